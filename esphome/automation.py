@@ -47,7 +47,14 @@ def maybe_conf(conf, *validators):
     return validate
 
 
-def register_action(name, action_type, schema):
+def register_action(name, action_type, schema, *, synchronous=False):
+    """Register an action.
+
+    Actions that always finish within their play() are marked synchronous, an automation
+    made of only such actions plays them in a single loop instead of through the chain.
+    """
+    if synchronous:
+        SYNCHRONOUS_ACTIONS.add(name)
     return ACTION_REGISTRY.register(name, action_type, schema)
 
 
@@ -58,6 +65,7 @@ def register_condition(name, condition_type, schema):
 Action = cg.esphome_ns.class_("Action")
 Trigger = cg.esphome_ns.class_("Trigger")
 ACTION_REGISTRY = Registry()
+SYNCHRONOUS_ACTIONS = set()
 Condition = cg.esphome_ns.class_("Condition")
 CONDITION_REGISTRY = Registry()
 validate_action = cv.validate_registry_entry("action", ACTION_REGISTRY)
@@ -303,7 +311,7 @@ async def wait_until_action_to_code(config, action_id, template_arg, args):
     return var
 
 
-@register_action("lambda", LambdaAction, cv.lambda_)
+@register_action("lambda", LambdaAction, cv.lambda_, synchronous=True)
 async def lambda_action_to_code(config, action_id, template_arg, args):
     lambda_ = await cg.process_lambda(config, args, return_type=cg.void)
     return cg.new_Pvariable(action_id, template_arg, lambda_)
@@ -317,6 +325,7 @@ async def lambda_action_to_code(config, action_id, template_arg, args):
             cv.Required(CONF_ID): cv.use_id(cg.PollingComponent),
         }
     ),
+    synchronous=True,
 )
 async def component_update_action_to_code(config, action_id, template_arg, args):
     comp = await cg.get_variable(config[CONF_ID])
@@ -331,6 +340,7 @@ async def component_update_action_to_code(config, action_id, template_arg, args)
             cv.Required(CONF_ID): cv.use_id(cg.PollingComponent),
         }
     ),
+    synchronous=True,
 )
 async def component_suspend_action_to_code(config, action_id, template_arg, args):
     comp = await cg.get_variable(config[CONF_ID])
@@ -348,6 +358,7 @@ async def component_suspend_action_to_code(config, action_id, template_arg, args
             ),
         }
     ),
+    synchronous=True,
 )
 async def component_resume_action_to_code(config, action_id, template_arg, args):
     comp = await cg.get_variable(config[CONF_ID])
@@ -400,4 +411,10 @@ async def build_automation(trigger, args, config):
     obj = cg.new_Pvariable(config[CONF_AUTOMATION_ID], templ, trigger)
     actions = await build_action_list(config[CONF_THEN], templ, args)
     cg.add(obj.add_actions(actions))
+    if actions and all(
+        cg.extract_registry_entry_config(ACTION_REGISTRY, conf)[0].name
+        in SYNCHRONOUS_ACTIONS
+        for conf in config[CONF_THEN]
+    ):
+        cg.add(obj.set_synchronous(True))
     return obj
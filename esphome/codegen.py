@@ -48,6 +48,7 @@ from esphome.cpp_helpers import (  # noqa: F401
     past_safe_mode,
     register_component,
     register_parented,
+    register_update_group,
 )
 from esphome.cpp_types import (  # noqa: F401
     NAN,
@@ -63,6 +64,7 @@ from esphome.cpp_types import (  # noqa: F401
     InternalGPIOPin,
     JsonObject,
     JsonObjectConst,
+    MeasuringComponent,
     Parented,
     PollingComponent,
     arduino_json_ns,
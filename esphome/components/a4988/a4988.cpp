@@ -1,11 +1,23 @@
 #include "a4988.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace a4988 {
 
 static const char *const TAG = "a4988.stepper";
 
+#ifdef USE_ESP32
+// The timer counts at 10 MHz
+static const uint32_t TIMER_DIVIDER = 8;
+static const float TIMER_FREQUENCY = 80e6f / TIMER_DIVIDER;
+// Length of the step pulses and the time between a direction change and the next step, 2us
+static const uint32_t PULSE_TICKS = 20;
+// While there are no steps to make, check again every 100ms
+static const uint32_t IDLE_TICKS = 1000000;
+#endif
+
 void A4988::setup() {
   ESP_LOGCONFIG(TAG, "Setting up A4988...");
   if (this->sleep_pin_ != nullptr) {
@@ -17,12 +29,20 @@ void A4988::setup() {
   this->step_pin_->digital_write(false);
   this->dir_pin_->setup();
   this->dir_pin_->digital_write(false);
+#ifdef USE_ESP32
+  if (this->hardware_timer_ && !this->init_timer_())
+    this->mark_failed();
+#endif
 }
 void A4988::dump_config() {
   ESP_LOGCONFIG(TAG, "A4988:");
   LOG_PIN("  Step Pin: ", this->step_pin_);
   LOG_PIN("  Dir Pin: ", this->dir_pin_);
   LOG_PIN("  Sleep Pin: ", this->sleep_pin_);
+#ifdef USE_ESP32
+  if (this->hardware_timer_)
+    ESP_LOGCONFIG(TAG, "  Hardware Timer: %d:%d", this->timer_group_, this->timer_idx_);
+#endif
   LOG_STEPPER(this);
 }
 void A4988::loop() {
@@ -41,6 +61,13 @@ void A4988::loop() {
     this->high_freq_.start();
   }
 
+#ifdef USE_ESP32
+  if (this->hardware_timer_) {
+    this->update_timer_();
+    return;
+  }
+#endif
+
   int32_t dir = this->should_step_();
   if (dir == 0)
     return;
@@ -52,5 +79,109 @@ void A4988::loop() {
   this->step_pin_->digital_write(false);
 }
 
+#ifdef USE_ESP32
+bool A4988::init_timer_() {
+  // Take the first timer nobody initialized yet
+  bool timer_found = false;
+  for (int cur_timer = 0; cur_timer < SOC_TIMER_GROUP_TOTAL_TIMERS; cur_timer++) {
+    timer_config_t temp_config;
+    this->timer_group_ = cur_timer < 2 ? TIMER_GROUP_0 : TIMER_GROUP_1;
+    this->timer_idx_ = cur_timer < 2 ? (timer_idx_t) cur_timer : (timer_idx_t) (cur_timer - 2);
+    if (timer_get_config(this->timer_group_, this->timer_idx_, &temp_config) == ESP_ERR_INVALID_ARG) {
+      timer_found = true;
+      break;
+    }
+  }
+  if (!timer_found) {
+    ESP_LOGE(TAG, "No free hardware timer");
+    return false;
+  }
+
+  timer_config_t config{};
+  config.alarm_en = TIMER_ALARM_EN;
+  config.counter_en = TIMER_PAUSE;
+  config.intr_type = TIMER_INTR_LEVEL;
+  config.counter_dir = TIMER_COUNT_UP;
+  config.auto_reload = TIMER_AUTORELOAD_EN;
+#if ESP_IDF_VERSION_MAJOR >= 5
+  config.clk_src = TIMER_SRC_CLK_DEFAULT;
+#endif
+  config.divider = TIMER_DIVIDER;
+  esp_err_t err = timer_init(this->timer_group_, this->timer_idx_, &config);
+  if (err == ESP_OK)
+    err = timer_set_counter_value(this->timer_group_, this->timer_idx_, 0);
+  if (err == ESP_OK)
+    err = timer_set_alarm_value(this->timer_group_, this->timer_idx_, IDLE_TICKS);
+  if (err == ESP_OK) {
+    err = timer_isr_callback_add(this->timer_group_, this->timer_idx_,
+                                 reinterpret_cast<bool (*)(void *)>(A4988::timer_isr), this, 0);
+  }
+  if (err == ESP_OK)
+    err = timer_start(this->timer_group_, this->timer_idx_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Setting up the hardware timer failed: %s", esp_err_to_name(err));
+    return false;
+  }
+  return true;
+}
+
+void A4988::update_timer_() {
+  // The velocity profile only changes gradually, so it's fine to keep calculating it at the loop() rate
+  this->calculate_speed_(micros());
+  uint32_t interval = 0;
+  if (this->current_speed_ > 0.0f) {
+    const float ticks = TIMER_FREQUENCY / this->current_speed_;
+    interval = ticks >= float(UINT32_MAX) ? UINT32_MAX : std::max<uint32_t>(ticks, 2 * PULSE_TICKS);
+  }
+  this->step_interval_ = interval;
+
+  if (interval != 0 && this->timer_idle_) {
+    // Don't wait for the next idle check before the first step
+    InterruptLock lock;
+    this->timer_idle_ = false;
+    timer_pause(this->timer_group_, this->timer_idx_);
+    timer_set_counter_value(this->timer_group_, this->timer_idx_, 0);
+    timer_set_alarm_value(this->timer_group_, this->timer_idx_, PULSE_TICKS);
+    timer_start(this->timer_group_, this->timer_idx_);
+  }
+}
+
+void IRAM_ATTR A4988::set_alarm_(uint64_t ticks) {
+  timer_group_set_alarm_value_in_isr(this->timer_group_, this->timer_idx_, ticks);
+}
+
+bool IRAM_ATTR A4988::timer_isr(A4988 *arg) {
+  if (arg->step_pin_high_) {
+    // End of the pulse, wait for the rest of the step interval
+    arg->isr_step_pin_.digital_write(false);
+    arg->step_pin_high_ = false;
+    const uint32_t interval = arg->step_interval_;
+    arg->set_alarm_(interval > 2 * PULSE_TICKS ? interval - PULSE_TICKS : PULSE_TICKS);
+    return false;
+  }
+
+  if (arg->step_interval_ == 0 || arg->current_position == arg->target_position) {
+    arg->timer_idle_ = true;
+    arg->set_alarm_(IDLE_TICKS);
+    return false;
+  }
+
+  const bool dir = arg->target_position > arg->current_position;
+  if (dir != arg->dir_state_) {
+    // The driver needs the direction to settle before the next step
+    arg->isr_dir_pin_.digital_write(dir);
+    arg->dir_state_ = dir;
+    arg->set_alarm_(PULSE_TICKS);
+    return false;
+  }
+
+  arg->isr_step_pin_.digital_write(true);
+  arg->step_pin_high_ = true;
+  arg->current_position += dir ? 1 : -1;
+  arg->set_alarm_(PULSE_TICKS);
+  return false;
+}
+#endif
+
 }  // namespace a4988
 }  // namespace esphome
@@ -4,6 +4,10 @@
 #include "esphome/core/hal.h"
 #include "esphome/components/stepper/stepper.h"
 
+#ifdef USE_ESP32
+#include "driver/timer.h"
+#endif
+
 namespace esphome {
 namespace a4988 {
 
@@ -12,12 +16,39 @@ class A4988 : public stepper::Stepper, public Component {
   void set_step_pin(GPIOPin *step_pin) { step_pin_ = step_pin; }
   void set_dir_pin(GPIOPin *dir_pin) { dir_pin_ = dir_pin; }
   void set_sleep_pin(GPIOPin *sleep_pin) { this->sleep_pin_ = sleep_pin; }
+#ifdef USE_ESP32
+  /// Emit the steps from a hardware timer interrupt, instead of from loop().
+  void set_hardware_timer(InternalGPIOPin *step_pin, InternalGPIOPin *dir_pin) {
+    this->hardware_timer_ = true;
+    this->isr_step_pin_ = step_pin->to_isr();
+    this->isr_dir_pin_ = dir_pin->to_isr();
+  }
+#endif
   void setup() override;
   void dump_config() override;
   void loop() override;
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
  protected:
+#ifdef USE_ESP32
+  bool init_timer_();
+  /// Passes the speed from the profile calculated in loop() on to the timer interrupt.
+  void update_timer_();
+  static bool timer_isr(A4988 *arg);
+  void set_alarm_(uint64_t ticks);
+
+  bool hardware_timer_{false};
+  ISRInternalGPIOPin isr_step_pin_;
+  ISRInternalGPIOPin isr_dir_pin_;
+  timer_group_t timer_group_{TIMER_GROUP_0};
+  timer_idx_t timer_idx_{TIMER_0};
+  /// Timer ticks between two steps, 0 while the stepper doesn't move
+  volatile uint32_t step_interval_{0};
+  /// Set by the interrupt when it had nothing to do and slowed down
+  volatile bool timer_idle_{true};
+  bool step_pin_high_{false};
+  bool dir_state_{false};
+#endif
   GPIOPin *step_pin_;
   GPIOPin *dir_pin_;
   GPIOPin *sleep_pin_{nullptr};
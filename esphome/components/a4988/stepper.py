@@ -3,19 +3,41 @@ from esphome.components import stepper
 import esphome.config_validation as cv
 import esphome.codegen as cg
 from esphome.const import CONF_DIR_PIN, CONF_ID, CONF_SLEEP_PIN, CONF_STEP_PIN
+from esphome.core import CORE
 
+CONF_HARDWARE_TIMER = "hardware_timer"
 
 a4988_ns = cg.esphome_ns.namespace("a4988")
 A4988 = a4988_ns.class_("A4988", stepper.Stepper, cg.Component)
 
-CONFIG_SCHEMA = stepper.STEPPER_SCHEMA.extend(
-    {
-        cv.Required(CONF_ID): cv.declare_id(A4988),
-        cv.Required(CONF_STEP_PIN): pins.gpio_output_pin_schema,
-        cv.Required(CONF_DIR_PIN): pins.gpio_output_pin_schema,
-        cv.Optional(CONF_SLEEP_PIN): pins.gpio_output_pin_schema,
-    }
-).extend(cv.COMPONENT_SCHEMA)
+
+
+def validate_hardware_timer(config):
+    if not config.get(CONF_HARDWARE_TIMER, False):
+        return config
+    for key in (CONF_STEP_PIN, CONF_DIR_PIN):
+        # The timer interrupt can only drive the chip's own pins
+        if pins.PIN_SCHEMA_REGISTRY.get_key(config[key]) != CORE.target_platform:
+            raise cv.Invalid(
+                f"'{CONF_HARDWARE_TIMER}' requires an internal GPIO", path=[key]
+            )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    stepper.STEPPER_SCHEMA.extend(
+        {
+            cv.Required(CONF_ID): cv.declare_id(A4988),
+            cv.Required(CONF_STEP_PIN): pins.gpio_output_pin_schema,
+            cv.Required(CONF_DIR_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_SLEEP_PIN): pins.gpio_output_pin_schema,
+            cv.Optional(CONF_HARDWARE_TIMER): cv.All(
+                cv.boolean, cv.only_on_esp32
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    validate_hardware_timer,
+)
 
 
 async def to_code(config):
@@ -27,6 +49,8 @@ async def to_code(config):
     cg.add(var.set_step_pin(step_pin))
     dir_pin = await cg.gpio_pin_expression(config[CONF_DIR_PIN])
     cg.add(var.set_dir_pin(dir_pin))
+    if config.get(CONF_HARDWARE_TIMER, False):
+        cg.add(var.set_hardware_timer(step_pin, dir_pin))
 
     if sleep_pin_config := config.get(CONF_SLEEP_PIN):
         sleep_pin = await cg.gpio_pin_expression(sleep_pin_config)
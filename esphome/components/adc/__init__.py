@@ -1,7 +1,8 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome import pins
-from esphome.const import CONF_ANALOG, CONF_INPUT, CONF_NUMBER
+from esphome.const import CONF_ANALOG, CONF_INPUT, CONF_NUMBER, CONF_PIN, CONF_PLATFORM
 
 from esphome.core import CORE
 from esphome.components.esp32 import get_esp32_variant
@@ -156,6 +157,29 @@ ESP32_VARIANT_ADC2_PIN_TO_CHANNEL = {
     VARIANT_ESP32H2: {},
 }
 
+# Variants whose ADC1 can sample continuously with DMA through the driver in use
+CONTINUOUS_VARIANTS = [VARIANT_ESP32, VARIANT_ESP32C3, VARIANT_ESP32S2, VARIANT_ESP32S3]
+
+
+def validate_continuous_pin(pin):
+    """Check in a final validation that an ADC pin can be sampled continuously."""
+    variant = get_esp32_variant()
+    if variant not in CONTINUOUS_VARIANTS:
+        raise cv.Invalid(f"{variant} doesn't support continuous ADC sampling")
+    if pin[CONF_NUMBER] not in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[variant]:
+        raise cv.Invalid("Continuous sampling is only supported on ADC1 pins")
+    # The DMA controller takes over ADC1, so it can't be read one sample at a time
+    for sensor_config in fv.full_config.get().get("sensor", []):
+        if (
+            sensor_config[CONF_PLATFORM] == "adc"
+            and "continuous" not in sensor_config
+            and sensor_config[CONF_PIN][CONF_NUMBER]
+            in ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[variant]
+        ):
+            raise cv.Invalid(
+                "All ADC1 sensors must use continuous mode when one of them does"
+            )
+
 
 def validate_adc_pin(value):
     if str(value).upper() == "VCC":
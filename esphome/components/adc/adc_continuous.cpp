@@ -0,0 +1,165 @@
+#include "adc_continuous.h"
+
+#if defined(USE_ESP32) && defined(USE_ADC_CONTINUOUS)
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace adc {
+
+static const char *const TAG = "adc.continuous";
+
+// Buffer about 100ms of conversions in the driver, so the main loop doesn't need to run at a high frequency
+static const uint32_t STORE_MIN_SIZE = 1024;
+static const uint32_t STORE_MAX_SIZE = 16384;
+
+ADCContinuousReader *ADCContinuousReader::get_instance() {
+  static ADCContinuousReader *instance = new ADCContinuousReader();  // NOLINT(cppcoreguidelines-owning-memory)
+  return instance;
+}
+
+void ADCContinuousReader::add_channel(adc1_channel_t channel, adc_atten_t attenuation, uint32_t sample_rate,
+                                      ADCContinuousListener *listener) {
+  for (auto &chan : this->channels_) {
+    if (chan.channel == channel && chan.attenuation != attenuation) {
+      ESP_LOGW(TAG, "ADC1 channel %d is already sampled with another attenuation", channel);
+      attenuation = chan.attenuation;
+    }
+  }
+  this->channels_.push_back({channel, attenuation, listener});
+  this->sample_rate_ = std::max(this->sample_rate_, sample_rate);
+}
+
+bool ADCContinuousReader::start() {
+  if (this->started_)
+    return true;
+  if (this->failed_ || this->channels_.empty())
+    return false;
+
+  // Every channel appears once in the pattern, sensors sampling the same channel share its conversions
+  std::vector<adc_digi_pattern_config_t> pattern;
+  uint32_t adc1_chan_mask = 0;
+  for (auto &chan : this->channels_) {
+    if (adc1_chan_mask & (1 << chan.channel))
+      continue;
+    adc1_chan_mask |= 1 << chan.channel;
+
+    adc_digi_pattern_config_t entry{};
+    entry.atten = chan.attenuation;
+    entry.channel = chan.channel;
+    entry.unit = 0;  // ADC1
+    entry.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+    pattern.push_back(entry);
+  }
+  if (pattern.size() > SOC_ADC_PATT_LEN_MAX) {
+    ESP_LOGE(TAG, "Too many channels for continuous sampling: %u", (unsigned) pattern.size());
+    this->failed_ = true;
+    return false;
+  }
+
+  // The channels are converted in turn, so every channel is sampled at the requested rate
+  uint32_t frequency = clamp<uint32_t>(this->sample_rate_ * pattern.size(), SOC_ADC_SAMPLE_FREQ_THRES_LOW,
+                                       SOC_ADC_SAMPLE_FREQ_THRES_HIGH);
+  uint32_t store_size = frequency * sizeof(adc_digi_output_data_t) / 10;
+  store_size = clamp(store_size, STORE_MIN_SIZE, STORE_MAX_SIZE);
+  // The driver hands the data out in chunks of conv_num_each_intr bytes
+  this->store_size_ = (store_size + sizeof(this->buffer_) - 1) / sizeof(this->buffer_) * sizeof(this->buffer_);
+
+  adc_digi_init_config_t init_config{};
+  init_config.max_store_buf_size = this->store_size_;
+  init_config.conv_num_each_intr = sizeof(this->buffer_);
+  init_config.adc1_chan_mask = adc1_chan_mask;
+  init_config.adc2_chan_mask = 0;
+  esp_err_t err = adc_digi_initialize(&init_config);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Initializing continuous sampling failed: %s", esp_err_to_name(err));
+    this->failed_ = true;
+    return false;
+  }
+
+  adc_digi_configure_t config{};
+  config.conv_limit_num = 250;
+#if defined(USE_ESP32_VARIANT_ESP32) || defined(USE_ESP32_VARIANT_ESP32S2)
+  config.conv_limit_en = true;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+#else
+  config.conv_limit_en = false;
+  config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+#endif
+  config.pattern_num = pattern.size();
+  config.adc_pattern = pattern.data();
+  config.sample_freq_hz = frequency;
+  config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+  err = adc_digi_controller_configure(&config);
+  if (err == ESP_OK)
+    err = adc_digi_start();
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Starting continuous sampling failed: %s", esp_err_to_name(err));
+    adc_digi_deinitialize();
+    this->failed_ = true;
+    return false;
+  }
+
+  this->channel_sample_rate_ = frequency / pattern.size();
+  ESP_LOGD(TAG, "Sampling %u channels at %" PRIu32 " Hz", (unsigned) pattern.size(), this->channel_sample_rate_);
+  this->started_ = true;
+  return true;
+}
+
+void ADCContinuousReader::drain() {
+  if (!this->start())
+    return;
+
+  // Read at most the driver's buffer size, so drain() returns even if conversions come in faster than they're handled
+  for (uint32_t total = 0; total < this->store_size_; total += sizeof(this->buffer_)) {
+    uint32_t length = 0;
+    esp_err_t err = adc_digi_read_bytes(this->buffer_, sizeof(this->buffer_), &length, 0);
+    if (err == ESP_ERR_INVALID_STATE) {
+      // The driver's buffer overflowed, the data read is still valid
+      ESP_LOGV(TAG, "Conversions were dropped");
+    } else if (err != ESP_OK) {
+      break;
+    }
+
+    for (uint32_t i = 0; i + sizeof(adc_digi_output_data_t) <= length; i += sizeof(adc_digi_output_data_t)) {
+      const auto *data = reinterpret_cast<const adc_digi_output_data_t *>(&this->buffer_[i]);
+#if defined(USE_ESP32_VARIANT_ESP32) || defined(USE_ESP32_VARIANT_ESP32S2)
+      const uint32_t channel = data->type1.channel;
+      const uint16_t raw = data->type1.data;
+#else
+      if (data->type2.unit != 0)
+        continue;
+      const uint32_t channel = data->type2.channel;
+      const uint16_t raw = data->type2.data;
+#endif
+      for (auto &chan : this->channels_) {
+        if (chan.channel == channel)
+          chan.listener->on_conversion(chan.channel, raw);
+      }
+    }
+
+    if (length < sizeof(this->buffer_))
+      break;
+  }
+}
+
+float ADCContinuousReader::get_mv_per_count(adc_atten_t attenuation) {
+  // The calibration covers the one-shot conversions, which may have more bits than the DMA ones
+#if USE_ESP32_VARIANT_ESP32S2
+  const uint32_t calibration_bits = 13;
+#else
+  const uint32_t calibration_bits = 12;
+#endif
+  esp_adc_cal_characteristics_t cal{};
+  esp_adc_cal_characterize(ADC_UNIT_1, attenuation, static_cast<adc_bits_width_t>(ADC_WIDTH_MAX - 1), 1100, &cal);
+  const uint32_t max_raw = (1 << calibration_bits) - 1;
+  const float slope =
+      (esp_adc_cal_raw_to_voltage(max_raw, &cal) - esp_adc_cal_raw_to_voltage(0, &cal)) / float(max_raw);
+  return slope * (1 << (calibration_bits - SOC_ADC_DIGI_MAX_BITWIDTH));
+}
+
+}  // namespace adc
+}  // namespace esphome
+
+#endif  // USE_ESP32 && USE_ADC_CONTINUOUS
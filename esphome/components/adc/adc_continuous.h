@@ -0,0 +1,88 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_ESP32) && defined(USE_ADC_CONTINUOUS)
+
+#include <esp_adc_cal.h>
+#include "driver/adc.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace adc {
+
+/// Receives the conversions of the channels it registered for, in the order the controller made them.
+class ADCContinuousListener {
+ public:
+  virtual void on_conversion(adc1_channel_t channel, uint16_t raw) = 0;
+};
+
+/// Running statistics of the samples of one channel, in raw ADC counts.
+struct ADCChannelStats : public ADCContinuousListener {
+  uint32_t count{0};
+  uint64_t sum{0};
+  uint64_t sum_squares{0};
+  uint16_t min{UINT16_MAX};
+  uint16_t max{0};
+
+  void on_conversion(adc1_channel_t channel, uint16_t raw) override {
+    this->count++;
+    this->sum += raw;
+    this->sum_squares += uint32_t(raw) * raw;
+    if (raw < this->min)
+      this->min = raw;
+    if (raw > this->max)
+      this->max = raw;
+  }
+  void reset() { *this = ADCChannelStats{}; }
+};
+
+/** Samples ADC1 channels continuously with DMA.
+ *
+ * The driver converts the registered channels in turn at a fixed rate and buffers the results, drain() then adds them
+ * to the statistics of each channel. The chip only has one DMA capable ADC controller, so all continuous ADC sensors
+ * share a single instance.
+ */
+class ADCContinuousReader {
+ public:
+  static ADCContinuousReader *get_instance();
+
+  /// Registers a listener for a channel sampled at least at sample_rate Hz. Must happen before start().
+  void add_channel(adc1_channel_t channel, adc_atten_t attenuation, uint32_t sample_rate,
+                   ADCContinuousListener *listener);
+
+  /// Starts the conversions, unless they are already running.
+  /// @return Whether the conversions are running.
+  bool start();
+
+  /// Passes the samples converted since the last call to the listeners.
+  void drain();
+
+  /// The rate at which every channel is actually sampled, in Hz. Only known once the conversions run.
+  uint32_t get_channel_sample_rate() const { return this->channel_sample_rate_; }
+
+  /// Average slope of the eFuse calibration of ADC1 for the conversions of the DMA controller, in mV per count.
+  static float get_mv_per_count(adc_atten_t attenuation);
+
+ protected:
+  struct Channel {
+    adc1_channel_t channel;
+    adc_atten_t attenuation;
+    ADCContinuousListener *listener;
+  };
+
+  std::vector<Channel> channels_;
+  uint32_t sample_rate_{0};
+  uint32_t channel_sample_rate_{0};
+  uint32_t store_size_{0};
+  bool started_{false};
+  bool failed_{false};
+  alignas(4) uint8_t buffer_[256];
+};
+
+}  // namespace adc
+}  // namespace esphome
+
+#endif  // USE_ESP32 && USE_ADC_CONTINUOUS
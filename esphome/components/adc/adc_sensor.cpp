@@ -80,6 +80,15 @@ extern "C"
     }
   }
 
+#ifdef USE_ADC_CONTINUOUS
+  if (this->continuous_sample_rate_ != 0) {
+    // The conversions start in the first loop(), after all continuous sensors registered their channels
+    ADCContinuousReader::get_instance()->add_channel(this->channel1_, this->attenuation_, this->continuous_sample_rate_,
+                                                     &this->continuous_stats_);
+  } else {
+    this->disable_loop();
+  }
+#endif
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
@@ -105,6 +114,13 @@ void ADCSensor::dump_config() {
 
 #ifdef USE_ESP32
   LOG_PIN("  Pin: ", this->pin_);
+#ifdef USE_ADC_CONTINUOUS
+  if (this->continuous_sample_rate_ != 0) {
+    static const char *const SAMPLING_MODES[] = {"mean", "min", "max", "rms", "ac_rms"};
+    ESP_LOGCONFIG(TAG, "  Continuous: %" PRIu32 " Hz, %s", this->continuous_sample_rate_,
+                  SAMPLING_MODES[this->sampling_mode_]);
+  }
+#endif
   if (this->autorange_) {
     ESP_LOGCONFIG(TAG, "  Attenuation: auto");
   } else {
@@ -175,6 +191,10 @@ float ADCSensor::sample() {
 
 #ifdef USE_ESP32
 float ADCSensor::sample() {
+#ifdef USE_ADC_CONTINUOUS
+  if (this->continuous_sample_rate_ != 0)
+    return this->sample_continuous_();
+#endif
   if (!this->autorange_) {
     uint32_t sum = 0;
     for (uint8_t sample = 0; sample < this->sample_count_; sample++) {
@@ -252,6 +272,50 @@ float ADCSensor::sample() {
   uint32_t mv_scaled = (mv12 * c12) + (mv6 * c6) + (mv2 * c2) + (mv0 * c0);
   return mv_scaled / (float) (csum * 1000U);
 }
+
+#ifdef USE_ADC_CONTINUOUS
+void ADCSensor::loop() { ADCContinuousReader::get_instance()->drain(); }
+
+float ADCSensor::sample_continuous_() {
+  ADCContinuousReader::get_instance()->drain();
+  ADCChannelStats &stats = this->continuous_stats_;
+  if (stats.count == 0)
+    return NAN;
+
+  // The DMA controller may convert with fewer bits than the calibration expects
+  const uint32_t scale = 1 << (SOC_ADC_RTC_MAX_BITWIDTH - SOC_ADC_DIGI_MAX_BITWIDTH);
+  const esp_adc_cal_characteristics_t *cal = &this->cal_characteristics_[(int32_t) this->attenuation_];
+  const double mean = double(stats.sum) / stats.count;
+  const double variance = std::max(0.0, double(stats.sum_squares) / stats.count - mean * mean);
+  // The spread of the samples is converted with the average slope of the calibration
+  const float mv_per_count =
+      (esp_adc_cal_raw_to_voltage(ADC_MAX, cal) - esp_adc_cal_raw_to_voltage(0, cal)) / float(ADC_MAX) * scale;
+  const float mean_mv = esp_adc_cal_raw_to_voltage(lround(mean * scale), cal);
+
+  float mv;
+  switch (this->sampling_mode_) {
+    case SAMPLING_MODE_MIN:
+      mv = esp_adc_cal_raw_to_voltage(stats.min * scale, cal);
+      break;
+    case SAMPLING_MODE_MAX:
+      mv = esp_adc_cal_raw_to_voltage(stats.max * scale, cal);
+      break;
+    case SAMPLING_MODE_RMS:
+      mv = std::sqrt(mean_mv * mean_mv + variance * mv_per_count * mv_per_count);
+      break;
+    case SAMPLING_MODE_AC_RMS:
+      mv = std::sqrt(variance) * mv_per_count;
+      break;
+    case SAMPLING_MODE_MEAN:
+    default:
+      mv = mean_mv;
+      break;
+  }
+  ESP_LOGV(TAG, "'%s': Aggregated %" PRIu32 " samples", this->get_name().c_str(), stats.count);
+  stats.reset();
+  return mv / 1000.0f;
+}
+#endif  // USE_ADC_CONTINUOUS
 #endif  // USE_ESP32
 
 #ifdef USE_RP2040
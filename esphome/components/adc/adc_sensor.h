@@ -11,6 +11,10 @@
 #include "driver/adc.h"
 #endif
 
+#ifdef USE_ADC_CONTINUOUS
+#include "adc_continuous.h"
+#endif
+
 namespace esphome {
 namespace adc {
 
@@ -29,6 +33,18 @@ static const adc_atten_t ADC_ATTEN_DB_12_COMPAT = ADC_ATTEN_DB_11;
 #endif
 #endif  // USE_ESP32
 
+#ifdef USE_ADC_CONTINUOUS
+/// The aggregate of the samples taken in continuous mode that is reported.
+enum SamplingMode : uint8_t {
+  SAMPLING_MODE_MEAN,
+  SAMPLING_MODE_MIN,
+  SAMPLING_MODE_MAX,
+  SAMPLING_MODE_RMS,
+  /// RMS with the mean removed, for example for a current clamp on the ADC's mid-point
+  SAMPLING_MODE_AC_RMS,
+};
+#endif
+
 class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage_sampler::VoltageSampler {
  public:
 #ifdef USE_ESP32
@@ -45,6 +61,15 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   void set_autorange(bool autorange) { this->autorange_ = autorange; }
 #endif
 
+#ifdef USE_ADC_CONTINUOUS
+  /// Sample the channel continuously with DMA, at sample_rate Hz, and report the given aggregate of the samples.
+  void set_continuous(uint32_t sample_rate, SamplingMode sampling_mode) {
+    this->continuous_sample_rate_ = sample_rate;
+    this->sampling_mode_ = sampling_mode;
+  }
+  void loop() override;
+#endif
+
   /// Update ADC values
   void update() override;
   /// Setup ADC
@@ -79,6 +104,14 @@ class ADCSensor : public sensor::Sensor, public PollingComponent, public voltage
   adc1_channel_t channel1_{ADC1_CHANNEL_MAX};
   adc2_channel_t channel2_{ADC2_CHANNEL_MAX};
   bool autorange_{false};
+#ifdef USE_ADC_CONTINUOUS
+  /// Aggregates the samples taken since the last call and starts a new block.
+  float sample_continuous_();
+
+  uint32_t continuous_sample_rate_{0};
+  SamplingMode sampling_mode_{SAMPLING_MODE_MEAN};
+  ADCChannelStats continuous_stats_;
+#endif
 #if ESP_IDF_VERSION_MAJOR >= 5
   esp_adc_cal_characteristics_t cal_characteristics_[SOC_ADC_ATTEN_NUM] = {};
 #else
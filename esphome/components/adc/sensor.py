@@ -12,6 +12,7 @@ from esphome.const import (
     CONF_NUMBER,
     CONF_PIN,
     CONF_RAW,
+    CONF_SAMPLE_RATE,
     CONF_WIFI,
     DEVICE_CLASS_VOLTAGE,
     STATE_CLASS_MEASUREMENT,
@@ -23,13 +24,25 @@ from . import (
     ESP32_VARIANT_ADC2_PIN_TO_CHANNEL,
     adc_ns,
     validate_adc_pin,
+    validate_continuous_pin,
 )
 
 _LOGGER = logging.getLogger(__name__)
 
 AUTO_LOAD = ["voltage_sampler"]
 
+CONF_CONTINUOUS = "continuous"
 CONF_SAMPLES = "samples"
+CONF_SAMPLING_MODE = "sampling_mode"
+
+SamplingMode = adc_ns.enum("SamplingMode")
+SAMPLING_MODES = {
+    "mean": SamplingMode.SAMPLING_MODE_MEAN,
+    "min": SamplingMode.SAMPLING_MODE_MIN,
+    "max": SamplingMode.SAMPLING_MODE_MAX,
+    "rms": SamplingMode.SAMPLING_MODE_RMS,
+    "ac_rms": SamplingMode.SAMPLING_MODE_AC_RMS,
+}
 
 
 _attenuation = cv.enum(ATTENUATION_MODES, lower=True)
@@ -50,6 +63,17 @@ def validate_config(config):
         # Alter value here so `config` command prints the recommended change
         config[CONF_ATTENUATION] = _attenuation("12db")
 
+    if CONF_CONTINUOUS in config:
+        if config[CONF_RAW]:
+            raise cv.Invalid("Raw output cannot be used in continuous mode")
+        if config.get(CONF_ATTENUATION) == "auto":
+            raise cv.Invalid("Automatic attenuation cannot be used in continuous mode")
+        if config[CONF_SAMPLES] > 1:
+            raise cv.Invalid(
+                "Multisampling cannot be used in continuous mode, "
+                f"use '{CONF_SAMPLING_MODE}' to aggregate the samples"
+            )
+
     return config
 
 
@@ -65,6 +89,9 @@ def final_validate_config(config):
                 f"{variant} doesn't support ADC on this pin when Wi-Fi is configured"
             )
 
+    if CONF_CONTINUOUS in config:
+        validate_continuous_pin(config[CONF_PIN])
+
     return config
 
 
@@ -88,6 +115,19 @@ CONFIG_SCHEMA = cv.All(
                 cv.only_on_esp32, _attenuation
             ),
             cv.Optional(CONF_SAMPLES, default=1): cv.int_range(min=1, max=255),
+            cv.Optional(CONF_CONTINUOUS): cv.All(
+                cv.only_on_esp32,
+                cv.Schema(
+                    {
+                        cv.Optional(CONF_SAMPLE_RATE, default="1kHz"): cv.All(
+                            cv.frequency, cv.int_range(min=100, max=100000)
+                        ),
+                        cv.Optional(CONF_SAMPLING_MODE, default="mean"): cv.enum(
+                            SAMPLING_MODES, lower=True
+                        ),
+                    }
+                ),
+            ),
         }
     )
     .extend(cv.polling_component_schema("60s")),
@@ -134,3 +174,11 @@ async def to_code(config):
         ):
             chan = ESP32_VARIANT_ADC2_PIN_TO_CHANNEL[variant][pin_num]
             cg.add(var.set_channel2(chan))
+
+        if continuous := config.get(CONF_CONTINUOUS):
+            cg.add_define("USE_ADC_CONTINUOUS")
+            cg.add(
+                var.set_continuous(
+                    continuous[CONF_SAMPLE_RATE], continuous[CONF_SAMPLING_MODE]
+                )
+            )
@@ -0,0 +1,145 @@
+#include "adc_power.h"
+
+#if defined(USE_ESP32) && defined(USE_ADC_CONTINUOUS)
+
+#include "esphome/core/log.h"
+
+#include <cmath>
+
+namespace esphome {
+namespace adc_power {
+
+static const char *const TAG = "adc_power";
+
+// The DC offsets follow the signals with a time constant of 2^OFFSET_SHIFT samples
+static const uint8_t OFFSET_SHIFT = 12;
+// The voltage has to move this many counts past the offset to count as a zero crossing, so noise doesn't
+static const int32_t ZERO_CROSSING_HYSTERESIS = 40;
+
+static int32_t remove_offset(int32_t &offset, uint16_t raw) {
+  const int32_t value = int32_t(raw) << 16;
+  if (offset < 0) {
+    // Start from the first sample, instead of waiting for the filter to settle
+    offset = value;
+  } else {
+    offset += (value - offset) >> OFFSET_SHIFT;
+  }
+  return int32_t(raw) - (offset >> 16);
+}
+
+void ADCPowerMeter::setup() {
+  this->voltage_pin_->setup();
+  this->current_pin_->setup();
+  this->mv_per_count_ = adc::ADCContinuousReader::get_mv_per_count(this->attenuation_);
+  // The voltage goes first, so the controller converts it right before the current
+  auto *reader = adc::ADCContinuousReader::get_instance();
+  reader->add_channel(this->voltage_channel_, this->attenuation_, this->sample_rate_, this);
+  reader->add_channel(this->current_channel_, this->attenuation_, this->sample_rate_, this);
+}
+
+void ADCPowerMeter::loop() { adc::ADCContinuousReader::get_instance()->drain(); }
+
+void ADCPowerMeter::dump_config() {
+  ESP_LOGCONFIG(TAG, "ADC Power Meter:");
+  LOG_PIN("  Voltage Pin: ", this->voltage_pin_);
+  LOG_PIN("  Current Pin: ", this->current_pin_);
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz", this->sample_rate_);
+  ESP_LOGCONFIG(TAG, "  Voltage Multiplier: %.3f", this->voltage_multiplier_);
+  ESP_LOGCONFIG(TAG, "  Current Multiplier: %.3f", this->current_multiplier_);
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Voltage", this->voltage_sensor_);
+  LOG_SENSOR("  ", "Current", this->current_sensor_);
+  LOG_SENSOR("  ", "Active Power", this->active_power_sensor_);
+  LOG_SENSOR("  ", "Apparent Power", this->apparent_power_sensor_);
+  LOG_SENSOR("  ", "Power Factor", this->power_factor_sensor_);
+  LOG_SENSOR("  ", "Frequency", this->frequency_sensor_);
+}
+
+void ADCPowerMeter::on_conversion(adc1_channel_t channel, uint16_t raw) {
+  if (channel == this->voltage_channel_) {
+    this->voltage_ = remove_offset(this->voltage_offset_, raw);
+    if (!this->voltage_positive_ && this->voltage_ > ZERO_CROSSING_HYSTERESIS) {
+      this->voltage_positive_ = true;
+      this->complete_cycle_(true);
+    } else if (this->voltage_positive_ && this->voltage_ < -ZERO_CROSSING_HYSTERESIS) {
+      this->voltage_positive_ = false;
+    }
+    return;
+  }
+  if (channel != this->current_channel_)
+    return;
+
+  const int32_t current = remove_offset(this->current_offset_, raw);
+  this->cycle_.voltage_squares += uint32_t(this->voltage_ * this->voltage_);
+  this->cycle_.current_squares += uint32_t(current * current);
+  this->cycle_.power += this->voltage_ * current;
+  this->cycle_.samples++;
+
+  // Without zero crossings, for example with nothing on the voltage pin, hand the samples over every 100ms
+  if (this->cycle_.samples >= adc::ADCContinuousReader::get_instance()->get_channel_sample_rate() / 10)
+    this->complete_cycle_(false);
+}
+
+void ADCPowerMeter::complete_cycle_(bool whole_cycle) {
+  // The samples before the first zero crossing are only part of a cycle
+  if (this->synchronized_ || !whole_cycle) {
+    this->total_.voltage_squares += this->cycle_.voltage_squares;
+    this->total_.current_squares += this->cycle_.current_squares;
+    this->total_.power += this->cycle_.power;
+    this->total_.samples += this->cycle_.samples;
+    if (whole_cycle) {
+      this->total_.cycles++;
+      this->total_.cycle_samples += this->cycle_.samples;
+    }
+  }
+  this->synchronized_ = whole_cycle;
+  this->cycle_ = Sums{};
+}
+
+void ADCPowerMeter::publish_nan_() {
+  for (auto *sens : {this->voltage_sensor_, this->current_sensor_, this->active_power_sensor_,
+                     this->apparent_power_sensor_, this->power_factor_sensor_, this->frequency_sensor_}) {
+    if (sens != nullptr)
+      sens->publish_state(NAN);
+  }
+}
+
+void ADCPowerMeter::update() {
+  adc::ADCContinuousReader::get_instance()->drain();
+  const Sums sums = this->total_;
+  this->total_ = Sums{};
+  if (sums.samples == 0) {
+    ESP_LOGW(TAG, "No samples since the last update");
+    this->publish_nan_();
+    return;
+  }
+
+  const float voltage_scale = this->mv_per_count_ / 1000.0f * this->voltage_multiplier_;
+  const float current_scale = this->mv_per_count_ / 1000.0f * this->current_multiplier_;
+  const float voltage = std::sqrt(double(sums.voltage_squares) / sums.samples) * voltage_scale;
+  const float current = std::sqrt(double(sums.current_squares) / sums.samples) * current_scale;
+  const float active_power = double(sums.power) / sums.samples * voltage_scale * current_scale;
+  const float apparent_power = voltage * current;
+  ESP_LOGV(TAG, "Got %" PRIu32 " samples over %" PRIu32 " cycles", sums.samples, sums.cycles);
+
+  if (this->voltage_sensor_ != nullptr)
+    this->voltage_sensor_->publish_state(voltage);
+  if (this->current_sensor_ != nullptr)
+    this->current_sensor_->publish_state(current);
+  if (this->active_power_sensor_ != nullptr)
+    this->active_power_sensor_->publish_state(active_power);
+  if (this->apparent_power_sensor_ != nullptr)
+    this->apparent_power_sensor_->publish_state(apparent_power);
+  if (this->power_factor_sensor_ != nullptr)
+    this->power_factor_sensor_->publish_state(apparent_power > 0.0f ? active_power / apparent_power : NAN);
+  if (this->frequency_sensor_ != nullptr) {
+    const uint32_t sample_rate = adc::ADCContinuousReader::get_instance()->get_channel_sample_rate();
+    this->frequency_sensor_->publish_state(
+        sums.cycles != 0 ? float(sums.cycles) * sample_rate / float(sums.cycle_samples) : NAN);
+  }
+}
+
+}  // namespace adc_power
+}  // namespace esphome
+
+#endif  // USE_ESP32 && USE_ADC_CONTINUOUS
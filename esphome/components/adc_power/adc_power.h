@@ -0,0 +1,108 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_ESP32) && defined(USE_ADC_CONTINUOUS)
+
+#include "esphome/components/adc/adc_continuous.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace adc_power {
+
+/** Meters a mains circuit from a voltage and a current channel of ADC1.
+ *
+ * Both channels are sampled continuously with DMA, each current sample is paired with the voltage sample converted
+ * right before it. The DC offset of both signals is tracked and removed, then the squares and products are summed in
+ * integers. The sums are only handed over to update() at rising zero crossings of the voltage, so every published
+ * value covers whole mains cycles.
+ */
+class ADCPowerMeter : public PollingComponent, public adc::ADCContinuousListener {
+ public:
+  void setup() override;
+  void loop() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void on_conversion(adc1_channel_t channel, uint16_t raw) override;
+
+  void set_voltage_pin(InternalGPIOPin *pin, adc1_channel_t channel) {
+    this->voltage_pin_ = pin;
+    this->voltage_channel_ = channel;
+  }
+  void set_current_pin(InternalGPIOPin *pin, adc1_channel_t channel) {
+    this->current_pin_ = pin;
+    this->current_channel_ = channel;
+  }
+  void set_attenuation(adc_atten_t attenuation) { this->attenuation_ = attenuation; }
+  void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
+  /// Volts on the mains per volt on the voltage pin.
+  void set_voltage_multiplier(float voltage_multiplier) { this->voltage_multiplier_ = voltage_multiplier; }
+  /// Amperes on the mains per volt on the current pin.
+  void set_current_multiplier(float current_multiplier) { this->current_multiplier_ = current_multiplier; }
+
+  void set_voltage_sensor(sensor::Sensor *voltage_sensor) { this->voltage_sensor_ = voltage_sensor; }
+  void set_current_sensor(sensor::Sensor *current_sensor) { this->current_sensor_ = current_sensor; }
+  void set_active_power_sensor(sensor::Sensor *active_power_sensor) {
+    this->active_power_sensor_ = active_power_sensor;
+  }
+  void set_apparent_power_sensor(sensor::Sensor *apparent_power_sensor) {
+    this->apparent_power_sensor_ = apparent_power_sensor;
+  }
+  void set_power_factor_sensor(sensor::Sensor *power_factor_sensor) {
+    this->power_factor_sensor_ = power_factor_sensor;
+  }
+  void set_frequency_sensor(sensor::Sensor *frequency_sensor) { this->frequency_sensor_ = frequency_sensor; }
+
+ protected:
+  struct Sums {
+    uint64_t voltage_squares{0};
+    uint64_t current_squares{0};
+    int64_t power{0};
+    uint32_t samples{0};
+    uint32_t cycles{0};
+    /// Samples that belong to whole cycles
+    uint32_t cycle_samples{0};
+  };
+
+  /// Moves the samples since the last zero crossing to the sums for update().
+  void complete_cycle_(bool whole_cycle);
+  void publish_nan_();
+
+  InternalGPIOPin *voltage_pin_{nullptr};
+  InternalGPIOPin *current_pin_{nullptr};
+  adc1_channel_t voltage_channel_{ADC1_CHANNEL_MAX};
+  adc1_channel_t current_channel_{ADC1_CHANNEL_MAX};
+  adc_atten_t attenuation_{ADC_ATTEN_DB_0};
+  uint32_t sample_rate_{10000};
+  float voltage_multiplier_{1.0f};
+  float current_multiplier_{1.0f};
+  float mv_per_count_{0.0f};
+
+  sensor::Sensor *voltage_sensor_{nullptr};
+  sensor::Sensor *current_sensor_{nullptr};
+  sensor::Sensor *active_power_sensor_{nullptr};
+  sensor::Sensor *apparent_power_sensor_{nullptr};
+  sensor::Sensor *power_factor_sensor_{nullptr};
+  sensor::Sensor *frequency_sensor_{nullptr};
+
+  /// DC offsets in counts, in Q16
+  int32_t voltage_offset_{-1};
+  int32_t current_offset_{-1};
+  int32_t voltage_{0};
+  bool voltage_positive_{false};
+  bool synchronized_{false};
+
+  /// Sums since the last rising zero crossing
+  Sums cycle_;
+  /// Sums of the whole cycles since the last update()
+  Sums total_;
+};
+
+}  // namespace adc_power
+}  // namespace esphome
+
+#endif  // USE_ESP32 && USE_ADC_CONTINUOUS
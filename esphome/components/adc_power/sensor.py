@@ -0,0 +1,149 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import sensor
+from esphome.components.adc import (
+    ATTENUATION_MODES,
+    ESP32_VARIANT_ADC1_PIN_TO_CHANNEL,
+    validate_adc_pin,
+    validate_continuous_pin,
+)
+from esphome.components.esp32 import get_esp32_variant
+from esphome.const import (
+    CONF_ACTIVE_POWER,
+    CONF_APPARENT_POWER,
+    CONF_ATTENUATION,
+    CONF_CURRENT,
+    CONF_FREQUENCY,
+    CONF_ID,
+    CONF_NUMBER,
+    CONF_POWER_FACTOR,
+    CONF_SAMPLE_RATE,
+    CONF_VOLTAGE,
+    DEVICE_CLASS_APPARENT_POWER,
+    DEVICE_CLASS_CURRENT,
+    DEVICE_CLASS_FREQUENCY,
+    DEVICE_CLASS_POWER,
+    DEVICE_CLASS_POWER_FACTOR,
+    DEVICE_CLASS_VOLTAGE,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_AMPERE,
+    UNIT_HERTZ,
+    UNIT_VOLT,
+    UNIT_VOLT_AMPS,
+    UNIT_WATT,
+)
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["esp32"]
+AUTO_LOAD = ["adc"]
+
+CONF_CURRENT_MULTIPLIER = "current_multiplier"
+CONF_CURRENT_PIN = "current_pin"
+CONF_VOLTAGE_MULTIPLIER = "voltage_multiplier"
+CONF_VOLTAGE_PIN = "voltage_pin"
+
+adc_power_ns = cg.esphome_ns.namespace("adc_power")
+ADCPowerMeter = adc_power_ns.class_("ADCPowerMeter", cg.PollingComponent)
+
+_ATTENUATION_MODES = {k: v for k, v in ATTENUATION_MODES.items() if k != "auto"}
+
+
+def validate_config(config):
+    if config[CONF_VOLTAGE_PIN][CONF_NUMBER] == config[CONF_CURRENT_PIN][CONF_NUMBER]:
+        raise cv.Invalid("The voltage and the current need their own pins")
+    return config
+
+
+def final_validate_config(config):
+    validate_continuous_pin(config[CONF_VOLTAGE_PIN])
+    validate_continuous_pin(config[CONF_CURRENT_PIN])
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(ADCPowerMeter),
+            cv.Required(CONF_VOLTAGE_PIN): validate_adc_pin,
+            cv.Required(CONF_CURRENT_PIN): validate_adc_pin,
+            cv.Optional(CONF_ATTENUATION, default="12db"): cv.enum(
+                _ATTENUATION_MODES, lower=True
+            ),
+            cv.Optional(CONF_SAMPLE_RATE, default="10kHz"): cv.All(
+                cv.frequency, cv.int_range(min=1000, max=100000)
+            ),
+            cv.Optional(CONF_VOLTAGE_MULTIPLIER, default=1.0): cv.float_,
+            cv.Optional(CONF_CURRENT_MULTIPLIER, default=1.0): cv.float_,
+            cv.Optional(CONF_VOLTAGE): sensor.sensor_schema(
+                unit_of_measurement=UNIT_VOLT,
+                accuracy_decimals=1,
+                device_class=DEVICE_CLASS_VOLTAGE,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+            cv.Optional(CONF_CURRENT): sensor.sensor_schema(
+                unit_of_measurement=UNIT_AMPERE,
+                accuracy_decimals=2,
+                device_class=DEVICE_CLASS_CURRENT,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+            cv.Optional(CONF_ACTIVE_POWER): sensor.sensor_schema(
+                unit_of_measurement=UNIT_WATT,
+                accuracy_decimals=1,
+                device_class=DEVICE_CLASS_POWER,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+            cv.Optional(CONF_APPARENT_POWER): sensor.sensor_schema(
+                unit_of_measurement=UNIT_VOLT_AMPS,
+                accuracy_decimals=1,
+                device_class=DEVICE_CLASS_APPARENT_POWER,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+            cv.Optional(CONF_POWER_FACTOR): sensor.sensor_schema(
+                accuracy_decimals=2,
+                device_class=DEVICE_CLASS_POWER_FACTOR,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+            cv.Optional(CONF_FREQUENCY): sensor.sensor_schema(
+                unit_of_measurement=UNIT_HERTZ,
+                accuracy_decimals=2,
+                device_class=DEVICE_CLASS_FREQUENCY,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    validate_config,
+)
+
+FINAL_VALIDATE_SCHEMA = final_validate_config
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add_define("USE_ADC_CONTINUOUS")
+
+    channels = ESP32_VARIANT_ADC1_PIN_TO_CHANNEL[get_esp32_variant()]
+    pin = await cg.gpio_pin_expression(config[CONF_VOLTAGE_PIN])
+    cg.add(
+        var.set_voltage_pin(pin, channels[config[CONF_VOLTAGE_PIN][CONF_NUMBER]])
+    )
+    pin = await cg.gpio_pin_expression(config[CONF_CURRENT_PIN])
+    cg.add(
+        var.set_current_pin(pin, channels[config[CONF_CURRENT_PIN][CONF_NUMBER]])
+    )
+    cg.add(var.set_attenuation(config[CONF_ATTENUATION]))
+    cg.add(var.set_sample_rate(config[CONF_SAMPLE_RATE]))
+    cg.add(var.set_voltage_multiplier(config[CONF_VOLTAGE_MULTIPLIER]))
+    cg.add(var.set_current_multiplier(config[CONF_CURRENT_MULTIPLIER]))
+
+    for key, setter in (
+        (CONF_VOLTAGE, var.set_voltage_sensor),
+        (CONF_CURRENT, var.set_current_sensor),
+        (CONF_ACTIVE_POWER, var.set_active_power_sensor),
+        (CONF_APPARENT_POWER, var.set_apparent_power_sensor),
+        (CONF_POWER_FACTOR, var.set_power_factor_sensor),
+        (CONF_FREQUENCY, var.set_frequency_sensor),
+    ):
+        if sensor_config := config.get(key):
+            sens = await sensor.new_sensor(sensor_config)
+            cg.add(setter(sens))
@@ -76,8 +76,8 @@ void ADS1115Component::dump_config() {
     ESP_LOGE(TAG, "Communication with ADS1115 failed!");
   }
 }
-float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
-                                            ADS1115Resolution resolution) {
+bool ADS1115Component::configure_conversion_(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
+                                             bool &conversion_running) {
   uint16_t config = this->prev_config_;
   // Multiplexer
   //        0bxBBBxxxxxxxxxxxx
@@ -94,13 +94,27 @@ float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1
     config |= 0b1000000000000000;
   }
 
+  conversion_running = false;
   if (!this->continuous_mode_ || this->prev_config_ != config) {
     if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
       this->status_set_warning();
-      return NAN;
+      return false;
     }
     this->prev_config_ = config;
+    conversion_running = true;
+  }
+  return true;
+}
+
+float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain,
+                                            ADS1115Resolution resolution) {
+  // Any conversion started with start_conversion() is replaced, its owner starts over
+  this->conversion_owner_ = nullptr;
+  bool conversion_running;
+  if (!this->configure_conversion_(multiplexer, gain, conversion_running))
+    return NAN;
 
+  if (conversion_running) {
     // about 1.2 ms with 860 samples per second
     delay(2);
 
@@ -109,6 +123,7 @@ float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1
     // can we use the rdy pin to trigger when a conversion is done?
     if (!this->continuous_mode_) {
       uint32_t start = millis();
+      uint16_t config;
       while (this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 0) {
         if (millis() - start > 100) {
           ESP_LOGW(TAG, "Reading ADS1115 timed out");
@@ -120,6 +135,32 @@ float ADS1115Component::request_measurement(ADS1115Multiplexer multiplexer, ADS1
     }
   }
 
+  return this->read_conversion(gain, resolution);
+}
+
+uint32_t ADS1115Component::start_conversion(const void *owner, ADS1115Multiplexer multiplexer, ADS1115Gain gain) {
+  if (this->conversion_owner_ != nullptr && this->conversion_owner_ != owner)
+    return MEASUREMENT_BUSY;
+  if (!this->configure_conversion_(multiplexer, gain, this->conversion_running_))
+    return MEASUREMENT_FAILED;
+  this->conversion_owner_ = owner;
+  // about 1.2 ms with 860 samples per second, continuous mode with unchanged settings has a result right away
+  return this->conversion_running_ ? 2 : 0;
+}
+
+bool ADS1115Component::is_conversion_ready() {
+  // in continuous mode, conversion will always be running, rely on the conversion time
+  // to ensure conversion is taking place with the correct settings
+  if (!this->conversion_running_ || this->continuous_mode_)
+    return true;
+  uint16_t config;
+  return this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 1;
+}
+
+float ADS1115Component::read_conversion(ADS1115Gain gain, ADS1115Resolution resolution) {
+  this->conversion_owner_ = nullptr;
+  this->conversion_running_ = false;
+
   uint16_t raw_conversion;
   if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
     this->status_set_warning();
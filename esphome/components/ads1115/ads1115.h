@@ -41,12 +41,31 @@ class ADS1115Component : public Component, public i2c::I2CDevice {
   float get_setup_priority() const override { return setup_priority::DATA; }
   void set_continuous_mode(bool continuous_mode) { continuous_mode_ = continuous_mode; }
 
-  /// Helper method to request a measurement from a sensor.
+  /// Helper method to request a measurement from a sensor, blocking until the conversion finished.
   float request_measurement(ADS1115Multiplexer multiplexer, ADS1115Gain gain, ADS1115Resolution resolution);
 
+  /** Start a conversion on behalf of owner without waiting for it.
+   *
+   * @return The time in ms until the conversion is expected to be ready, MEASUREMENT_BUSY while the conversion of
+   * another owner is running, or MEASUREMENT_FAILED.
+   */
+  uint32_t start_conversion(const void *owner, ADS1115Multiplexer multiplexer, ADS1115Gain gain);
+  /// Whether the conversion owner started is still the one running, a blocking request_measurement() replaces it
+  bool owns_conversion(const void *owner) const { return this->conversion_owner_ == owner; }
+  /// Whether the conversion started by start_conversion() finished
+  bool is_conversion_ready();
+  /// Read the result of the finished conversion and free the ADC for the next start_conversion()
+  float read_conversion(ADS1115Gain gain, ADS1115Resolution resolution);
+
  protected:
+  /// Write the configuration for the next conversion
+  /// @return false if writing failed, conversion_running is set when the conversion has to be waited for
+  bool configure_conversion_(ADS1115Multiplexer multiplexer, ADS1115Gain gain, bool &conversion_running);
+
   uint16_t prev_config_{0};
   bool continuous_mode_;
+  const void *conversion_owner_{nullptr};
+  bool conversion_running_{false};
 };
 
 }  // namespace ads1115
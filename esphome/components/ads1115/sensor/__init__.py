@@ -45,7 +45,7 @@ RESOLUTION = {
 
 
 ADS1115Sensor = ads1115_ns.class_(
-    "ADS1115Sensor", sensor.Sensor, cg.PollingComponent, voltage_sampler.VoltageSampler
+    "ADS1115Sensor", sensor.Sensor, cg.MeasuringComponent, voltage_sampler.VoltageSampler
 )
 
 CONFIG_SCHEMA = (
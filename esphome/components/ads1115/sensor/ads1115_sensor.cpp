@@ -1,5 +1,6 @@
 #include "ads1115_sensor.h"
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -11,12 +12,33 @@ float ADS1115Sensor::sample() {
   return this->parent_->request_measurement(this->multiplexer_, this->gain_, this->resolution_);
 }
 
-void ADS1115Sensor::update() {
-  float v = this->sample();
+uint32_t ADS1115Sensor::start_measurement() {
+  this->measurement_start_ = millis();
+  return this->parent_->start_conversion(this, this->multiplexer_, this->gain_);
+}
+
+bool ADS1115Sensor::collect_measurement() {
+  // A blocking sample() of another sensor took over the ADC, start over
+  if (!this->parent_->owns_conversion(this)) {
+    uint32_t wait = this->parent_->start_conversion(this, this->multiplexer_, this->gain_);
+    if (wait == MEASUREMENT_FAILED)
+      return true;
+    return false;
+  }
+  if (!this->parent_->is_conversion_ready()) {
+    if (millis() - this->measurement_start_ <= 100)
+      return false;
+    ESP_LOGW(TAG, "'%s': Reading ADS1115 timed out", this->get_name().c_str());
+    this->parent_->read_conversion(this->gain_, this->resolution_);
+    this->parent_->status_set_warning();
+    return true;
+  }
+  float v = this->parent_->read_conversion(this->gain_, this->resolution_);
   if (!std::isnan(v)) {
     ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
     this->publish_state(v);
   }
+  return true;
 }
 
 void ADS1115Sensor::dump_config() {
@@ -13,11 +13,10 @@ namespace ads1115 {
 
 /// Internal holder class that is in instance of Sensor so that the hub can create individual sensors.
 class ADS1115Sensor : public sensor::Sensor,
-                      public PollingComponent,
+                      public MeasuringComponent,
                       public voltage_sampler::VoltageSampler,
                       public Parented<ADS1115Component> {
  public:
-  void update() override;
   void set_multiplexer(ADS1115Multiplexer multiplexer) { this->multiplexer_ = multiplexer; }
   void set_gain(ADS1115Gain gain) { this->gain_ = gain; }
   void set_resolution(ADS1115Resolution resolution) { this->resolution_ = resolution; }
@@ -29,6 +28,10 @@ class ADS1115Sensor : public sensor::Sensor,
   ADS1115Multiplexer multiplexer_;
   ADS1115Gain gain_;
   ADS1115Resolution resolution_;
+  uint32_t measurement_start_{0};
+
+  uint32_t start_measurement() override;
+  bool collect_measurement() override;
 };
 
 }  // namespace ads1115
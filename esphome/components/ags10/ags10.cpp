@@ -197,18 +197,7 @@ template<size_t N> optional<std::array<uint8_t, N>> AGS10Component::read_and_che
 }
 
 template<size_t N> uint8_t AGS10Component::calc_crc8_(std::array<uint8_t, N> dat, uint8_t num) {
-  uint8_t i, byte1, crc = 0xFF;
-  for (byte1 = 0; byte1 < num; byte1++) {
-    crc ^= (dat[byte1]);
-    for (i = 0; i < 8; i++) {
-      if (crc & 0x80) {
-        crc = (crc << 1) ^ 0x31;
-      } else {
-        crc = (crc << 1);
-      }
-    }
-  }
-  return crc;
+  return crc8(dat.data(), num, 0xFF, 0x31, true);
 }
 }  // namespace ags10
 }  // namespace esphome
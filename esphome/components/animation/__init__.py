@@ -2,7 +2,7 @@ import logging
 
 from esphome import automation, core
 import esphome.codegen as cg
-from esphome.components import font
+from esphome.components import asset_partition, font
 import esphome.components.image as espImage
 from esphome.components.image import (
     CONF_USE_TRANSPARENCY,
@@ -36,6 +36,17 @@ CONF_LOOP = "loop"
 CONF_START_FRAME = "start_frame"
 CONF_END_FRAME = "end_frame"
 CONF_FRAME = "frame"
+CONF_DELTA_ENCODING = "delta_encoding"
+CONF_KEYFRAME_INTERVAL = "keyframe_interval"
+
+# Bytes per pixel of the types that can be delta encoded
+DELTA_BYTES_PER_PIXEL = {
+    "GRAYSCALE": 1,
+    "RGB565": 2,
+    "TRANSPARENT_IMAGE": 2,
+    "RGB24": 3,
+    "RGBA": 4,
+}
 
 animation_ns = cg.esphome_ns.namespace("animation")
 
@@ -103,6 +114,11 @@ def validate_cross_dependencies(config):
     if is_transparent_type and not config[CONF_USE_TRANSPARENCY]:
         raise cv.Invalid(f"Image type {image_type} must always be transparent.")
 
+    if config[CONF_DELTA_ENCODING] and image_type not in DELTA_BYTES_PER_PIXEL:
+        raise cv.Invalid(
+            f"Image type {image_type} can't be delta encoded.", [CONF_DELTA_ENCODING]
+        )
+
     return config
 
 
@@ -125,6 +141,8 @@ ANIMATION_SCHEMA = cv.Schema(
                     cv.Optional(CONF_REPEAT): cv.positive_int,
                 }
             ),
+            cv.Optional(CONF_DELTA_ENCODING, default=False): cv.boolean,
+            cv.Optional(CONF_KEYFRAME_INTERVAL, default=0): cv.positive_int,
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         },
         validate_cross_dependencies,
@@ -164,6 +182,108 @@ async def animation_action_to_code(config, action_id, template_arg, args):
     return var
 
 
+def _rle_encode(pixels):
+    """Run-length encode a list of pixels, each a tuple of bytes."""
+    out = []
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while run < 128 and i + run < len(pixels) and pixels[i + run] == pixels[i]:
+            run += 1
+        if run > 1:
+            out.append(0x80 | (run - 1))
+            out.extend(pixels[i])
+            i += run
+            continue
+        # Literal pixels until two equal ones follow each other
+        start = i
+        i += 1
+        while (
+            i < len(pixels)
+            and i - start < 128
+            and not (i + 1 < len(pixels) and pixels[i] == pixels[i + 1])
+        ):
+            i += 1
+        out.append(i - start - 1)
+        for pixel in pixels[start:i]:
+            out.extend(pixel)
+    return out
+
+
+def _encode_rect(pixels, width, x, y, w, h):
+    out = []
+    for value in (x, y, w, h):
+        out += [value & 0xFF, value >> 8]
+    rows = (pixels[(y + j) * width + x : (y + j) * width + x + w] for j in range(h))
+    return out + _rle_encode([pixel for row in rows for pixel in row])
+
+
+def _changed_rects(previous, current, width, height):
+    """Bands of neighbouring changed rows, each narrowed to the changed columns."""
+    rects = []
+    band = None
+    for y in range(height):
+        row = slice(y * width, (y + 1) * width)
+        changed = [
+            x for x, (a, b) in enumerate(zip(previous[row], current[row])) if a != b
+        ]
+        if not changed:
+            continue
+        # Rows with a single unchanged row in between still share a rectangle
+        if band is not None and y - band[3] <= 2:
+            band = [min(band[0], changed[0]), band[1], max(band[2], changed[-1]), y]
+        else:
+            if band is not None:
+                rects.append(band)
+            band = [changed[0], y, changed[-1], y]
+    if band is not None:
+        rects.append(band)
+    if len(rects) > 255:
+        rects = [
+            [
+                min(r[0] for r in rects),
+                rects[0][1],
+                max(r[2] for r in rects),
+                rects[-1][3],
+            ]
+        ]
+    return [(x1, y1, x2 - x1 + 1, y2 - y1 + 1) for x1, y1, x2, y2 in rects]
+
+
+def encode_delta_frames(data, width, height, frames, bytes_per_pixel, interval):
+    """Encode full frames as keyframes and the changes to the previous frame."""
+    frame_size = width * height * bytes_per_pixel
+    encoded = []
+    previous = None
+    for index in range(frames):
+        raw = data[index * frame_size : (index + 1) * frame_size]
+        pixels = [
+            tuple(raw[i : i + bytes_per_pixel])
+            for i in range(0, frame_size, bytes_per_pixel)
+        ]
+        keyframe = [0x01, 1] + _encode_rect(pixels, width, 0, 0, width, height)
+        frame = keyframe
+        if previous is not None and not (interval and index % interval == 0):
+            rects = _changed_rects(previous, pixels, width, height)
+            delta = [0x00, len(rects)]
+            for rect in rects:
+                delta += _encode_rect(pixels, width, *rect)
+            if len(delta) < len(keyframe):
+                frame = delta
+        encoded.append(frame)
+        previous = pixels
+
+    # Offsets of all frames and of the end come first
+    offset = 4 * (frames + 1)
+    out = []
+    for frame in encoded + [[]]:
+        out += [(offset >> shift) & 0xFF for shift in (0, 8, 16, 24)]
+        offset += len(frame)
+    for frame in encoded:
+        out += frame
+    return out
+
+
 async def to_code(config):
     from PIL import Image
 
@@ -329,8 +449,28 @@ async def to_code(config):
             f"Animation f{config[CONF_ID]} has not supported type {config[CONF_TYPE]}."
         )
 
-    rhs = [HexInt(x) for x in data]
-    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
+    if config[CONF_DELTA_ENCODING]:
+        full_size = len(data)
+        data = encode_delta_frames(
+            data,
+            width,
+            height,
+            frames,
+            DELTA_BYTES_PER_PIXEL[config[CONF_TYPE]],
+            config[CONF_KEYFRAME_INTERVAL],
+        )
+        _LOGGER.debug(
+            "Animation %s: delta encoded %d bytes into %d",
+            config[CONF_ID],
+            full_size,
+            len(data),
+        )
+
+    if asset_partition.is_enabled():
+        prog_arr = asset_partition.add_asset(data)
+    else:
+        rhs = [HexInt(x) for x in data]
+        prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID],
         prog_arr,
@@ -340,6 +480,8 @@ async def to_code(config):
         espImage.IMAGE_TYPE[config[CONF_TYPE]],
     )
     cg.add(var.set_transparency(transparent))
+    if config[CONF_DELTA_ENCODING]:
+        cg.add(var.set_delta_encoding())
     if loop_config := config.get(CONF_LOOP):
         start = loop_config[CONF_START_FRAME]
         end = loop_config.get(CONF_END_FRAME, frames)
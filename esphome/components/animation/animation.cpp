@@ -1,10 +1,17 @@
 #include "animation.h"
 
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
 
 namespace esphome {
 namespace animation {
 
+static const char *const TAG = "animation";
+
 Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count,
                      image::ImageType type)
     : Image(data_start, width, height, type),
@@ -14,7 +21,8 @@ Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t
       loop_start_frame_(0),
       loop_end_frame_(animation_frame_count_),
       loop_count_(0),
-      loop_current_iteration_(1) {}
+      loop_current_iteration_(1),
+      changed_region_(0, 0, width, height) {}
 void Animation::set_loop(uint32_t start_frame, uint32_t end_frame, int count) {
   loop_start_frame_ = std::min(start_frame, animation_frame_count_);
   loop_end_frame_ = std::min(end_frame, animation_frame_count_);
@@ -62,8 +70,106 @@ void Animation::set_frame(int frame) {
 }
 
 void Animation::update_data_start_() {
-  const uint32_t image_size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
-  this->data_start_ = this->animation_data_start_ + image_size * this->current_frame_;
+  if (this->frame_buffer_ == nullptr) {
+    const uint32_t image_size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
+    this->data_start_ = this->animation_data_start_ + image_size * this->current_frame_;
+    this->changed_region_ = display::Rect(0, 0, this->width_, this->height_);
+    return;
+  }
+
+  const int target = this->current_frame_;
+  if (target == this->decoded_frame_) {
+    this->changed_region_ = display::Rect();
+    return;
+  }
+  // Start at the last keyframe, unless the decoded frame is on the way
+  int start = target;
+  while (start > 0 && !this->is_keyframe_(start))
+    start--;
+  if (this->decoded_frame_ >= start && this->decoded_frame_ < target)
+    start = this->decoded_frame_ + 1;
+
+  this->changed_region_ = display::Rect();
+  for (int frame = start; frame <= target; frame++)
+    this->decode_frame_(frame);
+  this->decoded_frame_ = target;
+}
+
+void Animation::set_delta_encoding() {
+  const size_t size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
+  this->frame_buffer_ = static_cast<uint8_t *>(allocate_memory(size, MemoryClass::BULK));
+  if (this->frame_buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Could not allocate %u bytes for the frame buffer", (unsigned) size);
+    this->width_ = 0;
+    this->height_ = 0;
+    return;
+  }
+  memset(this->frame_buffer_, 0, size);
+  this->data_start_ = this->frame_buffer_;
+  this->decoded_frame_ = -1;
+  this->update_data_start_();
+}
+
+void Animation::draw_changes(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  const display::Rect &rect = this->changed_region_;
+  if (!rect.is_set())
+    return;
+  this->draw_area_(x, y, display, color_on, color_off, rect.x, rect.y, rect.x2(), rect.y2());
+}
+
+uint32_t Animation::read_uint32_(uint32_t offset) const {
+  const uint8_t *data = this->animation_data_start_ + offset;
+  return encode_uint32(progmem_read_byte(data + 3), progmem_read_byte(data + 2), progmem_read_byte(data + 1),
+                       progmem_read_byte(data));
+}
+
+uint16_t Animation::read_uint16_(uint32_t offset) const {
+  const uint8_t *data = this->animation_data_start_ + offset;
+  return encode_uint16(progmem_read_byte(data + 1), progmem_read_byte(data));
+}
+
+bool Animation::is_keyframe_(uint32_t frame) const {
+  return progmem_read_byte(this->animation_data_start_ + this->read_uint32_(frame * 4)) & 0x01;
+}
+
+void Animation::decode_frame_(uint32_t frame) {
+  const size_t bytes_per_pixel = image_type_to_bpp(this->type_) / 8;
+  const size_t stride = this->width_ * bytes_per_pixel;
+  const uint8_t *data = this->animation_data_start_;
+  uint32_t pos = this->read_uint32_(frame * 4);
+  const uint32_t end = this->read_uint32_(frame * 4 + 4);
+
+  const uint8_t rect_count = progmem_read_byte(data + pos + 1);
+  pos += 2;
+  for (uint8_t i = 0; i < rect_count && pos + 8 <= end; i++) {
+    const uint16_t rx = this->read_uint16_(pos);
+    const uint16_t ry = this->read_uint16_(pos + 2);
+    const uint16_t rw = this->read_uint16_(pos + 4);
+    const uint16_t rh = this->read_uint16_(pos + 6);
+    pos += 8;
+    if (rw == 0 || rh == 0 || rx + rw > this->width_ || ry + rh > this->height_) {
+      ESP_LOGE(TAG, "Frame %" PRIu32 " has an invalid rectangle", frame);
+      return;
+    }
+    this->changed_region_.extend(display::Rect(rx, ry, rw, rh));
+
+    // Pixels run through the rectangle row by row
+    uint32_t pixel = 0;
+    const uint32_t pixels = uint32_t(rw) * rh;
+    while (pixel < pixels && pos < end) {
+      const uint8_t control = progmem_read_byte(data + pos++);
+      const uint32_t count = std::min<uint32_t>((control & 0x7F) + 1, pixels - pixel);
+      const uint8_t *source = data + pos;
+      for (uint32_t n = 0; n < count; n++, pixel++) {
+        uint8_t *dest = this->frame_buffer_ + (ry + pixel / rw) * stride + (rx + pixel % rw) * bytes_per_pixel;
+        for (size_t b = 0; b < bytes_per_pixel; b++)
+          dest[b] = progmem_read_byte(source + b);
+        if (!(control & 0x80))
+          source += bytes_per_pixel;
+      }
+      pos += (control & 0x80) ? bytes_per_pixel : count * bytes_per_pixel;
+    }
+  }
 }
 
 }  // namespace animation
@@ -23,8 +23,33 @@ class Animation : public image::Image {
 
   void set_loop(uint32_t start_frame, uint32_t end_frame, int count);
 
+  /** Decode delta encoded frames instead of using the data as a sequence of full bitmaps.
+   *
+   * The data starts with the offsets of all frames, each a 32 bit little endian number. A frame is a flags byte
+   * (bit 0: keyframe), the number of rectangles and the rectangles it changes: x, y, width and height as 16 bit little
+   * endian numbers, followed by their run-length encoded pixels. A control byte with the top bit set repeats the next
+   * pixel (control & 0x7F) + 1 times, otherwise (control + 1) literal pixels follow.
+   *
+   * The current frame is decoded into a buffer in RAM, stepping to the next frame only rewrites what changed.
+   */
+  void set_delta_encoding();
+  /// The area that changed with the last frame step, in image coordinates.
+  display::Rect get_changed_region() const { return this->changed_region_; }
+  /** Only draw what changed with the last frame step.
+   *
+   * Meant for displays that don't clear their buffer on every update, with DisplayBuffer's dirty tracking only the
+   * changed region is then sent to the display.
+   */
+  void draw_changes(int x, int y, display::Display *display, Color color_on = display::COLOR_ON,
+                    Color color_off = display::COLOR_OFF);
+
  protected:
   void update_data_start_();
+  uint32_t read_uint32_(uint32_t offset) const;
+  uint16_t read_uint16_(uint32_t offset) const;
+  bool is_keyframe_(uint32_t frame) const;
+  /// Apply the rectangles of `frame` to the frame buffer.
+  void decode_frame_(uint32_t frame);
 
   const uint8_t *animation_data_start_;
   int current_frame_;
@@ -33,6 +58,11 @@ class Animation : public image::Image {
   uint32_t loop_end_frame_;
   int loop_count_;
   int loop_current_iteration_;
+
+  /// Frame buffer of delta encoded animations, nullptr otherwise
+  uint8_t *frame_buffer_{nullptr};
+  int decoded_frame_{-1};
+  display::Rect changed_region_{};
 };
 
 template<typename... Ts> class AnimationNextFrameAction : public Action<Ts...> {
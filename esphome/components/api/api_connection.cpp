@@ -1,4 +1,5 @@
 #include "api_connection.h"
+#include <algorithm>
 #include <cerrno>
 #include <cinttypes>
 #include <utility>
@@ -25,6 +26,10 @@ namespace esphome {
 namespace api {
 
 static const char *const TAG = "api.connection";
+// Batched messages are flushed once they fill about one TCP segment
+static const uint16_t API_BATCH_BUDGET = 1390;
+// Time the entity iterators may take per loop, so a large initial sync doesn't hold up other components for long
+static const uint32_t ITERATOR_BUDGET_US = 2000;
 static const int ESP32_CAMERA_STOP_STREAM = 5000;
 
 APIConnection::APIConnection(std::unique_ptr<socket::Socket> sock, APIServer *parent)
@@ -55,6 +60,9 @@ void APIConnection::start() {
 }
 
 APIConnection::~APIConnection() {
+  auto &cache = this->parent_->get_list_entities_cache();
+  if (cache.recorder == this)
+    cache.recorder = nullptr;
 #ifdef USE_BLUETOOTH_PROXY
   if (bluetooth_proxy::global_bluetooth_proxy->get_api_connection() == this) {
     bluetooth_proxy::global_bluetooth_proxy->unsubscribe_api_connection(this);
@@ -80,6 +88,7 @@ void APIConnection::loop() {
   }
   if (this->next_close_) {
     // requested a disconnect
+    this->flush_batch_();
     this->helper_->close();
     this->remove_ = true;
     return;
@@ -93,7 +102,7 @@ void APIConnection::loop() {
     return;
   }
   ReadPacketBuffer buffer;
-  err = this->helper_->read_packet(&buffer);
+  err = this->helper_->can_read() ? this->helper_->read_packet(&buffer) : APIError::WOULD_BLOCK;
   if (err == APIError::WOULD_BLOCK) {
     // pass
   } else if (err != APIError::OK) {
@@ -110,13 +119,16 @@ void APIConnection::loop() {
   } else {
     this->last_traffic_ = millis();
     // read a packet
-    this->read_message(buffer.data_len, buffer.type, &buffer.container[buffer.data_offset]);
+    this->read_message(buffer.data_len, buffer.type, buffer.data + buffer.data_offset);
     if (this->remove_)
       return;
   }
 
-  this->list_entities_iterator_.advance();
-  this->initial_state_iterator_.advance();
+  if (!this->deferred_states_.empty() && this->helper_->can_write_without_blocking())
+    this->send_deferred_states_();
+
+  this->advance_list_entities_();
+  this->initial_state_iterator_.advance(ITERATOR_BUDGET_US);
 
   static uint32_t keepalive = 60000;
   static uint8_t max_ping_retries = 60;
@@ -151,13 +163,17 @@ void APIConnection::loop() {
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available() && this->helper_->can_write_without_blocking()) {
     uint32_t to_send = std::min((size_t) 1024, this->image_reader_.available());
-    auto buffer = this->create_buffer();
+    bool done = this->image_reader_.available() == to_send;
+    uint32_t msg_size = 0;
+    ProtoSize::add_fixed32_field(msg_size, 1, esp32_camera::global_esp32_camera->get_object_id_hash());
+    ProtoSize::add_string_field(msg_size, 1, to_send);
+    ProtoSize::add_bool_field(msg_size, 1, done);
+    auto buffer = this->create_buffer(msg_size);
     // fixed32 key = 1;
     buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
     // bytes data = 2;
     buffer.encode_bytes(2, this->image_reader_.peek_data_buffer(), to_send);
     // bool done = 3;
-    bool done = this->image_reader_.available() == to_send;
     buffer.encode_bool(3, done);
     bool success = this->send_buffer(buffer, 44);
 
@@ -185,12 +201,38 @@ void APIConnection::loop() {
       }
     }
   }
+
+  this->flush_batch_();
 }
 
 std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
   return App.get_name() + component_type + entity->get_object_id();
 }
 
+bool APIConnection::defer_state_(EntityBase *entity, deferred_state_send_t send) {
+  if (this->remove_ || this->sending_deferred_states_)
+    return false;
+  for (auto &deferred : this->deferred_states_) {
+    if (deferred.entity == entity)
+      return true;
+  }
+  this->deferred_states_.push_back({entity, send});
+  return true;
+}
+void APIConnection::send_deferred_states_() {
+  // sends that fail now stay queued in order, they must not be deferred again while iterating
+  this->sending_deferred_states_ = true;
+  size_t sent = 0;
+  while (sent < this->deferred_states_.size()) {
+    auto &deferred = this->deferred_states_[sent];
+    if (!deferred.send(this, deferred.entity))
+      break;
+    sent++;
+  }
+  this->sending_deferred_states_ = false;
+  this->deferred_states_.erase(this->deferred_states_.begin(), this->deferred_states_.begin() + sent);
+}
+
 DisconnectResponse APIConnection::disconnect(const DisconnectRequest &msg) {
   // remote initiated disconnect_client
   // don't close yet, we still need to send the disconnect response
@@ -213,7 +255,12 @@ bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  if (this->send_binary_sensor_state_response(resp))
+    return true;
+  return this->defer_state_(binary_sensor, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<binary_sensor::BinarySensor *>(entity);
+    return conn->send_binary_sensor_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -245,7 +292,12 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  if (this->send_cover_state_response(resp))
+    return true;
+  return this->defer_state_(cover, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<cover::Cover *>(entity);
+    return conn->send_cover_state(obj);
+  });
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -312,7 +364,12 @@ bool APIConnection::send_fan_state(fan::Fan *fan) {
     resp.direction = static_cast<enums::FanDirection>(fan->direction);
   if (traits.supports_preset_modes())
     resp.preset_mode = fan->preset_mode;
-  return this->send_fan_state_response(resp);
+  if (this->send_fan_state_response(resp))
+    return true;
+  return this->defer_state_(fan, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<fan::Fan *>(entity);
+    return conn->send_fan_state(obj);
+  });
 }
 bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
@@ -379,7 +436,12 @@ bool APIConnection::send_light_state(light::LightState *light) {
   resp.warm_white = values.get_warm_white();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  if (this->send_light_state_response(resp))
+    return true;
+  return this->defer_state_(light, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<light::LightState *>(entity);
+    return conn->send_light_state(obj);
+  });
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -462,7 +524,12 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  if (this->send_sensor_state_response(resp))
+    return true;
+  return this->defer_state_(sensor, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<sensor::Sensor *>(entity);
+    return conn->send_sensor_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -493,7 +560,12 @@ bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  if (this->send_switch_state_response(resp))
+    return true;
+  return this->defer_state_(a_switch, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<switch_::Switch *>(entity);
+    return conn->send_switch_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -531,7 +603,12 @@ bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor,
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  if (this->send_text_sensor_state_response(resp))
+    return true;
+  return this->defer_state_(text_sensor, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<text_sensor::TextSensor *>(entity);
+    return conn->send_text_sensor_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -582,7 +659,12 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.current_humidity = climate->current_humidity;
   if (traits.get_supports_target_humidity())
     resp.target_humidity = climate->target_humidity;
-  return this->send_climate_state_response(resp);
+  if (this->send_climate_state_response(resp))
+    return true;
+  return this->defer_state_(climate, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<climate::Climate *>(entity);
+    return conn->send_climate_state(obj);
+  });
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -666,7 +748,12 @@ bool APIConnection::send_number_state(number::Number *number, float state) {
   resp.key = number->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !number->has_state();
-  return this->send_number_state_response(resp);
+  if (this->send_number_state_response(resp))
+    return true;
+  return this->defer_state_(number, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<number::Number *>(entity);
+    return conn->send_number_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
@@ -710,7 +797,12 @@ bool APIConnection::send_date_state(datetime::DateEntity *date) {
   resp.year = date->year;
   resp.month = date->month;
   resp.day = date->day;
-  return this->send_date_state_response(resp);
+  if (this->send_date_state_response(resp))
+    return true;
+  return this->defer_state_(date, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<datetime::DateEntity *>(entity);
+    return conn->send_date_state(obj);
+  });
 }
 bool APIConnection::send_date_info(datetime::DateEntity *date) {
   ListEntitiesDateResponse msg;
@@ -747,7 +839,12 @@ bool APIConnection::send_time_state(datetime::TimeEntity *time) {
   resp.hour = time->hour;
   resp.minute = time->minute;
   resp.second = time->second;
-  return this->send_time_state_response(resp);
+  if (this->send_time_state_response(resp))
+    return true;
+  return this->defer_state_(time, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<datetime::TimeEntity *>(entity);
+    return conn->send_time_state(obj);
+  });
 }
 bool APIConnection::send_time_info(datetime::TimeEntity *time) {
   ListEntitiesTimeResponse msg;
@@ -785,7 +882,12 @@ bool APIConnection::send_datetime_state(datetime::DateTimeEntity *datetime) {
     ESPTime state = datetime->state_as_esptime();
     resp.epoch_seconds = state.timestamp;
   }
-  return this->send_date_time_state_response(resp);
+  if (this->send_date_time_state_response(resp))
+    return true;
+  return this->defer_state_(datetime, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<datetime::DateTimeEntity *>(entity);
+    return conn->send_datetime_state(obj);
+  });
 }
 bool APIConnection::send_datetime_info(datetime::DateTimeEntity *datetime) {
   ListEntitiesDateTimeResponse msg;
@@ -820,7 +922,12 @@ bool APIConnection::send_text_state(text::Text *text, std::string state) {
   resp.key = text->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text->has_state();
-  return this->send_text_state_response(resp);
+  if (this->send_text_state_response(resp))
+    return true;
+  return this->defer_state_(text, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<text::Text *>(entity);
+    return conn->send_text_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_text_info(text::Text *text) {
   ListEntitiesTextResponse msg;
@@ -858,7 +965,12 @@ bool APIConnection::send_select_state(select::Select *select, std::string state)
   resp.key = select->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !select->has_state();
-  return this->send_select_state_response(resp);
+  if (this->send_select_state_response(resp))
+    return true;
+  return this->defer_state_(select, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<select::Select *>(entity);
+    return conn->send_select_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
@@ -918,7 +1030,12 @@ bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
   resp.state = static_cast<enums::LockState>(state);
-  return this->send_lock_state_response(resp);
+  if (this->send_lock_state_response(resp))
+    return true;
+  return this->defer_state_(a_lock, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<lock::Lock *>(entity);
+    return conn->send_lock_state(obj, obj->state);
+  });
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
@@ -963,7 +1080,12 @@ bool APIConnection::send_valve_state(valve::Valve *valve) {
   resp.key = valve->get_object_id_hash();
   resp.position = valve->position;
   resp.current_operation = static_cast<enums::ValveOperation>(valve->current_operation);
-  return this->send_valve_state_response(resp);
+  if (this->send_valve_state_response(resp))
+    return true;
+  return this->defer_state_(valve, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<valve::Valve *>(entity);
+    return conn->send_valve_state(obj);
+  });
 }
 bool APIConnection::send_valve_info(valve::Valve *valve) {
   auto traits = valve->get_traits();
@@ -1010,7 +1132,12 @@ bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_pla
   resp.state = static_cast<enums::MediaPlayerState>(report_state);
   resp.volume = media_player->volume;
   resp.muted = media_player->is_muted();
-  return this->send_media_player_state_response(resp);
+  if (this->send_media_player_state_response(resp))
+    return true;
+  return this->defer_state_(media_player, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<media_player::MediaPlayer *>(entity);
+    return conn->send_media_player_state(obj);
+  });
 }
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
@@ -1064,11 +1191,16 @@ void APIConnection::media_player_command(const MediaPlayerCommandRequest &msg) {
 void APIConnection::send_camera_state(std::shared_ptr<esp32_camera::CameraImage> image) {
   if (!this->state_subscription_)
     return;
-  if (this->image_reader_.available())
+  if (!image->was_requested_by(esphome::esp32_camera::API_REQUESTER) &&
+      !image->was_requested_by(esphome::esp32_camera::IDLE))
     return;
-  if (image->was_requested_by(esphome::esp32_camera::API_REQUESTER) ||
-      image->was_requested_by(esphome::esp32_camera::IDLE))
-    this->image_reader_.set_image(std::move(image));
+  if (this->image_reader_.available()) {
+    // Finish the image being sent and pick up a newer one after it, this one is skipped
+    ESP_LOGV(TAG, "%s: Skipped a camera frame while still sending the previous one (%" PRIu32 " skipped)",
+             this->client_combined_info_.c_str(), ++this->camera_frames_skipped_);
+    return;
+  }
+  this->image_reader_.set_image(std::move(image));
 }
 bool APIConnection::send_camera_info(esp32_camera::ESP32Camera *camera) {
   ListEntitiesCameraResponse msg;
@@ -1171,7 +1303,7 @@ void APIConnection::on_voice_assistant_response(const VoiceAssistantResponse &ms
       return;
     }
 
-    if (msg.error) {
+    if (msg.error || !voice_assistant::global_voice_assistant->set_audio_codec(msg.audio_codec)) {
       voice_assistant::global_voice_assistant->failed_to_start();
       return;
     }
@@ -1270,7 +1402,12 @@ bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmCon
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
-  return this->send_alarm_control_panel_state_response(resp);
+  if (this->send_alarm_control_panel_state_response(resp))
+    return true;
+  return this->defer_state_(a_alarm_control_panel, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<alarm_control_panel::AlarmControlPanel *>(entity);
+    return conn->send_alarm_control_panel_state(obj);
+  });
 }
 bool APIConnection::send_alarm_control_panel_info(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   ListEntitiesAlarmControlPanelResponse msg;
@@ -1365,7 +1502,12 @@ bool APIConnection::send_update_state(update::UpdateEntity *update) {
     resp.release_url = update->update_info.release_url;
   }
 
-  return this->send_update_state_response(resp);
+  if (this->send_update_state_response(resp))
+    return true;
+  return this->defer_state_(update, [](APIConnection *conn, EntityBase *entity) {
+    auto *obj = static_cast<update::UpdateEntity *>(entity);
+    return conn->send_update_state(obj);
+  });
 }
 bool APIConnection::send_update_info(update::UpdateEntity *update) {
   ListEntitiesUpdateResponse msg;
@@ -1402,16 +1544,83 @@ void APIConnection::update_command(const UpdateCommandRequest &msg) {
 }
 #endif
 
+void APIConnection::subscribe_logs(const SubscribeLogsRequest &msg) {
+  this->log_subscription_ = msg.level;
+  this->log_include_tags_ = msg.include_tags;
+  this->log_exclude_tags_ = msg.exclude_tags;
+  // Anything faster is as good as no limit, and the token math stays within 32 bits
+  this->log_max_rate_ = std::min<uint32_t>(msg.max_rate, 1000);
+  // Allow a burst of one second worth of messages right away
+  this->log_tokens_ = this->log_max_rate_ * 1000;
+  this->log_tokens_updated_ = millis();
+  this->log_messages_suppressed_ = 0;
+  if (msg.dump_config)
+    App.schedule_dump_config();
+}
+
+bool APIConnection::should_send_log_(const char *tag) {
+  if (!this->log_include_tags_.empty()) {
+    bool included = false;
+    for (auto &include : this->log_include_tags_) {
+      if (include == tag) {
+        included = true;
+        break;
+      }
+    }
+    if (!included)
+      return false;
+  }
+  for (auto &exclude : this->log_exclude_tags_) {
+    if (exclude == tag)
+      return false;
+  }
+  if (this->log_max_rate_ == 0)
+    return true;
+
+  const uint32_t now = millis();
+  // Past a second the bucket is full anyway, capping the time keeps the product from overflowing
+  const uint32_t elapsed = std::min<uint32_t>(now - this->log_tokens_updated_, 1000);
+  this->log_tokens_updated_ = now;
+  this->log_tokens_ = std::min(this->log_tokens_ + elapsed * this->log_max_rate_, this->log_max_rate_ * 1000);
+  if (this->log_tokens_ < 1000) {
+    this->log_messages_suppressed_++;
+    return false;
+  }
+  this->log_tokens_ -= 1000;
+  return true;
+}
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
+  // Filter before anything gets encoded
+  if (!this->should_send_log_(tag))
+    return false;
+
+  if (this->log_messages_suppressed_ != 0) {
+    char summary[48];
+    snprintf(summary, sizeof(summary), "%" PRIu32 " log messages suppressed", this->log_messages_suppressed_);
+    this->log_messages_suppressed_ = 0;
+    size_t summary_length = strlen(summary);
+    uint32_t summary_size = 0;
+    ProtoSize::add_uint32_field(summary_size, 1, ESPHOME_LOG_LEVEL_WARN);
+    ProtoSize::add_string_field(summary_size, 1, summary_length);
+    auto summary_buffer = this->create_buffer(summary_size);
+    summary_buffer.encode_uint32(1, ESPHOME_LOG_LEVEL_WARN);
+    summary_buffer.encode_string(3, summary, summary_length);
+    this->send_buffer(summary_buffer, 29);
+  }
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  size_t line_length = strlen(line);
+  uint32_t msg_size = 0;
+  ProtoSize::add_uint32_field(msg_size, 1, static_cast<uint32_t>(level));
+  ProtoSize::add_string_field(msg_size, 1, line_length);
+  auto buffer = this->create_buffer(msg_size);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_length);
   // SubscribeLogsResponse - 29
   return this->send_buffer(buffer, 29);
 }
@@ -1425,12 +1634,14 @@ HelloResponse APIConnection::hello(const HelloRequest &msg) {
   this->client_api_version_minor_ = msg.api_version_minor;
   ESP_LOGV(TAG, "Hello from client: '%s' | %s | API Version %" PRIu32 ".%" PRIu32, this->client_info_.c_str(),
            this->client_peername_.c_str(), this->client_api_version_major_, this->client_api_version_minor_);
+  this->batch_messages_ = msg.batch_messages;
 
   HelloResponse resp;
   resp.api_version_major = 1;
   resp.api_version_minor = 10;
   resp.server_info = App.get_name() + " (esphome v" ESPHOME_VERSION ")";
   resp.name = App.get_name();
+  resp.batch_messages = this->batch_messages_;
 
   this->connection_state_ = ConnectionState::CONNECTED;
   return resp;
@@ -1453,6 +1664,55 @@ ConnectResponse APIConnection::connect(const ConnectRequest &msg) {
   }
   return resp;
 }
+#ifdef USE_LOOP_PROFILER
+LoopStatsResponse APIConnection::loop_stats(const LoopStatsRequest &msg) {
+  LoopStatsResponse resp;
+  resp.duration_ms = millis() - App.get_loop_stats_reset_time();
+  for (auto *obj : App.get_components()) {
+    const ComponentLoopStats &stats = obj->get_loop_stats();
+    if (stats.loop_count == 0 && stats.scheduler_count == 0)
+      continue;
+    LoopStatsComponent component;
+    component.source = obj->get_component_source();
+    component.loop_count = stats.loop_count;
+    component.loop_time_us = stats.loop_time_us;
+    component.loop_max_us = stats.loop_max_us;
+    component.loop_p99_us = stats.loop_percentile_us(99.0f);
+    component.scheduler_count = stats.scheduler_count;
+    component.scheduler_time_us = stats.scheduler_time_us;
+    component.scheduler_max_us = stats.scheduler_max_us;
+    resp.components.push_back(component);
+  }
+  const LoopIterationStats &iteration_stats = App.get_loop_iteration_stats();
+  resp.loop_histogram_us.assign(std::begin(iteration_stats.iteration_us.buckets),
+                                std::end(iteration_stats.iteration_us.buckets));
+  const LatencyHistogram &lateness = App.scheduler.get_lateness_stats();
+  resp.scheduler_lateness_histogram_ms.assign(std::begin(lateness.buckets), std::end(lateness.buckets));
+  resp.stall_count = iteration_stats.stall_count;
+  resp.last_stall_us = iteration_stats.last_stall_us;
+  if (iteration_stats.last_stall_source != nullptr)
+    resp.last_stall_source = iteration_stats.last_stall_source;
+  resp.last_stall_source_us = iteration_stats.last_stall_source_us;
+  if (msg.reset)
+    App.reset_loop_stats();
+  return resp;
+}
+#endif
+void APIConnection::batch_command(const BatchCommandRequest &msg) {
+  // All commands are applied before any light writes its output, so the whole batch takes effect at once
+#ifdef USE_LIGHT
+  light::LightState::begin_batch();
+  for (const auto &command : msg.light_commands)
+    this->light_command(command);
+#endif
+#ifdef USE_SWITCH
+  for (const auto &command : msg.switch_commands)
+    this->switch_command(command);
+#endif
+#ifdef USE_LIGHT
+  light::LightState::end_batch();
+#endif
+}
 DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
   DeviceInfoResponse resp{};
   resp.uses_password = this->parent_->uses_password();
@@ -1495,11 +1755,7 @@ DeviceInfoResponse APIConnection::device_info(const DeviceInfoRequest &msg) {
   return resp;
 }
 void APIConnection::on_home_assistant_state_response(const HomeAssistantStateResponse &msg) {
-  for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == msg.entity_id && it.attribute.value() == msg.attribute) {
-      it.callback(msg.state);
-    }
-  }
+  this->parent_->on_home_assistant_state(msg.entity_id, msg.attribute, msg.state);
 }
 void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
   bool found = false;
@@ -1515,9 +1771,130 @@ void APIConnection::execute_service(const ExecuteServiceRequest &msg) {
 void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistantStatesRequest &msg) {
   state_subs_at_ = 0;
 }
+ProtoWriteBuffer APIConnection::create_buffer(uint32_t reserve_size) {
+  // FIXME: ensure no recursive writes can happen
+  auto &shared_buf = this->proto_write_buffer_;
+  if (!this->batch_packets_.empty()) {
+    uint8_t record_padding = this->helper_->batch_record_padding();
+    if (shared_buf.size() + record_padding + reserve_size <= API_BATCH_BUDGET) {
+      // append to the pending batch
+      shared_buf.resize(shared_buf.size() + record_padding);
+      return {&shared_buf};
+    }
+    this->flush_batch_();
+  }
+  // Leave headroom in front for the frame header and room behind for the footer,
+  // so the frame helper can frame the message in place.
+  uint32_t header_padding = this->helper_->frame_header_padding();
+  uint32_t capacity = header_padding + reserve_size + this->helper_->frame_footer_size();
+  if (this->batch_messages_)
+    capacity = std::max(capacity, (uint32_t) API_BATCH_BUDGET + this->helper_->frame_footer_size());
+  shared_buf.clear();
+  shared_buf.reserve(capacity);
+  shared_buf.resize(header_padding);
+  return {&shared_buf};
+}
+void APIConnection::list_entities(const ListEntitiesRequest &msg) {
+  auto &cache = this->parent_->get_list_entities_cache();
+  this->list_entities_cache_generation_ = cache.generation;
+  if (cache.complete) {
+    this->list_entities_cache_at_ = 0;
+    return;
+  }
+  this->list_entities_cache_at_ = -1;
+  if (cache.recorder == nullptr || cache.recorder == this) {
+    cache.data.clear();
+    cache.entries.clear();
+    cache.recorder = this;
+  }
+  this->list_entities_iterator_.begin();
+}
+void APIConnection::advance_list_entities_() {
+  if (this->list_entities_cache_at_ >= 0) {
+    this->send_cached_list_entities_();
+    return;
+  }
+  if (!this->list_entities_iterator_.is_running())
+    return;
+  auto &cache = this->parent_->get_list_entities_cache();
+  // Everything sent while iterating is part of the list
+  this->recording_list_entities_ = cache.recorder == this;
+  this->list_entities_iterator_.advance(ITERATOR_BUDGET_US);
+  this->recording_list_entities_ = false;
+  if (cache.recorder == this && !this->list_entities_iterator_.is_running()) {
+    cache.recorder = nullptr;
+    cache.complete = true;
+    ESP_LOGD(TAG, "Cached %u entity list messages in %u bytes", (unsigned) cache.entries.size(),
+             (unsigned) cache.data.size());
+  }
+}
+void APIConnection::send_cached_list_entities_() {
+  const auto &cache = this->parent_->get_list_entities_cache();
+  if (cache.generation != this->list_entities_cache_generation_) {
+    // Invalidated while sending it, list the entities again
+    this->list_entities(ListEntitiesRequest());
+    return;
+  }
+  const uint32_t started = micros();
+  while (static_cast<size_t>(this->list_entities_cache_at_) < cache.entries.size()) {
+    const auto &entry = cache.entries[this->list_entities_cache_at_];
+    if (!this->send_payload_(cache.data.data() + entry.offset, entry.size, entry.message_type))
+      return;
+    this->list_entities_cache_at_++;
+    if (micros() - started >= ITERATOR_BUDGET_US)
+      return;
+  }
+  this->list_entities_cache_at_ = -1;
+}
+bool APIConnection::send_payload_(const uint8_t *data, size_t len, uint32_t message_type) {
+  auto buffer = this->create_buffer(len);
+  buffer.get_buffer()->insert(buffer.get_buffer()->end(), data, data + len);
+  return this->send_buffer(buffer, message_type);
+}
+bool APIConnection::send_message_(const ProtoMessage &msg, uint32_t message_type) {
+  if (this->recording_list_entities_) {
+    std::vector<uint8_t> encoded;
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    encoded.reserve(msg_size);
+    msg.encode(ProtoWriteBuffer{&encoded});
+    // The iterator retries a message that could not be sent, it is recorded then
+    if (!this->send_payload_(encoded.data(), encoded.size(), message_type))
+      return false;
+    auto &cache = this->parent_->get_list_entities_cache();
+    cache.entries.push_back({static_cast<uint32_t>(cache.data.size()), static_cast<uint32_t>(encoded.size()),
+                             message_type});
+    cache.data.insert(cache.data.end(), encoded.begin(), encoded.end());
+    return true;
+  }
+
+  APIServer::SharedPayload *shared = this->parent_->get_shared_payload();
+  if (shared == nullptr)
+    return APIServerConnectionBase::send_message_(msg, message_type);
+
+  // fanning out one update to all clients: the first one encodes, the others only copy the payload
+  if (!shared->valid || shared->message_type != message_type) {
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    shared->data.clear();
+    shared->data.reserve(msg_size);
+    msg.encode(ProtoWriteBuffer{&shared->data});
+    shared->message_type = message_type;
+    shared->valid = true;
+  }
+  return this->send_payload_(shared->data.data(), shared->data.size(), message_type);
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
+  // where this message's payload starts and the batch before it ends
+  size_t batch_end = 0;
+  size_t payload_offset = this->helper_->frame_header_padding();
+  if (!this->batch_packets_.empty()) {
+    const auto &last = this->batch_packets_.back();
+    batch_end = last.offset + last.payload_size;
+    payload_offset = batch_end + this->helper_->batch_record_padding();
+  }
   if (!this->helper_->can_write_without_blocking()) {
     delay(0);
     APIError err = this->helper_->loop();
@@ -1532,12 +1909,34 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
       if (message_type != 29) {
         ESP_LOGV(TAG, "Cannot send message because of TCP buffer space");
       }
+      // drop this message from the batch, the caller will retry
+      buffer.get_buffer()->resize(batch_end);
       delay(0);
       return false;
     }
   }
 
-  APIError err = this->helper_->write_packet(message_type, buffer.get_buffer()->data(), buffer.get_buffer()->size());
+  if (this->batch_messages_) {
+    uint16_t payload_size = buffer.get_buffer()->size() - payload_offset;
+    this->batch_packets_.emplace_back(message_type, payload_offset, payload_size);
+    if (buffer.get_buffer()->size() >= API_BATCH_BUDGET)
+      return this->flush_batch_();
+    return true;
+  }
+
+  APIError err = this->helper_->write_protobuf_packet(message_type, buffer);
+  // Do not set last_traffic_ on send
+  return this->handle_write_result_(err);
+}
+bool APIConnection::flush_batch_() {
+  if (this->batch_packets_.empty())
+    return true;
+  APIError err =
+      this->helper_->write_protobuf_packets(ProtoWriteBuffer{&this->proto_write_buffer_}, this->batch_packets_);
+  this->batch_packets_.clear();
+  return this->handle_write_result_(err);
+}
+bool APIConnection::handle_write_result_(APIError err) {
   if (err == APIError::WOULD_BLOCK)
     return false;
   if (err != APIError::OK) {
@@ -1550,7 +1949,6 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
     return false;
   }
-  // Do not set last_traffic_ on send
   return true;
 }
 void APIConnection::on_unauthenticated_access() {
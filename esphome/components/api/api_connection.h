@@ -117,6 +117,8 @@ class APIConnection : public APIServerConnection {
   void media_player_command(const MediaPlayerCommandRequest &msg) override;
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
+  /// Whether a message of this tag passes the tag filters and the rate limit of the log subscription.
+  bool should_send_log_(const char *tag);
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -189,16 +191,12 @@ class APIConnection : public APIServerConnection {
   DisconnectResponse disconnect(const DisconnectRequest &msg) override;
   PingResponse ping(const PingRequest &msg) override { return {}; }
   DeviceInfoResponse device_info(const DeviceInfoRequest &msg) override;
-  void list_entities(const ListEntitiesRequest &msg) override { this->list_entities_iterator_.begin(); }
+  void list_entities(const ListEntitiesRequest &msg) override;
   void subscribe_states(const SubscribeStatesRequest &msg) override {
     this->state_subscription_ = true;
     this->initial_state_iterator_.begin();
   }
-  void subscribe_logs(const SubscribeLogsRequest &msg) override {
-    this->log_subscription_ = msg.level;
-    if (msg.dump_config)
-      App.schedule_dump_config();
-  }
+  void subscribe_logs(const SubscribeLogsRequest &msg) override;
   void subscribe_homeassistant_services(const SubscribeHomeassistantServicesRequest &msg) override {
     this->service_call_subscription_ = true;
   }
@@ -208,6 +206,10 @@ class APIConnection : public APIServerConnection {
     return {};
   }
   void execute_service(const ExecuteServiceRequest &msg) override;
+#ifdef USE_LOOP_PROFILER
+  LoopStatsResponse loop_stats(const LoopStatsRequest &msg) override;
+#endif
+  void batch_command(const BatchCommandRequest &msg) override;
 
   bool is_authenticated() override { return this->connection_state_ == ConnectionState::AUTHENTICATED; }
   bool is_connection_setup() override {
@@ -216,11 +218,12 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
-    // FIXME: ensure no recursive writes can happen
-    this->proto_write_buffer_.clear();
-    return {&this->proto_write_buffer_};
-  }
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override;
+  bool send_message_(const ProtoMessage &msg, uint32_t message_type) override;
+  /// Send an encoded message.
+  bool send_payload_(const uint8_t *data, size_t len, uint32_t message_type);
+  void advance_list_entities_();
+  void send_cached_list_entities_();
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
 
   std::string get_client_combined_info() const { return this->client_combined_info_; }
@@ -229,6 +232,15 @@ class APIConnection : public APIServerConnection {
   friend APIServer;
 
   bool send_(const void *buf, size_t len, bool force);
+  /// Send all batched messages with one write.
+  bool flush_batch_();
+  bool handle_write_result_(APIError err);
+
+  /// Re-sends the current state of an entity, used for updates that could not be sent right away.
+  using deferred_state_send_t = bool (*)(APIConnection *conn, EntityBase *entity);
+  /// Remember that entity has an unsent state update, returns false if it is dropped instead.
+  bool defer_state_(EntityBase *entity, deferred_state_send_t send);
+  void send_deferred_states_();
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -241,6 +253,17 @@ class APIConnection : public APIServerConnection {
   // Buffer used to encode proto messages
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
+  // Messages in proto_write_buffer_ that wait for flush_batch_(), only used when batch_messages_ is set
+  std::vector<PacketInfo> batch_packets_;
+  bool batch_messages_{false};
+
+  struct DeferredState {
+    EntityBase *entity;
+    deferred_state_send_t send;
+  };
+  // At most one entry per entity, the state is read again when it is sent
+  std::vector<DeferredState> deferred_states_;
+  bool sending_deferred_states_{false};
   std::unique_ptr<APIFrameHelper> helper_;
 
   std::string client_info_;
@@ -250,10 +273,18 @@ class APIConnection : public APIServerConnection {
   uint32_t client_api_version_minor_{0};
 #ifdef USE_ESP32_CAMERA
   esp32_camera::CameraImageReader image_reader_;
+  uint32_t camera_frames_skipped_{0};
 #endif
 
   bool state_subscription_{false};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+  std::vector<std::string> log_include_tags_;
+  std::vector<std::string> log_exclude_tags_;
+  /// Token bucket of the log rate limit, in thousandths of a message
+  uint32_t log_max_rate_{0};
+  uint32_t log_tokens_{0};
+  uint32_t log_tokens_updated_{0};
+  uint32_t log_messages_suppressed_{0};
   uint32_t last_traffic_;
   uint32_t next_ping_retry_{0};
   uint8_t ping_retries_{0};
@@ -263,6 +294,11 @@ class APIConnection : public APIServerConnection {
   APIServer *parent_;
   InitialStateIterator initial_state_iterator_;
   ListEntitiesIterator list_entities_iterator_;
+  /// Next entry of the server's list entities cache to send, -1 if the entities aren't sent from the cache
+  int list_entities_cache_at_ = -1;
+  uint32_t list_entities_cache_generation_{0};
+  /// Whether the messages sent are recorded into the list entities cache
+  bool recording_list_entities_{false};
   int state_subs_at_ = -1;
 };
 
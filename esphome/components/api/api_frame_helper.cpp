@@ -5,6 +5,7 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 #include "proto.h"
+#include <algorithm>
 #include <cstring>
 
 namespace esphome {
@@ -72,6 +73,13 @@ const char *api_error_to_str(APIError err) {
   return "UNKNOWN";
 }
 
+APIError APIFrameHelper::write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer) {
+  uint16_t payload_len = buffer.get_buffer()->size() - this->frame_header_padding_;
+  std::vector<PacketInfo> packets;
+  packets.emplace_back(type, this->frame_header_padding_, payload_len);
+  return this->write_protobuf_packets(buffer, packets);
+}
+
 #define HELPER_LOG(msg, ...) ESP_LOGVV(TAG, "%s: " msg, info_.c_str(), ##__VA_ARGS__)
 // uncomment to log raw packets
 //#define HELPER_LOG_PACKETS
@@ -224,9 +232,10 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
     return APIError::BAD_HANDSHAKE_PACKET_LEN;
   }
 
-  // reserve space for body
+  // reserve space for body, the buffer keeps its capacity between frames
   if (rx_buf_.size() != msg_size) {
     rx_buf_.resize(msg_size);
+    this->rx_buffer_high_water_ = std::max<size_t>(this->rx_buffer_high_water_, msg_size);
   }
 
   if (rx_buf_len_ < msg_size) {
@@ -256,9 +265,9 @@ APIError APINoiseFrameHelper::try_read_frame_(ParsedFrame *frame) {
 #ifdef HELPER_LOG_PACKETS
   ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
+  frame->data = rx_buf_.data();
+  frame->size = msg_size;
   // consume msg
-  rx_buf_ = {};
   rx_buf_len_ = 0;
   rx_header_buf_len_ = 0;
   return APIError::OK;
@@ -295,9 +304,9 @@ APIError APINoiseFrameHelper::state_action_() {
     if (aerr != APIError::OK)
       return aerr;
     // ignore contents, may be used in future for flags
-    prologue_.push_back((uint8_t) (frame.msg.size() >> 8));
-    prologue_.push_back((uint8_t) frame.msg.size());
-    prologue_.insert(prologue_.end(), frame.msg.begin(), frame.msg.end());
+    prologue_.push_back((uint8_t) (frame.size >> 8));
+    prologue_.push_back((uint8_t) frame.size);
+    prologue_.insert(prologue_.end(), frame.data, frame.data + frame.size);
 
     state_ = State::SERVER_HELLO;
   }
@@ -340,18 +349,18 @@ APIError APINoiseFrameHelper::state_action_() {
       if (aerr != APIError::OK)
         return aerr;
 
-      if (frame.msg.empty()) {
+      if (frame.size == 0) {
         send_explicit_handshake_reject_("Empty handshake message");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
-      } else if (frame.msg[0] != 0x00) {
-        HELPER_LOG("Bad handshake error byte: %u", frame.msg[0]);
+      } else if (frame.data[0] != 0x00) {
+        HELPER_LOG("Bad handshake error byte: %u", frame.data[0]);
         send_explicit_handshake_reject_("Bad handshake error byte");
         return APIError::BAD_HANDSHAKE_ERROR_BYTE;
       }
 
       NoiseBuffer mbuf;
       noise_buffer_init(mbuf);
-      noise_buffer_set_input(mbuf, frame.msg.data() + 1, frame.msg.size() - 1);
+      noise_buffer_set_input(mbuf, frame.data + 1, frame.size - 1);
       err = noise_handshakestate_read_message(handshake_, &mbuf, nullptr);
       if (err != 0) {
         state_ = State::FAILED;
@@ -432,7 +441,8 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, frame.msg.data(), frame.msg.size(), frame.msg.size());
+  // decrypt in place
+  noise_buffer_set_inout(mbuf, frame.data, frame.size, frame.size);
   err = noise_cipherstate_decrypt(recv_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -441,7 +451,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   }
 
   size_t msg_size = mbuf.size;
-  uint8_t *msg_data = frame.msg.data();
+  uint8_t *msg_data = frame.data;
   if (msg_size < 4) {
     state_ = State::FAILED;
     HELPER_LOG("Bad data packet: size %d too short", msg_size);
@@ -460,14 +470,14 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
     return APIError::BAD_DATA_PACKET;
   }
 
-  buffer->container = std::move(frame.msg);
+  buffer->data = frame.data;
   buffer->data_offset = 4;
   buffer->data_len = data_len;
   buffer->type = type;
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APINoiseFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer, const std::vector<PacketInfo> &packets) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -479,31 +489,33 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
-  if (tmpbuf == nullptr) {
-    HELPER_LOG("Could not allocate for writing packet");
-    return APIError::OUT_OF_MEMORY;
+  if (packets.empty()) {
+    return APIError::OK;
   }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
+  std::vector<uint8_t> *raw_buffer = buffer.get_buffer();
   const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  size_t padding = 0;
+  size_t msg_len = raw_buffer->size() - msg_offset + padding;
+  size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  // grows into the space reserved by create_buffer, so normally no reallocation
+  raw_buffer->resize(raw_buffer->size() + padding + mac_len, 0);
+  uint8_t *buf = raw_buffer->data();
+
+  buf[0] = 0x01;  // indicator
+  // buf[1], buf[2] to be set later
+  // every message is a type/length record in front of its payload, all records share one frame
+  for (const auto &packet : packets) {
+    uint8_t *record = &buf[packet.offset - 4];
+    record[0] = (uint8_t) (packet.message_type >> 8);  // type
+    record[1] = (uint8_t) packet.message_type;
+    record[2] = (uint8_t) (packet.payload_size >> 8);  // data_len
+    record[3] = (uint8_t) packet.payload_size;
+  }
 
   NoiseBuffer mbuf;
   noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
+  noise_buffer_set_inout(mbuf, &buf[msg_offset], msg_len, msg_len + mac_len);
   err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
   if (err != 0) {
     state_ = State::FAILED;
@@ -512,11 +524,11 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
   }
 
   size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
+  buf[1] = (uint8_t) (mbuf.size >> 8);
+  buf[2] = (uint8_t) mbuf.size;
 
   struct iovec iov;
-  iov.iov_base = &tmpbuf[0];
+  iov.iov_base = buf;
   iov.iov_len = total_len;
 
   // write raw to not have two packets sent if NAGLE disabled
@@ -785,7 +797,7 @@ APIError APIPlaintextFrameHelper::loop() {
 /** Read a packet into the rx_buf_. If successful, stores frame data in the frame parameter
  *
  * @param frame: The struct to hold the frame information in.
- *   msg: store the parsed frame in that struct
+ *   data, size: the parsed frame, it stays in rx_buf_ until the next call
  *
  * @return See APIError
  *
@@ -843,9 +855,10 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
   }
   // header reading done
 
-  // reserve space for body
+  // reserve space for body, the buffer keeps its capacity between frames
   if (rx_buf_.size() != rx_header_parsed_len_) {
     rx_buf_.resize(rx_header_parsed_len_);
+    this->rx_buffer_high_water_ = std::max<size_t>(this->rx_buffer_high_water_, rx_header_parsed_len_);
   }
 
   if (rx_buf_len_ < rx_header_parsed_len_) {
@@ -875,9 +888,9 @@ APIError APIPlaintextFrameHelper::try_read_frame_(ParsedFrame *frame) {
 #ifdef HELPER_LOG_PACKETS
   ESP_LOGVV(TAG, "Received frame: %s", format_hex_pretty(rx_buf_).c_str());
 #endif
-  frame->msg = std::move(rx_buf_);
+  frame->data = rx_buf_.data();
+  frame->size = rx_header_parsed_len_;
   // consume msg
-  rx_buf_ = {};
   rx_buf_len_ = 0;
   rx_header_buf_.clear();
   rx_header_parsed_ = false;
@@ -896,33 +909,39 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   if (aerr != APIError::OK)
     return aerr;
 
-  buffer->container = std::move(frame.msg);
+  buffer->data = frame.data;
   buffer->data_offset = 0;
   buffer->data_len = rx_header_parsed_len_;
   buffer->type = rx_header_parsed_type_;
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APIPlaintextFrameHelper::write_protobuf_packets(ProtoWriteBuffer buffer,
+                                                         const std::vector<PacketInfo> &packets) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
-
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  uint8_t *buf = buffer.get_buffer()->data();
+  std::vector<struct iovec> iovs;
+  iovs.reserve(packets.size());
+  for (const auto &packet : packets) {
+    // the varints are variable length, so right-align the header against the payload
+    uint8_t header_len = 1 + ProtoSize::varint(packet.payload_size) + ProtoSize::varint(packet.message_type);
+    uint8_t *header = &buf[packet.offset - header_len];
+    header[0] = 0x00;  // indicator
+    uint8_t *pos = header + 1;
+    pos += ProtoVarInt(packet.payload_size).encode(pos);
+    ProtoVarInt(packet.message_type).encode(pos);
+
+    struct iovec iov;
+    iov.iov_base = header;
+    iov.iov_len = header_len + packet.payload_size;
+    iovs.push_back(iov);
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
 
-  return write_raw_(iov, 2);
+  // write raw to not have several packets sent if NAGLE disabled
+  return write_raw_(iovs.data(), iovs.size());
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
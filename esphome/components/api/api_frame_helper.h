@@ -12,12 +12,14 @@
 
 #include "api_noise_context.h"
 #include "esphome/components/socket/socket.h"
+#include "proto.h"
 
 namespace esphome {
 namespace api {
 
 struct ReadPacketBuffer {
-  std::vector<uint8_t> container;
+  /// Points into the receive buffer of the frame helper, only valid until the next read_packet()
+  uint8_t *data;
   uint16_t type;
   size_t data_offset;
   size_t data_len;
@@ -30,6 +32,16 @@ struct PacketBuffer {
   uint8_t data_len;
 };
 
+/// A message encoded into a shared write buffer, see APIFrameHelper::write_protobuf_packets().
+struct PacketInfo {
+  uint16_t message_type;
+  /// Offset of the payload in the buffer
+  uint16_t offset;
+  uint16_t payload_size;
+
+  PacketInfo(uint16_t type, uint16_t off, uint16_t size) : message_type(type), offset(off), payload_size(size) {}
+};
+
 enum class APIError : int {
   OK = 0,
   WOULD_BLOCK = 1001,
@@ -65,26 +77,55 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  /// Whether read_packet() may find new data on the socket.
+  virtual bool can_read() const = 0;
+  /// Frame and send a message whose payload starts frame_header_padding() bytes into the buffer.
+  /// The header is written into that headroom so the payload is never copied.
+  APIError write_protobuf_packet(uint16_t type, ProtoWriteBuffer buffer);
+  /// Frame and send several messages with a single write. The first payload is preceded by
+  /// frame_header_padding() bytes of headroom, every following one by batch_record_padding() bytes.
+  /// Only valid once the client agreed to batching, as Noise puts all of them into one frame.
+  virtual APIError write_protobuf_packets(ProtoWriteBuffer buffer, const std::vector<PacketInfo> &packets) = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
   virtual APIError shutdown(int how) = 0;
   // Give this helper a name for logging
   virtual void set_log_info(std::string info) = 0;
+  /// Bytes to reserve in front of the payload for the frame header.
+  uint8_t frame_header_padding() const { return this->frame_header_padding_; }
+  /// Bytes to reserve after the payload for the frame footer (e.g. the MAC).
+  uint8_t frame_footer_size() const { return this->frame_footer_size_; }
+  /// Bytes to reserve in front of every batched payload after the first one.
+  uint8_t batch_record_padding() const { return this->batch_record_padding_; }
+  /// Largest frame received so far; the receive buffer keeps this capacity, so smaller frames never allocate.
+  size_t rx_buffer_high_water() const { return this->rx_buffer_high_water_; }
+
+ protected:
+  size_t rx_buffer_high_water_{0};
+  uint8_t frame_header_padding_{0};
+  uint8_t frame_footer_size_{0};
+  uint8_t batch_record_padding_{0};
 };
 
 #ifdef USE_API_NOISE
 class APINoiseFrameHelper : public APIFrameHelper {
  public:
   APINoiseFrameHelper(std::unique_ptr<socket::Socket> socket, std::shared_ptr<APINoiseContext> ctx)
-      : socket_(std::move(socket)), ctx_(std::move(std::move(ctx))) {}
+      : socket_(std::move(socket)), ctx_(std::move(std::move(ctx))) {
+    // 3 byte frame header + 2 byte type + 2 byte length, then the ChaChaPoly MAC
+    this->frame_header_padding_ = 7;
+    this->frame_footer_size_ = 16;
+    // batched messages share the frame, each only needs its type and length
+    this->batch_record_padding_ = 4;
+  }
   ~APINoiseFrameHelper() override;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  bool can_read() const override { return this->socket_->ready(); }
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const std::vector<PacketInfo> &packets) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -95,8 +136,10 @@ class APINoiseFrameHelper : public APIFrameHelper {
   void set_log_info(std::string info) override { info_ = std::move(info); }
 
  protected:
+  /// A frame in rx_buf_, valid until the next try_read_frame_()
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    uint8_t *data;
+    size_t size;
   };
 
   APIError state_action_();
@@ -141,13 +184,19 @@ class APINoiseFrameHelper : public APIFrameHelper {
 #ifdef USE_API_PLAINTEXT
 class APIPlaintextFrameHelper : public APIFrameHelper {
  public:
-  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket) : socket_(std::move(socket)) {}
+  APIPlaintextFrameHelper(std::unique_ptr<socket::Socket> socket) : socket_(std::move(socket)) {
+    // indicator + up to 3 byte varint length + up to 2 byte varint type
+    this->frame_header_padding_ = 6;
+    // batched messages are still separate frames
+    this->batch_record_padding_ = 6;
+  }
   ~APIPlaintextFrameHelper() override = default;
   APIError init() override;
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  bool can_read() const override { return this->socket_->ready(); }
+  APIError write_protobuf_packets(ProtoWriteBuffer buffer, const std::vector<PacketInfo> &packets) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -158,8 +207,10 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   void set_log_info(std::string info) override { info_ = std::move(info); }
 
  protected:
+  /// A frame in rx_buf_, valid until the next try_read_frame_()
   struct ParsedFrame {
-    std::vector<uint8_t> msg;
+    uint8_t *data;
+    size_t size;
   };
 
   APIError try_read_frame_(ParsedFrame *frame);
@@ -331,6 +331,13 @@ class APIServerConnectionBase : public ProtoService {
 #ifdef USE_UPDATE
   virtual void on_update_command_request(const UpdateCommandRequest &value){};
 #endif
+#ifdef USE_LOOP_PROFILER
+  virtual void on_loop_stats_request(const LoopStatsRequest &value){};
+#endif
+#ifdef USE_LOOP_PROFILER
+  bool send_loop_stats_response(const LoopStatsResponse &msg);
+#endif
+  virtual void on_batch_command_request(const BatchCommandRequest &value){};
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
 };
@@ -444,6 +451,10 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ALARM_CONTROL_PANEL
   virtual void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) = 0;
 #endif
+#ifdef USE_LOOP_PROFILER
+  virtual LoopStatsResponse loop_stats(const LoopStatsRequest &msg) = 0;
+#endif
+  virtual void batch_command(const BatchCommandRequest &msg) = 0;
  protected:
   void on_hello_request(const HelloRequest &msg) override;
   void on_connect_request(const ConnectRequest &msg) override;
@@ -551,6 +562,10 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_ALARM_CONTROL_PANEL
   void on_alarm_control_panel_command_request(const AlarmControlPanelCommandRequest &msg) override;
 #endif
+#ifdef USE_LOOP_PROFILER
+  void on_loop_stats_request(const LoopStatsRequest &msg) override;
+#endif
+  void on_batch_command_request(const BatchCommandRequest &msg) override;
 };
 
 }  // namespace api
@@ -93,7 +93,7 @@ void APIServer::setup() {
 }
 void APIServer::loop() {
   // Accept new clients
-  while (true) {
+  while (this->socket_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     auto sock = socket_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -174,12 +174,36 @@ bool APIServer::check_password(const std::string &password) const {
   return result == 0;
 }
 void APIServer::handle_disconnect(APIConnection *conn) {}
+void APIServer::begin_shared_payload_() {
+  // with a single client there is nothing to share, skip the extra copy
+  if (this->clients_.size() < 2 && this->shared_payload_.depth == 0)
+    return;
+  // nested updates start over, the outer one encodes again afterwards
+  this->shared_payload_.depth++;
+  this->shared_payload_.valid = false;
+}
+void APIServer::invalidate_list_entities_cache() {
+  auto &cache = this->list_entities_cache_;
+  cache.data.clear();
+  cache.entries.clear();
+  cache.recorder = nullptr;
+  cache.generation++;
+  cache.complete = false;
+}
+void APIServer::end_shared_payload_() {
+  if (this->shared_payload_.depth == 0)
+    return;
+  this->shared_payload_.depth--;
+  this->shared_payload_.valid = false;
+}
 #ifdef USE_BINARY_SENSOR
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_binary_sensor_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -187,8 +211,10 @@ void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
 void APIServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_cover_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -196,8 +222,10 @@ void APIServer::on_cover_update(cover::Cover *obj) {
 void APIServer::on_fan_update(fan::Fan *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_fan_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -205,8 +233,10 @@ void APIServer::on_fan_update(fan::Fan *obj) {
 void APIServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_light_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -214,8 +244,10 @@ void APIServer::on_light_update(light::LightState *obj) {
 void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_sensor_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -223,8 +255,10 @@ void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
 void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_switch_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -232,8 +266,10 @@ void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
 void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_text_sensor_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -241,8 +277,10 @@ void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 void APIServer::on_climate_update(climate::Climate *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_climate_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -250,8 +288,10 @@ void APIServer::on_climate_update(climate::Climate *obj) {
 void APIServer::on_number_update(number::Number *obj, float state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_number_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -259,8 +299,10 @@ void APIServer::on_number_update(number::Number *obj, float state) {
 void APIServer::on_date_update(datetime::DateEntity *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_date_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -268,8 +310,10 @@ void APIServer::on_date_update(datetime::DateEntity *obj) {
 void APIServer::on_time_update(datetime::TimeEntity *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_time_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -277,8 +321,10 @@ void APIServer::on_time_update(datetime::TimeEntity *obj) {
 void APIServer::on_datetime_update(datetime::DateTimeEntity *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_datetime_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -286,8 +332,10 @@ void APIServer::on_datetime_update(datetime::DateTimeEntity *obj) {
 void APIServer::on_text_update(text::Text *obj, const std::string &state) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_text_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -295,8 +343,10 @@ void APIServer::on_text_update(text::Text *obj, const std::string &state) {
 void APIServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_select_state(obj, state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -304,8 +354,10 @@ void APIServer::on_select_update(select::Select *obj, const std::string &state,
 void APIServer::on_lock_update(lock::Lock *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_lock_state(obj, obj->state);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -313,8 +365,10 @@ void APIServer::on_lock_update(lock::Lock *obj) {
 void APIServer::on_valve_update(valve::Valve *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_valve_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -322,22 +376,28 @@ void APIServer::on_valve_update(valve::Valve *obj) {
 void APIServer::on_media_player_update(media_player::MediaPlayer *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_media_player_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
 #ifdef USE_EVENT
 void APIServer::on_event(event::Event *obj, const std::string &event_type) {
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_event(obj, event_type);
+  this->end_shared_payload_();
 }
 #endif
 
 #ifdef USE_UPDATE
 void APIServer::on_update(update::UpdateEntity *obj) {
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_update_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
@@ -355,22 +415,54 @@ void APIServer::send_homeassistant_service_call(const HomeassistantServiceRespon
 APIServer::APIServer() { global_api_server = this; }
 void APIServer::subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                                std::function<void(std::string)> f) {
-  this->state_subs_.push_back(HomeAssistantStateSubscription{
-      .entity_id = std::move(entity_id),
-      .attribute = std::move(attribute),
-      .callback = std::move(f),
-      .once = false,
-  });
+  this->add_state_subscription_(std::move(entity_id), std::move(attribute), std::move(f), false);
 }
 void APIServer::get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                          std::function<void(std::string)> f) {
+  this->add_state_subscription_(std::move(entity_id), std::move(attribute), std::move(f), true);
+};
+void APIServer::add_state_subscription_(std::string entity_id, optional<std::string> attribute,
+                                        std::function<void(std::string)> f, bool once) {
+  std::string key = state_sub_key_(entity_id, attribute.value_or(""));
+  auto it = this->state_sub_index_.find(key);
+  if (it != this->state_sub_index_.end()) {
+    auto &sub = this->state_subs_[it->second];
+    // Home Assistant won't send the state again, so hand the late subscriber what it sent last
+    if (sub.last_state.has_value())
+      f(*sub.last_state);
+    sub.callbacks.push_back(std::move(f));
+    sub.once = sub.once && once;
+    return;
+  }
+  this->state_sub_index_.emplace(std::move(key), this->state_subs_.size());
   this->state_subs_.push_back(HomeAssistantStateSubscription{
       .entity_id = std::move(entity_id),
       .attribute = std::move(attribute),
-      .callback = std::move(f),
-      .once = true,
+      .callbacks = {std::move(f)},
+      .once = once,
+      .last_state = {},
   });
-};
+}
+std::string APIServer::state_sub_key_(const std::string &entity_id, const std::string &attribute) {
+  // Entity IDs never contain a space, so it can't be confused with part of the attribute
+  std::string key;
+  key.reserve(entity_id.size() + 1 + attribute.size());
+  key.append(entity_id).append(1, ' ').append(attribute);
+  return key;
+}
+void APIServer::on_home_assistant_state(const std::string &entity_id, const std::string &attribute,
+                                        const std::string &state) {
+  auto it = this->state_sub_index_.find(state_sub_key_(entity_id, attribute));
+  if (it == this->state_sub_index_.end())
+    return;
+  auto &sub = this->state_subs_[it->second];
+  // Home Assistant resends the state whenever any attribute changes, and every client sends it too
+  if (sub.last_state.has_value() && *sub.last_state == state)
+    return;
+  sub.last_state = state;
+  for (auto &callback : sub.callbacks)
+    callback(state);
+}
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
 }
@@ -396,8 +488,10 @@ void APIServer::on_shutdown() {
 void APIServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
   if (obj->is_internal())
     return;
+  this->begin_shared_payload_();
   for (auto &c : this->clients_)
     c->send_alarm_control_panel_state(obj);
+  this->end_shared_payload_();
 }
 #endif
 
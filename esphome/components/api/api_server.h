@@ -13,6 +13,7 @@
 #include "subscribe_state.h"
 #include "user_services.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace esphome {
@@ -91,7 +92,10 @@ class APIServer : public Component, public Controller {
   void on_media_player_update(media_player::MediaPlayer *obj) override;
 #endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call);
-  void register_user_service(UserServiceDescriptor *descriptor) { this->user_services_.push_back(descriptor); }
+  void register_user_service(UserServiceDescriptor *descriptor) {
+    this->user_services_.push_back(descriptor);
+    this->invalidate_list_entities_cache();
+  }
 #ifdef USE_HOMEASSISTANT_TIME
   void request_time();
 #endif
@@ -108,11 +112,15 @@ class APIServer : public Component, public Controller {
 
   bool is_connected() const;
 
+  /// All local subscribers of one Home Assistant entity (attribute), which is subscribed only once.
   struct HomeAssistantStateSubscription {
     std::string entity_id;
     optional<std::string> attribute;
-    std::function<void(std::string)> callback;
+    std::vector<std::function<void(std::string)>> callbacks;
+    /// Only true as long as all callbacks come from get_home_assistant_state()
     bool once;
+    /// The state last passed to the callbacks, repeats of it are dropped
+    optional<std::string> last_state;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, optional<std::string> attribute,
@@ -120,14 +128,53 @@ class APIServer : public Component, public Controller {
   void get_home_assistant_state(std::string entity_id, optional<std::string> attribute,
                                 std::function<void(std::string)> f);
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
+  /// Pass a state received from Home Assistant to its subscribers, unless it's the same as last time.
+  void on_home_assistant_state(const std::string &entity_id, const std::string &attribute, const std::string &state);
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
+  /// A state message encoded once and shared by all clients while fanning out an update.
+  struct SharedPayload {
+    std::vector<uint8_t> data;
+    uint32_t message_type{0};
+    uint8_t depth{0};
+    bool valid{false};
+  };
+  /// The payload to share while an update is fanned out to several clients, or nullptr.
+  SharedPayload *get_shared_payload() { return this->shared_payload_.depth > 0 ? &this->shared_payload_ : nullptr; }
+
+  /// The messages of a complete entity list, as encoded by the first client that listed the entities. The entity
+  /// metadata doesn't change after setup, later clients are sent these messages instead of encoding them again.
+  struct ListEntitiesCache {
+    struct Entry {
+      uint32_t offset;
+      uint32_t size;
+      uint32_t message_type;
+    };
+    std::vector<uint8_t, ExternalRAMAllocator<uint8_t>> data;
+    std::vector<Entry> entries;
+    /// The client recording the messages, nullptr if none
+    APIConnection *recorder{nullptr};
+    /// Incremented with every invalidation, clients sending an older cache list the entities again
+    uint32_t generation{0};
+    bool complete{false};
+  };
+  ListEntitiesCache &get_list_entities_cache() { return this->list_entities_cache_; }
+  /// Encode the entity list again for the next clients. Call it after changing the names, options or other
+  /// metadata of entities at runtime.
+  void invalidate_list_entities_cache();
+
   Trigger<std::string, std::string> *get_client_connected_trigger() const { return this->client_connected_trigger_; }
   Trigger<std::string, std::string> *get_client_disconnected_trigger() const {
     return this->client_disconnected_trigger_;
   }
 
  protected:
+  void begin_shared_payload_();
+  void end_shared_payload_();
+  void add_state_subscription_(std::string entity_id, optional<std::string> attribute,
+                               std::function<void(std::string)> f, bool once);
+  static std::string state_sub_key_(const std::string &entity_id, const std::string &attribute);
+
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
@@ -135,9 +182,13 @@ class APIServer : public Component, public Controller {
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
+  /// Index into state_subs_ by state_sub_key_()
+  std::unordered_map<std::string, size_t> state_sub_index_;
   std::vector<UserServiceDescriptor *> user_services_;
   Trigger<std::string, std::string> *client_connected_trigger_ = new Trigger<std::string, std::string>();
   Trigger<std::string, std::string> *client_disconnected_trigger_ = new Trigger<std::string, std::string>();
+  SharedPayload shared_payload_;
+  ListEntitiesCache list_entities_cache_;
 
 #ifdef USE_API_NOISE
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
@@ -0,0 +1,117 @@
+import logging
+import struct
+import zlib
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+from esphome.core import CORE, coroutine_with_priority
+from esphome.helpers import write_file
+
+_LOGGER = logging.getLogger(__name__)
+
+CODEOWNERS = ["@esphome/core"]
+
+DOMAIN = "asset_partition"
+
+asset_partition_ns = cg.esphome_ns.namespace("asset_partition")
+AssetPartition = asset_partition_ns.class_("AssetPartition", cg.Component)
+
+CONF_PARTITION = "partition"
+
+# Must match AssetHeader in asset_partition.h
+ASSET_MAGIC = 0x41505345  # "ESPA"
+ASSET_VERSION = 1
+ASSET_ALIGNMENT = 4
+ASSET_FILE = "assets.bin"
+
+KEY_DATA = "data"
+KEY_ID = "id"
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(AssetPartition),
+            cv.Optional(CONF_PARTITION, default="assets"): cv.All(
+                cv.string_strict, cv.Length(min=1, max=16)
+            ),
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_with_esp_idf,
+)
+
+
+def _get_data() -> dict:
+    return CORE.data.setdefault(DOMAIN, {KEY_DATA: bytearray(), KEY_ID: None})
+
+
+def is_enabled() -> bool:
+    """Whether the assets of fonts, images and animations go to the partition."""
+    return DOMAIN in CORE.config
+
+
+def add_asset(data: list[int]) -> cg.Expression:
+    """Append data to the partition and return an expression for its address.
+
+    Only valid once to_code() of this component ran, it has a higher priority than the
+    components with assets.
+    """
+    assets = _get_data()
+    blob = assets[KEY_DATA]
+    blob.extend(b"\0" * (-len(blob) % ASSET_ALIGNMENT))
+    offset = len(blob)
+    blob.extend(bytes(data))
+    return cg.RawExpression(f"{assets[KEY_ID]}->get({offset})")
+
+
+class _BlobValue(cg.Expression):
+    """Size or CRC of the blob, rendered once all assets were added."""
+
+    __slots__ = ("crc",)
+
+    def __init__(self, crc: bool):
+        self.crc = crc
+
+    def __str__(self):
+        blob = bytes(_get_data()[KEY_DATA])
+        if self.crc:
+            return f"0x{zlib.crc32(blob):08X}"
+        return str(len(blob))
+
+
+@coroutine_with_priority(-999.0)
+async def _write_blob():
+    blob = bytes(_get_data()[KEY_DATA])
+    header = struct.pack(
+        "<4I", ASSET_MAGIC, ASSET_VERSION, len(blob), zlib.crc32(blob)
+    )
+    path = CORE.relative_build_path(ASSET_FILE)
+    content = header + blob
+    try:
+        with open(path, "rb") as f_handle:
+            unchanged = f_handle.read() == content
+    except OSError:
+        unchanged = False
+    if not unchanged:
+        write_file(path, content)
+    _LOGGER.info(
+        "Assets take %d bytes, flash %s to the '%s' partition after changing them",
+        len(content),
+        path,
+        CORE.config[DOMAIN][CONF_PARTITION],
+    )
+
+
+# Before the fonts, images and animations add their data
+@coroutine_with_priority(100.0)
+async def to_code(config):
+    _get_data()[KEY_ID] = config[CONF_ID]
+    var = cg.new_Pvariable(
+        config[CONF_ID],
+        config[CONF_PARTITION],
+        _BlobValue(False),
+        _BlobValue(True),
+    )
+    await cg.register_component(var, config)
+    cg.add_define("USE_ASSET_PARTITION")
+    CORE.add_job(_write_blob)
@@ -0,0 +1,75 @@
+#ifdef USE_ESP_IDF
+
+#include "asset_partition.h"
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace asset_partition {
+
+static const char *const TAG = "asset_partition";
+
+static const uint32_t ASSET_MAGIC = 0x41505345;  // "ESPA"
+static const uint32_t ASSET_VERSION = 1;
+
+AssetPartition::AssetPartition(const char *label, uint32_t size, uint32_t crc)
+    : label_(label), size_(size), crc_(crc) {
+  // Too early for logging, setup() reports the error
+  this->error_ = this->map_();
+  if (this->error_ == nullptr)
+    return;
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  uint8_t *zeros = allocator.allocate(this->size_);
+  if (zeros != nullptr)
+    memset(zeros, 0, this->size_);
+  this->data_ = zeros;
+}
+
+const char *AssetPartition::map_() {
+  const esp_partition_t *partition =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, this->label_);
+  if (partition == nullptr)
+    return "The partition does not exist";
+  const uint32_t length = sizeof(AssetHeader) + this->size_;
+  if (partition->size < length)
+    return "The partition is too small for the assets";
+
+  const void *mapped;
+  if (esp_partition_mmap(partition, 0, length, ESP_PARTITION_MMAP_DATA, &mapped, &this->mmap_handle_) != ESP_OK)
+    return "The partition could not be mapped";
+  AssetHeader header;
+  memcpy(&header, mapped, sizeof(header));
+  // The CRC identifies the assets, checking it against the flash would take too long at boot
+  if (header.magic != ASSET_MAGIC || header.version != ASSET_VERSION || header.size != this->size_ ||
+      header.crc != this->crc_) {
+    esp_partition_munmap(this->mmap_handle_);
+    return "The partition holds no or other assets, flash the assets.bin of this build to it";
+  }
+  this->data_ = static_cast<const uint8_t *>(mapped) + sizeof(AssetHeader);
+  return nullptr;
+}
+
+void AssetPartition::setup() {
+  if (this->error_ != nullptr) {
+    ESP_LOGE(TAG, "Assets of partition '%s' are not available: %s", this->label_, this->error_);
+    this->status_set_error();
+  }
+}
+
+void AssetPartition::dump_config() {
+  ESP_LOGCONFIG(TAG, "Asset Partition:");
+  ESP_LOGCONFIG(TAG, "  Partition: %s", this->label_);
+  ESP_LOGCONFIG(TAG, "  Size: %" PRIu32 " bytes", this->size_);
+  ESP_LOGCONFIG(TAG, "  CRC: 0x%08" PRIX32, this->crc_);
+  if (this->error_ != nullptr)
+    ESP_LOGE(TAG, "  %s", this->error_);
+}
+
+}  // namespace asset_partition
+}  // namespace esphome
+
+#endif  // USE_ESP_IDF
@@ -0,0 +1,59 @@
+#pragma once
+
+#ifdef USE_ESP_IDF
+
+#include "esphome/core/component.h"
+
+#include <esp_partition.h>
+
+namespace esphome {
+namespace asset_partition {
+
+/// Start of the partition, followed by the assets. Must match asset_partition/__init__.py.
+struct AssetHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  uint32_t crc;
+};
+
+/** Font, image and animation data in a flash data partition instead of the firmware.
+ *
+ * The partition is written separately, from the `assets.bin` of the build, so the firmware shrinks and the assets
+ * don't have to be part of every OTA. It is memory mapped like the firmware's own constants, the assets are read
+ * through the pointers handed out by get().
+ *
+ * The assets are mapped when constructing, as the fonts and images take their pointers in their constructors. If the
+ * partition is missing or holds the assets of another build, they are replaced by zeros: everything draws blank,
+ * and setup() reports the error.
+ */
+class AssetPartition : public Component {
+ public:
+  /// @param label The label of the data partition.
+  /// @param size The size of the assets, without the header.
+  /// @param crc The CRC32 of the assets, identifying the build they were written by.
+  AssetPartition(const char *label, uint32_t size, uint32_t crc);
+
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  /// The asset at `offset`, valid for the whole runtime.
+  const uint8_t *get(uint32_t offset) const { return this->data_ + offset; }
+
+ protected:
+  const char *map_();
+
+  const char *label_;
+  uint32_t size_;
+  uint32_t crc_;
+  const uint8_t *data_{nullptr};
+  esp_partition_mmap_handle_t mmap_handle_{0};
+  /// Why the assets are zero, nullptr if they were mapped
+  const char *error_{nullptr};
+};
+
+}  // namespace asset_partition
+}  // namespace esphome
+
+#endif  // USE_ESP_IDF
@@ -0,0 +1,51 @@
+from esphome import automation
+from esphome.automation import maybe_simple_id
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/core"]
+
+CONF_BENCHMARK_ID = "benchmark_id"
+
+benchmark_ns = cg.esphome_ns.namespace("benchmark")
+BenchmarkComponent = benchmark_ns.class_("BenchmarkComponent", cg.Component)
+RunAction = benchmark_ns.class_("RunAction", automation.Action)
+
+BenchmarkTest = benchmark_ns.enum("BenchmarkTest")
+BENCHMARK_TESTS = {
+    "scheduler": BenchmarkTest.BENCHMARK_SCHEDULER,
+    "filter_chain": BenchmarkTest.BENCHMARK_FILTER_CHAIN,
+    "proto_encode": BenchmarkTest.BENCHMARK_PROTO_ENCODE,
+    "noise_encrypt": BenchmarkTest.BENCHMARK_NOISE_ENCRYPT,
+    "sha256": BenchmarkTest.BENCHMARK_SHA256,
+    "build_json": BenchmarkTest.BENCHMARK_BUILD_JSON,
+    "filled_rectangle": BenchmarkTest.BENCHMARK_FILLED_RECTANGLE,
+    "crc16": BenchmarkTest.BENCHMARK_CRC16,
+}
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(BenchmarkComponent),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+
+@automation.register_action(
+    "benchmark.run",
+    RunAction,
+    maybe_simple_id(
+        {
+            cv.GenerateID(): cv.use_id(BenchmarkComponent),
+        }
+    ),
+)
+async def benchmark_run_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    return var
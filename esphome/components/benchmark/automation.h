@@ -0,0 +1,17 @@
+#pragma once
+
+#include "esphome/core/automation.h"
+#include "esphome/core/helpers.h"
+
+#include "benchmark.h"
+
+namespace esphome {
+namespace benchmark {
+
+template<typename... Ts> class RunAction : public Action<Ts...>, public Parented<BenchmarkComponent> {
+ public:
+  void play(Ts... x) override { this->parent_->run(); }
+};
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -0,0 +1,266 @@
+#include "benchmark.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_API
+#include "esphome/components/api/api_pb2.h"
+#endif
+#ifdef USE_API_NOISE
+#include "noise/protocol.h"
+#endif
+#ifdef USE_JSON
+#include "esphome/components/json/json_util.h"
+#endif
+#ifdef USE_DISPLAY
+#include "esphome/components/display/display_buffer.h"
+#endif
+
+#include <cmath>
+
+namespace esphome {
+namespace benchmark {
+
+static const char *const TAG = "benchmark";
+
+// Size of the input of crc16, sha256 and noise_encrypt
+static const size_t DATA_SIZE = 1024;
+
+static const char *const BENCHMARK_NAMES[BENCHMARK_COUNT] = {
+    "Scheduler set_timeout + cancel_timeout",
+    "Sensor publish through 4 filters",
+    "Proto encode of a sensor state",
+    "Noise encrypt of 1024 bytes",
+    "SHA256 of 1024 bytes",
+    "build_json with 3 members",
+    "filled_rectangle of 128x64 RGB565",
+    "crc16 of 1024 bytes",
+};
+
+#ifdef USE_DISPLAY
+/// RGB565 display in RAM, filled row by row like the buffers of the display drivers.
+class MemoryDisplay : public display::DisplayBuffer {
+ public:
+  static const int WIDTH = 128;
+  static const int HEIGHT = 64;
+
+  MemoryDisplay() { this->init_internal_(WIDTH * HEIGHT * 2); }
+  void update() override {}
+  display::DisplayType get_display_type() override { return display::DISPLAY_TYPE_COLOR; }
+
+ protected:
+  int get_width_internal() override { return WIDTH; }
+  int get_height_internal() override { return HEIGHT; }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    this->fill_rect_internal(x, y, 1, 1, color);
+  }
+  void fill_rect_internal(int x, int y, int width, int height, Color color) override {
+    if (this->buffer_ == nullptr)
+      return;
+    const uint16_t value = display::ColorUtil::color_to_565(color);
+    for (int row = y; row < y + height; row++) {
+      uint8_t *ptr = this->buffer_ + (row * WIDTH + x) * 2;
+      for (int col = 0; col < width; col++) {
+        *ptr++ = value >> 8;
+        *ptr++ = value;
+      }
+    }
+  }
+};
+#endif
+
+void BenchmarkComponent::run() {
+  if (this->next_ != BENCHMARK_COUNT) {
+    ESP_LOGW(TAG, "Benchmarks are still running");
+    return;
+  }
+  if (!this->data_) {
+    this->data_.reset(new uint8_t[DATA_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+    for (size_t i = 0; i < DATA_SIZE; i++)
+      this->data_[i] = i * 31;
+  }
+  ESP_LOGI(TAG, "Running benchmarks:");
+  this->next_ = 0;
+  this->defer([this]() { this->run_next_(); });
+}
+
+void BenchmarkComponent::run_next_() {
+  const auto test = static_cast<BenchmarkTest>(this->next_++);
+  const float result = this->measure_(test);
+  if (std::isnan(result)) {
+    ESP_LOGI(TAG, "  %s: not available", BENCHMARK_NAMES[test]);
+  } else {
+    ESP_LOGI(TAG, "  %s: %.3f us", BENCHMARK_NAMES[test], result);
+#ifdef USE_SENSOR
+    if (this->sensors_[test] != nullptr)
+      this->sensors_[test]->publish_state(result);
+#endif
+  }
+  if (this->next_ < BENCHMARK_COUNT)
+    this->defer([this]() { this->run_next_(); });
+}
+
+float BenchmarkComponent::measure_(BenchmarkTest test) {
+  switch (test) {
+    case BENCHMARK_SCHEDULER:
+      return this->bench_scheduler_();
+    case BENCHMARK_FILTER_CHAIN:
+      return this->bench_filter_chain_();
+    case BENCHMARK_PROTO_ENCODE:
+      return this->bench_proto_encode_();
+    case BENCHMARK_NOISE_ENCRYPT:
+      return this->bench_noise_encrypt_();
+    case BENCHMARK_SHA256:
+      return this->bench_sha256_();
+    case BENCHMARK_BUILD_JSON:
+      return this->bench_build_json_();
+    case BENCHMARK_FILLED_RECTANGLE:
+      return this->bench_filled_rectangle_();
+    case BENCHMARK_CRC16:
+      return this->bench_crc16_();
+    default:
+      return NAN;
+  }
+}
+
+float BenchmarkComponent::bench_scheduler_() {
+  static const uint32_t ITERATIONS = 200;
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++) {
+    this->set_timeout("benchmark", 60000, []() {});
+    this->cancel_timeout("benchmark");
+  }
+  return float(micros() - start) / ITERATIONS;
+}
+
+float BenchmarkComponent::bench_filter_chain_() {
+#ifdef USE_SENSOR
+  static const uint32_t ITERATIONS = 500;
+  sensor::Sensor sensor;
+  sensor.add_filters({new sensor::OffsetFilter(1.0f), new sensor::MultiplyFilter(2.0f),
+                      new sensor::SlidingWindowMovingAverageFilter(5, 1, 1), new sensor::DeltaFilter(0.0f, false)});
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++)
+    sensor.publish_state(i);
+  return float(micros() - start) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_proto_encode_() {
+#ifdef USE_API
+  static const uint32_t ITERATIONS = 500;
+  api::SensorStateResponse msg;
+  msg.key = 0x12345678;
+  std::vector<uint8_t> buffer;
+  buffer.reserve(32);
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++) {
+    buffer.clear();
+    msg.state = i;
+    msg.encode(api::ProtoWriteBuffer(&buffer));
+  }
+  return float(micros() - start) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_noise_encrypt_() {
+#ifdef USE_API_NOISE
+  static const uint32_t ITERATIONS = 50;
+  static const size_t MAC_SIZE = 16;
+  NoiseCipherState *cipher;
+  if (noise_cipherstate_new_by_id(&cipher, NOISE_CIPHER_CHACHAPOLY) != NOISE_ERROR_NONE)
+    return NAN;
+  const uint8_t key[32] = {1, 2, 3, 4, 5, 6, 7, 8};
+  noise_cipherstate_init_key(cipher, key, sizeof(key));
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[DATA_SIZE + MAC_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++) {
+    memcpy(buffer.get(), this->data_.get(), DATA_SIZE);
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, buffer.get(), DATA_SIZE, DATA_SIZE + MAC_SIZE);
+    noise_cipherstate_encrypt(cipher, &mbuf);
+  }
+  const uint32_t duration = micros() - start;
+  noise_cipherstate_free(cipher);
+  return float(duration) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_sha256_() {
+#ifdef USE_API_NOISE
+  // The hash of the API handshake
+  static const uint32_t ITERATIONS = 50;
+  NoiseHashState *hash;
+  if (noise_hashstate_new_by_id(&hash, NOISE_HASH_SHA256) != NOISE_ERROR_NONE)
+    return NAN;
+  uint8_t digest[32];
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++)
+    noise_hashstate_hash_one(hash, this->data_.get(), DATA_SIZE, digest, sizeof(digest));
+  const uint32_t duration = micros() - start;
+  noise_hashstate_free(hash);
+  return float(duration) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_build_json_() {
+#ifdef USE_JSON
+  static const uint32_t ITERATIONS = 100;
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++) {
+    json::build_json([i](JsonObject root) {
+      root["id"] = "sensor-benchmark";
+      root["state"] = "12.3 °C";
+      root["value"] = i;
+    });
+  }
+  return float(micros() - start) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_filled_rectangle_() {
+#ifdef USE_DISPLAY
+  static const uint32_t ITERATIONS = 20;
+  MemoryDisplay display;
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++)
+    display.filled_rectangle(0, 0, MemoryDisplay::WIDTH, MemoryDisplay::HEIGHT, Color(i * 10, 128, 255 - i * 10));
+  return float(micros() - start) / ITERATIONS;
+#else
+  return NAN;
+#endif
+}
+
+float BenchmarkComponent::bench_crc16_() {
+  static const uint32_t ITERATIONS = 50;
+  volatile uint16_t crc = 0;
+  const uint32_t start = micros();
+  for (uint32_t i = 0; i < ITERATIONS; i++)
+    crc = crc16(this->data_.get(), DATA_SIZE);
+  (void) crc;
+  return float(micros() - start) / ITERATIONS;
+}
+
+void BenchmarkComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Benchmark:");
+#ifdef USE_SENSOR
+  for (uint8_t i = 0; i < BENCHMARK_COUNT; i++) {
+    if (this->sensors_[i] != nullptr)
+      LOG_SENSOR("  ", BENCHMARK_NAMES[i], this->sensors_[i]);
+  }
+#endif
+}
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
+#include <memory>
+
+namespace esphome {
+namespace benchmark {
+
+enum BenchmarkTest : uint8_t {
+  BENCHMARK_SCHEDULER = 0,
+  BENCHMARK_FILTER_CHAIN,
+  BENCHMARK_PROTO_ENCODE,
+  BENCHMARK_NOISE_ENCRYPT,
+  BENCHMARK_SHA256,
+  BENCHMARK_BUILD_JSON,
+  BENCHMARK_FILLED_RECTANGLE,
+  BENCHMARK_CRC16,
+  BENCHMARK_COUNT,
+};
+
+/** Times hot paths of ESPHome on the device it runs on, to compare chips and memory placement.
+ *
+ * run() goes through the benchmarks one per loop, so the main loop keeps running in between. Each result is the
+ * average time of one operation, logged and published to the sensor of the benchmark. Benchmarks of components that
+ * aren't part of the build are skipped: the filter chain needs sensor, proto_encode the api, noise_encrypt and sha256
+ * the api with encryption, build_json json and filled_rectangle display.
+ */
+class BenchmarkComponent : public Component {
+ public:
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  /// Start the benchmarks, ignored while they still run.
+  void run();
+
+#ifdef USE_SENSOR
+  void set_sensor(BenchmarkTest test, sensor::Sensor *sensor) { this->sensors_[test] = sensor; }
+#endif
+
+ protected:
+  void run_next_();
+  /// Microseconds per operation, NAN if the benchmark isn't available.
+  float measure_(BenchmarkTest test);
+
+  float bench_scheduler_();
+  float bench_filter_chain_();
+  float bench_proto_encode_();
+  float bench_noise_encrypt_();
+  float bench_sha256_();
+  float bench_build_json_();
+  float bench_filled_rectangle_();
+  float bench_crc16_();
+
+  /// The next benchmark to run, BENCHMARK_COUNT while idle
+  uint8_t next_{BENCHMARK_COUNT};
+  /// Input of the data benchmarks
+  std::unique_ptr<uint8_t[]> data_;
+#ifdef USE_SENSOR
+  sensor::Sensor *sensors_[BENCHMARK_COUNT]{};
+#endif
+};
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -0,0 +1,28 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import CONF_TYPE, ENTITY_CATEGORY_DIAGNOSTIC, ICON_TIMER
+
+from . import BENCHMARK_TESTS, CONF_BENCHMARK_ID, BenchmarkComponent
+
+DEPENDENCIES = ["benchmark"]
+
+UNIT_MICROSECOND = "µs"
+
+CONFIG_SCHEMA = sensor.sensor_schema(
+    unit_of_measurement=UNIT_MICROSECOND,
+    icon=ICON_TIMER,
+    accuracy_decimals=2,
+    entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+).extend(
+    {
+        cv.GenerateID(CONF_BENCHMARK_ID): cv.use_id(BenchmarkComponent),
+        cv.Required(CONF_TYPE): cv.enum(BENCHMARK_TESTS, lower=True),
+    }
+)
+
+
+async def to_code(config):
+    parent = await cg.get_variable(config[CONF_BENCHMARK_ID])
+    sens = await sensor.new_sensor(config)
+    cg.add(parent.set_sensor(config[CONF_TYPE], sens))
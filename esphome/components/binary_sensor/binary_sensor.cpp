@@ -20,6 +20,12 @@ void BinarySensor::publish_state(bool state) {
     this->filter_list_->input(state, false);
   }
 }
+void BinarySensor::publish_state(bool state, uint32_t age) {
+  // The filters only see the age while they handle this state, their timeouts later on start from scratch
+  this->input_age_ = age;
+  this->publish_state(state);
+  this->input_age_ = 0;
+}
 void BinarySensor::publish_initial_state(bool state) {
   if (!this->publish_dedup_.next(state))
     return;
@@ -50,6 +50,15 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
    */
   void publish_state(bool state);
 
+  /** Publish a state the input already had for a while, for example one latched by an interrupt.
+   *
+   * The delayed filters count their delays from the change of the input, instead of from now.
+   *
+   * @param state The new state.
+   * @param age For how many milliseconds the input has had this state already.
+   */
+  void publish_state(bool state, uint32_t age);
+
   /** Publish the initial state, this will not make the callback manager send callbacks
    * and is meant only for the initial state on boot.
    *
@@ -68,6 +77,8 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   void send_state_internal(bool state, bool is_initial);
+  /// The age of the state currently passed to the filters, see publish_state(bool, uint32_t).
+  uint32_t get_input_age() const { return this->input_age_; }
 
   /// Return whether this binary sensor has outputted a state.
   virtual bool has_state() const;
@@ -79,6 +90,7 @@ class BinarySensor : public EntityBase, public EntityBase_DeviceClass {
   Filter *filter_list_{nullptr};
   bool has_state_{false};
   bool publish_initial_state_{false};
+  uint32_t input_age_{0};
   Deduplicator<bool> publish_dedup_;
 };
 
@@ -1,6 +1,8 @@
 #include "filter.h"
 
 #include "binary_sensor.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include <utility>
 
 namespace esphome {
@@ -9,6 +11,11 @@ namespace binary_sensor {
 
 static const char *const TAG = "sensor.filter";
 
+// Timeouts are re-armed on every input edge, so identify them by id instead of by name
+static constexpr uint32_t TIMEOUT_DEADLINE = fnv1_hash_constexpr("DEADLINE");
+static constexpr uint32_t TIMEOUT_ON_OFF = fnv1_hash_constexpr("ON_OFF");
+static constexpr uint32_t TIMEOUT_TIMING = fnv1_hash_constexpr("TIMING");
+
 void Filter::output(bool value, bool is_initial) {
   if (!this->dedup_.next(value))
     return;
@@ -26,40 +33,89 @@ void Filter::input(bool value, bool is_initial) {
   }
 }
 
+uint32_t Filter::remaining_delay_(uint32_t delay) const {
+  const uint32_t age = this->parent_->get_input_age();
+  return age < delay ? delay - age : 0;
+}
+
+void TimedFilter::arm_(uint32_t delay) {
+  const uint32_t now = millis();
+  this->deadline_ = now + delay;
+  this->armed_ = true;
+  // A timeout that fires before the new deadline just re-schedules itself, only one that fires too late is replaced
+  if (this->scheduled_ && int32_t(this->deadline_ - this->fire_at_) >= 0)
+    return;
+  this->schedule_(now, delay);
+}
+
+void TimedFilter::schedule_(uint32_t now, uint32_t delay) {
+  this->scheduled_ = true;
+  this->fire_at_ = now + delay;
+  this->set_timeout(TIMEOUT_DEADLINE, delay, [this]() { this->deadline_timeout_(); });
+}
+
+void TimedFilter::deadline_timeout_() {
+  this->scheduled_ = false;
+  if (!this->armed_)
+    return;
+  const uint32_t now = millis();
+  const int32_t remaining = int32_t(this->deadline_ - now);
+  if (remaining > 0) {
+    this->schedule_(now, remaining);
+    return;
+  }
+  this->armed_ = false;
+  this->on_deadline_();
+}
+
+float TimedFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+
 optional<bool> DelayedOnOffFilter::new_value(bool value, bool is_initial) {
-  if (value) {
-    this->set_timeout("ON_OFF", this->on_delay_.value(), [this, is_initial]() { this->output(true, is_initial); });
-  } else {
-    this->set_timeout("ON_OFF", this->off_delay_.value(), [this, is_initial]() { this->output(false, is_initial); });
+  const uint32_t delay = this->remaining_delay_(value ? this->on_delay_.value() : this->off_delay_.value());
+  if (delay == 0) {
+    // The input already held the state long enough, the next state may follow within the same loop iteration
+    this->disarm_();
+    return value;
   }
+  this->pending_value_ = value;
+  this->pending_initial_ = is_initial;
+  this->arm_(delay);
   return {};
 }
 
-float DelayedOnOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOnOffFilter::on_deadline_() { this->output(this->pending_value_, this->pending_initial_); }
 
 optional<bool> DelayedOnFilter::new_value(bool value, bool is_initial) {
   if (value) {
-    this->set_timeout("ON", this->delay_.value(), [this, is_initial]() { this->output(true, is_initial); });
+    const uint32_t delay = this->remaining_delay_(this->delay_.value());
+    if (delay == 0)
+      return true;
+    this->pending_initial_ = is_initial;
+    this->arm_(delay);
     return {};
   } else {
-    this->cancel_timeout("ON");
+    this->disarm_();
     return false;
   }
 }
 
-float DelayedOnFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOnFilter::on_deadline_() { this->output(true, this->pending_initial_); }
 
 optional<bool> DelayedOffFilter::new_value(bool value, bool is_initial) {
   if (!value) {
-    this->set_timeout("OFF", this->delay_.value(), [this, is_initial]() { this->output(false, is_initial); });
+    const uint32_t delay = this->remaining_delay_(this->delay_.value());
+    if (delay == 0)
+      return false;
+    this->pending_initial_ = is_initial;
+    this->arm_(delay);
     return {};
   } else {
-    this->cancel_timeout("OFF");
+    this->disarm_();
     return true;
   }
 }
 
-float DelayedOffFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void DelayedOffFilter::on_deadline_() { this->output(false, this->pending_initial_); }
 
 optional<bool> InvertFilter::new_value(bool value, bool is_initial) { return !value; }
 
@@ -74,8 +130,8 @@ optional<bool> AutorepeatFilter::new_value(bool value, bool is_initial) {
     this->next_timing_();
     return true;
   } else {
-    this->cancel_timeout("TIMING");
-    this->cancel_timeout("ON_OFF");
+    this->cancel_timeout(TIMEOUT_TIMING);
+    this->cancel_timeout(TIMEOUT_ON_OFF);
     this->active_timing_ = 0;
     return false;
   }
@@ -87,7 +143,7 @@ void AutorepeatFilter::next_timing_() {
   // 2nd time: starts waiting the second delay and starts toggling with the first time_off / _on
   // last time: no delay to start but have to bump the index to reflect the last
   if (this->active_timing_ < this->timings_.size())
-    this->set_timeout("TIMING", this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
+    this->set_timeout(TIMEOUT_TIMING, this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
 
   if (this->active_timing_ <= this->timings_.size()) {
     this->active_timing_++;
@@ -102,7 +158,7 @@ void AutorepeatFilter::next_timing_() {
 void AutorepeatFilter::next_value_(bool val) {
   const AutorepeatFilterTiming &timing = this->timings_[this->active_timing_ - 2];
   this->output(val, false);  // This is at least the second one so not initial
-  this->set_timeout("ON_OFF", val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
+  this->set_timeout(TIMEOUT_ON_OFF, val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
 }
 
 float AutorepeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
@@ -113,20 +169,28 @@ optional<bool> LambdaFilter::new_value(bool value, bool is_initial) { return thi
 
 optional<bool> SettleFilter::new_value(bool value, bool is_initial) {
   if (!this->steady_) {
-    this->set_timeout("SETTLE", this->delay_.value(), [this, value, is_initial]() {
-      this->steady_ = true;
-      this->output(value, is_initial);
-    });
+    // Hold the change back until the input settled
+    this->has_pending_ = true;
+    this->pending_value_ = value;
+    this->pending_initial_ = is_initial;
+    this->arm_(this->delay_.value());
     return {};
   } else {
     this->steady_ = false;
+    this->has_pending_ = false;
     this->output(value, is_initial);
-    this->set_timeout("SETTLE", this->delay_.value(), [this]() { this->steady_ = true; });
+    this->arm_(this->delay_.value());
     return value;
   }
 }
 
-float SettleFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
+void SettleFilter::on_deadline_() {
+  this->steady_ = true;
+  if (this->has_pending_) {
+    this->has_pending_ = false;
+    this->output(this->pending_value_, this->pending_initial_);
+  }
+}
 
 }  // namespace binary_sensor
 
@@ -23,46 +23,79 @@ class Filter {
  protected:
   friend BinarySensor;
 
+  /// The part of the delay the input hasn't already waited for, 0 if the delay is over.
+  uint32_t remaining_delay_(uint32_t delay) const;
+
   Filter *next_{nullptr};
   BinarySensor *parent_{nullptr};
   Deduplicator<bool> dedup_;
 };
 
-class DelayedOnOffFilter : public Filter, public Component {
+/** A filter that waits for a deadline, which is re-armed on every input edge.
+ *
+ * Re-arming only moves the deadline. The single scheduler timeout behind it is left alone if it fires before the
+ * deadline, it then re-schedules itself for the rest of the time. So a chattering input doesn't create or cancel
+ * a scheduler item per edge, and the timeout callback never allocates.
+ */
+class TimedFilter : public Filter, public Component {
  public:
-  optional<bool> new_value(bool value, bool is_initial) override;
-
   float get_setup_priority() const override;
 
+ protected:
+  /// Call on_deadline_() in delay ms, replacing the current deadline.
+  void arm_(uint32_t delay);
+  void disarm_() { this->armed_ = false; }
+  virtual void on_deadline_() = 0;
+
+  void schedule_(uint32_t now, uint32_t delay);
+  void deadline_timeout_();
+
+  /// The state to output when the deadline is reached
+  bool pending_value_{false};
+  bool pending_initial_{false};
+
+  uint32_t deadline_{0};
+  /// When the scheduled timeout fires
+  uint32_t fire_at_{0};
+  bool armed_{false};
+  bool scheduled_{false};
+};
+
+class DelayedOnOffFilter : public TimedFilter {
+ public:
+  optional<bool> new_value(bool value, bool is_initial) override;
+
   template<typename T> void set_on_delay(T delay) { this->on_delay_ = delay; }
   template<typename T> void set_off_delay(T delay) { this->off_delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> on_delay_{};
   TemplatableValue<uint32_t> off_delay_{};
 };
 
-class DelayedOnFilter : public Filter, public Component {
+class DelayedOnFilter : public TimedFilter {
  public:
   optional<bool> new_value(bool value, bool is_initial) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
-class DelayedOffFilter : public Filter, public Component {
+class DelayedOffFilter : public TimedFilter {
  public:
   optional<bool> new_value(bool value, bool is_initial) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
 };
 
@@ -108,17 +141,19 @@ class LambdaFilter : public Filter {
   std::function<optional<bool>(bool)> f_;
 };
 
-class SettleFilter : public Filter, public Component {
+class SettleFilter : public TimedFilter {
  public:
   optional<bool> new_value(bool value, bool is_initial) override;
 
-  float get_setup_priority() const override;
-
   template<typename T> void set_delay(T delay) { this->delay_ = delay; }
 
  protected:
+  void on_deadline_() override;
+
   TemplatableValue<uint32_t> delay_{};
   bool steady_{true};
+  /// Whether the input changed while it wasn't steady, so the deadline has to output pending_value_
+  bool has_pending_{false};
 };
 
 }  // namespace binary_sensor
@@ -1,8 +1,10 @@
 import esphome.codegen as cg
 from esphome.components import esp32_ble_client, esp32_ble_tracker
-from esphome.components.esp32 import add_idf_sdkconfig_option
+from esphome.components.esp32 import add_idf_sdkconfig_option, get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32
 import esphome.config_validation as cv
 from esphome.const import CONF_ACTIVE, CONF_ID
+from esphome.core import CORE
 
 AUTO_LOAD = ["esp32_ble_client", "esp32_ble_tracker"]
 DEPENDENCIES = ["api", "esp32"]
@@ -10,7 +12,12 @@ CODEOWNERS = ["@jesserockz"]
 
 CONF_CACHE_SERVICES = "cache_services"
 CONF_CONNECTIONS = "connections"
+CONF_RAW_ADVERTISEMENTS_BATCH_INTERVAL = "raw_advertisements_batch_interval"
+CONF_RAW_ADVERTISEMENTS_BATCH_SIZE = "raw_advertisements_batch_size"
 MAX_CONNECTIONS = 3
+# The controller and Bluedroid support up to 9 connections, the Arduino libraries
+# are built for 3
+MAX_CONNECTIONS_IDF = 9
 
 bluetooth_proxy_ns = cg.esphome_ns.namespace("bluetooth_proxy")
 
@@ -28,6 +35,15 @@ CONNECTION_SCHEMA = esp32_ble_tracker.ESP_BLE_DEVICE_SCHEMA.extend(
 ).extend(cv.COMPONENT_SCHEMA)
 
 
+def validate_connection_count(value):
+    max_connections = MAX_CONNECTIONS_IDF if CORE.using_esp_idf else MAX_CONNECTIONS
+    if len(value) > max_connections:
+        raise cv.Invalid(
+            f"At most {max_connections} connections are supported with this framework"
+        )
+    return value
+
+
 def validate_connections(config):
     if CONF_CONNECTIONS in config:
         if not config[CONF_ACTIVE]:
@@ -52,9 +68,16 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_CACHE_SERVICES, esp32_idf=True): cv.All(
                 cv.only_with_esp_idf, cv.boolean
             ),
+            cv.Optional(CONF_RAW_ADVERTISEMENTS_BATCH_SIZE, default=16): cv.int_range(
+                min=1, max=64
+            ),
+            cv.Optional(
+                CONF_RAW_ADVERTISEMENTS_BATCH_INTERVAL, default="100ms"
+            ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_CONNECTIONS): cv.All(
                 cv.ensure_list(CONNECTION_SCHEMA),
-                cv.Length(min=1, max=MAX_CONNECTIONS),
+                cv.Length(min=1),
+                validate_connection_count,
             ),
         }
     )
@@ -69,6 +92,16 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_active(config[CONF_ACTIVE]))
+    cg.add(
+        var.set_raw_advertisements_batch_size(
+            config[CONF_RAW_ADVERTISEMENTS_BATCH_SIZE]
+        )
+    )
+    cg.add(
+        var.set_raw_advertisements_batch_interval(
+            config[CONF_RAW_ADVERTISEMENTS_BATCH_INTERVAL]
+        )
+    )
     await esp32_ble_tracker.register_ble_device(var, config)
 
     for connection_conf in config.get(CONF_CONNECTIONS, []):
@@ -77,6 +110,12 @@ async def to_code(config):
         cg.add(var.register_connection(connection_var))
         await esp32_ble_tracker.register_client(connection_var, connection_conf)
 
+    connection_count = len(config.get(CONF_CONNECTIONS, []))
+    if connection_count > MAX_CONNECTIONS and get_esp32_variant() == VARIANT_ESP32:
+        # The other variants allow 10 BLE activities by default, which covers the scan
+        # and all connections
+        add_idf_sdkconfig_option("CONFIG_BTDM_CTRL_BLE_MAX_CONN", connection_count)
+
     if config.get(CONF_CACHE_SERVICES):
         add_idf_sdkconfig_option("CONFIG_BT_GATTC_CACHE_NVS_FLASH", True)
 
@@ -2,7 +2,9 @@
 
 #ifdef USE_ESP32
 
+#include "esphome/components/api/api_pb2.h"
 #include "esphome/components/esp32_ble_client/ble_client_base.h"
+#include "esphome/core/string_ref.h"
 
 namespace esphome {
 namespace bluetooth_proxy {
@@ -17,9 +19,9 @@ class BluetoothConnection : public esp32_ble_client::BLEClientBase {
   esp32_ble_tracker::AdvertisementParserType get_advertisement_parser_type() override;
 
   esp_err_t read_characteristic(uint16_t handle);
-  esp_err_t write_characteristic(uint16_t handle, const std::string &data, bool response);
+  esp_err_t write_characteristic(uint16_t handle, const StringRef &data, bool response);
   esp_err_t read_descriptor(uint16_t handle);
-  esp_err_t write_descriptor(uint16_t handle, const std::string &data, bool response);
+  esp_err_t write_descriptor(uint16_t handle, const StringRef &data, bool response);
 
   esp_err_t notify_characteristic(uint16_t handle, bool enable);
 
@@ -29,6 +31,8 @@ class BluetoothConnection : public esp32_ble_client::BLEClientBase {
 
   int16_t send_service_{-2};
   BluetoothProxy *proxy_;
+  // Reused for every notification, so its buffer is only allocated once per connection
+  api::BluetoothGATTNotifyDataResponse notify_data_resp_;
 };
 
 }  // namespace bluetooth_proxy
@@ -10,6 +10,8 @@ namespace bluetooth_proxy {
 
 static const char *const TAG = "bluetooth_proxy";
 static const int DONE_SENDING_SERVICES = -2;
+// Services stop being added to a response once it grows past this many bytes
+static const uint32_t MAX_SERVICES_RESPONSE_SIZE = 1024;
 
 std::vector<uint64_t> get_128bit_uuid_vec(esp_bt_uuid_t uuid_source) {
   esp_bt_uuid_t uuid = espbt::ESPBTUUID::from_uuid(uuid_source).as_128bit().get_uuid();
@@ -39,29 +41,57 @@ bool BluetoothProxy::parse_devices(esp_ble_gap_cb_param_t::ble_scan_result_evt_p
   if (!api::global_api_server->is_connected() || this->api_connection_ == nullptr || !this->raw_advertisements_)
     return false;
 
-  api::BluetoothLERawAdvertisementsResponse resp;
+  auto &pending = this->raw_advertisements_response_.advertisements;
   for (size_t i = 0; i < count; i++) {
     auto &result = advertisements[i];
-    api::BluetoothLERawAdvertisement adv;
-    adv.address = esp32_ble::ble_addr_to_uint64(result.bda);
-    adv.rssi = result.rssi;
-    adv.address_type = result.ble_addr_type;
-
+    uint64_t address = esp32_ble::ble_addr_to_uint64(result.bda);
     uint8_t length = result.adv_data_len + result.scan_rsp_len;
-    adv.data.reserve(length);
-    for (uint16_t i = 0; i < length; i++) {
-      adv.data.push_back(result.ble_adv[i]);
+
+    // Keep only the latest advertisement of each device within a batch
+    size_t index = 0;
+    while (index < this->raw_advertisements_count_ &&
+           (pending[index].address != address || this->raw_advertisements_types_[index] != result.ble_evt_type))
+      index++;
+    if (index == this->raw_advertisements_count_) {
+      if (index == 0)
+        this->raw_advertisements_start_ = millis();
+      if (index == pending.size()) {
+        pending.emplace_back();
+        this->raw_advertisements_types_.push_back(0);
+      }
+      this->raw_advertisements_count_++;
     }
 
-    resp.advertisements.push_back(std::move(adv));
+    auto &adv = pending[index];
+    adv.address = address;
+    adv.rssi = result.rssi;
+    adv.address_type = result.ble_addr_type;
+    adv.data.assign(reinterpret_cast<const char *>(result.ble_adv), length);
+    this->raw_advertisements_types_[index] = result.ble_evt_type;
 
     ESP_LOGV(TAG, "Proxying raw packet from %02X:%02X:%02X:%02X:%02X:%02X, length %d. RSSI: %d dB", result.bda[0],
              result.bda[1], result.bda[2], result.bda[3], result.bda[4], result.bda[5], length, result.rssi);
+
+    if (this->raw_advertisements_count_ >= this->raw_advertisements_batch_size_)
+      this->flush_raw_advertisements_();
   }
-  ESP_LOGV(TAG, "Proxying %d packets", count);
-  this->api_connection_->send_bluetooth_le_raw_advertisements_response(resp);
+  if (this->raw_advertisements_batch_interval_ == 0)
+    this->flush_raw_advertisements_();
   return true;
 }
+
+void BluetoothProxy::flush_raw_advertisements_() {
+  if (this->raw_advertisements_count_ == 0)
+    return;
+  auto &pending = this->raw_advertisements_response_.advertisements;
+  // the encoder sends the whole vector, drop stale entries left over from a bigger batch
+  pending.resize(this->raw_advertisements_count_);
+  this->raw_advertisements_types_.resize(this->raw_advertisements_count_);
+  ESP_LOGV(TAG, "Proxying %d packets", this->raw_advertisements_count_);
+  this->api_connection_->send_bluetooth_le_raw_advertisements_response(this->raw_advertisements_response_);
+  this->raw_advertisements_count_ = 0;
+}
+
 void BluetoothProxy::send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device) {
   api::BluetoothLEAdvertisementResponse resp;
   resp.address = device.address_uint64();
@@ -92,6 +122,8 @@ void BluetoothProxy::dump_config() {
   ESP_LOGCONFIG(TAG, "  Active: %s", YESNO(this->active_));
   ESP_LOGCONFIG(TAG, "  Connections: %d", this->connections_.size());
   ESP_LOGCONFIG(TAG, "  Raw advertisements: %s", YESNO(this->raw_advertisements_));
+  ESP_LOGCONFIG(TAG, "  Raw advertisements batch: %u devices / %" PRIu32 " ms", this->raw_advertisements_batch_size_,
+                this->raw_advertisements_batch_interval_);
 }
 
 int BluetoothProxy::get_bluetooth_connections_free() {
@@ -115,8 +147,12 @@ void BluetoothProxy::loop() {
         connection->disconnect();
       }
     }
+    this->raw_advertisements_count_ = 0;
     return;
   }
+  if (this->raw_advertisements_count_ != 0 &&
+      millis() - this->raw_advertisements_start_ >= this->raw_advertisements_batch_interval_)
+    this->flush_raw_advertisements_();
   for (auto *connection : this->connections_) {
     if (connection->send_service_ == connection->service_count_) {
       connection->send_service_ = DONE_SENDING_SERVICES;
@@ -126,81 +162,92 @@ void BluetoothProxy::loop() {
         connection->release_services();
       }
     } else if (connection->send_service_ >= 0) {
-      esp_gattc_service_elem_t service_result;
-      uint16_t service_count = 1;
-      esp_gatt_status_t service_status =
-          esp_ble_gattc_get_service(connection->get_gattc_if(), connection->get_conn_id(), nullptr, &service_result,
-                                    &service_count, connection->send_service_);
-      connection->send_service_++;
-      if (service_status != ESP_GATT_OK) {
-        ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_service error at offset=%d, status=%d",
-                 connection->get_connection_index(), connection->address_str().c_str(), connection->send_service_ - 1,
-                 service_status);
-        continue;
-      }
-      if (service_count == 0) {
-        ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_service missing, service_count=%d",
-                 connection->get_connection_index(), connection->address_str().c_str(), service_count);
-        continue;
-      }
+      // Pack as many services into one message as fit the budget, instead of sending a message per service
       api::BluetoothGATTGetServicesResponse resp;
       resp.address = connection->get_address();
-      api::BluetoothGATTService service_resp;
-      service_resp.uuid = get_128bit_uuid_vec(service_result.uuid);
-      service_resp.handle = service_result.start_handle;
-      uint16_t char_offset = 0;
-      esp_gattc_char_elem_t char_result;
-      while (true) {  // characteristics
-        uint16_t char_count = 1;
-        esp_gatt_status_t char_status = esp_ble_gattc_get_all_char(
-            connection->get_gattc_if(), connection->get_conn_id(), service_result.start_handle,
-            service_result.end_handle, &char_result, &char_count, char_offset);
-        if (char_status == ESP_GATT_INVALID_OFFSET || char_status == ESP_GATT_NOT_FOUND) {
-          break;
-        }
-        if (char_status != ESP_GATT_OK) {
-          ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_all_char error, status=%d", connection->get_connection_index(),
-                   connection->address_str().c_str(), char_status);
-          break;
-        }
-        if (char_count == 0) {
-          break;
-        }
-        api::BluetoothGATTCharacteristic characteristic_resp;
-        characteristic_resp.uuid = get_128bit_uuid_vec(char_result.uuid);
-        characteristic_resp.handle = char_result.char_handle;
-        characteristic_resp.properties = char_result.properties;
-        char_offset++;
-        uint16_t desc_offset = 0;
-        esp_gattc_descr_elem_t desc_result;
-        while (true) {  // descriptors
-          uint16_t desc_count = 1;
-          esp_gatt_status_t desc_status =
-              esp_ble_gattc_get_all_descr(connection->get_gattc_if(), connection->get_conn_id(),
-                                          char_result.char_handle, &desc_result, &desc_count, desc_offset);
-          if (desc_status == ESP_GATT_INVALID_OFFSET || desc_status == ESP_GATT_NOT_FOUND) {
-            break;
-          }
-          if (desc_status != ESP_GATT_OK) {
-            ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_all_descr error, status=%d", connection->get_connection_index(),
-                     connection->address_str().c_str(), desc_status);
-            break;
-          }
-          if (desc_count == 0) {
-            break;
-          }
-          api::BluetoothGATTDescriptor descriptor_resp;
-          descriptor_resp.uuid = get_128bit_uuid_vec(desc_result.uuid);
-          descriptor_resp.handle = desc_result.handle;
-          characteristic_resp.descriptors.push_back(std::move(descriptor_resp));
-          desc_offset++;
-        }
-        service_resp.characteristics.push_back(std::move(characteristic_resp));
+      uint32_t size = 0;
+      while (connection->send_service_ < connection->service_count_ && size < MAX_SERVICES_RESPONSE_SIZE) {
+        this->add_gatt_service_(connection, resp);
+        size = 0;
+        resp.calculate_size(size);
+      }
+      if (!resp.services.empty())
+        this->api_connection_->send_bluetooth_gatt_get_services_response(resp);
+    }
+  }
+}
+
+void BluetoothProxy::add_gatt_service_(BluetoothConnection *connection, api::BluetoothGATTGetServicesResponse &resp) {
+  esp_gattc_service_elem_t service_result;
+  uint16_t service_count = 1;
+  esp_gatt_status_t service_status =
+      esp_ble_gattc_get_service(connection->get_gattc_if(), connection->get_conn_id(), nullptr, &service_result,
+                                &service_count, connection->send_service_);
+  connection->send_service_++;
+  if (service_status != ESP_GATT_OK) {
+    ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_service error at offset=%d, status=%d",
+             connection->get_connection_index(), connection->address_str().c_str(), connection->send_service_ - 1,
+             service_status);
+    return;
+  }
+  if (service_count == 0) {
+    ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_service missing, service_count=%d", connection->get_connection_index(),
+             connection->address_str().c_str(), service_count);
+    return;
+  }
+  api::BluetoothGATTService service_resp;
+  service_resp.uuid = get_128bit_uuid_vec(service_result.uuid);
+  service_resp.handle = service_result.start_handle;
+  uint16_t char_offset = 0;
+  esp_gattc_char_elem_t char_result;
+  while (true) {  // characteristics
+    uint16_t char_count = 1;
+    esp_gatt_status_t char_status =
+        esp_ble_gattc_get_all_char(connection->get_gattc_if(), connection->get_conn_id(), service_result.start_handle,
+                                   service_result.end_handle, &char_result, &char_count, char_offset);
+    if (char_status == ESP_GATT_INVALID_OFFSET || char_status == ESP_GATT_NOT_FOUND) {
+      break;
+    }
+    if (char_status != ESP_GATT_OK) {
+      ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_all_char error, status=%d", connection->get_connection_index(),
+               connection->address_str().c_str(), char_status);
+      break;
+    }
+    if (char_count == 0) {
+      break;
+    }
+    api::BluetoothGATTCharacteristic characteristic_resp;
+    characteristic_resp.uuid = get_128bit_uuid_vec(char_result.uuid);
+    characteristic_resp.handle = char_result.char_handle;
+    characteristic_resp.properties = char_result.properties;
+    char_offset++;
+    uint16_t desc_offset = 0;
+    esp_gattc_descr_elem_t desc_result;
+    while (true) {  // descriptors
+      uint16_t desc_count = 1;
+      esp_gatt_status_t desc_status = esp_ble_gattc_get_all_descr(connection->get_gattc_if(), connection->get_conn_id(),
+                                                                  char_result.char_handle, &desc_result, &desc_count,
+                                                                  desc_offset);
+      if (desc_status == ESP_GATT_INVALID_OFFSET || desc_status == ESP_GATT_NOT_FOUND) {
+        break;
+      }
+      if (desc_status != ESP_GATT_OK) {
+        ESP_LOGE(TAG, "[%d] [%s] esp_ble_gattc_get_all_descr error, status=%d", connection->get_connection_index(),
+                 connection->address_str().c_str(), desc_status);
+        break;
+      }
+      if (desc_count == 0) {
+        break;
       }
-      resp.services.push_back(std::move(service_resp));
-      this->api_connection_->send_bluetooth_gatt_get_services_response(resp);
+      api::BluetoothGATTDescriptor descriptor_resp;
+      descriptor_resp.uuid = get_128bit_uuid_vec(desc_result.uuid);
+      descriptor_resp.handle = desc_result.handle;
+      characteristic_resp.descriptors.push_back(std::move(descriptor_resp));
+      desc_offset++;
     }
+    service_resp.characteristics.push_back(std::move(characteristic_resp));
   }
+  resp.services.push_back(std::move(service_resp));
 }
 
 esp32_ble_tracker::AdvertisementParserType BluetoothProxy::get_advertisement_parser_type() {
@@ -456,6 +503,7 @@ void BluetoothProxy::unsubscribe_api_connection(api::APIConnection *api_connecti
   }
   this->api_connection_ = nullptr;
   this->raw_advertisements_ = false;
+  this->raw_advertisements_count_ = 0;
   this->parent_->recalculate_advertisement_parser_types();
 }
 
@@ -91,6 +91,10 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   }
 
   void set_active(bool active) { this->active_ = active; }
+  void set_raw_advertisements_batch_size(uint8_t size) { this->raw_advertisements_batch_size_ = size; }
+  void set_raw_advertisements_batch_interval(uint32_t interval) {
+    this->raw_advertisements_batch_interval_ = interval;
+  }
   bool has_active() { return this->active_; }
 
   uint32_t get_legacy_version() const {
@@ -116,6 +120,9 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
 
  protected:
   void send_api_packet_(const esp32_ble_tracker::ESPBTDevice &device);
+  void flush_raw_advertisements_();
+  /// Adds the next service of the connection, with its characteristics and descriptors, to the response.
+  void add_gatt_service_(BluetoothConnection *connection, api::BluetoothGATTGetServicesResponse &resp);
 
   BluetoothConnection *get_connection_(uint64_t address, bool reserve);
 
@@ -124,6 +131,17 @@ class BluetoothProxy : public esp32_ble_tracker::ESPBTDeviceListener, public Com
   std::vector<BluetoothConnection *> connections_{};
   api::APIConnection *api_connection_{nullptr};
   bool raw_advertisements_{false};
+
+  /// Flush the pending raw advertisements once this many distinct devices were seen...
+  uint8_t raw_advertisements_batch_size_{16};
+  /// ...or this many milliseconds after the first one was queued, whichever comes first.
+  uint32_t raw_advertisements_batch_interval_{100};
+  /// Pending batch. Entries past raw_advertisements_count_ are stale, they are kept so their buffers are reused.
+  api::BluetoothLERawAdvertisementsResponse raw_advertisements_response_{};
+  /// Event type of each pending entry, an advertisement and its scan response are not coalesced.
+  std::vector<uint8_t> raw_advertisements_types_{};
+  size_t raw_advertisements_count_{0};
+  uint32_t raw_advertisements_start_{0};
 };
 
 extern BluetoothProxy *global_bluetooth_proxy;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -1,6 +1,8 @@
 #include "canbus.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace canbus {
 
@@ -55,38 +57,89 @@ void Canbus::add_trigger(CanbusTrigger *trigger) {
   } else {
     ESP_LOGVV(TAG, "add trigger for std canid=0x%03" PRIx32, trigger->can_id_);
   }
-  this->triggers_.push_back(trigger);
+  this->has_triggers_ = true;
+  if (trigger->use_extended_id_) {
+    this->has_extended_triggers_ = true;
+  } else {
+    this->has_standard_triggers_ = true;
+  }
+  uint32_t id_mask = trigger->use_extended_id_ ? CAN_EXTENDED_ID_MASK : CAN_STANDARD_ID_MASK;
+  if ((trigger->can_id_mask_ & id_mask) == id_mask) {
+    this->exact_triggers_[dispatch_key_(trigger->can_id_, trigger->use_extended_id_)].push_back(trigger);
+  } else {
+    this->triggers_.push_back(trigger);
+  }
 };
 
+bool Canbus::get_acceptance_filter(CanAcceptanceFilter &filter) const {
+  if (!this->has_triggers_ || (this->has_standard_triggers_ && this->has_extended_triggers_))
+    return false;
+  filter.use_extended_id = this->has_extended_triggers_;
+  filter.mask = filter.use_extended_id ? CAN_EXTENDED_ID_MASK : CAN_STANDARD_ID_MASK;
+  bool first = true;
+  auto add = [&filter, &first](const CanbusTrigger *trigger) {
+    uint32_t code = trigger->can_id_ & trigger->can_id_mask_;
+    filter.mask &= trigger->can_id_mask_;
+    if (first) {
+      filter.code = code;
+      first = false;
+    } else {
+      // bits on which the triggers disagree can't be filtered
+      filter.mask &= ~(filter.code ^ code);
+    }
+  };
+  for (const auto &it : this->exact_triggers_) {
+    for (const auto *trigger : it.second)
+      add(trigger);
+  }
+  for (const auto *trigger : this->triggers_)
+    add(trigger);
+  filter.code &= filter.mask;
+  return true;
+}
+
+void Canbus::fire_trigger_(CanbusTrigger *trigger, const struct CanFrame &frame, std::vector<uint8_t> &data) {
+  if (trigger->remote_transmission_request_.has_value() &&
+      trigger->remote_transmission_request_.value() != frame.remote_transmission_request)
+    return;
+  // the payload is only built once a trigger matches
+  if (data.empty() && frame.can_data_length_code != 0)
+    data.assign(frame.data, frame.data + std::min(frame.can_data_length_code, CAN_MAX_DATA_LENGTH));
+  trigger->trigger(data, frame.can_id, frame.remote_transmission_request);
+}
+
 void Canbus::loop() {
   struct CanFrame can_message;
+  std::vector<uint8_t> data;
   // read all messages until queue is empty
   int message_counter = 0;
   while (this->read_message(&can_message) == canbus::ERROR_OK) {
     message_counter++;
+    // busy buses carry thousands of frames per second, too many to log at debug level
     if (can_message.use_extended_id) {
-      ESP_LOGD(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
+      ESP_LOGV(TAG, "received can message (#%d) extended can_id=0x%" PRIx32 " size=%d", message_counter,
                can_message.can_id, can_message.can_data_length_code);
     } else {
-      ESP_LOGD(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
+      ESP_LOGV(TAG, "received can message (#%d) std can_id=0x%" PRIx32 " size=%d", message_counter, can_message.can_id,
                can_message.can_data_length_code);
     }
 
-    std::vector<uint8_t> data;
-
     // show data received
     for (int i = 0; i < can_message.can_data_length_code; i++) {
-      ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
+      ESP_LOGVV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
     }
 
+    data.clear();
     // fire all triggers
+    auto exact = this->exact_triggers_.find(dispatch_key_(can_message.can_id, can_message.use_extended_id));
+    if (exact != this->exact_triggers_.end()) {
+      for (auto *trigger : exact->second)
+        this->fire_trigger_(trigger, can_message, data);
+    }
     for (auto *trigger : this->triggers_) {
       if ((trigger->can_id_ == (can_message.can_id & trigger->can_id_mask_)) &&
-          (trigger->use_extended_id_ == can_message.use_extended_id) &&
-          (!trigger->remote_transmission_request_.has_value() ||
-           trigger->remote_transmission_request_.value() == can_message.remote_transmission_request)) {
-        trigger->trigger(data, can_message.can_id, can_message.remote_transmission_request);
+          (trigger->use_extended_id_ == can_message.use_extended_id)) {
+        this->fire_trigger_(trigger, can_message, data);
       }
     }
   }
@@ -5,6 +5,7 @@
 #include "esphome/core/optional.h"
 
 #include <cinttypes>
+#include <unordered_map>
 #include <vector>
 
 namespace esphome {
@@ -49,6 +50,16 @@ template<typename... Ts> class CanbusSendAction;
 /* CAN payload length definitions according to ISO 11898-1 */
 static const uint8_t CAN_MAX_DATA_LENGTH = 8;
 
+static const uint32_t CAN_STANDARD_ID_MASK = 0x7FF;
+static const uint32_t CAN_EXTENDED_ID_MASK = 0x1FFFFFFF;
+
+/// A hardware acceptance filter: a frame passes if (can_id & mask) == code
+struct CanAcceptanceFilter {
+  uint32_t code;
+  uint32_t mask;
+  bool use_extended_id;
+};
+
 /*
 Can Frame describes a normative CAN Frame
 The RTR = Remote Transmission Request is implemented in every CAN controller but rarely used
@@ -82,9 +93,29 @@ class Canbus : public Component {
 
   void add_trigger(CanbusTrigger *trigger);
 
+  /** The narrowest acceptance filter that passes the frames of all triggers.
+   *
+   * Only the id bits all triggers care about and agree on are filtered. Without triggers, or with triggers for both
+   * standard and extended ids, nothing can be filtered.
+   * @return false if all frames have to be accepted
+   */
+  bool get_acceptance_filter(CanAcceptanceFilter &filter) const;
+
  protected:
   template<typename... Ts> friend class CanbusSendAction;
+  /// Triggers matching other ids through their mask, checked one by one
   std::vector<CanbusTrigger *> triggers_{};
+  /// Triggers for exactly one id, by dispatch_key_()
+  std::unordered_map<uint32_t, std::vector<CanbusTrigger *>> exact_triggers_{};
+  bool has_triggers_{false};
+  bool has_standard_triggers_{false};
+  bool has_extended_triggers_{false};
+
+  static uint32_t dispatch_key_(uint32_t can_id, bool use_extended_id) {
+    return use_extended_id ? (can_id | 0x80000000UL) : can_id;
+  }
+  void fire_trigger_(CanbusTrigger *trigger, const struct CanFrame &frame, std::vector<uint8_t> &data);
+
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
@@ -140,14 +171,15 @@ class CanbusTrigger : public Trigger<std::vector<uint8_t>, uint32_t, bool>, publ
  public:
   explicit CanbusTrigger(Canbus *parent, const std::uint32_t can_id, const std::uint32_t can_id_mask,
                          const bool use_extended_id)
-      : parent_(parent), can_id_(can_id), can_id_mask_(can_id_mask), use_extended_id_(use_extended_id){};
+      : parent_(parent), can_id_(can_id), can_id_mask_(can_id_mask), use_extended_id_(use_extended_id) {
+    // registered before the bus is set up, so its acceptance filter can include this trigger
+    parent->add_trigger(this);
+  };
 
   void set_remote_transmission_request(bool remote_transmission_request) {
     this->remote_transmission_request_ = remote_transmission_request;
   }
 
-  void setup() override { this->parent_->add_trigger(this); }
-
  protected:
   Canbus *parent_;
   uint32_t can_id_;
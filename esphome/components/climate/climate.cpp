@@ -392,7 +392,42 @@ void Climate::save_state_() {
 
   this->rtc_.save(&state);
 }
+static bool same_float(float a, float b) { return a == b || (std::isnan(a) && std::isnan(b)); }
+
+bool Climate::update_published_state_() {
+  // target_temperature shares its storage with target_temperature_low, comparing the two point fields covers both
+  if (this->published_state_.has_value()) {
+    const auto &last = *this->published_state_;
+    if (last.mode == this->mode && last.action == this->action && last.fan_mode == this->fan_mode &&
+        last.custom_fan_mode == this->custom_fan_mode && last.preset == this->preset &&
+        last.custom_preset == this->custom_preset && last.swing_mode == this->swing_mode &&
+        same_float(last.current_temperature, this->current_temperature) &&
+        same_float(last.target_temperature_low, this->target_temperature_low) &&
+        same_float(last.target_temperature_high, this->target_temperature_high) &&
+        same_float(last.current_humidity, this->current_humidity) &&
+        same_float(last.target_humidity, this->target_humidity))
+      return false;
+  }
+  this->published_state_ = PublishedState{this->mode,
+                                          this->action,
+                                          this->fan_mode,
+                                          this->custom_fan_mode,
+                                          this->preset,
+                                          this->custom_preset,
+                                          this->swing_mode,
+                                          this->current_temperature,
+                                          this->target_temperature_low,
+                                          this->target_temperature_high,
+                                          this->current_humidity,
+                                          this->target_humidity};
+  return true;
+}
+
 void Climate::publish_state() {
+  if (!this->update_published_state_()) {
+    ESP_LOGV(TAG, "'%s' - State unchanged, not sending", this->name_.c_str());
+    return;
+  }
   ESP_LOGD(TAG, "'%s' - Sending state:", this->name_.c_str());
   auto traits = this->get_traits();
 
@@ -234,7 +234,8 @@ class Climate : public EntityBase {
   /** Publish the state of the climate device, to be called from integrations.
    *
    * This will schedule the climate device to publish its state to all listeners and save the current state
-   * to recover memory.
+   * to recover memory. A state identical to the last published one is skipped, so integrations may call this
+   * whenever one of their inputs updates.
    */
   void publish_state();
 
@@ -292,9 +293,28 @@ class Climate : public EntityBase {
 
   void dump_traits_(const char *tag);
 
+  /// The parts of the state sent to the listeners, to detect publishes that wouldn't change anything.
+  struct PublishedState {
+    ClimateMode mode;
+    ClimateAction action;
+    optional<ClimateFanMode> fan_mode;
+    optional<std::string> custom_fan_mode;
+    optional<ClimatePreset> preset;
+    optional<std::string> custom_preset;
+    ClimateSwingMode swing_mode;
+    float current_temperature;
+    float target_temperature_low;
+    float target_temperature_high;
+    float current_humidity;
+    float target_humidity;
+  };
+  /// Check whether the state differs from the last published one, and remember it if it does.
+  bool update_published_state_();
+
   CallbackManager<void(Climate &)> state_callback_{};
   CallbackManager<void(ClimateCall &)> control_callback_{};
   ESPPreferenceObject rtc_;
+  optional<PublishedState> published_state_{};
   optional<float> visual_min_temperature_override_{};
   optional<float> visual_max_temperature_override_{};
   optional<float> visual_target_temperature_step_override_{};
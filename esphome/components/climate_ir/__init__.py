@@ -16,12 +16,17 @@ ClimateIR = climate_ir_ns.class_(
     remote_base.RemoteTransmittable,
 )
 
+CONF_MIN_RETRANSMIT_INTERVAL = "min_retransmit_interval"
+
 CLIMATE_IR_SCHEMA = (
     climate.CLIMATE_SCHEMA.extend(
         {
             cv.Optional(CONF_SUPPORTS_COOL, default=True): cv.boolean,
             cv.Optional(CONF_SUPPORTS_HEAT, default=True): cv.boolean,
             cv.Optional(CONF_SENSOR): cv.use_id(sensor.Sensor),
+            cv.Optional(
+                CONF_MIN_RETRANSMIT_INTERVAL
+            ): cv.positive_time_period_milliseconds,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -48,3 +53,5 @@ async def register_climate_ir(var, config):
     if sensor_id := config.get(CONF_SENSOR):
         sens = await cg.get_variable(sensor_id)
         cg.add(var.set_sensor(sens))
+    if min_retransmit_interval := config.get(CONF_MIN_RETRANSMIT_INTERVAL):
+        cg.add(var.set_min_retransmit_interval(min_retransmit_interval))
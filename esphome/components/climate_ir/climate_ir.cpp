@@ -1,6 +1,10 @@
 #include "climate_ir.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace climate_ir {
 
@@ -56,6 +60,13 @@ void ClimateIR::setup() {
   // Never send nan to HA
   if (std::isnan(this->target_temperature))
     this->target_temperature = 24;
+
+  if (this->min_retransmit_interval_ != 0) {
+    this->add_on_state_callback([this](climate::Climate & /*unused*/) {
+      if (this->state_hash_() != this->transmitted_state_)
+        this->frame_hashes_.clear();
+    });
+  }
 }
 
 void ClimateIR::control(const climate::ClimateCall &call) {
@@ -69,15 +80,74 @@ void ClimateIR::control(const climate::ClimateCall &call) {
     this->swing_mode = *call.get_swing_mode();
   if (call.get_preset().has_value())
     this->preset = *call.get_preset();
-  this->transmit_state();
+  if (this->min_retransmit_interval_ == 0) {
+    this->transmit_state();
+  } else {
+    this->transmit_state_filtered_();
+  }
   this->publish_state();
 }
+
+void ClimateIR::transmit_state_filtered_() {
+  this->frame_index_ = 0;
+  this->frame_sent_ = false;
+  this->transmitter_->set_send_filter(this);
+  this->transmit_state();
+  this->transmitter_->set_send_filter(nullptr);
+  this->frame_hashes_.resize(this->frame_index_);
+  if (this->frame_sent_)
+    this->last_transmit_ = millis();
+  this->transmitted_state_ = this->state_hash_();
+}
+
+bool ClimateIR::should_send(const remote_base::RemoteTransmitData &data) {
+  const auto &timings = data.get_data();
+  uint32_t hash = data.get_carrier_frequency();
+  for (int32_t timing : timings)
+    hash = (hash * 16777619UL) ^ static_cast<uint32_t>(timing);
+
+  const size_t index = this->frame_index_++;
+  const bool repeated = index < this->frame_hashes_.size() && this->frame_hashes_[index] == hash &&
+                        millis() - this->last_transmit_ < this->min_retransmit_interval_;
+  if (index < this->frame_hashes_.size()) {
+    this->frame_hashes_[index] = hash;
+  } else {
+    this->frame_hashes_.push_back(hash);
+  }
+  if (repeated) {
+    ESP_LOGD(TAG, "'%s' - Not sending unchanged frame %u", this->get_name().c_str(), (unsigned) index);
+    return false;
+  }
+  this->frame_sent_ = true;
+  return true;
+}
+
+uint32_t ClimateIR::state_hash_() const {
+  uint32_t hash = 2166136261UL;
+  auto add = [&hash](uint32_t value) { hash = (hash * 16777619UL) ^ value; };
+  auto add_float = [&add](float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    add(bits);
+  };
+  add(this->mode);
+  add_float(this->target_temperature);
+  add_float(this->target_humidity);
+  add(this->fan_mode.has_value() ? *this->fan_mode + 1 : 0);
+  add(this->custom_fan_mode.has_value() ? fnv1_hash(*this->custom_fan_mode) : 0);
+  add(this->swing_mode);
+  add(this->preset.has_value() ? *this->preset + 1 : 0);
+  add(this->custom_preset.has_value() ? fnv1_hash(*this->custom_preset) : 0);
+  return hash;
+}
 void ClimateIR::dump_config() {
   LOG_CLIMATE("", "IR Climate", this);
   ESP_LOGCONFIG(TAG, "  Min. Temperature: %.1f°C", this->minimum_temperature_);
   ESP_LOGCONFIG(TAG, "  Max. Temperature: %.1f°C", this->maximum_temperature_);
   ESP_LOGCONFIG(TAG, "  Supports HEAT: %s", YESNO(this->supports_heat_));
   ESP_LOGCONFIG(TAG, "  Supports COOL: %s", YESNO(this->supports_cool_));
+  if (this->min_retransmit_interval_ != 0)
+    ESP_LOGCONFIG(TAG, "  Min. Retransmit Interval: %.1fs", this->min_retransmit_interval_ / 1e3f);
 }
 
 }  // namespace climate_ir
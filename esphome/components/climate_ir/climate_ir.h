@@ -1,6 +1,7 @@
 #pragma once
 
 #include <utility>
+#include <vector>
 
 #include "esphome/components/climate/climate.h"
 #include "esphome/components/remote_base/remote_base.h"
@@ -21,7 +22,8 @@ namespace climate_ir {
 class ClimateIR : public Component,
                   public climate::Climate,
                   public remote_base::RemoteReceiverListener,
-                  public remote_base::RemoteTransmittable {
+                  public remote_base::RemoteTransmittable,
+                  public remote_base::RemoteTransmitFilter {
  public:
   ClimateIR(float minimum_temperature, float maximum_temperature, float temperature_step = 1.0f,
             bool supports_dry = false, bool supports_fan_only = false, std::set<climate::ClimateFanMode> fan_modes = {},
@@ -41,6 +43,8 @@ class ClimateIR : public Component,
   void set_supports_cool(bool supports_cool) { this->supports_cool_ = supports_cool; }
   void set_supports_heat(bool supports_heat) { this->supports_heat_ = supports_heat; }
   void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+  /// Don't send the same frames again within this many milliseconds, when a call doesn't change the state.
+  void set_min_retransmit_interval(uint32_t interval) { this->min_retransmit_interval_ = interval; }
 
  protected:
   float minimum_temperature_, maximum_temperature_, temperature_step_;
@@ -53,6 +57,12 @@ class ClimateIR : public Component,
   /// Transmit via IR the state of this climate controller.
   virtual void transmit_state() = 0;
 
+  /// transmit_state(), skipping the frames that are the same as the ones of the previous call.
+  void transmit_state_filtered_();
+  bool should_send(const remote_base::RemoteTransmitData &data) override;
+  /// Hash of the settings the frames are encoded from.
+  uint32_t state_hash_() const;
+
   // Dummy implement on_receive so implementation is optional for inheritors
   bool on_receive(remote_base::RemoteReceiveData data) override { return false; };
 
@@ -65,6 +75,15 @@ class ClimateIR : public Component,
   std::set<climate::ClimatePreset> presets_ = {};
 
   sensor::Sensor *sensor_{nullptr};
+
+  uint32_t min_retransmit_interval_{0};
+  /// Hashes of the frames sent by the previous transmit_state_filtered_(), by their position
+  std::vector<uint32_t> frame_hashes_;
+  size_t frame_index_{0};
+  bool frame_sent_{false};
+  uint32_t last_transmit_{0};
+  /// state_hash_() when the frames were sent, state received from a remote invalidates them
+  uint32_t transmitted_state_{0};
 };
 
 }  // namespace climate_ir
@@ -54,11 +54,15 @@ void CurrentBasedCover::setup() {
   } else {
     this->position = 0.5f;
   }
+  // The currents are only watched while moving
+  this->disable_loop();
 }
 
 void CurrentBasedCover::loop() {
-  if (this->current_operation == COVER_OPERATION_IDLE)
+  if (this->current_operation == COVER_OPERATION_IDLE) {
+    this->disable_loop();
     return;
+  }
 
   const uint32_t now = millis();
 
@@ -239,6 +243,12 @@ void CurrentBasedCover::start_direction_(CoverOperation dir) {
   const auto now = millis();
   this->start_dir_time_ = now;
   this->last_recompute_time_ = now;
+
+  if (dir == COVER_OPERATION_IDLE) {
+    this->disable_loop();
+  } else {
+    this->enable_loop();
+  }
 }
 void CurrentBasedCover::recompute_position_() {
   if (this->current_operation == COVER_OPERATION_IDLE)
@@ -1,17 +1,36 @@
 #include "dallas_temp.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace dallas_temp {
 
 static const char *const TAG = "dallas.temp.sensor";
 
 static const uint8_t DALLAS_MODEL_DS18S20 = 0x10;
+static const uint8_t DALLAS_MODEL_DS1822 = 0x22;
+static const uint8_t DALLAS_MODEL_DS18B20 = 0x28;
+static const uint8_t DALLAS_MODEL_DS1825 = 0x3B;
+static const uint8_t DALLAS_MODEL_DS28EA00 = 0x42;
 static const uint8_t DALLAS_COMMAND_START_CONVERSION = 0x44;
 static const uint8_t DALLAS_COMMAND_READ_SCRATCH_PAD = 0xBE;
 static const uint8_t DALLAS_COMMAND_WRITE_SCRATCH_PAD = 0x4E;
 static const uint8_t DALLAS_COMMAND_COPY_SCRATCH_PAD = 0x48;
 
+static bool is_temperature_model(uint8_t model) {
+  switch (model) {
+    case DALLAS_MODEL_DS18S20:
+    case DALLAS_MODEL_DS1822:
+    case DALLAS_MODEL_DS18B20:
+    case DALLAS_MODEL_DS1825:
+    case DALLAS_MODEL_DS28EA00:
+      return true;
+    default:
+      return false;
+  }
+}
+
 uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion_() const {
   switch (this->resolution_) {
     case 9:
@@ -33,6 +52,7 @@ void DallasTemperatureSensor::dump_config() {
   }
   LOG_ONE_WIRE_DEVICE(this);
   ESP_LOGCONFIG(TAG, "  Resolution: %u bits", this->resolution_);
+  ESP_LOGCONFIG(TAG, "  Bus-wide conversion: %s", YESNO(this->bus_wide_conversion_));
   LOG_UPDATE_INTERVAL(this);
 }
 
@@ -42,7 +62,12 @@ void DallasTemperatureSensor::update() {
 
   this->status_clear_warning();
 
-  this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  if (this->bus_wide_conversion_) {
+    // The sensors polled in the same cycle share one conversion, they all finish within their own conversion time
+    this->bus_->broadcast(DALLAS_COMMAND_START_CONVERSION, this->millis_to_wait_for_conversion_());
+  } else {
+    this->send_command_(DALLAS_COMMAND_START_CONVERSION);
+  }
 
   this->set_timeout(this->get_address_name(), this->millis_to_wait_for_conversion_(), [this] {
     if (!this->read_scratch_pad_() || !this->check_scratch_pad_()) {
@@ -63,13 +88,9 @@ void IRAM_ATTR DallasTemperatureSensor::read_scratch_pad_int_() {
 }
 
 bool DallasTemperatureSensor::read_scratch_pad_() {
-  bool success;
-  {
-    InterruptLock lock;
-    success = this->send_command_(DALLAS_COMMAND_READ_SCRATCH_PAD);
-    if (success)
-      this->read_scratch_pad_int_();
-  }
+  bool success = this->send_command_(DALLAS_COMMAND_READ_SCRATCH_PAD);
+  if (success)
+    this->read_scratch_pad_int_();
   if (!success) {
     ESP_LOGW(TAG, "'%s' - reading scratch pad failed bus reset", this->get_name().c_str());
     this->status_set_warning("bus reset failed");
@@ -81,6 +102,12 @@ void DallasTemperatureSensor::setup() {
   ESP_LOGCONFIG(TAG, "setting up Dallas temperature sensor...");
   if (!this->check_address_())
     return;
+
+  const auto &devices = this->bus_->get_devices();
+  this->bus_wide_conversion_ = !devices.empty() && std::all_of(devices.begin(), devices.end(), [](uint64_t address) {
+    return is_temperature_model(address & 0xff);
+  });
+
   if (!this->read_scratch_pad_())
     return;
   if (!this->check_scratch_pad_())
@@ -113,17 +140,14 @@ void DallasTemperatureSensor::setup() {
     return;
   this->scratch_pad_[4] = res;
 
-  {
-    InterruptLock lock;
-    if (this->send_command_(DALLAS_COMMAND_WRITE_SCRATCH_PAD)) {
-      this->bus_->write8(this->scratch_pad_[2]);  // high alarm temp
-      this->bus_->write8(this->scratch_pad_[3]);  // low alarm temp
-      this->bus_->write8(this->scratch_pad_[4]);  // resolution
-    }
-
-    // write value to EEPROM
-    this->send_command_(DALLAS_COMMAND_COPY_SCRATCH_PAD);
+  if (this->send_command_(DALLAS_COMMAND_WRITE_SCRATCH_PAD)) {
+    this->bus_->write8(this->scratch_pad_[2]);  // high alarm temp
+    this->bus_->write8(this->scratch_pad_[3]);  // low alarm temp
+    this->bus_->write8(this->scratch_pad_[4]);  // resolution
   }
+
+  // write value to EEPROM
+  this->send_command_(DALLAS_COMMAND_COPY_SCRATCH_PAD);
 }
 
 bool DallasTemperatureSensor::check_scratch_pad_() {
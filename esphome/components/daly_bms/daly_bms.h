@@ -12,6 +12,7 @@
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
 #include "esphome/components/uart/uart.h"
+#include "esphome/components/uart/uart_request_queue.h"
 
 #include <vector>
 
@@ -75,16 +76,13 @@ class DalyBmsComponent : public PollingComponent, public uart::UARTDevice {
 
  protected:
   void request_data_(uint8_t data_id);
-  void decode_data_(std::vector<uint8_t> data);
+  void decode_frame_(const uint8_t *it);
 
   uint8_t addr_;
 
-  std::vector<uint8_t> data_;
-  bool receiving_{false};
-  uint8_t data_count_;
-  uint32_t last_transmission_{0};
-  bool trigger_next_;
-  uint8_t next_request_;
+  uart::UARTRequestQueue requests_{this};
+  /// From the status response, 0 until it was received
+  uint8_t cells_count_{0};
 };
 
 }  // namespace daly_bms
@@ -0,0 +1,27 @@
+import esphome.codegen as cg
+from esphome.components.light.effects import register_addressable_effect
+from esphome.components.light.types import AddressableLightEffect
+import esphome.config_validation as cv
+from esphome.const import CONF_NAME, CONF_PORT
+
+AUTO_LOAD = ["socket"]
+DEPENDENCIES = ["network"]
+
+ddp_ns = cg.esphome_ns.namespace("ddp")
+DDPLightEffect = ddp_ns.class_("DDPLightEffect", AddressableLightEffect)
+
+CONFIG_SCHEMA = cv.Schema({})
+
+
+@register_addressable_effect(
+    "ddp",
+    DDPLightEffect,
+    "DDP",
+    {
+        cv.Optional(CONF_PORT, default=4048): cv.port,
+    },
+)
+async def ddp_light_effect_to_code(config, effect_id):
+    effect = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    cg.add(effect.set_port(config[CONF_PORT]))
+    return effect
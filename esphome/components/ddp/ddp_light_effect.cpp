@@ -0,0 +1,117 @@
+#include "ddp_light_effect.h"
+#ifdef USE_NETWORK
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace ddp {
+
+static const char *const TAG = "ddp_light_effect";
+
+static const uint8_t FLAG_VERSION_MASK = 0xC0;
+static const uint8_t FLAG_VERSION_1 = 0x40;
+static const uint8_t FLAG_TIMECODE = 0x10;
+static const uint8_t FLAG_REPLY = 0x04;
+static const uint8_t FLAG_QUERY = 0x02;
+static const uint8_t FLAG_PUSH = 0x01;
+static const uint8_t TYPE_RGBW = 3;
+static const uint8_t DESTINATION_DISPLAY = 1;
+static const size_t HEADER_SIZE = 10;
+static const size_t TIMECODE_SIZE = 4;
+/// Upper bound of packets read per loop, so a flood can't starve the other components
+static const int MAX_PACKETS_PER_LOOP = 32;
+
+DDPLightEffect::DDPLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+void DDPLightEffect::start() {
+  AddressableLightEffect::start();
+  this->open_socket_();
+}
+
+void DDPLightEffect::stop() {
+  if (this->socket_) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+  AddressableLightEffect::stop();
+}
+
+bool DDPLightEffect::open_socket_() {
+  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return false;
+  }
+  int enable = 1;
+  int err = this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set reuseaddr: errno %d", err);
+    // we can still continue
+  }
+  err = this->socket_->setblocking(false);
+  if (err != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", err);
+    this->socket_.reset();
+    return false;
+  }
+
+  struct sockaddr_storage server;
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), this->port_);
+  if (sl == 0 || this->socket_->bind((struct sockaddr *) &server, sizeof(server)) != 0) {
+    ESP_LOGW(TAG, "Cannot bind DDP effect to port %u: errno %d", this->port_, errno);
+    this->socket_.reset();
+    return false;
+  }
+  return true;
+}
+
+void DDPLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
+  if (this->socket_ == nullptr && !this->open_socket_())
+    return;
+
+  uint8_t buf[1460];
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0)
+      break;
+    if (!this->process_(it, buf, len)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+    }
+  }
+}
+
+bool DDPLightEffect::process_(light::AddressableLight &it, const uint8_t *data, size_t len) {
+  if (len < HEADER_SIZE)
+    return false;
+  uint8_t flags = data[0];
+  if ((flags & FLAG_VERSION_MASK) != FLAG_VERSION_1)
+    return false;
+  // queries, replies and the control/config/status destinations are not supported, only pixel data
+  if ((flags & (FLAG_QUERY | FLAG_REPLY)) != 0 || data[3] != DESTINATION_DISPLAY)
+    return true;
+
+  size_t header = HEADER_SIZE + ((flags & FLAG_TIMECODE) != 0 ? TIMECODE_SIZE : 0);
+  uint32_t offset = encode_uint32(data[4], data[5], data[6], data[7]);
+  uint16_t length = encode_uint16(data[8], data[9]);
+  if (len < header + length)
+    return false;
+
+  const size_t channels = ((data[2] >> 3) & 0x07) == TYPE_RGBW ? 4 : 3;
+  const uint8_t *pixels = data + header;
+  // senders split frames at pixel boundaries, otherwise the partial first pixel is skipped
+  size_t i = (channels - offset % channels) % channels;
+  int32_t led = (offset + i) / channels;
+  for (; i + channels <= length && led < it.size(); i += channels, led++) {
+    const uint8_t *p = pixels + i;
+    it[led] = Color(p[0], p[1], p[2], channels == 4 ? p[3] : 0);
+  }
+
+  if ((flags & FLAG_PUSH) != 0)
+    it.schedule_show();
+  return true;
+}
+
+}  // namespace ddp
+}  // namespace esphome
+
+#endif  // USE_NETWORK
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+#ifdef USE_NETWORK
+#include "esphome/components/light/addressable_light_effect.h"
+#include "esphome/components/socket/socket.h"
+
+#include <memory>
+
+namespace esphome {
+namespace ddp {
+
+/** Shows pixel data received with the Distributed Display Protocol (http://www.3waylabs.com/ddp/).
+ *
+ * A packet carries up to 1440 bytes for any offset of the strip, so a frame needs far fewer packets than E1.31
+ * universes. The data is written to the LEDs straight from the receive buffer, and shown once a packet with the push
+ * flag arrives.
+ */
+class DDPLightEffect : public light::AddressableLightEffect {
+ public:
+  explicit DDPLightEffect(const std::string &name);
+
+  void start() override;
+  void stop() override;
+  void apply(light::AddressableLight &it, const Color &current_color) override;
+
+  void set_port(uint16_t port) { this->port_ = port; }
+
+ protected:
+  bool open_socket_();
+  bool process_(light::AddressableLight &it, const uint8_t *data, size_t len);
+
+  uint16_t port_{4048};
+  std::unique_ptr<socket::Socket> socket_;
+};
+
+}  // namespace ddp
+}  // namespace esphome
+
+#endif  // USE_NETWORK
@@ -13,10 +13,19 @@ CODEOWNERS = ["@OttoWinter"]
 DEPENDENCIES = ["logger"]
 
 CONF_DEBUG_ID = "debug_id"
+CONF_LOOP_PROFILER = "loop_profiler"
+CONF_HEAP_PROFILER = "heap_profiler"
+CONF_STALL_THRESHOLD = "stall_threshold"
 debug_ns = cg.esphome_ns.namespace("debug")
 DebugComponent = debug_ns.class_("DebugComponent", cg.PollingComponent)
 
 
+def _validate_stall_threshold(config):
+    if CONF_STALL_THRESHOLD in config and not config[CONF_LOOP_PROFILER]:
+        raise cv.Invalid(f"'{CONF_STALL_THRESHOLD}' requires '{CONF_LOOP_PROFILER}'")
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -36,11 +45,23 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_LOOP_TIME): cv.invalid(
                 "The 'loop_time' option has been moved to the 'debug' sensor component"
             ),
+            cv.Optional(CONF_LOOP_PROFILER, default=False): cv.boolean,
+            cv.Optional(CONF_HEAP_PROFILER, default=False): cv.boolean,
+            cv.Optional(CONF_STALL_THRESHOLD): cv.positive_time_period_milliseconds,
         }
     ).extend(cv.polling_component_schema("60s")),
+    _validate_stall_threshold,
 )
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
+    if config[CONF_LOOP_PROFILER]:
+        cg.add_define("USE_LOOP_PROFILER")
+        stall_threshold = config.get(
+            CONF_STALL_THRESHOLD, cv.TimePeriod(milliseconds=100)
+        )
+        cg.add(cg.App.set_stall_threshold(stall_threshold.total_milliseconds))
+    if config[CONF_HEAP_PROFILER]:
+        cg.add_define("USE_HEAP_PROFILER")
@@ -1,6 +1,7 @@
 #include "debug_component.h"
 
 #include <algorithm>
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
@@ -83,10 +84,72 @@ void DebugComponent::update() {
     this->max_loop_time_ = 0;
   }
 
+#ifdef USE_LOOP_PROFILER
+  this->publish_loop_latency_();
+#endif
 #endif  // USE_SENSOR
+#ifdef USE_HEAP_PROFILER
+  this->log_heap_stats_();
+#endif
   update_platform_();
 }
 
+#if defined(USE_SENSOR) && defined(USE_LOOP_PROFILER)
+/// Returns the values recorded in `current` since `last`, and moves `last` up to `current`.
+static LatencyHistogram histogram_since(const LatencyHistogram &current, LatencyHistogram &last) {
+  // The counters start over when the statistics are reset through the API
+  if (current.count < last.count)
+    last = LatencyHistogram{};
+  LatencyHistogram delta;
+  delta.count = current.count - last.count;
+  // The maximum can't be split up, it only caps the estimate of the highest bucket
+  delta.max = current.max;
+  for (uint8_t i = 0; i < LatencyHistogram::BUCKETS; i++)
+    delta.buckets[i] = current.buckets[i] - last.buckets[i];
+  last = current;
+  return delta;
+}
+
+void DebugComponent::publish_loop_latency_() {
+  const LoopIterationStats &stats = App.get_loop_iteration_stats();
+  const LatencyHistogram iterations = histogram_since(stats.iteration_us, this->last_iterations_);
+  const LatencyHistogram lateness = histogram_since(App.scheduler.get_lateness_stats(), this->last_lateness_);
+  if (this->loop_time_p99_sensor_ != nullptr)
+    this->loop_time_p99_sensor_->publish_state(iterations.percentile(99.0f) / 1000.0f);
+  if (this->scheduler_lateness_p99_sensor_ != nullptr)
+    this->scheduler_lateness_p99_sensor_->publish_state(lateness.percentile(99.0f));
+  if (this->stall_count_sensor_ != nullptr)
+    this->stall_count_sensor_->publish_state(stats.stall_count);
+}
+#endif
+
+#ifdef USE_HEAP_PROFILER
+void DebugComponent::log_heap_stats_() {
+  // Only the biggest few are of interest
+  static const size_t TOP_COMPONENTS = 5;
+  std::vector<Component *> components = App.get_components();
+  auto held = [](Component *c) { return c->get_heap_stats().setup_bytes + c->get_heap_stats().loop_bytes; };
+  const size_t count = std::min(TOP_COMPONENTS, components.size());
+  std::partial_sort(components.begin(), components.begin() + count, components.end(),
+                    [&held](Component *a, Component *b) { return held(a) > held(b); });
+
+  ESP_LOGD(TAG, "Components holding the most heap:");
+  for (size_t i = 0; i < count; i++) {
+    const ComponentHeapStats &stats = components[i]->get_heap_stats();
+    ESP_LOGD(TAG, "  %s: %" PRId32 " bytes (setup %" PRId32 ", loop %" PRId32 ", %" PRIu32 " allocating calls)",
+             components[i]->get_component_source(), held(components[i]), stats.setup_bytes, stats.loop_bytes,
+             stats.allocating_calls);
+  }
+
+#ifdef USE_TEXT_SENSOR
+  if (this->heap_top_component_ != nullptr && count != 0) {
+    this->heap_top_component_->publish_state(str_sprintf("%s: %" PRId32 " bytes",
+                                                         components[0]->get_component_source(), held(components[0])));
+  }
+#endif  // USE_TEXT_SENSOR
+}
+#endif  // USE_HEAP_PROFILER
+
 float DebugComponent::get_setup_priority() const { return setup_priority::LATE; }
 
 }  // namespace debug
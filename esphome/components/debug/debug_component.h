@@ -25,6 +25,11 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_TEXT_SENSOR
   void set_device_info_sensor(text_sensor::TextSensor *device_info) { device_info_ = device_info; }
   void set_reset_reason_sensor(text_sensor::TextSensor *reset_reason) { reset_reason_ = reset_reason; }
+#ifdef USE_HEAP_PROFILER
+  void set_heap_top_component_sensor(text_sensor::TextSensor *heap_top_component) {
+    this->heap_top_component_ = heap_top_component;
+  }
+#endif  // USE_HEAP_PROFILER
 #endif  // USE_TEXT_SENSOR
 #ifdef USE_SENSOR
   void set_free_sensor(sensor::Sensor *free_sensor) { free_sensor_ = free_sensor; }
@@ -36,8 +41,25 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
+#ifdef USE_LOOP_PROFILER
+  void set_loop_time_p99_sensor(sensor::Sensor *loop_time_p99_sensor) {
+    this->loop_time_p99_sensor_ = loop_time_p99_sensor;
+  }
+  void set_scheduler_lateness_p99_sensor(sensor::Sensor *scheduler_lateness_p99_sensor) {
+    this->scheduler_lateness_p99_sensor_ = scheduler_lateness_p99_sensor;
+  }
+  void set_stall_count_sensor(sensor::Sensor *stall_count_sensor) { this->stall_count_sensor_ = stall_count_sensor; }
+#endif  // USE_LOOP_PROFILER
 #endif  // USE_SENSOR
  protected:
+#if defined(USE_SENSOR) && defined(USE_LOOP_PROFILER)
+  /// Publishes the percentiles of the loop profiler histograms over the last update interval.
+  void publish_loop_latency_();
+#endif
+#ifdef USE_HEAP_PROFILER
+  /// Logs the components holding the most heap, and publishes the top one.
+  void log_heap_stats_();
+#endif
   uint32_t free_heap_{};
 
 #ifdef USE_SENSOR
@@ -53,11 +75,22 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
+#ifdef USE_LOOP_PROFILER
+  sensor::Sensor *loop_time_p99_sensor_{nullptr};
+  sensor::Sensor *scheduler_lateness_p99_sensor_{nullptr};
+  sensor::Sensor *stall_count_sensor_{nullptr};
+  /// The histograms as of the last update, to take the percentiles of this interval only
+  LatencyHistogram last_iterations_;
+  LatencyHistogram last_lateness_;
+#endif  // USE_LOOP_PROFILER
 #endif  // USE_SENSOR
 
 #ifdef USE_TEXT_SENSOR
   text_sensor::TextSensor *device_info_{nullptr};
   text_sensor::TextSensor *reset_reason_{nullptr};
+#ifdef USE_HEAP_PROFILER
+  text_sensor::TextSensor *heap_top_component_{nullptr};
+#endif  // USE_HEAP_PROFILER
 #endif  // USE_TEXT_SENSOR
 
   std::string get_reset_reason_();
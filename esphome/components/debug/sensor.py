@@ -1,23 +1,29 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor
+import esphome.final_validate as fv
 from esphome.const import (
     CONF_FREE,
     CONF_FRAGMENTATION,
     CONF_BLOCK,
     CONF_LOOP_TIME,
     ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_MILLISECOND,
     UNIT_PERCENT,
     UNIT_BYTES,
     ICON_COUNTER,
     ICON_TIMER,
 )
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, CONF_LOOP_PROFILER, DebugComponent
 
 DEPENDENCIES = ["debug"]
 
 CONF_PSRAM = "psram"
+CONF_LOOP_TIME_P99 = "loop_time_p99"
+CONF_SCHEDULER_LATENESS_P99 = "scheduler_lateness_p99"
+CONF_STALL_COUNT = "stall_count"
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -59,8 +65,48 @@ CONFIG_SCHEMA = {
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
     ),
+    cv.Optional(CONF_LOOP_TIME_P99): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=1,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_SCHEDULER_LATENESS_P99): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_MEASUREMENT,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_STALL_COUNT): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
 }
 
+_LOOP_PROFILER_SENSORS = (
+    CONF_LOOP_TIME_P99,
+    CONF_SCHEDULER_LATENESS_P99,
+    CONF_STALL_COUNT,
+)
+
+
+def _final_validate(config):
+    if fv.full_config.get()["debug"].get(CONF_LOOP_PROFILER):
+        return config
+    for key in _LOOP_PROFILER_SENSORS:
+        if key in config:
+            raise cv.Invalid(
+                f"'{key}' requires '{CONF_LOOP_PROFILER}' in the debug component"
+            )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
 
 async def to_code(config):
     debug_component = await cg.get_variable(config[CONF_DEBUG_ID])
@@ -84,3 +130,15 @@ async def to_code(config):
     if psram_conf := config.get(CONF_PSRAM):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
+
+    if loop_time_p99_conf := config.get(CONF_LOOP_TIME_P99):
+        sens = await sensor.new_sensor(loop_time_p99_conf)
+        cg.add(debug_component.set_loop_time_p99_sensor(sens))
+
+    if lateness_conf := config.get(CONF_SCHEDULER_LATENESS_P99):
+        sens = await sensor.new_sensor(lateness_conf)
+        cg.add(debug_component.set_scheduler_lateness_p99_sensor(sens))
+
+    if stall_count_conf := config.get(CONF_STALL_COUNT):
+        sens = await sensor.new_sensor(stall_count_conf)
+        cg.add(debug_component.set_stall_count_sensor(sens))
@@ -1,19 +1,22 @@
 from esphome.components import text_sensor
 import esphome.config_validation as cv
 import esphome.codegen as cg
+import esphome.final_validate as fv
 from esphome.const import (
     CONF_DEVICE,
     ENTITY_CATEGORY_DIAGNOSTIC,
     ICON_CHIP,
+    ICON_MEMORY,
     ICON_RESTART,
 )
 
-from . import CONF_DEBUG_ID, DebugComponent
+from . import CONF_DEBUG_ID, CONF_HEAP_PROFILER, DebugComponent
 
 DEPENDENCIES = ["debug"]
 
 
 CONF_RESET_REASON = "reset_reason"
+CONF_HEAP_TOP_COMPONENT = "heap_top_component"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -25,10 +28,28 @@ CONFIG_SCHEMA = cv.Schema(
             icon=ICON_RESTART,
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
+        cv.Optional(CONF_HEAP_TOP_COMPONENT): text_sensor.text_sensor_schema(
+            icon=ICON_MEMORY,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
     }
 )
 
 
+def _final_validate(config):
+    if CONF_HEAP_TOP_COMPONENT in config and not fv.full_config.get()["debug"].get(
+        CONF_HEAP_PROFILER
+    ):
+        raise cv.Invalid(
+            f"'{CONF_HEAP_TOP_COMPONENT}' requires '{CONF_HEAP_PROFILER}'"
+            " in the debug component"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     debug_component = await cg.get_variable(config[CONF_DEBUG_ID])
 
@@ -38,3 +59,6 @@ async def to_code(config):
     if CONF_RESET_REASON in config:
         sens = await text_sensor.new_text_sensor(config[CONF_RESET_REASON])
         cg.add(debug_component.set_reset_reason_sensor(sens))
+    if CONF_HEAP_TOP_COMPONENT in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_HEAP_TOP_COMPONENT])
+        cg.add(debug_component.set_heap_top_component_sensor(sens))
@@ -1,8 +1,10 @@
 import esphome.codegen as cg
 from esphome.components import time
 import esphome.config_validation as cv
+import esphome.final_validate as fv
 from esphome import pins, automation
 from esphome.const import (
+    CONF_ENABLE_ON_BOOT,
     CONF_HOUR,
     CONF_ID,
     CONF_MINUTE,
@@ -158,6 +160,7 @@ CONF_DEFAULT = "default"
 CONF_GPIO_WAKEUP_REASON = "gpio_wakeup_reason"
 CONF_TOUCH_WAKEUP_REASON = "touch_wakeup_reason"
 CONF_UNTIL = "until"
+CONF_CONNECT_EVERY = "connect_every"
 
 WAKEUP_CAUSES_SCHEMA = cv.Schema(
     {
@@ -176,6 +179,7 @@ CONFIG_SCHEMA = cv.All(
                 cv.positive_time_period_milliseconds,
             ),
             cv.Optional(CONF_SLEEP_DURATION): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_CONNECT_EVERY): cv.int_range(min=1),
             cv.Optional(CONF_WAKEUP_PIN): cv.All(
                 cv.only_on_esp32,
                 pins.internal_gpio_input_pin_schema,
@@ -202,6 +206,22 @@ CONFIG_SCHEMA = cv.All(
 )
 
 
+def _final_validate(config):
+    if config.get(CONF_CONNECT_EVERY, 1) > 1:
+        wifi_config = fv.full_config.get().get("wifi")
+        if wifi_config is None:
+            raise cv.Invalid(f"{CONF_CONNECT_EVERY} requires the wifi component")
+        if wifi_config[CONF_ENABLE_ON_BOOT]:
+            raise cv.Invalid(
+                f"{CONF_CONNECT_EVERY} requires wifi {CONF_ENABLE_ON_BOOT}: false, "
+                "deep sleep enables Wi-Fi on the wakes that connect"
+            )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
@@ -250,6 +270,9 @@ async def to_code(config):
     if CONF_TOUCH_WAKEUP in config:
         cg.add(var.set_touch_wakeup(config[CONF_TOUCH_WAKEUP]))
 
+    if CONF_CONNECT_EVERY in config:
+        cg.add(var.set_connect_every(config[CONF_CONNECT_EVERY]))
+
     cg.add_define("USE_DEEP_SLEEP")
 
 
@@ -2,6 +2,10 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_WIFI
+#include "esphome/components/wifi/wifi_component.h"
+#endif
+
 namespace esphome {
 namespace deep_sleep {
 
@@ -13,6 +17,17 @@ void DeepSleepComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Deep Sleep...");
   global_has_deep_sleep = true;
 
+  if (this->connect_every_ > 1) {
+    this->wake_count_ = this->load_wake_count_();
+    this->connect_wake_ = this->wake_count_ % this->connect_every_ == 0;
+    ESP_LOGD(TAG, "Wake %" PRIu32 " of %" PRIu32 ", %s", this->wake_count_ % this->connect_every_ + 1,
+             this->connect_every_, this->connect_wake_ ? "connecting" : "not connecting");
+#ifdef USE_WIFI
+    if (this->connect_wake_)
+      wifi::global_wifi_component->enable();
+#endif
+  }
+
   const optional<uint32_t> run_duration = get_run_duration_();
   if (run_duration.has_value()) {
     ESP_LOGI(TAG, "Scheduling Deep Sleep to start in %" PRIu32 " ms", *run_duration);
@@ -31,6 +46,9 @@ void DeepSleepComponent::dump_config() {
   if (this->run_duration_.has_value()) {
     ESP_LOGCONFIG(TAG, "  Run Duration: %" PRIu32 " ms", *this->run_duration_);
   }
+  if (this->connect_every_ > 1) {
+    ESP_LOGCONFIG(TAG, "  Connect Every: %" PRIu32 " wakes", this->connect_every_);
+  }
   this->dump_config_platform_();
 }
 
@@ -57,6 +75,10 @@ void DeepSleepComponent::begin_sleep(bool manual) {
     return;
   }
 
+  if (this->connect_every_ > 1) {
+    this->save_wake_count_(this->wake_count_ + 1);
+  }
+
   ESP_LOGI(TAG, "Beginning Deep Sleep");
   if (this->sleep_duration_.has_value()) {
     ESP_LOGI(TAG, "Sleeping for %" PRId64 "us", *this->sleep_duration_);
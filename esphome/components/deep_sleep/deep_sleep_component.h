@@ -9,6 +9,10 @@
 #include <esp_sleep.h>
 #endif
 
+#ifdef USE_ESP8266
+#include "esphome/core/preferences.h"
+#endif
+
 #ifdef USE_TIME
 #include "esphome/components/time/real_time_clock.h"
 #include "esphome/core/time.h"
@@ -91,6 +95,15 @@ class DeepSleepComponent : public Component {
   /// Set a duration in ms for how long the code should run before entering deep sleep mode.
   void set_run_duration(uint32_t time_ms);
 
+  /** Only connect to Wi-Fi on every n-th wake, starting with the first one after power-on.
+   *
+   * The wakes in between run without the radio, Wi-Fi has to be configured not to be enabled on boot then. The wakes
+   * are counted in memory that is kept during deep sleep.
+   */
+  void set_connect_every(uint32_t connect_every) { this->connect_every_ = connect_every; }
+  /// Whether this wake connects to Wi-Fi.
+  bool is_connect_wake() const { return this->connect_wake_; }
+
   void setup() override;
   void dump_config() override;
   void loop() override;
@@ -111,6 +124,9 @@ class DeepSleepComponent : public Component {
   void dump_config_platform_();
   bool prepare_to_sleep_();
   void deep_sleep_();
+  /// Returns the number of wakes counted so far, kept in memory that survives deep sleep.
+  uint32_t load_wake_count_();
+  void save_wake_count_(uint32_t wake_count);
 
   optional<uint64_t> sleep_duration_;
 #ifdef USE_ESP32
@@ -125,6 +141,12 @@ class DeepSleepComponent : public Component {
   optional<WakeupCauseToRunDuration> wakeup_cause_to_run_duration_;
 #endif
   optional<uint32_t> run_duration_;
+#ifdef USE_ESP8266
+  ESPPreferenceObject wake_count_pref_;
+#endif
+  uint32_t connect_every_{1};
+  uint32_t wake_count_{0};
+  bool connect_wake_{true};
   bool next_enter_deep_sleep_{false};
   bool prevent_{false};
 };
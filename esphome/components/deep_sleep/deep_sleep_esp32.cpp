@@ -2,11 +2,16 @@
 #include "deep_sleep_component.h"
 #include "esphome/core/log.h"
 
+#include <esp_attr.h>
+
 namespace esphome {
 namespace deep_sleep {
 
 static const char *const TAG = "deep_sleep";
 
+// RTC slow memory is initialized on power-on and kept during deep sleep
+static RTC_DATA_ATTR uint32_t rtc_wake_count = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 optional<uint32_t> DeepSleepComponent::get_run_duration_() const {
   if (this->wakeup_cause_to_run_duration_.has_value()) {
     esp_sleep_wakeup_cause_t wakeup_cause = esp_sleep_get_wakeup_cause();
@@ -64,6 +69,10 @@ bool DeepSleepComponent::prepare_to_sleep_() {
   return true;
 }
 
+uint32_t DeepSleepComponent::load_wake_count_() { return rtc_wake_count; }
+
+void DeepSleepComponent::save_wake_count_(uint32_t wake_count) { rtc_wake_count = wake_count; }
+
 void DeepSleepComponent::deep_sleep_() {
 #if !defined(USE_ESP32_VARIANT_ESP32C3) && !defined(USE_ESP32_VARIANT_ESP32C6)
   if (this->sleep_duration_.has_value())
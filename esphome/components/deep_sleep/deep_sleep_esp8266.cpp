@@ -8,12 +8,24 @@ namespace deep_sleep {
 
 static const char *const TAG = "deep_sleep";
 
+static constexpr uint32_t WAKE_COUNT_HASH = fnv1_hash_constexpr("deep_sleep_wake_count");
+
 optional<uint32_t> DeepSleepComponent::get_run_duration_() const { return this->run_duration_; }
 
 void DeepSleepComponent::dump_config_platform_() {}
 
 bool DeepSleepComponent::prepare_to_sleep_() { return true; }
 
+uint32_t DeepSleepComponent::load_wake_count_() {
+  // Preferences that aren't in flash live in the RTC memory, which keeps its contents during deep sleep
+  this->wake_count_pref_ = global_preferences->make_preference<uint32_t>(WAKE_COUNT_HASH, false);
+  uint32_t wake_count = 0;
+  this->wake_count_pref_.load(&wake_count);
+  return wake_count;
+}
+
+void DeepSleepComponent::save_wake_count_(uint32_t wake_count) { this->wake_count_pref_.save(&wake_count); }
+
 void DeepSleepComponent::deep_sleep_() {
   ESP.deepSleep(*this->sleep_duration_);  // NOLINT(readability-static-accessed-through-instance)
 }
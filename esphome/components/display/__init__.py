@@ -39,6 +39,8 @@ DisplayOnPageChangeTrigger = display_ns.class_(
 
 CONF_ON_PAGE_CHANGE = "on_page_change"
 CONF_SHOW_TEST_CARD = "show_test_card"
+CONF_REDRAW_ON_CHANGE = "redraw_on_change"
+CONF_DEPENDS_ON = "depends_on"
 
 DISPLAY_ROTATIONS = {
     0: display_ns.DISPLAY_ROTATION_0_DEGREES,
@@ -69,6 +71,9 @@ FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend(
                 {
                     cv.GenerateID(): cv.declare_id(DisplayPage),
                     cv.Required(CONF_LAMBDA): cv.lambda_,
+                    cv.Optional(CONF_DEPENDS_ON): cv.ensure_list(
+                        cv.use_id(cg.EntityBase)
+                    ),
                 }
             ),
             cv.Length(min=1),
@@ -84,6 +89,8 @@ FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend(
         ),
         cv.Optional(CONF_AUTO_CLEAR_ENABLED, default=True): cv.boolean,
         cv.Optional(CONF_SHOW_TEST_CARD): cv.boolean,
+        cv.Optional(CONF_REDRAW_ON_CHANGE, default=False): cv.boolean,
+        cv.Optional(CONF_DEPENDS_ON): cv.ensure_list(cv.use_id(cg.EntityBase)),
     }
 )
 
@@ -102,6 +109,9 @@ async def setup_display_core_(var, config):
                 conf[CONF_LAMBDA], [(DisplayRef, "it")], return_type=cg.void
             )
             page = cg.new_Pvariable(conf[CONF_ID], lambda_)
+            for dep in conf.get(CONF_DEPENDS_ON, []):
+                entity = await cg.get_variable(dep)
+                cg.add(page.add_redraw_dependency(entity))
             pages.append(page)
         cg.add(var.set_pages(pages))
     for conf in config.get(CONF_ON_PAGE_CHANGE, []):
@@ -117,6 +127,11 @@ async def setup_display_core_(var, config):
         )
     if config.get(CONF_SHOW_TEST_CARD):
         cg.add(var.show_test_card())
+    if config.get(CONF_REDRAW_ON_CHANGE):
+        cg.add(var.set_redraw_on_change(True))
+    for dep in config.get(CONF_DEPENDS_ON, []):
+        entity = await cg.get_variable(dep)
+        cg.add(var.add_redraw_dependency(entity))
 
 
 async def register_display(var, config):
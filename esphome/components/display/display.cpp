@@ -85,16 +85,14 @@ void Display::draw_pixels_at(int x_start, int y_start, int w, int h, const uint8
   }
 }
 
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
-}
-void HOT Display::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+void HOT Display::fill_rect(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_pixel_at(i, j, color);
+  }
 }
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
+void HOT Display::vertical_line(int x, int y, int height, Color color) { this->fill_rect(x, y, 1, height, color); }
 void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
@@ -102,10 +100,7 @@ void Display::rectangle(int x1, int y1, int width, int height, Color color) {
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void Display::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
-  }
+  this->fill_rect(x1, y1, width, height, color);
 }
 void HOT Display::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
@@ -497,13 +492,31 @@ void Display::show_page(DisplayPage *page) {
   this->previous_page_ = this->page_;
   this->page_ = page;
   if (this->previous_page_ != this->page_) {
+    this->redraw_requested_ = true;
     for (auto *t : on_page_change_triggers_)
       t->process(this->previous_page_, this->page_);
   }
 }
 void Display::show_next_page() { this->page_->show_next(); }
 void Display::show_prev_page() { this->page_->show_prev(); }
+void Display::start_poller() {
+  if (!this->redraw_on_change_) {
+    PollingComponent::start_poller();
+    return;
+  }
+  this->set_interval("update", this->get_update_interval(), [this]() {
+    if (this->is_redraw_needed_())
+      this->update();
+  });
+}
+bool Display::is_redraw_needed_() const {
+  return this->redraw_requested_ || (this->page_ != nullptr && this->page_->is_redraw_requested());
+}
 void Display::do_update_() {
+  // clear the requests first, so that a state published while drawing triggers another frame
+  this->redraw_requested_ = false;
+  if (this->page_ != nullptr)
+    this->page_->clear_redraw_request();
   if (this->auto_clear_enabled_) {
     this->clear();
   }
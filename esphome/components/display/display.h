@@ -228,6 +228,16 @@ class Display : public PollingComponent {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Fill a rectangle with the given color.
+   *
+   * The naive implementation here sets every pixel with draw_pixel_at(). DisplayBuffer resolves clipping and rotation
+   * once per call and passes the rectangle on to fill_rect_internal(), which drivers can implement directly on their
+   * buffer format.
+   */
+  virtual void fill_rect(int x, int y, int width, int height, Color color);
+  /// Fill width pixels of row y, starting at x.
+  void fill_span(int x, int y, int width, Color color) { this->fill_rect(x, y, width, 1, color); }
+
   /** Given an array of pixels encoded in the nominated format, draw these into the display's buffer.
    * The naive implementation here will work in all cases, but can be overridden by sub-classes
    * in order to optimise the procedure.
@@ -256,6 +266,18 @@ class Display : public PollingComponent {
     this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
   }
 
+  /** Like draw_pixels_at() with a packed buffer, but the driver may return while the pixels are still being sent.
+   *
+   * The buffer must stay unchanged until wait_pixels_drawn() returns. Drivers without an asynchronous path draw
+   * synchronously.
+   */
+  virtual void draw_pixels_async(int x_start, int y_start, int w, int h, const uint8_t *ptr, ColorOrder order,
+                                 ColorBitness bitness, bool big_endian) {
+    this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian);
+  }
+  /// Wait until the pixels passed to draw_pixels_async() have been sent.
+  virtual void wait_pixels_drawn() {}
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -570,6 +592,22 @@ class Display : public PollingComponent {
 
   const DisplayPage *get_active_page() const { return this->page_; }
 
+  /** Only redraw when something the content depends on changed.
+   *
+   * When enabled, the update interval just checks whether a redraw was requested since the last frame, and skips
+   * both rendering and sending the frame to the panel otherwise. A redraw is requested by request_redraw(), by a
+   * registered dependency publishing a new state, or by switching pages.
+   */
+  void set_redraw_on_change(bool redraw_on_change) { this->redraw_on_change_ = redraw_on_change; }
+  /// Render the next frame even if none of the dependencies changed.
+  void request_redraw() { this->redraw_requested_ = true; }
+  /// Request a redraw whenever this entity publishes a new state.
+  template<typename T> void add_redraw_dependency(T *entity) {
+    entity->add_on_state_callback([this](auto &&...) { this->request_redraw(); });
+  }
+
+  void start_poller() override;
+
   void add_on_page_change_trigger(DisplayOnPageChangeTrigger *t) { this->on_page_change_triggers_.push_back(t); }
 
   /// Internal method to set the display rotation with.
@@ -642,6 +680,7 @@ class Display : public PollingComponent {
                 va_list arg);
 
   void do_update_();
+  bool is_redraw_needed_() const;
   void clear_clipping_();
 
   virtual int get_height_internal() = 0;
@@ -664,6 +703,8 @@ class Display : public PollingComponent {
   bool auto_clear_enabled_{true};
   std::vector<Rect> clipping_rectangle_;
   bool show_test_card_{false};
+  bool redraw_on_change_{false};
+  bool redraw_requested_{true};
 };
 
 class DisplayPage {
@@ -677,9 +718,19 @@ class DisplayPage {
   void set_next(DisplayPage *next);
   const display_writer_t &get_writer() const;
 
+  /// Redraw the next time this page is shown on a display with redraw_on_change enabled.
+  void request_redraw() { this->redraw_requested_ = true; }
+  /// Request a redraw of this page whenever this entity publishes a new state.
+  template<typename T> void add_redraw_dependency(T *entity) {
+    entity->add_on_state_callback([this](auto &&...) { this->request_redraw(); });
+  }
+  bool is_redraw_requested() const { return this->redraw_requested_; }
+  void clear_redraw_request() { this->redraw_requested_ = false; }
+
  protected:
   Display *parent_;
   display_writer_t writer_;
+  bool redraw_requested_{true};
   DisplayPage *prev_{nullptr};
   DisplayPage *next_{nullptr};
 };
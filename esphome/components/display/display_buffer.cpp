@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -65,8 +66,150 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
       break;
   }
   this->draw_absolute_pixel_internal(x, y, color);
+  if (this->track_dirty_ && x >= 0 && y >= 0 && x < this->get_width_internal() && y < this->get_height_internal())
+    this->mark_dirty_(x, y, 1, 1);
   App.feed_wdt();
 }
 
+void HOT DisplayBuffer::fill_rect(int x, int y, int width, int height, Color color) {
+  int x2 = x + width;
+  int y2 = y + height;
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    // same bounds as Rect::inside(), which includes x2() and y2()
+    x = std::max<int>(x, clipping.x);
+    y = std::max<int>(y, clipping.y);
+    x2 = std::min<int>(x2, clipping.x2() + 1);
+    y2 = std::min<int>(y2, clipping.y2() + 1);
+  }
+  x = std::max(x, 0);
+  y = std::max(y, 0);
+  x2 = std::min(x2, this->get_width());
+  y2 = std::min(y2, this->get_height());
+  if (x >= x2 || y >= y2)
+    return;
+
+  int width_internal = this->get_width_internal();
+  int height_internal = this->get_height_internal();
+  Rect native;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      native = Rect(x, y, x2 - x, y2 - y);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      native = Rect(width_internal - y2, x, y2 - y, x2 - x);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      native = Rect(width_internal - x2, height_internal - y2, x2 - x, y2 - y);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      native = Rect(y, height_internal - x2, y2 - y, x2 - x);
+      break;
+  }
+  this->fill_rect_internal(native.x, native.y, native.w, native.h, color);
+  if (this->track_dirty_)
+    this->mark_dirty_(native.x, native.y, native.w, native.h);
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::fill_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int j = y; j < y + height; j++) {
+    for (int i = x; i < x + width; i++)
+      this->draw_absolute_pixel_internal(i, j, color);
+  }
+}
+
+void DisplayBuffer::fill(Color color) {
+  if (!this->track_dirty_ || this->is_clipping()) {
+    Display::fill(color);
+    return;
+  }
+  this->track_fill_(color);
+  this->fill_rect_internal(0, 0, this->get_width_internal(), this->get_height_internal(), color);
+  App.feed_wdt();
+}
+
+void DisplayBuffer::enable_dirty_tracking_() {
+  this->track_dirty_ = true;
+  this->fill_color_valid_ = false;
+  this->mark_all_dirty_();
+}
+
+void DisplayBuffer::mark_all_dirty_() {
+  this->dirty_region_.clear();
+  this->dirty_region_.add(0, 0, this->get_width_internal(), this->get_height_internal());
+  this->drawn_region_ = this->dirty_region_;
+}
+
+void DisplayBuffer::track_fill_(Color color) {
+  if (!this->track_dirty_)
+    return;
+  if (this->fill_color_valid_ && color == this->fill_color_) {
+    // only what was drawn since the last fill with the same color changes
+    this->dirty_region_.add(this->drawn_region_);
+  } else {
+    this->dirty_region_.clear();
+    this->dirty_region_.add(0, 0, this->get_width_internal(), this->get_height_internal());
+    this->fill_color_ = color;
+    this->fill_color_valid_ = true;
+  }
+  this->drawn_region_.clear();
+}
+
+void DisplayBuffer::flush_dirty_() {
+  for (const Rect &rect : this->dirty_region_)
+    this->flush_rect_internal(rect);
+  this->dirty_region_.clear();
+}
+
+void HOT DirtyRegion::add(int x, int y, int width, int height) {
+  if (width <= 0 || height <= 0)
+    return;
+  // most pixels are drawn inside an area that is already dirty
+  for (uint8_t i = 0; i < this->count_; i++) {
+    const Rect &rect = this->rects_[i];
+    if (x >= rect.x && y >= rect.y && x + width <= rect.x2() && y + height <= rect.y2())
+      return;
+  }
+  int x1 = x, y1 = y, x2 = x + width, y2 = y + height;
+  while (true) {
+    // merge with a rectangle that overlaps or touches, otherwise with the one that grows the least
+    int best = -1;
+    bool touching = false;
+    int best_growth = 0;
+    for (uint8_t i = 0; i < this->count_; i++) {
+      const Rect &rect = this->rects_[i];
+      if (x1 <= rect.x2() && rect.x <= x2 && y1 <= rect.y2() && rect.y <= y2) {
+        best = i;
+        touching = true;
+        break;
+      }
+      int growth = (std::max<int>(x2, rect.x2()) - std::min<int>(x1, rect.x)) *
+                       (std::max<int>(y2, rect.y2()) - std::min<int>(y1, rect.y)) -
+                   rect.w * rect.h - (x2 - x1) * (y2 - y1);
+      if (best < 0 || growth < best_growth) {
+        best = i;
+        best_growth = growth;
+      }
+    }
+    if (!touching && this->count_ < MAX_RECTS) {
+      this->rects_[this->count_++] = Rect(x1, y1, x2 - x1, y2 - y1);
+      return;
+    }
+    const Rect &rect = this->rects_[best];
+    x1 = std::min<int>(x1, rect.x);
+    y1 = std::min<int>(y1, rect.y);
+    x2 = std::max<int>(x2, rect.x2());
+    y2 = std::max<int>(y2, rect.y2());
+    this->rects_[best] = this->rects_[--this->count_];
+  }
+}
+
+void DirtyRegion::add(const DirtyRegion &other) {
+  for (const Rect &rect : other)
+    this->add(rect.x, rect.y, rect.w, rect.h);
+}
+
 }  // namespace display
 }  // namespace esphome
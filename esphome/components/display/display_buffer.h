@@ -12,6 +12,27 @@
 namespace esphome {
 namespace display {
 
+/** A few rectangles covering every pixel added to them.
+ *
+ * Rectangles that touch are merged, once all slots are used a new area is merged into the rectangle that grows the
+ * least. The result can cover more than was added but never less.
+ */
+class DirtyRegion {
+ public:
+  static constexpr uint8_t MAX_RECTS = 4;
+
+  void add(int x, int y, int width, int height);
+  void add(const DirtyRegion &other);
+  void clear() { this->count_ = 0; }
+  bool empty() const { return this->count_ == 0; }
+  const Rect *begin() const { return this->rects_; }
+  const Rect *end() const { return this->rects_ + this->count_; }
+
+ protected:
+  Rect rects_[MAX_RECTS];
+  uint8_t count_{0};
+};
+
 class DisplayBuffer : public Display {
  public:
   /// Get the width of the image in pixels with rotation applied.
@@ -22,12 +43,51 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  /// Fill a rectangle, clipped and rotated once before it is handed to fill_rect_internal().
+  void fill_rect(int x, int y, int width, int height, Color color) override;
+
+  /// Fill the entire screen, with dirty tracking only the pixels drawn since the last fill are marked as changed.
+  void fill(Color color) override;
+
  protected:
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
+  /** Fill a rectangle given in native coordinates, it is always inside the display.
+   *
+   * Override this to fill the buffer directly, the default sets each pixel with draw_absolute_pixel_internal().
+   */
+  virtual void fill_rect_internal(int x, int y, int width, int height, Color color);
+
+  /** Record which parts of the buffer change, so that update() only has to send those.
+   *
+   * Drivers that enable this call flush_dirty_() instead of writing the whole buffer and implement
+   * flush_rect_internal(). Drivers that override fill() call track_fill_() from it.
+   */
+  void enable_dirty_tracking_();
+  /// Mark an area in native coordinates as changed.
+  void mark_dirty_(int x, int y, int width, int height) {
+    this->dirty_region_.add(x, y, width, height);
+    this->drawn_region_.add(x, y, width, height);
+  }
+  /// Mark the whole display as changed.
+  void mark_all_dirty_();
+  /// Account for filling the whole buffer with color.
+  void track_fill_(Color color);
+  /// Pass every changed area to flush_rect_internal() and forget about them.
+  void flush_dirty_();
+  /// Send one area of the buffer, in native coordinates, to the display.
+  virtual void flush_rect_internal(const Rect &rect) {}
 
   void init_internal_(uint32_t buffer_length);
 
   uint8_t *buffer_{nullptr};
+
+  bool track_dirty_{false};
+  /// Areas that differ from what was last sent to the display
+  DirtyRegion dirty_region_;
+  /// Areas drawn since the last fill, everything else has the fill color
+  DirtyRegion drawn_region_;
+  Color fill_color_{};
+  bool fill_color_valid_{false};
 };
 
 }  // namespace display
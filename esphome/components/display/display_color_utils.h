@@ -1,5 +1,6 @@
 #pragma once
 #include "esphome/core/color.h"
+#include "esphome/core/hal.h"
 
 namespace esphome {
 namespace display {
@@ -116,22 +117,30 @@ class ColorUtil {
    * @param[in] palette The 256*3 byte RGB palette.
    * @return The 8 bit index of the closest color (e.g. for display buffer).
    */
-  // static uint8_t color_to_index8_palette888(Color color, uint8_t *palette) {
   static uint8_t color_to_index8_palette888(Color color, const uint8_t *palette) {
+    return color_to_index_palette888(color, palette, 256);
+  }
+  /***
+   * Like color_to_index8_palette888(), for palettes with fewer entries (e.g. 16 for 4 bit indexed buffers).
+   * @param[in] color The target color.
+   * @param[in] palette The size*3 byte RGB palette, may be stored in PROGMEM.
+   * @param[in] size The number of palette entries, at most 256.
+   * @return The index of the closest color.
+   */
+  static uint8_t color_to_index_palette888(Color color, const uint8_t *palette, uint16_t size) {
     uint8_t closest_index = 0;
     uint32_t minimum_dist2 = UINT32_MAX;  // Smallest distance^2 to the target
                                           // so far
-    // int8_t(*plt)[][3] = palette;
     int16_t tgt_r = color.r;
     int16_t tgt_g = color.g;
     int16_t tgt_b = color.b;
     uint16_t x, y, z;
     // Loop through each row of the palette
-    for (uint16_t i = 0; i < 256; i++) {
+    for (uint16_t i = 0; i < size; i++) {
       // Get the pallet rgb color
-      int16_t plt_r = (int16_t) palette[i * 3 + 0];
-      int16_t plt_g = (int16_t) palette[i * 3 + 1];
-      int16_t plt_b = (int16_t) palette[i * 3 + 2];
+      int16_t plt_r = (int16_t) progmem_read_byte(palette + i * 3 + 0);
+      int16_t plt_g = (int16_t) progmem_read_byte(palette + i * 3 + 1);
+      int16_t plt_b = (int16_t) progmem_read_byte(palette + i * 3 + 2);
       // Calculate euclidean distance (linear distance in rgb cube).
       x = (uint32_t) std::abs(tgt_r - plt_r);
       y = (uint32_t) std::abs(tgt_g - plt_g);
@@ -0,0 +1,127 @@
+#include "framebuffer.h"
+#include "display_color_utils.h"
+
+#include "esphome/core/hal.h"
+
+#include <cstring>
+
+namespace esphome {
+namespace display {
+
+void Framebuffer::init(uint8_t *buffer, FramebufferFormat format, int width, int height, const uint8_t *palette) {
+  this->buffer_ = buffer;
+  this->format_ = format;
+  this->width_ = width;
+  this->height_ = height;
+  this->palette_ = palette;
+  this->last_valid_ = false;
+  this->palette_565_.clear();
+  if (this->is_indexed() && palette != nullptr) {
+    this->palette_565_.resize(1 << format);
+    for (size_t i = 0; i != this->palette_565_.size(); i++) {
+      this->palette_565_[i] = ColorUtil::color_to_565(Color(progmem_read_byte(palette + i * 3 + 0),
+                                                            progmem_read_byte(palette + i * 3 + 1),
+                                                            progmem_read_byte(palette + i * 3 + 2)));
+    }
+  } else if (this->is_indexed()) {
+    // no palette, the indexes are gray levels
+    this->palette_565_.resize(1 << format);
+    for (size_t i = 0; i != this->palette_565_.size(); i++) {
+      auto level = static_cast<uint8_t>(i * 255 / (this->palette_565_.size() - 1));
+      this->palette_565_[i] = ColorUtil::color_to_565(Color(level, level, level));
+    }
+  }
+}
+
+uint16_t Framebuffer::encode(Color color) {
+  if (!this->is_indexed())
+    return ColorUtil::color_to_565(color);
+  if (this->last_valid_ && this->last_color_ == color)
+    return this->last_value_;
+  uint16_t value;
+  if (this->palette_ != nullptr) {
+    value = ColorUtil::color_to_index_palette888(color, this->palette_, this->palette_565_.size());
+  } else {
+    value = (color.red * 30 + color.green * 59 + color.blue * 11) / 100 * (this->palette_565_.size() - 1) / 255;
+  }
+  this->last_color_ = color;
+  this->last_value_ = value;
+  this->last_valid_ = true;
+  return value;
+}
+
+uint16_t Framebuffer::get_raw_(size_t pos) const {
+  switch (this->format_) {
+    case FRAMEBUFFER_RGB565:
+      return (this->buffer_[pos * 2] << 8) | this->buffer_[pos * 2 + 1];
+    case FRAMEBUFFER_INDEXED_8:
+      return this->buffer_[pos];
+    default: {
+      size_t bit = pos * this->format_;
+      uint8_t shift = 8 - this->format_ - (bit & 7);
+      return (this->buffer_[bit / 8] >> shift) & ((1 << this->format_) - 1);
+    }
+  }
+}
+
+bool Framebuffer::set_raw_(size_t pos, uint16_t value) {
+  switch (this->format_) {
+    case FRAMEBUFFER_RGB565: {
+      uint8_t *ptr = this->buffer_ + pos * 2;
+      if (ptr[0] == (value >> 8) && ptr[1] == (value & 0xFF))
+        return false;
+      ptr[0] = value >> 8;
+      ptr[1] = value & 0xFF;
+      return true;
+    }
+    case FRAMEBUFFER_INDEXED_8:
+      if (this->buffer_[pos] == value)
+        return false;
+      this->buffer_[pos] = value;
+      return true;
+    default: {
+      size_t bit = pos * this->format_;
+      uint8_t shift = 8 - this->format_ - (bit & 7);
+      uint8_t mask = ((1 << this->format_) - 1) << shift;
+      uint8_t *ptr = this->buffer_ + bit / 8;
+      uint8_t updated = (*ptr & ~mask) | ((value << shift) & mask);
+      if (*ptr == updated)
+        return false;
+      *ptr = updated;
+      return true;
+    }
+  }
+}
+
+bool Framebuffer::fill_span(int x, int y, int width, Color color) {
+  uint16_t value = this->encode(color);
+  size_t pos = this->pixel_pos_(x, y);
+  bool changed = false;
+  for (size_t end = pos + width; pos != end; pos++)
+    changed |= this->set_raw_(pos, value);
+  return changed;
+}
+
+void Framebuffer::fill(Color color) {
+  uint16_t value = this->encode(color);
+  size_t length = buffer_size(this->format_, this->width_, this->height_);
+  if (this->format_ == FRAMEBUFFER_RGB565) {
+    if ((value >> 8) == (value & 0xFF)) {
+      memset(this->buffer_, value & 0xFF, length);
+      return;
+    }
+    for (size_t i = 0; i < length; i += 2) {
+      this->buffer_[i] = value >> 8;
+      this->buffer_[i + 1] = value & 0xFF;
+    }
+    return;
+  }
+  // repeat the index over a whole byte
+  uint8_t pattern = 0;
+  for (int bit = 0; bit < 8; bit += this->format_)
+    pattern = (pattern << this->format_) | value;
+  memset(this->buffer_, pattern, length);
+}
+
+}  // namespace display
+}  // namespace esphome
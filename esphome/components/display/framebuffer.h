@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "esphome/core/color.h"
+
+namespace esphome {
+namespace display {
+
+/// Pixel formats of a Framebuffer, the value is the number of bits per pixel.
+enum FramebufferFormat : uint8_t {
+  FRAMEBUFFER_INDEXED_1 = 1,
+  FRAMEBUFFER_INDEXED_2 = 2,
+  FRAMEBUFFER_INDEXED_4 = 4,
+  FRAMEBUFFER_INDEXED_8 = 8,
+  /// Big endian RGB565, the byte order most SPI panels expect
+  FRAMEBUFFER_RGB565 = 16,
+};
+
+/** Typed view of a display driver's pixel memory.
+ *
+ * Indexed formats store a palette index per pixel, packed most significant bits first and without padding between
+ * rows, so an 8 bit palette needs half the RAM of RGB565 and a 4 bit palette a quarter. The palette is a list of
+ * 2^bits RGB888 entries that is expanded to RGB565 once, so converting pixels for the panel while flushing is a
+ * table lookup.
+ *
+ * The buffer itself is owned by the driver (usually allocated with DisplayBuffer::init_internal_()).
+ */
+class Framebuffer {
+ public:
+  /// Number of bytes needed for a buffer of the given format and size.
+  static size_t buffer_size(FramebufferFormat format, int width, int height) {
+    return (static_cast<size_t>(width) * height * format + 7) / 8;
+  }
+
+  /** Attach to a buffer of at least buffer_size() bytes.
+   *
+   * @param palette 2^bits RGB888 entries (may be in PROGMEM), only used for the indexed formats.
+   */
+  void init(uint8_t *buffer, FramebufferFormat format, int width, int height, const uint8_t *palette = nullptr);
+
+  FramebufferFormat get_format() const { return this->format_; }
+  bool is_indexed() const { return this->format_ != FRAMEBUFFER_RGB565; }
+
+  /// Set a pixel, coordinates must be inside the buffer. Returns true if the stored value changed.
+  bool set_pixel(int x, int y, Color color) { return this->set_raw_(this->pixel_pos_(x, y), this->encode(color)); }
+  /// Set width pixels of a row starting at (x, y). Returns true if any stored value changed.
+  bool fill_span(int x, int y, int width, Color color);
+  void fill(Color color);
+
+  /// Value stored for a color: a palette index or an RGB565 value.
+  uint16_t encode(Color color);
+  /// The color stored at a pixel position (y * width + x), as RGB565.
+  uint16_t get_rgb565(size_t pos) const {
+    uint16_t raw = this->get_raw_(pos);
+    return this->is_indexed() ? this->palette_565_[raw] : raw;
+  }
+
+ protected:
+  size_t pixel_pos_(int x, int y) const { return static_cast<size_t>(y) * this->width_ + x; }
+  uint16_t get_raw_(size_t pos) const;
+  bool set_raw_(size_t pos, uint16_t value);
+
+  uint8_t *buffer_{nullptr};
+  FramebufferFormat format_{FRAMEBUFFER_RGB565};
+  int width_{0};
+  int height_{0};
+  const uint8_t *palette_{nullptr};
+  std::vector<uint16_t> palette_565_;
+  /// Finding the closest palette entry searches the whole palette, drawing usually repeats the same color.
+  Color last_color_{};
+  uint16_t last_value_{0};
+  bool last_valid_{false};
+};
+
+}  // namespace display
+}  // namespace esphome
@@ -13,7 +13,9 @@ namespace dsmr {
 static const char *const TAG = "dsmr";
 
 void Dsmr::setup() {
-  this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
+  // Encrypted telegrams are decrypted in place, they don't need a second buffer
+  if (this->decryption_key_.empty() && this->telegram_ == nullptr)
+    this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
   if (this->request_pin_ != nullptr) {
     this->request_pin_->setup();
   }
@@ -234,35 +236,37 @@ void Dsmr::receive_encrypted_telegram_() {
       this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
     constexpr uint16_t iv_size{12};
     gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
+    // the ciphertext starts at byte 18, it is decrypted in place
+    uint8_t *plaintext = &this->crypt_telegram_[18];
+    const size_t cipher_size = this->crypt_bytes_read_ - 18;
+    gcmaes128->decrypt(plaintext, plaintext, cipher_size);
     delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
 
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
+    const char *telegram = reinterpret_cast<const char *>(plaintext);
+    const size_t telegram_len = strnlen(telegram, cipher_size);
+    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", telegram_len);
+    ESP_LOGVV(TAG, "Decrypted telegram: %.*s", (int) telegram_len, telegram);
 
     // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
+    this->parse_telegram_(telegram, telegram_len);
     this->reset_telegram_();
     return;
   }
 }
 
-bool Dsmr::parse_telegram() {
+bool Dsmr::parse_telegram() { return this->parse_telegram_(this->telegram_, this->bytes_read_); }
+
+bool Dsmr::parse_telegram_(const char *telegram, size_t length) {
   MyData data;
   ESP_LOGV(TAG, "Trying to parse telegram");
   this->stop_requesting_data_();
 
   ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
+      ::dsmr::P1Parser::parse(&data, telegram, length, false,
                               this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
   if (res.err) {
     // Parsing error, show it
-    auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
+    auto err_str = res.fullError(telegram, telegram + length);
     ESP_LOGE(TAG, "%s", err_str.c_str());
     return false;
   } else {
@@ -271,7 +275,7 @@ bool Dsmr::parse_telegram() {
 
     // publish the telegram, after publishing the sensors so it can also trigger action based on latest values
     if (this->s_telegram_ != nullptr) {
-      this->s_telegram_->publish_state(std::string(this->telegram_, this->bytes_read_));
+      this->s_telegram_->publish_state(std::string(telegram, length));
     }
     return true;
   }
@@ -303,6 +307,8 @@ void Dsmr::set_decryption_key(const std::string &decryption_key) {
       delete[] this->crypt_telegram_;
       this->crypt_telegram_ = nullptr;
     }
+    if (this->telegram_ == nullptr)
+      this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
     return;
   }
 
@@ -92,6 +92,7 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_telegram_();
   void receive_encrypted_telegram_();
   void reset_telegram_();
+  bool parse_telegram_(const char *telegram, size_t length);
 
   /// Wait for UART data to become available within the read timeout.
   ///
@@ -118,6 +119,7 @@ class Dsmr : public Component, public uart::UARTDevice {
   uint32_t receive_timeout_;
   bool receive_timeout_reached_();
   size_t max_telegram_len_;
+  /// Unencrypted telegrams only, encrypted ones are decrypted in crypt_telegram_
   char *telegram_{nullptr};
   size_t bytes_read_{0};
   uint8_t *crypt_telegram_{nullptr};
@@ -1,6 +1,7 @@
 #include "e131.h"
 #ifdef USE_NETWORK
 #include "e131_addressable_light_effect.h"
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -8,6 +9,8 @@ namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+/// Upper bound of packets read per loop, so a flood can't starve the other components
+static const int MAX_PACKETS_PER_LOOP = 32;
 
 E131Component::E131Component() {}
 
@@ -53,29 +56,90 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
   uint8_t buf[1460];
+  bool received = false;
+
+  // drain what lwIP queued since the last loop, packets of many universes usually arrive in bursts
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP && this->socket_->ready(); i++) {
+    ssize_t len = this->socket_->read(buf, sizeof(buf));
+    if (len <= 0)
+      break;
+    if (!this->packet_(buf, len, universe, packet)) {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+      continue;
+    }
+    LockGuard guard{this->lock_};
+    this->receive_(universe, packet);
+    received = true;
+  }
+  if (!received)
+    return;
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
+#ifdef USE_LOOP_TASKS
+  // The lights belong to the main loop, a loop task only decodes the packets
+  if (!App.in_main_loop()) {
+    LockGuard guard{this->lock_};
+    if (!this->show_deferred_) {
+      this->show_deferred_ = true;
+      App.defer_to_main_loop([this]() { this->show_pending_(); });
+    }
     return;
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
+#endif
+  this->show_pending_();
+}
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
+void E131Component::show_pending_() {
+  LockGuard guard{this->lock_};
+  this->show_deferred_ = false;
+  // show only the newest packet of each universe
+  for (auto &it : this->universes_) {
+    if (!it.second.pending)
+      continue;
+    it.second.pending = false;
+    if (!this->process_(it.first, it.second.packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", it.first, it.second.packet.count);
+    }
   }
+}
 
-  if (!this->process_(universe, packet)) {
+void E131Component::receive_(int universe, const E131Packet &packet) {
+  auto consumers = this->universe_consumers_.find(universe);
+  if (consumers == this->universe_consumers_.end() || consumers->second == 0) {
     ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+    return;
+  }
+  auto &state = this->universes_[universe];
+  if (state.stats.received > 0) {
+    // E1.31 section 6.7.2: a sequence number up to 20 behind the last one is an out of order packet
+    int8_t diff = int8_t(packet.sequence - state.packet.sequence);
+    if (diff <= 0 && diff > -20) {
+      state.stats.lost++;
+      return;
+    }
+    if (diff > 1) {
+      state.stats.lost += diff - 1;
+      ESP_LOGV(TAG, "Lost %d packets of %d universe.", diff - 1, universe);
+    }
   }
+  if (state.pending)
+    state.stats.superseded++;
+  state.stats.received++;
+  state.packet = packet;
+  state.pending = true;
+}
+
+const E131UniverseStats *E131Component::get_universe_stats(int universe) const {
+  auto it = this->universes_.find(universe);
+  if (it == this->universes_.end())
+    return nullptr;
+  return &it->second.stats;
 }
 
 void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
+  LockGuard guard{this->lock_};
   if (light_effects_.count(light_effect)) {
     return;
   }
@@ -91,6 +155,7 @@ void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
 }
 
 void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
+  LockGuard guard{this->lock_};
   if (!light_effects_.count(light_effect)) {
     return;
   }
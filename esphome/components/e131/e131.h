@@ -3,6 +3,7 @@
 #ifdef USE_NETWORK
 #include "esphome/components/socket/socket.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 
 #include <cinttypes>
 #include <map>
@@ -20,10 +21,20 @@ enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
+  uint8_t sequence;
   uint16_t count;
   uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
 };
 
+struct E131UniverseStats {
+  /// Valid packets received
+  uint32_t received{0};
+  /// Packets missing in the sequence numbers, or arriving out of order and discarded
+  uint32_t lost{0};
+  /// Packets that were replaced by a newer one of the same universe before they were shown
+  uint32_t superseded{0};
+};
+
 class E131Component : public esphome::Component {
  public:
   E131Component();
@@ -38,8 +49,20 @@ class E131Component : public esphome::Component {
 
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
+  /// Counters of a universe, nullptr if nothing was received for it yet.
+  const E131UniverseStats *get_universe_stats(int universe) const;
+
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  struct UniverseState {
+    E131Packet packet;
+    bool pending{false};
+    E131UniverseStats stats;
+  };
+
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  void receive_(int universe, const E131Packet &packet);
+  /// Show the newest packet of every universe that received one.
+  void show_pending_();
   bool process_(int universe, const E131Packet &packet);
   bool join_igmp_groups_();
   void join_(int universe);
@@ -49,7 +72,10 @@ class E131Component : public esphome::Component {
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  std::map<int, UniverseState> universes_;
+  /// Guards the universes, as packets may be received in a loop task while the main loop shows them
+  Mutex lock_;
+  bool show_deferred_{false};
 };
 
 }  // namespace e131
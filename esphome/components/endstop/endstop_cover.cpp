@@ -2,6 +2,9 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace esphome {
 namespace endstop {
 
@@ -60,46 +63,60 @@ void EndstopCover::setup() {
   } else if (!restore.has_value()) {
     this->position = 0.5f;
   }
+
+  this->open_endstop_->add_on_state_callback([this](bool state) {
+    if (state)
+      this->endstop_reached_(COVER_OPERATION_OPENING);
+  });
+  this->close_endstop_->add_on_state_callback([this](bool state) {
+    if (state)
+      this->endstop_reached_(COVER_OPERATION_CLOSING);
+  });
 }
-void EndstopCover::loop() {
-  if (this->current_operation == COVER_OPERATION_IDLE)
+void EndstopCover::endstop_reached_(CoverOperation dir) {
+  if (this->current_operation != dir)
     return;
-
-  const uint32_t now = millis();
-
-  if (this->current_operation == COVER_OPERATION_OPENING && this->is_open_()) {
-    float dur = (now - this->start_dir_time_) / 1e3f;
+  float dur = (millis() - this->start_dir_time_) / 1e3f;
+  if (dir == COVER_OPERATION_OPENING) {
     ESP_LOGD(TAG, "'%s' - Open endstop reached. Took %.1fs.", this->name_.c_str(), dur);
-
-    this->start_direction_(COVER_OPERATION_IDLE);
-    this->position = COVER_OPEN;
-    this->publish_state();
-  } else if (this->current_operation == COVER_OPERATION_CLOSING && this->is_closed_()) {
-    float dur = (now - this->start_dir_time_) / 1e3f;
+  } else {
     ESP_LOGD(TAG, "'%s' - Close endstop reached. Took %.1fs.", this->name_.c_str(), dur);
-
-    this->start_direction_(COVER_OPERATION_IDLE);
-    this->position = COVER_CLOSED;
-    this->publish_state();
-  } else if (now - this->start_dir_time_ > this->max_duration_) {
-    ESP_LOGD(TAG, "'%s' - Max duration reached. Stopping cover.", this->name_.c_str());
-    this->start_direction_(COVER_OPERATION_IDLE);
-    this->publish_state();
   }
 
-  // Recompute position every loop cycle
+  this->start_direction_(COVER_OPERATION_IDLE);
+  this->position = dir == COVER_OPERATION_OPENING ? COVER_OPEN : COVER_CLOSED;
+  this->publish_state();
+}
+void EndstopCover::schedule_deadline_() {
   this->recompute_position_();
-
-  if (this->current_operation != COVER_OPERATION_IDLE && this->is_at_target_()) {
-    this->start_direction_(COVER_OPERATION_IDLE);
-    this->publish_state();
+  const bool opening = this->current_operation == COVER_OPERATION_OPENING;
+  const uint32_t elapsed = millis() - this->start_dir_time_;
+  uint32_t remaining = this->max_duration_ > elapsed ? this->max_duration_ - elapsed : 0;
+  if (opening ? this->is_open_() : this->is_closed_()) {
+    remaining = 0;
+  } else if (this->target_position_ != COVER_OPEN && this->target_position_ != COVER_CLOSED) {
+    // Fully open or closed is only reached at the endstops, other targets are timed
+    const float distance = opening ? this->target_position_ - this->position : this->position - this->target_position_;
+    const uint32_t duration = opening ? this->open_duration_ : this->close_duration_;
+    const uint32_t travel = distance > 0.0f ? static_cast<uint32_t>(std::ceil(distance * duration)) : 0;
+    remaining = std::min(remaining, travel);
   }
-
-  // Send current position every second
-  if (this->current_operation != COVER_OPERATION_IDLE && now - this->last_publish_time_ > 1000) {
-    this->publish_state(false);
-    this->last_publish_time_ = now;
+  // At UINT32_MAX (no max duration while going to an endstop), no timeout is scheduled
+  this->set_timeout("deadline", remaining, [this]() { this->deadline_reached_(); });
+}
+void EndstopCover::deadline_reached_() {
+  if (this->current_operation == COVER_OPERATION_OPENING && this->is_open_()) {
+    this->endstop_reached_(COVER_OPERATION_OPENING);
+    return;
   }
+  if (this->current_operation == COVER_OPERATION_CLOSING && this->is_closed_()) {
+    this->endstop_reached_(COVER_OPERATION_CLOSING);
+    return;
+  }
+  if (millis() - this->start_dir_time_ >= this->max_duration_)
+    ESP_LOGD(TAG, "'%s' - Max duration reached. Stopping cover.", this->name_.c_str());
+  this->start_direction_(COVER_OPERATION_IDLE);
+  this->publish_state();
 }
 void EndstopCover::dump_config() {
   LOG_COVER("", "Endstop Cover", this);
@@ -115,24 +132,13 @@ void EndstopCover::stop_prev_trigger_() {
     this->prev_command_trigger_ = nullptr;
   }
 }
-bool EndstopCover::is_at_target_() const {
-  switch (this->current_operation) {
-    case COVER_OPERATION_OPENING:
-      if (this->target_position_ == COVER_OPEN)
-        return this->is_open_();
-      return this->position >= this->target_position_;
-    case COVER_OPERATION_CLOSING:
-      if (this->target_position_ == COVER_CLOSED)
-        return this->is_closed_();
-      return this->position <= this->target_position_;
-    case COVER_OPERATION_IDLE:
-    default:
-      return true;
-  }
-}
 void EndstopCover::start_direction_(CoverOperation dir) {
-  if (dir == this->current_operation)
+  if (dir == this->current_operation) {
+    // The target may have changed
+    if (dir != COVER_OPERATION_IDLE)
+      this->schedule_deadline_();
     return;
+  }
 
   this->recompute_position_();
   Trigger<> *trig;
@@ -161,6 +167,18 @@ void EndstopCover::start_direction_(CoverOperation dir) {
   const uint32_t now = millis();
   this->start_dir_time_ = now;
   this->last_recompute_time_ = now;
+
+  if (dir == COVER_OPERATION_IDLE) {
+    this->cancel_timeout("deadline");
+    this->cancel_interval("publish");
+    return;
+  }
+  this->schedule_deadline_();
+  // Send current position every second
+  this->set_interval("publish", 1000, [this]() {
+    this->recompute_position_();
+    this->publish_state(false);
+  });
 }
 void EndstopCover::recompute_position_() {
   if (this->current_operation == COVER_OPERATION_IDLE)
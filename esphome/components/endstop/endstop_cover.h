@@ -11,7 +11,6 @@ namespace endstop {
 class EndstopCover : public cover::Cover, public Component {
  public:
   void setup() override;
-  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override;
 
@@ -31,9 +30,13 @@ class EndstopCover : public cover::Cover, public Component {
   void stop_prev_trigger_();
   bool is_open_() const { return this->open_endstop_->state; }
   bool is_closed_() const { return this->close_endstop_->state; }
-  bool is_at_target_() const;
 
   void start_direction_(cover::CoverOperation dir);
+  /// Reacts to the endstop of the current direction, fed by the state callbacks of the endstops.
+  void endstop_reached_(cover::CoverOperation dir);
+  /// (Re)starts the timeout stopping the cover at a timed target or the max duration.
+  void schedule_deadline_();
+  void deadline_reached_();
 
   void recompute_position_();
 
@@ -49,7 +52,6 @@ class EndstopCover : public cover::Cover, public Component {
   Trigger<> *prev_command_trigger_{nullptr};
   uint32_t last_recompute_time_{0};
   uint32_t start_dir_time_{0};
-  uint32_t last_publish_time_{0};
   float target_position_{0};
   cover::CoverOperation last_operation_{cover::COVER_OPERATION_OPENING};
 };
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include <driver/pcnt.h>
+
+namespace esphome {
+namespace esp32 {
+
+/// Hand out the PCNT units, shared by all components counting in hardware.
+/// @return Whether a unit was left.
+inline bool allocate_pcnt_unit(pcnt_unit_t *unit) {
+  static int next_unit = PCNT_UNIT_0;
+  if (next_unit >= PCNT_UNIT_MAX)
+    return false;
+  *unit = pcnt_unit_t(next_unit++);
+  return true;
+}
+
+}  // namespace esp32
+}  // namespace esphome
+
+#endif
@@ -3,6 +3,7 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <esp_rom_crc.h>
 #include <nvs_flash.h>
 #include <cstring>
 #include <cinttypes>
@@ -14,49 +15,60 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
-struct NVSData {
-  std::string key;
-  std::vector<uint8_t> data;
-};
+class ESP32PreferenceBackend;
 
-static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+/// Backends with data waiting for the next sync(), each backend is in here at most once.
+static std::vector<ESP32PreferenceBackend *> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static uint32_t pref_crc32(const uint8_t *data, size_t len) { return esp_rom_crc32_le(0, data, len); }
 
 class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
   std::string key;
   uint32_t nvs_handle;
+  /// Data waiting to be written, only valid while pending is set.
+  std::vector<uint8_t> data;
+  bool pending{false};
+  /// Whether the CRC and length of what is stored in NVS are known, from a load or a previous write.
+  bool stored_known{false};
+  bool stored_present{false};
+  uint32_t stored_crc{0};
+  size_t stored_len{0};
+  /// Wear statistics since boot
+  uint32_t write_count{0};
+  uint32_t bytes_written{0};
+
   bool save(const uint8_t *data, size_t len) override {
-    // try find in pending saves and update that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        obj.data.assign(data, data + len);
-        return true;
-      }
+    if (!this->pending && this->matches_stored(data, len)) {
+      ESP_LOGVV(TAG, "save: key: %s, unchanged", key.c_str());
+      return true;
+    }
+    this->data.assign(data, data + len);
+    if (!this->pending) {
+      this->pending = true;
+      s_pending_save.push_back(this);
     }
-    NVSData save{};
-    save.key = key;
-    save.data.assign(data, data + len);
-    s_pending_save.emplace_back(save);
     ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %d", key.c_str(), len);
     return true;
   }
   bool load(uint8_t *data, size_t len) override {
-    // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
+    if (this->pending) {
+      if (this->data.size() != len) {
+        // size mismatch
+        return false;
       }
+      memcpy(data, this->data.data(), len);
+      return true;
     }
 
     size_t actual_len;
     esp_err_t err = nvs_get_blob(nvs_handle, key.c_str(), nullptr, &actual_len);
     if (err != 0) {
       ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", key.c_str(), esp_err_to_name(err));
+      if (err == ESP_ERR_NVS_NOT_FOUND) {
+        this->stored_known = true;
+        this->stored_present = false;
+      }
       return false;
     }
     if (actual_len != len) {
@@ -70,8 +82,20 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
     } else {
       ESP_LOGVV(TAG, "nvs_get_blob: key: %s, len: %d", key.c_str(), len);
     }
+    this->set_stored(data, len);
     return true;
   }
+
+  bool matches_stored(const uint8_t *data, size_t len) const {
+    return this->stored_known && this->stored_present && this->stored_len == len &&
+           this->stored_crc == pref_crc32(data, len);
+  }
+  void set_stored(const uint8_t *data, size_t len) {
+    this->stored_known = true;
+    this->stored_present = true;
+    this->stored_len = len;
+    this->stored_crc = pref_crc32(data, len);
+  }
 };
 
 class ESP32Preferences : public ESPPreferences {
@@ -119,24 +143,31 @@ class ESP32Preferences : public ESPPreferences {
 
     // go through vector from back to front (makes erase easier/more efficient)
     for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
-      if (is_changed(nvs_handle, save)) {
-        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
+      auto *save = s_pending_save[i];
+      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save->key.c_str());
+      if (is_changed(nvs_handle, *save)) {
+        esp_err_t err = nvs_set_blob(nvs_handle, save->key.c_str(), save->data.data(), save->data.size());
+        ESP_LOGV(TAG, "sync: key: %s, len: %d", save->key.c_str(), save->data.size());
         if (err != 0) {
-          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
+          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save->key.c_str(), save->data.size(),
                    esp_err_to_name(err));
           failed++;
           last_err = err;
-          last_key = save.key;
+          last_key = save->key;
           continue;
         }
+        save->set_stored(save->data.data(), save->data.size());
+        save->write_count++;
+        save->bytes_written += save->data.size();
+        ESP_LOGD(TAG, "Wrote key %s: %" PRIu32 " writes, %" PRIu32 " bytes since boot", save->key.c_str(),
+                 save->write_count, save->bytes_written);
         written++;
       } else {
-        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
+        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save->key.c_str(), save->data.size());
         cached++;
       }
+      save->pending = false;
+      save->data.clear();
       s_pending_save.erase(s_pending_save.begin() + i);
     }
     ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed", cached + written + failed, cached,
@@ -145,8 +176,10 @@ class ESP32Preferences : public ESPPreferences {
       ESP_LOGE(TAG, "Error saving %d preferences to flash. Last error=%s for key=%s", failed, esp_err_to_name(last_err),
                last_key.c_str());
     }
+    if (written == 0)
+      return failed == 0;
 
-    // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
+    // all keys written above go out with a single commit
     esp_err_t err = nvs_commit(nvs_handle);
     if (err != 0) {
       ESP_LOGV(TAG, "nvs_commit() failed: %s", esp_err_to_name(err));
@@ -155,25 +188,35 @@ class ESP32Preferences : public ESPPreferences {
 
     return failed == 0;
   }
-  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
-    NVSData stored_data{};
+  bool is_changed(const uint32_t nvs_handle, const ESP32PreferenceBackend &to_save) {
+    if (to_save.stored_known) {
+      // compare against the CRC of what was last loaded or written instead of reading the blob back
+      if (!to_save.stored_present)
+        return true;
+      return !to_save.matches_stored(to_save.data.data(), to_save.data.size());
+    }
+    std::vector<uint8_t> stored_data;
     size_t actual_len;
     esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
     if (err != 0) {
       ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
       return true;
     }
-    stored_data.data.resize(actual_len);
-    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.data.data(), &actual_len);
+    stored_data.resize(actual_len);
+    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.data(), &actual_len);
     if (err != 0) {
       ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
       return true;
     }
-    return to_save.data != stored_data.data;
+    return to_save.data != stored_data;
   }
 
   bool reset() override {
     ESP_LOGD(TAG, "Cleaning up preferences in flash...");
+    for (auto *save : s_pending_save) {
+      save->pending = false;
+      save->data.clear();
+    }
     s_pending_save.clear();
 
     nvs_flash_deinit();
@@ -4,6 +4,8 @@
 
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 #ifdef USE_ESP32
 
 namespace esphome {
@@ -12,6 +14,8 @@ namespace esp32_ble_server {
 static const char *const TAG = "esp32_ble_server.characteristic";
 
 BLECharacteristic::~BLECharacteristic() {
+  if (!this->pending_notifications_.empty())
+    this->service_->get_server()->cancel_notifications(this);
   for (auto *descriptor : this->descriptors_) {
     delete descriptor;  // NOLINT(cppcoreguidelines-owning-memory)
   }
@@ -35,13 +39,29 @@ BLECharacteristic::BLECharacteristic(const ESPBTUUID uuid, uint32_t properties)
 void BLECharacteristic::set_value(std::vector<uint8_t> value) {
   xSemaphoreTake(this->set_value_lock_, 0L);
   this->value_ = std::move(value);
+  this->external_value_ = nullptr;
   xSemaphoreGive(this->set_value_lock_);
 }
 void BLECharacteristic::set_value(const std::string &value) {
-  this->set_value(std::vector<uint8_t>(value.begin(), value.end()));
+  this->set_value(reinterpret_cast<const uint8_t *>(value.data()), value.size());
 }
 void BLECharacteristic::set_value(const uint8_t *data, size_t length) {
-  this->set_value(std::vector<uint8_t>(data, data + length));
+  // Reuses the storage of the previous value
+  xSemaphoreTake(this->set_value_lock_, 0L);
+  this->value_.assign(data, data + length);
+  this->external_value_ = nullptr;
+  xSemaphoreGive(this->set_value_lock_);
+}
+void BLECharacteristic::set_external_value(const uint8_t *data, size_t length) {
+  xSemaphoreTake(this->set_value_lock_, 0L);
+  this->value_.clear();
+  this->external_value_ = data;
+  this->external_length_ = length;
+  xSemaphoreGive(this->set_value_lock_);
+}
+void BLECharacteristic::own_value_() {
+  if (this->external_value_ != nullptr)
+    this->set_value(this->external_value_, this->external_length_);
 }
 void BLECharacteristic::set_value(uint8_t &data) {
   uint8_t temp[1];
@@ -89,18 +109,58 @@ void BLECharacteristic::notify(bool notification) {
     ESP_LOGW(TAG, "notification=false is not yet supported");
     // TODO: Handle when notification=false
   }
-  if (this->service_->get_server()->get_connected_client_count() == 0)
+  BLEServer *server = this->service_->get_server();
+  if (server->get_connected_client_count() == 0)
     return;
 
-  for (auto &client : this->service_->get_server()->get_clients()) {
-    size_t length = this->value_.size();
-    esp_err_t err = esp_ble_gatts_send_indicate(this->service_->get_server()->get_gatts_if(), client.first,
-                                                this->handle_, length, this->value_.data(), false);
-    if (err != ESP_OK) {
-      ESP_LOGE(TAG, "esp_ble_gatts_send_indicate failed %d", err);
-      return;
+  for (auto &client : server->get_clients()) {
+    auto it = std::find_if(this->pending_notifications_.begin(), this->pending_notifications_.end(),
+                           [&client](const PendingNotification &pending) { return pending.conn_id == client.first; });
+    if (it != this->pending_notifications_.end()) {
+      it->offset = 0;
+    } else {
+      this->pending_notifications_.push_back(PendingNotification{client.first, 0});
+    }
+  }
+  if (!this->send_notifications())
+    server->schedule_notifications(this);
+}
+
+bool BLECharacteristic::send_notifications() {
+  BLEServer *server = this->service_->get_server();
+  const uint8_t *data = this->value_data_();
+  const size_t size = this->value_size_();
+  auto it = this->pending_notifications_.begin();
+  while (it != this->pending_notifications_.end()) {
+    // Disconnected, or the value was replaced by a shorter one
+    if (!server->has_client(it->conn_id) || it->offset > size) {
+      it = this->pending_notifications_.erase(it);
+      continue;
+    }
+    const size_t payload = server->get_client_mtu(it->conn_id) - 3;
+    bool done = false;
+    while (!server->is_client_congested(it->conn_id)) {
+      const size_t length = std::min(size - it->offset, payload);
+      esp_err_t err = esp_ble_gatts_send_indicate(server->get_gatts_if(), it->conn_id, this->handle_, length,
+                                                  const_cast<uint8_t *>(data + it->offset), false);
+      if (err != ESP_OK) {
+        // Out of buffers, retried from the loop of the server
+        ESP_LOGV(TAG, "esp_ble_gatts_send_indicate failed %d", err);
+        break;
+      }
+      it->offset += length;
+      if (it->offset >= size) {
+        done = true;
+        break;
+      }
+    }
+    if (done) {
+      it = this->pending_notifications_.erase(it);
+    } else {
+      ++it;
     }
   }
+  return this->pending_notifications_.empty();
 }
 
 void BLECharacteristic::add_descriptor(BLEDescriptor *descriptor) { this->descriptors_.push_back(descriptor); }
@@ -223,31 +283,36 @@ void BLECharacteristic::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt
       if (!param->read.need_rsp)
         break;  // For some reason you can request a read but not want a response
 
-      uint16_t max_offset = 22;
+      // The longest response that fits into the MTU of the client
+      uint16_t max_offset =
+          std::min<uint16_t>(this->service_->get_server()->get_client_mtu(param->read.conn_id) - 1,
+                             ESP_GATT_MAX_ATTR_LEN);
 
+      const uint8_t *value = this->value_data_();
+      const size_t value_size = this->value_size_();
       esp_gatt_rsp_t response;
       if (param->read.is_long) {
-        if (this->value_.size() - this->value_read_offset_ < max_offset) {
+        if (value_size - this->value_read_offset_ < max_offset) {
           //  Last message in the chain
-          response.attr_value.len = this->value_.size() - this->value_read_offset_;
+          response.attr_value.len = value_size - this->value_read_offset_;
           response.attr_value.offset = this->value_read_offset_;
-          memcpy(response.attr_value.value, this->value_.data() + response.attr_value.offset, response.attr_value.len);
+          memcpy(response.attr_value.value, value + response.attr_value.offset, response.attr_value.len);
           this->value_read_offset_ = 0;
         } else {
           response.attr_value.len = max_offset;
           response.attr_value.offset = this->value_read_offset_;
-          memcpy(response.attr_value.value, this->value_.data() + response.attr_value.offset, response.attr_value.len);
+          memcpy(response.attr_value.value, value + response.attr_value.offset, response.attr_value.len);
           this->value_read_offset_ += max_offset;
         }
       } else {
         response.attr_value.offset = 0;
-        if (this->value_.size() + 1 > max_offset) {
+        if (value_size + 1 > max_offset) {
           response.attr_value.len = max_offset;
           this->value_read_offset_ = max_offset;
         } else {
-          response.attr_value.len = this->value_.size();
+          response.attr_value.len = value_size;
         }
-        memcpy(response.attr_value.value, this->value_.data(), response.attr_value.len);
+        memcpy(response.attr_value.value, value, response.attr_value.len);
       }
 
       response.attr_value.handle = this->handle_;
@@ -265,6 +330,7 @@ void BLECharacteristic::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt
         return;
 
       if (param->write.is_prep) {
+        this->own_value_();
         this->value_.insert(this->value_.end(), param->write.value, param->write.value + param->write.len);
         this->write_event_ = true;
       } else {
@@ -37,6 +37,12 @@ class BLECharacteristic {
   void set_value(float &data);
   void set_value(double &data);
   void set_value(bool &data);
+  /** Serve reads and notifications straight from `data`, without copying it.
+   *
+   * The buffer is owned by the caller and has to stay valid and unchanged until the next set_value() or until the
+   * queued notifications went out. Writes from a client and get_value() switch back to an owned copy.
+   */
+  void set_external_value(const uint8_t *data, size_t length);
 
   void set_broadcast_property(bool value);
   void set_indicate_property(bool value);
@@ -45,7 +51,16 @@ class BLECharacteristic {
   void set_write_property(bool value);
   void set_write_no_response_property(bool value);
 
+  /** Queue a notification of the current value to every connected client.
+   *
+   * Values longer than the MTU of a client are split into notifications of `mtu - 3` bytes. What the stack can't take
+   * right away, or while a client is congested, is sent from the loop() of the server. A new notify() restarts the
+   * transfer of a client that is still pending, so only the newest value goes out.
+   */
   void notify(bool notification = true);
+  /// Send as much of the queued notifications as the clients take.
+  /// @return Whether nothing is left to send.
+  bool send_notifications();
 
   void do_create(BLEService *service);
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t *param);
@@ -57,7 +72,10 @@ class BLECharacteristic {
 
   BLEService *get_service() { return this->service_; }
   ESPBTUUID get_uuid() { return this->uuid_; }
-  std::vector<uint8_t> &get_value() { return this->value_; }
+  std::vector<uint8_t> &get_value() {
+    this->own_value_();
+    return this->value_;
+  }
 
   static const uint32_t PROPERTY_READ = 1 << 0;
   static const uint32_t PROPERTY_WRITE = 1 << 1;
@@ -70,16 +88,36 @@ class BLECharacteristic {
   bool is_failed();
 
  protected:
+  /// Notification of a client still in progress
+  struct PendingNotification {
+    uint16_t conn_id;
+    /// Bytes of the value already sent
+    uint16_t offset;
+  };
+
+  const uint8_t *value_data_() const {
+    return this->external_value_ != nullptr ? this->external_value_ : this->value_.data();
+  }
+  size_t value_size_() const {
+    return this->external_value_ != nullptr ? this->external_length_ : this->value_.size();
+  }
+  /// Copy an external value to `value_`.
+  void own_value_();
+
   bool write_event_{false};
-  BLEService *service_;
+  BLEService *service_{nullptr};
   ESPBTUUID uuid_;
   esp_gatt_char_prop_t properties_;
   uint16_t handle_{0xFFFF};
 
   uint16_t value_read_offset_{0};
   std::vector<uint8_t> value_;
+  const uint8_t *external_value_{nullptr};
+  size_t external_length_{0};
   SemaphoreHandle_t set_value_lock_;
 
+  std::vector<PendingNotification> pending_notifications_;
+
   std::vector<BLEDescriptor *> descriptors_;
 
   std::function<void(const std::vector<uint8_t> &)> on_write_;
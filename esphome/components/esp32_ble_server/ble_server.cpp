@@ -5,6 +5,8 @@
 #include "esphome/core/application.h"
 #include "esphome/core/version.h"
 
+#include <algorithm>
+
 #ifdef USE_ESP32
 
 #include <nvs_flash.h>
@@ -38,8 +40,18 @@ void BLEServer::loop() {
     return;
   }
   switch (this->state_) {
-    case RUNNING:
+    case RUNNING: {
+      // Whatever the stack couldn't take before, or while a client was congested
+      auto it = this->pending_notifications_.begin();
+      while (it != this->pending_notifications_.end()) {
+        if ((*it)->send_notifications()) {
+          it = this->pending_notifications_.erase(it);
+        } else {
+          ++it;
+        }
+      }
       return;
+    }
 
     case INIT: {
       esp_err_t err = esp_ble_gatts_app_register(0);
@@ -83,6 +95,28 @@ void BLEServer::loop() {
   }
 }
 
+uint16_t BLEServer::get_client_mtu(uint16_t conn_id) {
+  auto it = this->clients_.find(conn_id);
+  return it == this->clients_.end() ? 23 : it->second.mtu;
+}
+
+bool BLEServer::is_client_congested(uint16_t conn_id) {
+  auto it = this->clients_.find(conn_id);
+  return it != this->clients_.end() && it->second.congested;
+}
+
+void BLEServer::schedule_notifications(BLECharacteristic *characteristic) {
+  if (std::find(this->pending_notifications_.begin(), this->pending_notifications_.end(), characteristic) ==
+      this->pending_notifications_.end())
+    this->pending_notifications_.push_back(characteristic);
+}
+
+void BLEServer::cancel_notifications(BLECharacteristic *characteristic) {
+  this->pending_notifications_.erase(
+      std::remove(this->pending_notifications_.begin(), this->pending_notifications_.end(), characteristic),
+      this->pending_notifications_.end());
+}
+
 bool BLEServer::is_running() { return this->parent_->is_active() && this->state_ == RUNNING; }
 
 bool BLEServer::can_proceed() { return this->is_running() || !this->parent_->is_active(); }
@@ -153,7 +187,7 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
   switch (event) {
     case ESP_GATTS_CONNECT_EVT: {
       ESP_LOGD(TAG, "BLE Client connected");
-      this->add_client_(param->connect.conn_id, (void *) this);
+      this->add_client_(param->connect.conn_id);
       this->connected_clients_++;
       for (auto *component : this->service_components_) {
         component->on_client_connect();
@@ -170,6 +204,20 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
       }
       break;
     }
+    case ESP_GATTS_MTU_EVT: {
+      auto it = this->clients_.find(param->mtu.conn_id);
+      if (it != this->clients_.end()) {
+        ESP_LOGD(TAG, "BLE Client MTU: %u", param->mtu.mtu);
+        it->second.mtu = param->mtu.mtu;
+      }
+      break;
+    }
+    case ESP_GATTS_CONGEST_EVT: {
+      auto it = this->clients_.find(param->congest.conn_id);
+      if (it != this->clients_.end())
+        it->second.congested = param->congest.congested;
+      break;
+    }
     case ESP_GATTS_REG_EVT: {
       this->gatts_if_ = gatts_if;
       this->registered_ = true;
@@ -187,6 +235,7 @@ void BLEServer::gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t ga
 void BLEServer::ble_before_disabled_event_handler() {
   // Delete all clients
   this->clients_.clear();
+  this->pending_notifications_.clear();
   // Delete all services
   for (auto &pair : this->services_) {
     pair.second->do_delete();
@@ -33,6 +33,14 @@ class BLEServiceComponent {
   virtual void stop();
 };
 
+/// State of a connected client.
+struct BLEServerClient {
+  /// Negotiated ATT MTU, notifications carry up to `mtu - 3` bytes
+  uint16_t mtu{23};
+  /// Set while the stack can't take more data for this connection
+  bool congested{false};
+};
+
 class BLEServer : public Component, public GATTsEventHandler, public BLEStatusEventHandler, public Parented<ESP32BLE> {
  public:
   void setup() override;
@@ -57,7 +65,14 @@ class BLEServer : public Component, public GATTsEventHandler, public BLEStatusEv
 
   esp_gatt_if_t get_gatts_if() { return this->gatts_if_; }
   uint32_t get_connected_client_count() { return this->connected_clients_; }
-  const std::unordered_map<uint16_t, void *> &get_clients() { return this->clients_; }
+  const std::unordered_map<uint16_t, BLEServerClient> &get_clients() { return this->clients_; }
+  bool has_client(uint16_t conn_id) { return this->clients_.count(conn_id) > 0; }
+  uint16_t get_client_mtu(uint16_t conn_id);
+  bool is_client_congested(uint16_t conn_id);
+
+  /// Have loop() send the queued notifications of `characteristic` until all are out.
+  void schedule_notifications(BLECharacteristic *characteristic);
+  void cancel_notifications(BLECharacteristic *characteristic);
 
   void gatts_event_handler(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if,
                            esp_ble_gatts_cb_param_t *param) override;
@@ -70,7 +85,7 @@ class BLEServer : public Component, public GATTsEventHandler, public BLEStatusEv
   bool create_device_characteristics_();
   void restart_advertising_();
 
-  void add_client_(uint16_t conn_id, void *client) { this->clients_.emplace(conn_id, client); }
+  void add_client_(uint16_t conn_id) { this->clients_.emplace(conn_id, BLEServerClient{}); }
   bool remove_client_(uint16_t conn_id) { return this->clients_.erase(conn_id) > 0; }
 
   std::string manufacturer_;
@@ -80,7 +95,9 @@ class BLEServer : public Component, public GATTsEventHandler, public BLEStatusEv
   bool registered_{false};
 
   uint32_t connected_clients_{0};
-  std::unordered_map<uint16_t, void *> clients_;
+  std::unordered_map<uint16_t, BLEServerClient> clients_;
+  /// Characteristics with notifications still to send
+  std::vector<BLECharacteristic *> pending_notifications_;
   std::unordered_map<std::string, BLEService *> services_;
   BLEService *device_information_service_;
 
@@ -10,7 +10,11 @@ namespace esp32_ble_tracker {
 class ESPBTAdvertiseTrigger : public Trigger<const ESPBTDevice &>, public ESPBTDeviceListener {
  public:
   explicit ESPBTAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_addresses(const std::vector<uint64_t> &addresses) { this->address_vec_ = addresses; }
+  void set_addresses(const std::vector<uint64_t> &addresses) {
+    this->address_vec_ = addresses;
+    for (uint64_t address : addresses)
+      this->add_address_filter(address);
+  }
 
   bool parse_device(const ESPBTDevice &device) override {
     uint64_t u64_addr = device.address_uint64();
@@ -31,8 +35,15 @@ class ESPBTAdvertiseTrigger : public Trigger<const ESPBTDevice &>, public ESPBTD
 class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, public ESPBTDeviceListener {
  public:
   explicit BLEServiceDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_address(uint64_t address) { this->address_ = address; }
-  void set_service_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    if (address)
+      this->add_address_filter(address);
+  }
+  void set_service_uuid16(uint16_t uuid) {
+    this->uuid_ = ESPBTUUID::from_uint16(uuid);
+    this->add_service_data_uuid_filter(uuid);
+  }
   void set_service_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_service_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
 
@@ -57,8 +68,15 @@ class BLEServiceDataAdvertiseTrigger : public Trigger<const adv_data_t &>, publi
 class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>, public ESPBTDeviceListener {
  public:
   explicit BLEManufacturerDataAdvertiseTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
-  void set_address(uint64_t address) { this->address_ = address; }
-  void set_manufacturer_uuid16(uint16_t uuid) { this->uuid_ = ESPBTUUID::from_uint16(uuid); }
+  void set_address(uint64_t address) {
+    this->address_ = address;
+    if (address)
+      this->add_address_filter(address);
+  }
+  void set_manufacturer_uuid16(uint16_t uuid) {
+    this->uuid_ = ESPBTUUID::from_uint16(uuid);
+    this->add_manufacturer_id_filter(uuid);
+  }
   void set_manufacturer_uuid32(uint32_t uuid) { this->uuid_ = ESPBTUUID::from_uint32(uuid); }
   void set_manufacturer_uuid128(uint8_t *uuid) { this->uuid_ = ESPBTUUID::from_raw(uuid); }
 
@@ -82,7 +100,10 @@ class BLEManufacturerDataAdvertiseTrigger : public Trigger<const adv_data_t &>,
 
 class BLEEndOfScanTrigger : public Trigger<>, public ESPBTDeviceListener {
  public:
-  explicit BLEEndOfScanTrigger(ESP32BLETracker *parent) { parent->register_listener(this); }
+  explicit BLEEndOfScanTrigger(ESP32BLETracker *parent) {
+    parent->register_listener(this);
+    this->set_skip_advertisements(true);
+  }
 
   bool parse_device(const ESPBTDevice &device) override { return false; }
   void on_scan_end() override { this->trigger(); }
@@ -56,10 +56,17 @@ void ESP32BLETracker::setup() {
   }
 
   global_esp32_ble_tracker = this;
-  this->scan_result_lock_ = xSemaphoreCreateMutex();
   this->scan_end_lock_ = xSemaphoreCreateMutex();
   this->scanner_idle_ = true;
 
+#ifdef USE_SENSOR
+  if (this->dropped_advertisements_sensor_ != nullptr) {
+    this->set_interval("dropped_advertisements", 60000, [this]() {
+      this->dropped_advertisements_sensor_->publish_state(this->scan_results_dropped_.load());
+    });
+  }
+#endif
+
 #ifdef USE_OTA
   ota::get_global_ota_callback()->add_on_state_callback(
       [this](ota::OTAState state, float progress, uint8_t error, ota::OTAComponent *comp) {
@@ -107,50 +114,8 @@ void ESP32BLETracker::loop() {
   bool promote_to_connecting = discovered && !searching && !connecting;
 
   if (!this->scanner_idle_) {
-    if (this->scan_result_index_ &&  // if it looks like we have a scan result we will take the lock
-        xSemaphoreTake(this->scan_result_lock_, 5L / portTICK_PERIOD_MS)) {
-      uint32_t index = this->scan_result_index_;
-      if (index >= ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE) {
-        ESP_LOGW(TAG, "Too many BLE events to process. Some devices may not show up.");
-      }
-
-      if (this->raw_advertisements_) {
-        for (auto *listener : this->listeners_) {
-          listener->parse_devices(this->scan_result_buffer_, this->scan_result_index_);
-        }
-        for (auto *client : this->clients_) {
-          client->parse_devices(this->scan_result_buffer_, this->scan_result_index_);
-        }
-      }
-
-      if (this->parse_advertisements_) {
-        for (size_t i = 0; i < index; i++) {
-          ESPBTDevice device;
-          device.parse_scan_rst(this->scan_result_buffer_[i]);
-
-          bool found = false;
-          for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
-              found = true;
-          }
-
-          for (auto *client : this->clients_) {
-            if (client->parse_device(device)) {
-              found = true;
-              if (!connecting && client->state() == ClientState::DISCOVERED) {
-                promote_to_connecting = true;
-              }
-            }
-          }
-
-          if (!found && !this->scan_continuous_) {
-            this->print_bt_device_info(device);
-          }
-        }
-      }
-      this->scan_result_index_ = 0;
-      xSemaphoreGive(this->scan_result_lock_);
-    }
+    if (this->process_scan_results_(connecting))
+      promote_to_connecting = true;
 
     /*
 
@@ -385,18 +350,101 @@ void ESP32BLETracker::gap_scan_start_complete_(const esp_ble_gap_cb_param_t::ble
   }
 }
 
+bool ESP32BLETracker::process_scan_results_(int connecting) {
+  uint32_t tail = this->scan_result_tail_.load(std::memory_order_relaxed);
+  uint32_t head = this->scan_result_head_.load(std::memory_order_acquire);
+  if (head == tail)
+    return false;
+
+  uint32_t dropped = this->scan_results_dropped_.load(std::memory_order_relaxed);
+  if (dropped != this->scan_results_dropped_reported_) {
+    ESP_LOGW(TAG, "Too many BLE events to process, %" PRIu32 " advertisements dropped. Some devices may not show up.",
+             dropped - this->scan_results_dropped_reported_);
+    this->scan_results_dropped_reported_ = dropped;
+  }
+
+  bool promote_to_connecting = false;
+  // the ring may wrap, listeners that take raw advertisements get up to two contiguous spans
+  uint32_t start = tail % ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE;
+  uint32_t count = head - tail;
+  uint32_t first = std::min<uint32_t>(count, ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE - start);
+  const std::array<std::pair<uint32_t, uint32_t>, 2> spans{{{start, first}, {0, count - first}}};
+  for (const auto &span : spans) {
+    if (span.second == 0)
+      continue;
+    auto *results = this->scan_result_buffer_ + span.first;
+
+    if (this->raw_advertisements_) {
+      for (auto *listener : this->listeners_) {
+        listener->parse_devices(results, span.second);
+      }
+      for (auto *client : this->clients_) {
+        client->parse_devices(results, span.second);
+      }
+    }
+
+    if (this->parse_advertisements_) {
+      for (size_t i = 0; i < span.second; i++) {
+        const uint64_t address = esp32_ble::ble_addr_to_uint64(results[i].bda);
+        if (!this->wants_advertisement_(results[i], address))
+          continue;
+
+        ESPBTDevice device;
+        device.parse_scan_rst(results[i]);
+
+        bool found = false;
+        for (auto *listener : this->listeners_) {
+          if (listener->matches_advertisement(results[i], address) && listener->parse_device(device))
+            found = true;
+        }
+
+        for (auto *client : this->clients_) {
+          if (client->matches_advertisement(results[i], address) && client->parse_device(device)) {
+            found = true;
+            if (!connecting && client->state() == ClientState::DISCOVERED) {
+              promote_to_connecting = true;
+            }
+          }
+        }
+
+        if (!found && !this->scan_continuous_) {
+          this->print_bt_device_info(device);
+        }
+      }
+    }
+  }
+  this->scan_result_tail_.store(head, std::memory_order_release);
+  return promote_to_connecting;
+}
+
+bool ESP32BLETracker::wants_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param,
+                                           uint64_t address) const {
+  if (!this->scan_continuous_)
+    return true;
+  for (auto *listener : this->listeners_) {
+    if (listener->matches_advertisement(param, address))
+      return true;
+  }
+  for (auto *client : this->clients_) {
+    if (client->matches_advertisement(param, address))
+      return true;
+  }
+  return false;
+}
+
 void ESP32BLETracker::gap_scan_stop_complete_(const esp_ble_gap_cb_param_t::ble_scan_stop_cmpl_evt_param &param) {
   xSemaphoreGive(this->scan_end_lock_);
 }
 
 void ESP32BLETracker::gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
   if (param.search_evt == ESP_GAP_SEARCH_INQ_RES_EVT) {
-    if (xSemaphoreTake(this->scan_result_lock_, 0L)) {
-      if (this->scan_result_index_ < ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE) {
-        this->scan_result_buffer_[this->scan_result_index_++] = param;
-      }
-      xSemaphoreGive(this->scan_result_lock_);
+    uint32_t head = this->scan_result_head_.load(std::memory_order_relaxed);
+    if (head - this->scan_result_tail_.load(std::memory_order_acquire) >= ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE) {
+      this->scan_results_dropped_.fetch_add(1, std::memory_order_relaxed);
+      return;
     }
+    this->scan_result_buffer_[head % ESP32BLETracker::SCAN_RESULT_BUFFER_SIZE] = param;
+    this->scan_result_head_.store(head + 1, std::memory_order_release);
   } else if (param.search_evt == ESP_GAP_SEARCH_INQ_CMPL_EVT) {
     xSemaphoreGive(this->scan_end_lock_);
   }
@@ -660,13 +708,87 @@ void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "  Continuous Scanning: %s", this->scan_continuous_ ? "True" : "False");
 }
 
-void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
-  const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
+bool ESPBTDeviceListener::matches_advertisement(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param,
+                                                uint64_t address) const {
+  if (this->skip_advertisements_)
+    return false;
+  if (!this->filter_addresses_.empty() &&
+      std::find(this->filter_addresses_.begin(), this->filter_addresses_.end(), address) ==
+          this->filter_addresses_.end())
+    return false;
+  if (this->filter_service_data_uuids_.empty() && this->filter_manufacturer_ids_.empty())
+    return true;
+
+  // Walk the advertisement records like ESPBTDevice::parse_adv_() does, without copying anything out
+  bool service_data_match = this->filter_service_data_uuids_.empty();
+  bool manufacturer_match = this->filter_manufacturer_ids_.empty();
+  const uint8_t *payload = param.ble_adv;
+  uint8_t len = param.adv_data_len + param.scan_rsp_len;
+  size_t offset = 0;
+  while (offset + 2 < len) {
+    const uint8_t field_length = payload[offset++];
+    if (field_length == 0)
+      continue;
+    const uint8_t record_type = payload[offset++];
+    const uint8_t *record = &payload[offset];
+    const uint8_t record_length = field_length - 1;
+    offset += record_length;
+    if (record_length < 2)
+      continue;
+
+    const uint16_t id = record[0] | (record[1] << 8);
+    if (record_type == ESP_BLE_AD_TYPE_SERVICE_DATA && !service_data_match) {
+      service_data_match = std::find(this->filter_service_data_uuids_.begin(), this->filter_service_data_uuids_.end(),
+                                     id) != this->filter_service_data_uuids_.end();
+    } else if (record_type == ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE && !manufacturer_match) {
+      manufacturer_match = std::find(this->filter_manufacturer_ids_.begin(), this->filter_manufacturer_ids_.end(),
+                                     id) != this->filter_manufacturer_ids_.end();
+    }
+    if (service_data_match && manufacturer_match)
+      return true;
   }
-  this->already_discovered_.push_back(address);
+  return false;
+}
+
+// Addresses are 48 bits, the top bit marks a used slot so an all zero slot is empty
+static const uint64_t ADDRESS_SET_USED = 1ULL << 63;
+
+size_t RecentAddressSet::find_slot_(const Table &table, uint64_t key) {
+  // Fibonacci hashing, the top bits of the product are the well mixed ones
+  size_t slot = (key * 0x9E3779B97F4A7C15ULL) >> (64 - TABLE_BITS);
+  while (table[slot] != 0 && table[slot] != key)
+    slot = (slot + 1) % TABLE_SIZE;
+  return slot;
+}
+
+void RecentAddressSet::insert_(uint64_t key) {
+  if (this->current_count_ >= TABLE_SIZE * 3 / 4) {
+    this->previous_ = this->current_;
+    this->current_.fill(0);
+    this->current_count_ = 0;
+  }
+  this->current_[find_slot_(this->current_, key)] = key;
+  this->current_count_++;
+}
+
+bool RecentAddressSet::check_and_add(uint64_t address) {
+  uint64_t key = address | ADDRESS_SET_USED;
+  if (this->current_[find_slot_(this->current_, key)] == key)
+    return true;
+  bool known = this->previous_[find_slot_(this->previous_, key)] == key;
+  this->insert_(key);
+  return known;
+}
+
+void RecentAddressSet::clear() {
+  this->current_.fill(0);
+  this->previous_.fill(0);
+  this->current_count_ = 0;
+}
+
+void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
+  if (this->already_discovered_.check_and_add(device.address_uint64()))
+    return;
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
@@ -6,6 +6,7 @@
 #include "esphome/core/helpers.h"
 
 #include <array>
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,10 @@
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+
 namespace esphome {
 namespace esp32_ble_tracker {
 
@@ -129,8 +134,32 @@ class ESPBTDeviceListener {
   };
   void set_parent(ESP32BLETracker *parent) { parent_ = parent; }
 
+  /** Criteria checked against the raw advertisement before it is parsed, see matches_advertisement().
+   *
+   * Listeners that only care about some devices register them here so the tracker can skip parsing the
+   * advertisements nobody wants. parse_device() still has to check the device, this is only a pre-filter.
+   */
+  void add_address_filter(uint64_t address) { this->filter_addresses_.push_back(address); }
+  void add_service_data_uuid_filter(uint16_t uuid) { this->filter_service_data_uuids_.push_back(uuid); }
+  void add_manufacturer_id_filter(uint16_t manufacturer_id) {
+    this->filter_manufacturer_ids_.push_back(manufacturer_id);
+  }
+  /// Never offer advertisements to parse_device(), for listeners that only want on_scan_end().
+  void set_skip_advertisements(bool skip_advertisements) { this->skip_advertisements_ = skip_advertisements; }
+
+  /** Whether parse_device() should see this advertisement.
+   *
+   * It has to match one of the values of every kind of criterion that was added. Without any criteria every
+   * advertisement matches. Only 16-bit service data UUIDs are looked at.
+   */
+  bool matches_advertisement(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param, uint64_t address) const;
+
  protected:
   ESP32BLETracker *parent_{nullptr};
+  std::vector<uint64_t> filter_addresses_;
+  std::vector<uint16_t> filter_service_data_uuids_;
+  std::vector<uint16_t> filter_manufacturer_ids_;
+  bool skip_advertisements_{false};
 };
 
 enum class ClientState {
@@ -180,6 +209,31 @@ class ESPBTClient : public ESPBTDeviceListener {
   ClientState state_;
 };
 
+/** Bounded set of recently seen device addresses.
+ *
+ * Two open addressing tables: new addresses go into the current one, and once that is three quarters full it replaces
+ * the previous one, whose entries are forgotten. An address found in the previous table moves to the current one, so
+ * devices that keep advertising stay known while randomized addresses age out. Every lookup is constant time.
+ */
+class RecentAddressSet {
+ public:
+  /// Add the address, returns whether it was already known.
+  bool check_and_add(uint64_t address);
+  void clear();
+
+ protected:
+  static const uint8_t TABLE_BITS = 6;
+  static const size_t TABLE_SIZE = 1 << TABLE_BITS;
+  using Table = std::array<uint64_t, TABLE_SIZE>;
+
+  static size_t find_slot_(const Table &table, uint64_t key);
+  void insert_(uint64_t key);
+
+  Table current_{};
+  Table previous_{};
+  size_t current_count_{0};
+};
+
 class ESP32BLETracker : public Component,
                         public GAPEventHandler,
                         public GATTcEventHandler,
@@ -191,6 +245,9 @@ class ESP32BLETracker : public Component,
   void set_scan_window(uint32_t scan_window) { scan_window_ = scan_window; }
   void set_scan_active(bool scan_active) { scan_active_ = scan_active; }
   void set_scan_continuous(bool scan_continuous) { scan_continuous_ = scan_continuous; }
+#ifdef USE_SENSOR
+  void set_dropped_advertisements_sensor(sensor::Sensor *sensor) { dropped_advertisements_sensor_ = sensor; }
+#endif
 
   /// Setup the FreeRTOS task and the Bluetooth stack.
   void setup() override;
@@ -219,6 +276,10 @@ class ESP32BLETracker : public Component,
   void start_scan_(bool first);
   /// Called when a scan ends
   void end_of_scan_();
+  /// Hand the scan results in the ring to the listeners and clients, returns whether a client should connect.
+  bool process_scan_results_(int connecting);
+  /// Whether a listener, a client or print_bt_device_info() needs this advertisement parsed.
+  bool wants_advertisement_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param, uint64_t address) const;
   /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
   void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
@@ -230,8 +291,8 @@ class ESP32BLETracker : public Component,
 
   int app_id_;
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
-  std::vector<uint64_t> already_discovered_;
+  /// Addresses that have already been printed in print_bt_device_info
+  RecentAddressSet already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
@@ -248,15 +309,26 @@ class ESP32BLETracker : public Component,
   bool ble_was_disabled_{true};
   bool raw_advertisements_{false};
   bool parse_advertisements_{false};
-  SemaphoreHandle_t scan_result_lock_;
   SemaphoreHandle_t scan_end_lock_;
-  size_t scan_result_index_{0};
 #ifdef USE_PSRAM
   const static u_int8_t SCAN_RESULT_BUFFER_SIZE = 32;
 #else
   const static u_int8_t SCAN_RESULT_BUFFER_SIZE = 16;
 #endif  // USE_PSRAM
+  /** Ring of scan results, written by the BT task and read by loop().
+   *
+   * Both indices count up forever and are taken modulo the buffer size; each side only writes its own, so no lock
+   * is needed. The slots loop() is still working on are only released once it is done with them.
+   */
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param *scan_result_buffer_;
+  std::atomic<uint32_t> scan_result_head_{0};
+  std::atomic<uint32_t> scan_result_tail_{0};
+  /// Advertisements dropped because the ring was full
+  std::atomic<uint32_t> scan_results_dropped_{0};
+  uint32_t scan_results_dropped_reported_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *dropped_advertisements_sensor_{nullptr};
+#endif
   esp_bt_status_t scan_start_failed_{ESP_BT_STATUS_SUCCESS};
   esp_bt_status_t scan_set_param_failed_{ESP_BT_STATUS_SUCCESS};
 };
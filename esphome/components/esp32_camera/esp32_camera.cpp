@@ -31,8 +31,9 @@ void ESP32Camera::setup() {
   this->update_camera_parameters();
 
   /* initialize RTOS */
-  this->framebuffer_get_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
-  this->framebuffer_return_queue_ = xQueueCreate(1, sizeof(camera_fb_t *));
+  // Every framebuffer can be in use at once, so sending to either queue never blocks
+  this->framebuffer_get_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
+  this->framebuffer_return_queue_ = xQueueCreate(this->config_.fb_count, sizeof(camera_fb_t *));
   xTaskCreatePinnedToCore(&ESP32Camera::framebuffer_task,
                           "framebuffer_task",  // name
                           1024,                // stack size
@@ -153,13 +154,7 @@ void ESP32Camera::dump_config() {
 }
 
 void ESP32Camera::loop() {
-  // check if we can return the image
-  if (this->can_return_image_()) {
-    // return image
-    auto *fb = this->current_image_->get_raw_buffer();
-    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
-    this->current_image_.reset();
-  }
+  this->return_unused_images_();
 
   // request idle image every idle_update_interval
   const uint32_t now = millis();
@@ -171,26 +166,31 @@ void ESP32Camera::loop() {
   // Check if we should fetch a new image
   if (!this->has_requested_image_())
     return;
-  if (this->current_image_.use_count() > 1) {
-    // image is still in use
-    return;
-  }
   if (now - this->last_update_ <= this->max_update_interval_)
     return;
 
   // request new image
   camera_fb_t *fb;
   if (xQueueReceive(this->framebuffer_get_queue_, &fb, 0L) != pdTRUE) {
-    // no frame ready
+    // no frame ready, all framebuffers may be held by busy consumers
     ESP_LOGVV(TAG, "No frame ready");
     return;
   }
+  // Skip to the newest frame, the older ones go straight back to the driver
+  camera_fb_t *newer_fb;
+  while (xQueueReceive(this->framebuffer_get_queue_, &newer_fb, 0L) == pdTRUE) {
+    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+    fb = newer_fb;
+  }
 
   if (fb == nullptr) {
     ESP_LOGW(TAG, "Got invalid frame from camera!");
     xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
     return;
   }
+  // Consumers still busy with the current image keep it, the others move on to the new one
+  if (this->current_image_)
+    this->previous_images_.push_back(std::move(this->current_image_));
   this->current_image_ = std::make_shared<CameraImage>(fb, this->single_requesters_ | this->stream_requesters_);
 
   ESP_LOGD(TAG, "Got Image: len=%u", fb->len);
@@ -388,13 +388,41 @@ void ESP32Camera::update_camera_parameters() {
 /* ---------------- Internal methods ---------------- */
 bool ESP32Camera::has_requested_image_() const { return this->single_requesters_ || this->stream_requesters_; }
 bool ESP32Camera::can_return_image_() const { return this->current_image_.use_count() == 1; }
+void ESP32Camera::return_unused_images_() {
+  camera_fb_t *fb;
+  if (this->can_return_image_()) {
+    fb = this->current_image_->get_raw_buffer();
+    xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+    this->current_image_.reset();
+  }
+  for (auto it = this->previous_images_.begin(); it != this->previous_images_.end();) {
+    if (it->use_count() == 1) {
+      fb = (*it)->get_raw_buffer();
+      xQueueSend(this->framebuffer_return_queue_, &fb, portMAX_DELAY);
+      it = this->previous_images_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
 void ESP32Camera::framebuffer_task(void *pv) {
+  const uint8_t fb_count = global_esp32_camera->config_.fb_count;
+  uint8_t in_use = 0;
+  camera_fb_t *framebuffer;
   while (true) {
-    camera_fb_t *framebuffer = esp_camera_fb_get();
+    // The driver only has a frame to hand out once one of the framebuffers is free again
+    if (in_use == fb_count) {
+      xQueueReceive(global_esp32_camera->framebuffer_return_queue_, &framebuffer, portMAX_DELAY);
+      esp_camera_fb_return(framebuffer);
+      in_use--;
+    }
+    while (xQueueReceive(global_esp32_camera->framebuffer_return_queue_, &framebuffer, 0L) == pdTRUE) {
+      esp_camera_fb_return(framebuffer);
+      in_use--;
+    }
+    framebuffer = esp_camera_fb_get();
+    in_use++;
     xQueueSend(global_esp32_camera->framebuffer_get_queue_, &framebuffer, portMAX_DELAY);
-    // return is no-op for config with 1 fb
-    xQueueReceive(global_esp32_camera->framebuffer_return_queue_, &framebuffer, portMAX_DELAY);
-    esp_camera_fb_return(framebuffer);
   }
 }
 
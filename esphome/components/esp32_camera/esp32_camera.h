@@ -10,6 +10,8 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 
+#include <vector>
+
 namespace esphome {
 namespace esp32_camera {
 
@@ -168,6 +170,8 @@ class ESP32Camera : public Component, public EntityBase {
   /* internal methods */
   bool has_requested_image_() const;
   bool can_return_image_() const;
+  /// Hands the framebuffers no consumer uses anymore back to the driver.
+  void return_unused_images_();
 
   static void framebuffer_task(void *pv);
 
@@ -200,6 +204,8 @@ class ESP32Camera : public Component, public EntityBase {
 
   esp_err_t init_error_{ESP_OK};
   std::shared_ptr<CameraImage> current_image_;
+  /// Older images that consumers are still busy with
+  std::vector<std::shared_ptr<CameraImage>> previous_images_;
   uint8_t single_requesters_{0};
   uint8_t stream_requesters_{0};
   QueueHandle_t framebuffer_get_queue_;
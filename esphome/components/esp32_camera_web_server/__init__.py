@@ -12,17 +12,34 @@ Mode = esp32_camera_web_server_ns.enum("Mode")
 
 MODES = {"STREAM": Mode.STREAM, "SNAPSHOT": Mode.SNAPSHOT}
 
-CONFIG_SCHEMA = cv.Schema(
-    {
-        cv.GenerateID(): cv.declare_id(CameraWebServer),
-        cv.Required(CONF_PORT): cv.port,
-        cv.Required(CONF_MODE): cv.enum(MODES, upper=True),
-    },
-).extend(cv.COMPONENT_SCHEMA)
+CONF_MAX_FRAMERATE = "max_framerate"
+
+
+def validate_max_framerate(config):
+    if CONF_MAX_FRAMERATE in config and config[CONF_MODE] != "STREAM":
+        raise cv.Invalid(f"{CONF_MAX_FRAMERATE} is only supported in stream mode")
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(CameraWebServer),
+            cv.Required(CONF_PORT): cv.port,
+            cv.Required(CONF_MODE): cv.enum(MODES, upper=True),
+            cv.Optional(CONF_MAX_FRAMERATE): cv.All(
+                cv.framerate, cv.Range(min=0, min_included=False, max=60)
+            ),
+        },
+    ).extend(cv.COMPONENT_SCHEMA),
+    validate_max_framerate,
+)
 
 
 async def to_code(config):
     server = cg.new_Pvariable(config[CONF_ID])
     cg.add(server.set_port(config[CONF_PORT]))
     cg.add(server.set_mode(config[CONF_MODE]))
+    if CONF_MAX_FRAMERATE in config:
+        cg.add(server.set_max_update_interval(1000 / config[CONF_MAX_FRAMERATE]))
     await cg.register_component(server, config)
@@ -69,6 +69,9 @@ void CameraWebServer::setup() {
 
   esp32_camera::global_esp32_camera->add_image_callback([this](std::shared_ptr<esp32_camera::CameraImage> image) {
     if (this->running_ && image->was_requested_by(esp32_camera::WEB_REQUESTER)) {
+      // The newest image wins, one the client hasn't picked up yet is skipped
+      if (this->image_)
+        ESP_LOGV(TAG, "Skipped a camera frame (%" PRIu32 " skipped)", ++this->frames_skipped_);
       this->image_ = std::move(image);
       xSemaphoreGive(this->semaphore_);
     }
@@ -89,6 +92,8 @@ void CameraWebServer::dump_config() {
   ESP_LOGCONFIG(TAG, "  Port: %d", this->port_);
   if (this->mode_ == STREAM) {
     ESP_LOGCONFIG(TAG, "  Mode: stream");
+    if (this->max_update_interval_ != 0)
+      ESP_LOGCONFIG(TAG, "  Max Framerate: %.1f fps", 1000.0f / this->max_update_interval_);
   } else {
     ESP_LOGCONFIG(TAG, "  Mode: snapshot");
   }
@@ -173,6 +178,11 @@ esp_err_t CameraWebServer::streaming_handler_(struct httpd_req *req) {
   esp32_camera::global_esp32_camera->start_stream(esphome::esp32_camera::WEB_REQUESTER);
 
   while (res == ESP_OK && this->running_) {
+    // Throttle the stream for this client, the camera keeps replacing the pending image with newer ones meanwhile
+    const uint32_t since_last_frame = millis() - last_frame;
+    if (frames != 0 && since_last_frame < this->max_update_interval_)
+      delay(this->max_update_interval_ - since_last_frame);
+
     auto image = this->wait_for_image_();
 
     if (!image) {
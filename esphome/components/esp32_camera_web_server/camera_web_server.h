@@ -29,6 +29,8 @@ class CameraWebServer : public Component {
   float get_setup_priority() const override;
   void set_port(uint16_t port) { this->port_ = port; }
   void set_mode(Mode mode) { this->mode_ = mode; }
+  /// The shortest time between two frames of the stream in ms, newer frames replace the ones arriving in between.
+  void set_max_update_interval(uint32_t max_update_interval) { this->max_update_interval_ = max_update_interval; }
   void loop() override;
 
  protected:
@@ -41,8 +43,10 @@ class CameraWebServer : public Component {
   void *httpd_{nullptr};
   SemaphoreHandle_t semaphore_;
   std::shared_ptr<esphome::esp32_camera::CameraImage> image_;
+  uint32_t frames_skipped_{0};
   bool running_{false};
   Mode mode_{STREAM};
+  uint32_t max_update_interval_{0};
 };
 
 }  // namespace esp32_camera_web_server
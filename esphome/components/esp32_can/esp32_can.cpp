@@ -77,6 +77,16 @@ bool ESP32Can::setup_internal() {
   }
 
   twai_filter_config_t f_config = TWAI_FILTER_CONFIG_ACCEPT_ALL();
+  canbus::CanAcceptanceFilter filter;
+  if (this->get_acceptance_filter(filter)) {
+    // single filter layout: the id starts at bit 21 for standard and at bit 3 for extended frames,
+    // and set mask bits are the ones that are ignored
+    uint8_t shift = filter.use_extended_id ? 3 : 21;
+    f_config.acceptance_code = filter.code << shift;
+    f_config.acceptance_mask = ~(filter.mask << shift);
+    f_config.single_filter = true;
+    ESP_LOGD(TAG, "acceptance filter code=0x%08" PRIx32 " mask=0x%08" PRIx32, filter.code, filter.mask);
+  }
   twai_timing_config_t t_config;
 
   if (!get_bitrate(this->bit_rate_, &t_config)) {
@@ -37,9 +37,12 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  ExternalRAMAllocator<rmt_item32_t> rmt_allocator(ExternalRAMAllocator<rmt_item32_t>::ALLOW_FAILURE);
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8 +
-                                          1);  // 8 bits per byte, 1 rmt_item32_t per bit + 1 rmt_item32_t for reset
+  this->tx_buf_ = allocator.allocate(buffer_size);
+  if (this->tx_buf_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate transmit buffer!");
+    this->mark_failed();
+    return;
+  }
 
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
@@ -64,6 +67,36 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+  if (rmt_translator_init(config.channel, &ESP32RMTLEDStripLightOutput::translate_) != ESP_OK ||
+      rmt_translator_set_context(config.channel, this) != ESP_OK) {
+    ESP_LOGE(TAG, "Cannot initialize RMT translator!");
+    this->mark_failed();
+    return;
+  }
+}
+
+void IRAM_ATTR ESP32RMTLEDStripLightOutput::translate_(const void *src, rmt_item32_t *dest, size_t src_size,
+                                                       size_t wanted_num, size_t *translated_size, size_t *item_num) {
+  ESP32RMTLEDStripLightOutput *light = nullptr;
+  rmt_translator_get_context(item_num, reinterpret_cast<void **>(&light));
+  const uint8_t *psrc = static_cast<const uint8_t *>(src);
+  bool has_reset = light->reset_.duration0 > 0 || light->reset_.duration1 > 0;
+  size_t size = 0;
+  size_t num = 0;
+  while (size < src_size && num + 8 <= wanted_num) {
+    // the reset item goes out with the last byte, there is no later call to append it
+    if (size + 1 == src_size && has_reset && num + 9 > wanted_num)
+      break;
+    uint8_t b = psrc[size];
+    for (int i = 0; i < 8; i++) {
+      dest[num++].val = b & (1 << (7 - i)) ? light->bit1_.val : light->bit0_.val;
+    }
+    size++;
+  }
+  if (size == src_size && has_reset)
+    dest[num++].val = light->reset_.val;
+  *translated_size = size;
+  *item_num = num;
 }
 
 void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
@@ -95,42 +128,22 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
+  // the previous frame is still being sent, don't hold up the loop (and the other strips) waiting for it
+  if (rmt_wait_tx_done(this->channel_, 0) != ESP_OK) {
+    this->schedule_show();
+    return;
+  }
   this->last_refresh_ = now;
   this->mark_shown_();
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
 
-  if (rmt_wait_tx_done(this->channel_, pdMS_TO_TICKS(1000)) != ESP_OK) {
-    ESP_LOGE(TAG, "RMT TX timeout");
-    this->status_set_warning();
-    return;
-  }
   delayMicroseconds(50);
 
   size_t buffer_size = this->get_buffer_size_();
+  memcpy(this->tx_buf_, this->buf_, buffer_size);
 
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_item32_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
-  }
-
-  if (this->reset_.duration0 > 0 || this->reset_.duration1 > 0) {
-    pdest->val = this->reset_.val;
-    pdest++;
-    len++;
-  }
-
-  if (rmt_write_items(this->channel_, this->rmt_buf_, len, false) != ESP_OK) {
+  if (rmt_write_sample(this->channel_, this->tx_buf_, buffer_size, false) != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
     this->status_set_warning();
     return;
@@ -67,9 +67,14 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
   size_t get_buffer_size_() const { return this->num_leds_ * (this->is_rgbw_ || this->is_wrgb_ ? 4 : 3); }
 
+  /// Converts the bytes being sent to RMT items while the RMT memory drains, called from the RMT interrupt.
+  static void translate_(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                         size_t *translated_size, size_t *item_num);
+
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
-  rmt_item32_t *rmt_buf_{nullptr};
+  /// Copy of buf_ that is being sent, so effects can keep writing to buf_ during a transmission
+  uint8_t *tx_buf_{nullptr};
 
   uint8_t pin_;
   uint16_t num_leds_;
@@ -29,6 +29,7 @@ CONF_FILTER_MODE = "filter_mode"
 CONF_NOISE_THRESHOLD = "noise_threshold"
 CONF_JITTER_STEP = "jitter_step"
 CONF_SMOOTH_MODE = "smooth_mode"
+CONF_USE_INTERRUPT = "use_interrupt"
 CONF_WATERPROOF_GUARD_RING = "waterproof_guard_ring"
 CONF_WATERPROOF_SHIELD_DRIVER = "waterproof_shield_driver"
 
@@ -204,6 +205,8 @@ CONFIG_SCHEMA = cv.All(
         {
             cv.GenerateID(): cv.declare_id(ESP32TouchComponent),
             cv.Optional(CONF_SETUP_MODE, default=False): cv.boolean,
+            # On the ESP32-S2/S3 the thresholds are relative to the benchmark then
+            cv.Optional(CONF_USE_INTERRUPT, default=False): cv.boolean,
             # common options
             cv.Optional(CONF_SLEEP_DURATION, default="27306us"): cv.All(
                 cv.positive_time_period, cv.Range(max=TimePeriod(microseconds=436906))
@@ -269,6 +272,7 @@ async def to_code(config):
     await cg.register_component(touch, config)
 
     cg.add(touch.set_setup_mode(config[CONF_SETUP_MODE]))
+    cg.add(touch.set_use_interrupt(config[CONF_USE_INTERRUPT]))
 
     sleep_duration = int(round(config[CONF_SLEEP_DURATION].total_microseconds * 0.15))
     cg.add(touch.set_sleep_duration(sleep_duration))
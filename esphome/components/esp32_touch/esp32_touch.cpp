@@ -4,6 +4,7 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
 
 #include <cinttypes>
 
@@ -12,11 +13,24 @@ namespace esp32_touch {
 
 static const char *const TAG = "esp32_touch";
 
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+static const touch_pad_intr_mask_t TOUCH_INTR_MASK =
+    static_cast<touch_pad_intr_mask_t>(TOUCH_PAD_INTR_MASK_ACTIVE | TOUCH_PAD_INTR_MASK_INACTIVE);
+#endif
+
 void ESP32TouchComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ESP32 Touch Hub...");
   touch_pad_init();
 // set up and enable/start filtering based on ESP32 variant
 #if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+  if (this->use_interrupt_ && !this->filter_configured_()) {
+    // The benchmark the interrupt thresholds are relative to is only updated by the filter
+    this->filter_mode_ = TOUCH_PAD_FILTER_IIR_16;
+    this->debounce_count_ = 1;
+    this->noise_threshold_ = 0;
+    this->jitter_step_ = 4;
+    this->smooth_level_ = TOUCH_PAD_SMOOTH_IIR_2;
+  }
   if (this->filter_configured_()) {
     touch_filter_config_t filter_info = {
         .mode = this->filter_mode_,
@@ -58,15 +72,33 @@ void ESP32TouchComponent::setup() {
   for (auto *child : this->children_) {
 #if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
     touch_pad_config(child->get_touch_pad());
+    if (this->use_interrupt_)
+      touch_pad_set_thresh(child->get_touch_pad(), child->get_threshold());
 #else
-    // Disable interrupt threshold
-    touch_pad_config(child->get_touch_pad(), 0);
+    // A threshold of 0 disables the interrupt of the pad
+    touch_pad_config(child->get_touch_pad(), this->use_interrupt_ ? child->get_threshold() : 0);
 #endif
   }
 #if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
   touch_pad_set_fsm_mode(TOUCH_FSM_MODE_TIMER);
   touch_pad_fsm_start();
 #endif
+
+  if (this->use_interrupt_) {
+    for (auto *child : this->children_)
+      child->publish_initial_state(false);
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+    touch_pad_isr_register(reinterpret_cast<intr_handler_t>(&ESP32TouchComponent::touch_intr), this,
+                           TOUCH_INTR_MASK);
+    touch_pad_intr_enable(TOUCH_INTR_MASK);
+#else
+    touch_pad_isr_register(reinterpret_cast<intr_handler_t>(&ESP32TouchComponent::touch_intr), this);
+    touch_pad_intr_enable();
+#endif
+    // loop() only runs when the interrupt fired, or while a pad is touched on the ESP32
+    if (!this->setup_mode_)
+      this->disable_loop();
+  }
 }
 
 void ESP32TouchComponent::dump_config() {
@@ -255,6 +287,7 @@ void ESP32TouchComponent::dump_config() {
   if (this->setup_mode_) {
     ESP_LOGCONFIG(TAG, "  Setup Mode ENABLED");
   }
+  ESP_LOGCONFIG(TAG, "  Use Interrupt: %s", YESNO(this->use_interrupt_));
 
   for (auto *child : this->children_) {
     LOG_BINARY_SENSOR("  ", "Touch Pad", child);
@@ -282,20 +315,82 @@ uint32_t ESP32TouchComponent::component_touch_pad_read(touch_pad_t tp) {
   return value;
 }
 
+void IRAM_ATTR ESP32TouchComponent::touch_intr(ESP32TouchComponent *arg) {
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+  const uint32_t status = touch_pad_read_intr_status_mask();
+  const uint32_t pad_mask = 1UL << touch_pad_get_current_meas_channel();
+  if (status & TOUCH_PAD_INTR_MASK_ACTIVE)
+    arg->touched_mask_ = arg->touched_mask_ | pad_mask;
+  if (status & TOUCH_PAD_INTR_MASK_INACTIVE)
+    arg->touched_mask_ = arg->touched_mask_ & ~pad_mask;
+#else
+  const uint32_t status = touch_pad_get_status();
+  touch_pad_clear_status();
+  arg->pending_mask_ = arg->pending_mask_ | status;
+#endif
+  arg->enable_loop_soon_from_isr();
+}
+
+void ESP32TouchComponent::process_interrupts_() {
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+  const uint32_t touched = this->touched_mask_;
+  for (auto *child : this->children_)
+    child->publish_state(touched & (1UL << child->get_touch_pad()));
+#else
+  {
+    InterruptLock lock;
+    this->touched_mask_ |= this->pending_mask_;
+    this->pending_mask_ = 0;
+  }
+  for (auto *child : this->children_) {
+    const uint32_t pad_mask = 1UL << child->get_touch_pad();
+    if (this->touched_mask_ & pad_mask) {
+      // The interrupt doesn't fire on release
+      child->value_ = this->component_touch_pad_read(child->get_touch_pad());
+      if (child->value_ >= child->get_threshold())
+        this->touched_mask_ &= ~pad_mask;
+    }
+    child->publish_state(this->touched_mask_ & pad_mask);
+  }
+  if (this->touched_mask_ != 0)
+    return;
+#endif
+  // An interrupt from now on enables the loop again after this iteration
+  if (!this->setup_mode_)
+    this->disable_loop();
+}
+
 void ESP32TouchComponent::loop() {
   const uint32_t now = millis();
   bool should_print = this->setup_mode_ && now - this->setup_mode_last_log_print_ > 250;
+  if (this->use_interrupt_) {
+    this->process_interrupts_();
+    if (!should_print)
+      return;
+  }
   for (auto *child : this->children_) {
     child->value_ = this->component_touch_pad_read(child->get_touch_pad());
+    if (!this->use_interrupt_) {
 #if !(defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3))
-    child->publish_state(child->value_ < child->get_threshold());
+      child->publish_state(child->value_ < child->get_threshold());
 #else
-    child->publish_state(child->value_ > child->get_threshold());
+      child->publish_state(child->value_ > child->get_threshold());
 #endif
+    }
 
     if (should_print) {
-      ESP_LOGD(TAG, "Touch Pad '%s' (T%" PRIu32 "): %" PRIu32, child->get_name().c_str(),
-               (uint32_t) child->get_touch_pad(), child->value_);
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+      if (this->use_interrupt_) {
+        uint32_t benchmark = 0;
+        touch_pad_read_benchmark(child->get_touch_pad(), &benchmark);
+        ESP_LOGD(TAG, "Touch Pad '%s' (T%" PRIu32 "): %" PRIu32 " (benchmark %" PRIu32 ")",
+                 child->get_name().c_str(), (uint32_t) child->get_touch_pad(), child->value_, benchmark);
+      } else
+#endif
+      {
+        ESP_LOGD(TAG, "Touch Pad '%s' (T%" PRIu32 "): %" PRIu32, child->get_name().c_str(),
+                 (uint32_t) child->get_touch_pad(), child->value_);
+      }
     }
 
     App.feed_wdt();
@@ -310,6 +405,15 @@ void ESP32TouchComponent::loop() {
 void ESP32TouchComponent::on_shutdown() {
   bool is_wakeup_source = false;
 
+  if (this->use_interrupt_) {
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+    touch_pad_intr_disable(TOUCH_INTR_MASK);
+#else
+    touch_pad_intr_disable();
+#endif
+    touch_pad_isr_deregister(reinterpret_cast<intr_handler_t>(&ESP32TouchComponent::touch_intr), this);
+  }
+
 #if !(defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3))
   if (this->iir_filter_enabled_()) {
     touch_pad_filter_stop();
@@ -20,6 +20,13 @@ class ESP32TouchComponent : public Component {
   void register_touch_pad(ESP32TouchBinarySensor *pad) { this->children_.push_back(pad); }
 
   void set_setup_mode(bool setup_mode) { this->setup_mode_ = setup_mode; }
+  /** Detect touches with the touch interrupt instead of reading all pads in every loop iteration.
+   *
+   * On the ESP32-S2/S3 the interrupt fires on touch and on release, and the thresholds are relative to the benchmark
+   * that the hardware filter keeps tracking, so they follow slow drift of the pads. On the ESP32 the interrupt only
+   * fires on touch, touched pads are read until they are released.
+   */
+  void set_use_interrupt(bool use_interrupt) { this->use_interrupt_ = use_interrupt; }
   void set_sleep_duration(uint16_t sleep_duration) { this->sleep_cycle_ = sleep_duration; }
   void set_measurement_duration(uint16_t meas_cycle) { this->meas_cycle_ = meas_cycle; }
   void set_low_voltage_reference(touch_low_volt_t low_voltage_reference) {
@@ -57,6 +64,10 @@ class ESP32TouchComponent : public Component {
   void on_shutdown() override;
 
  protected:
+  static void touch_intr(ESP32TouchComponent *arg);
+  /// Publish the states the interrupt latched.
+  void process_interrupts_();
+
 #if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
   bool filter_configured_() const {
     return (this->filter_mode_ != TOUCH_PAD_FILTER_MAX) && (this->smooth_level_ != TOUCH_PAD_SMOOTH_MAX);
@@ -75,6 +86,16 @@ class ESP32TouchComponent : public Component {
   std::vector<ESP32TouchBinarySensor *> children_;
   bool setup_mode_{false};
   uint32_t setup_mode_last_log_print_{0};
+  bool use_interrupt_{false};
+#if defined(USE_ESP32_VARIANT_ESP32S2) || defined(USE_ESP32_VARIANT_ESP32S3)
+  /// Touched pads as a bit mask, only written by the interrupt
+  volatile uint32_t touched_mask_{0};
+#else
+  /// Pads the interrupt saw below their threshold since the last loop iteration
+  volatile uint32_t pending_mask_{0};
+  /// Touched pads, read by the loop until they are released
+  uint32_t touched_mask_{0};
+#endif
   // common parameters
   uint16_t sleep_cycle_{4095};
   uint16_t meas_cycle_{65535};
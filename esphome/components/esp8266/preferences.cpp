@@ -11,6 +11,7 @@ extern "C" {
 #include "esphome/core/preferences.h"
 #include "preferences.h"
 
+#include <cinttypes>
 #include <cstring>
 #include <vector>
 
@@ -75,6 +76,201 @@ template<class It> uint32_t calculate_crc(It first, It last, uint32_t type) {
   return crc;
 }
 
+#ifdef USE_ESP8266_PREFERENCES_LOG_SECTORS
+/* Log-structured storage, used instead of rewriting the preference sector on every sync.
+ *
+ * The sectors below the legacy preference sector (taken from the end of the filesystem area) are used round-robin.
+ * A sector starts with a header (magic, sequence number) followed by records. Each record is a header word (magic,
+ * word offset, word count), the words of the flash image it replaces and a CRC. The first record of a sector is a
+ * snapshot of the whole image, later records only contain the words that changed since. When the active sector is
+ * full the next one is erased and starts with a new snapshot, the header is written last so an interrupted
+ * compaction leaves the previous sector active.
+ */
+static const uint32_t LOG_SECTORS = USE_ESP8266_PREFERENCES_LOG_SECTORS;
+static const uint32_t LOG_SECTOR_MAGIC = 0x50485345;  // "ESHP"
+static const uint32_t LOG_RECORD_MAGIC = 0x5A;
+static const uint32_t LOG_SECTOR_WORDS = SPI_FLASH_SEC_SIZE / 4;
+static const uint32_t LOG_HEADER_WORDS = 2;
+static const uint32_t LOG_ERASED = 0xFFFFFFFF;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+/// Words of s_flash_storage changed since the last sync
+static uint32_t s_log_dirty[(ESP8266_FLASH_STORAGE_SIZE + 31) / 32] = {};
+/// Index of the active log sector, -1 if there is none yet
+static int32_t s_log_active = -1;
+static uint32_t s_log_sequence = 0;
+/// Next free word in the active sector
+static uint32_t s_log_position = 0;
+/// Set when the active sector can't be appended to, for example after a torn write
+static bool s_log_compact = true;
+/// Cleared when the filesystem area is too small to hold the log sectors
+static bool s_log_enabled = false;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+extern "C" uint32_t _SPIFFS_start;  // NOLINT
+
+static bool log_available() {
+  union {
+    uint32_t *ptr;
+    uint32_t uint;
+  } data{};
+  data.ptr = &_SPIFFS_start;
+  uint32_t fs_start_sector = (data.uint - 0x40200000) / SPI_FLASH_SEC_SIZE;
+  return get_esp8266_flash_sector() >= fs_start_sector + LOG_SECTORS;
+}
+static uint32_t log_address(uint32_t index, uint32_t word) {
+  return (get_esp8266_flash_sector() - LOG_SECTORS + index) * SPI_FLASH_SEC_SIZE + word * 4;
+}
+static bool log_read(uint32_t index, uint32_t word, uint32_t *data, size_t words) {
+  InterruptLock lock;
+  return spi_flash_read(log_address(index, word), data, words * 4) == SPI_FLASH_RESULT_OK;
+}
+static bool log_write(uint32_t index, uint32_t word, uint32_t *data, size_t words) {
+  InterruptLock lock;
+  return spi_flash_write(log_address(index, word), data, words * 4) == SPI_FLASH_RESULT_OK;
+}
+static uint32_t log_record_header(uint32_t offset, uint32_t words) {
+  return (LOG_RECORD_MAGIC << 24) | (offset << 12) | words;
+}
+
+/// Read the record at word, returns its size in words or 0 if there is no valid record.
+static uint32_t log_read_record(uint32_t index, uint32_t word, std::vector<uint32_t> &buffer) {
+  uint32_t header;
+  if (word + 2 > LOG_SECTOR_WORDS || !log_read(index, word, &header, 1))
+    return 0;
+  uint32_t offset = (header >> 12) & 0xFFF;
+  uint32_t words = header & 0xFFF;
+  if ((header >> 24) != LOG_RECORD_MAGIC || words == 0 || offset + words > ESP8266_FLASH_STORAGE_SIZE ||
+      word + words + 2 > LOG_SECTOR_WORDS)
+    return 0;
+  buffer.resize(words + 1);
+  if (!log_read(index, word + 1, buffer.data(), words + 1))
+    return 0;
+  if (buffer[words] != calculate_crc(buffer.begin(), buffer.end() - 1, header))
+    return 0;
+  memcpy(&s_flash_storage[offset], buffer.data(), words * 4);
+  return words + 2;
+}
+
+/// Rebuild the flash image from the newest valid log sector.
+static bool log_load() {
+  uint32_t sequences[LOG_SECTORS];
+  for (uint32_t i = 0; i < LOG_SECTORS; i++) {
+    uint32_t header[LOG_HEADER_WORDS];
+    sequences[i] = LOG_ERASED;
+    if (log_read(i, 0, header, LOG_HEADER_WORDS) && header[0] == LOG_SECTOR_MAGIC)
+      sequences[i] = header[1];
+  }
+
+  std::vector<uint32_t> buffer;
+  uint32_t last_sequence = LOG_ERASED;
+  while (true) {
+    // newest sector not tried yet
+    int32_t index = -1;
+    for (uint32_t i = 0; i < LOG_SECTORS; i++) {
+      if (sequences[i] != LOG_ERASED && (sequences[i] < last_sequence || last_sequence == LOG_ERASED) &&
+          (index < 0 || sequences[i] > sequences[index]))
+        index = i;
+    }
+    if (index < 0)
+      return false;
+    last_sequence = sequences[index];
+
+    uint32_t position = LOG_HEADER_WORDS;
+    uint32_t size = log_read_record(index, position, buffer);
+    if (size != ESP8266_FLASH_STORAGE_SIZE + 2) {
+      ESP_LOGW(TAG, "Preference log sector %" PRId32 " has no valid snapshot", index);
+      continue;
+    }
+    position += size;
+    while ((size = log_read_record(index, position, buffer)) != 0)
+      position += size;
+
+    uint32_t next = LOG_ERASED;
+    s_log_compact = position < LOG_SECTOR_WORDS && (!log_read(index, position, &next, 1) || next != LOG_ERASED);
+    if (s_log_compact)
+      ESP_LOGW(TAG, "Preference log sector %" PRId32 " ends with an invalid record", index);
+    s_log_active = index;
+    s_log_sequence = sequences[index];
+    s_log_position = position;
+    ESP_LOGV(TAG, "Loaded preference log sector %" PRId32 ", sequence %" PRIu32 ", %" PRIu32 " words used", index,
+             s_log_sequence, s_log_position);
+    return true;
+  }
+}
+
+/// Start a new sector with a snapshot of the whole image.
+static bool log_compact() {
+  uint32_t index = s_log_active < 0 ? 0 : (s_log_active + 1) % LOG_SECTORS;
+  uint32_t header = log_record_header(0, ESP8266_FLASH_STORAGE_SIZE);
+  std::vector<uint32_t> buffer(ESP8266_FLASH_STORAGE_SIZE + 2);
+  buffer[0] = header;
+  memcpy(&buffer[1], s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
+  buffer[ESP8266_FLASH_STORAGE_SIZE + 1] = calculate_crc(buffer.begin() + 1, buffer.end() - 1, header);
+  uint32_t sector_header[LOG_HEADER_WORDS] = {LOG_SECTOR_MAGIC, s_log_sequence + 1};
+
+  SpiFlashOpResult erase_res;
+  {
+    InterruptLock lock;
+    erase_res = spi_flash_erase_sector(get_esp8266_flash_sector() - LOG_SECTORS + index);
+  }
+  if (erase_res != SPI_FLASH_RESULT_OK) {
+    ESP_LOGE(TAG, "Erase ESP8266 flash failed!");
+    return false;
+  }
+  if (!log_write(index, LOG_HEADER_WORDS, buffer.data(), buffer.size()) ||
+      !log_write(index, 0, sector_header, LOG_HEADER_WORDS)) {
+    ESP_LOGE(TAG, "Write ESP8266 flash failed!");
+    return false;
+  }
+  s_log_active = index;
+  s_log_sequence++;
+  s_log_position = LOG_HEADER_WORDS + buffer.size();
+  s_log_compact = false;
+  ESP_LOGD(TAG, "Compacted preferences into log sector %" PRIu32, index);
+  return true;
+}
+
+/// Append the changed words to the active sector, compacting if they don't fit.
+static bool log_sync() {
+  std::vector<uint32_t> buffer;
+  uint32_t needed = 0;
+  for (uint32_t pass = 0; pass < 2; pass++) {
+    uint32_t position = s_log_position;
+    uint32_t i = 0;
+    while (i < ESP8266_FLASH_STORAGE_SIZE) {
+      if (!(s_log_dirty[i / 32] & (1UL << (i % 32)))) {
+        i++;
+        continue;
+      }
+      uint32_t start = i;
+      while (i < ESP8266_FLASH_STORAGE_SIZE && (s_log_dirty[i / 32] & (1UL << (i % 32))))
+        i++;
+      uint32_t words = i - start;
+      if (pass == 0) {
+        needed += words + 2;
+        continue;
+      }
+      uint32_t header = log_record_header(start, words);
+      buffer.resize(words + 2);
+      buffer[0] = header;
+      memcpy(&buffer[1], &s_flash_storage[start], words * 4);
+      buffer[words + 1] = calculate_crc(buffer.begin() + 1, buffer.end() - 1, header);
+      if (!log_write(s_log_active, position, buffer.data(), buffer.size())) {
+        ESP_LOGE(TAG, "Write ESP8266 flash failed!");
+        s_log_compact = true;
+        return false;
+      }
+      position += buffer.size();
+      s_log_position = position;
+    }
+    if (pass == 0 && (s_log_compact || s_log_active < 0 || s_log_position + needed > LOG_SECTOR_WORDS))
+      return log_compact();
+  }
+  return true;
+}
+#endif  // USE_ESP8266_PREFERENCES_LOG_SECTORS
+
 static bool save_to_flash(size_t offset, const uint32_t *data, size_t len) {
   for (uint32_t i = 0; i < len; i++) {
     uint32_t j = offset + i;
@@ -82,8 +278,12 @@ static bool save_to_flash(size_t offset, const uint32_t *data, size_t len) {
       return false;
     uint32_t v = data[i];
     uint32_t *ptr = &s_flash_storage[j];
-    if (*ptr != v)
+    if (*ptr != v) {
       s_flash_dirty = true;
+#ifdef USE_ESP8266_PREFERENCES_LOG_SECTORS
+      s_log_dirty[j / 32] |= 1UL << (j % 32);
+#endif
+    }
     *ptr = v;
   }
   return true;
@@ -171,6 +371,14 @@ class ESP8266Preferences : public ESPPreferences {
     s_flash_storage = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];  // NOLINT
     ESP_LOGVV(TAG, "Loading preferences from flash...");
 
+#ifdef USE_ESP8266_PREFERENCES_LOG_SECTORS
+    s_log_enabled = log_available();
+    if (!s_log_enabled) {
+      ESP_LOGW(TAG, "Not enough flash for %" PRIu32 " preference log sectors, using the single sector", LOG_SECTORS);
+    } else if (log_load()) {
+      return;
+    }
+#endif
     {
       InterruptLock lock;
       spi_flash_read(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
@@ -236,6 +444,15 @@ class ESP8266Preferences : public ESPPreferences {
       return false;
 
     ESP_LOGD(TAG, "Saving preferences to flash...");
+#ifdef USE_ESP8266_PREFERENCES_LOG_SECTORS
+    if (s_log_enabled) {
+      if (!log_sync())
+        return false;
+      memset(s_log_dirty, 0, sizeof(s_log_dirty));
+      s_flash_dirty = false;
+      return true;
+    }
+#endif
     SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
     {
       InterruptLock lock;
@@ -263,6 +480,10 @@ class ESP8266Preferences : public ESPPreferences {
     {
       InterruptLock lock;
       erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
+#ifdef USE_ESP8266_PREFERENCES_LOG_SECTORS
+      for (uint32_t i = 0; s_log_enabled && erase_res == SPI_FLASH_RESULT_OK && i < LOG_SECTORS; i++)
+        erase_res = spi_flash_erase_sector(get_esp8266_flash_sector() - LOG_SECTORS + i);
+#endif
     }
     if (erase_res != SPI_FLASH_RESULT_OK) {
       ESP_LOGE(TAG, "Erase ESP8266 flash failed!");
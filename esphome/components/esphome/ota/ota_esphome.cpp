@@ -8,6 +8,7 @@
 #include "esphome/components/ota/ota_backend_arduino_libretiny.h"
 #include "esphome/components/ota/ota_backend_arduino_rp2040.h"
 #include "esphome/components/ota/ota_backend_esp_idf.h"
+#include "esphome/components/ota/ota_backend_pipelined.h"
 #include "esphome/core/application.h"
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
@@ -99,7 +100,7 @@ void ESPHomeOTAComponent::handle_() {
   size_t size_acknowledged = 0;
 #endif
 
-  if (client_ == nullptr) {
+  if (client_ == nullptr && server_->ready()) {
     struct sockaddr_storage source_addr;
     socklen_t addr_len = sizeof(source_addr);
     client_ = server_->accept((struct sockaddr *) &source_addr, &addr_len);
@@ -137,7 +138,12 @@ void ESPHomeOTAComponent::handle_() {
   buf[1] = USE_OTA_VERSION;
   this->writeall_(buf, 2);
 
+#ifdef USE_ESP32
+  // write to flash while the next data is received
+  backend = make_unique<ota::PipelinedOTABackend>(ota::make_ota_backend());
+#else
   backend = ota::make_ota_backend();
+#endif
 
   // Read features - 1 byte
   if (!this->readall_(buf, 1)) {
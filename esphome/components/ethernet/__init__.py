@@ -44,6 +44,8 @@ CONF_PHY_ADDR = "phy_addr"
 CONF_MDC_PIN = "mdc_pin"
 CONF_MDIO_PIN = "mdio_pin"
 CONF_CLK_MODE = "clk_mode"
+CONF_DMA_RX_BUFFERS = "dma_rx_buffers"
+CONF_DMA_TX_BUFFERS = "dma_tx_buffers"
 CONF_POWER_PIN = "power_pin"
 CONF_PHY_REGISTERS = "phy_registers"
 
@@ -141,6 +143,13 @@ RMII_SCHEMA = BASE_SCHEMA.extend(
             cv.Optional(CONF_PHY_ADDR, default=0): cv.int_range(min=0, max=31),
             cv.Optional(CONF_POWER_PIN): pins.internal_gpio_output_pin_number,
             cv.Optional(CONF_PHY_REGISTERS): cv.ensure_list(PHY_REGISTER_SCHEMA),
+            # Every DMA buffer of the EMAC takes 512 bytes of internal RAM, 10 by default
+            cv.Optional(CONF_DMA_RX_BUFFERS): cv.All(
+                cv.only_with_esp_idf, cv.int_range(min=3, max=30)
+            ),
+            cv.Optional(CONF_DMA_TX_BUFFERS): cv.All(
+                cv.only_with_esp_idf, cv.int_range(min=3, max=30)
+            ),
         }
     )
 )
@@ -252,6 +261,14 @@ async def to_code(config):
         cg.add(var.set_clk_mode(*CLK_MODES[config[CONF_CLK_MODE]]))
         if CONF_POWER_PIN in config:
             cg.add(var.set_power_pin(config[CONF_POWER_PIN]))
+        if CONF_DMA_RX_BUFFERS in config:
+            add_idf_sdkconfig_option(
+                "CONFIG_ETH_DMA_RX_BUFFER_NUM", config[CONF_DMA_RX_BUFFERS]
+            )
+        if CONF_DMA_TX_BUFFERS in config:
+            add_idf_sdkconfig_option(
+                "CONFIG_ETH_DMA_TX_BUFFER_NUM", config[CONF_DMA_TX_BUFFERS]
+            )
         for register_value in config.get(CONF_PHY_REGISTERS, []):
             reg = phy_register(
                 register_value.get(CONF_ADDRESS),
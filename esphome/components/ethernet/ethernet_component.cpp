@@ -220,6 +220,9 @@ void EthernetComponent::setup() {
   /* attach Ethernet driver to TCP/IP stack */
   err = esp_netif_attach(this->eth_netif_, esp_eth_new_netif_glue(this->eth_handle_));
   ESPHL_ERROR_CHECK(err, "ETH netif attach error");
+  // Count the received frames on their way to the stack, replacing the input path the glue just installed
+  err = esp_eth_update_input_path(this->eth_handle_, &EthernetComponent::eth_input, this);
+  ESPHL_ERROR_CHECK(err, "ETH input path error");
 
   // Register user defined event handers
   err = esp_event_handler_register(ETH_EVENT, ESP_EVENT_ANY_ID, &EthernetComponent::eth_event_handler, nullptr);
@@ -276,6 +279,14 @@ void EthernetComponent::loop() {
   }
 }
 
+esp_err_t EthernetComponent::eth_input(esp_eth_handle_t eth_handle, uint8_t *buffer, uint32_t length, void *priv) {
+  auto *component = static_cast<EthernetComponent *>(priv);
+  component->rx_frames_ = component->rx_frames_ + 1;
+  component->rx_bytes_ = component->rx_bytes_ + length;
+  // The stack takes ownership of the buffer without copying it
+  return esp_netif_receive(component->eth_netif_, buffer, length, nullptr);
+}
+
 void EthernetComponent::dump_config() {
   const char *eth_type;
   switch (this->type_) {
@@ -88,9 +88,16 @@ class EthernetComponent : public Component {
   eth_speed_t get_link_speed();
   bool powerdown();
 
+  /// The number of frames received from the driver since setup.
+  uint32_t get_rx_frames() const { return this->rx_frames_; }
+  /// The number of bytes in the frames received from the driver since setup.
+  uint32_t get_rx_bytes() const { return this->rx_bytes_; }
+
  protected:
   static void eth_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
   static void got_ip_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
+  /// Passes a received frame to the TCP/IP stack, called from the task of the driver.
+  static esp_err_t eth_input(esp_eth_handle_t eth_handle, uint8_t *buffer, uint32_t length, void *priv);
 #if LWIP_IPV6
   static void got_ip6_event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
 #endif /* LWIP_IPV6 */
@@ -135,6 +142,9 @@ class EthernetComponent : public Component {
   esp_netif_t *eth_netif_{nullptr};
   esp_eth_handle_t eth_handle_;
   esp_eth_phy_t *phy_{nullptr};
+  // Written by the task of the driver
+  volatile uint32_t rx_frames_{0};
+  volatile uint32_t rx_bytes_{0};
 };
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
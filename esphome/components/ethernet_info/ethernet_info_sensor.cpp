@@ -0,0 +1,21 @@
+#include "ethernet_info_sensor.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_ESP32
+
+namespace esphome {
+namespace ethernet_info {
+
+static const char *const TAG = "ethernet_info";
+
+void TrafficEthernetInfo::dump_config() {
+  ESP_LOGCONFIG(TAG, "EthernetInfo Traffic:");
+  LOG_UPDATE_INTERVAL(this);
+  LOG_SENSOR("  ", "Received Frames", this->received_frames_sensor_);
+  LOG_SENSOR("  ", "Received Bytes", this->received_bytes_sensor_);
+}
+
+}  // namespace ethernet_info
+}  // namespace esphome
+
+#endif  // USE_ESP32
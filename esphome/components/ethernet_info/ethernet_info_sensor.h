@@ -0,0 +1,39 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/components/ethernet/ethernet_component.h"
+
+#ifdef USE_ESP32
+
+namespace esphome {
+namespace ethernet_info {
+
+/// Publishes the traffic the ethernet component received since setup.
+class TrafficEthernetInfo : public PollingComponent {
+ public:
+  void update() override {
+    if (this->received_frames_sensor_ != nullptr)
+      this->received_frames_sensor_->publish_state(ethernet::global_eth_component->get_rx_frames());
+    if (this->received_bytes_sensor_ != nullptr)
+      this->received_bytes_sensor_->publish_state(ethernet::global_eth_component->get_rx_bytes());
+  }
+  float get_setup_priority() const override { return setup_priority::ETHERNET; }
+  void dump_config() override;
+
+  void set_received_frames_sensor(sensor::Sensor *received_frames_sensor) {
+    this->received_frames_sensor_ = received_frames_sensor;
+  }
+  void set_received_bytes_sensor(sensor::Sensor *received_bytes_sensor) {
+    this->received_bytes_sensor_ = received_bytes_sensor;
+  }
+
+ protected:
+  sensor::Sensor *received_frames_sensor_{nullptr};
+  sensor::Sensor *received_bytes_sensor_{nullptr};
+};
+
+}  // namespace ethernet_info
+}  // namespace esphome
+
+#endif  // USE_ESP32
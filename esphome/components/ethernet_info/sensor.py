@@ -0,0 +1,51 @@
+import esphome.codegen as cg
+from esphome.components import sensor
+import esphome.config_validation as cv
+from esphome.const import (
+    CONF_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    ICON_COUNTER,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_BYTES,
+)
+
+DEPENDENCIES = ["ethernet"]
+
+CONF_RECEIVED_BYTES = "received_bytes"
+CONF_RECEIVED_FRAMES = "received_frames"
+
+ethernet_info_ns = cg.esphome_ns.namespace("ethernet_info")
+
+TrafficEthernetInfo = ethernet_info_ns.class_(
+    "TrafficEthernetInfo", cg.PollingComponent
+)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(TrafficEthernetInfo),
+        cv.Optional(CONF_RECEIVED_FRAMES): sensor.sensor_schema(
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+        cv.Optional(CONF_RECEIVED_BYTES): sensor.sensor_schema(
+            unit_of_measurement=UNIT_BYTES,
+            icon=ICON_COUNTER,
+            accuracy_decimals=0,
+            state_class=STATE_CLASS_TOTAL_INCREASING,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    if conf := config.get(CONF_RECEIVED_FRAMES):
+        sens = await sensor.new_sensor(conf)
+        cg.add(var.set_received_frames_sensor(sens))
+    if conf := config.get(CONF_RECEIVED_BYTES):
+        sens = await sensor.new_sensor(conf)
+        cg.add(var.set_received_bytes_sensor(sens))
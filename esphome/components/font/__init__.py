@@ -10,6 +10,7 @@ import requests
 
 from esphome import core, external_files
 import esphome.codegen as cg
+from esphome.components import asset_partition
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_FAMILY,
@@ -490,11 +491,22 @@ async def to_code(config):
         glyph_args[glyph] = GlyphInfo(len(data), offset_x, offset_y, width, height)
         data += glyph_data
 
-    rhs = [HexInt(x) for x in data]
-    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
+    if asset_partition.is_enabled():
+        # The glyphs hold offsets, Font adds the address of the asset to them
+        data_base = asset_partition.add_asset(data)
+        prog_arr = None
+    else:
+        data_base = None
+        rhs = [HexInt(x) for x in data]
+        prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
 
     glyph_initializer = []
     for glyph in glyphs:
+        offset = glyph_args[glyph].data_len
+        if prog_arr is None:
+            data_ptr = f"reinterpret_cast<const uint8_t *>({offset})"
+        else:
+            data_ptr = f"{str(prog_arr)} + {str(offset)}"
         glyph_initializer.append(
             cg.StructInitializer(
                 GlyphData,
@@ -502,12 +514,7 @@ async def to_code(config):
                     "a_char",
                     cg.RawExpression(f"(const uint8_t *){cpp_string_escape(glyph)}"),
                 ),
-                (
-                    "data",
-                    cg.RawExpression(
-                        f"{str(prog_arr)} + {str(glyph_args[glyph].data_len)}"
-                    ),
-                ),
+                ("data", cg.RawExpression(data_ptr)),
                 ("offset_x", glyph_args[glyph].offset_x),
                 ("offset_y", glyph_args[glyph].offset_y),
                 ("width", glyph_args[glyph].width),
@@ -524,4 +531,5 @@ async def to_code(config):
         font_list[0].ascent,
         font_list[0].ascent + font_list[0].descent,
         bpp,
+        data_base,
     )
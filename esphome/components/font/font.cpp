@@ -45,13 +45,36 @@ void Glyph::scan_area(int *x1, int *y1, int *width, int *height) const {
   *height = this->glyph_data_->height;
 }
 
-Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp)
+Font::Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp, const uint8_t *data_base)
     : baseline_(baseline), height_(height), bpp_(bpp) {
+  if (data_base != nullptr) {
+    this->glyph_data_.assign(data, data + data_nr);
+    for (auto &glyph_data : this->glyph_data_)
+      glyph_data.data = data_base + reinterpret_cast<uintptr_t>(glyph_data.data);
+    data = this->glyph_data_.data();
+  }
   glyphs_.reserve(data_nr);
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(&data[i]);
+
+  // The glyphs are sorted, so a longer glyph starting with the same byte directly follows the single byte one. Those
+  // characters keep using the search, it has to find the longest match.
+  for (auto &index : this->ascii_index_)
+    index = -1;
+  for (int i = 0; i < data_nr; ++i) {
+    const uint8_t *chr = data[i].a_char;
+    if (chr[0] == '\0' || chr[0] >= ASCII_INDEX_SIZE || chr[1] != '\0')
+      continue;
+    if (i + 1 < data_nr && data[i + 1].a_char[0] == chr[0])
+      continue;
+    this->ascii_index_[chr[0]] = i;
+  }
 }
 int Font::match_next_glyph(const uint8_t *str, int *match_length) {
+  if (str[0] < ASCII_INDEX_SIZE && this->ascii_index_[str[0]] >= 0) {
+    *match_length = 1;
+    return this->ascii_index_[str[0]];
+  }
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -71,6 +94,18 @@ int Font::match_next_glyph(const uint8_t *str, int *match_length) {
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
   *height = this->height_;
+  // FNV-1, like fnv1_hash()
+  uint32_t hash = 2166136261UL;
+  uint32_t length = 0;
+  for (; str[length] != '\0'; length++)
+    hash = (hash * 16777619UL) ^ static_cast<uint8_t>(str[length]);
+  MeasureCacheEntry &entry = this->measure_cache_[hash & (MEASURE_CACHE_SIZE - 1)];
+  if (length != 0 && entry.length == length && entry.hash == hash) {
+    *width = entry.width;
+    *x_offset = entry.x_offset;
+    return;
+  }
+
   int i = 0;
   int min_x = 0;
   bool has_char = false;
@@ -99,6 +134,8 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   }
   *x_offset = min_x;
   *width = x - min_x;
+  if (length != 0)
+    entry = MeasureCacheEntry{hash, length, *width, *x_offset};
 }
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text, Color background) {
   int i = 0;
@@ -135,8 +172,11 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     auto diff_b = (float) color.b - (float) background.b;
     auto b_r = (float) background.r;
     auto b_g = (float) background.g;
-    auto b_b = (float) background.g;
+    auto b_b = (float) background.b;
     for (int glyph_y = y_start + scan_y1; glyph_y != max_y; glyph_y++) {
+      // fully set pixels are collected into runs, so the display can fill them as a span instead of pixel by pixel
+      int run_start = 0;
+      int run_length = 0;
       for (int glyph_x = x_at + scan_x1; glyph_x != max_x; glyph_x++) {
         uint8_t pixel = 0;
         for (int bit_num = 0; bit_num != this->bpp_; bit_num++) {
@@ -150,14 +190,24 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
           bitmask >>= 1;
         }
         if (pixel == bpp_max) {
-          display->draw_pixel_at(glyph_x, glyph_y, color);
-        } else if (pixel != 0) {
+          if (run_length == 0)
+            run_start = glyph_x;
+          run_length++;
+          continue;
+        }
+        if (run_length != 0) {
+          display->fill_span(run_start, glyph_y, run_length, color);
+          run_length = 0;
+        }
+        if (pixel != 0) {
           auto on = (float) pixel / (float) bpp_max;
           auto blended =
               Color((uint8_t) (diff_r * on + b_r), (uint8_t) (diff_g * on + b_g), (uint8_t) (diff_b * on + b_b));
           display->draw_pixel_at(glyph_x, glyph_y, blended);
         }
       }
+      if (run_length != 0)
+        display->fill_span(run_start, glyph_y, run_length, color);
     }
     x_at += glyph.glyph_data_->width + glyph.glyph_data_->offset_x;
 
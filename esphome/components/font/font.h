@@ -52,8 +52,10 @@ class Font
    * @param glyphs A vector of glyphs, must be sorted lexicographically.
    * @param baseline The y-offset from the top of the text to the baseline.
    * @param bottom The y-offset from the top of the text to the bottom (i.e. height).
+   * @param data_base If set, the data of the glyphs are offsets from it. The glyphs are copied to point there.
    */
-  Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp = 1);
+  Font(const GlyphData *data, int data_nr, int baseline, int height, uint8_t bpp = 1,
+       const uint8_t *data_base = nullptr);
 
   int match_next_glyph(const uint8_t *str, int *match_length);
 
@@ -69,7 +71,26 @@ class Font
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
  protected:
+  /// Glyphs of single byte (ASCII) characters can be looked up directly by their code.
+  static constexpr uint8_t ASCII_INDEX_SIZE = 128;
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
+  /// Copy of the glyph data with the offsets resolved, for the fonts in an asset partition
+  std::vector<GlyphData, ExternalRAMAllocator<GlyphData>> glyph_data_;
+  /// Index into glyphs_ per ASCII character, -1 if the binary search has to be used
+  int16_t ascii_index_[ASCII_INDEX_SIZE];
+#ifdef USE_DISPLAY
+  /// Aligned text is measured before every print, mostly the same labels with each update. The last measured
+  /// strings are remembered by their hash and length.
+  static constexpr uint8_t MEASURE_CACHE_SIZE = 8;  // must be a power of two
+  struct MeasureCacheEntry {
+    uint32_t hash{};
+    uint32_t length{};  // 0 if unused
+    int width{};
+    int x_offset{};
+  };
+  MeasureCacheEntry measure_cache_[MEASURE_CACHE_SIZE]{};
+#endif
   int baseline_;
   int height_;
   uint8_t bpp_;  // bits per pixel
@@ -2,21 +2,40 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import binary_sensor
-from esphome.const import CONF_PIN
+from esphome.const import CONF_NUMBER, CONF_PIN
+from esphome.core import CORE
 from .. import gpio_ns
 
 GPIOBinarySensor = gpio_ns.class_(
     "GPIOBinarySensor", binary_sensor.BinarySensor, cg.Component
 )
 
-CONFIG_SCHEMA = (
+CONF_USE_INTERRUPT = "use_interrupt"
+
+
+def _validate_interrupt(config):
+    if not config[CONF_USE_INTERRUPT]:
+        return config
+    pin = config[CONF_PIN]
+    if pins.PIN_SCHEMA_REGISTRY.get_key(pin) != CORE.target_platform:
+        raise cv.Invalid(
+            "Interrupts are only supported on internal pins", [CONF_USE_INTERRUPT]
+        )
+    if CORE.is_esp8266 and pin[CONF_NUMBER] == 16:
+        raise cv.Invalid("GPIO16 has no interrupt support", [CONF_USE_INTERRUPT])
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
     binary_sensor.binary_sensor_schema(GPIOBinarySensor)
     .extend(
         {
             cv.Required(CONF_PIN): pins.gpio_input_pin_schema,
+            cv.Optional(CONF_USE_INTERRUPT, default=False): cv.boolean,
         }
     )
-    .extend(cv.COMPONENT_SCHEMA)
+    .extend(cv.COMPONENT_SCHEMA),
+    _validate_interrupt,
 )
 
 
@@ -26,3 +45,5 @@ async def to_code(config):
 
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
     cg.add(var.set_pin(pin))
+    if config[CONF_USE_INTERRUPT]:
+        cg.add(var.set_use_interrupt(True))
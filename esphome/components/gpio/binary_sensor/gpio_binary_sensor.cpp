@@ -1,4 +1,5 @@
 #include "gpio_binary_sensor.h"
+#include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -8,15 +9,79 @@ static const char *const TAG = "gpio.binary_sensor";
 
 void GPIOBinarySensor::setup() {
   this->pin_->setup();
-  this->publish_initial_state(this->pin_->digital_read());
+  const bool state = this->pin_->digital_read();
+  this->publish_initial_state(state);
+
+  if (this->use_interrupt_) {
+    // The config validation only allows internal pins with interrupts
+    auto *pin = static_cast<InternalGPIOPin *>(this->pin_);
+    this->isr_pin_ = pin->to_isr();
+    this->isr_level_ = state;
+    pin->attach_interrupt(&GPIOBinarySensor::gpio_intr, this, gpio::INTERRUPT_ANY_EDGE);
+    // loop() only runs when the interrupt latched an edge
+    this->disable_loop();
+  }
 }
 
 void GPIOBinarySensor::dump_config() {
   LOG_BINARY_SENSOR("", "GPIO Binary Sensor", this);
   LOG_PIN("  Pin: ", this->pin_);
+  ESP_LOGCONFIG(TAG, "  Use Interrupt: %s", YESNO(this->use_interrupt_));
+}
+
+void IRAM_ATTR GPIOBinarySensor::gpio_intr(GPIOBinarySensor *arg) {
+  const bool level = arg->isr_pin_.digital_read();
+  // A bounce may already be over when the interrupt reads the pin
+  if (level == arg->isr_level_)
+    return;
+  const uint8_t head = arg->edges_head_;
+  const uint8_t next = (head + 1) % EDGE_QUEUE_SIZE;
+  if (next == arg->edges_tail_) {
+    arg->edges_overflow_ = true;
+  } else {
+    arg->edges_[head] = {micros(), level};
+    arg->edges_head_ = next;
+    arg->isr_level_ = level;
+  }
+  arg->enable_loop_soon_from_isr();
 }
 
-void GPIOBinarySensor::loop() { this->publish_state(this->pin_->digital_read()); }
+void GPIOBinarySensor::loop() {
+  if (!this->use_interrupt_) {
+    this->publish_state(this->pin_->digital_read());
+    return;
+  }
+  this->process_edges_();
+  // An edge latched from now on enables the loop again after this iteration
+  this->disable_loop();
+}
+
+void GPIOBinarySensor::process_edges_() {
+  uint8_t tail = this->edges_tail_;
+  while (tail != this->edges_head_) {
+    const Edge edge = this->edges_[tail];
+    tail = (tail + 1) % EDGE_QUEUE_SIZE;
+    // Each state lasted until the next edge, the latest one lasts until now. The filters only let the states through
+    // that lasted long enough, so bounces within a single loop iteration are debounced as if they were seen live.
+    const uint32_t end = tail != this->edges_head_ ? this->edges_[tail].time : micros();
+    this->edges_tail_ = tail;
+    this->publish_state(edge.level, (end - edge.time) / 1000);
+  }
+
+  if (this->edges_overflow_) {
+    // Edges were dropped, start over from the current level
+    bool level;
+    {
+      InterruptLock lock;
+      level = this->pin_->digital_read();
+      this->isr_level_ = level;
+      this->edges_tail_ = this->edges_head_;
+      this->edges_overflow_ = false;
+    }
+    ESP_LOGW(TAG, "'%s': Edges came in faster than they could be handled", this->get_name().c_str());
+    this->publish_state(level);
+  }
+}
 
 float GPIOBinarySensor::get_setup_priority() const { return setup_priority::HARDWARE; }
 
@@ -10,6 +10,8 @@ namespace gpio {
 class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
  public:
   void set_pin(GPIOPin *pin) { pin_ = pin; }
+  /// Latch the edges of the pin in an interrupt, instead of reading it in every loop iteration. Needs an internal pin.
+  void set_use_interrupt(bool use_interrupt) { use_interrupt_ = use_interrupt; }
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Setup pin
@@ -21,7 +23,27 @@ class GPIOBinarySensor : public binary_sensor::BinarySensor, public Component {
   void loop() override;
 
  protected:
+  struct Edge {
+    /// micros() when the interrupt fired
+    uint32_t time;
+    bool level;
+  };
+  static const uint8_t EDGE_QUEUE_SIZE = 16;
+
+  static void gpio_intr(GPIOBinarySensor *arg);
+
+  void process_edges_();
+
   GPIOPin *pin_;
+  bool use_interrupt_{false};
+  ISRInternalGPIOPin isr_pin_;
+  /// Edges latched by the interrupt, written at the head by the interrupt only and read at the tail by the loop only
+  Edge edges_[EDGE_QUEUE_SIZE];
+  volatile uint8_t edges_head_{0};
+  volatile uint8_t edges_tail_{0};
+  volatile bool edges_overflow_{false};
+  /// Level of the last latched edge
+  volatile bool isr_level_{false};
 };
 
 }  // namespace gpio
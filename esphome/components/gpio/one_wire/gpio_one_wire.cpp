@@ -35,28 +35,28 @@ bool HOT IRAM_ATTR GPIOOneWireBus::reset() {
   } while (!pin_.digital_read());
 
   bool r;
+  {
+    // Only the time slots themselves are timing critical, the bus may idle with interrupts enabled between them
+    InterruptLock lock;
 
-  // Send 480µs LOW TX reset pulse (drive bus low, delay H)
-  pin_.pin_mode(gpio::FLAG_OUTPUT);
-  pin_.digital_write(false);
-  delayMicroseconds(480);
+    // Send 480µs LOW TX reset pulse (drive bus low, delay H)
+    pin_.pin_mode(gpio::FLAG_OUTPUT);
+    pin_.digital_write(false);
+    delayMicroseconds(480);
 
-  // Release the bus, delay I
-  pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
-  delayMicroseconds(70);
+    // Release the bus, delay I
+    pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
+    delayMicroseconds(70);
 
-  // sample bus, 0=device(s) present, 1=no device present
-  r = !pin_.digital_read();
+    // sample bus, 0=device(s) present, 1=no device present
+    r = !pin_.digital_read();
+  }
   // delay J
   delayMicroseconds(410);
   return r;
 }
 
 void HOT IRAM_ATTR GPIOOneWireBus::write_bit_(bool bit) {
-  // drive bus low
-  pin_.pin_mode(gpio::FLAG_OUTPUT);
-  pin_.digital_write(false);
-
   // from datasheet:
   // write 0 low time: t_low0: min=60µs, max=120µs
   // write 1 low time: t_low1: min=1µs, max=15µs
@@ -66,43 +66,56 @@ void HOT IRAM_ATTR GPIOOneWireBus::write_bit_(bool bit) {
   uint32_t delay0 = bit ? 6 : 60;
   uint32_t delay1 = bit ? 59 : 5;
 
-  // delay A/C
-  delayMicroseconds(delay0);
-  // release bus
-  pin_.digital_write(true);
+  {
+    // the low time must not be stretched, the recovery time has no upper limit
+    InterruptLock lock;
+    // drive bus low
+    pin_.pin_mode(gpio::FLAG_OUTPUT);
+    pin_.digital_write(false);
+
+    // delay A/C
+    delayMicroseconds(delay0);
+    // release bus
+    pin_.digital_write(true);
+  }
   // delay B/D
   delayMicroseconds(delay1);
 }
 
 bool HOT IRAM_ATTR GPIOOneWireBus::read_bit_() {
-  // drive bus low
-  pin_.pin_mode(gpio::FLAG_OUTPUT);
-  pin_.digital_write(false);
-
   // note: for reading we'll need very accurate timing, as the
   // timing for the digital_read() is tight; according to the datasheet,
   // we should read at the end of 16µs starting from the bus low
   // typically, the ds18b20 pulls the line high after 11µs for a logical 1
   // and 29µs for a logical 0
 
-  uint32_t start = micros();
-  // datasheet says >1µs
-  delayMicroseconds(2);
+  uint32_t start;
+  bool r;
+  {
+    InterruptLock lock;
+    // drive bus low
+    pin_.pin_mode(gpio::FLAG_OUTPUT);
+    pin_.digital_write(false);
+
+    start = micros();
+    // datasheet says >1µs
+    delayMicroseconds(2);
 
-  // release bus, delay E
-  pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
+    // release bus, delay E
+    pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
 
-  // measure from start value directly, to get best accurate timing no matter
-  // how long pin_mode/delayMicroseconds took
-  uint32_t now = micros();
-  if (now - start < 12)
-    delayMicroseconds(12 - (now - start));
+    // measure from start value directly, to get best accurate timing no matter
+    // how long pin_mode/delayMicroseconds took
+    uint32_t now = micros();
+    if (now - start < 12)
+      delayMicroseconds(12 - (now - start));
 
-  // sample bus to read bit from peer
-  bool r = pin_.digital_read();
+    // sample bus to read bit from peer
+    r = pin_.digital_read();
+  }
 
-  // read slot is at least 60µs; get as close to 60µs to spend less time with interrupts locked
-  now = micros();
+  // read slot is at least 60µs; the peer may still hold the bus low, so wait for the end of the slot
+  uint32_t now = micros();
   if (now - start < 60)
     delayMicroseconds(60 - (now - start));
 
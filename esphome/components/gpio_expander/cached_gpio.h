@@ -1,37 +1,41 @@
 #pragma once
 
-#include <array>
 #include <cstdint>
 #include "esphome/core/hal.h"
 
 namespace esphome {
 namespace gpio_expander {
 
-/// @brief A class to cache the read state of a GPIO expander.
+/** A class to cache the read state of a GPIO expander.
+ *
+ * The first read after reset_pin_cache_() takes a snapshot of all N inputs in a single bus transaction, every other
+ * pin is then served from that snapshot. Expanders reset the cache once per loop(), so all inputs cost at most one
+ * transaction per loop iteration, and none at all if nothing reads them.
+ */
 template<typename T, T N> class CachedGpioExpander {
  public:
   bool digital_read(T pin) {
-    if (!this->read_cache_invalidated_[pin]) {
-      this->read_cache_invalidated_[pin] = true;
-      return this->digital_read_cache(pin);
+    if (!this->read_cache_valid_) {
+      // A failed read isn't retried for every other pin of the same loop iteration
+      this->read_cache_valid_ = true;
+      this->digital_read_hw(pin);
     }
-    return this->digital_read_hw(pin);
+    return this->digital_read_cache(pin);
   }
 
   void digital_write(T pin, bool value) { this->digital_write_hw(pin, value); }
 
  protected:
+  /// Read all inputs into the cache, the pin is the one that triggered the read.
+  /// @return Whether the read succeeded.
   virtual bool digital_read_hw(T pin) = 0;
+  /// Return the state of the pin from the cache.
   virtual bool digital_read_cache(T pin) = 0;
   virtual void digital_write_hw(T pin, bool value) = 0;
 
-  void reset_pin_cache_() {
-    for (T i = 0; i < N; i++) {
-      this->read_cache_invalidated_[i] = false;
-    }
-  }
+  void reset_pin_cache_() { this->read_cache_valid_ = false; }
 
-  std::array<bool, N> read_cache_invalidated_{};
+  bool read_cache_valid_{false};
 };
 
 }  // namespace gpio_expander
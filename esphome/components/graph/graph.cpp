@@ -17,7 +17,8 @@ static const char *const TAGL = "graphlegend";
 
 void HistoryData::init(int length) {
   this->length_ = length;
-  this->samples_.resize(length, NAN);
+  this->mins_.resize(length, NAN);
+  this->maxs_.resize(length, NAN);
   this->last_sample_ = millis();
 }
 
@@ -26,27 +27,53 @@ void HistoryData::take_sample(float data) {
   uint32_t dt = tm - last_sample_;
   last_sample_ = tm;
 
-  // Step data based on time
+  // Step columns based on time
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
     this->period_ -= this->update_time_;
     this->count_ = (this->count_ + 1) % this->length_;
-    ESP_LOGV(TAG, "Updating trace with value: %f", data);
+    if (this->mins_[this->count_] == this->recent_min_ || this->maxs_[this->count_] == this->recent_max_)
+      this->extrema_stale_ = true;
+    this->mins_[this->count_] = this->last_value_;
+    this->maxs_[this->count_] = this->last_value_;
+    this->fresh_ = true;
   }
-  if (!std::isnan(data)) {
-    // Recalc recent max/min
-    this->recent_min_ = data;
-    this->recent_max_ = data;
+  ESP_LOGV(TAG, "Updating trace with value: %f", data);
+
+  float &mn = this->mins_[this->count_];
+  float &mx = this->maxs_[this->count_];
+  if (this->fresh_ || std::isnan(mn)) {
+    mn = data;
+    mx = data;
+    this->fresh_ = false;
+  } else if (!std::isnan(data)) {
+    mn = std::min(mn, data);
+    mx = std::max(mx, data);
+  }
+  this->last_value_ = data;
+  this->update_extrema_(data);
+}
+
+void HistoryData::update_extrema_(float data) {
+  if (this->extrema_stale_) {
+    // Only needed when a column with an extreme value scrolled out, at most once per column
+    this->extrema_stale_ = false;
+    this->recent_min_ = NAN;
+    this->recent_max_ = NAN;
     for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
+      if (!std::isnan(this->mins_[i]) && !(this->recent_min_ <= this->mins_[i]))
+        this->recent_min_ = this->mins_[i];
+      if (!std::isnan(this->maxs_[i]) && !(this->recent_max_ >= this->maxs_[i]))
+        this->recent_max_ = this->maxs_[i];
     }
+    return;
   }
+  if (std::isnan(data))
+    return;
+  if (!(this->recent_min_ <= data))
+    this->recent_min_ = data;
+  if (!(this->recent_max_ >= data))
+    this->recent_max_ = data;
 }
 
 void GraphTrace::init(Graph *g) {
@@ -88,16 +115,17 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
     float mn = NAN;
     for (uint32_t i = 0; i < this->width_; i++) {
       for (auto *trace : traces_) {
-        float v = trace->get_tracedata()->get_value(i);
-        if (!std::isnan(v)) {
-          if ((v - mn) > this->max_range_)
+        float vmin = trace->get_tracedata()->get_min(i);
+        float vmax = trace->get_tracedata()->get_max(i);
+        if (!std::isnan(vmin)) {
+          if ((vmax - mn) > this->max_range_)
             break;
-          if ((mx - v) > this->max_range_)
+          if ((mx - vmin) > this->max_range_)
             break;
-          if (std::isnan(mx) || (v > mx))
-            mx = v;
-          if (std::isnan(mn) || (v < mn))
-            mn = v;
+          if (std::isnan(mx) || (vmax > mx))
+            mx = vmax;
+          if (std::isnan(mn) || (vmin < mn))
+            mn = vmin;
         }
       }
     }
@@ -168,38 +196,43 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
     bool continuous = trace->get_continuous();
     bool has_prev = false;
     bool prev_b = false;
-    int16_t prev_y = 0;
+    int16_t prev_top = 0;
+    int16_t prev_bottom = 0;
     for (uint32_t i = 0; i < this->width_; i++) {
-      float v = (trace->get_tracedata()->get_value(i) - ymin) / yrange;
-      if (!std::isnan(v) && (thick > 0)) {
+      float vmin = (trace->get_tracedata()->get_min(i) - ymin) / yrange;
+      float vmax = (trace->get_tracedata()->get_max(i) - ymin) / yrange;
+      if (!std::isnan(vmin) && (thick > 0)) {
         int16_t x = this->width_ - 1 - i + x_offset;
         uint8_t bit = 1 << ((i % (thick * LineType::PATTERN_LENGTH)) / thick);
         bool b = (trace->get_line_type() & bit) == bit;
         if (b) {
-          int16_t y = (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - thick / 2 + y_offset;
+          // Each column spans everything published while it was current
+          int16_t top = (int16_t) roundf((this->height_ - 1) * (1.0 - vmax)) - thick / 2 + y_offset;
+          int16_t bottom = (int16_t) roundf((this->height_ - 1) * (1.0 - vmin)) - thick / 2 + y_offset;
           auto draw_pixel_at = [&buff, c, y_offset, this](int16_t x, int16_t y) {
             if (y >= y_offset && y < y_offset + this->height_)
               buff->draw_pixel_at(x, y, c);
           };
-          if (!continuous || !has_prev || !prev_b || (abs(y - prev_y) <= thick)) {
-            for (int16_t t = 0; t < thick; t++) {
-              draw_pixel_at(x, y + t);
-            }
-          } else {
-            int16_t mid_y = (y + prev_y + thick) / 2;
-            if (y > prev_y) {
-              for (int16_t t = prev_y + thick; t <= mid_y; t++)
+          for (int16_t t = top; t < bottom + thick; t++) {
+            draw_pixel_at(x, t);
+          }
+          if (continuous && has_prev && prev_b) {
+            if (top > prev_bottom + thick) {
+              int16_t mid_y = (top + prev_bottom + thick) / 2;
+              for (int16_t t = prev_bottom + thick; t <= mid_y; t++)
                 draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y + 1; t < y + thick; t++)
+              for (int16_t t = mid_y + 1; t < top; t++)
                 draw_pixel_at(x, t);
-            } else {
-              for (int16_t t = prev_y - 1; t >= mid_y; t--)
+            } else if (bottom + thick < prev_top) {
+              int16_t mid_y = (bottom + prev_top + thick) / 2;
+              for (int16_t t = prev_top - 1; t >= mid_y; t--)
                 draw_pixel_at(x + 1, t);
-              for (int16_t t = mid_y - 1; t >= y; t--)
+              for (int16_t t = mid_y - 1; t >= bottom + thick; t--)
                 draw_pixel_at(x, t);
             }
           }
-          prev_y = y;
+          prev_top = top;
+          prev_bottom = bottom;
         }
         prev_b = b;
         has_prev = true;
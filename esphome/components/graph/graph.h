@@ -83,6 +83,11 @@ class GraphLegend {
   friend Graph;
 };
 
+/** History of a trace, one column per pixel.
+ *
+ * Every published value is folded into the min and max of the current column, so that short spikes still show up on
+ * graphs spanning hours. A column that passes without a value holds the last one published.
+ */
 class HistoryData {
  public:
   void init(int length);
@@ -90,19 +95,31 @@ class HistoryData {
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
   int get_length() const { return length_; }
-  float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
+  /// Lowest value of column `idx`, 0 being the current one.
+  float get_min(int idx) const { return mins_[(count_ + length_ - idx) % length_]; }
+  /// Highest value of column `idx`, 0 being the current one.
+  float get_max(int idx) const { return maxs_[(count_ + length_ - idx) % length_]; }
   float get_recent_max() const { return recent_max_; }
   float get_recent_min() const { return recent_min_; }
 
  protected:
+  void update_extrema_(float data);
+
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
   int length_;
+  /// The current column
   int count_{0};
+  /// Whether the current column still holds the value of the previous one
+  bool fresh_{true};
+  /// Whether a column holding recent_min_ or recent_max_ was dropped
+  bool extrema_stale_{false};
+  float last_value_{NAN};
   float recent_min_{NAN};
   float recent_max_{NAN};
-  std::vector<float> samples_;
+  std::vector<float> mins_;
+  std::vector<float> maxs_;
 };
 
 class GraphTrace {
@@ -42,6 +42,7 @@ CONF_REDIRECT_LIMIT = "redirect_limit"
 CONF_WATCHDOG_TIMEOUT = "watchdog_timeout"
 CONF_BUFFER_SIZE_RX = "buffer_size_rx"
 CONF_BUFFER_SIZE_TX = "buffer_size_tx"
+CONF_KEEP_ALIVE_TIMEOUT = "keep_alive_timeout"
 
 CONF_MAX_RESPONSE_BUFFER_SIZE = "max_response_buffer_size"
 CONF_ON_RESPONSE = "on_response"
@@ -118,6 +119,9 @@ CONFIG_SCHEMA = cv.All(
             cv.SplitDefault(CONF_BUFFER_SIZE_TX, esp32_idf=512): cv.All(
                 cv.uint16_t, cv.only_with_esp_idf
             ),
+            cv.Optional(CONF_KEEP_ALIVE_TIMEOUT): cv.All(
+                cv.positive_time_period_milliseconds, cv.only_with_esp_idf
+            ),
         }
     ).extend(cv.COMPONENT_SCHEMA),
     cv.require_framework_version(
@@ -147,6 +151,11 @@ async def to_code(config):
         if CORE.using_esp_idf:
             cg.add(var.set_buffer_size_rx(config[CONF_BUFFER_SIZE_RX]))
             cg.add(var.set_buffer_size_tx(config[CONF_BUFFER_SIZE_TX]))
+            if CONF_KEEP_ALIVE_TIMEOUT in config:
+                cg.add(var.set_keep_alive_timeout(config[CONF_KEEP_ALIVE_TIMEOUT]))
+                esp32.add_idf_sdkconfig_option(
+                    "CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS", True
+                )
 
             esp32.add_idf_sdkconfig_option(
                 "CONFIG_MBEDTLS_CERTIFICATE_BUNDLE",
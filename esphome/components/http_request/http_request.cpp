@@ -3,6 +3,7 @@
 #include "esphome/core/log.h"
 
 #include <cinttypes>
+#include <new>
 
 namespace esphome {
 namespace http_request {
@@ -20,5 +21,36 @@ void HttpRequestComponent::dump_config() {
   }
 }
 
+bool HttpContainer::read_to(const std::function<bool(const uint8_t *data, size_t len)> &sink, size_t chunk_size) {
+  std::unique_ptr<uint8_t[]> buf(new (std::nothrow) uint8_t[chunk_size]);  // NOLINT(cppcoreguidelines-owning-memory)
+  if (!buf) {
+    ESP_LOGE(TAG, "Can't allocate %zu bytes to read the response", chunk_size);
+    return false;
+  }
+  uint32_t last_data = millis();
+  while (this->bytes_read_ < this->content_length) {
+    int read = this->read(buf.get(), chunk_size);
+    App.feed_wdt();
+    yield();
+    if (read < 0) {
+      ESP_LOGE(TAG, "Reading the response failed");
+      return false;
+    }
+    const uint32_t now = millis();
+    if (read == 0) {
+      // no data available yet
+      if (now - last_data > this->parent_->get_timeout()) {
+        ESP_LOGE(TAG, "Timeout reading the response");
+        return false;
+      }
+      continue;
+    }
+    last_data = now;
+    if (!sink(buf.get(), read))
+      return false;
+  }
+  return true;
+}
+
 }  // namespace http_request
 }  // namespace esphome
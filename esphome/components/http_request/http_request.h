@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -38,6 +39,15 @@ class HttpContainer : public Parented<HttpRequestComponent> {
 
   size_t get_bytes_read() const { return this->bytes_read_; }
 
+  /** Read the rest of the body and pass it to sink in chunks as they arrive.
+   *
+   * Only one chunk is buffered at a time, so memory use does not depend on the size of the response. The sink may
+   * return false to stop reading early.
+   *
+   * @return true if the whole body was read, false on a read error, a timeout or when the sink stopped.
+   */
+  bool read_to(const std::function<bool(const uint8_t *data, size_t len)> &sink, size_t chunk_size = 512);
+
  protected:
   size_t bytes_read_{0};
   bool secure_{false};
@@ -58,6 +68,7 @@ class HttpRequestComponent : public Component {
   void set_useragent(const char *useragent) { this->useragent_ = useragent; }
   void set_timeout(uint16_t timeout) { this->timeout_ = timeout; }
   void set_watchdog_timeout(uint32_t watchdog_timeout) { this->watchdog_timeout_ = watchdog_timeout; }
+  uint16_t get_timeout() const { return this->timeout_; }
   uint32_t get_watchdog_timeout() const { return this->watchdog_timeout_; }
   void set_follow_redirects(bool follow_redirects) { this->follow_redirects_ = follow_redirects; }
   void set_redirect_limit(uint16_t limit) { this->redirect_limit_ = limit; }
@@ -13,15 +13,81 @@
 #include "esp_crt_bundle.h"
 #endif
 
+#include <cinttypes>
+#include <esp_idf_version.h>
+
 namespace esphome {
 namespace http_request {
 
 static const char *const TAG = "http_request.idf";
+/// Most devices poll one or two servers, more idle connections would only hold on to TLS buffers
+static const size_t MAX_IDLE_CLIENTS = 2;
+
+/// scheme://host:port of a URL, the part a connection can be reused for.
+static std::string url_origin(const std::string &url) {
+  size_t authority = url.find("://");
+  if (authority == std::string::npos)
+    return url;
+  return url.substr(0, url.find('/', authority + 3));
+}
 
 void HttpRequestIDF::dump_config() {
   HttpRequestComponent::dump_config();
   ESP_LOGCONFIG(TAG, "  Buffer Size RX: %u", this->buffer_size_rx_);
   ESP_LOGCONFIG(TAG, "  Buffer Size TX: %u", this->buffer_size_tx_);
+  if (this->keep_alive_timeout_ > 0) {
+    ESP_LOGCONFIG(TAG, "  Keep-Alive Timeout: %" PRIu32 "ms", this->keep_alive_timeout_);
+  }
+}
+
+esp_http_client_handle_t HttpRequestIDF::acquire_client_(const std::string &origin) {
+  this->close_idle_clients_(true);
+  for (auto it = this->idle_clients_.begin(); it != this->idle_clients_.end(); ++it) {
+    if (it->origin != origin)
+      continue;
+    esp_http_client_handle_t client = it->client;
+    for (const auto &name : it->header_names)
+      esp_http_client_delete_header(client, name.c_str());
+    this->idle_clients_.erase(it);
+    return client;
+  }
+  return nullptr;
+}
+
+void HttpRequestIDF::release_client(esp_http_client_handle_t client, std::string &&origin,
+                                    std::vector<std::string> &&header_names) {
+  if (this->keep_alive_timeout_ == 0 || !esp_http_client_is_complete_data_received(client)) {
+    // the rest of the response is still on the connection, it can't be reused
+    esp_http_client_close(client);
+    esp_http_client_cleanup(client);
+    return;
+  }
+  if (this->idle_clients_.size() >= MAX_IDLE_CLIENTS) {
+    esp_http_client_close(this->idle_clients_.front().client);
+    esp_http_client_cleanup(this->idle_clients_.front().client);
+    this->idle_clients_.erase(this->idle_clients_.begin());
+  }
+  this->idle_clients_.push_back(IdleClient{
+      .client = client,
+      .origin = std::move(origin),
+      .header_names = std::move(header_names),
+      .released = millis(),
+  });
+  this->set_timeout("keep_alive", this->keep_alive_timeout_, [this]() { this->close_idle_clients_(false); });
+}
+
+void HttpRequestIDF::close_idle_clients_(bool expired_only) {
+  const uint32_t now = millis();
+  auto it = this->idle_clients_.begin();
+  while (it != this->idle_clients_.end()) {
+    if (expired_only && now - it->released < this->keep_alive_timeout_) {
+      ++it;
+      continue;
+    }
+    esp_http_client_close(it->client);
+    esp_http_client_cleanup(it->client);
+    it = this->idle_clients_.erase(it);
+  }
 }
 
 std::shared_ptr<HttpContainer> HttpRequestIDF::start(std::string url, std::string method, std::string body,
@@ -72,10 +138,28 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::start(std::string url, std::strin
   config.buffer_size = this->buffer_size_rx_;
   config.buffer_size_tx = this->buffer_size_tx_;
 
+#if defined(CONFIG_ESP_TLS_CLIENT_SESSION_TICKETS) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  // resume the TLS session when a kept-alive connection was closed by the server
+  config.save_client_session = this->keep_alive_timeout_ > 0;
+#endif
+
   const uint32_t start = millis();
   watchdog::WatchdogManager wdm(this->get_watchdog_timeout());
 
-  esp_http_client_handle_t client = esp_http_client_init(&config);
+  std::string origin;
+  esp_http_client_handle_t client = nullptr;
+  if (this->keep_alive_timeout_ > 0) {
+    origin = url_origin(url);
+    client = this->acquire_client_(origin);
+  }
+  bool reused = client != nullptr;
+  if (reused) {
+    esp_http_client_set_url(client, url.c_str());
+    esp_http_client_set_method(client, method_idf);
+    esp_http_client_set_timeout_ms(client, this->timeout_);
+  } else {
+    client = esp_http_client_init(&config);
+  }
 
   std::shared_ptr<HttpContainerIDF> container = std::make_shared<HttpContainerIDF>(client);
   container->set_parent(this);
@@ -89,6 +173,12 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::start(std::string url, std::strin
   const int body_len = body.length();
 
   esp_err_t err = esp_http_client_open(client, body_len);
+  if (err != ESP_OK && reused) {
+    // the server closed the idle connection, open a new one
+    ESP_LOGV(TAG, "Reconnecting kept-alive connection: %s", esp_err_to_name(err));
+    esp_http_client_close(client);
+    err = esp_http_client_open(client, body_len);
+  }
   if (err != ESP_OK) {
     this->status_momentary_error("failed", 1000);
     ESP_LOGE(TAG, "HTTP Request failed: %s", esp_err_to_name(err));
@@ -124,6 +214,12 @@ std::shared_ptr<HttpContainer> HttpRequestIDF::start(std::string url, std::strin
   container->status_code = esp_http_client_get_status_code(client);
   if (is_ok(container->status_code)) {
     container->duration_ms = millis() - start;
+    if (this->keep_alive_timeout_ > 0) {
+      std::vector<std::string> header_names;
+      for (const auto &header : headers)
+        header_names.emplace_back(header.name);
+      container->set_keep_alive(this, std::move(origin), std::move(header_names));
+    }
     return container;
   }
 
@@ -199,6 +295,10 @@ int HttpContainerIDF::read(uint8_t *buf, size_t max_len) {
 void HttpContainerIDF::end() {
   watchdog::WatchdogManager wdm(this->parent_->get_watchdog_timeout());
 
+  if (this->pool_ != nullptr) {
+    this->pool_->release_client(this->client_, std::move(this->origin_), std::move(this->header_names_));
+    return;
+  }
   esp_http_client_close(this->client_);
   esp_http_client_cleanup(this->client_);
 }
@@ -9,17 +9,32 @@
 #include <esp_netif.h>
 #include <esp_tls.h>
 
+#include <string>
+#include <vector>
+
 namespace esphome {
 namespace http_request {
 
+class HttpRequestIDF;
+
 class HttpContainerIDF : public HttpContainer {
  public:
   HttpContainerIDF(esp_http_client_handle_t client) : client_(client) {}
   int read(uint8_t *buf, size_t max_len) override;
   void end() override;
 
+  /// Hand the connection back to the keep-alive pool of pool in end() instead of closing it.
+  void set_keep_alive(HttpRequestIDF *pool, std::string origin, std::vector<std::string> header_names) {
+    this->pool_ = pool;
+    this->origin_ = std::move(origin);
+    this->header_names_ = std::move(header_names);
+  }
+
  protected:
   esp_http_client_handle_t client_;
+  HttpRequestIDF *pool_{nullptr};
+  std::string origin_;
+  std::vector<std::string> header_names_;
 };
 
 class HttpRequestIDF : public HttpRequestComponent {
@@ -31,8 +46,27 @@ class HttpRequestIDF : public HttpRequestComponent {
 
   void set_buffer_size_rx(uint16_t buffer_size_rx) { this->buffer_size_rx_ = buffer_size_rx; }
   void set_buffer_size_tx(uint16_t buffer_size_tx) { this->buffer_size_tx_ = buffer_size_tx; }
+  /// Keep connections open for reuse for this long after a request, 0 disables keep-alive.
+  void set_keep_alive_timeout(uint32_t keep_alive_timeout) { this->keep_alive_timeout_ = keep_alive_timeout; }
+
+  /// Return a client whose response was read completely to the pool, or close it.
+  void release_client(esp_http_client_handle_t client, std::string &&origin, std::vector<std::string> &&header_names);
 
  protected:
+  struct IdleClient {
+    esp_http_client_handle_t client;
+    /// scheme://host:port of the connection
+    std::string origin;
+    /// Headers set for the last request, they stay on the handle until deleted
+    std::vector<std::string> header_names;
+    uint32_t released;
+  };
+  /// Take an idle client connected to origin out of the pool, nullptr if there is none.
+  esp_http_client_handle_t acquire_client_(const std::string &origin);
+  void close_idle_clients_(bool expired_only);
+
+  std::vector<IdleClient> idle_clients_;
+  uint32_t keep_alive_timeout_{0};
   // if zero ESP-IDF will use DEFAULT_HTTP_BUF_SIZE
   uint16_t buffer_size_rx_{};
   uint16_t buffer_size_tx_{};
@@ -7,8 +7,15 @@ from esphome.const import (
     CONF_URL,
     CONF_USERNAME,
 )
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import (
+    VARIANT_ESP32,
+    VARIANT_ESP32C3,
+    VARIANT_ESP32S2,
+    VARIANT_ESP32S3,
+)
 from esphome.components.ota import BASE_OTA_SCHEMA, ota_to_code, OTAComponent
-from esphome.core import coroutine_with_priority
+from esphome.core import CORE, coroutine_with_priority
 from .. import CONF_HTTP_REQUEST_ID, http_request_ns, HttpRequestComponent
 
 CODEOWNERS = ["@oarcher"]
@@ -19,6 +26,9 @@ DEPENDENCIES = ["network", "http_request"]
 CONF_MD5 = "md5"
 CONF_MD5_URL = "md5_url"
 
+# Variants with an inflate implementation in ROM, for gzip compressed images
+INFLATE_VARIANTS = (VARIANT_ESP32, VARIANT_ESP32C3, VARIANT_ESP32S2, VARIANT_ESP32S3)
+
 OtaHttpRequestComponent = http_request_ns.class_(
     "OtaHttpRequestComponent", OTAComponent
 )
@@ -50,6 +60,8 @@ async def to_code(config):
     await ota_to_code(var, config)
     await cg.register_component(var, config)
     await cg.register_parented(var, config[CONF_HTTP_REQUEST_ID])
+    if CORE.is_esp32 and get_esp32_variant() in INFLATE_VARIANTS:
+        cg.add_define("USE_OTA_INFLATE")
 
 
 OTA_HTTP_REQUEST_FLASH_ACTION_SCHEMA = cv.All(
@@ -11,6 +11,7 @@
 #include "esphome/components/ota/ota_backend_arduino_esp8266.h"
 #include "esphome/components/ota/ota_backend_arduino_rp2040.h"
 #include "esphome/components/ota/ota_backend_esp_idf.h"
+#include "esphome/components/ota/ota_backend_inflate.h"
 
 namespace esphome {
 namespace http_request {
@@ -76,7 +77,7 @@ void OtaHttpRequestComponent::flash() {
 
 void OtaHttpRequestComponent::cleanup_(std::unique_ptr<ota::OTABackend> backend,
                                        const std::shared_ptr<HttpContainer> &container) {
-  if (this->update_started_) {
+  if (this->update_started_ && backend != nullptr) {
     ESP_LOGV(TAG, "Aborting OTA backend");
     backend->abort();
   }
@@ -114,14 +115,9 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
   md5_receive.init();
   ESP_LOGV(TAG, "MD5Digest initialized");
 
-  ESP_LOGV(TAG, "OTA backend begin");
-  auto backend = ota::make_ota_backend();
-  auto error_code = backend->begin(container->content_length);
-  if (error_code != ota::OTA_RESPONSE_OK) {
-    ESP_LOGW(TAG, "backend->begin error: %d", error_code);
-    this->cleanup_(std::move(backend), container);
-    return error_code;
-  }
+  // started with the first data, which tells whether the image is compressed
+  std::unique_ptr<ota::OTABackend> backend;
+  uint8_t error_code;
 
   while (container->get_bytes_read() < container->content_length) {
     // read a maximum of chunk_size bytes into buf. (real read size returned)
@@ -141,6 +137,21 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
       // add read bytes to MD5
       md5_receive.add(buf, bufsize);
 
+      if (backend == nullptr) {
+        ESP_LOGV(TAG, "OTA backend begin");
+        backend = this->make_backend_(buf, bufsize);
+        if (backend == nullptr) {
+          this->cleanup_(std::move(backend), container);
+          return ota::OTA_RESPONSE_ERROR_MAGIC;
+        }
+        error_code = backend->begin(container->content_length);
+        if (error_code != ota::OTA_RESPONSE_OK) {
+          ESP_LOGW(TAG, "backend->begin error: %d", error_code);
+          this->cleanup_(std::move(backend), container);
+          return error_code;
+        }
+      }
+
       // write bytes to OTA backend
       this->update_started_ = true;
       error_code = backend->write(buf, bufsize);
@@ -166,6 +177,11 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
   }  // while
 
   ESP_LOGI(TAG, "Done in %.0f seconds", float(millis() - update_start_time) / 1000);
+  if (backend == nullptr) {
+    ESP_LOGE(TAG, "Image is empty");
+    this->cleanup_(std::move(backend), container);
+    return OTA_CONNECTION_ERROR;
+  }
 
   // verify MD5 is as expected and act accordingly
   md5_receive.calculate();
@@ -197,6 +213,20 @@ uint8_t OtaHttpRequestComponent::do_ota_() {
   return ota::OTA_RESPONSE_OK;
 }
 
+std::unique_ptr<ota::OTABackend> OtaHttpRequestComponent::make_backend_(const uint8_t *data, size_t len) {
+  auto backend = ota::make_ota_backend();
+  const bool compressed = len >= 2 && data[0] == 0x1F && data[1] == 0x8B;
+  if (!compressed || backend->supports_compression())
+    return backend;
+#ifdef USE_OTA_INFLATE
+  ESP_LOGD(TAG, "Inflating gzip compressed image");
+  return make_unique<ota::InflateOTABackend>(std::move(backend));
+#else
+  ESP_LOGE(TAG, "Compressed images are not supported on this platform");
+  return nullptr;
+#endif
+}
+
 std::string OtaHttpRequestComponent::get_url_with_auth_(const std::string &url) {
   if (this->username_.empty() || this->password_.empty()) {
     return url;
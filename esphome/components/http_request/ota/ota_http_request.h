@@ -42,6 +42,8 @@ class OtaHttpRequestComponent : public ota::OTAComponent, public Parented<HttpRe
  protected:
   void cleanup_(std::unique_ptr<ota::OTABackend> backend, const std::shared_ptr<HttpContainer> &container);
   uint8_t do_ota_();
+  /// The backend for an image starting with `data`, gzip compressed images are inflated where needed.
+  std::unique_ptr<ota::OTABackend> make_backend_(const uint8_t *data, size_t len);
   std::string get_url_with_auth_(const std::string &url);
   bool http_get_md5_();
   bool validate_url_(const std::string &url);
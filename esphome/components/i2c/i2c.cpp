@@ -41,6 +41,31 @@ ErrorCode I2CDevice::write_register16(uint16_t a_register, const uint8_t *data,
   return bus_->writev(address_, buffers, 2, stop);
 }
 
+bool I2CDevice::read_register_async(uint8_t a_register, size_t len,
+                                    std::function<void(ErrorCode, const uint8_t *, size_t)> &&callback) {
+  auto transaction = make_unique<I2CTransaction>();
+  transaction->address = this->address_;
+  transaction->write_data.push_back(a_register);
+  transaction->read_data.resize(len);
+  transaction->callback = [callback = std::move(callback)](const I2CTransaction &t) {
+    callback(t.error, t.read_data.data(), t.read_data.size());
+  };
+  return this->bus_->submit(std::move(transaction));
+}
+
+bool I2CDevice::write_register_async(uint8_t a_register, const uint8_t *data, size_t len,
+                                     std::function<void(ErrorCode)> &&callback) {
+  auto transaction = make_unique<I2CTransaction>();
+  transaction->address = this->address_;
+  transaction->write_data.reserve(len + 1);
+  transaction->write_data.push_back(a_register);
+  transaction->write_data.insert(transaction->write_data.end(), data, data + len);
+  if (callback) {
+    transaction->callback = [callback = std::move(callback)](const I2CTransaction &t) { callback(t.error); };
+  }
+  return this->bus_->submit(std::move(transaction));
+}
+
 bool I2CDevice::read_bytes_16(uint8_t a_register, uint16_t *data, uint8_t len) {
   if (read_register(a_register, reinterpret_cast<uint8_t *>(data), len * 2) != ERROR_OK)
     return false;
@@ -203,6 +203,23 @@ class I2CDevice {
   /// @return an i2c::ErrorCode
   ErrorCode write_register16(uint16_t a_register, const uint8_t *data, size_t len, bool stop = true);
 
+  /// @brief queues a read of an array of bytes from a specific register in the I²C device
+  /// @param a_register an 8 bits internal address of the I²C register to read from
+  /// @param len number of bytes to read
+  /// @param callback called with the result and the bytes read once the transfer completed
+  /// @return false if the bus could not queue the read, the callback is not called then
+  bool read_register_async(uint8_t a_register, size_t len,
+                           std::function<void(ErrorCode, const uint8_t *, size_t)> &&callback);
+
+  /// @brief queues a write of an array of bytes to a specific register in the I²C device
+  /// @param a_register the internal address of the register to write to
+  /// @param data pointer to the bytes to send, they are copied before returning
+  /// @param len number of bytes to write
+  /// @param callback optionally called with the result once the transfer completed
+  /// @return false if the bus could not queue the write, the callback is not called then
+  bool write_register_async(uint8_t a_register, const uint8_t *data, size_t len,
+                            std::function<void(ErrorCode)> &&callback = nullptr);
+
   ///
   /// Compat APIs
   /// All methods below have been added for compatibility reasons. They do not bring any functionality and therefore on
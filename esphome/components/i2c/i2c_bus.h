@@ -1,6 +1,8 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <functional>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -32,6 +34,16 @@ struct WriteBuffer {
   size_t len;           ///< length of the buffer
 };
 
+/// @brief An I2C transfer queued with I2CBus::submit(): an optional write followed by an optional read
+struct I2CTransaction {
+  uint8_t address;                  ///< address of the I²C component on the i2c bus
+  std::vector<uint8_t> write_data;  ///< bytes sent first, usually the register address
+  std::vector<uint8_t> read_data;   ///< sized to the number of bytes to read, holds them once completed
+  bool stop{true};                  ///< send a stop after the write instead of a restart before the read
+  ErrorCode error{ERROR_OK};        ///< result of the transfer, set before the callback is called
+  std::function<void(const I2CTransaction &)> callback;  ///< called from the main loop once completed
+};
+
 /// @brief This Class provides the methods to read and write bytes from an I2CBus.
 /// @note The I2CBus virtual class follows a *Factory design pattern* that provides all the interfaces methods required
 /// by clients while deferring the actual implementation of these methods to a subclasses. I2C-bus specification and
@@ -91,7 +103,32 @@ class I2CBus {
   /// @details This is a pure virtual method that must be implemented in the subclass.
   virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t count, bool stop) = 0;
 
+  /// @brief Queues a transaction, its callback is called once it completed
+  /// @param transaction the transfer to perform
+  /// @return false if the transaction could not be queued, its callback is not called then
+  /// @details Buses without a worker task perform the transaction before returning, buses with one perform it in
+  /// the background and call the callback from the main loop.
+  virtual bool submit(std::unique_ptr<I2CTransaction> transaction) {
+    this->execute_transaction_(*transaction);
+    if (transaction->callback)
+      transaction->callback(*transaction);
+    return true;
+  }
+
  protected:
+  /// @brief Performs the write and read of a transaction, storing the result in its error field
+  void execute_transaction_(I2CTransaction &transaction) {
+    // A transaction without data probes the address, like i2c_scan_()
+    if (!transaction.write_data.empty() || transaction.read_data.empty()) {
+      transaction.error = this->write(transaction.address, transaction.write_data.data(),
+                                      transaction.write_data.size(), transaction.stop);
+      if (transaction.error != ERROR_OK)
+        return;
+    }
+    if (!transaction.read_data.empty())
+      transaction.error = this->read(transaction.address, transaction.read_data.data(), transaction.read_data.size());
+  }
+
   /// @brief Scans the I2C bus for devices. Devices presence is kept in an array of std::pair
   /// that contains the address and the corresponding bool presence flag.
   void i2c_scan_() {
@@ -13,6 +13,8 @@ namespace i2c {
 
 static const char *const TAG = "i2c.idf";
 
+static const size_t ASYNC_QUEUE_LENGTH = 16;
+
 void IDFI2CBus::setup() {
   ESP_LOGCONFIG(TAG, "Setting up I2C bus...");
   static i2c_port_t next_port = I2C_NUM_0;
@@ -70,6 +72,59 @@ void IDFI2CBus::setup() {
     ESP_LOGV(TAG, "Scanning i2c bus for active devices...");
     this->i2c_scan_();
   }
+
+  if (this->async_) {
+    this->request_queue_ = xQueueCreate(ASYNC_QUEUE_LENGTH, sizeof(I2CTransaction *));
+    this->completion_queue_ = xQueueCreate(ASYNC_QUEUE_LENGTH, sizeof(I2CTransaction *));
+    if (this->request_queue_ == nullptr || this->completion_queue_ == nullptr) {
+      ESP_LOGW(TAG, "Failed to create the transaction queues, transactions will block");
+      this->async_ = false;
+    } else {
+      xTaskCreate(IDFI2CBus::worker_task, "i2c_worker", 3072, (void *) this, 2, &this->worker_task_handle_);
+      if (this->worker_task_handle_ == nullptr) {
+        ESP_LOGW(TAG, "Failed to create the worker task, transactions will block");
+        this->async_ = false;
+      }
+    }
+  }
+  if (!this->async_)
+    this->disable_loop();
+}
+
+void IDFI2CBus::loop() {
+  // Callbacks run here, so components never see their results from another task
+  I2CTransaction *completed;
+  while (xQueueReceive(this->completion_queue_, &completed, 0) == pdTRUE) {
+    std::unique_ptr<I2CTransaction> transaction(completed);
+    if (transaction->callback)
+      transaction->callback(*transaction);
+  }
+}
+
+bool IDFI2CBus::submit(std::unique_ptr<I2CTransaction> transaction) {
+  if (!this->async_)
+    return I2CBus::submit(std::move(transaction));
+  I2CTransaction *queued = transaction.release();
+  if (xQueueSend(this->request_queue_, &queued, 0) != pdTRUE) {
+    ESP_LOGVV(TAG, "Transaction queue full, dropping transaction to %02X", queued->address);
+    delete queued;  // NOLINT(cppcoreguidelines-owning-memory)
+    return false;
+  }
+  return true;
+}
+
+void IDFI2CBus::worker_task(void *params) {
+  IDFI2CBus *this_bus = (IDFI2CBus *) params;
+  I2CTransaction *transaction;
+  while (true) {
+    if (xQueueReceive(this_bus->request_queue_, &transaction, portMAX_DELAY) != pdTRUE)
+      continue;
+    {
+      LockGuard guard(this_bus->lock_);
+      this_bus->execute_transaction_(*transaction);
+    }
+    xQueueSend(this_bus->completion_queue_, &transaction, portMAX_DELAY);
+  }
 }
 void IDFI2CBus::dump_config() {
   ESP_LOGCONFIG(TAG, "I2C Bus:");
@@ -90,6 +145,7 @@ void IDFI2CBus::dump_config() {
       ESP_LOGCONFIG(TAG, "  Recovery: failed, SDA is held low on the bus");
       break;
   }
+  ESP_LOGCONFIG(TAG, "  Async Transactions: %s", YESNO(this->async_));
   if (this->scan_) {
     ESP_LOGI(TAG, "Results from i2c bus scan:");
     if (scan_results_.empty()) {
@@ -107,6 +163,30 @@ void IDFI2CBus::dump_config() {
 }
 
 ErrorCode IDFI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+  if (!this->shares_bus_with_worker_())
+    return this->readv_(address, buffers, cnt);
+  if (!this->caller_holds_lock_)
+    this->lock_.lock();
+  ErrorCode err = this->readv_(address, buffers, cnt);
+  this->caller_holds_lock_ = false;
+  this->lock_.unlock();
+  return err;
+}
+
+ErrorCode IDFI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+  if (!this->shares_bus_with_worker_())
+    return this->writev_(address, buffers, cnt, stop);
+  if (!this->caller_holds_lock_)
+    this->lock_.lock();
+  ErrorCode err = this->writev_(address, buffers, cnt, stop);
+  // Without a stop the caller continues with a repeated start, keep the worker off the bus until then
+  this->caller_holds_lock_ = !stop && err == ERROR_OK;
+  if (!this->caller_holds_lock_)
+    this->lock_.unlock();
+  return err;
+}
+
+ErrorCode IDFI2CBus::readv_(uint8_t address, ReadBuffer *buffers, size_t cnt) {
   // logging is only enabled with vv level, if warnings are shown the caller
   // should log them
   if (!initialized_) {
@@ -175,7 +255,7 @@ ErrorCode IDFI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
 
   return ERROR_OK;
 }
-ErrorCode IDFI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+ErrorCode IDFI2CBus::writev_(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
   // logging is only enabled with vv level, if warnings are shown the caller
   // should log them
   if (!initialized_) {
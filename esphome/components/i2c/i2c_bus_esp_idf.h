@@ -4,7 +4,11 @@
 
 #include "i2c_bus.h"
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include <driver/i2c.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
 
 namespace esphome {
 namespace i2c {
@@ -18,9 +22,11 @@ enum RecoveryCode {
 class IDFI2CBus : public I2CBus, public Component {
  public:
   void setup() override;
+  void loop() override;
   void dump_config() override;
   ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
   ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+  bool submit(std::unique_ptr<I2CTransaction> transaction) override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void set_scan(bool scan) { scan_ = scan; }
@@ -30,12 +36,31 @@ class IDFI2CBus : public I2CBus, public Component {
   void set_scl_pullup_enabled(bool scl_pullup_enabled) { scl_pullup_enabled_ = scl_pullup_enabled; }
   void set_frequency(uint32_t frequency) { frequency_ = frequency; }
   void set_timeout(uint32_t timeout) { timeout_ = timeout; }
+  /// @brief Perform submitted transactions in a worker task instead of blocking the caller
+  void set_async(bool async) { async_ = async; }
 
  private:
   void recover_();
   RecoveryCode recovery_result_;
 
  protected:
+  ErrorCode readv_(uint8_t address, ReadBuffer *buffers, size_t cnt);
+  ErrorCode writev_(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop);
+  /// @brief True if the caller has to share the bus with the worker task
+  bool shares_bus_with_worker_() const {
+    return this->worker_task_handle_ != nullptr && xTaskGetCurrentTaskHandle() != this->worker_task_handle_;
+  }
+
+  static void worker_task(void *params);
+
+  bool async_{false};
+  TaskHandle_t worker_task_handle_{nullptr};
+  QueueHandle_t request_queue_{nullptr};
+  QueueHandle_t completion_queue_{nullptr};
+  /// Held by the worker for a whole transaction, and by other callers from a write without stop to the next transfer
+  Mutex lock_;
+  bool caller_holds_lock_{false};
+
   i2c_port_t port_;
   uint8_t sda_pin_;
   bool sda_pullup_enabled_;
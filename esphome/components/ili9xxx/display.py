@@ -87,6 +87,7 @@ COLOR_PALETTE = cv.one_of("NONE", "GRAYSCALE", "IMAGE_ADAPTIVE")
 
 CONF_LED_PIN = "led_pin"
 CONF_COLOR_PALETTE_IMAGES = "color_palette_images"
+CONF_COLOR_PALETTE_BITS = "color_palette_bits"
 CONF_INVERT_DISPLAY = "invert_display"
 CONF_PIXEL_MODE = "pixel_mode"
 CONF_INIT_SEQUENCE = "init_sequence"
@@ -127,6 +128,13 @@ def _validate(config):
         raise cv.Invalid(
             "Providing color palette images requires palette mode to be 'IMAGE_ADAPTIVE'"
         )
+    if (
+        CONF_COLOR_PALETTE_BITS in config
+        and config.get(CONF_COLOR_PALETTE, "NONE") == "NONE"
+    ):
+        raise cv.Invalid(
+            f"'{CONF_COLOR_PALETTE_BITS}' requires a 'GRAYSCALE' or 'IMAGE_ADAPTIVE' color palette"
+        )
     model = config[CONF_MODEL]
     if CORE.is_esp8266 and model not in [
         "M5STACK",
@@ -170,6 +178,7 @@ CONFIG_SCHEMA = cv.All(
                 "This property is removed. To use the backlight use proper light component."
             ),
             cv.Optional(CONF_COLOR_PALETTE, default="NONE"): COLOR_PALETTE,
+            cv.Optional(CONF_COLOR_PALETTE_BITS): cv.one_of(1, 2, 4, 8, int=True),
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
             cv.Optional(CONF_COLOR_PALETTE_IMAGES, default=[]): cv.ensure_list(
                 cv.file_
@@ -245,10 +254,13 @@ async def to_code(config):
             cg.add(var.set_dimensions(width, height))
 
     rhs = None
+    palette_bits = config.get(CONF_COLOR_PALETTE_BITS, 8)
+    palette_size = 1 << palette_bits
     if config[CONF_COLOR_PALETTE] == "GRAYSCALE":
         cg.add(var.set_buffer_color_mode(ILI9XXXColorMode.BITS_8_INDEXED))
         rhs = []
-        for x in range(256):
+        for i in range(palette_size):
+            x = i * 255 // (palette_size - 1)
             rhs.extend([HexInt(x), HexInt(x), HexInt(x)])
     elif config[CONF_COLOR_PALETTE] == "IMAGE_ADAPTIVE":
         cg.add(var.set_buffer_color_mode(ILI9XXXColorMode.BITS_8_INDEXED))
@@ -272,13 +284,16 @@ async def to_code(config):
             ref_image.paste(i, (x, 0))
             x = x + i.width
 
-        # reduce the colors on combined image to 256.
-        converted = ref_image.convert("P", palette=Image.Palette.ADAPTIVE, colors=256)
+        # reduce the colors on combined image to the palette size.
+        converted = ref_image.convert(
+            "P", palette=Image.Palette.ADAPTIVE, colors=palette_size
+        )
         # if you want to verify how the images look use
         # ref_image.save("ref_in.png")
         # converted.save("ref_out.png")
-        palette = converted.getpalette()
-        assert len(palette) == 256 * 3
+        palette = converted.getpalette()[: palette_size * 3]
+        # images with fewer colors may give a shorter palette
+        palette += [0] * (palette_size * 3 - len(palette))
         rhs = palette
     else:
         cg.add(var.set_buffer_color_mode(ILI9XXXColorMode.BITS_16))
@@ -286,5 +301,6 @@ async def to_code(config):
     if rhs is not None:
         prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
         cg.add(var.set_palette(prog_arr))
+        cg.add(var.set_palette_bits(palette_bits))
 
     cg.add(var.invert_colors(config[CONF_INVERT_COLORS]))
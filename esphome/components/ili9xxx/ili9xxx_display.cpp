@@ -71,6 +71,16 @@ void ILI9XXXDisplay::alloc_buffer_() {
     }
     this->buffer_color_mode_ = BITS_8;
   }
+  if (this->buffer_color_mode_ == BITS_8_INDEXED) {
+    auto format = static_cast<display::FramebufferFormat>(this->palette_bits_);
+    this->init_internal_(display::Framebuffer::buffer_size(format, this->width_, this->height_));
+    if (this->buffer_ == nullptr) {
+      this->mark_failed();
+      return;
+    }
+    this->framebuffer_.init(this->buffer_, format, this->width_, this->height_, this->palette_);
+    return;
+  }
   this->init_internal_(this->get_buffer_length_());
   if (this->buffer_ == nullptr) {
     this->mark_failed();
@@ -96,7 +106,7 @@ void ILI9XXXDisplay::dump_config() {
   ESP_LOGCONFIG(TAG, "  Height Offset: %u", this->offset_y_);
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      ESP_LOGCONFIG(TAG, "  Color mode: 8bit Indexed");
+      ESP_LOGCONFIG(TAG, "  Color mode: %ubit Indexed", this->palette_bits_);
       break;
     case BITS_16:
       ESP_LOGCONFIG(TAG, "  Color mode: 16bit");
@@ -138,8 +148,8 @@ void ILI9XXXDisplay::fill(Color color) {
   this->y_high_ = this->get_height_internal() - 1;
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
-      break;
+      this->framebuffer_.fill(color);
+      return;
     case BITS_16:
       new_color = display::ColorUtil::color_to_565(color);
       {
@@ -169,31 +179,33 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
   if (!this->check_buffer_())
     return;
   uint32_t pos = (y * width_) + x;
-  uint16_t new_color;
+  uint8_t new_color;
   bool updated = false;
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
-      new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
+      updated = this->framebuffer_.set_pixel(x, y, color);
       break;
-    case BITS_16:
+    case BITS_16: {
       pos = pos * 2;
-      new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
-      if (this->buffer_[pos] != (uint8_t) (new_color >> 8)) {
-        this->buffer_[pos] = (uint8_t) (new_color >> 8);
+      uint16_t color_565 = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+      if (this->buffer_[pos] != (uint8_t) (color_565 >> 8)) {
+        this->buffer_[pos] = (uint8_t) (color_565 >> 8);
+        updated = true;
+      }
+      if (this->buffer_[pos + 1] != (uint8_t) color_565) {
+        this->buffer_[pos + 1] = (uint8_t) color_565;
         updated = true;
       }
-      pos = pos + 1;
-      new_color = new_color & 0xFF;
       break;
+    }
     default:
       new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+      if (this->buffer_[pos] != new_color) {
+        this->buffer_[pos] = new_color;
+        updated = true;
+      }
       break;
   }
-
-  if (this->buffer_[pos] != new_color) {
-    this->buffer_[pos] = new_color;
-    updated = true;
-  }
   if (updated) {
     // low and high watermark may speed up drawing from buffer
     if (x < this->x_low_)
@@ -207,6 +219,52 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
   }
 }
 
+void HOT ILI9XXXDisplay::fill_rect_internal(int x, int y, int width, int height, Color color) {
+  if (!this->check_buffer_())
+    return;
+  bool updated = false;
+  if (this->buffer_color_mode_ == BITS_16) {
+    uint16_t new_color = display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB);
+    uint8_t high = new_color >> 8;
+    uint8_t low = new_color & 0xFF;
+    for (int j = y; j < y + height; j++) {
+      uint8_t *row = this->buffer_ + ((j * this->width_) + x) * 2;
+      for (int i = 0; i < width * 2; i += 2) {
+        if (row[i] != high || row[i + 1] != low) {
+          row[i] = high;
+          row[i + 1] = low;
+          updated = true;
+        }
+      }
+    }
+  } else if (this->buffer_color_mode_ == BITS_8_INDEXED) {
+    for (int j = y; j < y + height; j++)
+      updated |= this->framebuffer_.fill_span(x, j, width, color);
+  } else {
+    uint8_t new_color = display::ColorUtil::color_to_332(color, display::ColorOrder::COLOR_ORDER_RGB);
+    for (int j = y; j < y + height; j++) {
+      uint8_t *row = this->buffer_ + (j * this->width_) + x;
+      for (int i = 0; i < width; i++) {
+        if (row[i] != new_color) {
+          row[i] = new_color;
+          updated = true;
+        }
+      }
+    }
+  }
+  if (updated) {
+    // same watermarks as drawing the pixels one by one, widened to the whole rectangle
+    if (x < this->x_low_)
+      this->x_low_ = x;
+    if (y < this->y_low_)
+      this->y_low_ = y;
+    if (x + width - 1 > this->x_high_)
+      this->x_high_ = x + width - 1;
+    if (y + height - 1 > this->y_high_)
+      this->y_high_ = y + height - 1;
+  }
+}
+
 void ILI9XXXDisplay::update() {
   if (this->prossing_update_) {
     this->need_update_ = true;
@@ -249,7 +307,9 @@ void ILI9XXXDisplay::display_() {
     this->write_array(this->buffer_ + this->y_low_ * this->width_ * 2, h * this->width_ * 2);
   } else {
     ESP_LOGV(TAG, "Doing multiple write");
-    uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE];
+    // one buffer is filled while the other one is sent, the bus driver may still read from it after the write returns
+    alignas(4) uint8_t transfer_buffers[2][ILI9XXX_TRANSFER_BUFFER_SIZE];
+    uint8_t *transfer_buffer = transfer_buffers[0];
     size_t rem = h * w;  // remaining number of pixels to write
     set_addr_window_(this->x_low_, this->y_low_, this->x_high_, this->y_high_);
     size_t idx = 0;    // index into transfer_buffer
@@ -262,8 +322,7 @@ void ILI9XXXDisplay::display_() {
           color_val = display::ColorUtil::color_to_565(display::ColorUtil::rgb332_to_color(this->buffer_[pos++]));
           break;
         case BITS_8_INDEXED:
-          color_val = display::ColorUtil::color_to_565(
-              display::ColorUtil::index8_to_color_palette888(this->buffer_[pos++], this->palette_));
+          color_val = this->framebuffer_.get_rgb565(pos++);
           break;
         default:  // case BITS_16:
           color_val = (this->buffer_[pos * 2] << 8) + this->buffer_[pos * 2 + 1];
@@ -278,8 +337,9 @@ void ILI9XXXDisplay::display_() {
         put16_be(transfer_buffer + idx, color_val);
         idx += 2;
       }
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
+      if (idx == ILI9XXX_TRANSFER_BUFFER_SIZE) {
+        this->write_array_queued(transfer_buffer, idx);
+        transfer_buffer = transfer_buffer == transfer_buffers[0] ? transfer_buffers[1] : transfer_buffers[0];
         idx = 0;
         App.feed_wdt();
       }
@@ -291,7 +351,7 @@ void ILI9XXXDisplay::display_() {
     }
     // flush any balance.
     if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
+      this->write_array_queued(transfer_buffer, idx);
     }
   }
   this->end_data_();
@@ -325,12 +385,13 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
       this->write_array(ptr, w * h * 2);
     } else {
       for (size_t y = 0; y != h; y++) {
-        this->write_array(ptr + (y + y_offset) * stride + x_offset, w * 2);
+        this->write_array(ptr + ((y + y_offset) * stride + x_offset) * 2, w * 2);
       }
     }
   } else {
     // 18 bit mode
-    uint8_t transfer_buffer[ILI9XXX_TRANSFER_BUFFER_SIZE * 4];
+    alignas(4) uint8_t transfer_buffers[2][ILI9XXX_TRANSFER_BUFFER_SIZE * 4];
+    uint8_t *transfer_buffer = transfer_buffers[0];
     ESP_LOGV(TAG, "Doing multiple write");
     size_t rem = h * w;  // remaining number of pixels to write
     size_t idx = 0;      // index into transfer_buffer
@@ -342,8 +403,9 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
       transfer_buffer[idx++] = hi_byte & 0xF8;                     // Blue
       transfer_buffer[idx++] = ((hi_byte << 5) | (lo_byte) >> 5);  // Green
       transfer_buffer[idx++] = lo_byte << 3;                       // Red
-      if (idx == sizeof(transfer_buffer)) {
-        this->write_array(transfer_buffer, idx);
+      if (idx == sizeof(transfer_buffers[0])) {
+        this->write_array_queued(transfer_buffer, idx);
+        transfer_buffer = transfer_buffer == transfer_buffers[0] ? transfer_buffers[1] : transfer_buffers[0];
         idx = 0;
         App.feed_wdt();
       }
@@ -355,7 +417,7 @@ void ILI9XXXDisplay::draw_pixels_at(int x_start, int y_start, int w, int h, cons
     }
     // flush any balance.
     if (idx != 0) {
-      this->write_array(transfer_buffer, idx);
+      this->write_array_queued(transfer_buffer, idx);
     }
   }
   this->end_data_();
@@ -384,11 +446,36 @@ void ILI9XXXDisplay::send_command(uint8_t command_byte, const uint8_t *data_byte
   this->end_data_();
 }
 
+void ILI9XXXDisplay::draw_pixels_async(int x_start, int y_start, int w, int h, const uint8_t *ptr,
+                                       display::ColorOrder order, display::ColorBitness bitness, bool big_endian) {
+  if (w <= 0 || h <= 0)
+    return;
+  // only pixels in the native format can be sent straight from the caller's buffer
+  if (this->rotation_ != display::DISPLAY_ROTATION_0_DEGREES || bitness != display::COLOR_BITNESS_565 || !big_endian ||
+      this->is_18bitdisplay_) {
+    this->draw_pixels_at(x_start, y_start, w, h, ptr, order, bitness, big_endian, 0, 0, 0);
+    return;
+  }
+  this->set_addr_window_(x_start, y_start, x_start + w - 1, y_start + h - 1);
+  this->write_array_queued(ptr, w * h * 2);
+  this->pixels_queued_ = true;
+}
+
+void ILI9XXXDisplay::wait_pixels_drawn() {
+  if (!this->pixels_queued_)
+    return;
+  this->pixels_queued_ = false;
+  this->end_data_();
+}
+
 void ILI9XXXDisplay::start_command_() {
+  // the data/command line must not change while pixels are still being sent
+  this->wait_pixels_drawn();
   this->dc_pin_->digital_write(false);
   this->enable();
 }
 void ILI9XXXDisplay::start_data_() {
+  this->wait_pixels_drawn();
   this->dc_pin_->digital_write(true);
   this->enable();
 }
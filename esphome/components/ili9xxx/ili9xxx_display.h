@@ -2,6 +2,7 @@
 #include "esphome/components/spi/spi.h"
 #include "esphome/components/display/display_buffer.h"
 #include "esphome/components/display/display_color_utils.h"
+#include "esphome/components/display/framebuffer.h"
 #include "ili9xxx_defines.h"
 #include "ili9xxx_init.h"
 
@@ -64,6 +65,8 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   float get_setup_priority() const override;
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
   void set_palette(const uint8_t *palette) { this->palette_ = palette; }
+  /// Bits per pixel of the BITS_8_INDEXED mode buffer, the palette has 2^bits entries.
+  void set_palette_bits(uint8_t palette_bits) { this->palette_bits_ = palette_bits; }
   void set_buffer_color_mode(ILI9XXXColorMode color_mode) { this->buffer_color_mode_ = color_mode; }
   void set_dimensions(int16_t width, int16_t height) {
     this->height_ = height;
@@ -93,6 +96,9 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_COLOR; }
   void draw_pixels_at(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
                       display::ColorBitness bitness, bool big_endian, int x_offset, int y_offset, int x_pad) override;
+  void draw_pixels_async(int x_start, int y_start, int w, int h, const uint8_t *ptr, display::ColorOrder order,
+                         display::ColorBitness bitness, bool big_endian) override;
+  void wait_pixels_drawn() override;
 
  protected:
   inline bool check_buffer_() {
@@ -104,6 +110,7 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   }
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_rect_internal(int x, int y, int width, int height, Color color) override;
   void setup_pins_();
 
   virtual void set_madctl();
@@ -123,6 +130,9 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   uint16_t x_high_{0};
   uint16_t y_high_{0};
   const uint8_t *palette_{};
+  uint8_t palette_bits_{8};
+  /// Packs the palette indexes in BITS_8_INDEXED mode
+  display::Framebuffer framebuffer_;
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
 
@@ -149,6 +159,8 @@ class ILI9XXXDisplay : public display::DisplayBuffer,
   bool swap_xy_{};
   bool mirror_x_{};
   bool mirror_y_{};
+  /// draw_pixels_async() left its data transfer running
+  bool pixels_queued_{};
 };
 
 //-----------   M5Stack display --------------
@@ -10,7 +10,7 @@ from magic import Magic
 
 from esphome import core, external_files
 import esphome.codegen as cg
-from esphome.components import font
+from esphome.components import asset_partition, font
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_DITHER,
@@ -404,8 +404,11 @@ async def to_code(config):
             f"Image f{config[CONF_ID]} has an unsupported type: {config[CONF_TYPE]}."
         )
 
-    rhs = [HexInt(x) for x in data]
-    prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
+    if asset_partition.is_enabled():
+        prog_arr = asset_partition.add_asset(data)
+    else:
+        rhs = [HexInt(x) for x in data]
+        prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
         config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
     )
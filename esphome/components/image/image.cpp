@@ -6,22 +6,34 @@ namespace esphome {
 namespace image {
 
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  this->draw_area_(x, y, display, color_on, color_off, 0, 0, this->width_, this->height_);
+}
+void Image::draw_area_(int x, int y, display::Display *display, Color color_on, Color color_off, int left, int top,
+                       int right, int bottom) {
+  // Rows are drawn one after another, the order of the display's memory
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
+      // Spans of equal pixels are filled at once
+      for (int img_y = top; img_y < bottom; img_y++) {
+        int img_x = left;
+        while (img_x < right) {
+          const bool on = this->get_binary_pixel_(img_x, img_y);
+          int end = img_x + 1;
+          while (end < right && this->get_binary_pixel_(end, img_y) == on)
+            end++;
+          if (on) {
+            display->fill_span(x + img_x, y + img_y, end - img_x, color_on);
           } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
+            display->fill_span(x + img_x, y + img_y, end - img_x, color_off);
           }
+          img_x = end;
         }
       }
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_y = top; img_y < bottom; img_y++) {
+        for (int img_x = left; img_x < right; img_x++) {
           auto color = this->get_grayscale_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -30,19 +42,19 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
-      break;
     case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb24_pixel_(img_x, img_y);
+#ifndef USE_ESP8266
+      // The data of the ESP8266 is in PROGMEM, the display can't read it directly
+      if (!display->is_clipping() && x + left >= 0 && y + top >= 0 && x + right <= display->get_width() &&
+          y + bottom <= display->get_height()) {
+        this->blit_area_(x, y, display, left, top, right, bottom);
+        break;
+      }
+#endif
+      for (int img_y = top; img_y < bottom; img_y++) {
+        for (int img_x = left; img_x < right; img_x++) {
+          auto color = this->type_ == IMAGE_TYPE_RGB565 ? this->get_rgb565_pixel_(img_x, img_y)
+                                                        : this->get_rgb24_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
           }
@@ -50,8 +62,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_y = top; img_y < bottom; img_y++) {
+        for (int img_x = left; img_x < right; img_x++) {
           auto color = this->get_rgba_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -61,6 +73,40 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       break;
   }
 }
+void Image::blit_area_(int x, int y, display::Display *display, int left, int top, int right, int bottom) {
+  // The data is big endian RGB565 or RGB888, as draw_pixels_at() takes it
+  const auto bitness = this->type_ == IMAGE_TYPE_RGB565 ? display::COLOR_BITNESS_565 : display::COLOR_BITNESS_888;
+  if (!this->transparent_) {
+    display->draw_pixels_at(x + left, y + top, right - left, bottom - top, this->data_start_, display::COLOR_ORDER_RGB,
+                            bitness, true, left, top, this->width_ - right);
+    return;
+  }
+  // The opaque runs of each row, the transparent pixels are skipped
+  for (int img_y = top; img_y < bottom; img_y++) {
+    int img_x = left;
+    while (img_x < right) {
+      if (this->is_transparent_pixel_(img_x, img_y)) {
+        img_x++;
+        continue;
+      }
+      int end = img_x + 1;
+      while (end < right && !this->is_transparent_pixel_(end, img_y))
+        end++;
+      display->draw_pixels_at(x + img_x, y + img_y, end - img_x, 1, this->data_start_, display::COLOR_ORDER_RGB,
+                              bitness, true, img_x, img_y, this->width_ - end);
+      img_x = end;
+    }
+  }
+}
+bool Image::is_transparent_pixel_(int x, int y) const {
+  const uint32_t pos = x + y * this->width_;
+  if (this->type_ == IMAGE_TYPE_RGB565) {
+    const uint8_t *pixel = this->data_start_ + pos * 2;
+    return pixel[0] == 0x00 && pixel[1] == 0x20;
+  }
+  const uint8_t *pixel = this->data_start_ + pos * 3;
+  return pixel[2] == 1 && pixel[0] == 0 && pixel[1] == 0;
+}
 Color Image::get_pixel(int x, int y, Color color_on, Color color_off) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return color_off;
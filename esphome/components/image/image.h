@@ -46,6 +46,13 @@ class Image : public display::BaseImage {
   bool has_transparency() const { return transparent_; }
 
  protected:
+  /// Draw the pixels from (`left`, `top`) up to, but excluding (`right`, `bottom`) of the image.
+  void draw_area_(int x, int y, display::Display *display, Color color_on, Color color_off, int left, int top,
+                  int right, int bottom);
+  /// Hand the area of an RGB565 or RGB24 image to the display's draw_pixels_at(), a row of opaque pixels at once.
+  void blit_area_(int x, int y, display::Display *display, int left, int top, int right, int bottom);
+  /// Whether the pixel of an RGB565 or RGB24 image has the color marking it transparent.
+  bool is_transparent_pixel_(int x, int y) const;
   bool get_binary_pixel_(int x, int y) const;
   Color get_rgb24_pixel_(int x, int y) const;
   Color get_rgba_pixel_(int x, int y) const;
@@ -143,6 +143,12 @@ size_t Inkplate6::get_buffer_length_() {
 }
 
 void Inkplate6::update() {
+  if (this->refresh_state_ != REFRESH_IDLE) {
+    // The running refresh still reads the buffers, draw once it's done
+    this->update_pending_ = true;
+    return;
+  }
+
   this->do_update_();
 
   if (this->full_update_every_ > 0 && this->partial_updates_ >= this->full_update_every_) {
@@ -152,6 +158,32 @@ void Inkplate6::update() {
   this->display();
 }
 
+void Inkplate6::loop() {
+  switch (this->refresh_state_) {
+    case REFRESH_POWER_ON:
+      if (this->read_power_status_()) {
+        this->eink_on_finish_(true);
+        this->refresh_state_ = REFRESH_FRAMES;
+      } else if (millis() - this->refresh_timer_ >= 250) {
+        this->eink_on_finish_(false);
+        this->finish_refresh_(false);
+      }
+      break;
+    case REFRESH_FRAMES:
+      this->send_frame_();
+      break;
+    case REFRESH_POWER_OFF:
+      if (millis() - this->refresh_timer_ >= 100) {
+        this->eink_off_finish_();
+        this->finish_refresh_(true);
+      }
+      break;
+    default:
+      this->disable_loop();
+      break;
+  }
+}
+
 void HOT Inkplate6::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
     return;
@@ -209,9 +241,16 @@ void Inkplate6::dump_config() {
 }
 
 void Inkplate6::eink_off_() {
+  if (!this->eink_off_start_())
+    return;
+  delay(100);  // NOLINT
+  this->eink_off_finish_();
+}
+
+bool Inkplate6::eink_off_start_() {
   ESP_LOGV(TAG, "Eink off called");
   if (!panel_on_)
-    return;
+    return false;
   panel_on_ = false;
 
   this->oe_pin_->digital_write(false);
@@ -225,9 +264,10 @@ void Inkplate6::eink_off_() {
   this->vcom_pin_->digital_write(false);
 
   this->write_byte(0x01, 0x6F);  // Put TPS65186 into standby mode
+  return true;
+}
 
-  delay(100);  // NOLINT
-
+void Inkplate6::eink_off_finish_() {
   this->write_byte(0x01, 0x4f);  // Disable 3V3 to the panel
 
   if (this->model_ != INKPLATE_6_PLUS)
@@ -237,9 +277,20 @@ void Inkplate6::eink_off_() {
 }
 
 void Inkplate6::eink_on_() {
+  if (!this->eink_on_start_())
+    return;
+
+  uint32_t timer = millis();
+  do {
+    delay(1);
+  } while (!this->read_power_status_() && ((millis() - timer) < 250));
+  this->eink_on_finish_((millis() - timer) < 250);
+}
+
+bool Inkplate6::eink_on_start_() {
   ESP_LOGV(TAG, "Eink on called");
   if (panel_on_)
-    return;
+    return false;
   this->panel_on_ = true;
 
   this->pins_as_outputs_();
@@ -261,21 +312,21 @@ void Inkplate6::eink_on_() {
   this->spv_pin_->digital_write(true);
   this->ckv_pin_->digital_write(false);
   this->oe_pin_->digital_write(false);
+  return true;
+}
 
-  uint32_t timer = millis();
-  do {
-    delay(1);
-  } while (!this->read_power_status_() && ((millis() - timer) < 250));
-  if ((millis() - timer) >= 250) {
+bool Inkplate6::eink_on_finish_(bool powered) {
+  if (!powered) {
     ESP_LOGW(TAG, "Power supply not detected");
     this->wakeup_pin_->digital_write(false);
     this->vcom_pin_->digital_write(false);
     this->powerup_pin_->digital_write(false);
     this->panel_on_ = false;
-    return;
+    return false;
   }
 
   this->oe_pin_->digital_write(true);
+  return true;
 }
 
 bool Inkplate6::read_power_status_() {
@@ -304,57 +355,148 @@ void Inkplate6::fill(Color color) {
 
 void Inkplate6::display() {
   ESP_LOGV(TAG, "Display called");
-  uint32_t start_time = millis();
+  if (this->refresh_state_ != REFRESH_IDLE) {
+    this->display_pending_ = true;
+    return;
+  }
+  this->refresh_start_ = millis();
+  this->steps_.clear();
 
   if (this->greyscale_) {
-    this->display3b_();
-  } else {
-    if (this->partial_updating_ && this->partial_update_()) {
-      ESP_LOGV(TAG, "Display finished (partial) (%ums)", millis() - start_time);
-      return;
+    this->refresh_ = REFRESH_3B;
+    this->add_clean_steps_();
+    this->steps_.push_back({FRAME_3B, 9});
+    this->steps_.push_back({FRAME_SKIP, 1});
+  } else if (!this->partial_updating_ || !this->partial_update_()) {
+    this->refresh_ = REFRESH_1B;
+    memcpy(this->buffer_, this->partial_buffer_, this->get_buffer_length_());
+    this->add_clean_steps_();
+    this->steps_.push_back({FRAME_1B_FIRST, uint8_t((this->model_ == INKPLATE_6_V2) ? 5 : 4)});
+    this->steps_.push_back({FRAME_1B_SECOND, 1});
+    if (this->model_ == INKPLATE_6_PLUS) {
+      this->steps_.push_back({FRAME_DISCHARGE, 2});
+      this->steps_.push_back({FRAME_SKIP, 1});
+    } else {
+      this->steps_.push_back({FRAME_1B_THIRD, 1});
     }
-    this->display1b_();
   }
-  ESP_LOGV(TAG, "Display finished (full) (%ums)", millis() - start_time);
+
+  this->step_index_ = 0;
+  this->frame_index_ = 0;
+  if (this->eink_on_start_()) {
+    this->refresh_state_ = REFRESH_POWER_ON;
+    this->refresh_timer_ = millis();
+  } else {
+    this->refresh_state_ = REFRESH_FRAMES;
+  }
+  this->enable_loop();
 }
 
-void Inkplate6::display1b_() {
-  ESP_LOGV(TAG, "Display1b called");
-  uint32_t start_time = millis();
+void Inkplate6::add_clean_steps_() {
+  if (this->model_ == INKPLATE_6_PLUS) {
+    this->steps_.insert(this->steps_.end(), {{FRAME_WHITE, 1},
+                                             {FRAME_BLACK, 15},
+                                             {FRAME_DISCHARGE, 1},
+                                             {FRAME_WHITE, 5},
+                                             {FRAME_DISCHARGE, 1},
+                                             {FRAME_BLACK, 15}});
+  } else {
+    this->steps_.insert(this->steps_.end(), {{FRAME_WHITE, 1},
+                                             {FRAME_BLACK, 21},
+                                             {FRAME_DISCHARGE, 1},
+                                             {FRAME_WHITE, 12},
+                                             {FRAME_DISCHARGE, 1},
+                                             {FRAME_BLACK, 21},
+                                             {FRAME_DISCHARGE, 1},
+                                             {FRAME_WHITE, 12},
+                                             {FRAME_DISCHARGE, 1}});
+  }
+}
 
-  memcpy(this->buffer_, this->partial_buffer_, this->get_buffer_length_());
+void Inkplate6::send_frame_() {
+  const InkplateStep &step = this->steps_[this->step_index_];
+  switch (step.frame) {
+    case FRAME_WHITE:
+    case FRAME_BLACK:
+    case FRAME_DISCHARGE:
+    case FRAME_SKIP:
+      this->clean_frame_(step.frame);
+      break;
+    case FRAME_1B_FIRST:
+    case FRAME_1B_SECOND:
+    case FRAME_1B_THIRD:
+      this->frame_1b_(step.frame);
+      break;
+    case FRAME_3B:
+      this->frame_3b_(this->frame_index_);
+      break;
+    case FRAME_PARTIAL:
+      this->frame_partial_();
+      break;
+  }
+  ESP_LOGVV(TAG, "Frame %u of step %u sent (%ums)", this->frame_index_, this->step_index_,
+            millis() - this->refresh_start_);
 
-  uint8_t data;
-  uint8_t buffer_value;
-  const uint8_t *buffer_ptr;
-  eink_on_();
-  if (this->model_ == INKPLATE_6_PLUS) {
-    clean_fast_(0, 1);
-    clean_fast_(1, 15);
-    clean_fast_(2, 1);
-    clean_fast_(0, 5);
-    clean_fast_(2, 1);
-    clean_fast_(1, 15);
+  if (++this->frame_index_ < step.count)
+    return;
+  this->frame_index_ = 0;
+  if (++this->step_index_ < this->steps_.size())
+    return;
+
+  this->vscan_start_();
+  if (this->eink_off_start_()) {
+    this->refresh_state_ = REFRESH_POWER_OFF;
+    this->refresh_timer_ = millis();
   } else {
-    clean_fast_(0, 1);
-    clean_fast_(1, 21);
-    clean_fast_(2, 1);
-    clean_fast_(0, 12);
-    clean_fast_(2, 1);
-    clean_fast_(1, 21);
-    clean_fast_(2, 1);
-    clean_fast_(0, 12);
-    clean_fast_(2, 1);
+    this->finish_refresh_(true);
   }
+}
+
+void Inkplate6::finish_refresh_(bool shown) {
+  if (shown) {
+    switch (this->refresh_) {
+      case REFRESH_1B:
+        this->block_partial_ = false;
+        this->partial_updates_ = 0;
+        break;
+      case REFRESH_PARTIAL:
+        memcpy(this->buffer_, this->partial_buffer_, this->get_buffer_length_());
+        break;
+      default:
+        break;
+    }
+  }
+  ESP_LOGV(TAG, "Display finished (%s) (%ums)", this->refresh_ == REFRESH_PARTIAL ? "partial" : "full",
+           millis() - this->refresh_start_);
+  this->refresh_state_ = REFRESH_IDLE;
+
+  if (this->update_pending_) {
+    this->update_pending_ = false;
+    this->display_pending_ = false;
+    this->update();
+  } else if (this->display_pending_) {
+    this->display_pending_ = false;
+    this->display();
+  }
+}
+
+void Inkplate6::cancel_refresh_() {
+  if (this->refresh_state_ == REFRESH_IDLE)
+    return;
+  this->refresh_state_ = REFRESH_IDLE;
+  this->update_pending_ = false;
+  this->display_pending_ = false;
+  this->eink_off_();
+}
 
+void Inkplate6::frame_1b_(uint8_t frame) {
   uint32_t clock = (1 << this->cl_pin_->get_pin());
   uint32_t data_mask = this->get_data_pin_mask_();
-  ESP_LOGV(TAG, "Display1b start loops (%ums)", millis() - start_time);
-
-  int rep = (this->model_ == INKPLATE_6_V2) ? 5 : 4;
+  uint8_t data;
+  uint8_t buffer_value;
+  const uint8_t *buffer_ptr = &this->buffer_[this->get_buffer_length_() - 1];
 
-  for (int k = 0; k < rep; k++) {
-    buffer_ptr = &this->buffer_[this->get_buffer_length_() - 1];
+  if (frame == FRAME_1B_FIRST) {
     vscan_start_();
     for (int i = 0, im = this->get_height_internal(); i < im; i++) {
       buffer_value = *(buffer_ptr--);
@@ -381,52 +523,26 @@ void Inkplate6::display1b_() {
       vscan_end_();
     }
     delayMicroseconds(230);
+    return;
   }
-  ESP_LOGV(TAG, "Display1b first loop x %d (%ums)", 4, millis() - start_time);
 
-  buffer_ptr = &this->buffer_[this->get_buffer_length_() - 1];
-  vscan_start_();
-  for (int i = 0, im = this->get_height_internal(); i < im; i++) {
-    buffer_value = *(buffer_ptr--);
-    data = this->model_ == INKPLATE_6_PLUS ? LUTB[(buffer_value >> 4) & 0x0F] : LUT2[(buffer_value >> 4) & 0x0F];
-    hscan_start_(this->pin_lut_[data] | clock);
-    data = this->model_ == INKPLATE_6_PLUS ? LUTB[buffer_value & 0x0F] : LUT2[buffer_value & 0x0F];
-    GPIO.out_w1ts = this->pin_lut_[data] | clock;
-    GPIO.out_w1tc = data_mask | clock;
-
-    for (int j = 0, jm = (this->get_width_internal() / 8) - 1; j < jm; j++) {
+  if (frame == FRAME_1B_SECOND) {
+    vscan_start_();
+    for (int i = 0, im = this->get_height_internal(); i < im; i++) {
       buffer_value = *(buffer_ptr--);
       data = this->model_ == INKPLATE_6_PLUS ? LUTB[(buffer_value >> 4) & 0x0F] : LUT2[(buffer_value >> 4) & 0x0F];
-      GPIO.out_w1ts = this->pin_lut_[data] | clock;
-      GPIO.out_w1tc = data_mask | clock;
+      hscan_start_(this->pin_lut_[data] | clock);
       data = this->model_ == INKPLATE_6_PLUS ? LUTB[buffer_value & 0x0F] : LUT2[buffer_value & 0x0F];
       GPIO.out_w1ts = this->pin_lut_[data] | clock;
       GPIO.out_w1tc = data_mask | clock;
-    }
-    // New Inkplate6 panel doesn't need last clock
-    if (this->model_ != INKPLATE_6_V2) {
-      GPIO.out_w1ts = clock;
-      GPIO.out_w1tc = data_mask | clock;
-    }
-    vscan_end_();
-  }
-  delayMicroseconds(230);
-  ESP_LOGV(TAG, "Display1b second loop (%ums)", millis() - start_time);
 
-  if (this->model_ == INKPLATE_6_PLUS) {
-    clean_fast_(2, 2);
-    clean_fast_(3, 1);
-  } else {
-    uint32_t send = this->pin_lut_[0];
-    vscan_start_();
-    for (int i = 0, im = this->get_height_internal(); i < im; i++) {
-      hscan_start_(send);
-      GPIO.out_w1ts = send | clock;
-      GPIO.out_w1tc = data_mask | clock;
       for (int j = 0, jm = (this->get_width_internal() / 8) - 1; j < jm; j++) {
-        GPIO.out_w1ts = send | clock;
+        buffer_value = *(buffer_ptr--);
+        data = this->model_ == INKPLATE_6_PLUS ? LUTB[(buffer_value >> 4) & 0x0F] : LUT2[(buffer_value >> 4) & 0x0F];
+        GPIO.out_w1ts = this->pin_lut_[data] | clock;
         GPIO.out_w1tc = data_mask | clock;
-        GPIO.out_w1ts = send | clock;
+        data = this->model_ == INKPLATE_6_PLUS ? LUTB[buffer_value & 0x0F] : LUT2[buffer_value & 0x0F];
+        GPIO.out_w1ts = this->pin_lut_[data] | clock;
         GPIO.out_w1tc = data_mask | clock;
       }
       // New Inkplate6 panel doesn't need last clock
@@ -437,79 +553,64 @@ void Inkplate6::display1b_() {
       vscan_end_();
     }
     delayMicroseconds(230);
-    ESP_LOGV(TAG, "Display1b third loop (%ums)", millis() - start_time);
+    return;
   }
-  vscan_start_();
-  eink_off_();
-  this->block_partial_ = false;
-  this->partial_updates_ = 0;
-  ESP_LOGV(TAG, "Display1b finished (%ums)", millis() - start_time);
-}
 
-void Inkplate6::display3b_() {
-  ESP_LOGV(TAG, "Display3b called");
-  uint32_t start_time = millis();
-
-  eink_on_();
-  if (this->model_ == INKPLATE_6_PLUS) {
-    clean_fast_(0, 1);
-    clean_fast_(1, 15);
-    clean_fast_(2, 1);
-    clean_fast_(0, 5);
-    clean_fast_(2, 1);
-    clean_fast_(1, 15);
-  } else {
-    clean_fast_(0, 1);
-    clean_fast_(1, 21);
-    clean_fast_(2, 1);
-    clean_fast_(0, 12);
-    clean_fast_(2, 1);
-    clean_fast_(1, 21);
-    clean_fast_(2, 1);
-    clean_fast_(0, 12);
-    clean_fast_(2, 1);
+  uint32_t send = this->pin_lut_[0];
+  vscan_start_();
+  for (int i = 0, im = this->get_height_internal(); i < im; i++) {
+    hscan_start_(send);
+    GPIO.out_w1ts = send | clock;
+    GPIO.out_w1tc = data_mask | clock;
+    for (int j = 0, jm = (this->get_width_internal() / 8) - 1; j < jm; j++) {
+      GPIO.out_w1ts = send | clock;
+      GPIO.out_w1tc = data_mask | clock;
+      GPIO.out_w1ts = send | clock;
+      GPIO.out_w1tc = data_mask | clock;
+    }
+    // New Inkplate6 panel doesn't need last clock
+    if (this->model_ != INKPLATE_6_V2) {
+      GPIO.out_w1ts = clock;
+      GPIO.out_w1tc = data_mask | clock;
+    }
+    vscan_end_();
   }
+  delayMicroseconds(230);
+}
 
+void Inkplate6::frame_3b_(uint8_t k) {
   uint32_t clock = (1 << this->cl_pin_->get_pin());
   uint32_t data_mask = this->get_data_pin_mask_();
-  uint32_t pos;
+  uint32_t pos = this->get_buffer_length_();
   uint32_t data;
-  uint8_t glut_size = 9;
-  for (int k = 0; k < glut_size; k++) {
-    pos = this->get_buffer_length_();
-    vscan_start_();
-    for (int i = 0; i < this->get_height_internal(); i++) {
+  vscan_start_();
+  for (int i = 0; i < this->get_height_internal(); i++) {
+    data = this->glut2_[k * 256 + this->buffer_[--pos]];
+    data |= this->glut_[k * 256 + this->buffer_[--pos]];
+    hscan_start_(data);
+    data = this->glut2_[k * 256 + this->buffer_[--pos]];
+    data |= this->glut_[k * 256 + this->buffer_[--pos]];
+    GPIO.out_w1ts = data | clock;
+    GPIO.out_w1tc = data_mask | clock;
+
+    for (int j = 0; j < (this->get_width_internal() / 8) - 1; j++) {
       data = this->glut2_[k * 256 + this->buffer_[--pos]];
       data |= this->glut_[k * 256 + this->buffer_[--pos]];
-      hscan_start_(data);
+      GPIO.out_w1ts = data | clock;
+      GPIO.out_w1tc = data_mask | clock;
       data = this->glut2_[k * 256 + this->buffer_[--pos]];
       data |= this->glut_[k * 256 + this->buffer_[--pos]];
       GPIO.out_w1ts = data | clock;
       GPIO.out_w1tc = data_mask | clock;
-
-      for (int j = 0; j < (this->get_width_internal() / 8) - 1; j++) {
-        data = this->glut2_[k * 256 + this->buffer_[--pos]];
-        data |= this->glut_[k * 256 + this->buffer_[--pos]];
-        GPIO.out_w1ts = data | clock;
-        GPIO.out_w1tc = data_mask | clock;
-        data = this->glut2_[k * 256 + this->buffer_[--pos]];
-        data |= this->glut_[k * 256 + this->buffer_[--pos]];
-        GPIO.out_w1ts = data | clock;
-        GPIO.out_w1tc = data_mask | clock;
-      }
-      // New Inkplate6 panel doesn't need last clock
-      if (this->model_ != INKPLATE_6_V2) {
-        GPIO.out_w1ts = clock;
-        GPIO.out_w1tc = data_mask | clock;
-      }
-      vscan_end_();
     }
-    delayMicroseconds(230);
+    // New Inkplate6 panel doesn't need last clock
+    if (this->model_ != INKPLATE_6_V2) {
+      GPIO.out_w1ts = clock;
+      GPIO.out_w1tc = data_mask | clock;
+    }
+    vscan_end_();
   }
-  clean_fast_(3, 1);
-  vscan_start_();
-  eink_off_();
-  ESP_LOGV(TAG, "Display3b finished (%ums)", millis() - start_time);
+  delayMicroseconds(230);
 }
 
 bool Inkplate6::partial_update_() {
@@ -523,7 +624,6 @@ bool Inkplate6::partial_update_() {
   this->partial_updates_++;
 
   uint32_t pos = this->get_buffer_length_() - 1;
-  uint8_t data;
   uint8_t diffw, diffb;
   uint32_t n = (this->get_buffer_length_() * 2) - 1;
 
@@ -538,40 +638,35 @@ bool Inkplate6::partial_update_() {
   }
   ESP_LOGV(TAG, "Partial update buffer built after (%ums)", millis() - start_time);
 
-  int rep = (this->model_ == INKPLATE_6_V2) ? 6 : 5;
+  this->refresh_ = REFRESH_PARTIAL;
+  this->steps_.push_back({FRAME_PARTIAL, uint8_t((this->model_ == INKPLATE_6_V2) ? 6 : 5)});
+  this->steps_.push_back({FRAME_DISCHARGE, 2});
+  this->steps_.push_back({FRAME_SKIP, 1});
+  return true;
+}
 
-  eink_on_();
+void Inkplate6::frame_partial_() {
   uint32_t clock = (1 << this->cl_pin_->get_pin());
   uint32_t data_mask = this->get_data_pin_mask_();
-  for (int k = 0; k < rep; k++) {
-    vscan_start_();
-    const uint8_t *data_ptr = &this->partial_buffer_2_[(this->get_buffer_length_() * 2) - 1];
-    for (int i = 0; i < this->get_height_internal(); i++) {
+  uint8_t data;
+  vscan_start_();
+  const uint8_t *data_ptr = &this->partial_buffer_2_[(this->get_buffer_length_() * 2) - 1];
+  for (int i = 0; i < this->get_height_internal(); i++) {
+    data = *(data_ptr--);
+    hscan_start_(this->pin_lut_[data]);
+    for (int j = 0, jm = (this->get_width_internal() / 4) - 1; j < jm; j++) {
       data = *(data_ptr--);
-      hscan_start_(this->pin_lut_[data]);
-      for (int j = 0, jm = (this->get_width_internal() / 4) - 1; j < jm; j++) {
-        data = *(data_ptr--);
-        GPIO.out_w1ts = this->pin_lut_[data] | clock;
-        GPIO.out_w1tc = data_mask | clock;
-      }
-      // New Inkplate6 panel doesn't need last clock
-      if (this->model_ != INKPLATE_6_V2) {
-        GPIO.out_w1ts = clock;
-        GPIO.out_w1tc = data_mask | clock;
-      }
-      vscan_end_();
+      GPIO.out_w1ts = this->pin_lut_[data] | clock;
+      GPIO.out_w1tc = data_mask | clock;
     }
-    delayMicroseconds(230);
-    ESP_LOGV(TAG, "Partial update loop k=%d (%ums)", k, millis() - start_time);
+    // New Inkplate6 panel doesn't need last clock
+    if (this->model_ != INKPLATE_6_V2) {
+      GPIO.out_w1ts = clock;
+      GPIO.out_w1tc = data_mask | clock;
+    }
+    vscan_end_();
   }
-  clean_fast_(2, 2);
-  clean_fast_(3, 1);
-  vscan_start_();
-  eink_off_();
-
-  memcpy(this->buffer_, this->partial_buffer_, this->get_buffer_length_());
-  ESP_LOGV(TAG, "Partial update finished (%ums)", millis() - start_time);
-  return true;
+  delayMicroseconds(230);
 }
 
 void Inkplate6::vscan_start_() {
@@ -616,6 +711,10 @@ void Inkplate6::vscan_end_() {
 
 void Inkplate6::clean() {
   ESP_LOGV(TAG, "Clean called");
+  if (this->refresh_state_ != REFRESH_IDLE) {
+    ESP_LOGW(TAG, "Can't clean while the display refreshes");
+    return;
+  }
   uint32_t start_time = millis();
 
   eink_on_();
@@ -633,6 +732,14 @@ void Inkplate6::clean_fast_(uint8_t c, uint8_t rep) {
   uint32_t start_time = millis();
 
   eink_on_();
+  for (int k = 0; k < rep; k++) {
+    this->clean_frame_(c);
+    ESP_LOGV(TAG, "Clean fast rep loop %d finished (%ums)", k, millis() - start_time);
+  }
+  ESP_LOGV(TAG, "Clean fast finished (%ums)", millis() - start_time);
+}
+
+void Inkplate6::clean_frame_(uint8_t c) {
   uint8_t data = 0;
   if (c == 0) {  // White
     data = 0b10101010;
@@ -648,29 +755,25 @@ void Inkplate6::clean_fast_(uint8_t c, uint8_t rep) {
                   (((data & 0b11100000) >> 5) << 25);
   uint32_t clock = (1 << this->cl_pin_->get_pin());
 
-  for (int k = 0; k < rep; k++) {
-    vscan_start_();
-    for (int i = 0; i < this->get_height_internal(); i++) {
-      hscan_start_(send);
+  vscan_start_();
+  for (int i = 0; i < this->get_height_internal(); i++) {
+    hscan_start_(send);
+    GPIO.out_w1ts = send | clock;
+    GPIO.out_w1tc = clock;
+    for (int j = 0; j < (this->get_width_internal() / 8) - 1; j++) {
+      GPIO.out_w1ts = clock;
+      GPIO.out_w1tc = clock;
+      GPIO.out_w1ts = clock;
+      GPIO.out_w1tc = clock;
+    }
+    // New Inkplate6 panel doesn't need last clock
+    if (this->model_ != INKPLATE_6_V2) {
       GPIO.out_w1ts = send | clock;
       GPIO.out_w1tc = clock;
-      for (int j = 0; j < (this->get_width_internal() / 8) - 1; j++) {
-        GPIO.out_w1ts = clock;
-        GPIO.out_w1tc = clock;
-        GPIO.out_w1ts = clock;
-        GPIO.out_w1tc = clock;
-      }
-      // New Inkplate6 panel doesn't need last clock
-      if (this->model_ != INKPLATE_6_V2) {
-        GPIO.out_w1ts = send | clock;
-        GPIO.out_w1tc = clock;
-      }
-      vscan_end_();
     }
-    delayMicroseconds(230);
-    ESP_LOGV(TAG, "Clean fast rep loop %d finished (%ums)", k, millis() - start_time);
+    vscan_end_();
   }
-  ESP_LOGV(TAG, "Clean fast finished (%ums)", millis() - start_time);
+  delayMicroseconds(230);
 }
 
 void Inkplate6::pins_z_state_() {
@@ -5,6 +5,8 @@
 #include "esphome/components/i2c/i2c.h"
 #include "esphome/components/display/display_buffer.h"
 
+#include <vector>
+
 #ifdef USE_ESP32_FRAMEWORK_ARDUINO
 
 namespace esphome {
@@ -19,6 +21,39 @@ enum InkplateModel : uint8_t {
   INKPLATE_5_V2 = 5,
 };
 
+/// One scan of the whole panel. The first four are the colors of clean_fast_().
+enum InkplateFrame : uint8_t {
+  FRAME_WHITE = 0,
+  FRAME_BLACK,
+  FRAME_DISCHARGE,
+  FRAME_SKIP,
+  FRAME_1B_FIRST,
+  FRAME_1B_SECOND,
+  FRAME_1B_THIRD,
+  FRAME_3B,
+  FRAME_PARTIAL,
+};
+
+struct InkplateStep {
+  InkplateFrame frame;
+  uint8_t count;
+};
+
+enum InkplateRefreshState : uint8_t {
+  REFRESH_IDLE = 0,
+  /// Waiting for the TPS65186 to report power good
+  REFRESH_POWER_ON,
+  REFRESH_FRAMES,
+  /// Waiting between standby and switching off the 3V3 rail of the panel
+  REFRESH_POWER_OFF,
+};
+
+enum InkplateRefresh : uint8_t {
+  REFRESH_1B = 0,
+  REFRESH_3B,
+  REFRESH_PARTIAL,
+};
+
 class Inkplate6 : public display::DisplayBuffer, public i2c::I2CDevice {
  public:
   const uint8_t LUT2[16] = {0xAA, 0xA9, 0xA6, 0xA5, 0x9A, 0x99, 0x96, 0x95,
@@ -89,8 +124,11 @@ class Inkplate6 : public display::DisplayBuffer, public i2c::I2CDevice {
   void set_greyscale(bool greyscale) {
     this->greyscale_ = greyscale;
     this->block_partial_ = true;
-    if (this->is_ready())
+    if (this->is_ready()) {
+      // The buffers of a running refresh are about to be replaced
+      this->cancel_refresh_();
       this->initialize_();
+    }
   }
   void set_partial_updating(bool partial_updating) { this->partial_updating_ = partial_updating; }
   void set_full_update_every(uint32_t full_update_every) { this->full_update_every_ = full_update_every; }
@@ -122,11 +160,18 @@ class Inkplate6 : public display::DisplayBuffer, public i2c::I2CDevice {
 
   void dump_config() override;
 
+  /** Start refreshing the panel with the buffer.
+   *
+   * The refresh is sent from loop(), one scan of the panel per iteration, so other components keep running in
+   * between. A call while refreshing starts another refresh after the current one.
+   */
   void display();
+  /// Clean the panel. Unlike display() this blocks until it's done.
   void clean();
   void fill(Color color) override;
 
   void update() override;
+  void loop() override;
 
   void setup() override;
 
@@ -143,18 +188,31 @@ class Inkplate6 : public display::DisplayBuffer, public i2c::I2CDevice {
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
-  void display1b_();
-  void display3b_();
   void initialize_();
+  /// Build the partial update buffer and queue its frames, unless a full update is needed.
   bool partial_update_();
+  void add_clean_steps_();
+  void send_frame_();
+  void finish_refresh_(bool shown);
+  void cancel_refresh_();
+  void frame_1b_(uint8_t frame);
+  void frame_3b_(uint8_t k);
+  void frame_partial_();
   void clean_fast_(uint8_t c, uint8_t rep);
+  void clean_frame_(uint8_t c);
 
   void hscan_start_(uint32_t d);
   void vscan_end_();
   void vscan_start_();
 
   void eink_off_();
+  /// First part of eink_off_(), the rail is switched off by eink_off_finish_() 100ms later.
+  bool eink_off_start_();
+  void eink_off_finish_();
   void eink_on_();
+  /// First part of eink_on_(), eink_on_finish_() follows once read_power_status_() reports power good.
+  bool eink_on_start_();
+  bool eink_on_finish_(bool powered);
   bool read_power_status_();
 
   void setup_pins_();
@@ -220,6 +278,16 @@ class Inkplate6 : public display::DisplayBuffer, public i2c::I2CDevice {
   uint32_t partial_updates_{0};
 
   bool block_partial_{true};
+
+  std::vector<InkplateStep> steps_;
+  size_t step_index_{0};
+  uint8_t frame_index_{0};
+  InkplateRefreshState refresh_state_{REFRESH_IDLE};
+  InkplateRefresh refresh_{REFRESH_1B};
+  uint32_t refresh_start_{0};
+  uint32_t refresh_timer_{0};
+  bool update_pending_{false};
+  bool display_pending_{false};
   bool greyscale_;
   bool partial_updating_;
 
@@ -9,12 +9,8 @@ namespace integration {
 static const char *const TAG = "integration";
 
 void IntegrationSensor::setup() {
-  if (this->restore_) {
-    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
-    float preference_value = 0;
-    this->pref_.load(&preference_value);
-    this->result_ = preference_value;
-  }
+  if (this->accumulator_ != nullptr)
+    this->result_ = this->accumulator_->get(this->accumulator_index_);
 
   this->last_update_ = millis();
 
@@ -1,9 +1,9 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/core/preferences.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/persistent_accumulator/persistent_accumulator.h"
 #include "esphome/components/sensor/sensor.h"
 
 namespace esphome {
@@ -31,7 +31,11 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void set_sensor(Sensor *sensor) { sensor_ = sensor; }
   void set_time(IntegrationSensorTime time) { time_ = time; }
   void set_method(IntegrationMethod method) { method_ = method; }
-  void set_restore(bool restore) { restore_ = restore; }
+  /// Restore the result after reboots, from the shared store of counters.
+  void set_accumulator(persistent_accumulator::PersistentAccumulator *accumulator) {
+    accumulator_ = accumulator;
+    accumulator_index_ = accumulator->add_counter(this);
+  }
   void reset() { this->publish_and_save_(0.0f); }
 
  protected:
@@ -55,17 +59,15 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void publish_and_save_(double result) {
     this->result_ = result;
     this->publish_state(result);
-    if (this->restore_) {
-      float result_f = result;
-      this->pref_.save(&result_f);
-    }
+    if (this->accumulator_ != nullptr)
+      this->accumulator_->set(this->accumulator_index_, result);
   }
 
   sensor::Sensor *sensor_;
   IntegrationSensorTime time_;
   IntegrationMethod method_;
-  bool restore_;
-  ESPPreferenceObject pref_;
+  persistent_accumulator::PersistentAccumulator *accumulator_{nullptr};
+  size_t accumulator_index_{0};
 
   uint32_t last_update_;
   double result_{0.0f};
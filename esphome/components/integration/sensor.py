@@ -2,6 +2,10 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import automation
 from esphome.components import sensor
+from esphome.components.persistent_accumulator import (
+    CONF_PERSISTENT_ACCUMULATOR_ID,
+    PersistentAccumulator,
+)
 from esphome.const import (
     CONF_ICON,
     CONF_ID,
@@ -12,6 +16,8 @@ from esphome.const import (
 )
 from esphome.core.entity_helpers import inherit_property_from
 
+AUTO_LOAD = ["persistent_accumulator"]
+
 integration_ns = cg.esphome_ns.namespace("integration")
 IntegrationSensor = integration_ns.class_(
     "IntegrationSensor", sensor.Sensor, cg.Component
@@ -57,6 +63,9 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_INTEGRATION_METHOD, default="trapezoid"): cv.enum(
                 INTEGRATION_METHODS, lower=True
             ),
+            cv.GenerateID(CONF_PERSISTENT_ACCUMULATOR_ID): cv.use_id(
+                PersistentAccumulator
+            ),
             cv.Optional(CONF_RESTORE, default=False): cv.boolean,
             cv.Optional("min_save_interval"): cv.invalid(
                 "min_save_interval was removed in 2022.8.0. Please use the `preferences` -> `flash_write_interval` to adjust."
@@ -98,7 +107,9 @@ async def to_code(config):
     cg.add(var.set_sensor(sens))
     cg.add(var.set_time(config[CONF_TIME_UNIT]))
     cg.add(var.set_method(config[CONF_INTEGRATION_METHOD]))
-    cg.add(var.set_restore(config[CONF_RESTORE]))
+    if config[CONF_RESTORE]:
+        accumulator = await cg.get_variable(config[CONF_PERSISTENT_ACCUMULATOR_ID])
+        cg.add(var.set_accumulator(accumulator))
 
 
 @automation.register_action(
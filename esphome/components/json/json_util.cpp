@@ -16,13 +16,36 @@ namespace json {
 
 static const char *const TAG = "json";
 
-static std::vector<char> global_json_build_buffer;  // NOLINT
+/// Size of the document build_json() tries first, on the stack. Entity states and most MQTT messages fit in it.
+static const size_t STACK_DOCUMENT_SIZE = 512;
+
+/// Places the heap documents in SPI RAM when available, they are large and only live for a single call.
+struct BulkJsonAllocator {
+  void *allocate(size_t size) { return allocate_memory(size, MemoryClass::BULK); }
+  void deallocate(void *ptr) { free_memory(ptr); }
+  void *reallocate(void *ptr, size_t new_size) { return reallocate_memory(ptr, new_size, MemoryClass::BULK); }
+};
+using BulkJsonDocument = BasicJsonDocument<BulkJsonAllocator>;
+
+static std::string serialize_document(const JsonDocument &json_document) {
+  std::string output;
+  // one allocation for the output instead of growing it while serializing
+  output.reserve(measureJson(json_document));
+  serializeJson(json_document, output);
+  return output;
+}
 
 std::string build_json(const json_build_t &f) {
-  // Here we are allocating up to 5kb of memory,
-  // with the heap size minus 2kb to be safe if less than 5kb
+  {
+    StaticJsonDocument<STACK_DOCUMENT_SIZE> json_document;
+    JsonObject root = json_document.to<JsonObject>();
+    f(root);
+    if (!json_document.overflowed())
+      return serialize_document(json_document);
+  }
+
+  // Larger documents are built on the heap, allocating up to the largest free block
   // as we can not have a true dynamic sized document.
-  // The excess memory is freed below with `shrinkToFit()`
 #ifdef USE_ESP8266
   const size_t free_heap = ESP.getMaxFreeBlockSize();  // NOLINT(readability-static-accessed-through-instance)
 #elif defined(USE_ESP32)
@@ -33,10 +56,10 @@ std::string build_json(const json_build_t &f) {
   const size_t free_heap = lt_heap_get_free();
 #endif
 
-  size_t request_size = std::min(free_heap, (size_t) 512);
+  size_t request_size = std::min(free_heap, STACK_DOCUMENT_SIZE * 2);
   while (true) {
     ESP_LOGV(TAG, "Attempting to allocate %u bytes for JSON serialization", request_size);
-    DynamicJsonDocument json_document(request_size);
+    BulkJsonDocument json_document(request_size);
     if (json_document.capacity() == 0) {
       ESP_LOGE(TAG,
                "Could not allocate memory for JSON document! Requested %u bytes, largest free heap block: %u bytes",
@@ -54,11 +77,8 @@ std::string build_json(const json_build_t &f) {
       request_size = std::min(request_size * 2, free_heap);
       continue;
     }
-    json_document.shrinkToFit();
-    ESP_LOGV(TAG, "Size after shrink %u bytes", json_document.capacity());
-    std::string output;
-    serializeJson(json_document, output);
-    return output;
+    ESP_LOGV(TAG, "Document uses %u bytes", json_document.memoryUsage());
+    return serialize_document(json_document);
   }
 }
 
@@ -78,7 +98,7 @@ bool parse_json(const std::string &data, const json_parse_t &f) {
 #endif
   size_t request_size = std::min(free_heap, (size_t) (data.size() * 1.5));
   while (true) {
-    DynamicJsonDocument json_document(request_size);
+    BulkJsonDocument json_document(request_size);
     if (json_document.capacity() == 0) {
       ESP_LOGE(TAG, "Could not allocate memory for JSON document! Requested %u bytes, free heap: %u", request_size,
                free_heap);
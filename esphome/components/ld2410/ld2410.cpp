@@ -1,5 +1,7 @@
 #include "ld2410.h"
 
+#include <cmath>
+#include <cstring>
 #include <utility>
 #ifdef USE_NUMBER
 #include "esphome/components/number/number.h"
@@ -42,6 +44,10 @@ void LD2410Component::dump_config() {
   LOG_SENSOR("  ", "MovingTargetEnergySensor", this->moving_target_energy_sensor_);
   LOG_SENSOR("  ", "StillTargetEnergySensor", this->still_target_energy_sensor_);
   LOG_SENSOR("  ", "DetectionDistanceSensor", this->detection_distance_sensor_);
+  ESP_LOGCONFIG(TAG, "  Gate Energy Aggregation: %s",
+                this->gate_energy_aggregation_ == GATE_ENERGY_MAX    ? "max"
+                : this->gate_energy_aggregation_ == GATE_ENERGY_MEAN ? "mean"
+                                                                     : "last");
   for (sensor::Sensor *s : this->gate_still_sensors_) {
     LOG_SENSOR("  ", "NthGateStillSesnsor", s);
   }
@@ -151,6 +157,18 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
   if (buffer[7] != HEAD || buffer[len - 6] != END || buffer[len - 5] != CHECK)  // Check constant values
     return;  // data head=0xAA, data end=0x55, crc=0x00
 
+  /*
+    Data Type: 7th
+    0x01: Engineering mode
+    0x02: Normal mode
+  */
+  bool engineering_mode = buffer[DATA_TYPES] == 0x01 && len > OUT_PIN_SENSOR + 6;
+#ifdef USE_SENSOR
+  // The frames skipped by the throttle still count towards the gate energies
+  if (engineering_mode)
+    this->aggregate_gate_energies_(buffer);
+#endif
+
   /*
     Reduce data update rate to prevent home assistant database size grow fast
   */
@@ -158,13 +176,6 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
   if (current_millis - last_periodic_millis_ < this->throttle_)
     return;
   last_periodic_millis_ = current_millis;
-
-  /*
-    Data Type: 7th
-    0x01: Engineering mode
-    0x02: Normal mode
-  */
-  bool engineering_mode = buffer[DATA_TYPES] == 0x01;
 #ifdef USE_SWITCH
   if (this->engineering_mode_switch_ != nullptr &&
       current_millis - last_engineering_mode_change_millis_ > this->throttle_) {
@@ -232,7 +243,10 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
     for (std::vector<sensor::Sensor *>::size_type i = 0; i != this->gate_move_sensors_.size(); i++) {
       sensor::Sensor *s = this->gate_move_sensors_[i];
       if (s != nullptr) {
-        s->publish_state(buffer[MOVING_SENSOR_START + i]);
+        float new_energy = this->gate_energy_(this->gate_move_energy_sum_[i], this->gate_move_energy_max_[i],
+                                              buffer[MOVING_SENSOR_START + i]);
+        if (s->get_state() != new_energy)
+          s->publish_state(new_energy);
       }
     }
     /*
@@ -241,7 +255,10 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
     for (std::vector<sensor::Sensor *>::size_type i = 0; i != this->gate_still_sensors_.size(); i++) {
       sensor::Sensor *s = this->gate_still_sensors_[i];
       if (s != nullptr) {
-        s->publish_state(buffer[STILL_SENSOR_START + i]);
+        float new_energy = this->gate_energy_(this->gate_still_energy_sum_[i], this->gate_still_energy_max_[i],
+                                              buffer[STILL_SENSOR_START + i]);
+        if (s->get_state() != new_energy)
+          s->publish_state(new_energy);
       }
     }
     /*
@@ -267,6 +284,11 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
       this->light_sensor_->publish_state(NAN);
     }
   }
+  memset(this->gate_move_energy_sum_, 0, sizeof(this->gate_move_energy_sum_));
+  memset(this->gate_still_energy_sum_, 0, sizeof(this->gate_still_energy_sum_));
+  memset(this->gate_move_energy_max_, 0, sizeof(this->gate_move_energy_max_));
+  memset(this->gate_still_energy_max_, 0, sizeof(this->gate_still_energy_max_));
+  this->gate_energy_frames_ = 0;
 #endif
 #ifdef USE_BINARY_SENSOR
   if (engineering_mode) {
@@ -281,6 +303,36 @@ void LD2410Component::handle_periodic_data_(uint8_t *buffer, int len) {
 #endif
 }
 
+#ifdef USE_SENSOR
+void LD2410Component::aggregate_gate_energies_(const uint8_t *buffer) {
+  // With longer throttles only the first ~25s of frames count, the sums can't overflow before that
+  if (this->gate_energy_frames_ == UINT8_MAX)
+    return;
+  this->gate_energy_frames_++;
+  for (uint8_t i = 0; i < 9; i++) {
+    const uint8_t move = buffer[MOVING_SENSOR_START + i];
+    const uint8_t still = buffer[STILL_SENSOR_START + i];
+    this->gate_move_energy_sum_[i] += move;
+    this->gate_still_energy_sum_[i] += still;
+    this->gate_move_energy_max_[i] = std::max(this->gate_move_energy_max_[i], move);
+    this->gate_still_energy_max_[i] = std::max(this->gate_still_energy_max_[i], still);
+  }
+}
+
+float LD2410Component::gate_energy_(uint16_t sum, uint8_t max, uint8_t last) const {
+  if (this->gate_energy_frames_ == 0)
+    return last;
+  switch (this->gate_energy_aggregation_) {
+    case GATE_ENERGY_MAX:
+      return max;
+    case GATE_ENERGY_MEAN:
+      return roundf(float(sum) * 10.0f / this->gate_energy_frames_) / 10.0f;
+    default:
+      return last;
+  }
+}
+#endif
+
 const char VERSION_FMT[] = "%u.%02X.%02X%02X%02X%02X";
 
 std::string format_version(uint8_t *buffer) {
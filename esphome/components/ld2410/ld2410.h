@@ -133,6 +133,9 @@ enum PeriodicDataValue : uint8_t { HEAD = 0XAA, END = 0x55, CHECK = 0x00 };
 
 enum AckDataStructure : uint8_t { COMMAND = 6, COMMAND_STATUS = 7 };
 
+/// How the gate energies of the engineering mode frames within one throttle period are combined
+enum GateEnergyAggregation : uint8_t { GATE_ENERGY_LAST, GATE_ENERGY_MAX, GATE_ENERGY_MEAN };
+
 //  char cmd[2] = {enable ? 0xFF : 0xFE, 0x00};
 class LD2410Component : public Component, public uart::UARTDevice {
 #ifdef USE_SENSOR
@@ -190,6 +193,7 @@ class LD2410Component : public Component, public uart::UARTDevice {
 #ifdef USE_SENSOR
   void set_gate_move_sensor(int gate, sensor::Sensor *s);
   void set_gate_still_sensor(int gate, sensor::Sensor *s);
+  void set_gate_energy_aggregation(GateEnergyAggregation aggregation) { this->gate_energy_aggregation_ = aggregation; }
 #endif
   void set_throttle(uint16_t value) { this->throttle_ = value; };
   void set_bluetooth_password(const std::string &password);
@@ -208,6 +212,12 @@ class LD2410Component : public Component, public uart::UARTDevice {
   void handle_periodic_data_(uint8_t *buffer, int len);
   bool handle_ack_data_(uint8_t *buffer, int len);
   void readline_(int readch, uint8_t *buffer, int len);
+#ifdef USE_SENSOR
+  /// Adds the gate energies of an engineering mode frame to the current throttle period.
+  void aggregate_gate_energies_(const uint8_t *buffer);
+  /// The aggregated energy of one gate, from the sum and the maximum over the period.
+  float gate_energy_(uint16_t sum, uint8_t max, uint8_t last) const;
+#endif
   void query_parameters_();
   void get_version_();
   void get_mac_();
@@ -230,6 +240,13 @@ class LD2410Component : public Component, public uart::UARTDevice {
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> gate_still_sensors_ = std::vector<sensor::Sensor *>(9);
   std::vector<sensor::Sensor *> gate_move_sensors_ = std::vector<sensor::Sensor *>(9);
+  GateEnergyAggregation gate_energy_aggregation_{GATE_ENERGY_LAST};
+  /// Gate energies of the engineering mode frames since the last publish
+  uint16_t gate_move_energy_sum_[9]{};
+  uint16_t gate_still_energy_sum_[9]{};
+  uint8_t gate_move_energy_max_[9]{};
+  uint8_t gate_still_energy_max_[9]{};
+  uint8_t gate_energy_frames_{0};
 #endif
 };
 
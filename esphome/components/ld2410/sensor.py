@@ -13,7 +13,7 @@ from esphome.const import (
     ICON_MOTION_SENSOR,
     ICON_LIGHTBULB,
 )
-from . import CONF_LD2410_ID, LD2410Component
+from . import CONF_LD2410_ID, LD2410Component, ld2410_ns
 
 DEPENDENCIES = ["ld2410"]
 CONF_MOVING_DISTANCE = "moving_distance"
@@ -22,10 +22,21 @@ CONF_MOVING_ENERGY = "moving_energy"
 CONF_STILL_ENERGY = "still_energy"
 CONF_DETECTION_DISTANCE = "detection_distance"
 CONF_MOVE_ENERGY = "move_energy"
+CONF_GATE_ENERGY_AGGREGATION = "gate_energy_aggregation"
+
+GateEnergyAggregation = ld2410_ns.enum("GateEnergyAggregation")
+GATE_ENERGY_AGGREGATIONS = {
+    "last": GateEnergyAggregation.GATE_ENERGY_LAST,
+    "max": GateEnergyAggregation.GATE_ENERGY_MAX,
+    "mean": GateEnergyAggregation.GATE_ENERGY_MEAN,
+}
 
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(CONF_LD2410_ID): cv.use_id(LD2410Component),
+        cv.Optional(CONF_GATE_ENERGY_AGGREGATION, default="last"): cv.enum(
+            GATE_ENERGY_AGGREGATIONS, lower=True
+        ),
         cv.Optional(CONF_MOVING_DISTANCE): sensor.sensor_schema(
             device_class=DEVICE_CLASS_DISTANCE,
             unit_of_measurement=UNIT_CENTIMETER,
@@ -80,6 +91,11 @@ CONFIG_SCHEMA = CONFIG_SCHEMA.extend(
 
 async def to_code(config):
     ld2410_component = await cg.get_variable(config[CONF_LD2410_ID])
+    cg.add(
+        ld2410_component.set_gate_energy_aggregation(
+            config[CONF_GATE_ENERGY_AGGREGATION]
+        )
+    )
     if moving_distance_config := config.get(CONF_MOVING_DISTANCE):
         sens = await sensor.new_sensor(moving_distance_config)
         cg.add(ld2410_component.set_moving_target_distance_sensor(sens))
@@ -67,6 +67,14 @@ class ESPColorView : public ESPColorSettable {
       return;
     *this->effect_data_ = effect_data;
   }
+  /// Store an already corrected color, see get_color_correction().
+  void set_raw(const Color &color) {
+    *this->red_ = color.red;
+    *this->green_ = color.green;
+    *this->blue_ = color.blue;
+    if (this->white_ != nullptr)
+      *this->white_ = color.white;
+  }
   void fade_to_white(uint8_t amnt) override { this->set(this->get().fade_to_white(amnt)); }
   void fade_to_black(uint8_t amnt) override { this->set(this->get().fade_to_black(amnt)); }
   void lighten(uint8_t delta) override { this->set(this->get().lighten(delta)); }
@@ -88,11 +96,15 @@ class ESPColorView : public ESPColorSettable {
       return 0;
     return *this->white_;
   }
+  Color get_raw() const {
+    return Color(this->get_red_raw(), this->get_green_raw(), this->get_blue_raw(), this->get_white_raw());
+  }
   uint8_t get_effect_data() const {
     if (this->effect_data_ == nullptr)
       return 0;
     return *this->effect_data_;
   }
+  const ESPColorCorrection *get_color_correction() const { return this->color_correction_; }
   void raw_set_color_correction(const ESPColorCorrection *color_correction) {
     this->color_correction_ = color_correction;
   }
@@ -10,6 +10,15 @@ int32_t HOT interpret_index(int32_t index, int32_t size) {
   return index;
 }
 
+/// Copy a LED, without converting back and forth through the (lossy) color correction when both use the same one.
+static inline void copy_color(const ESPColorView &src, ESPColorView dst) {
+  if (src.get_color_correction() == dst.get_color_correction()) {
+    dst.set_raw(src.get_raw());
+  } else {
+    dst.set(src.get());
+  }
+}
+
 ESPColorView ESPRangeView::operator[](int32_t index) const {
   index = interpret_index(index, this->size()) + this->begin_;
   return (*this->parent_)[index];
@@ -18,8 +27,16 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
+  // all LEDs usually share one correction (a partition may span several lights), only correct the color once for it
+  const ESPColorCorrection *correction = nullptr;
+  Color corrected;
   for (int32_t i = this->begin_; i < this->end_; i++) {
-    (*this->parent_)[i] = color;
+    ESPColorView view = (*this->parent_)[i];
+    if (view.get_color_correction() != correction) {
+      correction = view.get_color_correction();
+      corrected = correction->color_correct(color);
+    }
+    view.set_raw(corrected);
   }
 }
 
@@ -67,7 +84,7 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
 
   if (this->parent_ != rhs.parent_) {
     for (int32_t i = 0; i < this->size(); i++)
-      (*this)[i].set(rhs[i].get());
+      copy_color(rhs[i], (*this)[i]);
     return *this;
   }
 
@@ -78,12 +95,12 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
-      (*this)[i].set(rhs[i].get());
+      copy_color(rhs[i], (*this)[i]);
     }
   } else {
     // Copy from right
     for (int32_t i = this->size() - 1; i >= 0; i--) {
-      (*this)[i].set(rhs[i].get());
+      copy_color(rhs[i], (*this)[i]);
     }
   }
 
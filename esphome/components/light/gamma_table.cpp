@@ -0,0 +1,53 @@
+#include "gamma_table.h"
+#include "esphome/core/helpers.h"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace light {
+
+/// Interpolating between 256 steps is accurate to about 1e-5, below the resolution of 16 bit PWM.
+static const size_t GAMMA_TABLE_STEPS = 256;
+
+struct GammaTable {
+  float gamma;
+  float values[GAMMA_TABLE_STEPS + 1];
+};
+
+static const GammaTable *get_gamma_table(float gamma) {
+  static std::vector<std::unique_ptr<GammaTable>> tables;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  static const GammaTable *last = nullptr;                 // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+  if (last != nullptr && last->gamma == gamma)
+    return last;
+  for (auto &table : tables) {
+    if (table->gamma == gamma)
+      return last = table.get();
+  }
+  auto table = make_unique<GammaTable>();
+  table->gamma = gamma;
+  for (size_t i = 0; i <= GAMMA_TABLE_STEPS; i++)
+    table->values[i] = powf(float(i) / GAMMA_TABLE_STEPS, gamma);
+  last = table.get();
+  tables.push_back(std::move(table));
+  return last;
+}
+
+float gamma_correct_lut(float value, float gamma) {
+  if (value <= 0.0f)
+    return 0.0f;
+  if (gamma <= 0.0f)
+    return value;
+  if (value >= 1.0f)
+    return gamma_correct(value, gamma);
+
+  const GammaTable *table = get_gamma_table(gamma);
+  float pos = value * GAMMA_TABLE_STEPS;
+  size_t index = static_cast<size_t>(pos);
+  float fraction = pos - index;
+  return table->values[index] + (table->values[index + 1] - table->values[index]) * fraction;
+}
+
+}  // namespace light
+}  // namespace esphome
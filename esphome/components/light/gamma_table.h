@@ -0,0 +1,14 @@
+#pragma once
+
+namespace esphome {
+namespace light {
+
+/** Fast equivalent of gamma_correct(value, gamma) for values between 0 and 1.
+ *
+ * Looks the value up in a table with linear interpolation instead of calling powf(). There is one table per gamma
+ * value, shared by all lights using it, calculated on first use.
+ */
+float gamma_correct_lut(float value, float gamma);
+
+}  // namespace light
+}  // namespace esphome
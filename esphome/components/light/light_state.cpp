@@ -1,3 +1,4 @@
+#include "esphome/core/application.h"
 #include "esphome/core/log.h"
 #include "light_state.h"
 #include "light_output.h"
@@ -16,6 +17,20 @@ LightCall LightState::turn_off() { return this->make_call().set_state(false); }
 LightCall LightState::toggle() { return this->make_call().set_state(!this->remote_values.is_on()); }
 LightCall LightState::make_call() { return LightCall(this); }
 
+uint8_t LightState::batch_depth_ = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void LightState::begin_batch() { batch_depth_++; }
+void LightState::end_batch() {
+  if (batch_depth_ == 0 || --batch_depth_ != 0)
+    return;
+  for (auto *light : App.get_lights()) {
+    if (light->next_write_) {
+      light->next_write_ = false;
+      light->output_->write_state(light);
+    }
+  }
+}
+
 struct LightStateRTCState {
   ColorMode color_mode{ColorMode::UNKNOWN};
   bool state{false};
@@ -138,8 +153,8 @@ void LightState::loop() {
     }
   }
 
-  // Write state to the light
-  if (this->next_write_) {
+  // Write state to the light, unless a batch of calls is still being applied
+  if (this->next_write_ && batch_depth_ == 0) {
     this->next_write_ = false;
     this->output_->write_state(this);
   }
@@ -43,6 +43,14 @@ class LightState : public EntityBase, public Component {
   LightCall toggle();
   LightCall make_call();
 
+  /** Defer the output writes of all lights until the matching end_batch().
+   *
+   * Calls performed in between only update the values of the lights. end_batch() then writes every light that
+   * changed right away, so that their outputs switch together instead of each in its own loop(). Batches can nest.
+   */
+  static void begin_batch();
+  static void end_batch();
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Load state from preferences
@@ -186,6 +194,8 @@ class LightState : public EntityBase, public Component {
   std::unique_ptr<LightTransformer> transformer_{nullptr};
   /// Whether the light value should be written in the next cycle.
   bool next_write_{true};
+  /// Depth of begin_batch() calls, no light writes its output while non-zero.
+  static uint8_t batch_depth_;
 
   /// Object used to store the persisted values of the light.
   ESPPreferenceObject rtc_;
@@ -0,0 +1,34 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_SENSORS, CONF_UPDATE_INTERVAL
+
+CODEOWNERS = ["@esphome/core"]
+AUTO_LOAD = ["sensor"]
+
+CONF_REPORT_INTERVAL = "report_interval"
+
+load_generator_ns = cg.esphome_ns.namespace("load_generator")
+LoadGenerator = load_generator_ns.class_("LoadGenerator", cg.Component)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(LoadGenerator),
+        cv.Optional(CONF_SENSORS, default=100): cv.int_range(min=1, max=10000),
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="1s"
+        ): cv.positive_not_null_time_period,
+        cv.Optional(
+            CONF_REPORT_INTERVAL, default="10s"
+        ): cv.positive_not_null_time_period,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(
+        config[CONF_ID],
+        config[CONF_SENSORS],
+        config[CONF_UPDATE_INTERVAL].total_milliseconds,
+    )
+    await cg.register_component(var, config)
+    cg.add(var.set_report_interval(config[CONF_REPORT_INTERVAL].total_milliseconds))
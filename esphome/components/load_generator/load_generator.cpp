@@ -0,0 +1,100 @@
+#include "load_generator.h"
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_MQTT
+#include "esphome/components/mqtt/mqtt_sensor.h"
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+namespace esphome {
+namespace load_generator {
+
+static const char *const TAG = "load_generator";
+
+// "Load 00000" and "load_00000", with their terminators
+static const size_t NAME_SIZE = 11;
+
+LoadGenerator::LoadGenerator(uint16_t count, uint32_t update_interval)
+    : count_(count), update_interval_(update_interval) {
+  this->rate_ = float(count) / (float(update_interval) * 1000.0f);
+  this->sensors_.reset(new sensor::Sensor[count]);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->names_.reset(new char[count * NAME_SIZE * 2]);
+  for (uint16_t i = 0; i < count; i++) {
+    char *name = &this->names_[i * NAME_SIZE * 2];
+    char *object_id = name + NAME_SIZE;
+    snprintf(name, NAME_SIZE, "Load %05u", i);
+    snprintf(object_id, NAME_SIZE, "load_%05u", i);
+    sensor::Sensor *sensor = &this->sensors_[i];
+    sensor->set_name(name);
+    sensor->set_object_id(object_id);
+    sensor->set_accuracy_decimals(0);
+    App.register_sensor(sensor);
+#ifdef USE_MQTT
+    App.register_component(new mqtt::MQTTSensorComponent(sensor));  // NOLINT(cppcoreguidelines-owning-memory)
+#endif
+  }
+}
+
+void LoadGenerator::setup() {
+  this->last_loop_ = micros();
+  this->report_start_ = millis();
+  this->set_interval(this->report_interval_, [this]() { this->report_(); });
+}
+
+void LoadGenerator::loop() {
+  const uint32_t now = micros();
+  const uint32_t gap = now - this->last_loop_;
+  this->last_loop_ = now;
+  this->max_loop_gap_ = std::max(this->max_loop_gap_, gap);
+
+  this->owed_ += gap * this->rate_;
+  uint32_t due = this->owed_;
+  this->owed_ -= due;
+  if (due > this->count_) {
+    this->dropped_ += due - this->count_;
+    due = this->count_;
+  }
+
+  for (uint32_t i = 0; i < due; i++) {
+    const uint32_t start = micros();
+    this->sensors_[this->next_].publish_state(this->value_++ % 1000);
+    const uint32_t duration = micros() - start;
+    this->publish_time_ += duration;
+    this->max_publish_time_ = std::max(this->max_publish_time_, duration);
+    this->next_ = (this->next_ + 1) % this->count_;
+  }
+  this->published_ += due;
+}
+
+void LoadGenerator::report_() {
+  const uint32_t now = millis();
+  const float seconds = (now - this->report_start_) / 1e3f;
+  const uint32_t average = this->published_ != 0 ? this->publish_time_ / this->published_ : 0;
+  ESP_LOGI(TAG,
+           "%.0f updates/s of %.0f/s, %" PRIu32 " dropped, publishing took %" PRIu32 "us on average and %" PRIu32
+           "us at most, loop gap up to %" PRIu32 "us",
+           this->published_ / seconds, this->rate_ * 1e6f, this->dropped_, average, this->max_publish_time_,
+           this->max_loop_gap_);
+  this->report_start_ = now;
+  this->published_ = 0;
+  this->dropped_ = 0;
+  this->publish_time_ = 0;
+  this->max_publish_time_ = 0;
+  this->max_loop_gap_ = 0;
+}
+
+void LoadGenerator::dump_config() {
+  ESP_LOGCONFIG(TAG, "Load Generator:");
+  ESP_LOGCONFIG(TAG, "  Sensors: %u", this->count_);
+  ESP_LOGCONFIG(TAG, "  Update Interval: %" PRIu32 "ms", this->update_interval_);
+  ESP_LOGCONFIG(TAG, "  Total Rate: %.0f updates/s", this->rate_ * 1e6f);
+  ESP_LOGCONFIG(TAG, "  Report Interval: %" PRIu32 "ms", this->report_interval_);
+}
+
+}  // namespace load_generator
+}  // namespace esphome
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/components/sensor/sensor.h"
+
+#include <memory>
+
+namespace esphome {
+namespace load_generator {
+
+/** Synthesizes sensors that publish at a fixed rate, to find out how many updates the API, MQTT and the web server
+ * keep up with.
+ *
+ * The sensors are created when constructing, before the other components are set up, so they are exposed like any
+ * configured sensor. Their updates are spread evenly: each loop() publishes the updates that became due since the
+ * previous one, round-robin over the sensors. Updates that are due for the same sensor more than once in a loop are
+ * dropped, as the loop couldn't keep up with them.
+ *
+ * A report is logged every report interval, with the achieved rate, the dropped updates, how long publishing took
+ * (which includes sending the state to the API clients, MQTT and the web server) and the longest gap between loops.
+ */
+class LoadGenerator : public Component {
+ public:
+  /// @param count The number of sensors.
+  /// @param update_interval How often each sensor publishes, in milliseconds.
+  LoadGenerator(uint16_t count, uint32_t update_interval);
+
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::DATA; }
+
+  void set_report_interval(uint32_t report_interval) { this->report_interval_ = report_interval; }
+
+ protected:
+  void report_();
+
+  uint16_t count_;
+  uint32_t update_interval_;
+  uint32_t report_interval_{10000};
+  std::unique_ptr<sensor::Sensor[]> sensors_;
+  /// Names and object IDs of the sensors, the entities only keep pointers to them
+  std::unique_ptr<char[]> names_;
+
+  uint16_t next_{0};
+  uint32_t value_{0};
+  /// Updates per microsecond, over all sensors
+  float rate_;
+  /// Fraction of an update that was due, but not published yet
+  float owed_{0.0f};
+  uint32_t last_loop_{0};
+
+  // Since the last report
+  uint32_t report_start_{0};
+  uint32_t published_{0};
+  uint32_t dropped_{0};
+  uint64_t publish_time_{0};
+  uint32_t max_publish_time_{0};
+  uint32_t max_loop_gap_{0};
+};
+
+}  // namespace load_generator
+}  // namespace esphome
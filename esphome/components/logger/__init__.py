@@ -170,12 +170,26 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_LOG_BUFFER_SIZE = "log_buffer_size"
+
+
+def validate_log_buffer_size(config):
+    size = config[CONF_LOG_BUFFER_SIZE]
+    if size != 0 and size < 2 * config[CONF_TX_BUFFER_SIZE]:
+        raise cv.Invalid(
+            f"{CONF_LOG_BUFFER_SIZE} must be at least twice {CONF_TX_BUFFER_SIZE}",
+            [CONF_LOG_BUFFER_SIZE],
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Logger),
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
             cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+            cv.Optional(CONF_LOG_BUFFER_SIZE, default=0): cv.validate_bytes,
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
             cv.SplitDefault(
                 CONF_HARDWARE_UART,
@@ -219,6 +233,7 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
+    validate_log_buffer_size,
 )
 
 
@@ -233,6 +248,9 @@ async def to_code(config):
             )
         )
     cg.add(log.pre_setup())
+    if config[CONF_LOG_BUFFER_SIZE] > 0:
+        cg.add_define("USE_LOGGER_RING_BUFFER")
+        cg.add(log.init_log_buffer(config[CONF_LOG_BUFFER_SIZE]))
 
     for tag, level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
@@ -356,7 +374,9 @@ LOGGER_LOG_ACTION_SCHEMA = cv.All(
 )
 
 
-@automation.register_action(CONF_LOGGER_LOG, LambdaAction, LOGGER_LOG_ACTION_SCHEMA)
+@automation.register_action(
+    CONF_LOGGER_LOG, LambdaAction, LOGGER_LOG_ACTION_SCHEMA, synchronous=True
+)
 async def logger_log_action_to_code(config, action_id, template_arg, args):
     esp_log = LOG_LEVEL_TO_ESP_LOG[config[CONF_LEVEL]]
     args_ = [cg.RawExpression(str(x)) for x in config[CONF_ARGS]]
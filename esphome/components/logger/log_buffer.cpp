@@ -0,0 +1,94 @@
+#include "log_buffer.h"
+
+#ifdef USE_LOGGER_RING_BUFFER
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+bool LogBuffer::init(size_t size) {
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  size &= ~(alignof(Record) - 1);
+  this->data_ = allocator.allocate(size);
+  if (this->data_ == nullptr)
+    return false;
+  this->size_ = size;
+  return true;
+}
+
+bool LogBuffer::push_(uint8_t level, const char *tag, uint16_t line, const char *thread_name, size_t max_len,
+                      const char *format, bool format_in_flash, va_list args) {
+  if (this->data_ == nullptr)
+    return false;
+  size_t name_len = thread_name == nullptr ? 0 : std::min<size_t>(strlen(thread_name), 255);
+  // reserve room for the longest message including the terminator vsnprintf always writes
+  size_t needed = record_size_(name_len + max_len + 1);
+
+  LockGuard guard(this->write_lock_);
+  size_t head = this->head_.load(std::memory_order_relaxed);
+  size_t tail = this->tail_.load(std::memory_order_acquire);
+  // The comparisons are strict so head never catches up with tail, head == tail always means empty.
+  size_t pos = head;
+  if (head >= tail) {
+    if (this->size_ - head <= needed) {
+      if (tail <= needed) {
+        this->dropped_++;
+        return false;
+      }
+      // the consumer also wraps on its own if there is no room for a record header
+      if (this->size_ - head >= sizeof(Record))
+        reinterpret_cast<Record *>(this->data_ + head)->message_len = WRAP_MARKER;
+      pos = 0;
+    }
+  } else if (tail - head <= needed) {
+    this->dropped_++;
+    return false;
+  }
+
+  auto *record = reinterpret_cast<Record *>(this->data_ + pos);
+  char *text = reinterpret_cast<char *>(record + 1);
+  memcpy(text, thread_name, name_len);
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  int ret = format_in_flash ? vsnprintf_P(text + name_len, max_len + 1, format, args)
+                            : vsnprintf(text + name_len, max_len + 1, format, args);
+#else
+  int ret = vsnprintf(text + name_len, max_len + 1, format, args);
+#endif
+  if (ret < 0)
+    ret = 0;
+  record->tag = tag;
+  record->line = line;
+  record->message_len = std::min<size_t>(ret, max_len);
+  record->level = level;
+  record->thread_name_len = name_len;
+  this->head_.store(pos + record_size_(name_len + record->message_len), std::memory_order_release);
+  return true;
+}
+
+const LogBuffer::Record *LogBuffer::front(size_t end) {
+  size_t tail = this->tail_.load(std::memory_order_relaxed);
+  if (tail == end)
+    return nullptr;
+  if (this->size_ - tail < sizeof(Record) ||
+      reinterpret_cast<Record *>(this->data_ + tail)->message_len == WRAP_MARKER) {
+    tail = 0;
+    this->tail_.store(0, std::memory_order_release);
+    if (tail == end)
+      return nullptr;
+  }
+  return reinterpret_cast<Record *>(this->data_ + tail);
+}
+
+void LogBuffer::pop() {
+  size_t tail = this->tail_.load(std::memory_order_relaxed);
+  auto *record = reinterpret_cast<Record *>(this->data_ + tail);
+  this->tail_.store(tail + record_size_(record->thread_name_len + record->message_len), std::memory_order_release);
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_RING_BUFFER
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_LOGGER_RING_BUFFER
+
+#include <atomic>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/helpers.h"
+
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+#include "WString.h"
+#endif
+
+namespace esphome {
+namespace logger {
+
+/** Ring buffer of formatted log records, drained by Logger::loop().
+ *
+ * Any task may push, producers are serialized by a mutex. The single consumer (the main loop) never takes the
+ * mutex, head and tail are only published with atomic stores. Records are stored contiguously; when a record does
+ * not fit before the end of the buffer a wrap marker is written and it starts over at the beginning.
+ */
+class LogBuffer {
+ public:
+  struct Record {
+    const char *tag;
+    uint16_t line;
+    /// Length of the message text, not null terminated
+    uint16_t message_len;
+    uint8_t level;
+    /// Length of the task name following the record, 0 for the main task
+    uint8_t thread_name_len;
+
+    const char *thread_name() const { return reinterpret_cast<const char *>(this + 1); }
+    const char *message() const { return this->thread_name() + this->thread_name_len; }
+  };
+
+  /// Allocate the buffer, returns false if out of memory.
+  bool init(size_t size);
+
+  /** Format a message into the buffer.
+   *
+   * @param max_len Longest message text to store, longer ones are truncated.
+   * @return false if there was no room and the message was dropped.
+   */
+  bool push(uint8_t level, const char *tag, uint16_t line, const char *thread_name, size_t max_len,
+            const char *format, va_list args) {
+    return this->push_(level, tag, line, thread_name, max_len, format, false, args);
+  }
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  bool push(uint8_t level, const char *tag, uint16_t line, const char *thread_name, size_t max_len,
+            const __FlashStringHelper *format, va_list args) {
+    return this->push_(level, tag, line, thread_name, max_len, reinterpret_cast<const char *>(format), true, args);
+  }
+#endif
+
+  /// Position after the newest record, pass to front() to stop at the records pushed so far.
+  size_t mark() const { return this->head_.load(std::memory_order_acquire); }
+  /// The oldest record, or nullptr if everything up to end was consumed. Only valid until pop().
+  const Record *front(size_t end);
+  /// Release the record returned by front().
+  void pop();
+
+  /// Number of messages dropped since the last call.
+  uint32_t take_dropped() { return this->dropped_.exchange(0); }
+
+ protected:
+  bool push_(uint8_t level, const char *tag, uint16_t line, const char *thread_name, size_t max_len,
+             const char *format, bool format_in_flash, va_list args);
+
+  static constexpr uint16_t WRAP_MARKER = 0xFFFF;
+  static size_t record_size_(size_t payload) {
+    // keep records aligned for the tag pointer
+    return (sizeof(Record) + payload + alignof(Record) - 1) & ~(alignof(Record) - 1);
+  }
+
+  uint8_t *data_{nullptr};
+  size_t size_{0};
+  /// Written by producers only
+  std::atomic<size_t> head_{0};
+  /// Written by the consumer only
+  std::atomic<size_t> tail_{0};
+  std::atomic<uint32_t> dropped_{0};
+  Mutex write_lock_;
+};
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_LOGGER_RING_BUFFER
@@ -9,6 +9,7 @@ namespace esphome {
 namespace logger {
 
 static const char *const TAG = "logger";
+static const uint8_t LOG_LEVEL_CACHE_SIZE = 16;
 
 static const char *const LOG_LEVEL_COLORS[] = {
     "",                                            // NONE
@@ -31,7 +32,22 @@ static const char *const LOG_LEVEL_LETTERS[] = {
     "VV",  // VERY_VERBOSE
 };
 
-void Logger::write_header_(int level, const char *tag, int line) {
+const char *Logger::get_thread_name_() {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
+  if (current_task == main_task_)
+    return nullptr;
+#if defined(USE_ESP32)
+  return pcTaskGetName(current_task);
+#else
+  return pcTaskGetTaskName(current_task);
+#endif
+#else
+  return nullptr;
+#endif
+}
+
+void Logger::write_header_(int level, const char *tag, int line, const char *thread_name, int thread_name_len) {
   if (level < 0)
     level = 0;
   if (level > 7)
@@ -39,32 +55,31 @@ void Logger::write_header_(int level, const char *tag, int line) {
 
   const char *color = LOG_LEVEL_COLORS[level];
   const char *letter = LOG_LEVEL_LETTERS[level];
-#if defined(USE_ESP32) || defined(USE_LIBRETINY)
-  TaskHandle_t current_task = xTaskGetCurrentTaskHandle();
-#else
-  void *current_task = nullptr;
-#endif
-  if (current_task == main_task_) {
+  if (thread_name == nullptr) {
     this->printf_to_buffer_("%s[%s][%s:%03u]: ", color, letter, tag, line);
   } else {
-    const char *thread_name = "";
-#if defined(USE_ESP32)
-    thread_name = pcTaskGetName(current_task);
-#elif defined(USE_LIBRETINY)
-    thread_name = pcTaskGetTaskName(current_task);
-#endif
-    this->printf_to_buffer_("%s[%s][%s:%03u]%s[%s]%s: ", color, letter, tag, line,
-                            ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name, color);
+    this->printf_to_buffer_("%s[%s][%s:%03u]%s[%.*s]%s: ", color, letter, tag, line,
+                            ESPHOME_LOG_BOLD(ESPHOME_LOG_COLOR_RED), thread_name_len, thread_name, color);
   }
 }
 
 void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *format, va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+
+  const char *thread_name = this->get_thread_name_();
+#ifdef USE_LOGGER_RING_BUFFER
+  if (this->should_buffer_(thread_name)) {
+    this->log_buffer_.push(level, tag, line, thread_name, this->tx_buffer_size_, format, args);
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
   this->reset_buffer_();
-  this->write_header_(level, tag, line);
+  this->write_header_(level, tag, line, thread_name, thread_name == nullptr ? 0 : strlen(thread_name));
   this->vprintf_to_buffer_(format, args);
   this->write_footer_();
   this->log_message_(level, tag);
@@ -73,7 +88,16 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
                           va_list args) {  // NOLINT
-  if (level > this->level_for(tag) || recursion_guard_)
+  if (level > this->level_for(tag))
+    return;
+
+#ifdef USE_LOGGER_RING_BUFFER
+  if (this->should_buffer_(nullptr)) {
+    this->log_buffer_.push(level, tag, line, nullptr, this->tx_buffer_size_, format, args);
+    return;
+  }
+#endif
+  if (recursion_guard_)
     return;
 
   recursion_guard_ = true;
@@ -93,7 +117,7 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
   uint32_t offset = this->tx_buffer_at_;
 
   // now apply vsnprintf
-  this->write_header_(level, tag, line);
+  this->write_header_(level, tag, line, nullptr, 0);
   this->vprintf_to_buffer_(this->tx_buffer_, args);
   this->write_footer_();
   this->log_message_(level, tag, offset);
@@ -102,15 +126,26 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
 #endif
 
 int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
+  if (this->log_levels_.empty())
+    return ESPHOME_LOG_LEVEL;
+
+  // Every component logs with the same static TAG string, so the level is looked up by the address of the tag once
+  // and then served from a small direct-mapped cache. Other tasks may race on a cache entry, the worst case is one
+  // message filtered with the level of another tag, which the next lookup corrects again.
+  auto &entry = this->log_level_cache_[(reinterpret_cast<uintptr_t>(tag) >> 2) % LOG_LEVEL_CACHE_SIZE];
+  if (entry.tag == tag)
+    return entry.level;
+
+  int level = ESPHOME_LOG_LEVEL;
   for (auto &it : this->log_levels_) {
     if (it.tag == tag) {
-      return it.level;
+      level = it.level;
+      break;
     }
   }
-  return ESPHOME_LOG_LEVEL;
+  entry.level = level;
+  entry.tag = tag;
+  return level;
 }
 
 void HOT Logger::log_message_(int level, const char *tag, int offset) {
@@ -148,9 +183,49 @@ Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size) : baud_rate_(baud_rate
 #endif
 }
 
-#ifdef USE_LOGGER_USB_CDC
+#ifdef USE_LOGGER_RING_BUFFER
+void Logger::init_log_buffer(size_t size) {
+  this->log_buffer_enabled_ = this->log_buffer_.init(size);
+  if (!this->log_buffer_enabled_)
+    ESP_LOGE(TAG, "Could not allocate log buffer of %u bytes", (unsigned) size);
+}
+
+void Logger::drain_log_buffer_() {
+  // Messages logged by the callbacks below are queued behind this mark and written on the next loop.
+  size_t end = this->log_buffer_.mark();
+  recursion_guard_ = true;
+  const LogBuffer::Record *record;
+  while ((record = this->log_buffer_.front(end)) != nullptr) {
+    this->reset_buffer_();
+    this->write_header_(record->level, record->tag, record->line,
+                        record->thread_name_len == 0 ? nullptr : record->thread_name(), record->thread_name_len);
+    this->write_to_buffer_(record->message(), record->message_len);
+    this->write_footer_();
+    this->log_message_(record->level, record->tag);
+    this->log_buffer_.pop();
+  }
+
+  uint32_t dropped = this->log_buffer_.take_dropped();
+  if (dropped != 0) {
+    this->reset_buffer_();
+    this->write_header_(ESPHOME_LOG_LEVEL_WARN, TAG, __LINE__, nullptr, 0);
+    this->printf_to_buffer_("Log buffer full, %" PRIu32 " messages dropped", dropped);
+    this->write_footer_();
+    this->log_message_(ESPHOME_LOG_LEVEL_WARN, TAG);
+  }
+  recursion_guard_ = false;
+}
+#endif
+
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_RING_BUFFER)
 void Logger::loop() {
-#ifdef USE_ARDUINO
+#ifdef USE_LOGGER_RING_BUFFER
+  if (this->log_buffer_enabled_) {
+    this->buffer_main_task_ = true;
+    this->drain_log_buffer_();
+  }
+#endif
+#if defined(USE_LOGGER_USB_CDC) && defined(USE_ARDUINO)
   if (this->uart_ != UART_SELECTION_USB_CDC) {
     return;
   }
@@ -169,6 +244,13 @@ void Logger::loop() {
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  if (!this->log_level_cache_) {
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    this->log_level_cache_.reset(new LogLevelCacheEntry[LOG_LEVEL_CACHE_SIZE]());
+  } else {
+    for (uint8_t i = 0; i < LOG_LEVEL_CACHE_SIZE; i++)
+      this->log_level_cache_[i].tag = nullptr;
+  }
 }
 
 #if defined(USE_ESP32) || defined(USE_ESP8266) || defined(USE_RP2040) || defined(USE_LIBRETINY)
@@ -7,6 +7,8 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#include "log_buffer.h"
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -56,8 +58,14 @@ enum UARTSelection {
 class Logger : public Component {
  public:
   explicit Logger(uint32_t baud_rate, size_t tx_buffer_size);
-#ifdef USE_LOGGER_USB_CDC
+#if defined(USE_LOGGER_USB_CDC) || defined(USE_LOGGER_RING_BUFFER)
   void loop() override;
+#endif
+#ifdef USE_LOGGER_RING_BUFFER
+  /// Queue messages in a buffer of this size and write them out from loop().
+  void init_log_buffer(size_t size);
+  /// Whether messages of the main task are queued now, instead of being written out right away.
+  bool is_buffering() const { return this->log_buffer_enabled_ && this->buffer_main_task_; }
 #endif
   /// Manually set the baud rate for serial, set to 0 to disable.
   void set_baud_rate(uint32_t baud_rate);
@@ -96,10 +104,19 @@ class Logger : public Component {
 #endif
 
  protected:
-  void write_header_(int level, const char *tag, int line);
+  /// Name of the task logging, nullptr for the main task.
+  const char *get_thread_name_();
+  void write_header_(int level, const char *tag, int line, const char *thread_name, int thread_name_len);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
   void write_msg_(const char *msg);
+#ifdef USE_LOGGER_RING_BUFFER
+  /// Whether a message logged now has to go through the log buffer.
+  bool should_buffer_(const char *thread_name) const {
+    return this->log_buffer_enabled_ && (thread_name != nullptr || this->recursion_guard_ || this->buffer_main_task_);
+  }
+  void drain_log_buffer_();
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -164,10 +181,22 @@ class Logger : public Component {
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
+  /// Log levels of the tags seen so far, by the address of the tag. Only allocated once there are overrides.
+  struct LogLevelCacheEntry {
+    const char *tag;
+    int level;
+  };
+  std::unique_ptr<LogLevelCacheEntry[]> log_level_cache_;
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
   void *main_task_ = nullptr;
+#ifdef USE_LOGGER_RING_BUFFER
+  LogBuffer log_buffer_;
+  bool log_buffer_enabled_{false};
+  /// Set once loop() runs, from then on the main task queues its messages as well.
+  bool buffer_main_task_{false};
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -233,6 +233,8 @@ async def to_code(config):
         frac = 8
     cg.add(lv_component.set_buffer_frac(int(frac)))
     cg.add(lv_component.set_full_refresh(config[df.CONF_FULL_REFRESH]))
+    if config[df.CONF_DOUBLE_BUFFER]:
+        cg.add(lv_component.set_double_buffer(True))
 
     for font in helpers.esphome_fonts_used:
         await cg.get_variable(font)
@@ -313,6 +315,7 @@ CONFIG_SCHEMA = (
             cv.Optional(df.CONF_DEFAULT_FONT, default="montserrat_14"): lvalid.lv_font,
             cv.Optional(df.CONF_FULL_REFRESH, default=False): cv.boolean,
             cv.Optional(CONF_BUFFER_SIZE, default="100%"): cv.percentage,
+            cv.Optional(df.CONF_DOUBLE_BUFFER, default=False): cv.boolean,
             cv.Optional(df.CONF_LOG_LEVEL, default="WARN"): cv.one_of(
                 *df.LOG_LEVELS, upper=True
             ),
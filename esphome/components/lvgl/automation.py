@@ -63,6 +63,7 @@ async def action_to_code(
     action_id,
     template_arg,
     args,
+    deferred=False,
 ):
     await wait_for_widgets()
     async with LambdaContext(parameters=args, where=action_id) as context:
@@ -71,6 +72,9 @@ async def action_to_code(
         for widget in widgets:
             await action(widget)
     var = cg.new_Pvariable(action_id, template_arg, await context.get_lambda())
+    if deferred:
+        # Only the last value before a frame has to be shown
+        cg.add(var.set_deferred(True))
     return var
 
 
@@ -85,7 +89,9 @@ async def update_to_code(config, action_id, template_arg, args):
             lv.event_send(widget.obj, UPDATE_EVENT, nullptr)
 
     widgets = await get_widgets(config[CONF_ID])
-    return await action_to_code(widgets, do_update, action_id, template_arg, args)
+    return await action_to_code(
+        widgets, do_update, action_id, template_arg, args, deferred=True
+    )
 
 
 @automation.register_condition(
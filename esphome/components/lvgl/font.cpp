@@ -44,8 +44,12 @@ FontEngine::FontEngine(font::Font *esp_font) : font_(esp_font) {
 const lv_font_t *FontEngine::get_lv_font() { return &this->lv_font_; }
 
 const font::GlyphData *FontEngine::get_glyph_data(uint32_t unicode_letter) {
-  if (unicode_letter == last_letter_)
-    return this->last_data_;
+  auto &entry = this->cache_[unicode_letter & (CACHE_SIZE - 1)];
+  if (entry.letter == unicode_letter) {
+    this->cache_hits_++;
+    return entry.data;
+  }
+  this->cache_misses_++;
   uint8_t unicode[5];
   memset(unicode, 0, sizeof unicode);
   if (unicode_letter > 0xFFFF) {
@@ -65,11 +69,10 @@ const font::GlyphData *FontEngine::get_glyph_data(uint32_t unicode_letter) {
   }
   int match_length;
   int glyph_n = this->font_->match_next_glyph(unicode, &match_length);
-  if (glyph_n < 0)
-    return nullptr;
-  this->last_data_ = this->font_->get_glyphs()[glyph_n].get_glyph_data();
-  this->last_letter_ = unicode_letter;
-  return this->last_data_;
+  // missing glyphs are cached too, LVGL keeps asking for them
+  entry.letter = unicode_letter;
+  entry.data = glyph_n < 0 ? nullptr : this->font_->get_glyphs()[glyph_n].get_glyph_data();
+  return entry.data;
 }
 }  // namespace lvgl
 }  // namespace esphome
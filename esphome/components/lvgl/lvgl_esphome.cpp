@@ -83,6 +83,29 @@ static void rounder_cb(lv_disp_drv_t *disp_drv, lv_area_t *area) {
 
 lv_event_code_t lv_api_event;     // NOLINT
 lv_event_code_t lv_update_event;  // NOLINT
+static std::vector<LvDeferredUpdate *> deferred_updates;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void lv_defer_update(LvDeferredUpdate *update) {
+  if (update->update_pending)
+    return;
+  update->update_pending = true;
+  deferred_updates.push_back(update);
+}
+
+void LvglComponent::apply_deferred_updates_() {
+  if (deferred_updates.empty())
+    return;
+  const lv_timer_t *refr_timer = this->disp_->refr_timer;
+  if (refr_timer != nullptr && lv_tick_elaps(refr_timer->last_run) < refr_timer->period)
+    return;
+  // An update may defer others, they go with the next frame
+  std::vector<LvDeferredUpdate *> updates;
+  updates.swap(deferred_updates);
+  for (auto *update : updates) {
+    update->update_pending = false;
+    update->apply_update();
+  }
+}
 void LvglComponent::dump_config() { ESP_LOGCONFIG(TAG, "LVGL:"); }
 void LvglComponent::set_paused(bool paused, bool show_snow) {
   this->paused_ = paused;
@@ -143,12 +166,32 @@ void LvglComponent::draw_buffer_(const lv_area_t *area, const uint8_t *ptr) {
 void LvglComponent::flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   if (!this->paused_) {
     auto now = millis();
+    if (this->draw_buf_.buf2 != nullptr) {
+      // with two buffers LVGL renders into the other one while this one is sent, it waits in
+      // static_wait_cb() before touching this buffer again.
+      for (auto *display : this->displays_) {
+        display->draw_pixels_async(area->x1, area->y1, lv_area_get_width(area), lv_area_get_height(area),
+                                   (const uint8_t *) color_p, display::COLOR_ORDER_RGB, LV_BITNESS, LV_COLOR_16_SWAP);
+      }
+      this->flush_pending_ = true;
+      ESP_LOGV(TAG, "flush_cb, area=%d/%d, %d/%d queued in %dms", area->x1, area->y1, lv_area_get_width(area),
+               lv_area_get_height(area), (int) (millis() - now));
+      return;
+    }
     this->draw_buffer_(area, (const uint8_t *) color_p);
     ESP_LOGV(TAG, "flush_cb, area=%d/%d, %d/%d took %dms", area->x1, area->y1, lv_area_get_width(area),
              lv_area_get_height(area), (int) (millis() - now));
   }
   lv_disp_flush_ready(disp_drv);
 }
+void LvglComponent::finish_flush_() {
+  if (!this->flush_pending_)
+    return;
+  for (auto *display : this->displays_)
+    display->wait_pixels_drawn();
+  this->flush_pending_ = false;
+  lv_disp_flush_ready(&this->disp_drv_);
+}
 IdleTrigger::IdleTrigger(LvglComponent *parent, TemplatableValue<uint32_t> timeout) : timeout_(std::move(timeout)) {
   parent->add_on_idle_callback([this](uint32_t idle_time) {
     if (!this->is_idle_ && idle_time > this->timeout_.value()) {
@@ -168,20 +211,54 @@ LVTouchListener::LVTouchListener(uint16_t long_press_time, uint16_t long_press_r
   this->drv_.type = LV_INDEV_TYPE_POINTER;
   this->drv_.user_data = this;
   this->drv_.read_cb = [](lv_indev_drv_t *d, lv_indev_data_t *data) {
-    auto *l = static_cast<LVTouchListener *>(d->user_data);
-    if (l->touch_pressed_) {
-      data->point.x = l->touch_point_.x;
-      data->point.y = l->touch_point_.y;
-      data->state = LV_INDEV_STATE_PRESSED;
-    } else {
-      data->state = LV_INDEV_STATE_RELEASED;
-    }
+    static_cast<LVTouchListener *>(d->user_data)->read_(data);
   };
 }
 void LVTouchListener::update(const touchscreen::TouchPoints_t &tpoints) {
-  this->touch_pressed_ = !this->parent_->is_paused() && !tpoints.empty();
-  if (this->touch_pressed_)
-    this->touch_point_ = tpoints[0];
+  if (this->parent_->is_paused() || tpoints.empty()) {
+    this->push_release_();
+  } else {
+    this->push_event_(true, tpoints[0].x, tpoints[0].y);
+  }
+}
+void LVTouchListener::push_release_() {
+  // Released where the touch was last seen, LVGL takes the point of the release for the click
+  if (this->events_count_ != 0) {
+    const auto &last = this->events_[(this->events_head_ + this->events_count_ - 1) % EVENT_QUEUE_SIZE];
+    this->push_event_(false, last.x, last.y);
+  } else {
+    this->push_event_(false, this->last_event_.x, this->last_event_.y);
+  }
+}
+void LVTouchListener::push_event_(bool pressed, lv_coord_t x, lv_coord_t y) {
+  if (this->events_count_ != 0) {
+    auto &last = this->events_[(this->events_head_ + this->events_count_ - 1) % EVENT_QUEUE_SIZE];
+    // A move replaces the previous one, and a full queue keeps the latest state
+    if (last.pressed == pressed || this->events_count_ == EVENT_QUEUE_SIZE) {
+      last = {x, y, pressed};
+      return;
+    }
+  } else if (this->last_event_.pressed == pressed) {
+    // Nothing changed since LVGL last read the input
+    if (!pressed || (this->last_event_.x == x && this->last_event_.y == y))
+      return;
+  }
+  this->events_[(this->events_head_ + this->events_count_) % EVENT_QUEUE_SIZE] = {x, y, pressed};
+  this->events_count_++;
+  // Have LVGL read the input with its next timer run
+  if (this->drv_.read_timer != nullptr)
+    lv_timer_ready(this->drv_.read_timer);
+}
+void LVTouchListener::read_(lv_indev_data_t *data) {
+  if (this->events_count_ != 0) {
+    this->last_event_ = this->events_[this->events_head_];
+    this->events_head_ = (this->events_head_ + 1) % EVENT_QUEUE_SIZE;
+    this->events_count_--;
+  }
+  data->point.x = this->last_event_.x;
+  data->point.y = this->last_event_.y;
+  data->state = this->last_event_.pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+  data->continue_reading = this->events_count_ != 0;
 }
 #endif  // USE_LVGL_TOUCHSCREEN
 
@@ -300,12 +377,19 @@ void LvglComponent::setup() {
     this->status_set_error("Memory allocation failure");
     return;
   }
-  lv_disp_draw_buf_init(&this->draw_buf_, buf, nullptr, buffer_pixels);
+  void *buf2 = nullptr;
+  if (this->double_buffer_) {
+    buf2 = lv_custom_mem_alloc(buf_bytes);
+    if (buf2 == nullptr)
+      ESP_LOGW(TAG, "Malloc failed to allocate a second draw buffer of %zu bytes", buf_bytes);
+  }
+  lv_disp_draw_buf_init(&this->draw_buf_, buf, buf2, buffer_pixels);
   lv_disp_drv_init(&this->disp_drv_);
   this->disp_drv_.draw_buf = &this->draw_buf_;
   this->disp_drv_.user_data = this;
   this->disp_drv_.full_refresh = this->full_refresh_;
   this->disp_drv_.flush_cb = static_flush_cb;
+  this->disp_drv_.wait_cb = static_wait_cb;
   this->disp_drv_.rounder_cb = rounder_cb;
   switch (display->get_rotation()) {
     case display::DISPLAY_ROTATION_0_DEGREES:
@@ -346,7 +430,10 @@ void LvglComponent::loop() {
     if (this->show_snow_)
       this->write_random_();
   }
+  this->apply_deferred_updates_();
   lv_timer_handler_run_in_period(5);
+  // don't keep the display (and possibly a shared bus) busy beyond this loop iteration
+  this->finish_flush_();
 }
 bool lv_is_pre_initialise() {
   if (!lv_is_initialized()) {
@@ -411,33 +498,17 @@ void lv_animimg_stop(lv_obj_t *obj) {
 void LvglComponent::static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p) {
   reinterpret_cast<LvglComponent *>(disp_drv->user_data)->flush_cb_(disp_drv, area, color_p);
 }
+void LvglComponent::static_wait_cb(lv_disp_drv_t *disp_drv) {
+  reinterpret_cast<LvglComponent *>(disp_drv->user_data)->finish_flush_();
+}
 }  // namespace lvgl
 }  // namespace esphome
 
 size_t lv_millis(void) { return esphome::millis(); }
 
-#if defined(USE_HOST) || defined(USE_RP2040) || defined(USE_ESP8266)
+// LVGL's heap holds widgets and styles, draw buffers included, none of which need fast memory
 void *lv_custom_mem_alloc(size_t size) {
-  auto *ptr = malloc(size);  // NOLINT
-  if (ptr == nullptr) {
-#if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR
-    esphome::ESP_LOGE(esphome::lvgl::TAG, "Failed to allocate %zu bytes", size);
-#endif
-  }
-  return ptr;
-}
-void lv_custom_mem_free(void *ptr) { return free(ptr); }                            // NOLINT
-void *lv_custom_mem_realloc(void *ptr, size_t size) { return realloc(ptr, size); }  // NOLINT
-#else
-static unsigned cap_bits = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;  // NOLINT
-
-void *lv_custom_mem_alloc(size_t size) {
-  void *ptr;
-  ptr = heap_caps_malloc(size, cap_bits);
-  if (ptr == nullptr) {
-    cap_bits = MALLOC_CAP_8BIT;
-    ptr = heap_caps_malloc(size, cap_bits);
-  }
+  void *ptr = esphome::allocate_memory(size, esphome::MemoryClass::BULK);
   if (ptr == nullptr) {
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_ERROR
     esphome::ESP_LOGE(esphome::lvgl::TAG, "Failed to allocate %zu bytes", size);
@@ -454,15 +525,12 @@ void lv_custom_mem_free(void *ptr) {
 #ifdef ESPHOME_LOG_HAS_VERBOSE
   esphome::ESP_LOGV(esphome::lvgl::TAG, "free %p", ptr);
 #endif
-  if (ptr == nullptr)
-    return;
-  heap_caps_free(ptr);
+  esphome::free_memory(ptr);
 }
 
 void *lv_custom_mem_realloc(void *ptr, size_t size) {
 #ifdef ESPHOME_LOG_HAS_VERBOSE
   esphome::ESP_LOGV(esphome::lvgl::TAG, "realloc %p: %zu", ptr, size);
 #endif
-  return heap_caps_realloc(ptr, size, cap_bits);
+  return esphome::reallocate_memory(ptr, size, esphome::MemoryClass::BULK);
 }
-#endif
@@ -18,8 +18,10 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 #include <lvgl.h>
+#include <cstring>
 #include <vector>
 #include <map>
+#include <tuple>
 #ifdef USE_LVGL_IMAGE
 #include "esphome/components/image/image.h"
 #endif  // USE_LVGL_IMAGE
@@ -75,14 +77,46 @@ using set_value_lambda_t = std::function<void(float)>;
 using event_callback_t = void(_lv_event_t *);
 using text_lambda_t = std::function<const char *()>;
 
-template<typename... Ts> class ObjUpdateAction : public Action<Ts...> {
+/// Set the text of a label, unless it shows that text already. LVGL copies the text and lays the label out again
+/// with every call, even for the same text.
+inline void lv_label_update_text(lv_obj_t *obj, const char *text) {
+  if (strcmp(lv_label_get_text(obj), text) != 0)
+    lv_label_set_text(obj, text);
+}
+
+/// A change of widgets that only has to show with the next frame, see lv_defer_update().
+class LvDeferredUpdate {
+ public:
+  virtual void apply_update() = 0;
+  /// Queued by lv_defer_update() and not applied yet
+  bool update_pending{};
+};
+/// Apply `update` right before LVGL renders its next frame. Deferring it again until then has no effect, so values
+/// published faster than the display refreshes only change the widgets once per frame.
+void lv_defer_update(LvDeferredUpdate *update);
+
+template<typename... Ts> class ObjUpdateAction : public Action<Ts...>, public LvDeferredUpdate {
  public:
   explicit ObjUpdateAction(std::function<void(Ts...)> &&lamb) : lamb_(std::move(lamb)) {}
+  /// Apply the update with the next frame, with the arguments of the last play() before it.
+  void set_deferred(bool deferred) { this->deferred_ = deferred; }
 
-  void play(Ts... x) override { this->lamb_(x...); }
+  void play(Ts... x) override {
+    if (!this->deferred_) {
+      this->lamb_(x...);
+      return;
+    }
+    this->var_ = std::make_tuple(x...);
+    lv_defer_update(this);
+  }
+  void apply_update() override { this->apply_update_(typename gens<sizeof...(Ts)>::type()); }
 
  protected:
+  template<int... S> void apply_update_(seq<S...> /*unused*/) { this->lamb_(std::get<S>(this->var_)...); }
+
   std::function<void(Ts...)> lamb_;
+  bool deferred_{};
+  std::tuple<Ts...> var_{};
 };
 #ifdef USE_LVGL_FONT
 class FontEngine {
@@ -95,10 +129,22 @@ class FontEngine {
   uint16_t height{};
   uint8_t bpp{};
 
+  /// Number of glyph lookups answered from the cache, and the ones that had to search the font.
+  uint32_t get_cache_hits() const { return this->cache_hits_; }
+  uint32_t get_cache_misses() const { return this->cache_misses_; }
+
  protected:
+  /// LVGL asks for the same few glyphs many times per frame, remember recent lookups by their code point.
+  static constexpr size_t CACHE_SIZE = 32;  // must be a power of two
+  struct CacheEntry {
+    uint32_t letter{UINT32_MAX};
+    const font::GlyphData *data{};
+  };
+
   font::Font *font_{};
-  uint32_t last_letter_{};
-  const font::GlyphData *last_data_{};
+  CacheEntry cache_[CACHE_SIZE]{};
+  uint32_t cache_hits_{};
+  uint32_t cache_misses_{};
   lv_font_t lv_font_{};
 };
 #endif  // USE_LVGL_FONT
@@ -115,6 +161,7 @@ class LvglComponent : public PollingComponent {
 
  public:
   static void static_flush_cb(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  static void static_wait_cb(lv_disp_drv_t *disp_drv);
 
   float get_setup_priority() const override { return setup_priority::PROCESSOR; }
   void setup() override;
@@ -129,6 +176,8 @@ class LvglComponent : public PollingComponent {
   void set_full_refresh(bool full_refresh) { this->full_refresh_ = full_refresh; }
   bool is_idle(uint32_t idle_ms) { return lv_disp_get_inactive_time(this->disp_) > idle_ms; }
   void set_buffer_frac(size_t frac) { this->buffer_frac_ = frac; }
+  /// Allocate a second draw buffer, so LVGL can render into one while the other one is sent to the display.
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
   lv_disp_t *get_disp() { return this->disp_; }
   void set_paused(bool paused, bool show_snow);
   void add_event_cb(lv_obj_t *obj, event_callback_t callback, lv_event_code_t event);
@@ -153,6 +202,9 @@ class LvglComponent : public PollingComponent {
   void write_random_();
   void draw_buffer_(const lv_area_t *area, const uint8_t *ptr);
   void flush_cb_(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
+  void finish_flush_();
+  /// Apply the deferred updates if the next lv_timer_handler() call renders a frame
+  void apply_deferred_updates_();
   std::vector<display::Display *> displays_{};
   lv_disp_draw_buf_t draw_buf_{};
   lv_disp_drv_t disp_drv_{};
@@ -169,6 +221,9 @@ class LvglComponent : public PollingComponent {
   CallbackManager<void(uint32_t)> idle_callbacks_{};
   size_t buffer_frac_{1};
   bool full_refresh_{};
+  bool double_buffer_{};
+  /// A flush was started with draw_pixels_async() and lv_disp_flush_ready() was not called yet
+  bool flush_pending_{};
 };
 
 class IdleTrigger : public Trigger<> {
@@ -200,17 +255,36 @@ template<typename... Ts> class LvglCondition : public Condition<Ts...>, public P
 };
 
 #ifdef USE_LVGL_TOUCHSCREEN
+/** Feeds the touchscreen to an LVGL pointer input.
+ *
+ * Touch changes are queued, so that a quick tap between two reads of LVGL isn't lost, and LVGL is told to read the
+ * input with its next timer run instead of waiting for its read period. Consecutive moves are merged into one.
+ */
 class LVTouchListener : public touchscreen::TouchListener, public Parented<LvglComponent> {
  public:
   LVTouchListener(uint16_t long_press_time, uint16_t long_press_repeat_time);
   void update(const touchscreen::TouchPoints_t &tpoints) override;
-  void release() override { touch_pressed_ = false; }
+  void release() override { this->push_release_(); }
   lv_indev_drv_t *get_drv() { return &this->drv_; }
 
  protected:
+  struct TouchEvent {
+    lv_coord_t x;
+    lv_coord_t y;
+    bool pressed;
+  };
+  static const uint8_t EVENT_QUEUE_SIZE = 8;
+
+  void push_event_(bool pressed, lv_coord_t x, lv_coord_t y);
+  void push_release_();
+  void read_(lv_indev_data_t *data);
+
   lv_indev_drv_t drv_{};
-  touchscreen::TouchPoint touch_point_{};
-  bool touch_pressed_{};
+  TouchEvent events_[EVENT_QUEUE_SIZE]{};
+  uint8_t events_head_{0};
+  uint8_t events_count_{0};
+  /// Reported to LVGL while nothing changes
+  TouchEvent last_event_{};
 };
 #endif  // USE_LVGL_TOUCHSCREEN
 
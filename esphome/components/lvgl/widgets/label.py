@@ -10,6 +10,7 @@ from ..defines import (
     LV_LONG_MODES,
 )
 from ..lv_validation import lv_bool, lv_text
+from ..lvcode import lv
 from ..schemas import TEXT_SCHEMA
 from ..types import LvText, WidgetType
 from . import Widget
@@ -34,7 +35,7 @@ class LabelType(WidgetType):
     async def to_code(self, w: Widget, config):
         """For a text object, create and set text"""
         if value := config.get(CONF_TEXT):
-            await w.set_property(CONF_TEXT, await lv_text.process(value))
+            lv.label_update_text(w.obj, await lv_text.process(value))
         await w.set_property(CONF_LONG_MODE, config)
         await w.set_property(CONF_RECOLOR, config)
 
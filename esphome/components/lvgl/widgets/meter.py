@@ -296,7 +296,9 @@ async def indicator_update_to_code(config, action_id, template_arg, args):
     async def set_value(w: Widget):
         set_indicator_values(w.var, w.obj, start_value, end_value)
 
-    return await action_to_code(widget, set_value, action_id, template_arg, args)
+    return await action_to_code(
+        widget, set_value, action_id, template_arg, args, deferred=True
+    )
 
 
 def set_indicator_values(meter, indicator, start_value, end_value):
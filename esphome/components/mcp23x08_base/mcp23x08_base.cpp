@@ -6,15 +6,15 @@ namespace mcp23x08_base {
 
 static const char *const TAG = "mcp23x08_base";
 
-bool MCP23X08Base::digital_read(uint8_t pin) {
-  uint8_t bit = pin % 8;
-  uint8_t reg_addr = mcp23x08_base::MCP23X08_GPIO;
-  uint8_t value = 0;
-  this->read_reg(reg_addr, &value);
-  return value & (1 << bit);
+bool MCP23X08Base::digital_read_hw(uint8_t pin) {
+  uint8_t value;
+  if (!this->read_reg(mcp23x08_base::MCP23X08_GPIO, &value))
+    return false;
+  this->input_mask_ = value;
+  return true;
 }
 
-void MCP23X08Base::digital_write(uint8_t pin, bool value) {
+void MCP23X08Base::digital_write_hw(uint8_t pin, bool value) {
   uint8_t reg_addr = mcp23x08_base::MCP23X08_OLAT;
   this->update_reg(pin, value, reg_addr);
 }
@@ -6,15 +6,16 @@ namespace mcp23x17_base {
 
 static const char *const TAG = "mcp23x17_base";
 
-bool MCP23X17Base::digital_read(uint8_t pin) {
-  uint8_t bit = pin % 8;
-  uint8_t reg_addr = pin < 8 ? mcp23x17_base::MCP23X17_GPIOA : mcp23x17_base::MCP23X17_GPIOB;
-  uint8_t value = 0;
-  this->read_reg(reg_addr, &value);
-  return value & (1 << bit);
+bool MCP23X17Base::digital_read_hw(uint8_t pin) {
+  uint8_t value_a, value_b;
+  if (!this->read_reg(mcp23x17_base::MCP23X17_GPIOA, &value_a) ||
+      !this->read_reg(mcp23x17_base::MCP23X17_GPIOB, &value_b))
+    return false;
+  this->input_mask_ = (uint16_t(value_b) << 8) | value_a;
+  return true;
 }
 
-void MCP23X17Base::digital_write(uint8_t pin, bool value) {
+void MCP23X17Base::digital_write_hw(uint8_t pin, bool value) {
   uint8_t reg_addr = pin < 8 ? mcp23x17_base::MCP23X17_OLATA : mcp23x17_base::MCP23X17_OLATB;
   this->update_reg(pin, value, reg_addr);
 }
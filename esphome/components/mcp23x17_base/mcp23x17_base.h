@@ -36,13 +36,13 @@ enum MCP23X17GPIORegisters {
 
 class MCP23X17Base : public mcp23xxx_base::MCP23XXXBase {
  public:
-  bool digital_read(uint8_t pin) override;
-  void digital_write(uint8_t pin, bool value) override;
   void pin_mode(uint8_t pin, gpio::Flags flags) override;
   void pin_interrupt_mode(uint8_t pin, mcp23xxx_base::MCP23XXXInterruptMode interrupt_mode) override;
 
  protected:
   void update_reg(uint8_t pin, bool pin_value, uint8_t reg_a) override;
+  bool digital_read_hw(uint8_t pin) override;
+  void digital_write_hw(uint8_t pin, bool value) override;
 
   uint8_t olat_a_{0x00};
   uint8_t olat_b_{0x00};
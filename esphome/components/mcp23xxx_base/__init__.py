@@ -15,6 +15,7 @@ from esphome.const import (
 from esphome.core import coroutine
 
 CODEOWNERS = ["@jesserockz"]
+AUTO_LOAD = ["gpio_expander"]
 
 mcp23xxx_base_ns = cg.esphome_ns.namespace("mcp23xxx_base")
 MCP23XXXBase = mcp23xxx_base_ns.class_("MCP23XXXBase", cg.Component)
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "esphome/components/gpio_expander/cached_gpio.h"
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
 
@@ -8,10 +9,10 @@ namespace mcp23xxx_base {
 
 enum MCP23XXXInterruptMode : uint8_t { MCP23XXX_NO_INTERRUPT = 0, MCP23XXX_CHANGE, MCP23XXX_RISING, MCP23XXX_FALLING };
 
-class MCP23XXXBase : public Component {
+class MCP23XXXBase : public Component, public gpio_expander::CachedGpioExpander<uint8_t, 16> {
  public:
-  virtual bool digital_read(uint8_t pin);
-  virtual void digital_write(uint8_t pin, bool value);
+  /// Invalidate the snapshot of the inputs once per loop iteration
+  void loop() override { this->reset_pin_cache_(); }
   virtual void pin_mode(uint8_t pin, gpio::Flags flags);
   virtual void pin_interrupt_mode(uint8_t pin, MCP23XXXInterruptMode interrupt_mode);
 
@@ -26,7 +27,11 @@ class MCP23XXXBase : public Component {
   // update registers with given pin value.
   virtual void update_reg(uint8_t pin, bool pin_value, uint8_t reg_a);
 
+  bool digital_read_cache(uint8_t pin) override { return this->input_mask_ & (1 << pin); }
+
   bool open_drain_ints_;
+  /// The state of the inputs read in digital_read_hw - 1 means HIGH, 0 means LOW
+  uint16_t input_mask_{0x00};
 };
 
 class MCP23XXXGPIOPin : public GPIOPin {
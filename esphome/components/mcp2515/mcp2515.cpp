@@ -20,6 +20,18 @@ bool MCP2515::setup_internal() {
     return false;
   if (this->set_bitrate_(this->bit_rate_, this->mcp_clock_) != canbus::ERROR_OK)
     return false;
+  canbus::CanAcceptanceFilter filter;
+  if (this->get_acceptance_filter(filter)) {
+    // both receive buffers use the same filter, so frames roll over from RXB0 to RXB1
+    if (this->set_filter_mask_(MASK0, filter.use_extended_id, filter.mask) != canbus::ERROR_OK ||
+        this->set_filter_mask_(MASK1, filter.use_extended_id, filter.mask) != canbus::ERROR_OK)
+      return false;
+    for (RXF rxf : {RXF0, RXF1, RXF2, RXF3, RXF4, RXF5}) {
+      if (this->set_filter_(rxf, filter.use_extended_id, filter.code) != canbus::ERROR_OK)
+        return false;
+    }
+    ESP_LOGD(TAG, "acceptance filter code=0x%08" PRIx32 " mask=0x%08" PRIx32, filter.code, filter.mask);
+  }
   if (this->set_mode_(this->mcp_mode_) != canbus::ERROR_OK)
     return false;
   uint8_t err_flags = this->get_error_flags_();
@@ -65,14 +77,11 @@ uint8_t MCP2515::read_register_(const REGISTER reg) {
 }
 
 void MCP2515::read_registers_(const REGISTER reg, uint8_t values[], const uint8_t n) {
-  this->enable();
-  this->transfer_byte(INSTRUCTION_READ);
-  this->transfer_byte(reg);
-  // this->transfer_array(values, n);
+  this->batch_.clear();
   // mcp2515 has auto - increment of address - pointer
-  for (uint8_t i = 0; i < n; i++) {
-    values[i] = this->transfer_byte(0x00);
-  }
+  this->batch_.write_byte(INSTRUCTION_READ).write_byte(reg).read(values, n);
+  this->enable();
+  this->submit(this->batch_);
   this->disable();
 }
 
@@ -85,13 +94,10 @@ void MCP2515::set_register_(const REGISTER reg, const uint8_t value) {
 }
 
 void MCP2515::set_registers_(const REGISTER reg, uint8_t values[], const uint8_t n) {
+  this->batch_.clear();
+  this->batch_.write_byte(INSTRUCTION_WRITE).write_byte(reg).write(values, n);
   this->enable();
-  this->transfer_byte(INSTRUCTION_WRITE);
-  this->transfer_byte(reg);
-  // this->transfer_array(values, n);
-  for (uint8_t i = 0; i < n; i++) {
-    this->transfer_byte(values[i]);
-  }
+  this->submit(this->batch_);
   this->disable();
 }
 
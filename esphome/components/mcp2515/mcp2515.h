@@ -74,6 +74,7 @@ class MCP2515 : public canbus::Canbus,
 
  protected:
   CanClock mcp_clock_{MCP_8MHZ};
+  spi::SPIBatch batch_;
   CanctrlReqopMode mcp_mode_ = CANCTRL_REQOP_NORMAL;
   bool setup_internal() override;
   canbus::Error set_mode_(CanctrlReqopMode mode);
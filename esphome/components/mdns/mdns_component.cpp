@@ -74,7 +74,7 @@ void MDNSComponent::compile_records_() {
     service.txt_records.push_back({"package_import_url", dashboard_import::get_package_import_url()});
 #endif
 
-    this->services_.push_back(service);
+    this->services_.push_back(std::move(service));
   }
 #endif  // USE_API
 
@@ -112,6 +112,15 @@ void MDNSComponent::compile_records_() {
   }
 }
 
+void MDNSComponent::release_records_() {
+#if ESPHOME_LOG_LEVEL < ESPHOME_LOG_LEVEL_VERBOSE
+  this->services_.clear();
+  this->services_.shrink_to_fit();
+  this->services_extra_.clear();
+  this->services_extra_.shrink_to_fit();
+#endif
+}
+
 void MDNSComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "mDNS:");
   ESP_LOGCONFIG(TAG, "  Hostname: %s", this->hostname_.c_str());
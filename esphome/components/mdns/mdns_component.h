@@ -43,6 +43,9 @@ class MDNSComponent : public Component {
   std::vector<MDNSService> services_{};
   std::string hostname_;
   void compile_records_();
+  /// Free the compiled records once they were handed to the backend, which keeps its own copy. They are only kept to
+  /// log them with verbose logging.
+  void release_records_();
 };
 
 }  // namespace mdns
@@ -27,26 +27,23 @@ void MDNSComponent::setup() {
 
   for (const auto &service : this->services_) {
     std::vector<mdns_txt_item_t> txt_records;
+    txt_records.reserve(service.txt_records.size());
     for (const auto &record : service.txt_records) {
+      // mdns_service_add() copies the items, the records only have to outlive the call
       mdns_txt_item_t it{};
-      // dup strings to ensure the pointer is valid even after the record loop
-      it.key = strdup(record.key.c_str());
-      it.value = strdup(record.value.c_str());
+      it.key = record.key.c_str();
+      it.value = record.value.c_str();
       txt_records.push_back(it);
     }
     err = mdns_service_add(nullptr, service.service_type.c_str(), service.proto.c_str(), service.port,
                            txt_records.data(), txt_records.size());
 
-    // free records
-    for (const auto &it : txt_records) {
-      delete it.key;    // NOLINT(cppcoreguidelines-owning-memory)
-      delete it.value;  // NOLINT(cppcoreguidelines-owning-memory)
-    }
-
     if (err != ESP_OK) {
       ESP_LOGW(TAG, "Failed to register mDNS service %s: %s", service.service_type.c_str(), esp_err_to_name(err));
     }
   }
+
+  this->release_records_();
 }
 
 void MDNSComponent::on_shutdown() {
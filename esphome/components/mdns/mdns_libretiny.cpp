@@ -34,6 +34,8 @@ void MDNSComponent::setup() {
       MDNS.addServiceTxt(service_type, proto, record.key.c_str(), record.value.c_str());
     }
   }
+
+  this->release_records_();
 }
 
 void MDNSComponent::on_shutdown() {}
@@ -35,8 +35,10 @@ DOMAIN = "micro_wake_word"
 
 
 CONF_FEATURE_STEP_SIZE = "feature_step_size"
+CONF_INFERENCE_TASK = "inference_task"
 CONF_MODELS = "models"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
+CONF_PARTITION = "partition"
 CONF_PROBABILITY_CUTOFF = "probability_cutoff"
 CONF_SLIDING_WINDOW_AVERAGE_SIZE = "sliding_window_average_size"
 CONF_SLIDING_WINDOW_SIZE = "sliding_window_size"
@@ -299,6 +301,8 @@ MODEL_SCHEMA = cv.Schema(
         cv.Optional(CONF_MODEL): MODEL_SOURCE_SCHEMA,
         cv.Optional(CONF_PROBABILITY_CUTOFF): cv.percentage,
         cv.Optional(CONF_SLIDING_WINDOW_SIZE): cv.positive_int,
+        # Read the model from this data partition instead of embedding it
+        cv.Optional(CONF_PARTITION): cv.All(cv.string, cv.Length(min=1, max=16)),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
 )
@@ -336,6 +340,7 @@ CONFIG_SCHEMA = cv.All(
                 single=True
             ),
             cv.Optional(CONF_VAD): _maybe_empty_vad_schema,
+            cv.Optional(CONF_INFERENCE_TASK, default=False): cv.boolean,
             cv.Optional(CONF_MODEL): cv.invalid(
                 f"The {CONF_MODEL} parameter has moved to be a list element under the {CONF_MODELS} parameter."
             ),
@@ -413,6 +418,7 @@ async def to_code(config):
 
     mic = await cg.get_variable(config[CONF_MICROPHONE])
     cg.add(var.set_microphone(mic))
+    cg.add(var.set_inference_task(config[CONF_INFERENCE_TASK]))
 
     esp32.add_idf_component(
         name="esp-tflite-micro",
@@ -449,8 +455,13 @@ async def to_code(config):
         data = []
         manifest, data = _model_config_to_manifest_data(model_config)
 
-        rhs = [HexInt(x) for x in data]
-        prog_arr = cg.progmem_array(model_parameters[CONF_RAW_DATA_ID], rhs)
+        # The manifest still provides the settings of a model in a partition
+        if partition := model_parameters.get(CONF_PARTITION):
+            prog_arr = cg.nullptr
+        else:
+            partition = cg.nullptr
+            rhs = [HexInt(x) for x in data]
+            prog_arr = cg.progmem_array(model_parameters[CONF_RAW_DATA_ID], rhs)
 
         probability_cutoff = model_parameters.get(
             CONF_PROBABILITY_CUTOFF, manifest[KEY_MICRO][CONF_PROBABILITY_CUTOFF]
@@ -467,6 +478,7 @@ async def to_code(config):
                     probability_cutoff,
                     sliding_window_size,
                     manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE],
+                    partition,
                 )
             )
         else:
@@ -477,6 +489,7 @@ async def to_code(config):
                     sliding_window_size,
                     manifest[KEY_WAKE_WORD],
                     manifest[KEY_MICRO][CONF_TENSOR_ARENA_SIZE],
+                    partition,
                 )
             )
 
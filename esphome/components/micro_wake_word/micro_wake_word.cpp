@@ -14,6 +14,7 @@
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace esphome {
@@ -21,6 +22,39 @@ namespace micro_wake_word {
 
 static const char *const TAG = "micro_wake_word";
 
+// These scaling values are set to match the TFLite audio frontend int8 output.
+// The feature pipeline outputs 16-bit signed integers in roughly a 0 to 670
+// range. In training, these are then arbitrarily divided by 25.6 to get
+// float values in the rough range of 0.0 to 26.0. This scaling is performed
+// for historical reasons, to match up with the output of other feature
+// generators.
+// The process is then further complicated when we quantize the model. This
+// means we have to scale the 0.0 to 26.0 real values to the -128 to 127
+// signed integer numbers.
+// All this means that to get matching values from our integer feature
+// output into the tensor input, we have to perform:
+// input = (((feature / 25.6) / 26.0) * 256) - 128
+// To simplify this and perform it in 32-bit integer math, we rearrange to:
+// input = (feature * 256) / (25.6 * 26.0) - 128
+// The result is tabulated at compile time so every feature costs a lookup instead of a division; all frontend
+// outputs from the last entry on saturate to 127.
+static const uint16_t FEATURE_QUANTIZATION_TABLE_SIZE = 664;
+
+struct FeatureQuantizationTable {
+  int8_t values[FEATURE_QUANTIZATION_TABLE_SIZE];
+
+  constexpr FeatureQuantizationTable() : values() {
+    constexpr int32_t value_scale = 256;
+    constexpr int32_t value_div = 666;  // 666 = 25.6 * 26.0 after rounding
+    for (int32_t feature = 0; feature < FEATURE_QUANTIZATION_TABLE_SIZE; ++feature) {
+      int32_t value = ((feature * value_scale) + (value_div / 2)) / value_div - 128;
+      this->values[feature] = value > 127 ? 127 : value;
+    }
+  }
+};
+
+static constexpr FeatureQuantizationTable FEATURE_QUANTIZATION_TABLE{};
+
 static const size_t SAMPLE_RATE_HZ = 16000;  // 16 kHz
 static const size_t BUFFER_LENGTH = 64;      // 0.064 seconds
 static const size_t BUFFER_SIZE = SAMPLE_RATE_HZ / 1000 * BUFFER_LENGTH;
@@ -87,15 +121,19 @@ void MicroWakeWord::setup() {
 
 void MicroWakeWord::add_wake_word_model(const uint8_t *model_start, float probability_cutoff,
                                         size_t sliding_window_average_size, const std::string &wake_word,
-                                        size_t tensor_arena_size) {
+                                        size_t tensor_arena_size, const char *partition) {
   this->wake_word_models_.emplace_back(model_start, probability_cutoff, sliding_window_average_size, wake_word,
                                        tensor_arena_size);
+  if (partition != nullptr)
+    this->wake_word_models_.back().set_partition(partition);
 }
 
 #ifdef USE_MICRO_WAKE_WORD_VAD
 void MicroWakeWord::add_vad_model(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_size,
-                                  size_t tensor_arena_size) {
+                                  size_t tensor_arena_size, const char *partition) {
   this->vad_model_ = make_unique<VADModel>(model_start, probability_cutoff, sliding_window_size, tensor_arena_size);
+  if (partition != nullptr)
+    this->vad_model_->set_partition(partition);
 }
 #endif
 
@@ -106,15 +144,32 @@ void MicroWakeWord::loop() {
     case State::START_MICROPHONE:
       ESP_LOGD(TAG, "Starting Microphone");
       this->microphone_->start();
+      this->microphone_reader_->reset();
       this->set_state_(State::STARTING_MICROPHONE);
       this->high_freq_.start();
       break;
     case State::STARTING_MICROPHONE:
       if (this->microphone_->is_running()) {
         this->set_state_(State::DETECTING_WAKE_WORD);
+        if (this->inference_task_) {
+          // set here and only cleared by the task, so stopping never misses a task that did not wake up yet
+          this->inference_detected_ = false;
+          this->inference_running_ = true;
+          this->inference_requested_ = true;
+          xTaskNotifyGive(this->inference_task_handle_);
+        }
       }
       break;
     case State::DETECTING_WAKE_WORD:
+      if (this->inference_task_) {
+        this->read_microphone_();
+        if (this->inference_detected_) {
+          ESP_LOGD(TAG, "Wake Word '%s' Detected", (this->detected_wake_word_).c_str());
+          this->detected_ = true;
+          this->set_state_(State::STOP_MICROPHONE);
+        }
+        break;
+      }
       while (!this->has_enough_samples_()) {
         this->read_microphone_();
       }
@@ -126,12 +181,17 @@ void MicroWakeWord::loop() {
       }
       break;
     case State::STOP_MICROPHONE:
+      if (this->inference_running_) {
+        // the models are unloaded below, wait for the current inference to finish
+        this->inference_requested_ = false;
+        break;
+      }
+      this->log_inference_times_();
       ESP_LOGD(TAG, "Stopping Microphone");
       this->microphone_->stop();
       this->set_state_(State::STOPPING_MICROPHONE);
       this->high_freq_.stop();
       this->unload_models_();
-      this->deallocate_buffers_();
       break;
     case State::STOPPING_MICROPHONE:
       if (this->microphone_->is_stopped()) {
@@ -157,6 +217,15 @@ void MicroWakeWord::start() {
     return;
   }
 
+  if (this->inference_task_ && this->inference_task_handle_ == nullptr) {
+    xTaskCreatePinnedToCore(MicroWakeWord::inference_task, "mww_inference", 8192, this, 2,
+                            &this->inference_task_handle_, portNUM_PROCESSORS - 1);
+    if (this->inference_task_handle_ == nullptr) {
+      ESP_LOGW(TAG, "Could not create the inference task, running inference in the main loop");
+      this->inference_task_ = false;
+    }
+  }
+
   if (!this->load_models_() || !this->allocate_buffers_()) {
     ESP_LOGE(TAG, "Failed to load the wake word model(s) or allocate buffers");
     this->status_set_error();
@@ -190,6 +259,34 @@ void MicroWakeWord::stop() {
   this->set_state_(State::STOP_MICROPHONE);
 }
 
+void MicroWakeWord::inference_task(void *params) {
+  auto *this_mww = static_cast<MicroWakeWord *>(params);
+  while (true) {
+    if (!this_mww->inference_requested_) {
+      this_mww->inference_running_ = false;
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (this_mww->inference_detected_ || !this_mww->has_enough_samples_()) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+    this_mww->update_model_probabilities_();
+    if (this_mww->detect_wake_words_())
+      this_mww->inference_detected_ = true;
+  }
+}
+
+void MicroWakeWord::log_inference_times_() {
+  for (auto &model : this->wake_word_models_) {
+    ESP_LOGD(TAG, "Longest inference of '%s': %" PRIu32 " us", model.get_wake_word().c_str(),
+             model.get_max_inference_us());
+  }
+#ifdef USE_MICRO_WAKE_WORD_VAD
+  ESP_LOGD(TAG, "Longest inference of the VAD model: %" PRIu32 " us", this->vad_model_->get_max_inference_us());
+#endif
+}
+
 void MicroWakeWord::set_state_(State state) {
   ESP_LOGD(TAG, "State changed from %s to %s", LOG_STR_ARG(micro_wake_word_state_to_string(this->state_)),
            LOG_STR_ARG(micro_wake_word_state_to_string(state)));
@@ -197,46 +294,31 @@ void MicroWakeWord::set_state_(State state) {
 }
 
 size_t MicroWakeWord::read_microphone_() {
-  size_t bytes_read = this->microphone_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  if (bytes_read == 0) {
-    return 0;
+  // The microphone writes straight into the ring buffer, in two parts if the free space wraps around its end
+  size_t total = 0;
+  uint8_t *region;
+  size_t len;
+  while (total < INPUT_BUFFER_SIZE * sizeof(int16_t) &&
+         (len = this->ring_buffer_->acquire_write(&region, INPUT_BUFFER_SIZE * sizeof(int16_t) - total)) > 0) {
+    size_t bytes_read = this->microphone_reader_->read(reinterpret_cast<int16_t *>(region), len);
+    this->ring_buffer_->commit_write(bytes_read);
+    total += bytes_read;
+    if (bytes_read < len)
+      return total;
   }
 
-  size_t bytes_free = this->ring_buffer_->free();
-
-  if (bytes_free < bytes_read) {
-    ESP_LOGW(TAG,
-             "Not enough free bytes in ring buffer to store incoming audio data (free bytes=%d, incoming bytes=%d). "
-             "Resetting the ring buffer. Wake word detection accuracy will be reduced.",
-             bytes_free, bytes_read);
-
-    this->ring_buffer_->reset();
+  if (total == 0 && this->ring_buffer_->free() == 0) {
+    ESP_LOGW(TAG, "Ring buffer is full, the microphone drops incoming audio. Wake word detection accuracy will be "
+                  "reduced.");
   }
-
-  return this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
+  return total;
 }
 
 bool MicroWakeWord::allocate_buffers_() {
-  ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-
-  if (this->input_buffer_ == nullptr) {
-    this->input_buffer_ = audio_samples_allocator.allocate(INPUT_BUFFER_SIZE * sizeof(int16_t));
-    if (this->input_buffer_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate input buffer");
-      return false;
-    }
-  }
-
-  if (this->preprocessor_audio_buffer_ == nullptr) {
-    this->preprocessor_audio_buffer_ = audio_samples_allocator.allocate(this->new_samples_to_get_());
-    if (this->preprocessor_audio_buffer_ == nullptr) {
-      ESP_LOGE(TAG, "Could not allocate the audio preprocessor's buffer.");
-      return false;
-    }
-  }
-
   if (this->ring_buffer_ == nullptr) {
-    this->ring_buffer_ = RingBuffer::create(BUFFER_SIZE * sizeof(int16_t));
+    // The frontend processes each window in place, so a whole window must be readable in one piece
+    this->ring_buffer_ =
+        RingBuffer::create_zero_copy(BUFFER_SIZE * sizeof(int16_t), this->new_samples_to_get_() * sizeof(int16_t));
     if (this->ring_buffer_ == nullptr) {
       ESP_LOGE(TAG, "Could not allocate ring buffer");
       return false;
@@ -246,14 +328,6 @@ bool MicroWakeWord::allocate_buffers_() {
   return true;
 }
 
-void MicroWakeWord::deallocate_buffers_() {
-  ExternalRAMAllocator<int16_t> audio_samples_allocator(ExternalRAMAllocator<int16_t>::ALLOW_FAILURE);
-  audio_samples_allocator.deallocate(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
-  this->input_buffer_ = nullptr;
-  audio_samples_allocator.deallocate(this->preprocessor_audio_buffer_, this->new_samples_to_get_());
-  this->preprocessor_audio_buffer_ = nullptr;
-}
-
 bool MicroWakeWord::load_models_() {
   // Setup preprocesor feature generator
   if (!FrontendPopulateState(&this->frontend_config_, &this->frontend_state_, AUDIO_SAMPLE_FREQUENCY)) {
@@ -348,48 +422,22 @@ bool MicroWakeWord::generate_features_for_window_(int8_t features[PREPROCESSOR_F
     return false;
   }
 
-  size_t bytes_read = this->ring_buffer_->read((void *) (this->preprocessor_audio_buffer_),
-                                               this->new_samples_to_get_() * sizeof(int16_t), pdMS_TO_TICKS(200));
-
-  if (bytes_read == 0) {
+  const size_t window_bytes = this->new_samples_to_get_() * sizeof(int16_t);
+  uint8_t *window;
+  if (this->ring_buffer_->acquire_read(&window, window_bytes) < window_bytes) {
     ESP_LOGE(TAG, "Could not read data from Ring Buffer");
-  } else if (bytes_read < this->new_samples_to_get_() * sizeof(int16_t)) {
-    ESP_LOGD(TAG, "Partial Read of Data by Model");
-    ESP_LOGD(TAG, "Could only read %d bytes when required %d bytes ", bytes_read,
-             (int) (this->new_samples_to_get_() * sizeof(int16_t)));
     return false;
   }
 
   size_t num_samples_read;
-  struct FrontendOutput frontend_output = FrontendProcessSamples(
-      &this->frontend_state_, this->preprocessor_audio_buffer_, this->new_samples_to_get_(), &num_samples_read);
+  struct FrontendOutput frontend_output =
+      FrontendProcessSamples(&this->frontend_state_, reinterpret_cast<const int16_t *>(window),
+                             this->new_samples_to_get_(), &num_samples_read);
+  this->ring_buffer_->release_read(window_bytes);
 
   for (size_t i = 0; i < frontend_output.size; ++i) {
-    // These scaling values are set to match the TFLite audio frontend int8 output.
-    // The feature pipeline outputs 16-bit signed integers in roughly a 0 to 670
-    // range. In training, these are then arbitrarily divided by 25.6 to get
-    // float values in the rough range of 0.0 to 26.0. This scaling is performed
-    // for historical reasons, to match up with the output of other feature
-    // generators.
-    // The process is then further complicated when we quantize the model. This
-    // means we have to scale the 0.0 to 26.0 real values to the -128 to 127
-    // signed integer numbers.
-    // All this means that to get matching values from our integer feature
-    // output into the tensor input, we have to perform:
-    // input = (((feature / 25.6) / 26.0) * 256) - 128
-    // To simplify this and perform it in 32-bit integer math, we rearrange to:
-    // input = (feature * 256) / (25.6 * 26.0) - 128
-    constexpr int32_t value_scale = 256;
-    constexpr int32_t value_div = 666;  // 666 = 25.6 * 26.0 after rounding
-    int32_t value = ((frontend_output.values[i] * value_scale) + (value_div / 2)) / value_div;
-    value -= 128;
-    if (value < -128) {
-      value = -128;
-    }
-    if (value > 127) {
-      value = 127;
-    }
-    features[i] = value;
+    features[i] = FEATURE_QUANTIZATION_TABLE.values[std::min<uint16_t>(frontend_output.values[i],
+                                                                        FEATURE_QUANTIZATION_TABLE_SIZE - 1)];
   }
 
   return true;
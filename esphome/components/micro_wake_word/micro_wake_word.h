@@ -13,6 +13,11 @@
 
 #include <frontend_util.h>
 
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+
 #include <tensorflow/lite/core/c/common.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
@@ -45,21 +50,28 @@ class MicroWakeWord : public Component {
   bool is_running() const { return this->state_ != State::IDLE; }
 
   void set_features_step_size(uint8_t step_size) { this->features_step_size_ = step_size; }
+  /// @brief Run the feature generation and inference in a task on the last core instead of the main loop
+  void set_inference_task(bool inference_task) { this->inference_task_ = inference_task; }
 
-  void set_microphone(microphone::Microphone *microphone) { this->microphone_ = microphone; }
+  void set_microphone(microphone::Microphone *microphone) {
+    this->microphone_ = microphone;
+    this->microphone_reader_ = make_unique<microphone::MicrophoneReader>(microphone);
+  }
 
   Trigger<std::string> *get_wake_word_detected_trigger() const { return this->wake_word_detected_trigger_; }
 
+  /// `model_start` is nullptr for a model read from the data partition `partition`.
   void add_wake_word_model(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_average_size,
-                           const std::string &wake_word, size_t tensor_arena_size);
+                           const std::string &wake_word, size_t tensor_arena_size, const char *partition = nullptr);
 
 #ifdef USE_MICRO_WAKE_WORD_VAD
   void add_vad_model(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_size,
-                     size_t tensor_arena_size);
+                     size_t tensor_arena_size, const char *partition = nullptr);
 #endif
 
  protected:
   microphone::Microphone *microphone_{nullptr};
+  std::unique_ptr<microphone::MicrophoneReader> microphone_reader_;
   Trigger<std::string> *wake_word_detected_trigger_ = new Trigger<std::string>();
   State state_{State::IDLE};
   HighFrequencyLoopRequester high_freq_;
@@ -84,14 +96,21 @@ class MicroWakeWord : public Component {
 
   uint8_t features_step_size_;
 
-  // Stores audio read from the microphone before being added to the ring buffer.
-  int16_t *input_buffer_{nullptr};
-  // Stores audio to be fed into the audio frontend for generating features.
-  int16_t *preprocessor_audio_buffer_{nullptr};
-
   bool detected_{false};
   std::string detected_wake_word_{""};
 
+  bool inference_task_{false};
+  TaskHandle_t inference_task_handle_{nullptr};
+  /// Set by the main loop to start and stop the inference task
+  std::atomic<bool> inference_requested_{false};
+  /// Cleared by the inference task once it no longer touches the models and the ring buffer
+  std::atomic<bool> inference_running_{false};
+  /// Set by the inference task after it stored detected_wake_word_
+  std::atomic<bool> inference_detected_{false};
+
+  static void inference_task(void *params);
+  void log_inference_times_();
+
   void set_state_(State state);
 
   /// @brief Tests if there are enough samples in the ring buffer to generate new features.
@@ -100,20 +119,16 @@ class MicroWakeWord : public Component {
 
   /** Reads audio from microphone into the ring buffer
    *
-   * Audio data (16000 kHz with int16 samples) is read into the input_buffer_.
-   * Verifies the ring buffer has enough space for all audio data. If not, it logs
-   * a warning and resets the ring buffer entirely.
+   * Audio data (16000 kHz with int16 samples) is read straight into the free space of the ring buffer.
+   * If the ring buffer is full, it logs a warning and the microphone drops the audio.
    * @return Number of bytes written to the ring buffer
    */
   size_t read_microphone_();
 
-  /// @brief Allocates memory for input_buffer_, preprocessor_audio_buffer_, and ring_buffer_
+  /// @brief Allocates memory for the ring_buffer_
   /// @return True if successful, false otherwise
   bool allocate_buffers_();
 
-  /// @brief Frees memory allocated for input_buffer_ and preprocessor_audio_buffer_
-  void deallocate_buffers_();
-
   /// @brief Loads streaming models and prepares the feature generation frontend
   /// @return True if successful, false otherwise
   bool load_models_();
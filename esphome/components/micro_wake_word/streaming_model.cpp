@@ -6,6 +6,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#include <tensorflow/lite/schema/schema_generated.h>
+
 static const char *const TAG = "micro_wake_word";
 
 namespace esphome {
@@ -15,12 +17,44 @@ void WakeWordModel::log_model_config() {
   ESP_LOGCONFIG(TAG, "    - Wake Word: %s", this->wake_word_.c_str());
   ESP_LOGCONFIG(TAG, "      Probability cutoff: %.3f", this->probability_cutoff_);
   ESP_LOGCONFIG(TAG, "      Sliding window size: %d", this->sliding_window_size_);
+  this->log_partition_config_();
 }
 
 void VADModel::log_model_config() {
   ESP_LOGCONFIG(TAG, "    - VAD Model");
   ESP_LOGCONFIG(TAG, "      Probability cutoff: %.3f", this->probability_cutoff_);
   ESP_LOGCONFIG(TAG, "      Sliding window size: %d", this->sliding_window_size_);
+  this->log_partition_config_();
+}
+
+void StreamingModel::log_partition_config_() {
+  if (this->partition_label_ != nullptr)
+    ESP_LOGCONFIG(TAG, "      Partition: %s", this->partition_label_);
+}
+
+bool StreamingModel::map_partition_() {
+  const esp_partition_t *partition =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, this->partition_label_);
+  if (partition == nullptr) {
+    ESP_LOGE(TAG, "No data partition '%s' for the streaming model", this->partition_label_);
+    return false;
+  }
+  const void *data;
+  esp_err_t err =
+      esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &data, &this->partition_mmap_);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Could not map the partition '%s': %s", this->partition_label_, esp_err_to_name(err));
+    return false;
+  }
+  // The partition is written separately from the firmware, so it is checked completely once
+  flatbuffers::Verifier verifier(static_cast<const uint8_t *>(data), partition->size);
+  if (!tflite::ModelBufferHasIdentifier(data) || !tflite::VerifyModelBuffer(verifier)) {
+    ESP_LOGE(TAG, "The partition '%s' does not hold a valid streaming model", this->partition_label_);
+    esp_partition_munmap(this->partition_mmap_);
+    return false;
+  }
+  this->model_start_ = static_cast<const uint8_t *>(data);
+  return true;
 }
 
 bool StreamingModel::load_model(tflite::MicroMutableOpResolver<20> &op_resolver) {
@@ -44,6 +78,9 @@ bool StreamingModel::load_model(tflite::MicroMutableOpResolver<20> &op_resolver)
     this->mrv_ = tflite::MicroResourceVariables::Create(this->ma_, 20);
   }
 
+  if (this->partition_label_ != nullptr && this->model_start_ == nullptr && !this->map_partition_())
+    return false;
+
   const tflite::Model *model = tflite::GetModel(this->model_start_);
   if (model->version() != TFLITE_SCHEMA_VERSION) {
     ESP_LOGE(TAG, "Streaming model's schema is not supported");
@@ -54,9 +91,12 @@ bool StreamingModel::load_model(tflite::MicroMutableOpResolver<20> &op_resolver)
     this->interpreter_ = make_unique<tflite::MicroInterpreter>(
         tflite::GetModel(this->model_start_), op_resolver, this->tensor_arena_, this->tensor_arena_size_, this->mrv_);
     if (this->interpreter_->AllocateTensors() != kTfLiteOk) {
-      ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model");
+      ESP_LOGE(TAG, "Failed to allocate tensors for the streaming model, the tensor arena of %u bytes may be too small",
+               (unsigned) this->tensor_arena_size_);
       return false;
     }
+    ESP_LOGD(TAG, "Streaming model uses %u of %u bytes of its tensor arena",
+             (unsigned) this->interpreter_->arena_used_bytes(), (unsigned) this->tensor_arena_size_);
 
     // Verify input tensor matches expected values
     // Dimension 3 will represent the first layer stride, so skip it may vary
@@ -96,6 +136,12 @@ void StreamingModel::unload_model() {
   this->tensor_arena_ = nullptr;
   arena_allocator.deallocate(this->var_arena_, STREAMING_MODEL_VARIABLE_ARENA_SIZE);
   this->var_arena_ = nullptr;
+
+  if (this->partition_label_ != nullptr && this->model_start_ != nullptr) {
+    // Mapped again by the next load, which picks up a rewritten partition
+    esp_partition_munmap(this->partition_mmap_);
+    this->model_start_ = nullptr;
+  }
 }
 
 bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCESSOR_FEATURE_SIZE]) {
@@ -112,7 +158,9 @@ bool StreamingModel::perform_streaming_inference(const int8_t features[PREPROCES
     if (this->current_stride_step_ >= stride) {
       this->current_stride_step_ = 0;
 
+      uint32_t started = micros();
       TfLiteStatus invoke_status = this->interpreter_->Invoke();
+      this->max_inference_us_ = std::max(this->max_inference_us_, micros() - started);
       if (invoke_status != kTfLiteOk) {
         ESP_LOGW(TAG, "Streaming interpreter invoke failed");
         return false;
@@ -135,6 +183,7 @@ void StreamingModel::reset_probabilities() {
   for (auto &prob : this->recent_streaming_probabilities_) {
     prob = 0;
   }
+  this->max_inference_us_ = 0;
 }
 
 WakeWordModel::WakeWordModel(const uint8_t *model_start, float probability_cutoff, size_t sliding_window_average_size,
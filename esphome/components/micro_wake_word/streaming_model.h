@@ -4,6 +4,8 @@
 
 #include "preprocessor_settings.h"
 
+#include <esp_partition.h>
+
 #include <tensorflow/lite/core/c/common.h>
 #include <tensorflow/lite/micro/micro_interpreter.h>
 #include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
@@ -31,8 +33,20 @@ class StreamingModel {
   /// @brief Destroys the TFLite interpreter and frees the tensor and variable arenas' memory
   void unload_model();
 
+  /// @brief Reads the model from the data partition `label` instead of the firmware. The partition is mapped into
+  /// the address space while the model is loaded, so it can be rewritten without a firmware update.
+  void set_partition(const char *label) { this->partition_label_ = label; }
+
+  /// @brief Longest interpreter invocation since the last reset_probabilities(), in microseconds
+  uint32_t get_max_inference_us() const { return this->max_inference_us_; }
+
  protected:
+  /// @brief Maps the model partition and verifies that it holds a TFLite model
+  bool map_partition_();
+  void log_partition_config_();
+
   uint8_t current_stride_step_{0};
+  uint32_t max_inference_us_{0};
 
   float probability_cutoff_;
   size_t sliding_window_size_;
@@ -41,6 +55,8 @@ class StreamingModel {
   std::vector<uint8_t> recent_streaming_probabilities_;
 
   const uint8_t *model_start_;
+  const char *partition_label_{nullptr};
+  esp_partition_mmap_handle_t partition_mmap_{0};
   uint8_t *tensor_arena_{nullptr};
   uint8_t *var_arena_{nullptr};
   std::unique_ptr<tflite::MicroInterpreter> interpreter_;
@@ -0,0 +1,48 @@
+#include "microphone.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace microphone {
+
+size_t Microphone::read_shared_(MicrophoneReader *reader, uint8_t *buf, size_t len) {
+  LockGuard guard(this->shared_lock_);
+  if (this->shared_buffer_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->shared_buffer_ = allocator.allocate(SHARED_BUFFER_SIZE);
+    if (this->shared_buffer_ == nullptr)
+      return this->read(reinterpret_cast<int16_t *>(buf), len);
+  }
+
+  if (reader->position_ == this->shared_written_) {
+    // read into the shared buffer directly, without splitting a read at its end
+    size_t pos = this->shared_written_ % SHARED_BUFFER_SIZE;
+    size_t to_read = std::min(SHARED_READ_SIZE, SHARED_BUFFER_SIZE - pos);
+    this->shared_written_ += this->read(reinterpret_cast<int16_t *>(this->shared_buffer_ + pos), to_read);
+  }
+
+  // a read may temporarily use SHARED_READ_SIZE bytes after the newest audio
+  uint32_t kept = std::min<uint32_t>(this->shared_written_, SHARED_BUFFER_SIZE - SHARED_READ_SIZE);
+  uint32_t oldest = this->shared_written_ - kept;
+  if (this->shared_written_ - reader->position_ > kept) {
+    reader->dropped_ += oldest - reader->position_;
+    reader->position_ = oldest;
+  }
+
+  size_t count = std::min<size_t>(len, this->shared_written_ - reader->position_);
+  size_t pos = reader->position_ % SHARED_BUFFER_SIZE;
+  size_t first = std::min(count, SHARED_BUFFER_SIZE - pos);
+  memcpy(buf, this->shared_buffer_ + pos, first);
+  memcpy(buf + first, this->shared_buffer_, count - first);
+  reader->position_ += count;
+  return count;
+}
+
+void MicrophoneReader::reset() {
+  LockGuard guard(this->mic_->shared_lock_);
+  this->position_ = this->mic_->shared_written_;
+}
+
+}  // namespace microphone
+}  // namespace esphome
@@ -9,6 +9,8 @@
 namespace esphome {
 namespace microphone {
 
+class MicrophoneReader;
+
 enum State : uint8_t {
   STATE_STOPPED = 0,
   STATE_STARTING,
@@ -29,10 +31,52 @@ class Microphone {
   bool is_stopped() const { return this->state_ == STATE_STOPPED; }
 
  protected:
+  friend MicrophoneReader;
+
+  /// Shared buffer size, the most audio a reader can fall behind the others (256ms at 16kHz)
+  static constexpr size_t SHARED_BUFFER_SIZE = 8192;
+  /// Bytes requested from read() at once, 32 bit samples are converted in place
+  static constexpr size_t SHARED_READ_SIZE = 1024;
+
+  size_t read_shared_(MicrophoneReader *reader, uint8_t *buf, size_t len);
+
   State state_{STATE_STOPPED};
 
+  uint8_t *shared_buffer_{nullptr};
+  /// Total bytes stored in shared_buffer_, positions of the readers count the same way
+  uint32_t shared_written_{0};
+  Mutex shared_lock_;
+
   CallbackManager<void(const std::vector<int16_t> &)> data_callbacks_{};
 };
 
+/** A consumer of the audio of a microphone with its own read position.
+ *
+ * All readers of a microphone share one buffer. A reader that caught up reads the microphone (one I2S read and sample
+ * conversion for everyone), the others copy what was already read, so wake word detection and streaming can run at
+ * the same time. Readers may be used from different tasks.
+ */
+class MicrophoneReader {
+ public:
+  explicit MicrophoneReader(Microphone *mic) : mic_(mic), position_(mic->shared_written_) {}
+
+  /// Like Microphone::read(), len is in bytes.
+  size_t read(int16_t *buf, size_t len) {
+    return this->mic_->read_shared_(this, reinterpret_cast<uint8_t *>(buf), len);
+  }
+  /// Skip audio read by other readers so far.
+  void reset();
+
+  /// Bytes that were overwritten before this reader got to them.
+  uint32_t get_dropped_bytes() const { return this->dropped_; }
+
+ protected:
+  friend Microphone;
+
+  Microphone *mic_;
+  uint32_t position_{0};
+  uint32_t dropped_{0};
+};
+
 }  // namespace microphone
 }  // namespace esphome
@@ -0,0 +1,3 @@
+import esphome.codegen as cg
+
+mixer_speaker_ns = cg.esphome_ns.namespace("mixer_speaker")
@@ -0,0 +1,140 @@
+from esphome import automation
+import esphome.codegen as cg
+from esphome.components import speaker
+import esphome.config_validation as cv
+from esphome.const import CONF_DURATION, CONF_ID, CONF_SAMPLE_RATE, CONF_VOLUME
+import esphome.final_validate as fv
+
+from .. import mixer_speaker_ns
+
+DEPENDENCIES = ["esp32"]
+
+CONF_BUFFER_DURATION = "buffer_duration"
+CONF_DECIBEL_REDUCTION = "decibel_reduction"
+CONF_OUTPUT_SPEAKER = "output_speaker"
+CONF_SOURCE_SPEAKERS = "source_speakers"
+
+MixerSpeaker = mixer_speaker_ns.class_("MixerSpeaker", cg.Component)
+SourceSpeaker = mixer_speaker_ns.class_(
+    "SourceSpeaker", cg.Component, speaker.Speaker, cg.Parented.template(MixerSpeaker)
+)
+
+DuckingApplyAction = mixer_speaker_ns.class_(
+    "DuckingApplyAction", automation.Action, cg.Parented.template(SourceSpeaker)
+)
+SetVolumeAction = mixer_speaker_ns.class_(
+    "SetVolumeAction", automation.Action, cg.Parented.template(SourceSpeaker)
+)
+
+
+SOURCE_SPEAKER_SCHEMA = speaker.SPEAKER_SCHEMA.extend(
+    {
+        cv.GenerateID(): cv.declare_id(SourceSpeaker),
+        cv.Optional(CONF_SAMPLE_RATE, default=16000): cv.int_range(min=1),
+        cv.Optional(
+            CONF_BUFFER_DURATION, default="500ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_VOLUME, default=1.0): cv.percentage,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(MixerSpeaker),
+        cv.Required(CONF_OUTPUT_SPEAKER): cv.use_id(speaker.Speaker),
+        cv.Optional(CONF_SAMPLE_RATE): cv.int_range(min=1),
+        cv.Required(CONF_SOURCE_SPEAKERS): cv.All(
+            cv.ensure_list(SOURCE_SPEAKER_SCHEMA), cv.Length(min=1)
+        ),
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+def _final_validate(config):
+    # The mixer has to produce audio at the rate the output speaker's I2S bus runs at
+    fconf = fv.full_config.get()
+    path = fconf.get_path_for_id(config[CONF_OUTPUT_SPEAKER])[:-1]
+    output_config = fconf.get_config_for_path(path)
+    output_sample_rate = output_config.get(CONF_SAMPLE_RATE)
+    if CONF_SAMPLE_RATE not in config:
+        if output_sample_rate is None:
+            raise cv.Invalid(
+                f"The output speaker has no {CONF_SAMPLE_RATE}, please set one",
+                path=[CONF_SAMPLE_RATE],
+            )
+        config[CONF_SAMPLE_RATE] = output_sample_rate
+    elif output_sample_rate not in (None, config[CONF_SAMPLE_RATE]):
+        raise cv.Invalid(
+            f"{CONF_SAMPLE_RATE} must match the output speaker, {output_sample_rate} Hz",
+            path=[CONF_SAMPLE_RATE],
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = _final_validate
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+
+    output_speaker = await cg.get_variable(config[CONF_OUTPUT_SPEAKER])
+    cg.add(var.set_output_speaker(output_speaker))
+    cg.add(var.set_output_sample_rate(config[CONF_SAMPLE_RATE]))
+
+    for source_config in config[CONF_SOURCE_SPEAKERS]:
+        source = cg.new_Pvariable(source_config[CONF_ID])
+        await cg.register_component(source, source_config)
+        await speaker.register_speaker(source, source_config)
+        await cg.register_parented(source, var)
+
+        cg.add(source.set_sample_rate(source_config[CONF_SAMPLE_RATE]))
+        cg.add(source.set_buffer_duration(source_config[CONF_BUFFER_DURATION]))
+        cg.add(source.set_volume(source_config[CONF_VOLUME]))
+        cg.add(var.add_source_speaker(source))
+
+
+@automation.register_action(
+    "mixer_speaker.apply_ducking",
+    DuckingApplyAction,
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.use_id(SourceSpeaker),
+            cv.Required(CONF_DECIBEL_REDUCTION): cv.templatable(
+                cv.int_range(min=0, max=51)
+            ),
+            cv.Optional(CONF_DURATION, default="0s"): cv.templatable(
+                cv.positive_time_period_milliseconds
+            ),
+        }
+    ),
+)
+async def ducking_apply_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    decibel_reduction = await cg.templatable(
+        config[CONF_DECIBEL_REDUCTION], args, cg.uint8
+    )
+    cg.add(var.set_decibel_reduction(decibel_reduction))
+    duration = await cg.templatable(config[CONF_DURATION], args, cg.uint32)
+    cg.add(var.set_duration(duration))
+    return var
+
+
+@automation.register_action(
+    "mixer_speaker.set_volume",
+    SetVolumeAction,
+    cv.maybe_simple_value(
+        {
+            cv.GenerateID(): cv.use_id(SourceSpeaker),
+            cv.Required(CONF_VOLUME): cv.templatable(cv.percentage),
+        },
+        key=CONF_VOLUME,
+    ),
+)
+async def set_volume_to_code(config, action_id, template_arg, args):
+    var = cg.new_Pvariable(action_id, template_arg)
+    await cg.register_parented(var, config[CONF_ID])
+    volume = await cg.templatable(config[CONF_VOLUME], args, float)
+    cg.add(var.set_volume(volume))
+    return var
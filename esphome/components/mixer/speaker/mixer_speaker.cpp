@@ -0,0 +1,332 @@
+#include "mixer_speaker.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace esphome {
+namespace mixer_speaker {
+
+static const char *const TAG = "mixer_speaker";
+
+// Number of input samples a resampling source reads from its ring buffer at once
+static const size_t RESAMPLER_INPUT_SAMPLES = 256;
+
+static const uint32_t MIXER_TASK_STACK_SIZE = 4096;
+static const UBaseType_t MIXER_TASK_PRIORITY = 2;
+
+PolyphaseResampler::PolyphaseResampler(uint32_t input_rate, uint32_t output_rate) {
+  this->step_ = ((uint64_t) input_rate << 16) / output_rate;
+  this->step_remainder_ = ((uint64_t) input_rate << 16) % output_rate;
+  this->output_rate_ = output_rate;
+
+  // Lower the cutoff to the output Nyquist frequency when downsampling
+  const float cutoff = std::min(1.0f, (float) output_rate / (float) input_rate);
+  for (uint8_t phase = 0; phase < RESAMPLER_PHASES; ++phase) {
+    const float fraction = (float) phase / RESAMPLER_PHASES;
+    float taps[RESAMPLER_TAPS];
+    float sum = 0.0f;
+    for (uint8_t tap = 0; tap < RESAMPLER_TAPS; ++tap) {
+      // Distance of this tap from the interpolated point, the window reaches zero at +-RESAMPLER_TAPS / 2
+      const float t = (float) tap - (RESAMPLER_TAPS / 2 - 1) - fraction;
+      const float x = t * cutoff;
+      const float sinc = (x == 0.0f) ? 1.0f : sinf(M_PI * x) / (M_PI * x);
+      const float blackman = 0.42f + 0.5f * cosf(2.0f * M_PI * t / RESAMPLER_TAPS) +
+                             0.08f * cosf(4.0f * M_PI * t / RESAMPLER_TAPS);
+      taps[tap] = sinc * blackman;
+      sum += taps[tap];
+    }
+    // Normalize every phase to unity DC gain, so a constant signal doesn't ripple with the phase
+    for (uint8_t tap = 0; tap < RESAMPLER_TAPS; ++tap) {
+      this->coefficients_[phase][tap] = (int16_t) lroundf(taps[tap] / sum * (1 << 14));
+    }
+  }
+}
+
+size_t PolyphaseResampler::process(const int16_t *input, size_t input_samples, size_t &consumed, int16_t *output,
+                                   size_t output_samples) {
+  size_t produced = 0;
+  consumed = 0;
+  while (produced < output_samples) {
+    while (this->position_ >= (1 << 16)) {
+      if (consumed == input_samples)
+        return produced;
+      memmove(this->history_, this->history_ + 1, (RESAMPLER_TAPS - 1) * sizeof(int16_t));
+      this->history_[RESAMPLER_TAPS - 1] = input[consumed++];
+      this->position_ -= (1 << 16);
+    }
+
+    const int16_t *coefficients = this->coefficients_[this->position_ >> (16 - RESAMPLER_PHASE_BITS)];
+    int32_t sum = 0;
+    for (uint8_t tap = 0; tap < RESAMPLER_TAPS; ++tap) {
+      sum += (int32_t) this->history_[tap] * coefficients[tap];
+    }
+    sum = (sum + (1 << 13)) >> 14;
+    output[produced++] = clamp<int32_t>(sum, INT16_MIN, INT16_MAX);
+
+    this->position_ += this->step_;
+    // Carry the remainder, so the ratio is exact and long streams don't drift
+    this->remainder_ += this->step_remainder_;
+    if (this->remainder_ >= this->output_rate_) {
+      this->remainder_ -= this->output_rate_;
+      ++this->position_;
+    }
+  }
+  return produced;
+}
+
+void PolyphaseResampler::reset() {
+  memset(this->history_, 0, sizeof(this->history_));
+  this->position_ = 0;
+  this->remainder_ = 0;
+}
+
+void MixerSpeaker::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up Mixer Speaker...");
+
+  this->accumulator_.resize(MIX_BLOCK_SAMPLES);
+  this->source_buffer_.resize(MIX_BLOCK_SAMPLES);
+  this->output_buffer_.resize(MIX_BLOCK_SAMPLES);
+
+  xTaskCreate(MixerSpeaker::mix_task, "mixer_task", MIXER_TASK_STACK_SIZE, (void *) this, MIXER_TASK_PRIORITY,
+              &this->task_handle_);
+  if (this->task_handle_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to create mixer task");
+    this->mark_failed();
+  }
+}
+
+void MixerSpeaker::dump_config() {
+  ESP_LOGCONFIG(TAG, "Mixer Speaker:");
+  ESP_LOGCONFIG(TAG, "  Output Sample Rate: %" PRIu32 " Hz", this->output_sample_rate_);
+  ESP_LOGCONFIG(TAG, "  Source Speakers: %u", this->source_speakers_.size());
+}
+
+void MixerSpeaker::loop() {
+  bool active = std::any_of(this->source_speakers_.begin(), this->source_speakers_.end(),
+                            [](SourceSpeaker *source) { return !source->is_stopped(); });
+
+  if (active && this->output_speaker_->is_stopped()) {
+    this->output_speaker_->start();
+  } else if (!active && this->active_) {
+    // Let the output play what was already mixed instead of cutting it off
+    this->output_speaker_->finish();
+  }
+  this->active_ = active;
+}
+
+void MixerSpeaker::notify_task() {
+  if (this->task_handle_ != nullptr)
+    xTaskNotifyGive(this->task_handle_);
+}
+
+size_t MixerSpeaker::mix_block_() {
+  std::fill(this->accumulator_.begin(), this->accumulator_.end(), 0);
+
+  size_t mixed = 0;
+  for (auto *source : this->source_speakers_) {
+    size_t samples = source->read_block(this->source_buffer_.data(), MIX_BLOCK_SAMPLES);
+    if (samples == 0)
+      continue;
+    int32_t gain = source->next_block_gain(samples);
+    for (size_t i = 0; i < samples; ++i) {
+      this->accumulator_[i] += (this->source_buffer_[i] * gain) >> 15;
+    }
+    mixed = std::max(mixed, samples);
+  }
+
+  for (size_t i = 0; i < mixed; ++i) {
+    this->output_buffer_[i] = clamp<int32_t>(this->accumulator_[i], INT16_MIN, INT16_MAX);
+  }
+  return mixed;
+}
+
+void MixerSpeaker::mix_task(void *params) {
+  MixerSpeaker *this_mixer = (MixerSpeaker *) params;
+
+  while (true) {
+    if (!this_mixer->output_speaker_->is_running()) {
+      // Whatever the output didn't accept before it stopped is stale by the time it restarts
+      this_mixer->output_length_ = 0;
+      ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(20));
+      continue;
+    }
+
+    if (this_mixer->output_length_ == 0) {
+      this_mixer->output_offset_ = 0;
+      this_mixer->output_length_ = this_mixer->mix_block_() * sizeof(int16_t);
+      if (this_mixer->output_length_ == 0) {
+        // No source has audio, wait for the next play() or poll again shortly
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
+        continue;
+      }
+    }
+
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(this_mixer->output_buffer_.data());
+    size_t written = this_mixer->output_speaker_->play(data + this_mixer->output_offset_, this_mixer->output_length_);
+    this_mixer->output_offset_ += written;
+    this_mixer->output_length_ -= written;
+    if (this_mixer->output_length_ > 0) {
+      // The output's buffer is full, it paces the mixer
+      vTaskDelay(pdMS_TO_TICKS(5));
+    }
+  }
+}
+
+void SourceSpeaker::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up Mixer Source Speaker...");
+
+  this->ring_buffer_ = RingBuffer::create(this->sample_rate_ * sizeof(int16_t) * this->buffer_duration_ms_ / 1000);
+  if (this->ring_buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate ring buffer");
+    this->mark_failed();
+    return;
+  }
+
+  if (this->sample_rate_ != this->parent_->get_output_sample_rate()) {
+    this->resampler_ = make_unique<PolyphaseResampler>(this->sample_rate_, this->parent_->get_output_sample_rate());
+    this->resampler_input_.resize(RESAMPLER_INPUT_SAMPLES);
+  }
+}
+
+void SourceSpeaker::dump_config() {
+  ESP_LOGCONFIG(TAG, "Mixer Source Speaker:");
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz", this->sample_rate_);
+  ESP_LOGCONFIG(TAG, "  Buffer Duration: %" PRIu32 " ms", this->buffer_duration_ms_);
+  ESP_LOGCONFIG(TAG, "  Volume: %.0f%%", this->volume_ * 100.0f);
+  ESP_LOGCONFIG(TAG, "  Resampling: %s", YESNO(this->resampler_ != nullptr));
+}
+
+void SourceSpeaker::loop() {
+  switch (this->state_) {
+    case speaker::STATE_STARTING:
+      this->state_ = speaker::STATE_RUNNING;
+      break;
+    case speaker::STATE_STOPPING:
+      if (!this->has_buffered_data())
+        this->state_ = speaker::STATE_STOPPED;
+      break;
+    case speaker::STATE_RUNNING:
+    case speaker::STATE_STOPPED:
+      break;
+  }
+}
+
+size_t SourceSpeaker::play(const uint8_t *data, size_t length) {
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "Cannot play audio, speaker failed to setup");
+    return 0;
+  }
+  if (this->state_ == speaker::STATE_STOPPED || this->state_ == speaker::STATE_STOPPING) {
+    this->start();
+  }
+
+  // Only write whole samples, the mixer task reads the buffer in samples
+  length = std::min(length, this->ring_buffer_->free()) & ~(sizeof(int16_t) - 1);
+  size_t written = this->ring_buffer_->write_without_replacement((void *) data, length);
+  this->parent_->notify_task();
+  return written;
+}
+
+void SourceSpeaker::start() {
+  if (this->is_failed())
+    return;
+  this->state_ = speaker::STATE_STARTING;
+}
+
+void SourceSpeaker::stop() {
+  if (this->is_failed())
+    return;
+  this->ring_buffer_->reset();
+  this->reset_requested_ = true;
+  this->state_ = speaker::STATE_STOPPED;
+}
+
+void SourceSpeaker::finish() {
+  if (this->state_ == speaker::STATE_STARTING || this->state_ == speaker::STATE_RUNNING)
+    this->state_ = speaker::STATE_STOPPING;
+}
+
+bool SourceSpeaker::has_buffered_data() const {
+  return this->ring_buffer_ != nullptr && this->ring_buffer_->available() > 0;
+}
+
+void SourceSpeaker::set_volume(float volume) {
+  this->volume_ = clamp(volume, 0.0f, 1.0f);
+  this->ramp_samples_ = 0;
+  this->update_target_gain_();
+}
+
+void SourceSpeaker::apply_ducking(uint8_t decibel_reduction, uint32_t duration_ms) {
+  this->decibel_reduction_ = decibel_reduction;
+  this->ramp_samples_ = (uint64_t) duration_ms * this->parent_->get_output_sample_rate() / 1000;
+  this->update_target_gain_();
+}
+
+void SourceSpeaker::update_target_gain_() {
+  float gain = this->volume_ * powf(10.0f, -this->decibel_reduction_ / 20.0f);
+  this->target_gain_ = (int32_t) lroundf(gain * (1 << 15));
+}
+
+size_t SourceSpeaker::read_block(int16_t *buffer, size_t samples) {
+  if (this->ring_buffer_ == nullptr)
+    return 0;
+
+  if (this->reset_requested_.exchange(false)) {
+    if (this->resampler_ != nullptr)
+      this->resampler_->reset();
+    this->resampler_input_length_ = 0;
+  }
+
+  if (this->resampler_ == nullptr)
+    return this->ring_buffer_->read((void *) buffer, samples * sizeof(int16_t)) / sizeof(int16_t);
+
+  size_t produced = 0;
+  while (produced < samples) {
+    if (this->resampler_input_length_ == 0) {
+      this->resampler_input_offset_ = 0;
+      this->resampler_input_length_ =
+          this->ring_buffer_->read((void *) this->resampler_input_.data(), RESAMPLER_INPUT_SAMPLES * sizeof(int16_t)) /
+          sizeof(int16_t);
+      if (this->resampler_input_length_ == 0)
+        break;
+    }
+    size_t consumed;
+    produced += this->resampler_->process(this->resampler_input_.data() + this->resampler_input_offset_,
+                                          this->resampler_input_length_, consumed, buffer + produced,
+                                          samples - produced);
+    this->resampler_input_offset_ += consumed;
+    this->resampler_input_length_ -= consumed;
+  }
+  return produced;
+}
+
+int32_t SourceSpeaker::next_block_gain(size_t samples) {
+  int32_t target = this->target_gain_;
+  if (target != this->ramp_target_gain_) {
+    this->ramp_start_gain_ = this->gain_;
+    this->ramp_target_gain_ = target;
+    this->ramp_total_ = this->ramp_samples_;
+    this->ramp_remaining_ = this->ramp_total_;
+  }
+
+  if (this->ramp_remaining_ > samples) {
+    this->ramp_remaining_ -= samples;
+    this->gain_ = this->ramp_target_gain_ - (int64_t) (this->ramp_target_gain_ - this->ramp_start_gain_) *
+                                                this->ramp_remaining_ / this->ramp_total_;
+  } else {
+    this->ramp_remaining_ = 0;
+    this->gain_ = this->ramp_target_gain_;
+  }
+  return this->gain_;
+}
+
+}  // namespace mixer_speaker
+}  // namespace esphome
+
+#endif
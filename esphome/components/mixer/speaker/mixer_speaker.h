@@ -0,0 +1,195 @@
+#pragma once
+
+#ifdef USE_ESP32
+
+#include "esphome/components/speaker/speaker.h"
+#include "esphome/core/automation.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/ring_buffer.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace esphome {
+namespace mixer_speaker {
+
+// Number of output samples mixed per pass of the mixer task
+static const size_t MIX_BLOCK_SAMPLES = 256;
+
+/// @brief Fixed-point polyphase FIR resampler for 16-bit mono audio.
+///
+/// The windowed sinc filter has RESAMPLER_TAPS taps and is tabulated for RESAMPLER_PHASES fractional positions, so
+/// each output sample costs a single dot product. When downsampling, the cutoff follows the output rate to suppress
+/// aliasing.
+class PolyphaseResampler {
+ public:
+  static const uint8_t RESAMPLER_TAPS = 16;
+  static const uint8_t RESAMPLER_PHASE_BITS = 5;
+  static const uint8_t RESAMPLER_PHASES = 1 << RESAMPLER_PHASE_BITS;
+
+  PolyphaseResampler(uint32_t input_rate, uint32_t output_rate);
+
+  /// @brief Resamples as much of the input as fits in the output
+  /// @param input Input samples
+  /// @param input_samples Number of input samples available
+  /// @param consumed Set to the number of input samples used
+  /// @param output Buffer for the output samples
+  /// @param output_samples Maximum number of output samples to produce
+  /// @return Number of output samples produced
+  size_t process(const int16_t *input, size_t input_samples, size_t &consumed, int16_t *output,
+                 size_t output_samples);
+
+  /// @brief Forgets the filter history, so the next stream doesn't start with the tail of the previous one
+  void reset();
+
+ protected:
+  // Q14 coefficients, one row per phase
+  int16_t coefficients_[RESAMPLER_PHASES][RESAMPLER_TAPS];
+  // Most recent input samples, oldest first
+  int16_t history_[RESAMPLER_TAPS]{};
+  // Input samples per output sample, in Q16, with the truncated remainder tracked in units of 1 / output_rate_
+  uint32_t step_;
+  uint32_t step_remainder_;
+  uint32_t remainder_{0};
+  uint32_t output_rate_;
+  // Fractional position of the next output sample past the centre of the history, in Q16
+  uint32_t position_{0};
+};
+
+class SourceSpeaker;
+
+/// @brief Mixes the audio from several source speakers into one output speaker.
+///
+/// Every source speaker buffers its audio in its own ring buffer. A dedicated task resamples each source to the
+/// output sample rate, applies its gain, and sums them with saturation. The output speaker therefore keeps a single
+/// configuration, no matter how many streams play or what rate they use.
+class MixerSpeaker : public Component {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return esphome::setup_priority::LATE; }
+
+  void set_output_speaker(speaker::Speaker *output_speaker) { this->output_speaker_ = output_speaker; }
+  void set_output_sample_rate(uint32_t sample_rate) { this->output_sample_rate_ = sample_rate; }
+  uint32_t get_output_sample_rate() const { return this->output_sample_rate_; }
+
+  void add_source_speaker(SourceSpeaker *source_speaker) { this->source_speakers_.push_back(source_speaker); }
+
+  /// @brief Wakes the mixer task after a source received new audio
+  void notify_task();
+
+ protected:
+  static void mix_task(void *params);
+  /// @brief Mixes one block from all sources into output_buffer_
+  /// @return Number of mixed samples, 0 if no source had audio
+  size_t mix_block_();
+
+  speaker::Speaker *output_speaker_{nullptr};
+  uint32_t output_sample_rate_{16000};
+  std::vector<SourceSpeaker *> source_speakers_;
+
+  TaskHandle_t task_handle_{nullptr};
+
+  bool active_{false};
+
+  // The buffers are only used by the mixer task
+  std::vector<int32_t> accumulator_;
+  std::vector<int16_t> source_buffer_;
+  std::vector<int16_t> output_buffer_;
+  size_t output_offset_{0};
+  size_t output_length_{0};
+};
+
+/// @brief A speaker whose audio is mixed into the parent's output speaker.
+///
+/// Accepts 16-bit mono samples at its own sample rate.
+class SourceSpeaker : public speaker::Speaker, public Component, public Parented<MixerSpeaker> {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return esphome::setup_priority::LATE; }
+
+  size_t play(const uint8_t *data, size_t length) override;
+
+  void start() override;
+  void stop() override;
+  void finish() override;
+
+  bool has_buffered_data() const override;
+
+  void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
+  void set_buffer_duration(uint32_t buffer_duration_ms) { this->buffer_duration_ms_ = buffer_duration_ms; }
+
+  /// @brief Sets the volume between 0.0 (muted) and 1.0 (unity gain)
+  void set_volume(float volume);
+  float get_volume() const { return this->volume_; }
+
+  /// @brief Lowers this source by decibel_reduction dB, ramping over duration_ms. A reduction of 0 restores it.
+  void apply_ducking(uint8_t decibel_reduction, uint32_t duration_ms);
+
+  /// @brief Reads this source's contribution to the next mixed block, called by the mixer task
+  /// @param buffer Receives output-rate samples
+  /// @param samples Number of samples wanted
+  /// @return Number of samples written to buffer
+  size_t read_block(int16_t *buffer, size_t samples);
+
+  /// @brief Gain for a block of the given length in Q15, advancing any ducking ramp. Called by the mixer task.
+  int32_t next_block_gain(size_t samples);
+
+ protected:
+  void update_target_gain_();
+
+  std::unique_ptr<RingBuffer> ring_buffer_;
+  std::unique_ptr<PolyphaseResampler> resampler_;
+  // Input samples waiting for the resampler, only used by the mixer task
+  std::vector<int16_t> resampler_input_;
+  size_t resampler_input_offset_{0};
+  size_t resampler_input_length_{0};
+
+  uint32_t sample_rate_{16000};
+  uint32_t buffer_duration_ms_{500};
+
+  float volume_{1.0f};
+  uint8_t decibel_reduction_{0};
+
+  // Set by the main loop, picked up by the mixer task at the start of the next block
+  std::atomic<int32_t> target_gain_{1 << 15};
+  std::atomic<uint32_t> ramp_samples_{0};
+  std::atomic<bool> reset_requested_{false};
+
+  // Only used by the mixer task
+  int32_t gain_{1 << 15};
+  int32_t ramp_start_gain_{1 << 15};
+  int32_t ramp_target_gain_{1 << 15};
+  uint32_t ramp_total_{0};
+  uint32_t ramp_remaining_{0};
+};
+
+template<typename... Ts> class DuckingApplyAction : public Action<Ts...>, public Parented<SourceSpeaker> {
+ public:
+  TEMPLATABLE_VALUE(uint8_t, decibel_reduction)
+  TEMPLATABLE_VALUE(uint32_t, duration)
+
+  void play(Ts... x) override {
+    this->parent_->apply_ducking(this->decibel_reduction_.value(x...), this->duration_.value(x...));
+  }
+};
+
+template<typename... Ts> class SetVolumeAction : public Action<Ts...>, public Parented<SourceSpeaker> {
+ public:
+  TEMPLATABLE_VALUE(float, volume)
+
+  void play(Ts... x) override { this->parent_->set_volume(this->volume_.value(x...)); }
+};
+
+}  // namespace mixer_speaker
+}  // namespace esphome
+
+#endif
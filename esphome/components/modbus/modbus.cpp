@@ -2,27 +2,53 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus {
 
 static const char *const TAG = "modbus";
 
+// Lower bound for the adaptive response timeout
+static const uint32_t MIN_RESPONSE_TIMEOUT = 20;
+// Upper bound for the backoff of a device that stopped responding
+static const uint32_t MAX_BACKOFF = 60000;
+
 void Modbus::setup() {
   if (this->flow_control_pin_ != nullptr) {
     this->flow_control_pin_->setup();
   }
+  // An RTU frame ends with a silence of 3.5 characters
+  uart::UARTFrameConfig frame_config;
+  frame_config.idle_chars = 4;
+  this->use_frames_ = this->set_frame_callback(frame_config, [this](const uint8_t *data, size_t len) {
+    this->reset_rx_buffer_();
+    for (size_t i = 0; i < len; i++) {
+      if (!this->parse_modbus_byte_(data[i]))
+        this->reset_rx_buffer_();
+    }
+  });
 }
 void Modbus::loop() {
   const uint32_t now = millis();
 
+  // stop blocking new send commands after the response timeout regardless if a response has been received since then
+  if (this->waiting_for_response != 0 && now - this->last_send_ > this->response_timeout_) {
+    ModbusDevice *device = this->find_device_(this->waiting_for_response);
+    // a server doesn't wait for anything after its response
+    if (device != nullptr && this->role == ModbusRole::CLIENT)
+      this->on_response_timeout_(device, now);
+    waiting_for_response = 0;
+  }
+  // the UART delivers whole frames to the frame callback
+  if (this->use_frames_)
+    return;
+
   if (now - this->last_modbus_byte_ > 50) {
-    this->rx_buffer_.clear();
+    this->reset_rx_buffer_();
     this->last_modbus_byte_ = now;
   }
-  // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
-  if (now - this->last_send_ > send_wait_time_) {
-    waiting_for_response = 0;
-  }
 
   while (this->available()) {
     uint8_t byte;
@@ -30,15 +56,20 @@ void Modbus::loop() {
     if (this->parse_modbus_byte_(byte)) {
       this->last_modbus_byte_ = now;
     } else {
-      this->rx_buffer_.clear();
+      this->reset_rx_buffer_();
     }
   }
 }
 
 bool Modbus::parse_modbus_byte_(uint8_t byte) {
-  size_t at = this->rx_buffer_.size();
-  this->rx_buffer_.push_back(byte);
-  const uint8_t *raw = &this->rx_buffer_[0];
+  // longer than any valid frame, start over
+  if (this->rx_length_ == MODBUS_MAX_FRAME_SIZE)
+    return false;
+  size_t at = this->rx_length_;
+  this->rx_buffer_[this->rx_length_++] = byte;
+  // the CRC over a frame including its own CRC is 0, so a frame is complete once the running CRC returns to 0
+  this->rx_crc_ = crc16(&byte, 1, this->rx_crc_);
+  const uint8_t *raw = this->rx_buffer_.data();
   ESP_LOGV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
   // Byte 0: modbus address (match all)
   if (at == 0)
@@ -68,10 +99,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
     data_len = at - 2;
     data_offset = 1;
 
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
+    if (this->rx_crc_ != 0)
       return true;
 
     ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
@@ -105,9 +133,9 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       return true;
 
     // Byte data_offset+len+1: CRC_HI (over all bytes)
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-    if (computed_crc != remote_crc) {
+    if (this->rx_crc_ != 0) {
+      uint16_t computed_crc = crc16(raw, data_offset + data_len);
+      uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
       if (this->disable_crc_) {
         ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
       } else {
@@ -116,7 +144,7 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
       }
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+  const uint8_t *data = raw + data_offset;
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
@@ -133,8 +161,10 @@ bool Modbus::parse_modbus_byte_(uint8_t byte) {
         device->on_modbus_read_registers(function_code, uint16_t(data[1]) | (uint16_t(data[0]) << 8),
                                          uint16_t(data[3]) | (uint16_t(data[2]) << 8));
       } else {
-        device->on_modbus_data(data);
+        device->on_modbus_frame(data, data_len);
       }
+      if (!found && waiting_for_response == address)
+        this->on_response_(device, millis());
       found = true;
     }
   }
@@ -205,8 +235,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
 
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
-  waiting_for_response = address;
-  last_send_ = millis();
+  this->start_response_wait_(address);
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
 }
 
@@ -227,9 +256,73 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
   this->flush();
   if (this->flow_control_pin_ != nullptr)
     this->flow_control_pin_->digital_write(false);
-  waiting_for_response = payload[0];
+  this->start_response_wait_(payload[0]);
   ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
-  last_send_ = millis();
+}
+
+bool Modbus::request_bus(ModbusDevice *device) {
+  const uint32_t now = millis();
+  if (!device->bus_requested_) {
+    device->bus_requested_ = true;
+    device->bus_request_time_ = now;
+  }
+  if (this->waiting_for_response != 0 || device->is_backed_off_(now))
+    return false;
+  for (auto *other : this->devices_) {
+    if (other == device || !other->bus_requested_ || other->is_backed_off_(now))
+      continue;
+    // an older request goes first
+    if (int32_t(other->bus_request_time_ - device->bus_request_time_) < 0)
+      return false;
+  }
+  return true;
+}
+
+ModbusDevice *Modbus::find_device_(uint8_t address) {
+  for (auto *device : this->devices_) {
+    if (device->address_ == address)
+      return device;
+  }
+  return nullptr;
+}
+
+void Modbus::start_response_wait_(uint8_t address) {
+  this->waiting_for_response = address;
+  this->last_send_ = millis();
+  this->response_timeout_ = this->send_wait_time_;
+  ModbusDevice *device = this->find_device_(address);
+  if (device == nullptr)
+    return;
+  device->bus_requested_ = false;
+  // twice the slowest recent response, until then the configured send_wait_time
+  if (device->latency_peak_ != 0) {
+    this->response_timeout_ =
+        std::min<uint32_t>(this->send_wait_time_, std::max(2 * device->latency_peak_, MIN_RESPONSE_TIMEOUT));
+  }
+}
+
+void Modbus::on_response_(ModbusDevice *device, uint32_t now) {
+  uint32_t latency = now - this->last_send_;
+  device->latency_peak_ = std::max(latency, device->latency_peak_ - device->latency_peak_ / 8);
+  if (device->consecutive_timeouts_ >= 2)
+    ESP_LOGI(TAG, "Modbus device 0x%02X responds again", device->address_);
+  device->consecutive_timeouts_ = 0;
+  device->backoff_duration_ = 0;
+}
+
+void Modbus::on_response_timeout_(ModbusDevice *device, uint32_t now) {
+  // the device may have become slower, wait the full send_wait_time for the next response
+  device->latency_peak_ = 0;
+  if (device->consecutive_timeouts_ < 16)
+    device->consecutive_timeouts_++;
+  // a single lost response doesn't hold the device back
+  if (device->consecutive_timeouts_ < 2)
+    return;
+  uint32_t backoff = uint32_t(this->send_wait_time_) << std::min<uint8_t>(device->consecutive_timeouts_ - 2, 8);
+  device->backoff_start_ = now;
+  device->backoff_duration_ = std::min(backoff, MAX_BACKOFF);
+  ESP_LOGD(TAG, "Modbus device 0x%02X timed out %u times, backing off for %" PRIu32 " ms", device->address_,
+           device->consecutive_timeouts_, device->backoff_duration_);
 }
 
 }  // namespace modbus
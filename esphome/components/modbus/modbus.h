@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/uart/uart.h"
 
+#include <array>
 #include <vector>
 
 namespace esphome {
@@ -13,6 +14,9 @@ enum ModbusRole {
   SERVER,
 };
 
+// Largest RTU frame: address, function code, 252 data bytes and CRC
+static const size_t MODBUS_MAX_FRAME_SIZE = 256;
+
 class ModbusDevice;
 
 class Modbus : public uart::UARTDevice, public Component {
@@ -32,6 +36,12 @@ class Modbus : public uart::UARTDevice, public Component {
   void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
             uint8_t payload_len = 0, const uint8_t *payload = nullptr);
   void send_raw(const std::vector<uint8_t> &payload);
+  /** Ask whether device may send its next request now.
+   *
+   * The bus is granted to the devices in the order they first asked for it, so a device polling in every loop can't
+   * starve the others. Devices that stopped responding are held back with an exponential backoff.
+   */
+  bool request_bus(ModbusDevice *device);
   void set_role(ModbusRole role) { this->role = role; }
   void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
   uint8_t waiting_for_response{0};
@@ -44,11 +54,25 @@ class Modbus : public uart::UARTDevice, public Component {
   GPIOPin *flow_control_pin_{nullptr};
 
   bool parse_modbus_byte_(uint8_t byte);
+  ModbusDevice *find_device_(uint8_t address);
+  /// Start waiting for the response of the device at address, with a timeout adapted to its measured latency
+  void start_response_wait_(uint8_t address);
+  void on_response_(ModbusDevice *device, uint32_t now);
+  void on_response_timeout_(ModbusDevice *device, uint32_t now);
+  void reset_rx_buffer_() {
+    this->rx_length_ = 0;
+    this->rx_crc_ = 0xFFFF;
+  }
   uint16_t send_wait_time_{250};
   bool disable_crc_;
-  std::vector<uint8_t> rx_buffer_;
+  bool use_frames_{false};
+  std::array<uint8_t, MODBUS_MAX_FRAME_SIZE> rx_buffer_;
+  size_t rx_length_{0};
+  // CRC over rx_buffer_[0..rx_length_)
+  uint16_t rx_crc_{0xFFFF};
   uint32_t last_modbus_byte_{0};
   uint32_t last_send_{0};
+  uint32_t response_timeout_{0};
   std::vector<ModbusDevice *> devices_;
 };
 
@@ -57,6 +81,11 @@ class ModbusDevice {
   void set_parent(Modbus *parent) { parent_ = parent; }
   void set_address(uint8_t address) { address_ = address; }
   virtual void on_modbus_data(const std::vector<uint8_t> &data) = 0;
+  /// Called with the data of a received frame, which is only valid during the call. Devices that handle the data in
+  /// place override this to avoid the copy into a vector for on_modbus_data().
+  virtual void on_modbus_frame(const uint8_t *data, size_t len) {
+    this->on_modbus_data(std::vector<uint8_t>(data, data + len));
+  }
   virtual void on_modbus_error(uint8_t function_code, uint8_t exception_code) {}
   virtual void on_modbus_read_registers(uint8_t function_code, uint16_t start_address, uint16_t number_of_registers){};
   void send(uint8_t function, uint16_t start_address, uint16_t number_of_entities, uint8_t payload_len = 0,
@@ -66,12 +95,29 @@ class ModbusDevice {
   void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
   // If more than one device is connected block sending a new command before a response is received
   bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  // Whether this device may send now, see Modbus::request_bus()
+  bool request_bus() { return this->parent_->request_bus(this); }
+  // Withdraw a request_bus() when there was nothing to send after all
+  void cancel_bus_request() { this->bus_requested_ = false; }
 
  protected:
   friend Modbus;
 
+  bool is_backed_off_(uint32_t now) const {
+    return this->backoff_duration_ != 0 && now - this->backoff_start_ < this->backoff_duration_;
+  }
+
   Modbus *parent_;
   uint8_t address_;
+
+  // Bus arbitration, maintained by Modbus
+  bool bus_requested_{false};
+  uint32_t bus_request_time_{0};
+  // Slowest recent response in ms, decays with every faster response. 0 until the first response.
+  uint32_t latency_peak_{0};
+  uint8_t consecutive_timeouts_{0};
+  uint32_t backoff_start_{0};
+  uint32_t backoff_duration_{0};
 };
 
 }  // namespace modbus
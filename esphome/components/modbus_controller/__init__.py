@@ -2,7 +2,7 @@ import binascii
 
 from esphome import automation
 import esphome.codegen as cg
-from esphome.components import modbus
+from esphome.components import modbus, sensor
 import esphome.config_validation as cv
 from esphome.const import (
     CONF_ADDRESS,
@@ -11,6 +11,9 @@ from esphome.const import (
     CONF_NAME,
     CONF_OFFSET,
     CONF_TRIGGER_ID,
+    ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_MEASUREMENT,
+    UNIT_MILLISECOND,
 )
 from esphome.cpp_helpers import logging
 
@@ -22,19 +25,22 @@ from .const import (
     CONF_CUSTOM_COMMAND,
     CONF_FORCE_NEW_RANGE,
     CONF_MAX_CMD_RETRIES,
+    CONF_MAX_REGISTER_GAP,
+    CONF_MAX_REGISTERS_PER_REQUEST,
     CONF_MODBUS_CONTROLLER_ID,
     CONF_OFFLINE_SKIP_UPDATES,
     CONF_ON_COMMAND_SENT,
     CONF_REGISTER_COUNT,
     CONF_REGISTER_TYPE,
     CONF_RESPONSE_SIZE,
+    CONF_ROUND_TRIP_TIME,
     CONF_SKIP_UPDATES,
     CONF_VALUE_TYPE,
 )
 
 CODEOWNERS = ["@martgras"]
 
-AUTO_LOAD = ["modbus"]
+AUTO_LOAD = ["modbus", "sensor"]
 
 CONF_READ_LAMBDA = "read_lambda"
 CONF_SERVER_REGISTERS = "server_registers"
@@ -136,6 +142,18 @@ CONFIG_SCHEMA = cv.All(
             ): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_MAX_CMD_RETRIES, default=4): cv.positive_int,
             cv.Optional(CONF_OFFLINE_SKIP_UPDATES, default=0): cv.positive_int,
+            # Reading unused registers fails on devices that don't implement them,
+            # so ranges are only merged across gaps when asked for
+            cv.Optional(CONF_MAX_REGISTER_GAP, default=0): cv.int_range(0, 124),
+            cv.Optional(CONF_MAX_REGISTERS_PER_REQUEST, default=125): cv.int_range(
+                1, 125
+            ),
+            cv.Optional(CONF_ROUND_TRIP_TIME): sensor.sensor_schema(
+                unit_of_measurement=UNIT_MILLISECOND,
+                accuracy_decimals=0,
+                state_class=STATE_CLASS_MEASUREMENT,
+                entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+            ),
             cv.Optional(
                 CONF_SERVER_REGISTERS,
             ): cv.ensure_list(ModbusServerRegisterSchema),
@@ -263,6 +281,13 @@ async def to_code(config):
     cg.add(var.set_command_throttle(config[CONF_COMMAND_THROTTLE]))
     cg.add(var.set_max_cmd_retries(config[CONF_MAX_CMD_RETRIES]))
     cg.add(var.set_offline_skip_updates(config[CONF_OFFLINE_SKIP_UPDATES]))
+    cg.add(var.set_max_register_gap(config[CONF_MAX_REGISTER_GAP]))
+    cg.add(
+        var.set_max_registers_per_request(config[CONF_MAX_REGISTERS_PER_REQUEST])
+    )
+    if round_trip_time_config := config.get(CONF_ROUND_TRIP_TIME):
+        sens = await sensor.new_sensor(round_trip_time_config)
+        cg.add(var.set_round_trip_time_sensor(sens))
     if CONF_SERVER_REGISTERS in config:
         for server_register in config[CONF_SERVER_REGISTERS]:
             cg.add(
@@ -18,7 +18,7 @@ void ModbusController::setup() { this->create_register_ranges_(); }
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
 
-  if ((last_send > this->command_throttle_) && !waiting_for_response() && !this->command_queue_.empty()) {
+  if ((last_send > this->command_throttle_) && !this->command_queue_.empty() && this->request_bus()) {
     auto &command = this->command_queue_.front();
 
     // remove from queue if command was sent too often
@@ -37,6 +37,8 @@ bool ModbusController::send_next_command_() {
       ESP_LOGD(TAG, "Modbus command to device=%d register=0x%02X no response received - removed from send queue",
                this->address_, command->register_address);
       this->command_queue_.pop_front();
+      // nothing was sent, let the other devices go first
+      this->cancel_bus_request();
     } else {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
@@ -56,7 +58,7 @@ bool ModbusController::send_next_command_() {
 }
 
 // Queue incoming response
-void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
+void ModbusController::on_modbus_frame(const uint8_t *data, size_t len) {
   auto &current_command = this->command_queue_.front();
   if (current_command != nullptr) {
     if (this->module_offline_) {
@@ -70,9 +72,11 @@ void ModbusController::on_modbus_data(const std::vector<uint8_t> &data) {
       }
     }
     this->module_offline_ = false;
+    this->round_trip_time_sum_ += millis() - this->last_command_timestamp_;
+    this->round_trip_time_count_++;
 
     // Move the commandItem to the response queue
-    current_command->payload = data;
+    current_command->payload.assign(data, data + len);
     this->incoming_queue_.push(std::move(current_command));
     ESP_LOGV(TAG, "Modbus response queued");
     this->command_queue_.pop_front();
@@ -228,6 +232,14 @@ void ModbusController::update() {
     ESP_LOGV(TAG, "Updating modbus component");
   }
 
+#ifdef USE_SENSOR
+  if (this->round_trip_time_sensor_ != nullptr && this->round_trip_time_count_ > 0) {
+    this->round_trip_time_sensor_->publish_state(float(this->round_trip_time_sum_) / this->round_trip_time_count_);
+  }
+#endif
+  this->round_trip_time_sum_ = 0;
+  this->round_trip_time_count_ = 0;
+
   for (auto &r : this->register_ranges_) {
     ESP_LOGVV(TAG, "Updating range 0x%X", r.start_address);
     update_range_(r);
@@ -285,16 +297,20 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
-          // this register can extend the current range
+        } else if (curr->start_address >= (r.start_address + r.register_count) &&
+                   this->can_extend_range_(r, prev, curr)) {
+          // this register can extend the current range, reading the unused registers in between is cheaper than
+          // another command with its request, response header and turnaround time
+          uint16_t gap = curr->start_address - (r.start_address + r.register_count);
 
           // remove this sensore because start_address is changed (sort-order)
           ix = sensorset_.erase(ix);
 
           curr->start_address = r.start_address;
-          curr->offset += buffer_offset;
-          buffer_offset += curr->get_register_size();
-          r.register_count += curr->register_count;
+          // every skipped register takes two bytes in the response
+          curr->offset += buffer_offset + gap * 2;
+          buffer_offset += gap * 2 + curr->get_register_size();
+          r.register_count += gap + curr->register_count;
 
           sensorset_.insert(curr);
           // move iterator backwards because it will be incremented later
@@ -341,11 +357,31 @@ size_t ModbusController::create_register_ranges_() {
   return register_ranges_.size();
 }
 
+bool ModbusController::can_extend_range_(const RegisterRange &r, const SensorItem *prev,
+                                         const SensorItem *curr) const {
+  uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+  if (r.register_count + gap + curr->register_count > this->max_registers_per_request_)
+    return false;
+  if (gap == 0)
+    return true;
+  // unused registers can only be skipped when each register is two bytes of the response
+  if (gap > this->max_register_gap_ || curr->register_type == ModbusRegisterType::COIL ||
+      curr->register_type == ModbusRegisterType::DISCRETE_INPUT || prev->response_bytes != 0 ||
+      curr->response_bytes != 0)
+    return false;
+  return true;
+}
+
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
   ESP_LOGCONFIG(TAG, "  Max Command Retries: %d", this->max_cmd_retries_);
   ESP_LOGCONFIG(TAG, "  Offline Skip Updates: %d", this->offline_skip_updates_);
+  ESP_LOGCONFIG(TAG, "  Max Register Gap: %u", this->max_register_gap_);
+  ESP_LOGCONFIG(TAG, "  Max Registers Per Request: %u", this->max_registers_per_request_);
+#ifdef USE_SENSOR
+  LOG_SENSOR("  ", "Round Trip Time", this->round_trip_time_sensor_);
+#endif
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
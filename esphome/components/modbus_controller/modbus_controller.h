@@ -4,6 +4,11 @@
 
 #include "esphome/components/modbus/modbus.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/defines.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
 
 #include <list>
 #include <queue>
@@ -441,7 +446,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   /// Registers a server register with the controller. Called by esphomes code generator
   void add_server_register(ServerRegister *server_register) { server_registers_.push_back(server_register); }
   /// called when a modbus response was parsed without errors
-  void on_modbus_data(const std::vector<uint8_t> &data) override;
+  void on_modbus_data(const std::vector<uint8_t> &data) override { this->on_modbus_frame(data.data(), data.size()); }
+  void on_modbus_frame(const uint8_t *data, size_t len) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
   /// called when a modbus request (function code 3 or 4) was parsed without errors
@@ -472,10 +478,24 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_max_cmd_retries(uint8_t max_cmd_retries) { this->max_cmd_retries_ = max_cmd_retries; }
   /// get how many times a command will be (re)sent if no response is received
   uint8_t get_max_cmd_retries() { return this->max_cmd_retries_; }
+  /// called by esphome generated code to set how many unused registers may be read to merge two ranges
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
+  /// called by esphome generated code to set the most registers read by one command
+  void set_max_registers_per_request(uint16_t max_registers_per_request) {
+    this->max_registers_per_request_ = max_registers_per_request;
+  }
+#ifdef USE_SENSOR
+  /// called by esphome generated code to set the sensor for the average time from command to response
+  void set_round_trip_time_sensor(sensor::Sensor *round_trip_time_sensor) {
+    this->round_trip_time_sensor_ = round_trip_time_sensor;
+  }
+#endif
 
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// whether curr can be added to the range r, which ends with prev, without exceeding the request size
+  bool can_extend_range_(const RegisterRange &r, const SensorItem *prev, const SensorItem *curr) const;
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
@@ -508,6 +528,16 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   uint16_t offline_skip_updates_;
   /// How many times we will retry a command if we get no response
   uint8_t max_cmd_retries_{4};
+  /// Unused registers that may be read to merge two ranges into one command
+  uint16_t max_register_gap_{0};
+  /// Most registers to read with one command, the protocol allows 125
+  uint16_t max_registers_per_request_{125};
+  /// Time from command to response of the responses since the last update
+  uint32_t round_trip_time_sum_{0};
+  uint16_t round_trip_time_count_{0};
+#ifdef USE_SENSOR
+  sensor::Sensor *round_trip_time_sensor_{nullptr};
+#endif
   CallbackManager<void(int, int)> command_sent_callback_{};
 };
 
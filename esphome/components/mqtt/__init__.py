@@ -64,6 +64,8 @@ def AUTO_LOAD():
 
 CONF_DISCOVER_IP = "discover_ip"
 CONF_IDF_SEND_ASYNC = "idf_send_async"
+CONF_PUBLISH_QUEUE_SIZE = "publish_queue_size"
+CONF_DISCOVERY_SHARED_DEVICE = "discovery_shared_device"
 CONF_SKIP_CERT_CN_CHECK = "skip_cert_cn_check"
 
 
@@ -231,6 +233,7 @@ CONFIG_SCHEMA = cv.All(
                 cv.boolean, cv.one_of("CLEAN", upper=True)
             ),
             cv.Optional(CONF_DISCOVERY_RETAIN, default=True): cv.boolean,
+            cv.Optional(CONF_DISCOVERY_SHARED_DEVICE, default=False): cv.boolean,
             cv.Optional(CONF_DISCOVER_IP, default=True): cv.boolean,
             cv.Optional(
                 CONF_DISCOVERY_PREFIX, default="homeassistant"
@@ -262,6 +265,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(
                 CONF_REBOOT_TIMEOUT, default="15min"
             ): cv.positive_time_period_milliseconds,
+            cv.Optional(CONF_PUBLISH_QUEUE_SIZE): cv.int_range(min=1, max=1000),
             cv.Optional(CONF_ON_CONNECT): automation.validate_automation(
                 {
                     cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(MQTTConnectTrigger),
@@ -365,6 +369,9 @@ async def to_code(config):
             )
         )
 
+    if config[CONF_DISCOVERY_SHARED_DEVICE]:
+        cg.add(var.set_discovery_shared_device(True))
+
     cg.add(var.set_topic_prefix(config[CONF_TOPIC_PREFIX]))
 
     if config[CONF_USE_ABBREVIATIONS]:
@@ -407,6 +414,9 @@ async def to_code(config):
 
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
 
+    if CONF_PUBLISH_QUEUE_SIZE in config:
+        cg.add(var.set_publish_queue_size(config[CONF_PUBLISH_QUEUE_SIZE]))
+
     # esp-idf only
     if CONF_CERTIFICATE_AUTHORITY in config:
         cg.add(var.set_ca_certificate(config[CONF_CERTIFICATE_AUTHORITY]))
@@ -2,6 +2,7 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -26,6 +27,8 @@ namespace esphome {
 namespace mqtt {
 
 static const char *const TAG = "mqtt";
+/// Building a discovery payload takes a few milliseconds, so only a few components send theirs per loop iteration
+static const uint8_t DISCOVERIES_PER_LOOP = 4;
 
 MQTTClientComponent::MQTTClientComponent() {
   global_mqtt_client = this;
@@ -35,6 +38,7 @@ MQTTClientComponent::MQTTClientComponent() {
 // Connection
 void MQTTClientComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up MQTT...");
+  this->mqtt_backend_.set_on_connect([this](bool session_present) { this->session_present_ = session_present; });
   this->mqtt_backend_.set_on_message(
       [this](const char *topic, const char *payload, size_t len, size_t index, size_t total) {
         if (index == 0)
@@ -162,6 +166,9 @@ void MQTTClientComponent::dump_config() {
   if (!this->availability_.topic.empty()) {
     ESP_LOGCONFIG(TAG, "  Availability: '%s'", this->availability_.topic.c_str());
   }
+  if (this->publish_queue_size_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Publish Queue Size: %zu", this->publish_queue_size_);
+  }
 }
 bool MQTTClientComponent::can_proceed() { return network::is_disabled() || this->is_connected(); }
 
@@ -170,6 +177,7 @@ void MQTTClientComponent::start_dnslookup_() {
     subscription.subscribed = false;
     subscription.resubscribe_timeout = 0;
   }
+  this->clear_publish_queue_();
 
   this->status_set_warning();
   this->dns_resolve_error_ = false;
@@ -297,6 +305,7 @@ void MQTTClientComponent::check_connected() {
 void MQTTClientComponent::loop() {
   // Call the backend loop first
   mqtt_backend_.loop();
+  this->discovery_slots_ = DISCOVERIES_PER_LOOP;
 
   if (this->disconnect_reason_.has_value()) {
     const LogString *reason_s;
@@ -357,8 +366,10 @@ void MQTTClientComponent::loop() {
         this->start_dnslookup_();
       } else {
         if (!this->birth_message_.topic.empty() && !this->sent_birth_message_) {
-          this->sent_birth_message_ = this->publish(this->birth_message_);
+          this->sent_birth_message_ =
+              this->queue_publish(MQTTMessage(this->birth_message_), MQTT_PUBLISH_PRIORITY_AVAILABILITY);
         }
+        this->drain_publish_queue_();
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
@@ -408,6 +419,12 @@ void MQTTClientComponent::resubscribe_subscriptions_() {
   }
 }
 
+void MQTTClientComponent::add_subscription_(MQTTSubscription &&subscription) {
+  this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.insert(subscription.topic, this->subscriptions_.size());
+  this->subscriptions_.push_back(std::move(subscription));
+}
+
 void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t callback, uint8_t qos) {
   MQTTSubscription subscription{
       .topic = topic,
@@ -416,8 +433,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .subscribed = false,
       .resubscribe_timeout = 0,
   };
-  this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  this->add_subscription_(std::move(subscription));
 }
 
 void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_json_callback_t &callback, uint8_t qos) {
@@ -434,8 +450,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .subscribed = false,
       .resubscribe_timeout = 0,
   };
-  this->resubscribe_subscription_(&subscription);
-  this->subscriptions_.push_back(subscription);
+  this->add_subscription_(std::move(subscription));
 }
 
 void MQTTClientComponent::unsubscribe(const std::string &topic) {
@@ -457,6 +472,78 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
       ++it;
     }
   }
+  // indices after the removed subscriptions shifted
+  this->subscription_trie_.clear();
+  for (size_t i = 0; i < this->subscriptions_.size(); i++)
+    this->subscription_trie_.insert(this->subscriptions_[i].topic, i);
+}
+
+bool MQTTClientComponent::queue_publish(MQTTMessage &&message, MQTTPublishPriority priority) {
+  if (this->publish_queue_size_ == 0)
+    return this->publish(message);
+  if (!this->is_connected())
+    return false;
+
+  auto &queue = this->publish_queue_[priority];
+  if (priority == MQTT_PUBLISH_PRIORITY_STATE) {
+    // only the newest state matters
+    for (auto &queued : queue) {
+      if (queued.topic == message.topic) {
+        queued = std::move(message);
+        return true;
+      }
+    }
+  }
+  if (this->publish_queue_depth_ == 0 && this->mqtt_backend_.publish(message)) {
+    ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(), message.payload.c_str(),
+             message.retain, message.qos);
+    return true;
+  }
+
+  if (this->publish_queue_depth_ >= this->publish_queue_size_) {
+    // make room by dropping the oldest message of a lower priority
+    int drop = -1;
+    for (int i = 0; i < priority; i++) {
+      if (!this->publish_queue_[i].empty()) {
+        drop = i;
+        break;
+      }
+    }
+    this->publish_queue_dropped_++;
+    if (drop < 0) {
+      ESP_LOGV(TAG, "Publish queue full, dropped topic='%s'", message.topic.c_str());
+      return false;
+    }
+    ESP_LOGV(TAG, "Publish queue full, dropped topic='%s'", this->publish_queue_[drop].front().topic.c_str());
+    this->publish_queue_[drop].pop_front();
+    this->publish_queue_depth_--;
+  }
+  queue.push_back(std::move(message));
+  this->publish_queue_depth_++;
+  return true;
+}
+
+void MQTTClientComponent::drain_publish_queue_() {
+  for (int i = MQTT_PUBLISH_PRIORITY_COUNT - 1; i >= 0 && this->publish_queue_depth_ != 0; i--) {
+    auto &queue = this->publish_queue_[i];
+    while (!queue.empty()) {
+      const MQTTMessage &message = queue.front();
+      if (!this->mqtt_backend_.publish(message))
+        return;  // the transport is full, try again in the next loop
+      ESP_LOGV(TAG, "Publish(topic='%s' payload='%s' retain=%d qos=%d)", message.topic.c_str(),
+               message.payload.c_str(), message.retain, message.qos);
+      queue.pop_front();
+      this->publish_queue_depth_--;
+      delay(0);
+    }
+  }
+}
+
+void MQTTClientComponent::clear_publish_queue_() {
+  // the components send their discovery and state again after reconnecting
+  for (auto &queue : this->publish_queue_)
+    queue.clear();
+  this->publish_queue_depth_ = 0;
 }
 
 // Publish
@@ -501,72 +588,22 @@ bool MQTTClientComponent::publish_json(const std::string &topic, const json::jso
   return this->publish(topic, message, qos, retain);
 }
 
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
-}
-
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
 #ifdef USE_ESP8266
   // on ESP8266, this is called in lwIP/AsyncTCP task; some components do not like running
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    auto &matched = this->matched_subscriptions_;
+    matched.clear();
+    this->subscription_trie_.match(topic, matched);
+    // call back in subscription order, like before the lookup was indexed
+    std::sort(matched.begin(), matched.end());
+    matched.erase(std::unique(matched.begin(), matched.end()), matched.end());
+    for (size_t i = 0; i < matched.size(); i++) {
+      // a callback may unsubscribe
+      if (matched[i] < this->subscriptions_.size())
+        this->subscriptions_[matched[i]].callback(topic, payload);
     }
 #ifdef USE_ESP8266
   });
@@ -594,6 +631,23 @@ void MQTTClientComponent::disable_shutdown_message() {
 }
 bool MQTTClientComponent::is_discovery_enabled() const { return !this->discovery_info_.prefix.empty(); }
 bool MQTTClientComponent::is_discovery_ip_enabled() const { return this->discovery_info_.discover_ip; }
+MQTTComponent *MQTTClientComponent::get_device_info_component() {
+  if (this->device_info_component_ == nullptr) {
+    for (MQTTComponent *component : this->children_) {
+      if (component->is_discovery_enabled()) {
+        this->device_info_component_ = component;
+        break;
+      }
+    }
+  }
+  return this->device_info_component_;
+}
+bool MQTTClientComponent::reserve_discovery_slot() {
+  if (this->discovery_slots_ == 0)
+    return false;
+  this->discovery_slots_--;
+  return true;
+}
 const Availability &MQTTClientComponent::get_availability() { return this->availability_; }
 void MQTTClientComponent::recalculate_availability_() {
   if (this->birth_message_.topic.empty() || this->birth_message_.topic != this->last_will_.topic) {
@@ -638,6 +692,7 @@ void MQTTClientComponent::disable_discovery() {
       .clean = false,
       .unique_id_generator = MQTT_LEGACY_UNIQUE_ID_GENERATOR,
       .object_id_generator = MQTT_NONE_OBJECT_ID_GENERATOR,
+      .shared_device = false,
   };
 }
 void MQTTClientComponent::on_shutdown() {
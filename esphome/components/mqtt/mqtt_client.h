@@ -16,8 +16,10 @@
 #elif defined(USE_LIBRETINY)
 #include "mqtt_backend_libretiny.h"
 #endif
+#include "mqtt_topic_trie.h"
 #include "lwip/ip_addr.h"
 
+#include <deque>
 #include <vector>
 
 namespace esphome {
@@ -35,6 +37,14 @@ using mqtt_on_disconnect_callback_t = std::function<MQTTBackend::on_disconnect_c
 using mqtt_callback_t = std::function<void(const std::string &, const std::string &)>;
 using mqtt_json_callback_t = std::function<void(const std::string &, JsonObject)>;
 
+/// Priority of messages in the publish queue, higher priorities are sent first.
+enum MQTTPublishPriority : uint8_t {
+  MQTT_PUBLISH_PRIORITY_STATE = 0,
+  MQTT_PUBLISH_PRIORITY_AVAILABILITY,
+  MQTT_PUBLISH_PRIORITY_DISCOVERY,
+  MQTT_PUBLISH_PRIORITY_COUNT,
+};
+
 /// internal struct for MQTT subscriptions.
 struct MQTTSubscription {
   std::string topic;
@@ -84,6 +94,7 @@ struct MQTTDiscoveryInfo {
   bool clean;
   MQTTDiscoveryUniqueIdGenerator unique_id_generator;
   MQTTDiscoveryObjectIdGenerator object_id_generator;
+  bool shared_device;  ///< Send the full device block only with the first component.
 };
 
 enum MQTTClientState {
@@ -128,6 +139,18 @@ class MQTTClientComponent : public Component {
                           bool clean = false);
   /// Get Home Assistant discovery info.
   const MQTTDiscoveryInfo &get_discovery_info() const;
+  /** Only include the full device block in the discovery of one component.
+   *
+   * Home Assistant merges the device info of all entities with the same identifiers, the other components only send
+   * the identifiers.
+   */
+  void set_discovery_shared_device(bool shared_device) { this->discovery_info_.shared_device = shared_device; }
+  /// The component whose discovery carries the full device block when the device block is shared.
+  MQTTComponent *get_device_info_component();
+  /// Components ask before sending discovery, this spreads the discovery of all components over several loops.
+  bool reserve_discovery_slot();
+  /// Whether the broker kept the session (and with it the retained messages) of the last connection.
+  bool is_session_present() const { return this->session_present_; }
   /// Globally disable Home Assistant discovery.
   void disable_discovery();
   bool is_discovery_enabled() const;
@@ -177,7 +200,7 @@ class MQTTClientComponent : public Component {
 
   /** Subscribe to an MQTT topic and call callback when a message is received.
    *
-   * @param topic The topic. Wildcards are currently not supported.
+   * @param topic The topic, may contain the '+' and '#' wildcards.
    * @param callback The callback function.
    * @param qos The QoS of this subscription.
    */
@@ -187,7 +210,7 @@ class MQTTClientComponent : public Component {
    *
    * If an invalid JSON payload is received, the callback will not be called.
    *
-   * @param topic The topic. Wildcards are currently not supported.
+   * @param topic The topic, may contain the '+' and '#' wildcards.
    * @param callback The callback with a parsed JsonObject that will be called when a message with matching topic is
    * received.
    * @param qos The QoS of this subscription.
@@ -220,6 +243,23 @@ class MQTTClientComponent : public Component {
   bool publish(const std::string &topic, const char *payload, size_t payload_length, uint8_t qos = 0,
                bool retain = false);
 
+  /** Publish a message through the publish queue.
+   *
+   * Without a publish queue this is the same as publish(). With one, the message is sent right away only if nothing
+   * is queued and the transport takes it; otherwise it waits in the queue, which loop() drains as fast as the
+   * transport accepts messages. A queued state message is replaced by a newer one for the same topic.
+   *
+   * @return false if not connected or the message was dropped because the queue is full, the caller should retry
+   * later like for a failed publish().
+   */
+  bool queue_publish(MQTTMessage &&message, MQTTPublishPriority priority);
+
+  /// Maximum number of queued messages, 0 disables the publish queue.
+  void set_publish_queue_size(size_t size) { this->publish_queue_size_ = size; }
+  size_t get_publish_queue_depth() const { return this->publish_queue_depth_; }
+  /// Number of messages dropped because the publish queue was full.
+  uint32_t get_publish_queue_dropped() const { return this->publish_queue_dropped_; }
+
   /** Construct and send a JSON MQTT message.
    *
    * @param topic The topic.
@@ -278,6 +318,10 @@ class MQTTClientComponent : public Component {
   bool subscribe_(const char *topic, uint8_t qos);
   void resubscribe_subscription_(MQTTSubscription *sub);
   void resubscribe_subscriptions_();
+  void add_subscription_(MQTTSubscription &&subscription);
+  /// Send queued messages until the queue is empty or the transport stops accepting them.
+  void drain_publish_queue_();
+  void clear_publish_queue_();
 
   MQTTCredentials credentials_;
   /// The last will message. Disabled optional denotes it being default and
@@ -299,6 +343,7 @@ class MQTTClientComponent : public Component {
       .clean = false,
       .unique_id_generator = MQTT_LEGACY_UNIQUE_ID_GENERATOR,
       .object_id_generator = MQTT_NONE_OBJECT_ID_GENERATOR,
+      .shared_device = false,
   };
   std::string topic_prefix_{};
   MQTTMessage log_message_;
@@ -306,6 +351,16 @@ class MQTTClientComponent : public Component {
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Indices into subscriptions_ by topic filter
+  MQTTTopicTrie subscription_trie_;
+  std::vector<size_t> matched_subscriptions_;
+  MQTTComponent *device_info_component_{nullptr};
+  uint8_t discovery_slots_{0};
+  bool session_present_{false};
+  std::deque<MQTTMessage> publish_queue_[MQTT_PUBLISH_PRIORITY_COUNT];
+  size_t publish_queue_size_{0};
+  size_t publish_queue_depth_{0};
+  uint32_t publish_queue_dropped_{0};
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
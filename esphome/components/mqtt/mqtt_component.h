@@ -206,6 +206,8 @@ class MQTTComponent : public Component {
   uint8_t qos_{0};
   bool discovery_enabled_{true};
   bool resend_state_{false};
+  /// Hash of the last discovery payload sent, 0 if none
+  uint32_t discovery_hash_{0};
 };
 
 }  // namespace mqtt
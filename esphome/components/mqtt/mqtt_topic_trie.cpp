@@ -0,0 +1,66 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+namespace esphome {
+namespace mqtt {
+
+void MQTTTopicTrie::insert(const std::string &filter, size_t value) {
+  Node *node = &this->root_;
+  size_t start = 0;
+  while (true) {
+    size_t end = filter.find('/', start);
+    auto &child = node->children[filter.substr(start, end - start)];
+    if (!child)
+      child = std::make_unique<Node>();
+    node = child.get();
+    if (end == std::string::npos)
+      break;
+    start = end + 1;
+  }
+  node->values.push_back(value);
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<size_t> &out) const {
+  std::string level;
+  this->match_(this->root_, topic, 0, topic.empty() || topic[0] != '$', level, out);
+}
+
+void MQTTTopicTrie::match_(const Node &node, const std::string &topic, size_t start, bool wildcards,
+                           std::string &level, std::vector<size_t> &out) const {
+  if (node.children.empty())
+    return;
+  if (wildcards) {
+    auto multi = node.children.find("#");
+    if (multi != node.children.end())
+      out.insert(out.end(), multi->second->values.begin(), multi->second->values.end());
+  }
+  if (start == std::string::npos)
+    return;
+
+  size_t end = topic.find('/', start);
+  size_t next = end == std::string::npos ? std::string::npos : end + 1;
+  const Node *single = nullptr;
+  if (wildcards) {
+    auto it = node.children.find("+");
+    if (it != node.children.end())
+      single = it->second.get();
+  }
+  level.assign(topic, start, end == std::string::npos ? std::string::npos : end - start);
+  auto exact = node.children.find(level);
+  if (exact != node.children.end()) {
+    if (next == std::string::npos)
+      out.insert(out.end(), exact->second->values.begin(), exact->second->values.end());
+    this->match_(*exact->second, topic, next, true, level, out);
+  }
+  if (single != nullptr) {
+    if (next == std::string::npos)
+      out.insert(out.end(), single->values.begin(), single->values.end());
+    this->match_(*single, topic, next, true, level, out);
+  }
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
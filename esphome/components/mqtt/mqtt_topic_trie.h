@@ -0,0 +1,47 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Index of subscription topic filters, split at the '/' level separators.
+ *
+ * Looking up the filters matching a topic walks one branch per topic level (plus the '+' and '#' branches), instead
+ * of comparing the topic with every filter. Wildcards follow the MQTT spec: '+' matches one level, '#' matches any
+ * number of levels including the parent level, and neither matches a first level starting with '$'.
+ */
+class MQTTTopicTrie {
+ public:
+  /// Add a topic filter, value is reported by match() for matching topics.
+  void insert(const std::string &filter, size_t value);
+  void clear() { this->root_ = Node{}; }
+
+  /// Append the values of all filters matching topic to out (in no particular order).
+  void match(const std::string &topic, std::vector<size_t> &out) const;
+
+ protected:
+  struct Node {
+    std::map<std::string, std::unique_ptr<Node>> children;
+    /// Values of the filters ending at this node
+    std::vector<size_t> values;
+  };
+
+  void match_(const Node &node, const std::string &topic, size_t start, bool wildcards, std::string &level,
+              std::vector<size_t> &out) const;
+
+  Node root_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -24,6 +24,7 @@ from .base_component import (
     CONF_AUTO_WAKE_ON_TOUCH,
     CONF_EXIT_REPARSE_ON_START,
     CONF_SKIP_CONNECTION_HANDSHAKE,
+    CONF_SKIP_UNCHANGED_VALUES,
 )
 
 CODEOWNERS = ["@senexcrenshaw", "@edwardtfn"]
@@ -74,6 +75,7 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_AUTO_WAKE_ON_TOUCH, default=True): cv.boolean,
             cv.Optional(CONF_EXIT_REPARSE_ON_START, default=False): cv.boolean,
             cv.Optional(CONF_SKIP_CONNECTION_HANDSHAKE, default=False): cv.boolean,
+            cv.Optional(CONF_SKIP_UNCHANGED_VALUES, default=False): cv.boolean,
         }
     )
     .extend(cv.polling_component_schema("5s"))
@@ -122,6 +124,8 @@ async def to_code(config):
 
     cg.add(var.set_skip_connection_handshake(config[CONF_SKIP_CONNECTION_HANDSHAKE]))
 
+    cg.add(var.set_skip_unchanged_values(config[CONF_SKIP_UNCHANGED_VALUES]))
+
     await display.register_display(var, config)
 
     for conf in config.get(CONF_ON_SETUP, []):
@@ -2,6 +2,7 @@
 #include "esphome/core/util.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
 #include <cinttypes>
 
 namespace esphome {
@@ -132,6 +133,7 @@ void Nextion::reset_(bool reset_nextion) {
   };
   this->nextion_queue_.clear();
   this->waveform_queue_.clear();
+  this->sent_values_.clear();
 }
 
 void Nextion::dump_config() {
@@ -146,6 +148,7 @@ void Nextion::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "  Wake On Touch:    %s", YESNO(this->auto_wake_on_touch_));
   ESP_LOGCONFIG(TAG, "  Exit reparse:     %s", YESNO(this->exit_reparse_on_start_));
+  ESP_LOGCONFIG(TAG, "  Skip unchanged:   %s", YESNO(this->skip_unchanged_values_));
 
   if (this->touch_sleep_timeout_ != 0) {
     ESP_LOGCONFIG(TAG, "  Touch Timeout:    %" PRIu32, this->touch_sleep_timeout_);
@@ -359,6 +362,9 @@ void Nextion::process_nextion_commands_() {
     }
 
     this->nextion_event_ = this->command_data_[0];
+    // Anything the display initiates, like touches, page changes or waking up, may have changed attributes
+    if (this->nextion_event_ >= 0x65 && this->nextion_event_ != 0x70 && this->nextion_event_ != 0x71)
+      this->sent_values_.clear();
 
     to_process_length -= 1;
     to_process = this->command_data_.substr(1, to_process_length);
@@ -992,11 +998,36 @@ void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_n
   if ((!this->is_setup() && !this->ignore_is_setup_) || command.empty())
     return;
 
+  if (this->skip_unchanged_values_) {
+    if (this->is_unchanged_value_(command)) {
+      ESP_LOGN(TAG, "Skipping unchanged %s", command.c_str());
+      return;
+    }
+    // The components of the new page start out with the values of the HMI file
+    if (command.compare(0, 5, "page ") == 0)
+      this->sent_values_.clear();
+  }
+
   if (this->send_command_(command)) {
     this->add_no_result_to_queue_(variable_name);
   }
 }
 
+bool Nextion::is_unchanged_value_(const std::string &command) {
+  // Only attributes of components like "t0.txt" are tracked, global variables may be changed by the HMI code any time
+  const size_t assignment = command.find('=');
+  if (assignment == std::string::npos || command.find('.') > assignment)
+    return false;
+
+  const uint32_t attribute = fnv1_hash(command.substr(0, assignment));
+  const uint32_t value = fnv1_hash(command.substr(assignment + 1));
+  auto it = this->sent_values_.find(attribute);
+  if (it != this->sent_values_.end() && it->second == value)
+    return true;
+  this->sent_values_[attribute] = value;
+  return false;
+}
+
 bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format,
                                                                ...) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
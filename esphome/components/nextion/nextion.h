@@ -1,6 +1,7 @@
 #pragma once
 
 #include <deque>
+#include <map>
 #include <vector>
 
 #include "esphome/core/defines.h"
@@ -941,6 +942,19 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    */
   void set_skip_connection_handshake(bool skip_handshake) { this->skip_connection_handshake_ = skip_handshake; }
 
+  /**
+   * Sets whether writes of component attributes that would not change them are skipped.
+   * @param skip_unchanged True or false. When skip_unchanged_values is true, a command like `t0.txt="abc"` is not
+   * sent again while the attribute still has the value last written. Touches, page changes and wake ups from the
+   * display make every attribute count as changed again, since the display may have changed them itself.
+   *
+   * Example:
+   * ```cpp
+   * it.set_skip_unchanged_values(true);
+   * ```
+   */
+  void set_skip_unchanged_values(bool skip_unchanged) { this->skip_unchanged_values_ = skip_unchanged; }
+
   /**
    * Sets Nextion mode between sleep and awake
    * @param True or false. Sleep=true to enter sleep mode or sleep=false to exit sleep mode.
@@ -1237,6 +1251,12 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   bool auto_wake_on_touch_ = true;
   bool exit_reparse_on_start_ = false;
   bool skip_connection_handshake_ = false;
+  bool skip_unchanged_values_ = false;
+  /// Hashes of the values last written, by the hash of the component attribute
+  std::map<uint32_t, uint32_t> sent_values_;
+
+  /// Whether the command writes the value a component attribute already has, records the value otherwise.
+  bool is_unchanged_value_(const std::string &command);
 
   /**
    * Manually send a raw command to the display and don't wait for an acknowledgement packet.
@@ -31,16 +31,13 @@ void OneWireBus::search() {
   this->reset_search();
   uint64_t address;
   while (true) {
-    {
-      InterruptLock lock;
-      if (!this->reset()) {
-        // Reset failed or no devices present
-        return;
-      }
-
-      this->write8(ONE_WIRE_ROM_SEARCH);
-      address = this->search_int();
+    if (!this->reset()) {
+      // Reset failed or no devices present
+      return;
     }
+
+    this->write8(ONE_WIRE_ROM_SEARCH);
+    address = this->search_int();
     if (address == 0)
       break;
     auto *address8 = reinterpret_cast<uint8_t *>(&address);
@@ -56,6 +53,20 @@ void OneWireBus::skip() {
   this->write8(0xCC);  // skip ROM
 }
 
+bool OneWireBus::broadcast(uint8_t cmd, uint32_t window_ms) {
+  const uint32_t now = millis();
+  if (this->broadcast_sent_ && this->last_broadcast_command_ == cmd && now - this->last_broadcast_time_ < window_ms)
+    return true;
+  if (!this->reset())
+    return false;
+  this->skip();
+  this->write8(cmd);
+  this->broadcast_sent_ = true;
+  this->last_broadcast_command_ = cmd;
+  this->last_broadcast_time_ = now;
+  return true;
+}
+
 const LogString *OneWireBus::get_model_str(uint8_t model) {
   switch (model) {
     case DALLAS_MODEL_DS18S20:
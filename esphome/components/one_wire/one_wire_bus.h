@@ -7,6 +7,11 @@
 namespace esphome {
 namespace one_wire {
 
+/** Base class for the 1-Wire bus implementations.
+ *
+ * The implementations take care of the timing of every reset and bit time slot themselves, the bus is idle between
+ * the slots. Callers therefore don't need to disable interrupts around longer transactions.
+ */
 class OneWireBus {
  public:
   /** Reset the bus, should be done before all write operations.
@@ -26,6 +31,14 @@ class OneWireBus {
   /// Write a command to the bus that addresses all devices by skipping the ROM.
   void skip();
 
+  /** Send a command to all devices by skipping the ROM, unless it was already broadcast in the last window_ms.
+   *
+   * Lets the devices share one bus-wide operation, like a temperature conversion, instead of addressing each of them.
+   *
+   * @return Whether the command was sent now or within the window.
+   */
+  bool broadcast(uint8_t cmd, uint32_t window_ms);
+
   /// Read an 8 bit word from the bus.
   virtual uint8_t read8() = 0;
 
@@ -46,6 +59,9 @@ class OneWireBus {
 
  protected:
   std::vector<uint64_t> devices_;
+  uint32_t last_broadcast_time_{0};
+  uint8_t last_broadcast_command_{0};
+  bool broadcast_sent_{false};
 
   /// log the found devices
   void dump_devices_(const char *tag);
@@ -35,9 +35,13 @@ online_image_ns = cg.esphome_ns.namespace("online_image")
 
 ImageFormat = online_image_ns.enum("ImageFormat")
 
+FORMAT_JPEG = "JPEG"
 FORMAT_PNG = "PNG"
 
-IMAGE_FORMAT = {FORMAT_PNG: ImageFormat.PNG}  # Add new supported formats here
+IMAGE_FORMAT = {
+    FORMAT_JPEG: ImageFormat.JPEG,
+    FORMAT_PNG: ImageFormat.PNG,
+}  # Add new supported formats here
 
 OnlineImage = online_image_ns.class_("OnlineImage", cg.PollingComponent, Image_)
 
@@ -135,6 +139,9 @@ async def to_code(config):
     if format in [FORMAT_PNG]:
         cg.add_define("USE_ONLINE_IMAGE_PNG_SUPPORT")
         cg.add_library("pngle", "1.0.2")
+    if format in [FORMAT_JPEG]:
+        cg.add_define("USE_ONLINE_IMAGE_JPEG_SUPPORT")
+        cg.add_library("bitbank2/JPEGDEC", "1.6.2")
 
     url = config[CONF_URL]
     width, height = config.get(CONF_RESIZE, (0, 0))
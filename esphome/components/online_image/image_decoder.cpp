@@ -10,15 +10,28 @@ static const char *const TAG = "online_image.decoder";
 
 void ImageDecoder::set_size(int width, int height) {
   this->image_->resize_(width, height);
-  this->x_scale_ = static_cast<double>(this->image_->buffer_width_) / width;
-  this->y_scale_ = static_cast<double>(this->image_->buffer_height_) / height;
+  this->source_width_ = std::max(width, 1);
+  this->source_height_ = std::max(height, 1);
+  this->buffer_width_ = this->image_->buffer_width_;
+  this->buffer_height_ = this->image_->buffer_height_;
+}
+
+size_t ImageDecoder::resize_download_buffer(size_t size) { return this->image_->resize_download_buffer_(size); }
+
+/// First buffer coordinate covered by the source coordinate, rounded up so that neighbouring ranges don't overlap.
+static int scale_coordinate(int value, int buffer_size, int source_size) {
+  return static_cast<int>((static_cast<int64_t>(value) * buffer_size + source_size - 1) / source_size);
 }
 
 void ImageDecoder::draw(int x, int y, int w, int h, const Color &color) {
-  auto width = std::min(this->image_->buffer_width_, static_cast<int>(std::ceil((x + w) * this->x_scale_)));
-  auto height = std::min(this->image_->buffer_height_, static_cast<int>(std::ceil((y + h) * this->y_scale_)));
-  for (int i = x * this->x_scale_; i < width; i++) {
-    for (int j = y * this->y_scale_; j < height; j++) {
+  int buffer_width = this->image_->buffer_width_;
+  int buffer_height = this->image_->buffer_height_;
+  int x_start = scale_coordinate(x, buffer_width, this->source_width_);
+  int x_end = std::min(buffer_width, scale_coordinate(x + w, buffer_width, this->source_width_));
+  int y_start = scale_coordinate(y, buffer_height, this->source_height_);
+  int y_end = std::min(buffer_height, scale_coordinate(y + h, buffer_height, this->source_height_));
+  for (int j = y_start; j < y_end; j++) {
+    for (int i = x_start; i < x_end; i++) {
       this->image_->draw_pixel_(i, j, color);
     }
   }
@@ -32,6 +45,19 @@ uint8_t *DownloadBuffer::data(size_t offset) {
   return this->buffer_ + offset;
 }
 
+size_t DownloadBuffer::resize(size_t size) {
+  if (size <= this->size_)
+    return this->size_;
+  uint8_t *buffer = this->allocator_.allocate(size);
+  if (buffer == nullptr)
+    return this->size_;
+  memcpy(buffer, this->buffer_, this->unread_);
+  this->allocator_.deallocate(this->buffer_, this->size_);
+  this->buffer_ = buffer;
+  this->size_ = size;
+  return size;
+}
+
 size_t DownloadBuffer::read(size_t len) {
   this->unread_ -= len;
   if (this->unread_ > 0) {
@@ -49,10 +49,20 @@ class ImageDecoder {
    */
   void set_size(int width, int height);
 
+  /**
+   * @brief Grow the download buffer, for formats that can only be decoded once the whole file is downloaded.
+   *
+   * @param size The number of bytes the buffer needs to hold.
+   * @return size_t The resulting buffer size, smaller than size if the allocation failed.
+   */
+  size_t resize_download_buffer(size_t size);
+
   /**
    * @brief Draw a rectangle on the display_buffer using the defined color.
    * Will check the given coordinates for out-of-bounds, and clip the rectangle accordingly.
    * In case of binary displays, the color will be converted to binary as well.
+   * When the image is scaled, every buffer pixel is written by exactly one source pixel, so a downscaled image
+   * skips most decoded pixels instead of overwriting the same buffer pixel several times.
    * Called by the callback functions, to be able to access the parent Image class.
    *
    * @param x The left-most coordinate of the rectangle.
@@ -71,8 +81,12 @@ class ImageDecoder {
   // Will be overwritten anyway once the download size is known.
   uint32_t download_size_ = 1;
   uint32_t decoded_bytes_ = 0;
-  double x_scale_ = 1.0;
-  double y_scale_ = 1.0;
+  /// Size of the decoded image, the buffer may be scaled to a different size
+  int source_width_ = 1;
+  int source_height_ = 1;
+  /// Size of the image buffer, known after set_size()
+  int buffer_width_ = 0;
+  int buffer_height_ = 0;
 };
 
 class DownloadBuffer {
@@ -100,6 +114,14 @@ class DownloadBuffer {
 
   void reset() { this->unread_ = 0; }
 
+  /**
+   * @brief Grow the buffer, keeping its unread content.
+   *
+   * @param size The new size of the buffer.
+   * @return size_t The resulting size, which stays the old size if the allocation failed.
+   */
+  size_t resize(size_t size);
+
  protected:
   ExternalRAMAllocator<uint8_t> allocator_;
   uint8_t *buffer_;
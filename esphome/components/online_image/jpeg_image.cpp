@@ -0,0 +1,82 @@
+#include "jpeg_image.h"
+#ifdef USE_ONLINE_IMAGE_JPEG_SUPPORT
+
+#include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+static const char *const TAG = "online_image.jpeg";
+
+namespace esphome {
+namespace online_image {
+
+/**
+ * @brief Callback method that will be called by the JPEGDEC engine when a block of MCUs is decoded.
+ *
+ * @param jpeg The decoded block, including the context data.
+ * @return int 1 to continue decoding.
+ */
+static int draw_callback(JPEGDRAW *jpeg) {
+  auto *decoder = (ImageDecoder *) jpeg->pUser;
+  // large images take a while, one block is short enough to feed the watchdog for
+  App.feed_wdt();
+  const uint16_t *pixels = jpeg->pPixels;
+  for (int y = 0; y < jpeg->iHeight; y++) {
+    for (int x = 0; x < jpeg->iWidth; x++) {
+      uint16_t value = *pixels++;
+      Color color((value >> 8) & 0xF8, (value >> 3) & 0xFC, (value << 3) & 0xF8, 0xFF);
+      decoder->draw(jpeg->x + x, jpeg->y + y, 1, 1, color);
+    }
+  }
+  return 1;
+}
+
+void JpegDecoder::prepare(uint32_t download_size) {
+  ImageDecoder::prepare(download_size);
+  this->buffer_too_small_ = this->resize_download_buffer(download_size) < download_size;
+  if (this->buffer_too_small_)
+    ESP_LOGE(TAG, "Could not allocate a download buffer for the whole image (%" PRIu32 " bytes)", download_size);
+}
+
+int HOT JpegDecoder::decode(uint8_t *buffer, size_t size) {
+  if (this->buffer_too_small_)
+    return -1;
+  if (size < this->download_size_) {
+    ESP_LOGV(TAG, "Waiting for the whole image: %zu/%" PRIu32, size, this->download_size_);
+    return 0;
+  }
+  if (!this->jpeg_.openRAM(buffer, size, draw_callback)) {
+    ESP_LOGE(TAG, "Could not open image for decoding: %d", this->jpeg_.getLastError());
+    return -1;
+  }
+  if (this->jpeg_.getJPEGType() == JPEG_MODE_PROGRESSIVE) {
+    ESP_LOGE(TAG, "Progressive JPEG images are not supported");
+    return -1;
+  }
+  int width = this->jpeg_.getWidth();
+  int height = this->jpeg_.getHeight();
+  ESP_LOGD(TAG, "Image size: %d x %d, bpp: %d", width, height, this->jpeg_.getBpp());
+  this->set_size(width, height);
+  // let the decoder skip detail that would be scaled away anyway
+  int scale = 1;
+  while (scale < 8 && width / (scale * 2) >= this->buffer_width_ && height / (scale * 2) >= this->buffer_height_)
+    scale *= 2;
+  this->source_width_ = std::max((width + scale - 1) / scale, 1);
+  this->source_height_ = std::max((height + scale - 1) / scale, 1);
+  int options = scale == 8 ? JPEG_SCALE_EIGHTH : scale == 4 ? JPEG_SCALE_QUARTER : scale == 2 ? JPEG_SCALE_HALF : 0;
+  this->jpeg_.setUserPointer(this);
+  this->jpeg_.setPixelType(RGB565_LITTLE_ENDIAN);
+  if (!this->jpeg_.decode(0, 0, options)) {
+    ESP_LOGE(TAG, "Error decoding image: %d", this->jpeg_.getLastError());
+    this->jpeg_.close();
+    return -1;
+  }
+  this->jpeg_.close();
+  this->decoded_bytes_ = size;
+  return size;
+}
+
+}  // namespace online_image
+}  // namespace esphome
+
+#endif  // USE_ONLINE_IMAGE_JPEG_SUPPORT
@@ -23,7 +23,7 @@ using t_http_codes = enum {
 enum ImageFormat {
   /** Automatically detect from MIME type. Not supported yet. */
   AUTO,
-  /** JPEG format. Not supported yet. */
+  /** JPEG format. */
   JPEG,
   /** PNG format. */
   PNG,
@@ -98,6 +98,9 @@ class OnlineImage : public PollingComponent,
 
   bool resize_(int width, int height);
 
+  /// Some decoders need the whole file in memory, grow the download buffer for them.
+  size_t resize_download_buffer_(size_t size) { return this->download_buffer_.resize(size); }
+
   /**
    * @brief Draw a pixel into the buffer.
    *
@@ -152,6 +155,7 @@ class OnlineImage : public PollingComponent,
 
   friend void ImageDecoder::set_size(int width, int height);
   friend void ImageDecoder::draw(int x, int y, int w, int h, const Color &color);
+  friend size_t ImageDecoder::resize_download_buffer(size_t size);
 };
 
 template<typename... Ts> class OnlineImageSetUrlAction : public Action<Ts...> {
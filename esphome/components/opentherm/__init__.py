@@ -3,6 +3,7 @@ from typing import Any
 from esphome import pins
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome.components import esp32_rmt
 from esphome.const import CONF_ID, PLATFORM_ESP32, PLATFORM_ESP8266
 
 CODEOWNERS = ["@olegtarasov"]
@@ -16,6 +17,8 @@ CONF_COOLING_ENABLE = "cooling_enable"
 CONF_OTC_ACTIVE = "otc_active"
 CONF_CH2_ACTIVE = "ch2_active"
 CONF_SYNC_MODE = "sync_mode"
+CONF_RMT_TX_CHANNEL = "rmt_tx_channel"
+CONF_RMT_RX_CHANNEL = "rmt_rx_channel"
 
 opentherm_ns = cg.esphome_ns.namespace("opentherm")
 OpenthermHub = opentherm_ns.class_("OpenthermHub", cg.Component)
@@ -32,8 +35,12 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_OTC_ACTIVE, False): cv.boolean,
             cv.Optional(CONF_CH2_ACTIVE, False): cv.boolean,
             cv.Optional(CONF_SYNC_MODE, False): cv.boolean,
+            # Hardware-timed frames on the ESP32
+            cv.Optional(CONF_RMT_TX_CHANNEL): esp32_rmt.validate_rmt_channel(tx=True),
+            cv.Optional(CONF_RMT_RX_CHANNEL): esp32_rmt.validate_rmt_channel(tx=False),
         }
     ).extend(cv.COMPONENT_SCHEMA),
+    cv.has_none_or_all_keys(CONF_RMT_TX_CHANNEL, CONF_RMT_RX_CHANNEL),
     cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266]),
 )
 
@@ -51,7 +58,17 @@ async def to_code(config: dict[str, Any]) -> None:
     out_pin = await cg.gpio_pin_expression(config[CONF_OUT_PIN])
     cg.add(var.set_out_pin(out_pin))
 
-    non_sensors = {CONF_ID, CONF_IN_PIN, CONF_OUT_PIN}
+    if CONF_RMT_TX_CHANNEL in config:
+        cg.add(var.set_rmt_tx_channel(config[CONF_RMT_TX_CHANNEL]))
+        cg.add(var.set_rmt_rx_channel(config[CONF_RMT_RX_CHANNEL]))
+
+    non_sensors = {
+        CONF_ID,
+        CONF_IN_PIN,
+        CONF_OUT_PIN,
+        CONF_RMT_TX_CHANNEL,
+        CONF_RMT_RX_CHANNEL,
+    }
     for key, value in config.items():
         if key not in non_sensors:
             cg.add(getattr(var, f"set_{key}")(value))
@@ -56,6 +56,10 @@ void OpenthermHub::process_response(OpenthermData &data) {
 void OpenthermHub::setup() {
   ESP_LOGD(TAG, "Setting up OpenTherm component");
   this->opentherm_ = make_unique<OpenTherm>(this->in_pin_, this->out_pin_);
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->rmt_tx_channel_ != RMT_CHANNEL_MAX)
+    this->opentherm_->set_rmt_channels(this->rmt_tx_channel_, this->rmt_rx_channel_);
+#endif
   if (!this->opentherm_->initialize()) {
     ESP_LOGE(TAG, "Failed to initialize OpenTherm protocol. See previous log messages for details.");
     this->mark_failed();
@@ -92,7 +96,8 @@ void OpenthermHub::loop() {
     case OperationMode::ERROR_PROTOCOL:
       if (this->last_mode_ == OperationMode::WRITE) {
         this->handle_protocol_write_error_();
-      } else if (this->last_mode_ == OperationMode::READ) {
+      } else if (this->last_mode_ == OperationMode::READ || this->last_mode_ == OperationMode::LISTEN) {
+        // The RMT backend goes straight from LISTEN to the result
         this->handle_protocol_read_error_();
       }
 
@@ -262,6 +267,11 @@ void OpenthermHub::dump_config() {
   ESP_LOGCONFIG(TAG, "OpenTherm:");
   LOG_PIN("  In: ", this->in_pin_);
   LOG_PIN("  Out: ", this->out_pin_);
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->rmt_tx_channel_ != RMT_CHANNEL_MAX) {
+    ESP_LOGCONFIG(TAG, "  RMT channels: TX %d, RX %d", this->rmt_tx_channel_, this->rmt_rx_channel_);
+  }
+#endif
   ESP_LOGCONFIG(TAG, "  Sync mode: %d", this->sync_mode_);
   ESP_LOGCONFIG(TAG, "  Initial requests:");
   for (auto type : this->initial_messages_) {
@@ -20,6 +20,11 @@ class OpenthermHub : public Component {
  protected:
   // Communication pins for the OpenTherm interface
   InternalGPIOPin *in_pin_, *out_pin_;
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  // RMT channels for the hardware-timed backend, RMT_CHANNEL_MAX for the timer interrupt
+  rmt_channel_t rmt_tx_channel_{RMT_CHANNEL_MAX};
+  rmt_channel_t rmt_rx_channel_{RMT_CHANNEL_MAX};
+#endif
   // The OpenTherm interface
   std::unique_ptr<OpenTherm> opentherm_;
 
@@ -77,6 +82,10 @@ class OpenthermHub : public Component {
   // Setters for the input and output OpenTherm interface pins
   void set_in_pin(InternalGPIOPin *in_pin) { this->in_pin_ = in_pin; }
   void set_out_pin(InternalGPIOPin *out_pin) { this->out_pin_ = out_pin; }
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  void set_rmt_tx_channel(rmt_channel_t channel) { this->rmt_tx_channel_ = channel; }
+  void set_rmt_rx_channel(rmt_channel_t channel) { this->rmt_rx_channel_ = channel; }
+#endif
 
   // Add a request to the set of initial requests
   void add_initial_message(MessageId message_id) { this->initial_messages_.insert(message_id); }
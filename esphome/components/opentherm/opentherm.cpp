@@ -60,6 +60,8 @@ bool OpenTherm::initialize() {
   this->out_pin_->digital_write(true);
 
 #if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->use_rmt_)
+    return this->init_rmt_();
   return this->init_esp32_timer_();
 #else
   return true;
@@ -67,6 +69,12 @@ bool OpenTherm::initialize() {
 }
 
 void OpenTherm::listen() {
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->use_rmt_) {
+    this->listen_rmt_();
+    return;
+  }
+#endif
   this->stop_timer_();
   this->timeout_counter_ = this->device_timeout_ * 5;  // timer_ ticks at 5 ticks/ms
 
@@ -78,7 +86,10 @@ void OpenTherm::listen() {
 }
 
 void OpenTherm::send(OpenthermData &data) {
-  this->stop_timer_();
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (!this->use_rmt_)
+#endif
+    this->stop_timer_();
   this->data_ = data.type;
   this->data_ = (this->data_ << 12) | data.id;
   this->data_ = (this->data_ << 8) | data.valueHB;
@@ -91,6 +102,12 @@ void OpenTherm::send(OpenthermData &data) {
   this->bit_pos_ = 33;  // count down (33 == start bit, 32-1 data, 0 == stop bit)
   this->mode_ = OperationMode::WRITE;
 
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->use_rmt_) {
+    this->send_rmt_();
+    return;
+  }
+#endif
   this->start_write_timer_();
 }
 
@@ -120,7 +137,15 @@ bool OpenTherm::get_protocol_error(OpenThermError &error) {
 }
 
 void OpenTherm::stop() {
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  if (this->use_rmt_) {
+    this->stop_rmt_();
+  } else {
+    this->stop_timer_();
+  }
+#else
   this->stop_timer_();
+#endif
   this->mode_ = OperationMode::IDLE;
 }
 
@@ -362,6 +387,182 @@ void IRAM_ATTR OpenTherm::stop_timer_() {
   }
 }
 
+// RMT backend: 1 us ticks, every half of a manchester bit lasts 500 ticks
+
+static const uint32_t RMT_HALF_BIT = 500;
+// The RX channel ends a frame after this long without changes
+static const uint16_t RMT_IDLE_TICKS = 2000;
+static const size_t RMT_FRAME_HALVES = 68;
+
+bool OpenTherm::init_rmt_() {
+  rmt_config_t tx{};
+  tx.rmt_mode = RMT_MODE_TX;
+  tx.channel = this->rmt_tx_channel_;
+  tx.gpio_num = gpio_num_t(this->out_pin_->get_pin());
+  tx.clk_div = 80;
+  tx.mem_block_num = 1;
+  tx.tx_config.carrier_en = false;
+  tx.tx_config.loop_en = false;
+  tx.tx_config.idle_output_en = true;
+  // The line idles high, like the pin after initialize()
+  tx.tx_config.idle_level = this->out_pin_->is_inverted() ? RMT_IDLE_LEVEL_LOW : RMT_IDLE_LEVEL_HIGH;
+
+  esp_err_t result = rmt_config(&tx);
+  if (result == ESP_OK)
+    result = rmt_driver_install(this->rmt_tx_channel_, 0, 0);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to set up RMT channel %d for sending. Error: %s", this->rmt_tx_channel_,
+             esp_err_to_name(result));
+    return false;
+  }
+
+  rmt_config_t rx{};
+  rx.rmt_mode = RMT_MODE_RX;
+  rx.channel = this->rmt_rx_channel_;
+  rx.gpio_num = gpio_num_t(this->in_pin_->get_pin());
+  rx.clk_div = 80;
+  rx.mem_block_num = 1;
+  // The filter counts ticks of the source clock, 255 is about 3 us
+  rx.rx_config.filter_en = true;
+  rx.rx_config.filter_ticks_thresh = 255;
+  rx.rx_config.idle_threshold = RMT_IDLE_TICKS;
+
+  result = rmt_config(&rx);
+  if (result == ESP_OK)
+    result = rmt_driver_install(this->rmt_rx_channel_, 1024, 0);
+  if (result == ESP_OK)
+    result = rmt_get_ringbuf_handle(this->rmt_rx_channel_, &this->rmt_ringbuf_);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to set up RMT channel %d for receiving. Error: %s", this->rmt_rx_channel_,
+             esp_err_to_name(result));
+    return false;
+  }
+  return true;
+}
+
+void OpenTherm::send_rmt_() {
+  const bool inverted = this->out_pin_->is_inverted();
+  for (uint8_t i = 0; i < 34; i++) {
+    // same order as the timer interrupt: 33 == start bit, 32-1 data, 0 == stop bit
+    const uint8_t bit_pos = 33 - i;
+    const bool high = bit_pos == 33 || bit_pos == 0 || read_bit(this->data_, bit_pos - 1);
+    // low means logical 1 to protocol in the left part of the manchester encoding
+    this->rmt_items_[i].level0 = !high != inverted;
+    this->rmt_items_[i].duration0 = RMT_HALF_BIT;
+    this->rmt_items_[i].level1 = high != inverted;
+    this->rmt_items_[i].duration1 = RMT_HALF_BIT;
+  }
+  esp_err_t result = rmt_write_items(this->rmt_tx_channel_, this->rmt_items_, 34, false);
+  if (result != ESP_OK) {
+    ESP_LOGE(TAG, "Failed to start sending. Error: %s", esp_err_to_name(result));
+    this->mode_ = OperationMode::ERROR_PROTOCOL;
+    this->error_type_ = ProtocolErrorType::NO_ERROR;
+  }
+}
+
+void OpenTherm::listen_rmt_() {
+  this->stop_rmt_();
+  // Drop frames received since the last conversation
+  size_t len = 0;
+  void *item;
+  while ((item = xRingbufferReceive(this->rmt_ringbuf_, &len, 0)) != nullptr)
+    vRingbufferReturnItem(this->rmt_ringbuf_, item);
+
+  this->mode_ = OperationMode::LISTEN;
+  this->data_ = 0;
+  this->bit_pos_ = 0;
+  this->listen_start_ = millis();
+  rmt_rx_start(this->rmt_rx_channel_, true);
+}
+
+void OpenTherm::stop_rmt_() {
+  if (this->mode_ == OperationMode::WRITE)
+    rmt_tx_stop(this->rmt_tx_channel_);
+  rmt_rx_stop(this->rmt_rx_channel_);
+}
+
+void OpenTherm::poll_rmt_() {
+  if (this->mode_ == OperationMode::WRITE) {
+    if (rmt_wait_tx_done(this->rmt_tx_channel_, 0) == ESP_OK)
+      this->mode_ = OperationMode::SENT;
+  } else if (this->mode_ == OperationMode::LISTEN) {
+    size_t len = 0;
+    auto *items = (rmt_item32_t *) xRingbufferReceive(this->rmt_ringbuf_, &len, 0);
+    if (items != nullptr) {
+      rmt_rx_stop(this->rmt_rx_channel_);
+      this->decode_rmt_(items, len / sizeof(rmt_item32_t));
+      vRingbufferReturnItem(this->rmt_ringbuf_, items);
+    } else if (this->device_timeout_ >= 0 && millis() - this->listen_start_ > (uint32_t) this->device_timeout_) {
+      rmt_rx_stop(this->rmt_rx_channel_);
+      this->mode_ = OperationMode::ERROR_TIMEOUT;
+    }
+  }
+}
+
+void OpenTherm::set_protocol_error_(ProtocolErrorType error_type, uint8_t bit_pos, uint32_t duration) {
+  this->mode_ = OperationMode::ERROR_PROTOCOL;
+  this->error_type_ = error_type;
+  this->bit_pos_ = bit_pos;
+  this->capture_ = duration;
+}
+
+void OpenTherm::decode_rmt_(const rmt_item32_t *items, size_t count) {
+  // The capture starts with the rising edge of the start bit, split it into the levels of the half-bits
+  const bool inverted = this->in_pin_->is_inverted();
+  bool halves[RMT_FRAME_HALVES];
+  size_t half_count = 0;
+  for (size_t i = 0; i < count * 2 && half_count < RMT_FRAME_HALVES; i++) {
+    const uint32_t duration = i % 2 == 0 ? items[i / 2].duration0 : items[i / 2].duration1;
+    const bool level = (i % 2 == 0 ? items[i / 2].level0 : items[i / 2].level1) != inverted;
+    if (duration == 0) {
+      // The idle level after the frame, which continues the second half of the stop bit
+      halves[half_count++] = level;
+      break;
+    }
+    const uint32_t half_bits = (duration + RMT_HALF_BIT / 2) / RMT_HALF_BIT;
+    if (half_bits == 0) {
+      this->set_protocol_error_(ProtocolErrorType::NO_TRANSITION, half_count / 2, duration);
+      return;
+    }
+    if (half_bits > 2) {
+      this->set_protocol_error_(ProtocolErrorType::NO_CHANGE_TOO_LONG, half_count / 2, duration);
+      return;
+    }
+    for (uint32_t j = 0; j < half_bits && half_count < RMT_FRAME_HALVES; j++)
+      halves[half_count++] = level;
+  }
+  if (half_count < RMT_FRAME_HALVES) {
+    this->set_protocol_error_(ProtocolErrorType::INVALID_STOP_BIT, half_count / 2, 0);
+    return;
+  }
+
+  this->data_ = 0;
+  for (uint8_t bit = 0; bit < 34; bit++) {
+    const bool value = halves[bit * 2];
+    if (value == halves[bit * 2 + 1]) {
+      this->set_protocol_error_(ProtocolErrorType::NO_TRANSITION, bit, 0);
+      return;
+    }
+    if (bit == 0) {
+      // start bit
+      if (!value) {
+        this->set_protocol_error_(ProtocolErrorType::NO_TRANSITION, bit, 0);
+        return;
+      }
+    } else if (bit < BitPositions::STOP_BIT) {
+      this->data_ = (this->data_ << 1) | value;
+    } else {
+      auto stop_bit_error = this->verify_stop_bit_(value);
+      if (stop_bit_error != ProtocolErrorType::NO_ERROR) {
+        this->set_protocol_error_(stop_bit_error, bit, 0);
+        return;
+      }
+    }
+  }
+  this->bit_pos_ = BitPositions::STOP_BIT;
+  this->mode_ = OperationMode::RECEIVED;
+}
+
 #endif  // END ESP32
 
 #ifdef ESP8266
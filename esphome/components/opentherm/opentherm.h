@@ -15,6 +15,7 @@
 
 #if defined(ESP32) || defined(USE_ESP_IDF)
 #include "driver/timer.h"
+#include "driver/rmt.h"
 #endif
 
 namespace esphome {
@@ -214,7 +215,7 @@ class OpenTherm {
    *
    * @return true if data packet has been captured from line by listen() function.
    */
-  bool has_message() { return mode_ == OperationMode::RECEIVED; }
+  bool has_message() { return this->get_mode() == OperationMode::RECEIVED; }
 
   /**
    * Use this to retrive data packed captured by listen() function. Data packet is ready when has_message() function
@@ -252,7 +253,7 @@ class OpenTherm {
    *
    * @return true if data packet has been sent, false otherwise.
    */
-  bool is_sent() { return mode_ == OperationMode::SENT; }
+  bool is_sent() { return this->get_mode() == OperationMode::SENT; }
 
   /**
    * Indicates whether listinig or sending is not in progress.
@@ -260,7 +261,7 @@ class OpenTherm {
    *
    * @return true if listening nor sending is in progress.
    */
-  bool is_idle() { return mode_ == OperationMode::IDLE; }
+  bool is_idle() { return this->get_mode() == OperationMode::IDLE; }
 
   /**
    * Indicates whether last listen() or send() operation ends up with an error. Includes both timeout and
@@ -268,23 +269,48 @@ class OpenTherm {
    *
    * @return true if last listen() or send() operation ends up with an error.
    */
-  bool is_error() { return mode_ == OperationMode::ERROR_TIMEOUT || mode_ == OperationMode::ERROR_PROTOCOL; }
+  bool is_error() {
+    auto mode = this->get_mode();
+    return mode == OperationMode::ERROR_TIMEOUT || mode == OperationMode::ERROR_PROTOCOL;
+  }
 
   /**
    * Indicates whether last listen() or send() operation ends up with a *timeout* error
    * @return true if last listen() or send() operation ends up with a *timeout* error.
    */
-  bool is_timeout() { return mode_ == OperationMode::ERROR_TIMEOUT; }
+  bool is_timeout() { return this->get_mode() == OperationMode::ERROR_TIMEOUT; }
 
   /**
    * Indicates whether last listen() or send() operation ends up with a *protocol* error
    * @return true if last listen() or send() operation ends up with a *protocol* error.
    */
-  bool is_protocol_error() { return mode_ == OperationMode::ERROR_PROTOCOL; }
+  bool is_protocol_error() { return this->get_mode() == OperationMode::ERROR_PROTOCOL; }
 
-  bool is_active() { return mode_ == LISTEN || mode_ == READ || mode_ == WRITE; }
+  bool is_active() {
+    auto mode = this->get_mode();
+    return mode == LISTEN || mode == READ || mode == WRITE;
+  }
 
-  OperationMode get_mode() { return mode_; }
+  OperationMode get_mode() {
+#if defined(ESP32) || defined(USE_ESP_IDF)
+    if (this->use_rmt_)
+      this->poll_rmt_();
+#endif
+    return mode_;
+  }
+
+#if defined(ESP32) || defined(USE_ESP_IDF)
+  /**
+   * Send and receive with the RMT peripheral instead of sampling the pins in a timer interrupt. The RMT handles the
+   * wire-level timing, so interrupt latency can't corrupt the frames, and no interrupt runs for every half-bit.
+   * Must be called before initialize().
+   */
+  void set_rmt_channels(rmt_channel_t tx_channel, rmt_channel_t rx_channel) {
+    this->rmt_tx_channel_ = tx_channel;
+    this->rmt_rx_channel_ = rx_channel;
+    this->use_rmt_ = true;
+  }
+#endif
 
   std::string debug_data(OpenthermData &data);
   std::string debug_error(OpenThermError &error);
@@ -324,6 +350,23 @@ class OpenTherm {
 #if defined(ESP32) || defined(USE_ESP_IDF)
   bool init_esp32_timer_();
   void start_esp32_timer_(uint64_t alarm_value);
+
+  bool init_rmt_();
+  void send_rmt_();
+  void listen_rmt_();
+  void stop_rmt_();
+  /// Advance the mode once the RMT sent the frame, or received one.
+  void poll_rmt_();
+  void decode_rmt_(const rmt_item32_t *items, size_t count);
+  void set_protocol_error_(ProtocolErrorType error_type, uint8_t bit_pos, uint32_t duration);
+
+  bool use_rmt_{false};
+  rmt_channel_t rmt_tx_channel_{RMT_CHANNEL_0};
+  rmt_channel_t rmt_rx_channel_{RMT_CHANNEL_1};
+  RingbufHandle_t rmt_ringbuf_{nullptr};
+  /// The frame being sent, the driver reads it while sending
+  rmt_item32_t rmt_items_[34];
+  uint32_t listen_start_{0};
 #endif
 
   void stop_timer_();
@@ -17,6 +17,7 @@ std::unique_ptr<ota::OTABackend> make_ota_backend() { return make_unique<ota::Ar
 OTAResponseTypes ArduinoESP32OTABackend::begin(size_t image_size) {
   bool ret = Update.begin(image_size, U_FLASH);
   if (ret) {
+    this->size_unknown_ = image_size == UPDATE_SIZE_UNKNOWN;
     return OTA_RESPONSE_OK;
   }
 
@@ -44,7 +45,7 @@ OTAResponseTypes ArduinoESP32OTABackend::write(uint8_t *data, size_t len) {
 }
 
 OTAResponseTypes ArduinoESP32OTABackend::end() {
-  if (Update.end()) {
+  if (Update.end(this->size_unknown_)) {
     return OTA_RESPONSE_OK;
   }
 
@@ -16,6 +16,10 @@ class ArduinoESP32OTABackend : public OTABackend {
   OTAResponseTypes end() override;
   void abort() override;
   bool supports_compression() override { return false; }
+
+ protected:
+  /// Started with UPDATE_SIZE_UNKNOWN, the image ends wherever the last write() ended
+  bool size_unknown_{false};
 };
 
 }  // namespace ota
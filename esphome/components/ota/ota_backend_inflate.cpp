@@ -0,0 +1,204 @@
+#include "ota_backend_inflate.h"
+#ifdef USE_OTA_INFLATE
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <esp_rom_crc.h>
+
+#include <cinttypes>
+#include <cstring>
+#include <new>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.inflate";
+
+static const uint8_t GZIP_FLAG_HCRC = 1 << 1;
+static const uint8_t GZIP_FLAG_EXTRA = 1 << 2;
+static const uint8_t GZIP_FLAG_NAME = 1 << 3;
+static const uint8_t GZIP_FLAG_COMMENT = 1 << 4;
+/// The inflated size is only known from the trailer, both ESP32 backends then prepare the whole partition
+static const size_t IMAGE_SIZE_UNKNOWN = 0xFFFFFFFF;
+
+OTAResponseTypes InflateOTABackend::begin(size_t image_size) {
+  this->inflator_.reset(new (std::nothrow) tinfl_decompressor);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->window_.reset(new (std::nothrow) uint8_t[TINFL_LZ_DICT_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+  if (!this->inflator_ || !this->window_) {
+    ESP_LOGE(TAG, "Not enough memory to inflate the image");
+    this->release_();
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  OTAResponseTypes error = this->backend_->begin(IMAGE_SIZE_UNKNOWN);
+  if (error != OTA_RESPONSE_OK) {
+    this->release_();
+    return error;
+  }
+  tinfl_init(this->inflator_.get());
+  this->window_pos_ = 0;
+  this->state_ = State::HEADER;
+  this->field_fill_ = 0;
+  this->received_md5_.init();
+  this->image_md5_.init();
+  this->image_crc_ = 0;
+  this->image_size_ = 0;
+  return OTA_RESPONSE_OK;
+}
+
+void InflateOTABackend::set_update_md5(const char *md5) { memcpy(this->expected_md5_, md5, 32); }
+
+OTAResponseTypes InflateOTABackend::write(uint8_t *data, size_t len) {
+  this->received_md5_.add(data, len);
+  while (len > 0) {
+    if (this->state_ == State::DATA) {
+      OTAResponseTypes error = this->inflate_(data, len);
+      if (error != OTA_RESPONSE_OK)
+        return error;
+      continue;
+    }
+    if (!this->parse_(*data))
+      return OTA_RESPONSE_ERROR_MAGIC;
+    data++;
+    len--;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+bool InflateOTABackend::parse_(uint8_t byte) {
+  switch (this->state_) {
+    case State::HEADER:
+      this->field_[this->field_fill_++] = byte;
+      if (this->field_fill_ < 10)
+        return true;
+      // Deflate is the only compression method of gzip
+      if (this->field_[0] != 0x1F || this->field_[1] != 0x8B || this->field_[2] != 8) {
+        ESP_LOGE(TAG, "Not a gzip image");
+        return false;
+      }
+      this->flags_ = this->field_[3];
+      this->next_header_field_();
+      return true;
+    case State::EXTRA_LENGTH:
+      this->field_[this->field_fill_++] = byte;
+      if (this->field_fill_ < 2)
+        return true;
+      this->skip_ = encode_uint16(this->field_[1], this->field_[0]);
+      this->state_ = State::SKIP;
+      if (this->skip_ == 0)
+        this->next_header_field_();
+      return true;
+    case State::SKIP:
+      if (--this->skip_ == 0)
+        this->next_header_field_();
+      return true;
+    case State::STRING:
+      if (byte == 0)
+        this->next_header_field_();
+      return true;
+    case State::TRAILER:
+      this->field_[this->field_fill_++] = byte;
+      if (this->field_fill_ == 8)
+        this->state_ = State::DONE;
+      return true;
+    default:
+      ESP_LOGE(TAG, "Data after the end of the image");
+      return false;
+  }
+}
+
+void InflateOTABackend::next_header_field_() {
+  this->field_fill_ = 0;
+  // In the order of the fields in the header
+  if (this->flags_ & GZIP_FLAG_EXTRA) {
+    this->flags_ &= ~GZIP_FLAG_EXTRA;
+    this->state_ = State::EXTRA_LENGTH;
+  } else if (this->flags_ & GZIP_FLAG_NAME) {
+    this->flags_ &= ~GZIP_FLAG_NAME;
+    this->state_ = State::STRING;
+  } else if (this->flags_ & GZIP_FLAG_COMMENT) {
+    this->flags_ &= ~GZIP_FLAG_COMMENT;
+    this->state_ = State::STRING;
+  } else if (this->flags_ & GZIP_FLAG_HCRC) {
+    this->flags_ &= ~GZIP_FLAG_HCRC;
+    this->skip_ = 2;
+    this->state_ = State::SKIP;
+  } else {
+    this->state_ = State::DATA;
+  }
+}
+
+OTAResponseTypes InflateOTABackend::inflate_(uint8_t *&data, size_t &len) {
+  tinfl_status status;
+  do {
+    size_t in_size = len;
+    size_t out_size = TINFL_LZ_DICT_SIZE - this->window_pos_;
+    uint8_t *out = this->window_.get() + this->window_pos_;
+    status = tinfl_decompress(this->inflator_.get(), data, &in_size, this->window_.get(), out, &out_size,
+                              TINFL_FLAG_HAS_MORE_INPUT);
+    data += in_size;
+    len -= in_size;
+    if (status < TINFL_STATUS_DONE) {
+      ESP_LOGE(TAG, "Corrupt image data: %d", status);
+      return OTA_RESPONSE_ERROR_UNKNOWN;
+    }
+    if (out_size > 0) {
+      this->image_md5_.add(out, out_size);
+      this->image_crc_ = esp_rom_crc32_le(this->image_crc_, out, out_size);
+      this->image_size_ += out_size;
+      OTAResponseTypes error = this->backend_->write(out, out_size);
+      if (error != OTA_RESPONSE_OK)
+        return error;
+      this->window_pos_ = (this->window_pos_ + out_size) & (TINFL_LZ_DICT_SIZE - 1);
+    }
+    // Inflated data can be left over even once all input is consumed
+  } while (status == TINFL_STATUS_HAS_MORE_OUTPUT);
+
+  if (status == TINFL_STATUS_DONE) {
+    this->state_ = State::TRAILER;
+    this->field_fill_ = 0;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+OTAResponseTypes InflateOTABackend::end() {
+  this->received_md5_.calculate();
+  if (!this->received_md5_.equals_hex(this->expected_md5_)) {
+    this->abort();
+    return OTA_RESPONSE_ERROR_MD5_MISMATCH;
+  }
+  if (this->state_ != State::DONE) {
+    ESP_LOGE(TAG, "Image is incomplete");
+    this->abort();
+    return OTA_RESPONSE_ERROR_UPDATE_END;
+  }
+  const uint32_t crc = encode_uint32(this->field_[3], this->field_[2], this->field_[1], this->field_[0]);
+  const uint32_t size = encode_uint32(this->field_[7], this->field_[6], this->field_[5], this->field_[4]);
+  if (crc != this->image_crc_ || size != this->image_size_) {
+    ESP_LOGE(TAG, "Inflated image doesn't match the gzip trailer");
+    this->abort();
+    return OTA_RESPONSE_ERROR_UPDATE_END;
+  }
+  ESP_LOGD(TAG, "Inflated %" PRIu32 " bytes", this->image_size_);
+  this->release_();
+
+  char md5[33];
+  this->image_md5_.calculate();
+  this->image_md5_.get_hex(md5);
+  this->backend_->set_update_md5(md5);
+  return this->backend_->end();
+}
+
+void InflateOTABackend::abort() {
+  this->release_();
+  this->backend_->abort();
+}
+
+void InflateOTABackend::release_() {
+  this->inflator_.reset();
+  this->window_.reset();
+}
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,74 @@
+#pragma once
+#include "esphome/core/defines.h"
+#ifdef USE_OTA_INFLATE
+#include "ota_backend.h"
+
+#include "esphome/components/md5/md5.h"
+
+#include <memory>
+
+#include "rom/miniz.h"
+
+namespace esphome {
+namespace ota {
+
+/** Wraps a backend so that it takes gzip compressed images.
+ *
+ * The image is inflated while it is written, with the inflate implementation in the ROM of the chip. The MD5 passed
+ * to set_update_md5() is the one of the compressed image, as received. The wrapped backend verifies the inflated
+ * image against its own MD5, and end() checks the CRC and the size in the gzip trailer.
+ */
+class InflateOTABackend : public OTABackend {
+ public:
+  explicit InflateOTABackend(std::unique_ptr<OTABackend> backend) : backend_(std::move(backend)) {}
+
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override;
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return true; }
+
+ protected:
+  enum class State : uint8_t {
+    HEADER,
+    EXTRA_LENGTH,
+    SKIP,
+    STRING,
+    DATA,
+    TRAILER,
+    DONE,
+  };
+
+  /// Parse one byte of the gzip header or trailer.
+  bool parse_(uint8_t byte);
+  /// Go on with the next optional field of the header, or with the data.
+  void next_header_field_();
+  /// Inflate as much of `data` as possible, advancing `data` and `len`.
+  OTAResponseTypes inflate_(uint8_t *&data, size_t &len);
+  /// Free the buffers once the image is complete or aborted.
+  void release_();
+
+  std::unique_ptr<OTABackend> backend_;
+  std::unique_ptr<tinfl_decompressor> inflator_;
+  /// Sliding window of the inflated data, written to the backend as it fills
+  std::unique_ptr<uint8_t[]> window_;
+  size_t window_pos_{0};
+
+  State state_{State::HEADER};
+  uint8_t field_[10];
+  uint8_t field_fill_{0};
+  /// Optional header fields still to parse
+  uint8_t flags_{0};
+  uint16_t skip_{0};
+
+  md5::MD5Digest received_md5_;
+  char expected_md5_[33]{};
+  md5::MD5Digest image_md5_;
+  uint32_t image_crc_{0};
+  uint32_t image_size_{0};
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
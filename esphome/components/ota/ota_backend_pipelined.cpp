@@ -0,0 +1,127 @@
+#ifdef USE_ESP32
+#include "ota_backend_pipelined.h"
+
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace esphome {
+namespace ota {
+
+static const char *const TAG = "ota.pipelined";
+/// Longest wait for the write task, erasing a sector takes well under a second
+static const TickType_t WRITE_TIMEOUT = pdMS_TO_TICKS(5000);
+
+PipelinedOTABackend::~PipelinedOTABackend() {
+  this->stop_();
+  if (this->full_ != nullptr)
+    vQueueDelete(this->full_);
+  if (this->free_ != nullptr)
+    vQueueDelete(this->free_);
+  if (this->done_ != nullptr)
+    vSemaphoreDelete(this->done_);
+}
+
+OTAResponseTypes PipelinedOTABackend::begin(size_t image_size) {
+  OTAResponseTypes error = this->backend_->begin(image_size);
+  if (error != OTA_RESPONSE_OK)
+    return error;
+
+  for (auto &buffer : this->buffers_)
+    buffer.reset(new (std::nothrow) uint8_t[BUFFER_SIZE]);  // NOLINT(cppcoreguidelines-owning-memory)
+  this->full_ = xQueueCreate(2, sizeof(Chunk));
+  this->free_ = xQueueCreate(2, sizeof(uint8_t *));
+  this->done_ = xSemaphoreCreateBinary();
+  if (!this->buffers_[0] || !this->buffers_[1] || this->full_ == nullptr || this->free_ == nullptr ||
+      this->done_ == nullptr ||
+      xTaskCreate(PipelinedOTABackend::write_task, "ota_write", 4096, this, 2, &this->task_) != pdPASS) {
+    ESP_LOGE(TAG, "Can't start the write task");
+    this->task_ = nullptr;
+    this->backend_->abort();
+    return OTA_RESPONSE_ERROR_UNKNOWN;
+  }
+  this->current_ = this->buffers_[0].get();
+  uint8_t *spare = this->buffers_[1].get();
+  xQueueSend(this->free_, &spare, 0);
+  this->fill_ = 0;
+  this->error_ = OTA_RESPONSE_OK;
+  return OTA_RESPONSE_OK;
+}
+
+void PipelinedOTABackend::write_task(void *arg) {
+  auto *self = static_cast<PipelinedOTABackend *>(arg);
+  Chunk chunk;
+  while (xQueueReceive(self->full_, &chunk, portMAX_DELAY) == pdTRUE && chunk.data != nullptr) {
+    // after an error the rest of the image is dropped, the caller aborts
+    if (self->error_ == OTA_RESPONSE_OK)
+      self->error_ = self->backend_->write(chunk.data, chunk.len);
+    xQueueSend(self->free_, &chunk.data, portMAX_DELAY);
+  }
+  xSemaphoreGive(self->done_);
+  vTaskDelete(nullptr);
+}
+
+OTAResponseTypes PipelinedOTABackend::write(uint8_t *data, size_t len) {
+  while (len > 0) {
+    OTAResponseTypes error = this->error_;
+    if (error != OTA_RESPONSE_OK)
+      return error;
+    size_t part = std::min(len, BUFFER_SIZE - this->fill_);
+    memcpy(this->current_ + this->fill_, data, part);
+    this->fill_ += part;
+    data += part;
+    len -= part;
+    if (this->fill_ == BUFFER_SIZE) {
+      error = this->submit_();
+      if (error != OTA_RESPONSE_OK)
+        return error;
+    }
+  }
+  return this->error_;
+}
+
+OTAResponseTypes PipelinedOTABackend::submit_() {
+  Chunk chunk{this->current_, this->fill_};
+  this->current_ = nullptr;
+  this->fill_ = 0;
+  if (xQueueSend(this->full_, &chunk, WRITE_TIMEOUT) != pdTRUE ||
+      xQueueReceive(this->free_, &this->current_, WRITE_TIMEOUT) != pdTRUE) {
+    ESP_LOGE(TAG, "Timeout waiting for the flash write");
+    return OTA_RESPONSE_ERROR_WRITING_FLASH;
+  }
+  return OTA_RESPONSE_OK;
+}
+
+void PipelinedOTABackend::stop_() {
+  if (this->task_ == nullptr)
+    return;
+  Chunk stop{nullptr, 0};
+  xQueueSend(this->full_, &stop, portMAX_DELAY);
+  xSemaphoreTake(this->done_, portMAX_DELAY);
+  this->task_ = nullptr;
+}
+
+OTAResponseTypes PipelinedOTABackend::end() {
+  OTAResponseTypes error = OTA_RESPONSE_OK;
+  if (this->fill_ > 0 && this->current_ != nullptr)
+    error = this->submit_();
+  this->stop_();
+  if (error == OTA_RESPONSE_OK)
+    error = this->error_;
+  if (error != OTA_RESPONSE_OK) {
+    this->backend_->abort();
+    return error;
+  }
+  return this->backend_->end();
+}
+
+void PipelinedOTABackend::abort() {
+  this->stop_();
+  this->backend_->abort();
+}
+
+}  // namespace ota
+}  // namespace esphome
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+#ifdef USE_ESP32
+#include "ota_backend.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <memory>
+
+namespace esphome {
+namespace ota {
+
+/** Wraps a backend so that flash writes overlap with receiving the next data.
+ *
+ * write() only copies into one of two sector sized buffers. Full buffers are written (and hashed) by the wrapped
+ * backend in a separate task, while the caller goes on reading into the other buffer. Errors of the wrapped backend
+ * are returned by the next write() or by end().
+ */
+class PipelinedOTABackend : public OTABackend {
+ public:
+  explicit PipelinedOTABackend(std::unique_ptr<OTABackend> backend) : backend_(std::move(backend)) {}
+  ~PipelinedOTABackend() override;
+
+  OTAResponseTypes begin(size_t image_size) override;
+  void set_update_md5(const char *md5) override { this->backend_->set_update_md5(md5); }
+  OTAResponseTypes write(uint8_t *data, size_t len) override;
+  OTAResponseTypes end() override;
+  void abort() override;
+  bool supports_compression() override { return this->backend_->supports_compression(); }
+
+ protected:
+  static constexpr size_t BUFFER_SIZE = 4096;
+
+  struct Chunk {
+    uint8_t *data;  ///< nullptr stops the task
+    size_t len;
+  };
+
+  static void write_task(void *arg);
+  /// Hand the current buffer to the write task and wait for a free one.
+  OTAResponseTypes submit_();
+  /// Let the write task finish all queued chunks and exit.
+  void stop_();
+
+  std::unique_ptr<OTABackend> backend_;
+  std::unique_ptr<uint8_t[]> buffers_[2];
+  uint8_t *current_{nullptr};
+  size_t fill_{0};
+  QueueHandle_t full_{nullptr};
+  QueueHandle_t free_{nullptr};
+  SemaphoreHandle_t done_{nullptr};
+  TaskHandle_t task_{nullptr};
+  /// First error of the wrapped backend, written by the write task
+  std::atomic<OTAResponseTypes> error_{OTA_RESPONSE_OK};
+};
+
+}  // namespace ota
+}  // namespace esphome
+#endif
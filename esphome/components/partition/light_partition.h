@@ -24,6 +24,14 @@ class AddressableSegment {
   void set_dst_offset(int32_t dst_offset) { this->dst_offset_ = dst_offset; }
   bool is_reversed() const { return this->reversed_; }
 
+  /// Index in the source of pixel `index` of the partition.
+  int32_t get_src_index(int32_t index) const {
+    int32_t seg_off = index - this->dst_offset_;
+    if (this->reversed_)
+      return this->src_offset_ + this->size_ - seg_off - 1;
+    return this->src_offset_ + seg_off;
+  }
+
  protected:
   light::AddressableLight *src_;
   int32_t src_offset_;
@@ -40,6 +48,13 @@ class PartitionLightOutput : public light::AddressableLight {
       seg.set_dst_offset(off);
       off += seg.get_size();
     }
+    // The segment of every pixel, so a view doesn't have to search for it. One byte per pixel, larger partitions
+    // fall back to a binary search.
+    if (this->segments_.size() <= 256) {
+      this->pixel_segments_.reserve(off);
+      for (size_t i = 0; i < this->segments_.size(); i++)
+        this->pixel_segments_.insert(this->pixel_segments_.end(), this->segments_[i].get_size(), uint8_t(i));
+    }
   }
   int32_t size() const override {
     auto &last_seg = this->segments_[this->segments_.size() - 1];
@@ -52,7 +67,7 @@ class PartitionLightOutput : public light::AddressableLight {
   }
   light::LightTraits get_traits() override { return this->segments_[0].get_src()->get_traits(); }
   void write_state(light::LightState *state) override {
-    for (auto seg : this->segments_) {
+    for (auto &seg : this->segments_) {
       seg.get_src()->schedule_show();
     }
     this->mark_shown_();
@@ -60,6 +75,15 @@ class PartitionLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {
+    const AddressableSegment &seg = this->segments_[this->find_segment_(index)];
+    auto view = (*seg.get_src())[seg.get_src_index(index)];
+    view.raw_set_color_correction(&this->correction_);
+    return view;
+  }
+
+  uint32_t find_segment_(int32_t index) const {
+    if (!this->pixel_segments_.empty())
+      return this->pixel_segments_[index];
     uint32_t lo = 0;
     uint32_t hi = this->segments_.size() - 1;
     while (lo < hi) {
@@ -74,23 +98,11 @@ class PartitionLightOutput : public light::AddressableLight {
         lo = hi = mid;
       }
     }
-    auto &seg = this->segments_[lo];
-    // offset within the segment
-    int32_t seg_off = index - seg.get_dst_offset();
-    // offset within the src
-    int32_t src_off;
-    if (seg.is_reversed()) {
-      src_off = seg.get_src_offset() + seg.get_size() - seg_off - 1;
-    } else {
-      src_off = seg.get_src_offset() + seg_off;
-    }
-
-    auto view = (*seg.get_src())[src_off];
-    view.raw_set_color_correction(&this->correction_);
-    return view;
+    return lo;
   }
 
   std::vector<AddressableSegment> segments_;
+  std::vector<uint8_t> pixel_segments_;
 };
 
 }  // namespace partition
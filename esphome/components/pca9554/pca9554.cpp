@@ -33,41 +33,38 @@ void PCA9554Component::setup() {
   this->write_register_(OUTPUT_REG, this->output_mask_);
   // Read the inputs
   this->read_inputs_();
+
+  if (this->interrupt_pin_ != nullptr) {
+    // INT goes low on any input change and is released when the inputs are read
+    this->interrupt_pin_->setup();
+    this->interrupt_pin_->attach_interrupt(&PCA9554Component::gpio_intr, this, gpio::INTERRUPT_FALLING_EDGE);
+  }
   ESP_LOGD(TAG, "Initialization complete. Warning: %d, Error: %d", this->status_has_warning(),
            this->status_has_error());
 }
 
 void PCA9554Component::loop() {
-  // The read_inputs_() method will cache the input values from the chip.
-  this->read_inputs_();
-  // Clear all the previously read flags.
-  this->was_previously_read_ = 0x00;
+  // The first digital_read() after this reads all inputs once, every other pin gets the cached values
+  this->reset_pin_cache_();
+  if (this->interrupt_pin_ != nullptr) {
+    // Reading right away releases INT, the snapshot then stays valid until the next change
+    this->disable_loop();
+    this->digital_read(0);
+  }
 }
+void IRAM_ATTR PCA9554Component::gpio_intr(PCA9554Component *arg) { arg->enable_loop_soon_from_isr(); }
 
 void PCA9554Component::dump_config() {
   ESP_LOGCONFIG(TAG, "PCA9554:");
   ESP_LOGCONFIG(TAG, "  I/O Pins: %d", this->pin_count_);
   LOG_I2C_DEVICE(this)
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Communication with PCA9554 failed!");
   }
 }
 
-bool PCA9554Component::digital_read(uint8_t pin) {
-  // Note: We want to try and avoid doing any I2C bus read transactions here
-  // to conserve I2C bus bandwidth. So what we do is check to see if we
-  // have seen a read during the time esphome is running this loop. If we have,
-  // we do an I2C bus transaction to get the latest value. If we haven't
-  // we return a cached value which was read at the time loop() was called.
-  if (this->was_previously_read_ & (1 << pin))
-    this->read_inputs_();  // Force a read of a new value
-  // Indicate we saw a read request for this pin in case a
-  // read happens later in the same loop.
-  this->was_previously_read_ |= (1 << pin);
-  return this->input_mask_ & (1 << pin);
-}
-
-void PCA9554Component::digital_write(uint8_t pin, bool value) {
+void PCA9554Component::digital_write_hw(uint8_t pin, bool value) {
   if (value) {
     this->output_mask_ |= (1 << pin);
   } else {
@@ -126,8 +123,8 @@ bool PCA9554Component::write_register_(uint8_t reg, uint16_t value) {
 
 float PCA9554Component::get_setup_priority() const { return setup_priority::IO; }
 
-// Run our loop() method very early in the loop, so that we cache read values before
-// before other components call our digital_read() method.
+// Run our loop() method very early in the loop, so that the cache is reset before
+// other components call our digital_read() method.
 float PCA9554Component::get_loop_priority() const { return 9.0f; }  // Just after WIFI
 
 void PCA9554GPIOPin::setup() { pin_mode(flags_); }
@@ -2,23 +2,22 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/gpio_expander/cached_gpio.h"
 #include "esphome/components/i2c/i2c.h"
 
 namespace esphome {
 namespace pca9554 {
 
-class PCA9554Component : public Component, public i2c::I2CDevice {
+class PCA9554Component : public Component,
+                         public i2c::I2CDevice,
+                         public gpio_expander::CachedGpioExpander<uint8_t, 16> {
  public:
   PCA9554Component() = default;
 
   /// Check i2c availability and setup masks
   void setup() override;
-  /// Poll for input changes periodically
+  /// Invalidate the snapshot of the inputs
   void loop() override;
-  /// Helper function to read the value of a pin.
-  bool digital_read(uint8_t pin);
-  /// Helper function to write the value of a pin.
-  void digital_write(uint8_t pin, bool value);
   /// Helper function to set the pin mode of a pin.
   void pin_mode(uint8_t pin, gpio::Flags flags);
 
@@ -29,8 +28,16 @@ class PCA9554Component : public Component, public i2c::I2CDevice {
   void dump_config() override;
 
   void set_pin_count(size_t pin_count) { this->pin_count_ = pin_count; }
+  /// Only read the inputs after the INT output signalled a change, instead of once per loop iteration.
+  void set_interrupt_pin(InternalGPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
 
  protected:
+  static void gpio_intr(PCA9554Component *arg);
+
+  bool digital_read_hw(uint8_t pin) override { return this->read_inputs_(); }
+  bool digital_read_cache(uint8_t pin) override { return this->input_mask_ & (1 << pin); }
+  void digital_write_hw(uint8_t pin, bool value) override;
+
   bool read_inputs_();
 
   bool write_register_(uint8_t reg, uint16_t value);
@@ -45,10 +52,9 @@ class PCA9554Component : public Component, public i2c::I2CDevice {
   uint16_t output_mask_{0x00};
   /// The state of the actual input pin states - 1 means HIGH, 0 means LOW
   uint16_t input_mask_{0x00};
-  /// Flags to check if read previously during this loop
-  uint16_t was_previously_read_ = {0x00};
   /// Storage for last I2C error seen
   esphome::i2c::ErrorCode last_error_;
+  InternalGPIOPin *interrupt_pin_{nullptr};
 };
 
 /// Helper class to expose a PCA9554 pin as an internal input GPIO pin.
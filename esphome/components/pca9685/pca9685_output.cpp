@@ -100,7 +100,9 @@ void PCA9685Output::loop() {
   if (this->min_channel_ == 0xFF || !this->update_)
     return;
 
+  // All channels are written in a single transaction, the chip auto-increments the register address
   const uint16_t num_channels = this->max_channel_ - this->min_channel_ + 1;
+  uint8_t data[16 * 4];
   for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
     uint16_t phase_begin = uint16_t(channel - this->min_channel_) / num_channels * 4096;
     uint16_t phase_end;
@@ -119,17 +121,17 @@ void PCA9685Output::loop() {
     ESP_LOGVV(TAG, "Channel %02u: amount=%04u phase_begin=%04u phase_end=%04u", channel, amount, phase_begin,
               phase_end);
 
-    uint8_t data[4];
-    data[0] = phase_begin & 0xFF;
-    data[1] = (phase_begin >> 8) & 0xFF;
-    data[2] = phase_end & 0xFF;
-    data[3] = (phase_end >> 8) & 0xFF;
+    uint8_t *channel_data = &data[4 * (channel - this->min_channel_)];
+    channel_data[0] = phase_begin & 0xFF;
+    channel_data[1] = (phase_begin >> 8) & 0xFF;
+    channel_data[2] = phase_end & 0xFF;
+    channel_data[3] = (phase_end >> 8) & 0xFF;
+  }
 
-    uint8_t reg = PCA9685_REGISTER_LED0 + 4 * channel;
-    if (!this->write_bytes(reg, data, 4)) {
-      this->status_set_warning();
-      return;
-    }
+  uint8_t reg = PCA9685_REGISTER_LED0 + 4 * this->min_channel_;
+  if (!this->write_bytes(reg, data, 4 * num_channels)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
@@ -2,23 +2,26 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/gpio_expander/cached_gpio.h"
 #include "esphome/components/i2c/i2c.h"
 
 namespace esphome {
 namespace pcf8574 {
 
-class PCF8574Component : public Component, public i2c::I2CDevice {
+class PCF8574Component : public Component,
+                         public i2c::I2CDevice,
+                         public gpio_expander::CachedGpioExpander<uint8_t, 16> {
  public:
   PCF8574Component() = default;
 
   void set_pcf8575(bool pcf8575) { pcf8575_ = pcf8575; }
+  /// Only read the inputs after the INT output signalled a change, instead of once per loop iteration.
+  void set_interrupt_pin(InternalGPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
 
   /// Check i2c availability and setup masks
   void setup() override;
-  /// Helper function to read the value of a pin.
-  bool digital_read(uint8_t pin);
-  /// Helper function to write the value of a pin.
-  void digital_write(uint8_t pin, bool value);
+  /// Invalidate the snapshot of the inputs
+  void loop() override;
   /// Helper function to set the pin mode of a pin.
   void pin_mode(uint8_t pin, gpio::Flags flags);
 
@@ -27,10 +30,18 @@ class PCF8574Component : public Component, public i2c::I2CDevice {
   void dump_config() override;
 
  protected:
+  static void gpio_intr(PCF8574Component *arg);
+
+  bool digital_read_hw(uint8_t pin) override { return this->read_gpio_(); }
+  bool digital_read_cache(uint8_t pin) override { return this->input_mask_ & (1 << pin); }
+  void digital_write_hw(uint8_t pin, bool value) override;
+
   bool read_gpio_();
 
   bool write_gpio_();
 
+  InternalGPIOPin *interrupt_pin_{nullptr};
+
   /// Mask for the pin mode - 1 means output, 0 means input
   uint16_t mode_mask_{0x00};
   /// The mask to write as output state - 1 means HIGH, 0 means LOW
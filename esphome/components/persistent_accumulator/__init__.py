@@ -0,0 +1,33 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID, CONF_UPDATE_INTERVAL
+
+persistent_accumulator_ns = cg.esphome_ns.namespace("persistent_accumulator")
+PersistentAccumulator = persistent_accumulator_ns.class_(
+    "PersistentAccumulator", cg.Component
+)
+
+CONF_PERSISTENT_ACCUMULATOR_ID = "persistent_accumulator_id"
+CONF_CHANGE_THRESHOLD = "change_threshold"
+CONF_MAX_SAVE_INTERVAL = "max_save_interval"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(PersistentAccumulator),
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="60s"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_CHANGE_THRESHOLD, default="1%"): cv.percentage,
+        cv.Optional(
+            CONF_MAX_SAVE_INTERVAL, default="1h"
+        ): cv.positive_time_period_milliseconds,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    cg.add(var.set_change_threshold(config[CONF_CHANGE_THRESHOLD]))
+    cg.add(var.set_max_save_interval(config[CONF_MAX_SAVE_INTERVAL]))
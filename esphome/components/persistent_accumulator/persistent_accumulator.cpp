@@ -0,0 +1,193 @@
+#include "persistent_accumulator.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <cstring>
+
+#ifdef USE_ESP32
+#include <esp_attr.h>
+#endif
+
+namespace esphome {
+namespace persistent_accumulator {
+
+static const char *const TAG = "persistent_accumulator";
+
+#ifdef USE_ESP32
+static const size_t RTC_MAX_COUNTERS = 64;
+static const uint32_t RTC_MAGIC = 0x50414331;
+
+/// Mirror of the counters, kept by soft reboots. `check` is the XOR of the magic, the count and all words of the
+/// entries, so it can be updated for a single value.
+struct RtcMirror {
+  uint32_t magic;
+  uint32_t count;
+  uint32_t check;
+  uint32_t words[RTC_MAX_COUNTERS * 2];
+};
+
+static RTC_NOINIT_ATTR RtcMirror rtc_mirror;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+static uint32_t float_bits(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+static float bits_float(uint32_t bits) {
+  float value;
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+#endif
+
+size_t PersistentAccumulator::add_counter(EntityBase *owner) {
+  this->counters_.push_back(Counter{owner, Entry{0, 0.0f}, NAN});
+  return this->counters_.size() - 1;
+}
+
+void PersistentAccumulator::setup() {
+  if (this->counters_.empty())
+    return;
+  this->load_();
+  this->restore_rtc_();
+  this->set_interval(this->update_interval_, [this]() { this->checkpoint_(false); });
+}
+
+void PersistentAccumulator::load_() {
+  const uint32_t base_hash = fnv1_hash("persistent_accumulator");
+  const size_t record_count = (this->counters_.size() + COUNTERS_PER_RECORD - 1) / COUNTERS_PER_RECORD;
+  // The entries of all records, by the position they were saved at
+  std::vector<Entry> stored(record_count * COUNTERS_PER_RECORD, Entry{0, 0.0f});
+  for (size_t r = 0; r < record_count; r++) {
+    this->records_.push_back(global_preferences->make_preference<Record>(base_hash + r));
+    this->last_save_.push_back(millis());
+    Record record{};
+    if (this->records_[r].load(&record))
+      memcpy(&stored[r * COUNTERS_PER_RECORD], record.entries, sizeof(record.entries));
+  }
+
+  for (size_t i = 0; i < this->counters_.size(); i++) {
+    Counter &counter = this->counters_[i];
+    counter.entry.key = counter.owner->get_object_id_hash();
+    auto it = std::find_if(stored.begin(), stored.end(),
+                           [&counter](const Entry &entry) { return entry.key == counter.entry.key; });
+    if (it != stored.end()) {
+      counter.entry.value = it->value;
+      // Counters at a new position are saved with the first checkpoint
+      if (size_t(it - stored.begin()) == i)
+        counter.saved = counter.entry.value;
+      continue;
+    }
+#if !defined(USE_ESP8266) && !defined(USE_RP2040)
+    // Take over the preference the counter used to save itself to. The preferences of the ESP8266 and the RP2040
+    // are stored at the offset they were made at, so they can't be looked up afterwards.
+    auto pref = global_preferences->make_preference<float>(counter.entry.key);
+    float value;
+    if (pref.load(&value))
+      counter.entry.value = value;
+#endif
+  }
+}
+
+void PersistentAccumulator::restore_rtc_() {
+#ifdef USE_ESP32
+  const uint32_t count = this->counters_.size();
+  if (count > RTC_MAX_COUNTERS) {
+    rtc_mirror.magic = 0;
+    return;
+  }
+  if (rtc_mirror.magic == RTC_MAGIC && rtc_mirror.count == count) {
+    uint32_t check = RTC_MAGIC ^ count;
+    bool keys_match = true;
+    for (size_t i = 0; i < count; i++) {
+      check ^= rtc_mirror.words[i * 2] ^ rtc_mirror.words[i * 2 + 1];
+      keys_match &= rtc_mirror.words[i * 2] == this->counters_[i].entry.key;
+    }
+    if (check == rtc_mirror.check && keys_match) {
+      // Newer than the last checkpoint
+      for (size_t i = 0; i < count; i++)
+        this->counters_[i].entry.value = bits_float(rtc_mirror.words[i * 2 + 1]);
+      ESP_LOGD(TAG, "Restored %" PRIu32 " counters from RTC memory", count);
+    }
+  }
+
+  rtc_mirror.magic = RTC_MAGIC;
+  rtc_mirror.count = count;
+  rtc_mirror.check = RTC_MAGIC ^ count;
+  for (size_t i = 0; i < count; i++) {
+    rtc_mirror.words[i * 2] = this->counters_[i].entry.key;
+    rtc_mirror.words[i * 2 + 1] = float_bits(this->counters_[i].entry.value);
+    rtc_mirror.check ^= rtc_mirror.words[i * 2] ^ rtc_mirror.words[i * 2 + 1];
+  }
+#endif
+}
+
+void PersistentAccumulator::update_rtc_(size_t index) {
+#ifdef USE_ESP32
+  if (rtc_mirror.magic != RTC_MAGIC || index >= rtc_mirror.count)
+    return;
+  const uint32_t bits = float_bits(this->counters_[index].entry.value);
+  rtc_mirror.check ^= rtc_mirror.words[index * 2 + 1] ^ bits;
+  rtc_mirror.words[index * 2 + 1] = bits;
+#endif
+}
+
+void PersistentAccumulator::set(size_t index, float value) {
+  this->counters_[index].entry.value = value;
+  this->update_rtc_(index);
+}
+
+void PersistentAccumulator::checkpoint_(bool force) {
+  const uint32_t now = millis();
+  for (size_t r = 0; r < this->records_.size(); r++) {
+    const size_t begin = r * COUNTERS_PER_RECORD;
+    const size_t end = std::min(begin + COUNTERS_PER_RECORD, this->counters_.size());
+    const bool overdue = now - this->last_save_[r] >= this->max_save_interval_;
+    bool save = false;
+    for (size_t i = begin; i < end; i++) {
+      const Counter &counter = this->counters_[i];
+      if (counter.entry.value == counter.saved)
+        continue;
+      // NAN is never saved
+      if (force || overdue || std::isnan(counter.saved) ||
+          std::fabs(counter.entry.value - counter.saved) > std::fabs(counter.saved) * this->change_threshold_) {
+        save = true;
+        break;
+      }
+    }
+    if (!save)
+      continue;
+
+    Record record{};
+    for (size_t i = begin; i < end; i++) {
+      record.entries[i - begin] = this->counters_[i].entry;
+      this->counters_[i].saved = this->counters_[i].entry.value;
+    }
+    this->records_[r].save(&record);
+    this->last_save_[r] = now;
+  }
+}
+
+void PersistentAccumulator::on_safe_shutdown() {
+  // Before the preferences are synced in on_shutdown()
+  this->checkpoint_(true);
+}
+
+void PersistentAccumulator::dump_config() {
+  ESP_LOGCONFIG(TAG, "Persistent Accumulator:");
+  ESP_LOGCONFIG(TAG, "  Counters: %u in %u records", (unsigned) this->counters_.size(),
+                (unsigned) this->records_.size());
+  ESP_LOGCONFIG(TAG, "  Update Interval: %" PRIu32 "ms", this->update_interval_);
+  ESP_LOGCONFIG(TAG, "  Change Threshold: %.1f%%", this->change_threshold_ * 100.0f);
+  ESP_LOGCONFIG(TAG, "  Max Save Interval: %" PRIu32 "ms", this->max_save_interval_);
+#ifdef USE_ESP32
+  ESP_LOGCONFIG(TAG, "  RTC Mirror: %s", YESNO(this->counters_.size() <= RTC_MAX_COUNTERS));
+#endif
+}
+
+}  // namespace persistent_accumulator
+}  // namespace esphome
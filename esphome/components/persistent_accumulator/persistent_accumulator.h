@@ -0,0 +1,71 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/entity_base.h"
+#include "esphome/core/preferences.h"
+
+#include <vector>
+
+namespace esphome {
+namespace persistent_accumulator {
+
+/** Keeps the counters of accumulating sensors, such as integration and total_daily_energy, across reboots.
+ *
+ * Instead of a preference per counter that is saved on every publish, the counters are checkpointed together in
+ * records of COUNTERS_PER_RECORD counters. A record is only saved when one of its counters changed by more than the
+ * change threshold, or changed at all and wasn't saved for the max save interval. On the ESP32 the counters are also
+ * mirrored to RTC memory on every change, so soft reboots don't lose what wasn't checkpointed yet.
+ */
+class PersistentAccumulator : public Component {
+ public:
+  static const size_t COUNTERS_PER_RECORD = 8;
+
+  /// Add a counter, must be called before setup(). The object id hash of the owner identifies it in the records.
+  /// @return The index of the counter.
+  size_t add_counter(EntityBase *owner);
+  /// The restored value after setup().
+  float get(size_t index) const { return this->counters_[index].entry.value; }
+  void set(size_t index, float value);
+
+  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+  /// Relative change of a counter that saves its record at the next check.
+  void set_change_threshold(float change_threshold) { this->change_threshold_ = change_threshold; }
+  void set_max_save_interval(uint32_t max_save_interval) { this->max_save_interval_ = max_save_interval; }
+
+  void setup() override;
+  void dump_config() override;
+  void on_safe_shutdown() override;
+  /// Before the counters are set up, after the preferences.
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+ protected:
+  struct Entry {
+    uint32_t key;
+    float value;
+  };
+  struct Record {
+    Entry entries[COUNTERS_PER_RECORD];
+  };
+  struct Counter {
+    EntityBase *owner;
+    Entry entry;
+    /// The value in the saved record, NAN if the record doesn't hold it yet
+    float saved;
+  };
+
+  void load_();
+  void restore_rtc_();
+  void update_rtc_(size_t index);
+  void checkpoint_(bool force);
+
+  std::vector<Counter> counters_;
+  std::vector<ESPPreferenceObject> records_;
+  /// millis() of the last save, per record
+  std::vector<uint32_t> last_save_;
+  uint32_t update_interval_{60000};
+  float change_threshold_{0.01f};
+  uint32_t max_save_interval_{3600000};
+};
+
+}  // namespace persistent_accumulator
+}  // namespace esphome
@@ -1,6 +1,8 @@
 #include "pid_climate.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace pid {
 
@@ -11,10 +13,17 @@ void PIDClimate::setup() {
     // only publish if state/current temperature has changed in two digits of precision
     this->do_publish_ = roundf(state * 100) != roundf(this->current_temperature * 100);
     this->current_temperature = state;
-    this->update_pid_();
+    if (this->update_interval_ == 0)
+      this->update_pid_();
   });
   this->current_temperature = this->sensor_->state;
 
+  if (this->update_interval_ != 0) {
+    // The scheduler keeps the phase of intervals, so the jitter is bounded by the loop time
+    this->controller_.set_sample_time(this->update_interval_ / 1000.0f);
+    this->set_interval("pid", this->update_interval_, [this]() { this->update_pid_(); });
+  }
+
   // register for humidity values and get initial state
   if (this->humidity_sensor_ != nullptr) {
     this->humidity_sensor_->add_on_state_callback([this](float state) {
@@ -73,6 +82,9 @@ climate::ClimateTraits PIDClimate::traits() {
 }
 void PIDClimate::dump_config() {
   LOG_CLIMATE("", "PID Climate", this);
+  if (this->update_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Update Interval: %" PRIu32 "ms", this->update_interval_);
+  }
   ESP_LOGCONFIG(TAG, "  Control Parameters:");
   ESP_LOGCONFIG(TAG, "    kp: %.5f, ki: %.5f, kd: %.5f, output samples: %d", controller_.kp_, controller_.ki_,
                 controller_.kd_, controller_.output_samples_);
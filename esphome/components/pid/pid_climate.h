@@ -38,6 +38,8 @@ class PIDClimate : public climate::Climate, public Component {
   void set_starting_integral_term(float in) { controller_.set_starting_integral_term(in); }
 
   void set_deadband_output_samples(int in) { controller_.deadband_output_samples_ = in; }
+  /// Run the controller at this fixed interval on the latest sensor value, instead of on every sensor update.
+  void set_update_interval(uint32_t update_interval) { update_interval_ = update_interval; }
 
   float get_output_value() const { return output_value_; }
   float get_error_value() const { return controller_.error_; }
@@ -99,6 +101,8 @@ class PIDClimate : public climate::Climate, public Component {
   float default_target_temperature_;
   std::unique_ptr<PIDAutotuner> autotuner_;
   bool do_publish_ = false;
+  /// 0 to update on every sensor value
+  uint32_t update_interval_ = 0;
 };
 
 template<typename... Ts> class PIDAutotuneAction : public Action<Ts...> {
@@ -9,7 +9,7 @@ float PIDController::update(float setpoint, float process_value) {
   // y(t) ... process value (sensor reading)
   // u(t) ... output value
 
-  dt_ = calculate_relative_time_();
+  dt_ = sample_time_ > 0 ? sample_time_ : calculate_relative_time_();
 
   // e(t) := r(t) - y(t)
   error_ = setpoint - process_value;
@@ -55,11 +55,23 @@ void PIDController::calculate_integral_term_() {
 
   if (in_deadband()) {
     // shallow the integral when in the deadband
-    accumulated_integral_ += new_integral * ki_multiplier_;
-  } else {
-    accumulated_integral_ += new_integral;
+    new_integral *= ki_multiplier_;
+  }
+
+  if (sample_time_ > 0) {
+    // accumulate and constrain in fixed-point, see set_sample_time()
+    fixed_integral_ += to_fixed_(new_integral);
+    if (!std::isnan(min_integral_) && fixed_integral_ < to_fixed_(min_integral_))
+      fixed_integral_ = to_fixed_(min_integral_);
+    if (!std::isnan(max_integral_) && fixed_integral_ > to_fixed_(max_integral_))
+      fixed_integral_ = to_fixed_(max_integral_);
+    accumulated_integral_ = from_fixed_(fixed_integral_);
+    integral_term_ = accumulated_integral_;
+    return;
   }
 
+  accumulated_integral_ += new_integral;
+
   // constrain accumulated integral value
   if (!std::isnan(min_integral_) && accumulated_integral_ < min_integral_)
     accumulated_integral_ = min_integral_;
@@ -73,7 +85,8 @@ void PIDController::calculate_derivative_term_(float setpoint) {
   // derivative_term_
   // d(t) := K_d * de(t)/dt
   float derivative = 0.0f;
-  if (dt_ != 0.0f) {
+  // with a fixed sample time there's no previous error to derive from in the first update
+  if (dt_ != 0.0f && (sample_time_ <= 0 || !std::isnan(previous_setpoint_))) {
     // remove changes to setpoint from error
     if (!std::isnan(previous_setpoint_) && previous_setpoint_ != setpoint)
       previous_error_ -= previous_setpoint_ - setpoint;
@@ -82,8 +95,18 @@ void PIDController::calculate_derivative_term_(float setpoint) {
   previous_error_ = error_;
   previous_setpoint_ = setpoint;
 
-  // smooth the derivative samples
-  derivative = weighted_average_(derivative_list_, derivative, derivative_samples_);
+  if (sample_time_ > 0) {
+    // d_avg += (d - d_avg) / N, in fixed-point
+    if (derivative_samples_ > 1) {
+      fixed_derivative_ += (to_fixed_(derivative) - fixed_derivative_) / derivative_samples_;
+    } else {
+      fixed_derivative_ = to_fixed_(derivative);
+    }
+    derivative = from_fixed_(fixed_derivative_);
+  } else {
+    // smooth the derivative samples
+    derivative = weighted_average_(derivative_list_, derivative, derivative_samples_);
+  }
 
   derivative_term_ = kd_ * derivative;
 
@@ -125,5 +148,17 @@ float PIDController::calculate_relative_time_() {
   return dt / 1000.0f;
 }
 
+int64_t PIDController::to_fixed_(float value) {
+  // scaling by a power of two is exact, the limit keeps the conversion defined
+  const float limit = 1073741824.0f;
+  if (value > limit)
+    value = limit;
+  if (value < -limit)
+    value = -limit;
+  return static_cast<int64_t>(ldexpf(value, FIXED_FRACTION_BITS));
+}
+
+float PIDController::from_fixed_(int64_t value) { return ldexpf(static_cast<float>(value), -FIXED_FRACTION_BITS); }
+
 }  // namespace pid
 }  // namespace esphome
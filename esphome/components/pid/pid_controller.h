@@ -2,6 +2,7 @@
 #include "esphome/core/hal.h"
 #include <deque>
 #include <cmath>
+#include <cstdint>
 
 namespace esphome {
 namespace pid {
@@ -9,8 +10,22 @@ namespace pid {
 struct PIDController {
   float update(float setpoint, float process_value);
 
-  void reset_accumulated_integral() { accumulated_integral_ = 0; }
-  void set_starting_integral_term(float in) { accumulated_integral_ = in; }
+  void reset_accumulated_integral() {
+    accumulated_integral_ = 0;
+    fixed_integral_ = 0;
+  }
+  void set_starting_integral_term(float in) {
+    accumulated_integral_ = in;
+    fixed_integral_ = to_fixed_(in);
+  }
+
+  /** Run at a fixed sample time in seconds, instead of timing the updates with millis().
+   *
+   * The integral and the derivative filter are then kept in fixed-point. At high rates the increments of the integral
+   * get so small that a float accumulator would round them away, a 64 bit accumulator keeps every one of them. The
+   * derivative is smoothed with an exponential moving average over the derivative samples instead of a window.
+   */
+  void set_sample_time(float sample_time) { sample_time_ = sample_time; }
 
   bool in_deadband();
 
@@ -53,6 +68,11 @@ struct PIDController {
   float weighted_average_(std::deque<float> &list, float new_value, int samples);
   float calculate_relative_time_();
 
+  /// Fraction bits of the fixed-point values, their integer part is limited to +-2^30
+  static const int FIXED_FRACTION_BITS = 32;
+  static int64_t to_fixed_(float value);
+  static float from_fixed_(int64_t value);
+
   /// Error from previous update used for derivative term
   float previous_error_ = 0;
   float previous_setpoint_ = NAN;
@@ -60,6 +80,11 @@ struct PIDController {
   float accumulated_integral_ = 0;
   uint32_t last_time_ = 0;
 
+  /// 0 to time the updates with millis()
+  float sample_time_ = 0;
+  int64_t fixed_integral_ = 0;
+  int64_t fixed_derivative_ = 0;
+
   // this is a list of derivative values for smoothing.
   std::deque<float> derivative_list_;
 
@@ -14,8 +14,12 @@ namespace pn532 {
 
 static const char *const TAG = "pn532";
 
+static const uint32_t ABORT_SETTLE_TIME_MS = 10;
+
 void PN532::setup() {
   ESP_LOGCONFIG(TAG, "Setting up PN532...");
+  if (this->irq_pin_ != nullptr)
+    this->irq_pin_->setup();
 
   // Get version data
   if (!this->write_command_({PN532_COMMAND_VERSION_DATA})) {
@@ -83,7 +87,7 @@ void PN532::setup() {
 
 bool PN532::powerdown() {
   updates_enabled_ = false;
-  requested_read_ = false;
+  poll_state_ = POLL_IDLE;
   ESP_LOGI(TAG, "Powering down PN532");
   if (!this->write_command_({PN532_COMMAND_POWERDOWN, 0b10100000})) {  // enable i2c,spi wakeup
     ESP_LOGE(TAG, "Error writing powerdown command to PN532");
@@ -106,41 +110,77 @@ bool PN532::powerdown() {
 void PN532::update() {
   if (!updates_enabled_)
     return;
+  if (this->poll_state_ != POLL_IDLE) {
+    ESP_LOGV(TAG, "Previous poll still running, skipping");
+    return;
+  }
 
   for (auto *obj : this->binary_sensors_)
     obj->on_scan_end();
 
-  if (!this->write_command_({
-          PN532_COMMAND_INLISTPASSIVETARGET,
-          0x01,  // max 1 card
-          0x00,  // baud rate ISO14443A (106 kbit/s)
-      })) {
-    ESP_LOGW(TAG, "Requesting tag read failed!");
-    this->status_set_warning();
-    return;
-  }
-  this->status_clear_warning();
-  this->requested_read_ = true;
+  // The ACK and the response are picked up by loop() once the PN532 has them ready
+  this->send_command_({
+      PN532_COMMAND_INLISTPASSIVETARGET,
+      0x01,  // max 1 card
+      0x00,  // baud rate ISO14443A (106 kbit/s)
+  });
+  this->poll_state_ = POLL_WAIT_ACK;
 }
 
 void PN532::loop() {
-  if (!this->requested_read_)
+  if (this->poll_state_ == POLL_IDLE)
+    return;
+
+  if (this->poll_state_ == POLL_ABORTING) {
+    // Give the PN532 time to abort InListPassiveTarget, without stalling the main loop
+    if (millis() - this->abort_time_ < ABORT_SETTLE_TIME_MS)
+      return;
+    std::vector<uint8_t> read;
+    this->process_inlist_response_(false, read);
     return;
+  }
 
   auto ready = this->read_ready_(false);
   if (ready == WOULDBLOCK)
     return;
 
-  bool success = false;
-  std::vector<uint8_t> read;
-
-  if (ready == READY) {
-    success = this->read_response(PN532_COMMAND_INLISTPASSIVETARGET, read);
-  } else {
-    this->send_ack_();  // abort still running InListPassiveTarget
+  switch (this->poll_state_) {
+    case POLL_WAIT_ACK:
+      if (ready != READY || !this->read_ack_()) {
+        ESP_LOGW(TAG, "Requesting tag read failed!");
+        this->status_set_warning();
+        this->poll_state_ = POLL_IDLE;
+        return;
+      }
+      this->status_clear_warning();
+      this->poll_state_ = POLL_WAIT_RESPONSE;
+      break;
+    case POLL_WAIT_RESPONSE: {
+      if (ready != READY) {
+        // abort still running InListPassiveTarget
+        ESP_LOGV(TAG, "Sending ACK for abort");
+        this->write_data({0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00});
+        this->abort_time_ = millis();
+        this->poll_state_ = POLL_ABORTING;
+        return;
+      }
+      std::vector<uint8_t> read;
+      bool success = this->read_response(PN532_COMMAND_INLISTPASSIVETARGET, read);
+      this->process_inlist_response_(success, read);
+      break;
+    }
+    case POLL_WAIT_RF_OFF_ACK:
+      if (ready == READY)
+        this->read_ack_();
+      this->poll_state_ = POLL_IDLE;
+      break;
+    default:
+      break;
   }
+}
 
-  this->requested_read_ = false;
+void PN532::process_inlist_response_(bool success, std::vector<uint8_t> &read) {
+  this->poll_state_ = POLL_IDLE;
 
   if (!success) {
     // Something failed
@@ -150,7 +190,7 @@ void PN532::loop() {
         trigger->process(tag);
     }
     this->current_uid_ = {};
-    this->turn_off_rf_();
+    this->request_rf_off_();
     return;
   }
 
@@ -163,16 +203,16 @@ void PN532::loop() {
         trigger->process(tag);
     }
     this->current_uid_ = {};
-    this->turn_off_rf_();
+    this->request_rf_off_();
     return;
   }
 
   uint8_t nfcid_length = read[5];
-  std::vector<uint8_t> nfcid(read.begin() + 6, read.begin() + 6 + nfcid_length);
   if (read.size() < 6U + nfcid_length) {
     // oops, pn532 returned invalid data
     return;
   }
+  std::vector<uint8_t> nfcid(read.begin() + 6, read.begin() + 6 + nfcid_length);
 
   bool report = true;
   for (auto *bin_sens : this->binary_sensors_) {
@@ -240,10 +280,15 @@ void PN532::loop() {
 
   this->read_mode();
 
-  this->turn_off_rf_();
+  this->request_rf_off_();
 }
 
 bool PN532::write_command_(const std::vector<uint8_t> &data) {
+  this->send_command_(data);
+  return this->read_ack_();
+}
+
+bool PN532::send_command_(const std::vector<uint8_t> &data) {
   std::vector<uint8_t> write_data;
   // Preamble
   write_data.push_back(0x00);
@@ -275,9 +320,7 @@ bool PN532::write_command_(const std::vector<uint8_t> &data) {
   // Postamble
   write_data.push_back(0x00);
 
-  this->write_data(write_data);
-
-  return this->read_ack_();
+  return this->write_data(write_data);
 }
 
 bool PN532::read_ack_() {
@@ -296,11 +339,6 @@ bool PN532::read_ack_() {
   return matches;
 }
 
-void PN532::send_ack_() {
-  ESP_LOGV(TAG, "Sending ACK for abort");
-  this->write_data({0x00, 0x00, 0xFF, 0x00, 0xFF, 0x00});
-  delay(10);
-}
 void PN532::send_nack_() {
   ESP_LOGV(TAG, "Sending NACK for retransmit");
   this->write_data({0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00});
@@ -321,7 +359,9 @@ enum PN532ReadReady PN532::read_ready_(bool block) {
   }
 
   while (true) {
-    if (this->is_read_ready()) {
+    // The IRQ line goes low once the PN532 has a frame ready, which saves polling the bus for the status
+    bool ready = this->irq_pin_ != nullptr ? !this->irq_pin_->digital_read() : this->is_read_ready();
+    if (ready) {
       this->rd_ready_ = READY;
       break;
     }
@@ -357,6 +397,16 @@ void PN532::turn_off_rf_() {
   });
 }
 
+void PN532::request_rf_off_() {
+  ESP_LOGV(TAG, "Turning RF field OFF");
+  this->send_command_({
+      PN532_COMMAND_RFCONFIGURATION,
+      0x01,  // RF Field
+      0x00,  // Off
+  });
+  this->poll_state_ = POLL_WAIT_RF_OFF_ACK;
+}
+
 std::unique_ptr<nfc::NfcTag> PN532::read_tag_(std::vector<uint8_t> &uid) {
   uint8_t type = nfc::guess_tag_type(uid.size());
 
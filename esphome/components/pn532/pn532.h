@@ -2,6 +2,7 @@
 
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
+#include "esphome/core/hal.h"
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #include "esphome/components/nfc/nfc_tag.h"
 #include "esphome/components/nfc/nfc.h"
@@ -20,6 +21,15 @@ static const uint8_t PN532_COMMAND_INDATAEXCHANGE = 0x40;
 static const uint8_t PN532_COMMAND_INLISTPASSIVETARGET = 0x4A;
 static const uint8_t PN532_COMMAND_POWERDOWN = 0x16;
 
+/// Steps of a tag poll, so that loop() never waits for the PN532
+enum PN532PollState {
+  POLL_IDLE = 0,
+  POLL_WAIT_ACK,
+  POLL_WAIT_RESPONSE,
+  POLL_ABORTING,
+  POLL_WAIT_RF_OFF_ACK,
+};
+
 enum PN532ReadReady {
   WOULDBLOCK = 0,
   TIMEOUT,
@@ -40,6 +50,8 @@ class PN532 : public PollingComponent {
   void loop() override;
   void on_shutdown() override { powerdown(); }
 
+  /// Optional IRQ line, checked instead of polling the bus for the ready status.
+  void set_irq_pin(GPIOPin *irq_pin) { this->irq_pin_ = irq_pin; }
   void register_tag(PN532BinarySensor *tag) { this->binary_sensors_.push_back(tag); }
   void register_ontag_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontag_.push_back(trig); }
   void register_ontagremoved_trigger(nfc::NfcOnTagTrigger *trig) { this->triggers_ontagremoved_.push_back(trig); }
@@ -58,9 +70,14 @@ class PN532 : public PollingComponent {
 
  protected:
   void turn_off_rf_();
+  /// Turn the RF field off without waiting for the ACK, loop() picks it up.
+  void request_rf_off_();
+  void process_inlist_response_(bool success, std::vector<uint8_t> &read);
+  /// Send a command and wait for its ACK.
   bool write_command_(const std::vector<uint8_t> &data);
+  /// Send a command frame only.
+  bool send_command_(const std::vector<uint8_t> &data);
   bool read_ack_();
-  void send_ack_();
   void send_nack_();
 
   enum PN532ReadReady read_ready_(bool block);
@@ -94,7 +111,9 @@ class PN532 : public PollingComponent {
   bool clean_mifare_ultralight_();
 
   bool updates_enabled_{true};
-  bool requested_read_{false};
+  enum PN532PollState poll_state_ { POLL_IDLE };
+  uint32_t abort_time_{0};
+  GPIOPin *irq_pin_{nullptr};
   std::vector<PN532BinarySensor *> binary_sensors_;
   std::vector<nfc::NfcOnTagTrigger *> triggers_ontag_;
   std::vector<nfc::NfcOnTagTrigger *> triggers_ontagremoved_;
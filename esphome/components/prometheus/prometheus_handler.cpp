@@ -2,179 +2,262 @@
 #ifdef USE_NETWORK
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 namespace prometheus {
 
+namespace {
+/// Print into a std::string, the row functions write each part of the response into one.
+class StringPrint : public Print {
+ public:
+  explicit StringPrint(std::string &output) : output_(output) {}
+  size_t write(uint8_t c) override {
+    this->output_ += char(c);
+    return 1;
+  }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    this->output_.append(reinterpret_cast<const char *>(buffer), size);
+    return size;
+  }
+
+ protected:
+  std::string &output_;
+};
+}  // namespace
+
 void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+  // The response is generated a few rows at a time while it is sent, instead of buffering all of it on the heap
+  auto cursor = std::make_shared<Cursor>();
+  AsyncWebServerResponse *response = req->beginChunkedResponse(
+      "text/plain; version=0.0.4; charset=utf-8", [this, cursor](uint8_t *buffer, size_t max_len, size_t index) {
+        size_t written = 0;
+        while (written < max_len) {
+          if (cursor->offset == cursor->pending.size()) {
+            cursor->pending.clear();
+            cursor->offset = 0;
+            StringPrint out(cursor->pending);
+            if (!this->render_part_(*cursor, &out))
+              break;
+            continue;
+          }
+          size_t len = std::min(max_len - written, cursor->pending.size() - cursor->offset);
+          memcpy(buffer + written, cursor->pending.data() + cursor->offset, len);
+          cursor->offset += len;
+          written += len;
+        }
+        return written;
+      });
+  req->send(response);
+}
 
+bool PrometheusHandler::render_part_(Cursor &cursor, Print *stream) {
+  switch (cursor.stage) {
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
-  for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+    case STAGE_SENSOR:
+      if (cursor.index == 0)
+        this->sensor_type_(stream);
+      if (cursor.index < App.get_sensors().size()) {
+        this->sensor_row_(stream, App.get_sensors()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
-  for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    case STAGE_BINARY_SENSOR:
+      if (cursor.index == 0)
+        this->binary_sensor_type_(stream);
+      if (cursor.index < App.get_binary_sensors().size()) {
+        this->binary_sensor_row_(stream, App.get_binary_sensors()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
-  for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    case STAGE_FAN:
+      if (cursor.index == 0)
+        this->fan_type_(stream);
+      if (cursor.index < App.get_fans().size()) {
+        this->fan_row_(stream, App.get_fans()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
-  for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    case STAGE_LIGHT:
+      if (cursor.index == 0)
+        this->light_type_(stream);
+      if (cursor.index < App.get_lights().size()) {
+        this->light_row_(stream, App.get_lights()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
-  for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    case STAGE_COVER:
+      if (cursor.index == 0)
+        this->cover_type_(stream);
+      if (cursor.index < App.get_covers().size()) {
+        this->cover_row_(stream, App.get_covers()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
-  for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    case STAGE_SWITCH:
+      if (cursor.index == 0)
+        this->switch_type_(stream);
+      if (cursor.index < App.get_switches().size()) {
+        this->switch_row_(stream, App.get_switches()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
 #ifdef USE_LOCK
-  this->lock_type_(stream);
-  for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    case STAGE_LOCK:
+      if (cursor.index == 0)
+        this->lock_type_(stream);
+      if (cursor.index < App.get_locks().size()) {
+        this->lock_row_(stream, App.get_locks()[cursor.index++]);
+        return true;
+      }
+      break;
 #endif
-
-  req->send(stream);
+    case STAGE_DONE:
+      return false;
+    default:
+      // entity type not compiled in
+      break;
+  }
+  cursor.stage++;
+  cursor.index = 0;
+  return true;
 }
 
-std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
-  auto item = relabel_map_id_.find(obj);
-  return item == relabel_map_id_.end() ? obj->get_object_id() : item->second;
+static std::string escape_label_value(const std::string &value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      escaped += '\\';
+      escaped += c;
+    } else if (c == '\n') {
+      escaped += "\\n";
+    } else {
+      escaped += c;
+    }
+  }
+  return escaped;
 }
 
-std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
-  auto item = relabel_map_name_.find(obj);
-  return item == relabel_map_name_.end() ? obj->get_name() : item->second;
+const std::string &PrometheusHandler::labels_(EntityBase *obj) {
+  auto cached = this->labels_cache_.find(obj);
+  if (cached != this->labels_cache_.end())
+    return cached->second;
+
+  auto id = this->relabel_map_id_.find(obj);
+  auto name = this->relabel_map_name_.find(obj);
+  std::string labels = "id=\"";
+  labels += escape_label_value(id == this->relabel_map_id_.end() ? obj->get_object_id().str() : id->second);
+  labels += "\",name=\"";
+  labels += escape_label_value(name == this->relabel_map_name_.end() ? obj->get_name().str() : name->second);
+  labels += "\"";
+  return this->labels_cache_.emplace(obj, std::move(labels)).first->second;
 }
 
 // Type-specific implementation
 #ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::sensor_type_(Print *stream) {
   stream->print(F("#TYPE esphome_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_sensor_failed gauge\n"));
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
+void PrometheusHandler::sensor_row_(Print *stream, sensor::Sensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->state)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_sensor_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
+    stream->print(F("esphome_sensor_value{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F(",unit=\""));
     stream->print(obj->get_unit_of_measurement().c_str());
     stream->print(F("\"} "));
     stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_sensor_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::binary_sensor_type_(Print *stream) {
   stream->print(F("#TYPE esphome_binary_sensor_value gauge\n"));
   stream->print(F("#TYPE esphome_binary_sensor_failed gauge\n"));
 }
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
+void PrometheusHandler::binary_sensor_row_(Print *stream, binary_sensor::BinarySensor *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (obj->has_state()) {
     // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_binary_sensor_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_binary_sensor_value{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} "));
     stream->print(obj->state);
     stream->print(F("\n"));
   } else {
     // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_binary_sensor_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::fan_type_(Print *stream) {
   stream->print(F("#TYPE esphome_fan_value gauge\n"));
   stream->print(F("#TYPE esphome_fan_failed gauge\n"));
   stream->print(F("#TYPE esphome_fan_speed gauge\n"));
   stream->print(F("#TYPE esphome_fan_oscillation gauge\n"));
 }
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
+void PrometheusHandler::fan_row_(Print *stream, fan::Fan *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  stream->print(F("esphome_fan_failed{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_fan_value{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print(F("\n"));
   // Speed if available
   if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_fan_speed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} "));
     stream->print(obj->speed);
     stream->print(F("\n"));
   }
   // Oscillation if available
   if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_fan_oscillation{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} "));
     stream->print(obj->oscillating);
     stream->print(F("\n"));
   }
@@ -182,20 +265,18 @@ void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::light_type_(Print *stream) {
   stream->print(F("#TYPE esphome_light_state gauge\n"));
   stream->print(F("#TYPE esphome_light_color gauge\n"));
   stream->print(F("#TYPE esphome_light_effect_active gauge\n"));
 }
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
+void PrometheusHandler::light_row_(Print *stream, light::LightState *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_light_state{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} "));
   stream->print(obj->remote_values.is_on());
   stream->print(F("\n"));
   // Brightness and RGBW
@@ -203,55 +284,41 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
   float brightness, r, g, b, w;
   color.as_brightness(&brightness);
   color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
+  stream->print(F("esphome_light_color{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F(",channel=\"brightness\"} "));
   stream->print(brightness);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
+  stream->print(F("esphome_light_color{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F(",channel=\"r\"} "));
   stream->print(r);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
+  stream->print(F("esphome_light_color{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F(",channel=\"g\"} "));
   stream->print(g);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
+  stream->print(F("esphome_light_color{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F(",channel=\"b\"} "));
   stream->print(b);
   stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
+  stream->print(F("esphome_light_color{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F(",channel=\"w\"} "));
   stream->print(w);
   stream->print(F("\n"));
   // Effect
   std::string effect = obj->get_effect_name();
   if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
+    stream->print(F("esphome_light_effect_active{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F(",effect=\"None\"} 0\n"));
   } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
+    stream->print(F("esphome_light_effect_active{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F(",effect=\""));
     stream->print(effect.c_str());
     stream->print(F("\"} 1\n"));
   }
@@ -259,91 +326,75 @@ void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightStat
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::cover_type_(Print *stream) {
   stream->print(F("#TYPE esphome_cover_value gauge\n"));
   stream->print(F("#TYPE esphome_cover_failed gauge\n"));
 }
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
+void PrometheusHandler::cover_row_(Print *stream, cover::Cover *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
   if (!std::isnan(obj->position)) {
     // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
+    stream->print(F("esphome_cover_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 0\n"));
     // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
+    stream->print(F("esphome_cover_value{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} "));
     stream->print(obj->position);
     stream->print(F("\n"));
     if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
+      stream->print(F("esphome_cover_tilt{"));
+      stream->print(this->labels_(obj).c_str());
+      stream->print(F("} "));
       stream->print(obj->tilt);
       stream->print(F("\n"));
     }
   } else {
     // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+    stream->print(F("esphome_cover_failed{"));
+    stream->print(this->labels_(obj).c_str());
+    stream->print(F("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::switch_type_(Print *stream) {
   stream->print(F("#TYPE esphome_switch_value gauge\n"));
   stream->print(F("#TYPE esphome_switch_failed gauge\n"));
 }
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
+void PrometheusHandler::switch_row_(Print *stream, switch_::Switch *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  stream->print(F("esphome_switch_failed{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_switch_value{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print(F("\n"));
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
+void PrometheusHandler::lock_type_(Print *stream) {
   stream->print(F("#TYPE esphome_lock_value gauge\n"));
   stream->print(F("#TYPE esphome_lock_failed gauge\n"));
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
+void PrometheusHandler::lock_row_(Print *stream, lock::Lock *obj) {
   if (obj->is_internal() && !this->include_internal_)
     return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
+  stream->print(F("esphome_lock_failed{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} 0\n"));
   // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
+  stream->print(F("esphome_lock_value{"));
+  stream->print(this->labels_(obj).c_str());
+  stream->print(F("} "));
   stream->print(obj->state);
   stream->print(F("\n"));
 }
@@ -13,6 +13,8 @@ CODEOWNERS = ["@esphome/core"]
 psram_ns = cg.esphome_ns.namespace("psram")
 PsramComponent = psram_ns.class_("PsramComponent", cg.Component)
 
+CONF_BULK_DATA = "bulk_data"
+
 SPIRAM_MODES = {
     "quad": "CONFIG_SPIRAM_MODE_QUAD",
     "octal": "CONFIG_SPIRAM_MODE_OCT",
@@ -30,6 +32,8 @@ CONFIG_SCHEMA = cv.All(
             cv.GenerateID(): cv.declare_id(PsramComponent),
             cv.Optional(CONF_MODE): cv.enum(SPIRAM_MODES, lower=True),
             cv.Optional(CONF_SPEED): cv.All(cv.frequency, cv.one_of(*SPIRAM_SPEEDS)),
+            # Place large, rarely touched buffers (framebuffers, JSON documents, ...) in PSRAM
+            cv.Optional(CONF_BULK_DATA, default=True): cv.boolean,
         }
     ),
     cv.only_on_esp32,
@@ -55,6 +59,8 @@ async def to_code(config):
             add_idf_sdkconfig_option(f"{SPIRAM_SPEEDS[config[CONF_SPEED]]}", True)
 
     cg.add_define("USE_PSRAM")
+    if not config[CONF_BULK_DATA]:
+        cg.add_define("USE_PSRAM_INTERNAL_BULK_DATA")
 
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
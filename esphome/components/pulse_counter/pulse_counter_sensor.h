@@ -7,6 +7,7 @@
 #include <cinttypes>
 
 #if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include "esphome/components/esp32/pcnt.h"
 #include <driver/pcnt.h>
 #define HAS_PCNT
 #endif
@@ -1,4 +1,5 @@
 #include "pulse_meter_sensor.h"
+#include <algorithm>
 #include <utility>
 #include "esphome/core/log.h"
 
@@ -7,6 +8,12 @@ namespace pulse_meter {
 
 static const char *const TAG = "pulse_meter";
 
+#ifdef HAS_PCNT
+// Adapt the pulses per PCNT interrupt, so the interrupts come in about this often
+static const uint32_t PCNT_EVENT_PERIOD_US = 20000;
+static const uint16_t PCNT_MAX_LIMIT = 32767;
+#endif
+
 void PulseMeterSensor::set_total_pulses(uint32_t pulses) {
   this->total_pulses_ = pulses;
   if (this->total_sensor_ != nullptr) {
@@ -21,6 +28,14 @@ void PulseMeterSensor::setup() {
   // Set the last processed edge to now for the first timeout
   this->last_processed_edge_us_ = micros();
 
+#ifdef HAS_PCNT
+  if (this->use_pcnt_) {
+    if (!this->pcnt_setup_())
+      this->mark_failed();
+    return;
+  }
+#endif
+
   if (this->filter_mode_ == FILTER_EDGE) {
     this->pin_->attach_interrupt(PulseMeterSensor::edge_intr, this, gpio::INTERRUPT_RISING_EDGE);
   } else if (this->filter_mode_ == FILTER_PULSE) {
@@ -76,6 +91,10 @@ void PulseMeterSensor::loop() {
         uint32_t delta_us = this->get_->last_detected_edge_us_ - this->last_processed_edge_us_;
         float pulse_width_us = delta_us / float(this->get_->count_);
         this->publish_state((60.0f * 1000000.0f) / pulse_width_us);
+#ifdef HAS_PCNT
+        if (this->use_pcnt_)
+          this->pcnt_adapt_limit_(pulse_width_us);
+#endif
       } break;
     }
 
@@ -84,6 +103,15 @@ void PulseMeterSensor::loop() {
   // No detected edges this loop
   else {
     const uint32_t time_since_valid_edge_us = now - this->last_processed_edge_us_;
+#ifdef HAS_PCNT
+    if (this->use_pcnt_ && this->pcnt_limit_ > 1 && time_since_valid_edge_us > 4 * PCNT_EVENT_PERIOD_US) {
+      // The rate dropped, the pulses counted since the last interrupt tell by how much
+      int16_t partial = 0;
+      pcnt_get_counter_value(this->pcnt_unit_, &partial);
+      const uint32_t limit = uint64_t(partial) * PCNT_EVENT_PERIOD_US / time_since_valid_edge_us;
+      this->pcnt_set_limit_(std::max<uint32_t>(limit, 1));
+    }
+#endif
 
     switch (this->meter_state_) {
       // Running and initial states can timeout
@@ -107,6 +135,10 @@ float PulseMeterSensor::get_setup_priority() const { return setup_priority::DATA
 void PulseMeterSensor::dump_config() {
   LOG_SENSOR("", "Pulse Meter", this);
   LOG_PIN("  Pin: ", this->pin_);
+#ifdef HAS_PCNT
+  if (this->use_pcnt_)
+    ESP_LOGCONFIG(TAG, "  PCNT Unit Number: %u", this->pcnt_unit_);
+#endif
   if (this->filter_mode_ == FILTER_EDGE) {
     ESP_LOGCONFIG(TAG, "  Filtering rising edges less than %" PRIu32 " µs apart", this->filter_us_);
   } else {
@@ -159,5 +191,91 @@ void IRAM_ATTR PulseMeterSensor::pulse_intr(PulseMeterSensor *sensor) {
   state.last_pin_val_ = pin_val;
 }
 
+#ifdef HAS_PCNT
+bool PulseMeterSensor::pcnt_setup_() {
+  if (!esp32::allocate_pcnt_unit(&this->pcnt_unit_)) {
+    ESP_LOGE(TAG, "No PCNT unit left");
+    return false;
+  }
+
+  pcnt_config_t pcnt_config = {
+      .pulse_gpio_num = this->pin_->get_pin(),
+      .ctrl_gpio_num = PCNT_PIN_NOT_USED,
+      .lctrl_mode = PCNT_MODE_KEEP,
+      .hctrl_mode = PCNT_MODE_KEEP,
+      .pos_mode = PCNT_COUNT_INC,
+      .neg_mode = PCNT_COUNT_DIS,
+      .counter_h_lim = int16_t(this->pcnt_limit_),
+      .counter_l_lim = 0,
+      .unit = this->pcnt_unit_,
+      .channel = PCNT_CHANNEL_0,
+  };
+  esp_err_t error = pcnt_unit_config(&pcnt_config);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+
+  if (this->filter_us_ != 0) {
+    // The glitch filter counts APB clock cycles
+    const uint16_t filter_val = std::min<uint32_t>(this->filter_us_ * 80u, 1023u);
+    pcnt_set_filter_value(this->pcnt_unit_, filter_val);
+    pcnt_filter_enable(this->pcnt_unit_);
+  }
+
+  // The counter wraps to 0 at the high limit, every interrupt therefore stands for exactly pcnt_limit_ pulses
+  error = pcnt_isr_service_install(0);
+  if (error != ESP_OK && error != ESP_ERR_INVALID_STATE) {
+    ESP_LOGE(TAG, "Installing the PCNT interrupt service failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  error = pcnt_isr_handler_add(this->pcnt_unit_, PulseMeterSensor::pcnt_intr, this);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Adding the PCNT interrupt handler failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  pcnt_event_enable(this->pcnt_unit_, PCNT_EVT_H_LIM);
+  pcnt_counter_clear(this->pcnt_unit_);
+  pcnt_counter_resume(this->pcnt_unit_);
+  return true;
+}
+
+void PulseMeterSensor::pcnt_set_limit_(uint16_t limit) {
+  if (limit == this->pcnt_limit_)
+    return;
+  ESP_LOGV(TAG, "'%s': Interrupting every %u pulses", this->get_name().c_str(), limit);
+  // Pulses while the counter is paused are lost, which only takes a few µs once in a while
+  pcnt_counter_pause(this->pcnt_unit_);
+  int16_t partial = 0;
+  pcnt_get_counter_value(this->pcnt_unit_, &partial);
+  pcnt_set_event_value(this->pcnt_unit_, PCNT_EVT_H_LIM, limit);
+  // A new limit only takes effect once the counter is cleared
+  pcnt_counter_clear(this->pcnt_unit_);
+  this->pcnt_carry_ += partial;
+  this->pcnt_limit_ = limit;
+  pcnt_counter_resume(this->pcnt_unit_);
+}
+
+void PulseMeterSensor::pcnt_adapt_limit_(float pulse_width_us) {
+  const uint32_t limit = this->pcnt_limit_;
+  const float desired = PCNT_EVENT_PERIOD_US / pulse_width_us;
+  // Only change the limit when it's off by a lot, every change loses the pulses of a few µs
+  if (desired >= 2.0f * limit || desired * 4.0f < limit)
+    this->pcnt_set_limit_(clamp<float>(desired, 1.0f, PCNT_MAX_LIMIT));
+}
+
+void IRAM_ATTR PulseMeterSensor::pcnt_intr(void *arg) {
+  // This is an interrupt handler - we can't call any virtual method from this method
+  const uint32_t now = micros();
+  auto *sensor = static_cast<PulseMeterSensor *>(arg);
+  auto &set = *sensor->set_;
+
+  set.last_detected_edge_us_ = now;
+  set.last_rising_edge_us_ = now;
+  set.count_ += sensor->pcnt_limit_ + sensor->pcnt_carry_;
+  sensor->pcnt_carry_ = 0;
+}
+#endif
+
 }  // namespace pulse_meter
 }  // namespace esphome
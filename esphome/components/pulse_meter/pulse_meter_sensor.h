@@ -7,6 +7,12 @@
 
 #include <cinttypes>
 
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include "esphome/components/esp32/pcnt.h"
+#include <driver/pcnt.h>
+#define HAS_PCNT
+#endif
+
 namespace esphome {
 namespace pulse_meter {
 
@@ -22,6 +28,10 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
   void set_filter_mode(InternalFilterMode mode) { this->filter_mode_ = mode; }
+#ifdef HAS_PCNT
+  /// Count the pulses in a PCNT unit, which only interrupts once every few pulses at high rates.
+  void set_use_pcnt(bool use_pcnt) { this->use_pcnt_ = use_pcnt; }
+#endif
 
   void set_total_pulses(uint32_t pulses);
 
@@ -33,6 +43,14 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
  protected:
   static void edge_intr(PulseMeterSensor *sensor);
   static void pulse_intr(PulseMeterSensor *sensor);
+#ifdef HAS_PCNT
+  static void pcnt_intr(void *arg);
+
+  bool pcnt_setup_();
+  /// Interrupt every `limit` pulses from now on, the pulses counted so far are added to the next interrupt.
+  void pcnt_set_limit_(uint16_t limit);
+  void pcnt_adapt_limit_(float pulse_width_us);
+#endif
 
   InternalGPIOPin *pin_{nullptr};
   uint32_t filter_us_ = 0;
@@ -77,6 +95,15 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
     bool last_pin_val_ = false;
   };
   PulseState pulse_state_{};
+
+#ifdef HAS_PCNT
+  bool use_pcnt_{false};
+  pcnt_unit_t pcnt_unit_{PCNT_UNIT_0};
+  /// Pulses per interrupt, the high limit of the PCNT unit
+  volatile uint16_t pcnt_limit_{1};
+  /// Pulses counted before the last limit change, which the next interrupt adds
+  volatile uint32_t pcnt_carry_{0};
+#endif
 };
 
 }  // namespace pulse_meter
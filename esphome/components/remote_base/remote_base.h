@@ -47,10 +47,13 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode)
-      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode) {}
+  /// @param frame_id Identifies the received frame for decode_cached(), 0 if the data should not be cached.
+  explicit RemoteReceiveData(const RawTimings &data, uint32_t tolerance, ToleranceMode tolerance_mode,
+                             uint32_t frame_id = 0)
+      : data_(data), index_(0), tolerance_(tolerance), tolerance_mode_(tolerance_mode), frame_id_(frame_id) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
+  uint32_t get_frame_id() const { return this->frame_id_; }
   uint32_t get_index() const { return index_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
@@ -99,6 +102,7 @@ class RemoteReceiveData {
   uint32_t index_;
   uint32_t tolerance_;
   ToleranceMode tolerance_mode_;
+  uint32_t frame_id_;
 };
 
 class RemoteComponentBase {
@@ -134,6 +138,12 @@ class RemoteRMTChannel {
 };
 #endif
 
+/// Decides whether the frames of a transmitter are sent, see RemoteTransmitterBase::set_send_filter().
+class RemoteTransmitFilter {
+ public:
+  virtual bool should_send(const RemoteTransmitData &data) = 0;
+};
+
 class RemoteTransmitterBase : public RemoteComponentBase {
  public:
   RemoteTransmitterBase(InternalGPIOPin *pin) : RemoteComponentBase(pin) {}
@@ -164,6 +174,9 @@ class RemoteTransmitterBase : public RemoteComponentBase {
     call.perform();
   }
 
+  /// Ask `filter` before sending each of the following frames, nullptr to send all of them again.
+  void set_send_filter(RemoteTransmitFilter *filter) { this->send_filter_ = filter; }
+
  protected:
   void send_(uint32_t send_times, uint32_t send_wait);
   virtual void send_internal(uint32_t send_times, uint32_t send_wait) = 0;
@@ -171,6 +184,7 @@ class RemoteTransmitterBase : public RemoteComponentBase {
 
   /// Use same vector for all transmits, avoids many allocations
   RemoteTransmitData temp_;
+  RemoteTransmitFilter *send_filter_{nullptr};
 };
 
 class RemoteReceiverListener {
@@ -198,9 +212,19 @@ class RemoteReceiverBase : public RemoteComponentBase {
   void call_listeners_();
   void call_dumpers_();
   void call_listeners_dumpers_() {
+    // a new id for every frame of every receiver, 0 is reserved for uncached data
+    if (++next_frame_id_ == 0)
+      ++next_frame_id_;
+    this->frame_id_ = next_frame_id_;
     this->call_listeners_();
     this->call_dumpers_();
   }
+  RemoteReceiveData frame_data_() const {
+    return RemoteReceiveData(this->temp_, this->tolerance_, this->tolerance_mode_, this->frame_id_);
+  }
+
+  inline static uint32_t next_frame_id_{0};
+  uint32_t frame_id_{0};
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
@@ -230,14 +254,27 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const ProtocolData &data) = 0;
 };
 
+/** Decode a frame with protocol T only once, however many triggers, binary sensors and dumpers use the protocol.
+ *
+ * The result of the last frame is kept per protocol and reused while the frame id of src stays the same.
+ */
+template<typename T> optional<typename T::ProtocolData> decode_cached(RemoteReceiveData src) {
+  static uint32_t frame_id = 0;
+  static optional<typename T::ProtocolData> result;
+  if (src.get_frame_id() == 0 || src.get_frame_id() != frame_id) {
+    result = T().decode(src);
+    frame_id = src.get_frame_id();
+  }
+  return result;
+}
+
 template<typename T> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_cached<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -252,8 +289,7 @@ template<typename T>
 class RemoteReceiverTrigger : public Trigger<typename T::ProtocolData>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_cached<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -294,11 +330,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public RemoteTransm
 template<typename T> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_cached<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
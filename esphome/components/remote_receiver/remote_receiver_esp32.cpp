@@ -101,7 +101,9 @@ void RemoteReceiverComponent::decode_rmt_(rmt_item32_t *item, size_t len) {
   int32_t multiplier = this->pin_->is_inverted() ? -1 : 1;
   size_t item_count = len / sizeof(rmt_item32_t);
   uint32_t filter_ticks = this->from_microseconds_(this->filter_us_);
+  const uint32_t ticks_per_ten_us = 80000000u / this->clock_divider_ / 100000u;
 
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "START:");
   for (size_t i = 0; i < item_count; i++) {
     if (item[i].level0) {
@@ -120,48 +122,33 @@ void RemoteReceiverComponent::decode_rmt_(rmt_item32_t *item, size_t len) {
     }
   }
   ESP_LOGVV(TAG, "\n");
+#endif
 
+  // temp_ keeps its capacity between frames, this only allocates for a frame longer than all before it
   this->temp_.reserve(item_count * 2);  // each RMT item has 2 pulses
-  for (size_t i = 0; i < item_count; i++) {
-    if (item[i].duration0 == 0u) {
-      // Do nothing
-    } else if ((bool(item[i].level0) == prev_level) || (item[i].duration0 < filter_ticks)) {
-      prev_length += item[i].duration0;
-    } else {
-      if (prev_length > 0) {
-        if (prev_level) {
-          this->temp_.push_back(this->to_microseconds_(prev_length) * multiplier);
-        } else {
-          this->temp_.push_back(-int32_t(this->to_microseconds_(prev_length)) * multiplier);
-        }
-      }
-      prev_level = bool(item[i].level0);
-      prev_length = item[i].duration0;
-    }
-
-    if (item[i].duration1 == 0u) {
-      // Do nothing
-    } else if ((bool(item[i].level1) == prev_level) || (item[i].duration1 < filter_ticks)) {
-      prev_length += item[i].duration1;
-    } else {
-      if (prev_length > 0) {
-        if (prev_level) {
-          this->temp_.push_back(this->to_microseconds_(prev_length) * multiplier);
-        } else {
-          this->temp_.push_back(-int32_t(this->to_microseconds_(prev_length)) * multiplier);
-        }
-      }
-      prev_level = bool(item[i].level1);
-      prev_length = item[i].duration1;
-    }
-  }
-  if (prev_length > 0) {
-    if (prev_level) {
-      this->temp_.push_back(this->to_microseconds_(prev_length) * multiplier);
-    } else {
-      this->temp_.push_back(-int32_t(this->to_microseconds_(prev_length)) * multiplier);
+  auto push = [this, multiplier, ticks_per_ten_us](bool level, uint32_t ticks) {
+    int32_t length = int32_t((ticks * 10) / ticks_per_ten_us) * multiplier;
+    this->temp_.push_back(level ? length : -length);
+  };
+  // merges pulses of the same level and the ones shorter than the filter into the previous pulse
+  auto add = [&](bool level, uint32_t ticks) {
+    if (ticks == 0u)
+      return;
+    if (level == prev_level || ticks < filter_ticks) {
+      prev_length += ticks;
+      return;
     }
+    if (prev_length > 0)
+      push(prev_level, prev_length);
+    prev_level = level;
+    prev_length = ticks;
+  };
+  for (size_t i = 0; i < item_count; i++) {
+    add(bool(item[i].level0), item[i].duration0);
+    add(bool(item[i].level1), item[i].duration1);
   }
+  if (prev_length > 0)
+    push(prev_level, prev_length);
 }
 
 }  // namespace remote_receiver
@@ -8,6 +8,7 @@ AUTO_LOAD = ["remote_base"]
 
 CONF_ON_TRANSMIT = "on_transmit"
 CONF_ON_COMPLETE = "on_complete"
+CONF_NON_BLOCKING = "non_blocking"
 
 remote_transmitter_ns = cg.esphome_ns.namespace("remote_transmitter")
 RemoteTransmitterComponent = remote_transmitter_ns.class_(
@@ -23,6 +24,7 @@ CONFIG_SCHEMA = cv.Schema(
             cv.percentage_int, cv.Range(min=1, max=100)
         ),
         cv.Optional(CONF_RMT_CHANNEL): esp32_rmt.validate_rmt_channel(tx=True),
+        cv.Optional(CONF_NON_BLOCKING): cv.All(cv.only_on_esp32, cv.boolean),
         cv.Optional(CONF_ON_TRANSMIT): automation.validate_automation(single=True),
         cv.Optional(CONF_ON_COMPLETE): automation.validate_automation(single=True),
     }
@@ -38,6 +40,8 @@ async def to_code(config):
     await cg.register_component(var, config)
 
     cg.add(var.set_carrier_duty_percent(config[CONF_CARRIER_DUTY_PERCENT]))
+    if CONF_NON_BLOCKING in config:
+        cg.add(var.set_non_blocking(config[CONF_NON_BLOCKING]))
 
     if on_transmit_config := config.get(CONF_ON_TRANSMIT):
         await automation.build_automation(
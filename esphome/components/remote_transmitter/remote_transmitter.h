@@ -3,6 +3,7 @@
 #include "esphome/components/remote_base/remote_base.h"
 #include "esphome/core/component.h"
 
+#include <deque>
 #include <vector>
 
 namespace esphome {
@@ -33,6 +34,15 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
   void set_carrier_duty_percent(uint8_t carrier_duty_percent) { this->carrier_duty_percent_ = carrier_duty_percent; }
 
+#ifdef USE_ESP32
+  void loop() override;
+
+  /// Queue transmissions and send them, including their repeats and gaps, from loop() instead of blocking.
+  void set_non_blocking(bool non_blocking) { this->non_blocking_ = non_blocking; }
+  /// Number of transmissions waiting or being sent, only used in non blocking mode.
+  size_t get_queue_size() const { return this->queue_.size(); }
+#endif
+
   Trigger<> *get_transmit_trigger() const { return this->transmit_trigger_; };
   Trigger<> *get_complete_trigger() const { return this->complete_trigger_; };
 
@@ -51,13 +61,33 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
 #ifdef USE_ESP32
   void configure_rmt_();
+  void convert_rmt_(std::vector<rmt_item32_t> &items);
+  void set_carrier_frequency_(uint32_t carrier_frequency);
+  void queue_repeat_done_();
+
+  struct QueuedTransmit {
+    std::vector<rmt_item32_t> items;
+    uint32_t carrier_frequency;
+    uint32_t send_times;
+    uint32_t send_wait;
+  };
+  static constexpr size_t MAX_QUEUE_SIZE = 8;
 
   uint32_t current_carrier_frequency_{38000};
   bool initialized_{false};
   std::vector<rmt_item32_t> rmt_temp_;
+  /// Timings rmt_temp_ was converted from, scenes usually send the same codes again
+  std::vector<int32_t> rmt_source_;
   esp_err_t error_code_{ESP_OK};
   std::string error_string_{""};
   bool inverted_{false};
+  bool non_blocking_{false};
+  /// The front entry is the one being sent
+  std::deque<QueuedTransmit> queue_;
+  bool queue_started_{false};
+  bool queue_transmitting_{false};
+  uint32_t queue_done_time_{0};
+  HighFrequencyLoopRequester high_freq_;
 #endif
   uint8_t carrier_duty_percent_;
 
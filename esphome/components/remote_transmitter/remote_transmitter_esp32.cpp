@@ -82,13 +82,104 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
   if (this->is_failed())
     return;
 
-  if (this->current_carrier_frequency_ != this->temp_.get_carrier_frequency()) {
-    this->current_carrier_frequency_ = this->temp_.get_carrier_frequency();
+  if (this->non_blocking_) {
+    if (send_times == 0)
+      return;
+    if (this->queue_.size() >= MAX_QUEUE_SIZE) {
+      ESP_LOGW(TAG, "Transmit queue full, dropping transmission");
+      return;
+    }
+    QueuedTransmit transmit{{}, this->temp_.get_carrier_frequency(), send_times, send_wait};
+    this->convert_rmt_(transmit.items);
+    if (transmit.items.empty()) {
+      ESP_LOGE(TAG, "Empty data");
+      return;
+    }
+    this->queue_.push_back(std::move(transmit));
+    this->high_freq_.start();
+    this->loop();
+    return;
+  }
+
+  this->set_carrier_frequency_(this->temp_.get_carrier_frequency());
+
+  if (this->temp_.get_data() != this->rmt_source_ || this->rmt_temp_.empty()) {
+    this->rmt_source_ = this->temp_.get_data();
+    this->convert_rmt_(this->rmt_temp_);
+  }
+
+  if ((this->rmt_temp_.data() == nullptr) || this->rmt_temp_.empty()) {
+    ESP_LOGE(TAG, "Empty data");
+    return;
+  }
+  this->transmit_trigger_->trigger();
+  for (uint32_t i = 0; i < send_times; i++) {
+    esp_err_t error = rmt_write_items(this->channel_, this->rmt_temp_.data(), this->rmt_temp_.size(), true);
+    if (error != ESP_OK) {
+      ESP_LOGW(TAG, "rmt_write_items failed: %s", esp_err_to_name(error));
+      this->status_set_warning();
+    } else {
+      this->status_clear_warning();
+    }
+    if (i + 1 < send_times)
+      delayMicroseconds(send_wait);
+  }
+  this->complete_trigger_->trigger();
+}
+
+void RemoteTransmitterComponent::loop() {
+  if (this->queue_.empty())
+    return;
+  if (this->queue_transmitting_) {
+    if (rmt_wait_tx_done(this->channel_, 0) != ESP_OK)
+      return;
+    this->queue_transmitting_ = false;
+    this->queue_repeat_done_();
+    return;
+  }
+  auto &front = this->queue_.front();
+  if (this->queue_started_) {
+    // gap between repeats
+    if (micros() - this->queue_done_time_ < front.send_wait)
+      return;
+  } else {
+    this->set_carrier_frequency_(front.carrier_frequency);
+    this->queue_started_ = true;
+    this->transmit_trigger_->trigger();
+  }
+  esp_err_t error = rmt_write_items(this->channel_, front.items.data(), front.items.size(), false);
+  if (error != ESP_OK) {
+    ESP_LOGW(TAG, "rmt_write_items failed: %s", esp_err_to_name(error));
+    this->status_set_warning();
+    // count it as sent, so a failing channel can't stall the queue
+    this->queue_repeat_done_();
+    return;
+  }
+  this->status_clear_warning();
+  this->queue_transmitting_ = true;
+}
+
+void RemoteTransmitterComponent::queue_repeat_done_() {
+  this->queue_done_time_ = micros();
+  if (--this->queue_.front().send_times != 0)
+    return;
+  this->queue_.pop_front();
+  this->queue_started_ = false;
+  this->complete_trigger_->trigger();
+  if (this->queue_.empty())
+    this->high_freq_.stop();
+}
+
+void RemoteTransmitterComponent::set_carrier_frequency_(uint32_t carrier_frequency) {
+  if (this->current_carrier_frequency_ != carrier_frequency) {
+    this->current_carrier_frequency_ = carrier_frequency;
     this->configure_rmt_();
   }
+}
 
-  this->rmt_temp_.clear();
-  this->rmt_temp_.reserve((this->temp_.get_data().size() + 1) / 2);
+void RemoteTransmitterComponent::convert_rmt_(std::vector<rmt_item32_t> &items) {
+  items.clear();
+  items.reserve((this->temp_.get_data().size() + 1) / 2);
   uint32_t rmt_i = 0;
   rmt_item32_t rmt_item;
 
@@ -108,7 +199,7 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
       } else {
         rmt_item.level1 = static_cast<uint32_t>(level ^ this->inverted_);
         rmt_item.duration1 = static_cast<uint32_t>(item);
-        this->rmt_temp_.push_back(rmt_item);
+        items.push_back(rmt_item);
       }
       rmt_i++;
     } while (val != 0);
@@ -117,26 +208,8 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
   if (rmt_i % 2 == 1) {
     rmt_item.level1 = 0;
     rmt_item.duration1 = 0;
-    this->rmt_temp_.push_back(rmt_item);
-  }
-
-  if ((this->rmt_temp_.data() == nullptr) || this->rmt_temp_.empty()) {
-    ESP_LOGE(TAG, "Empty data");
-    return;
-  }
-  this->transmit_trigger_->trigger();
-  for (uint32_t i = 0; i < send_times; i++) {
-    esp_err_t error = rmt_write_items(this->channel_, this->rmt_temp_.data(), this->rmt_temp_.size(), true);
-    if (error != ESP_OK) {
-      ESP_LOGW(TAG, "rmt_write_items failed: %s", esp_err_to_name(error));
-      this->status_set_warning();
-    } else {
-      this->status_clear_warning();
-    }
-    if (i + 1 < send_times)
-      delayMicroseconds(send_wait);
+    items.push_back(rmt_item);
   }
-  this->complete_trigger_->trigger();
 }
 
 }  // namespace remote_transmitter
@@ -2,11 +2,18 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace rotary_encoder {
 
 static const char *const TAG = "rotary_encoder";
 
+#ifdef HAS_PCNT
+/// The PCNT counter wraps to 0 at +-PCNT_LIMIT and raises an interrupt
+static const int16_t PCNT_LIMIT = 16384;
+#endif
+
 // based on https://github.com/jkDesignDE/MechInputs/blob/master/QEIx4.cpp
 static const uint8_t STATE_LUT_MASK = 0x1C;  // clears upper counter increment/decrement bits and pin states
 static const uint16_t STATE_PIN_A_HIGH = 0x01;
@@ -144,6 +151,16 @@ void RotaryEncoderSensor::setup() {
   this->store_.counter = initial_value;
   this->store_.last_read = initial_value;
 
+#ifdef HAS_PCNT
+  if (this->use_pcnt_) {
+    if (this->pin_i_ != nullptr)
+      this->pin_i_->setup();
+    if (!this->pcnt_setup_())
+      this->mark_failed();
+    return;
+  }
+#endif
+
   this->pin_a_->setup();
   this->store_.pin_a = this->pin_a_->to_isr();
   this->pin_b_->setup();
@@ -161,6 +178,13 @@ void RotaryEncoderSensor::dump_config() {
   LOG_PIN("  Pin A: ", this->pin_a_);
   LOG_PIN("  Pin B: ", this->pin_b_);
   LOG_PIN("  Pin I: ", this->pin_i_);
+#ifdef HAS_PCNT
+  if (this->use_pcnt_) {
+    ESP_LOGCONFIG(TAG, "  PCNT Unit Number: %u", this->pcnt_unit_);
+    ESP_LOGCONFIG(TAG, "  Filter: %" PRIu32 "us", this->filter_us_);
+  }
+  LOG_SENSOR("  ", "Velocity", this->velocity_sensor_);
+#endif
 
   const LogString *restore_mode = LOG_STR("");
   switch (this->restore_mode_) {
@@ -186,6 +210,31 @@ void RotaryEncoderSensor::dump_config() {
   }
 }
 void RotaryEncoderSensor::loop() {
+#ifdef HAS_PCNT
+  if (this->use_pcnt_) {
+    this->pcnt_loop_();
+  } else
+#endif
+  {
+    this->isr_loop_();
+  }
+
+  if (this->pin_i_ != nullptr && this->pin_i_->digital_read()) {
+    this->store_.counter = 0;
+  }
+  int counter = this->store_.counter;
+  if (this->store_.last_read != counter || this->publish_initial_value_) {
+    if (this->restore_mode_ == ROTARY_ENCODER_RESTORE_DEFAULT_ZERO) {
+      this->rtc_.save(&counter);
+    }
+    this->store_.last_read = counter;
+    this->publish_state(counter);
+    this->listeners_.call(counter);
+    this->publish_initial_value_ = false;
+  }
+}
+
+void RotaryEncoderSensor::isr_loop_() {
   std::array<int8_t, 8> rotation_events;
   bool rotation_events_overflow;
   {
@@ -215,22 +264,125 @@ void RotaryEncoderSensor::loop() {
       }
     }
   }
+}
 
-  if (this->pin_i_ != nullptr && this->pin_i_->digital_read()) {
-    this->store_.counter = 0;
+#ifdef HAS_PCNT
+bool RotaryEncoderSensor::pcnt_setup_() {
+  if (!esp32::allocate_pcnt_unit(&this->pcnt_unit_)) {
+    ESP_LOGE(TAG, "No PCNT unit left");
+    return false;
   }
-  int counter = this->store_.counter;
-  if (this->store_.last_read != counter || this->publish_initial_value_) {
-    if (this->restore_mode_ == ROTARY_ENCODER_RESTORE_DEFAULT_ZERO) {
-      this->rtc_.save(&counter);
+  this->pin_a_->setup();
+  this->pin_b_->setup();
+
+  // Channel 0 counts the edges of A, the level of B gives the direction. A rising while B is low is clockwise.
+  pcnt_config_t pcnt_config = {
+      .pulse_gpio_num = this->pin_a_->get_pin(),
+      .ctrl_gpio_num = this->pin_b_->get_pin(),
+      .lctrl_mode = PCNT_MODE_REVERSE,
+      .hctrl_mode = PCNT_MODE_KEEP,
+      .pos_mode = PCNT_COUNT_DEC,
+      .neg_mode = this->store_.resolution == ROTARY_ENCODER_1_PULSE_PER_CYCLE ? PCNT_COUNT_DIS : PCNT_COUNT_INC,
+      .counter_h_lim = PCNT_LIMIT,
+      .counter_l_lim = -PCNT_LIMIT,
+      .unit = this->pcnt_unit_,
+      .channel = PCNT_CHANNEL_0,
+  };
+  esp_err_t error = pcnt_unit_config(&pcnt_config);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  if (this->store_.resolution == ROTARY_ENCODER_4_PULSES_PER_CYCLE) {
+    // Channel 1 counts the edges of B, the level of A gives the direction
+    pcnt_config.pulse_gpio_num = this->pin_b_->get_pin();
+    pcnt_config.ctrl_gpio_num = this->pin_a_->get_pin();
+    pcnt_config.pos_mode = PCNT_COUNT_INC;
+    pcnt_config.neg_mode = PCNT_COUNT_DEC;
+    pcnt_config.channel = PCNT_CHANNEL_1;
+    error = pcnt_unit_config(&pcnt_config);
+    if (error != ESP_OK) {
+      ESP_LOGE(TAG, "Configuring PCNT failed: %s", esp_err_to_name(error));
+      return false;
     }
-    this->store_.last_read = counter;
-    this->publish_state(counter);
-    this->listeners_.call(counter);
-    this->publish_initial_value_ = false;
   }
+
+  if (this->filter_us_ != 0) {
+    // The glitch filter counts APB clock cycles
+    const uint16_t filter_val = std::min<uint32_t>(this->filter_us_ * 80u, 1023u);
+    pcnt_set_filter_value(this->pcnt_unit_, filter_val);
+    pcnt_filter_enable(this->pcnt_unit_);
+  }
+
+  error = pcnt_isr_service_install(0);
+  if (error != ESP_OK && error != ESP_ERR_INVALID_STATE) {
+    ESP_LOGE(TAG, "Installing the PCNT interrupt service failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  error = pcnt_isr_handler_add(this->pcnt_unit_, RotaryEncoderSensor::pcnt_intr, this);
+  if (error != ESP_OK) {
+    ESP_LOGE(TAG, "Adding the PCNT interrupt handler failed: %s", esp_err_to_name(error));
+    return false;
+  }
+  pcnt_event_enable(this->pcnt_unit_, PCNT_EVT_H_LIM);
+  pcnt_event_enable(this->pcnt_unit_, PCNT_EVT_L_LIM);
+  pcnt_counter_pause(this->pcnt_unit_);
+  pcnt_counter_clear(this->pcnt_unit_);
+  pcnt_counter_resume(this->pcnt_unit_);
+  this->velocity_start_ = millis();
+  return true;
+}
+
+void IRAM_ATTR RotaryEncoderSensor::pcnt_intr(void *arg) {
+  auto *sensor = static_cast<RotaryEncoderSensor *>(arg);
+  uint32_t status = 0;
+  pcnt_get_event_status(sensor->pcnt_unit_, &status);
+  if (status & PCNT_EVT_H_LIM) {
+    sensor->pcnt_overflow_ += PCNT_LIMIT;
+  } else if (status & PCNT_EVT_L_LIM) {
+    sensor->pcnt_overflow_ -= PCNT_LIMIT;
+  }
+}
+
+int32_t RotaryEncoderSensor::pcnt_read_() {
+  int32_t overflow;
+  int16_t count;
+  // Read again if an overflow came in between
+  do {
+    overflow = this->pcnt_overflow_;
+    pcnt_get_counter_value(this->pcnt_unit_, &count);
+  } while (overflow != this->pcnt_overflow_);
+  return overflow + count;
 }
 
+void RotaryEncoderSensor::pcnt_loop_() {
+  const int32_t total = this->pcnt_read_();
+  int32_t steps = total - this->pcnt_last_;
+  this->pcnt_last_ = total;
+
+  if (this->velocity_sensor_ != nullptr) {
+    this->velocity_steps_ += steps;
+    const uint32_t now = millis();
+    const uint32_t elapsed = now - this->velocity_start_;
+    if (elapsed >= this->velocity_interval_) {
+      this->velocity_sensor_->publish_state(this->velocity_steps_ * 1000.0f / elapsed);
+      this->velocity_steps_ = 0;
+      this->velocity_start_ = now;
+    }
+  }
+
+  if (steps == 0)
+    return;
+  // Same limits as the interrupt: the counter stops at them, the triggers keep firing
+  const int64_t counter = int64_t(this->store_.counter) + steps;
+  this->store_.counter = clamp<int64_t>(counter, this->store_.min_value, this->store_.max_value);
+  for (; steps > 0; steps--)
+    this->on_clockwise_callback_.call();
+  for (; steps < 0; steps++)
+    this->on_anticlockwise_callback_.call();
+}
+#endif
+
 float RotaryEncoderSensor::get_setup_priority() const { return setup_priority::DATA; }
 void RotaryEncoderSensor::set_restore_mode(RotaryEncoderRestoreMode restore_mode) {
   this->restore_mode_ = restore_mode;
@@ -7,6 +7,12 @@
 #include "esphome/core/automation.h"
 #include "esphome/components/sensor/sensor.h"
 
+#if defined(USE_ESP32) && !defined(USE_ESP32_VARIANT_ESP32C3)
+#include "esphome/components/esp32/pcnt.h"
+#include <driver/pcnt.h>
+#define HAS_PCNT
+#endif
+
 namespace esphome {
 namespace rotary_encoder {
 
@@ -75,6 +81,17 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
   void set_min_value(int32_t min_value);
   void set_max_value(int32_t max_value);
   void set_publish_initial_value(bool publish_initial_value) { publish_initial_value_ = publish_initial_value; }
+#ifdef HAS_PCNT
+  /// Decode the quadrature in a PCNT unit, which costs no CPU time per edge.
+  void set_use_pcnt(bool use_pcnt) { this->use_pcnt_ = use_pcnt; }
+  /// Glitch filter of the PCNT unit, pulses shorter than this are ignored.
+  void set_filter_us(uint32_t filter_us) { this->filter_us_ = filter_us; }
+  /// Publish the speed in steps per second, every `interval` ms.
+  void set_velocity_sensor(sensor::Sensor *velocity_sensor, uint32_t interval) {
+    this->velocity_sensor_ = velocity_sensor;
+    this->velocity_interval_ = interval;
+  }
+#endif
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -104,6 +121,28 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
 
   RotaryEncoderSensorStore store_{};
 
+  /// Handle the rotations recorded by the pin interrupts.
+  void isr_loop_();
+#ifdef HAS_PCNT
+  static void pcnt_intr(void *arg);
+  bool pcnt_setup_();
+  /// Steps counted by the PCNT unit since setup, including the overflows.
+  int32_t pcnt_read_();
+  /// Apply the steps counted since the last loop() to the counter and the triggers.
+  void pcnt_loop_();
+
+  bool use_pcnt_{false};
+  uint32_t filter_us_{0};
+  pcnt_unit_t pcnt_unit_{PCNT_UNIT_0};
+  /// Steps in the overflows of the unit, its counter wraps to 0 at its limits
+  volatile int32_t pcnt_overflow_{0};
+  int32_t pcnt_last_{0};
+  sensor::Sensor *velocity_sensor_{nullptr};
+  uint32_t velocity_interval_{1000};
+  uint32_t velocity_start_{0};
+  int32_t velocity_steps_{0};
+#endif
+
   CallbackManager<void()> on_clockwise_callback_{};
   CallbackManager<void()> on_anticlockwise_callback_{};
   CallbackManager<void(int32_t)> listeners_{};
@@ -2,8 +2,12 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins, automation
 from esphome.components import sensor
+from esphome.components.esp32 import get_esp32_variant
+from esphome.components.esp32.const import VARIANT_ESP32C3
 from esphome.const import (
     CONF_ID,
+    CONF_INTERNAL_FILTER,
+    CONF_UPDATE_INTERVAL,
     CONF_RESOLUTION,
     CONF_MIN_VALUE,
     CONF_MAX_VALUE,
@@ -14,7 +18,9 @@ from esphome.const import (
     CONF_PIN_B,
     CONF_TRIGGER_ID,
     CONF_RESTORE_MODE,
+    STATE_CLASS_MEASUREMENT,
 )
+from esphome.core import CORE
 
 rotary_encoder_ns = cg.esphome_ns.namespace("rotary_encoder")
 
@@ -35,6 +41,9 @@ CONF_PIN_RESET = "pin_reset"
 CONF_ON_CLOCKWISE = "on_clockwise"
 CONF_ON_ANTICLOCKWISE = "on_anticlockwise"
 CONF_PUBLISH_INITIAL_VALUE = "publish_initial_value"
+CONF_USE_PCNT = "use_pcnt"
+CONF_VELOCITY = "velocity"
+UNIT_STEPS_PER_SECOND = "steps/s"
 
 RotaryEncoderSensor = rotary_encoder_ns.class_(
     "RotaryEncoderSensor", sensor.Sensor, cg.Component
@@ -62,6 +71,23 @@ def validate_min_max_value(config):
     return config
 
 
+def validate_pcnt(config):
+    if not config[CONF_USE_PCNT]:
+        for key in (CONF_INTERNAL_FILTER, CONF_VELOCITY):
+            if key in config:
+                raise cv.Invalid(f"{key} requires {CONF_USE_PCNT}", [key])
+        return config
+    if not CORE.is_esp32 or get_esp32_variant() == VARIANT_ESP32C3:
+        raise cv.Invalid("Hardware PCNT is not available on this chip", [CONF_USE_PCNT])
+    filter_ = config.get(CONF_INTERNAL_FILTER)
+    if filter_ is not None and filter_.total_microseconds > 13:
+        raise cv.Invalid(
+            "Maximum internal filter value when using ESP32 hardware PCNT is 13us",
+            [CONF_INTERNAL_FILTER],
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     sensor.sensor_schema(
         RotaryEncoderSensor,
@@ -78,6 +104,19 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_MIN_VALUE): cv.int_,
             cv.Optional(CONF_MAX_VALUE): cv.int_,
             cv.Optional(CONF_PUBLISH_INITIAL_VALUE, default=False): cv.boolean,
+            cv.Optional(CONF_USE_PCNT, default=False): cv.boolean,
+            cv.Optional(CONF_INTERNAL_FILTER): cv.positive_time_period_microseconds,
+            cv.Optional(CONF_VELOCITY): sensor.sensor_schema(
+                unit_of_measurement=UNIT_STEPS_PER_SECOND,
+                accuracy_decimals=1,
+                state_class=STATE_CLASS_MEASUREMENT,
+            ).extend(
+                {
+                    cv.Optional(
+                        CONF_UPDATE_INTERVAL, default="1s"
+                    ): cv.positive_time_period_milliseconds,
+                }
+            ),
             cv.Optional(CONF_RESTORE_MODE, default="RESTORE_DEFAULT_ZERO"): cv.enum(
                 RESTORE_MODES, upper=True, space="_"
             ),
@@ -99,6 +138,7 @@ CONFIG_SCHEMA = cv.All(
     )
     .extend(cv.COMPONENT_SCHEMA),
     validate_min_max_value,
+    validate_pcnt,
 )
 
 
@@ -121,6 +161,17 @@ async def to_code(config):
         cg.add(var.set_min_value(config[CONF_MIN_VALUE]))
     if CONF_MAX_VALUE in config:
         cg.add(var.set_max_value(config[CONF_MAX_VALUE]))
+    if config[CONF_USE_PCNT]:
+        cg.add(var.set_use_pcnt(True))
+        if CONF_INTERNAL_FILTER in config:
+            cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
+        if velocity_config := config.get(CONF_VELOCITY):
+            velocity = await sensor.new_sensor(velocity_config)
+            cg.add(
+                var.set_velocity_sensor(
+                    velocity, velocity_config[CONF_UPDATE_INTERVAL].total_milliseconds
+                )
+            )
 
     for conf in config.get(CONF_ON_CLOCKWISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
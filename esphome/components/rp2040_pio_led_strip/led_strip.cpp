@@ -150,8 +150,12 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
     return;
   }
 
+  // the previous frame is still being sent, try again next loop instead of blocking the other strips
+  if (!sem_try_acquire(&RP2040PIOLEDStripLightOutput::dma_write_complete_sem_[this->dma_chan_])) {
+    this->schedule_show();
+    return;
+  }
   // the bits are already in the correct order for the pio program so we can just copy the buffer using DMA
-  sem_acquire_blocking(&RP2040PIOLEDStripLightOutput::dma_write_complete_sem_[this->dma_chan_]);
   dma_channel_transfer_from_buffer_now(this->dma_chan_, this->buf_, this->get_buffer_size_());
 }
 
@@ -4,7 +4,10 @@
 #include "esphome/core/component.h"
 #include "esphome/core/log.h"
 
-#include <queue>
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace esphome {
 namespace script {
 
@@ -98,8 +101,10 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
       }
 
       this->esp_logd_(__LINE__, "Script '%s' queueing new instance (mode: queued)", this->name_.c_str());
+      if (size_t(this->num_runs_) == this->var_queue_.size())
+        this->grow_queue_();
+      this->var_queue_[(this->queue_head_ + this->num_runs_) % this->var_queue_.size()] = std::make_tuple(x...);
       this->num_runs_++;
-      this->var_queue_.push(std::make_tuple(x...));
       return;
     }
 
@@ -116,22 +121,38 @@ template<typename... Ts> class QueueingScript : public Script<Ts...>, public Com
   void loop() override {
     if (this->num_runs_ != 0 && !this->is_action_running()) {
       this->num_runs_--;
-      auto &vars = this->var_queue_.front();
-      this->var_queue_.pop();
+      auto vars = std::move(this->var_queue_[this->queue_head_]);
+      this->queue_head_ = (this->queue_head_ + 1) % this->var_queue_.size();
       this->trigger_tuple_(vars, typename gens<sizeof...(Ts)>::type());
     }
   }
 
-  void set_max_runs(int max_runs) { max_runs_ = max_runs; }
+  void set_max_runs(int max_runs) {
+    max_runs_ = max_runs;
+    // Every run but the active one can be queued, size the ring buffer for all of them up front
+    if (max_runs > 1)
+      this->var_queue_.resize(max_runs - 1);
+  }
 
  protected:
+  /// Only happens without max_runs, the queue then doubles whenever it's full.
+  void grow_queue_() {
+    std::vector<std::tuple<Ts...>> queue(std::max<size_t>(4, this->var_queue_.size() * 2));
+    for (int i = 0; i < this->num_runs_; i++)
+      queue[i] = std::move(this->var_queue_[(this->queue_head_ + i) % this->var_queue_.size()]);
+    this->var_queue_ = std::move(queue);
+    this->queue_head_ = 0;
+  }
+
   template<int... S> void trigger_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->trigger(std::get<S>(tuple)...);
   }
 
   int num_runs_ = 0;
   int max_runs_ = 0;
-  std::queue<std::tuple<Ts...>> var_queue_;
+  /// Ring buffer of the arguments of the queued runs, starting at queue_head_
+  std::vector<std::tuple<Ts...>> var_queue_;
+  size_t queue_head_ = 0;
 };
 
 /** A script type that executes new instances in parallel.
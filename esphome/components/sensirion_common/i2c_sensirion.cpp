@@ -95,33 +95,8 @@ bool SensirionI2CDevice::get_register_(uint16_t reg, CommandLen command_len, uin
 
 // The 8-bit CRC checksum is transmitted after each data word
 uint8_t SensirionI2CDevice::sht_crc_(uint16_t data) {
-  uint8_t bit;
-  uint8_t crc = 0xFF;
-#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-  crc ^= data >> 8;
-#else
-  crc ^= data & 0xFF;
-#endif
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80) {
-      crc = (crc << 1) ^ crc_polynomial_;
-    } else {
-      crc = (crc << 1);
-    }
-  }
-#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-  crc ^= data & 0xFF;
-#else
-  crc ^= data >> 8;
-#endif
-  for (bit = 8; bit > 0; --bit) {
-    if (crc & 0x80) {
-      crc = (crc << 1) ^ crc_polynomial_;
-    } else {
-      crc = (crc << 1);
-    }
-  }
-  return crc;
+  const uint8_t bytes[2] = {uint8_t(data >> 8), uint8_t(data & 0xFF)};
+  return crc8(bytes, 2, 0xFF, this->crc_polynomial_, true);
 }
 
 }  // namespace sensirion_common
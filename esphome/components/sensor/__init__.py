@@ -34,6 +34,7 @@ from esphome.const import (
     CONF_TO,
     CONF_TRIGGER_ID,
     CONF_TYPE,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_VALUE,
     CONF_WEB_SERVER_ID,
@@ -92,8 +93,8 @@ from esphome.const import (
     DEVICE_CLASS_WIND_SPEED,
     ENTITY_CATEGORY_CONFIG,
 )
-from esphome.core import CORE, coroutine_with_priority
-from esphome.cpp_generator import MockObjClass
+from esphome.core import CORE, ID, coroutine_with_priority
+from esphome.cpp_generator import FloatLiteral, LambdaExpression, MockObjClass
 from esphome.cpp_helpers import setup_entity
 from esphome.util import Registry
 
@@ -251,6 +252,7 @@ SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
 ClampFilter = sensor_ns.class_("ClampFilter", Filter)
 RoundFilter = sensor_ns.class_("RoundFilter", Filter)
 RoundMultipleFilter = sensor_ns.class_("RoundMultipleFilter", Filter)
+FusedFilter = sensor_ns.class_("FusedFilter", Filter)
 
 validate_unit_of_measurement = cv.string_strict
 validate_accuracy_decimals = cv.int_
@@ -637,6 +639,10 @@ def validate_calibrate_linear(config):
     ),
 )
 async def calibrate_linear_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_linear_functions(config))
+
+
+def _calibrate_linear_functions(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
 
@@ -646,7 +652,7 @@ async def calibrate_linear_filter_to_code(config, filter_id):
         linear_functions = [[k, b, float("NaN")]]
     elif config[CONF_METHOD] == "exact":
         linear_functions = map_linear(x, y)
-    return cg.new_Pvariable(filter_id, linear_functions)
+    return linear_functions
 
 
 CONF_DEGREE = "degree"
@@ -677,14 +683,17 @@ def validate_calibrate_polynomial(config):
     ),
 )
 async def calibrate_polynomial_filter_to_code(config, filter_id):
+    return cg.new_Pvariable(filter_id, _calibrate_polynomial_coefficients(config))
+
+
+def _calibrate_polynomial_coefficients(config):
     x = [conf[CONF_FROM] for conf in config[CONF_DATAPOINTS]]
     y = [conf[CONF_TO] for conf in config[CONF_DATAPOINTS]]
     degree = config[CONF_DEGREE]
     a = [[1] + [x_ ** (i + 1) for i in range(degree)] for x_ in x]
     # Column vector
     b = [[v] for v in y]
-    res = [v[0] for v in _lstsq(a, b)]
-    return cg.new_Pvariable(filter_id, res)
+    return [v[0] for v in _lstsq(a, b)]
 
 
 def validate_clamp(config):
@@ -753,8 +762,119 @@ async def round_multiple_filter_to_code(config, filter_id):
     )
 
 
+def _float(value):
+    return str(FloatLiteral(value))
+
+
+def _offset_code(config):
+    return [f"x = x + {_float(config)};"]
+
+
+def _multiply_code(config):
+    return [f"x = x * {_float(config)};"]
+
+
+def _calibrate_linear_code(config):
+    lines = []
+    for k, b, below in _calibrate_linear_functions(config):
+        apply = f"x = (x * {_float(k)}) + {_float(b)};"
+        if not math.isfinite(below):
+            lines.append(f"{'else ' if lines else ''}{apply}")
+            return lines
+        lines.append(f"{'else ' if lines else ''}if (x < {_float(below)}) {apply}")
+    lines.append("else x = NAN;")
+    return lines
+
+
+def _calibrate_polynomial_code(config):
+    lines = ["{", "float res = 0.0f;", "float p = 1.0f;"]
+    for coefficient in _calibrate_polynomial_coefficients(config):
+        lines += [f"res += p * {_float(coefficient)};", "p *= x;"]
+    return lines + ["x = res;", "}"]
+
+
+def _clamp_code(config):
+    drop = config[CONF_IGNORE_OUT_OF_RANGE]
+    checks = []
+    if math.isfinite(config[CONF_MIN_VALUE]):
+        min_value = _float(config[CONF_MIN_VALUE])
+        checks.append(
+            f"if (x < {min_value}) {'return {};' if drop else f'x = {min_value};'}"
+        )
+    if math.isfinite(config[CONF_MAX_VALUE]):
+        max_value = _float(config[CONF_MAX_VALUE])
+        checks.append(
+            f"{'else ' if checks else ''}if (x > {max_value}) "
+            f"{'return {};' if drop else f'x = {max_value};'}"
+        )
+    return ["if (std::isfinite(x)) {", *checks, "}"]
+
+
+def _round_code(config):
+    mult = f"powf(10.0f, {config[CONF_ACCURACY_DECIMALS]})"
+    return [f"if (std::isfinite(x)) x = roundf({mult} * x) / {mult};"]
+
+
+def _round_multiple_code(config):
+    return [
+        f"if (std::isfinite(x)) x = x - remainderf(x, {_float(config[CONF_MULTIPLE])});"
+    ]
+
+
+# Filters without state or runtime dependencies, consecutive ones are fused into a
+# single FusedFilter. Each entry returns the C++ statements applying the filter to x.
+STATELESS_FILTERS = {
+    "offset": _offset_code,
+    "multiply": _multiply_code,
+    "calibrate_linear": _calibrate_linear_code,
+    "calibrate_polynomial": _calibrate_polynomial_code,
+    "clamp": _clamp_code,
+    "round": _round_code,
+    "round_to_multiple_of": _round_multiple_code,
+}
+
+
+def _stateless_code(conf):
+    registry_entry, config = cg.extract_registry_entry_config(FILTER_REGISTRY, conf)
+    if (code := STATELESS_FILTERS.get(registry_entry.name)) is None:
+        return None
+    if registry_entry.name in ("offset", "multiply") and not math.isfinite(config):
+        return None
+    return code(config)
+
+
+async def _build_fused_filter(confs, codes):
+    if len(confs) == 1:
+        return await cg.build_registry_entry(FILTER_REGISTRY, confs[0])
+    parts = [f"{line}\n" for code in codes for line in code] + ["return x;"]
+    lambda_ = LambdaExpression(
+        parts,
+        [(cg.float_, "x")],
+        capture="",
+        return_type=cg.optional.template(cg.float_),
+    )
+    filter_id = ID(
+        f"{confs[0][CONF_TYPE_ID].id}_fused", is_declaration=True, type=FusedFilter
+    )
+    return cg.new_Pvariable(filter_id, lambda_)
+
+
 async def build_filters(config):
-    return await cg.build_registry_list(FILTER_REGISTRY, config)
+    filters = []
+    confs = []
+    codes = []
+    for conf in config:
+        if (code := _stateless_code(conf)) is not None:
+            confs.append(conf)
+            codes.append(code)
+            continue
+        if confs:
+            filters.append(await _build_fused_filter(confs, codes))
+            confs, codes = [], []
+        filters.append(await cg.build_registry_entry(FILTER_REGISTRY, conf))
+    if confs:
+        filters.append(await _build_fused_filter(confs, codes))
+    return filters
 
 
 async def setup_sensor_core_(var, config):
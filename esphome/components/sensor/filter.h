@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cmath>
+#include <functional>
+#include <memory>
 #include <queue>
 #include <utility>
 #include <vector>
@@ -34,6 +37,13 @@ class Filter {
 
   void input(float value);
 
+  /** Called with a block of samples taken dt_us apart, oldest first.
+   *
+   * By default every sample goes through new_value() and on down the chain. Filters that can do better with the
+   * whole block at once override this and call output() for their results.
+   */
+  virtual void input_block(const float *values, size_t count, uint32_t dt_us);
+
   void output(float value);
 
  protected:
@@ -43,6 +53,105 @@ class Filter {
   Sensor *parent_{nullptr};
 };
 
+/// Fixed capacity FIFO backing the sliding window filters.
+template<typename T> class FilterWindow {
+ public:
+  explicit FilterWindow(size_t capacity) { this->reset(capacity); }
+
+  /// Drop all values and change the capacity.
+  void reset(size_t capacity) {
+    this->data_.reset(new T[capacity]);  // NOLINT
+    this->capacity_ = capacity;
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+
+  size_t size() const { return this->size_; }
+  size_t capacity() const { return this->capacity_; }
+  bool empty() const { return this->size_ == 0; }
+  bool full() const { return this->size_ == this->capacity_; }
+
+  T &front() { return this->data_[this->head_]; }
+  T &back() { return (*this)[this->size_ - 1]; }
+  /// Element i counted from the oldest one.
+  T &operator[](size_t i) {
+    size_t pos = this->head_ + i;
+    return this->data_[pos >= this->capacity_ ? pos - this->capacity_ : pos];
+  }
+
+  void push_back(const T &value) {
+    this->size_++;
+    this->back() = value;
+  }
+  void pop_front() {
+    if (++this->head_ == this->capacity_)
+      this->head_ = 0;
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+
+ protected:
+  std::unique_ptr<T[]> data_;
+  size_t capacity_;
+  size_t head_;
+  size_t size_;
+};
+
+/** Sliding window that also keeps its non-NaN values sorted, for the median and quantile filters.
+ *
+ * The sorted copy is updated with a binary search and a short move on every value instead of sorting the whole
+ * window for every output.
+ */
+class SortedFilterWindow {
+ public:
+  explicit SortedFilterWindow(size_t window_size);
+
+  void reset(size_t window_size);
+  void push(float value);
+  /// Non-NaN values of the window in ascending order.
+  const std::vector<float> &sorted() const { return this->sorted_; }
+
+ protected:
+  FilterWindow<float> window_;
+  std::vector<float> sorted_;
+};
+
+/** Sliding window minimum or maximum using a monotonic queue.
+ *
+ * Only values that can still become the extreme of the window are kept, the front is always the answer.
+ *
+ * @tparam Compare std::less<float> for the minimum, std::greater<float> for the maximum.
+ */
+template<typename Compare> class MonotonicFilterWindow {
+ public:
+  explicit MonotonicFilterWindow(size_t window_size) : queue_(window_size) {}
+
+  void reset(size_t window_size) {
+    this->queue_.reset(window_size);
+    this->count_ = 0;
+  }
+
+  void push(float value) {
+    size_t window_size = this->queue_.capacity();
+    this->count_++;
+    if (!this->queue_.empty() && this->count_ - this->queue_.front().second >= window_size)
+      this->queue_.pop_front();
+    if (std::isnan(value))
+      return;
+    while (!this->queue_.empty() && !Compare()(this->queue_.back().first, value))
+      this->queue_.pop_back();
+    this->queue_.push_back({value, this->count_});
+  }
+
+  /// The extreme of the window, NaN if the window has no valid value.
+  float get() { return this->queue_.empty() ? NAN : this->queue_.front().first; }
+
+ protected:
+  /// Value and position in the input stream
+  FilterWindow<std::pair<float, size_t>> queue_;
+  size_t count_{0};
+};
+
 /** Simple quantile filter.
  *
  * Takes the quantile of the last <send_every> values and pushes it out every <send_every>.
@@ -67,10 +176,9 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
-  std::deque<float> queue_;
+  SortedFilterWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
   float quantile_;
 };
 
@@ -96,10 +204,9 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  SortedFilterWindow window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple skip filter.
@@ -142,10 +249,9 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicFilterWindow<std::less<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple max filter.
@@ -170,10 +276,9 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  MonotonicFilterWindow<std::greater<float>> window_;
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple sliding window moving average filter.
@@ -199,10 +304,14 @@ class SlidingWindowMovingAverageFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  FilterWindow<float> window_;
+  /// Running sum of the non-NaN values in the window
+  float sum_{0.0f};
+  size_t valid_count_{0};
+  /// Values until the running sum is recomputed to get rid of accumulated rounding errors
+  size_t resync_at_{0};
   size_t send_every_;
   size_t send_at_;
-  size_t window_size_;
 };
 
 /** Simple exponential moving average filter.
@@ -238,6 +347,7 @@ class ThrottleAverageFilter : public Filter, public Component {
   void setup() override;
 
   optional<float> new_value(float value) override;
+  void input_block(const float *values, size_t count, uint32_t dt_us) override;
 
   float get_setup_priority() const override;
 
@@ -270,6 +380,22 @@ class LambdaFilter : public Filter {
   lambda_filter_t lambda_filter_;
 };
 
+/** Consecutive stateless filters fused into one function by code generation.
+ *
+ * Offset, multiply, calibrate, clamp and round filters next to each other in a sensor's filter list become a single
+ * function, so a value takes one call instead of one virtual call per filter.
+ */
+class FusedFilter : public Filter {
+ public:
+  using fused_filter_t = optional<float> (*)(float);
+  explicit FusedFilter(fused_filter_t function) : function_(function) {}
+
+  optional<float> new_value(float value) override { return this->function_(value); }
+
+ protected:
+  fused_filter_t function_;
+};
+
 /// A simple filter that adds `offset` to each value it receives.
 class OffsetFilter : public Filter {
  public:
@@ -308,6 +434,8 @@ class ThrottleFilter : public Filter {
   explicit ThrottleFilter(uint32_t min_time_between_inputs);
 
   optional<float> new_value(float value) override;
+  /// Throttles on the sample times within the block, not the time the block arrived.
+  void input_block(const float *values, size_t count, uint32_t dt_us) override;
 
  protected:
   uint32_t last_input_{0};
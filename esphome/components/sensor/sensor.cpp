@@ -49,6 +49,22 @@ void Sensor::publish_state(float state) {
   }
 }
 
+void Sensor::publish_block(const float *samples, size_t n, uint32_t dt_us) {
+  if (n == 0)
+    return;
+  float newest = samples[n - 1];
+  this->raw_state = newest;
+  this->raw_callback_.call(newest);
+
+  ESP_LOGV(TAG, "'%s': Received block of %zu values, newest %f", this->name_.c_str(), n, newest);
+
+  if (this->filter_list_ == nullptr) {
+    this->internal_send_state_to_frontend(newest);
+  } else {
+    this->filter_list_->input_block(samples, n, dt_us);
+  }
+}
+
 void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
 void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
   this->raw_callback_.add(std::move(callback));
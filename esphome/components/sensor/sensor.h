@@ -114,6 +114,18 @@ class Sensor : public EntityBase, public EntityBase_DeviceClass, public EntityBa
    */
   void publish_state(float state);
 
+  /** Publish a block of samples taken at a fixed interval, oldest first.
+   *
+   * The block goes through the filter chain in one go and only the values that come out of the end of the chain
+   * reach the state callbacks. Without filters only the newest sample is sent to the front-end. raw_value and the
+   * raw state callbacks get the newest sample.
+   *
+   * @param samples The samples, oldest first.
+   * @param n The number of samples.
+   * @param dt_us The time between two samples in microseconds.
+   */
+  void publish_block(const float *samples, size_t n, uint32_t dt_us);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Add a callback that will be called every time a filtered value arrives.
@@ -62,7 +62,7 @@ void Sml::loop() {
   }
 }
 
-void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
+void Sml::add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback) {
   this->data_callbacks_.add(std::move(callback));
 }
 
@@ -92,10 +92,13 @@ void Sml::publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
 }
 
 void Sml::publish_value_(const ObisInfo &obis_info) {
+  // Format the IDs once per value, not once per listener
+  const std::string server_id = bytes_repr(obis_info.server_id);
+  const std::string obis_code = obis_info.code_repr();
   for (auto const &sml_listener : sml_listeners_) {
-    if ((!sml_listener->server_id.empty()) && (bytes_repr(obis_info.server_id) != sml_listener->server_id))
+    if ((!sml_listener->server_id.empty()) && (server_id != sml_listener->server_id))
       continue;
-    if (obis_info.code_repr() != sml_listener->obis_code)
+    if (obis_code != sml_listener->obis_code)
       continue;
     sml_listener->publish_val(obis_info);
   }
@@ -24,7 +24,7 @@ class Sml : public Component, public uart::UARTDevice {
   void loop() override;
   void dump_config() override;
   std::vector<SmlListener *> sml_listeners_{};
-  void add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback);
+  void add_on_data_callback(std::function<void(const std::vector<uint8_t> &, bool)> &&callback);
 
  protected:
   void process_sml_file_(const bytes &sml_data);
@@ -5,7 +5,7 @@
 namespace esphome {
 namespace sml {
 
-SmlFile::SmlFile(bytes buffer) : buffer_(std::move(buffer)) {
+SmlFile::SmlFile(const bytes &buffer) : buffer_(buffer) {
   // extract messages
   this->pos_ = 0;
   while (this->pos_ < this->buffer_.size()) {
@@ -15,7 +15,7 @@ SmlFile::SmlFile(bytes buffer) : buffer_(std::move(buffer)) {
     SmlNode message = SmlNode();
     if (!this->setup_node(&message))
       break;
-    this->messages.emplace_back(message);
+    this->messages.emplace_back(std::move(message));
   }
 }
 
@@ -71,7 +71,7 @@ bool SmlFile::setup_node(SmlNode *node) {
       SmlNode child_node = SmlNode();
       if (!this->setup_node(&child_node))
         return false;
-      node->nodes.emplace_back(child_node);
+      node->nodes.emplace_back(std::move(child_node));
     }
   } else {
     // Value starts at the current position
@@ -87,14 +87,14 @@ bool SmlFile::setup_node(SmlNode *node) {
 std::vector<ObisInfo> SmlFile::get_obis_info() {
   std::vector<ObisInfo> obis_info;
   for (auto const &message : messages) {
-    SmlNode message_body = message.nodes[3];
+    const SmlNode &message_body = message.nodes[3];
     uint16_t message_type = bytes_to_uint(message_body.nodes[0].value_bytes);
     if (message_type != SML_GET_LIST_RES)
       continue;
 
-    SmlNode get_list_response = message_body.nodes[1];
-    bytes server_id = get_list_response.nodes[1].value_bytes;
-    SmlNode val_list = get_list_response.nodes[4];
+    const SmlNode &get_list_response = message_body.nodes[1];
+    const bytes &server_id = get_list_response.nodes[1].value_bytes;
+    const SmlNode &val_list = get_list_response.nodes[4];
 
     for (auto const &val_list_entry : val_list.nodes) {
       obis_info.emplace_back(server_id, val_list_entry);
@@ -137,12 +137,12 @@ int64_t bytes_to_int(const bytes &buffer) {
 
 std::string bytes_to_string(const bytes &buffer) { return std::string(buffer.begin(), buffer.end()); }
 
-ObisInfo::ObisInfo(bytes server_id, SmlNode val_list_entry) : server_id(std::move(server_id)) {
+ObisInfo::ObisInfo(const bytes &server_id, const SmlNode &val_list_entry) : server_id(server_id) {
   this->code = val_list_entry.nodes[0].value_bytes;
   this->status = val_list_entry.nodes[1].value_bytes;
   this->unit = bytes_to_uint(val_list_entry.nodes[3].value_bytes);
   this->scaler = bytes_to_int(val_list_entry.nodes[4].value_bytes);
-  SmlNode value_node = val_list_entry.nodes[5];
+  const SmlNode &value_node = val_list_entry.nodes[5];
   this->value = value_node.value_bytes;
   this->value_type = value_node.type;
 }
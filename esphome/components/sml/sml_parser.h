@@ -20,7 +20,7 @@ class SmlNode {
 
 class ObisInfo {
  public:
-  ObisInfo(bytes server_id, SmlNode val_list_entry);
+  ObisInfo(const bytes &server_id, const SmlNode &val_list_entry);
   bytes server_id;
   bytes code;
   bytes status;
@@ -33,13 +33,14 @@ class ObisInfo {
 
 class SmlFile {
  public:
-  SmlFile(bytes buffer);
+  /// The buffer is parsed in place, it has to outlive the SmlFile.
+  SmlFile(const bytes &buffer);
   bool setup_node(SmlNode *node);
   std::vector<SmlNode> messages;
   std::vector<ObisInfo> get_obis_info();
 
  protected:
-  const bytes buffer_;
+  const bytes &buffer_;
   size_t pos_;
 };
 
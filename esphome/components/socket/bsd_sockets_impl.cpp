@@ -40,7 +40,7 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class BSDSocketImpl : public Socket {
  public:
-  BSDSocketImpl(int fd) : fd_(fd) {}
+  BSDSocketImpl(int fd) : fd_(fd) { monitor_fd(fd); }
   ~BSDSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -54,6 +54,7 @@ class BSDSocketImpl : public Socket {
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+    unmonitor_fd(fd_);
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -124,6 +125,7 @@ class BSDSocketImpl : public Socket {
     ::fcntl(fd_, F_SETFL, fl);
     return 0;
   }
+  bool ready() const override { return is_fd_ready(fd_); }
 
  protected:
   int fd_;
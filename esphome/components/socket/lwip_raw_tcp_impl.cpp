@@ -9,6 +9,7 @@
 #include "lwip/tcp.h"
 #include <cerrno>
 #include <cstring>
+#include <new>
 #include <queue>
 
 #include "esphome/core/helpers.h"
@@ -35,6 +36,7 @@ class LWIPRawImpl : public Socket {
       tcp_abort(pcb_);
       pcb_ = nullptr;
     }
+    free_tx_ring_(tx_ring_);
   }
 
   void init() {
@@ -43,6 +45,7 @@ class LWIPRawImpl : public Socket {
     tcp_accept(pcb_, LWIPRawImpl::s_accept_fn);
     tcp_recv(pcb_, LWIPRawImpl::s_recv_fn);
     tcp_err(pcb_, LWIPRawImpl::s_err_fn);
+    tcp_sent(pcb_, LWIPRawImpl::s_sent_fn);
   }
 
   std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) override {
@@ -140,6 +143,16 @@ class LWIPRawImpl : public Socket {
       errno = err == ERR_MEM ? ENOMEM : EIO;
       return -1;
     }
+    if (tx_ring_ != nullptr && tx_ring_->used != 0) {
+      // the pcb lingers until the peer acknowledged everything, it keeps the data it references alive
+      tcp_arg(pcb_, tx_ring_);
+      tcp_recv(pcb_, nullptr);
+      tcp_sent(pcb_, LWIPRawImpl::s_orphan_sent_fn);
+      tcp_err(pcb_, LWIPRawImpl::s_orphan_err_fn);
+      tx_ring_ = nullptr;
+    } else {
+      tcp_sent(pcb_, nullptr);
+    }
     pcb_ = nullptr;
     return 0;
   }
@@ -411,6 +424,51 @@ class LWIPRawImpl : public Socket {
     }
     return to_send;
   }
+  /** Queue iovecs without letting lwIP copy them.
+   *
+   * The data is copied once into tx_ring_, lwIP only references it until the peer acknowledged it (see sent_fn()).
+   * All iovecs go out in one tcp_write() (two if the ring wraps), so a frame is not split into small segments.
+   */
+  ssize_t internal_writev_pinned(const struct iovec *iov, int iovcnt) {
+    TxRing *ring = tx_ring_;
+    size_t space = std::min<size_t>(tcp_sndbuf(pcb_), ring->size - ring->used);
+    if (space == 0) {
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    size_t head = (ring->start + ring->used) % ring->size;
+    size_t copied = 0;
+    for (int i = 0; i < iovcnt && copied < space; i++) {
+      const uint8_t *src = reinterpret_cast<const uint8_t *>(iov[i].iov_base);
+      size_t len = std::min(iov[i].iov_len, space - copied);
+      size_t pos = (head + copied) % ring->size;
+      size_t first = std::min(len, ring->size - pos);
+      memcpy(ring->data + pos, src, first);
+      memcpy(ring->data, src + first, len - first);
+      copied += len;
+    }
+    if (copied == 0)
+      return 0;
+
+    size_t first = std::min(copied, ring->size - head);
+    err_t err = tcp_write(pcb_, ring->data + head, first, first < copied ? TCP_WRITE_FLAG_MORE : 0);
+    size_t queued = err == ERR_OK ? first : 0;
+    if (err == ERR_OK && first < copied) {
+      err = tcp_write(pcb_, ring->data, copied - first, 0);
+      if (err == ERR_OK)
+        queued = copied;
+    }
+    LWIP_LOG("tcp_write(%p pinned %u/%u)", pcb_, queued, copied);
+    ring->used += queued;
+    if (queued != 0)
+      return queued;
+    if (err == ERR_MEM) {
+      errno = EWOULDBLOCK;
+      return -1;
+    }
+    errno = ECONNRESET;
+    return -1;
+  }
   int internal_output() {
     LWIP_LOG("tcp_output(%p)", pcb_);
     err_t err = tcp_output(pcb_);
@@ -430,21 +488,27 @@ class LWIPRawImpl : public Socket {
     return 0;
   }
   ssize_t write(const void *buf, size_t len) override {
-    ssize_t written = internal_write(buf, len);
-    if (written == -1)
-      return -1;
-    if (written == 0)
-      // no need to output if nothing written
-      return 0;
-    if (nodelay_) {
-      int err = internal_output();
-      if (err == -1)
-        return -1;
-    }
-    return written;
+    struct iovec iov = {const_cast<void *>(buf), len};
+    return writev(&iov, 1);
   }
   ssize_t writev(const struct iovec *iov, int iovcnt) override {
+    if (pcb_ == nullptr) {
+      errno = ECONNRESET;
+      return -1;
+    }
     ssize_t written = 0;
+    if (tx_ring_ == nullptr)
+      tx_ring_ = alloc_tx_ring_();
+    if (tx_ring_ != nullptr) {
+      written = internal_writev_pinned(iov, iovcnt);
+      if (written <= 0)
+        return written;
+      // one tcp_output() per frame instead of one per write
+      if (nodelay_ && internal_output() == -1)
+        return -1;
+      return written;
+    }
+    // out of memory for the ring, let lwIP copy every iovec instead
     for (int i = 0; i < iovcnt; i++) {
       ssize_t err = internal_write(reinterpret_cast<uint8_t *>(iov[i].iov_base), iov[i].iov_len);
       if (err == -1) {
@@ -484,6 +548,10 @@ class LWIPRawImpl : public Socket {
     }
     return 0;
   }
+  bool ready() const override {
+    // the lwIP callbacks already queued everything a read or accept could return
+    return rx_buf_ != nullptr || rx_closed_ || pcb_ == nullptr || !accepted_sockets_.empty();
+  }
 
   err_t accept_fn(struct tcp_pcb *newpcb, err_t err) {
     LWIP_LOG("accept(newpcb=%p err=%d)", newpcb, err);
@@ -540,12 +608,69 @@ class LWIPRawImpl : public Socket {
     arg_this->err_fn(err);
   }
 
+  err_t sent_fn(uint16_t len) {
+    LWIP_LOG("sent(len=%u)", len);
+    if (tx_ring_ != nullptr)
+      release_tx_ring_(tx_ring_, len);
+    return ERR_OK;
+  }
+
   static err_t s_recv_fn(void *arg, struct tcp_pcb *pcb, struct pbuf *pb, err_t err) {
     LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
     return arg_this->recv_fn(pb, err);
   }
 
+  static err_t s_sent_fn(void *arg, struct tcp_pcb *pcb, uint16_t len) {
+    LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
+    return arg_this->sent_fn(len);
+  }
+
+  // callbacks of a closed socket whose pcb still sends from the ring
+  static err_t s_orphan_sent_fn(void *arg, struct tcp_pcb *pcb, uint16_t len) {
+    TxRing *ring = reinterpret_cast<TxRing *>(arg);
+    release_tx_ring_(ring, len);
+    if (ring->used == 0) {
+      tcp_arg(pcb, nullptr);
+      tcp_sent(pcb, nullptr);
+      tcp_err(pcb, nullptr);
+      free_tx_ring_(ring);
+    }
+    return ERR_OK;
+  }
+
+  static void s_orphan_err_fn(void *arg, err_t err) { free_tx_ring_(reinterpret_cast<TxRing *>(arg)); }
+
  protected:
+  /// Send data referenced by lwIP, it has to stay in place until the peer acknowledged it.
+  struct TxRing {
+    uint8_t *data;
+    size_t size;
+    /// Oldest unacknowledged byte
+    size_t start;
+    size_t used;
+  };
+
+  static TxRing *alloc_tx_ring_() {
+    auto *data = new (std::nothrow) uint8_t[TCP_SND_BUF];  // NOLINT(cppcoreguidelines-owning-memory)
+    if (data == nullptr)
+      return nullptr;
+    auto *ring = new (std::nothrow) TxRing{data, TCP_SND_BUF, 0, 0};  // NOLINT(cppcoreguidelines-owning-memory)
+    if (ring == nullptr)
+      delete[] data;  // NOLINT(cppcoreguidelines-owning-memory)
+    return ring;
+  }
+  static void release_tx_ring_(TxRing *ring, size_t len) {
+    len = std::min(len, ring->used);
+    ring->start = (ring->start + len) % ring->size;
+    ring->used -= len;
+  }
+  static void free_tx_ring_(TxRing *ring) {
+    if (ring == nullptr)
+      return;
+    delete[] ring->data;  // NOLINT(cppcoreguidelines-owning-memory)
+    delete ring;          // NOLINT(cppcoreguidelines-owning-memory)
+  }
+
   int ip2sockaddr_(ip_addr_t *ip, uint16_t port, struct sockaddr *name, socklen_t *addrlen) {
     if (family_ == AF_INET) {
       if (*addrlen < sizeof(struct sockaddr_in)) {
@@ -591,6 +716,7 @@ class LWIPRawImpl : public Socket {
   bool rx_closed_ = false;
   pbuf *rx_buf_ = nullptr;
   size_t rx_buf_offset_ = 0;
+  TxRing *tx_ring_ = nullptr;
   // don't use lwip nodelay flag, it sometimes causes reconnect
   // instead use it for determining whether to call lwip_output
   bool nodelay_ = false;
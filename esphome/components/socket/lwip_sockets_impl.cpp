@@ -33,7 +33,7 @@ std::string format_sockaddr(const struct sockaddr_storage &storage) {
 
 class LwIPSocketImpl : public Socket {
  public:
-  LwIPSocketImpl(int fd) : fd_(fd) {}
+  LwIPSocketImpl(int fd) : fd_(fd) { monitor_fd(fd); }
   ~LwIPSocketImpl() override {
     if (!closed_) {
       close();  // NOLINT(clang-analyzer-optin.cplusplus.VirtualCall)
@@ -47,6 +47,7 @@ class LwIPSocketImpl : public Socket {
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_bind(fd_, addr, addrlen); }
   int close() override {
+    unmonitor_fd(fd_);
     int ret = lwip_close(fd_);
     closed_ = true;
     return ret;
@@ -96,6 +97,7 @@ class LwIPSocketImpl : public Socket {
     lwip_fcntl(fd_, F_SETFL, fl);
     return 0;
   }
+  bool ready() const override { return is_fd_ready(fd_); }
 
  protected:
   int fd_;
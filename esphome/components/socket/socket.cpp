@@ -1,15 +1,75 @@
 #include "socket.h"
 #if defined(USE_SOCKET_IMPL_LWIP_TCP) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS) || defined(USE_SOCKET_IMPL_BSD_SOCKETS)
 #include <cerrno>
+#include <algorithm>
 #include <cstring>
 #include <string>
 #include "esphome/core/log.h"
 
+#if defined(USE_SOCKET_SELECT_SUPPORT) && defined(USE_HOST)
+#include <sys/select.h>
+#endif
+
 namespace esphome {
 namespace socket {
 
 Socket::~Socket() {}
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+// One select() per main loop iteration answers Socket::ready() for every socket, instead of each component
+// paying for a failing read() or accept() on its idle sockets.
+static fd_set monitored_fds;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static fd_set polled_fds;     // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static fd_set ready_fds;      // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static int max_monitored_fd = -1;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+void monitor_fd(int fd) {
+  if (fd < 0 || fd >= FD_SETSIZE)
+    return;
+  if (max_monitored_fd < 0) {
+    FD_ZERO(&monitored_fds);
+    FD_ZERO(&polled_fds);
+    FD_ZERO(&ready_fds);
+  }
+  FD_SET(fd, &monitored_fds);
+  max_monitored_fd = std::max(max_monitored_fd, fd);
+}
+
+void unmonitor_fd(int fd) {
+  if (fd < 0 || fd > max_monitored_fd)
+    return;
+  FD_CLR(fd, &monitored_fds);
+  // the fd number may be reused by a socket that was not polled yet
+  FD_CLR(fd, &polled_fds);
+  while (max_monitored_fd >= 0 && !FD_ISSET(max_monitored_fd, &monitored_fds))
+    max_monitored_fd--;
+}
+
+void poll_ready() {
+  if (max_monitored_fd < 0)
+    return;
+  ready_fds = monitored_fds;
+  struct timeval tv = {0, 0};
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+  int ret = lwip_select(max_monitored_fd + 1, &ready_fds, nullptr, nullptr, &tv);
+#else
+  int ret = ::select(max_monitored_fd + 1, &ready_fds, nullptr, nullptr, &tv);
+#endif
+  if (ret < 0) {
+    // report everything as ready and let the reads find out
+    FD_ZERO(&polled_fds);
+    return;
+  }
+  polled_fds = monitored_fds;
+}
+
+bool is_fd_ready(int fd) {
+  if (fd < 0 || fd > max_monitored_fd || !FD_ISSET(fd, &polled_fds))
+    return true;
+  return FD_ISSET(fd, &ready_fds);
+}
+#endif
+
 std::unique_ptr<Socket> socket_ip(int type, int protocol) {
 #if USE_NETWORK_IPV6
   return socket(AF_INET6, type, protocol);
@@ -42,6 +42,13 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /** Whether a read() or accept() may make progress.
+   *
+   * This is only a hint to skip calls that would fail with EWOULDBLOCK, so it may return true when there is
+   * nothing to read but never false when there is.
+   */
+  virtual bool ready() const { return true; }
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -56,6 +63,16 @@ socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::stri
 /// Set a sockaddr to the any address and specified port for the IP version used by socket_ip().
 socklen_t set_sockaddr_any(struct sockaddr *addr, socklen_t addrlen, uint16_t port);
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+/// Add a file descriptor to the set checked by poll_ready().
+void monitor_fd(int fd);
+void unmonitor_fd(int fd);
+/// Check all monitored file descriptors for readability with one select(), called by the main loop.
+void poll_ready();
+/// Whether the file descriptor was readable at the last poll_ready(), true if it was not monitored then.
+bool is_fd_ready(int fd);
+#endif
+
 }  // namespace socket
 }  // namespace esphome
 #endif
@@ -0,0 +1,59 @@
+import esphome.codegen as cg
+from esphome.components import media_player
+import esphome.config_validation as cv
+from esphome.const import CONF_BUFFER_SIZE, CONF_ID, CONF_SAMPLE_RATE, CONF_SPEAKER
+
+from .. import Speaker, speaker_ns
+
+CODEOWNERS = ["@jesserockz"]
+DEPENDENCIES = ["speaker"]
+
+SpeakerMediaPlayer = speaker_ns.class_(
+    "SpeakerMediaPlayer", cg.Component, media_player.MediaPlayer
+)
+
+CONF_PREBUFFER = "prebuffer"
+
+
+def _validate_prebuffer(config):
+    # Sized for 16 bit mono at the speaker's rate, bigger streams prebuffer less
+    needed = config[CONF_PREBUFFER].total_milliseconds * config[CONF_SAMPLE_RATE] * 2
+    if needed > config[CONF_BUFFER_SIZE] * 1000:
+        raise cv.Invalid(
+            f"The prebuffer of {config[CONF_PREBUFFER]} needs a buffer_size of at "
+            f"least {needed // 1000} bytes at {config[CONF_SAMPLE_RATE]} Hz"
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    media_player.MEDIA_PLAYER_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(SpeakerMediaPlayer),
+            cv.GenerateID(CONF_SPEAKER): cv.use_id(Speaker),
+            cv.Optional(CONF_SAMPLE_RATE, default=16000): cv.int_range(
+                min=8000, max=48000
+            ),
+            cv.Optional(CONF_BUFFER_SIZE, default=32768): cv.int_range(
+                min=4096, max=1048576
+            ),
+            cv.Optional(
+                CONF_PREBUFFER, default="500ms"
+            ): cv.positive_time_period_milliseconds,
+        }
+    ).extend(cv.COMPONENT_SCHEMA),
+    cv.only_on_esp32,
+    _validate_prebuffer,
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await media_player.register_media_player(var, config)
+
+    spkr = await cg.get_variable(config[CONF_SPEAKER])
+    cg.add(var.set_speaker(spkr))
+    cg.add(var.set_sample_rate(config[CONF_SAMPLE_RATE]))
+    cg.add(var.set_buffer_size(config[CONF_BUFFER_SIZE]))
+    cg.add(var.set_prebuffer(config[CONF_PREBUFFER]))
@@ -0,0 +1,357 @@
+#include "audio_pipeline.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <esp_http_client.h>
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+#include <esp_crt_bundle.h>
+#endif
+
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace speaker {
+
+static const char *const TAG = "speaker_media_player.pipeline";
+
+static const EventBits_t COMMAND_STOP = 1 << 0;
+static const EventBits_t COMMAND_PAUSE = 1 << 1;
+static const EventBits_t READER_DONE = 1 << 2;
+static const EventBits_t DECODER_DONE = 1 << 3;
+static const EventBits_t PLAYBACK_FAILED = 1 << 4;
+static const EventBits_t ALL_EVENTS = COMMAND_STOP | COMMAND_PAUSE | READER_DONE | DECODER_DONE | PLAYBACK_FAILED;
+
+// TLS handshakes run on the reader's stack
+static const uint32_t READER_STACK_SIZE = 8192;
+static const uint32_t DECODER_STACK_SIZE = 4096;
+// Above the main loop, so the buffers keep filling while it's busy
+static const UBaseType_t TASK_PRIORITY = 2;
+static const int HTTP_TIMEOUT_MS = 5000;
+static const uint8_t MAX_REDIRECTS = 3;
+static const size_t READ_CHUNK_SIZE = 512;
+static const size_t DECODE_CHUNK_SIZE = 512;
+static const size_t OUTPUT_SAMPLES = 256;
+
+bool AudioPipeline::start(const std::string &url) {
+  if (!this->is_stopped())
+    return false;
+  if (this->events_ == nullptr) {
+    this->events_ = xEventGroupCreate();
+    if (this->events_ == nullptr)
+      return false;
+  }
+  if (this->ring_buffer_ == nullptr) {
+    this->ring_buffer_ = RingBuffer::create(this->buffer_size_);
+    if (this->ring_buffer_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate the %u byte ring buffer", (unsigned) this->buffer_size_);
+      return false;
+    }
+  } else {
+    this->ring_buffer_->reset();
+  }
+
+  this->url_ = url;
+  this->stats_ = AudioPipelineStats{};
+  this->underrun_ = false;
+  this->prebuffered_ = false;
+  xEventGroupClearBits(this->events_, ALL_EVENTS);
+  if (xTaskCreate(AudioPipeline::reader_task, "audio_reader", READER_STACK_SIZE, this, TASK_PRIORITY, nullptr) !=
+      pdPASS) {
+    xEventGroupSetBits(this->events_, READER_DONE | DECODER_DONE | PLAYBACK_FAILED);
+    return false;
+  }
+  if (xTaskCreate(AudioPipeline::decoder_task, "audio_decoder", DECODER_STACK_SIZE, this, TASK_PRIORITY, nullptr) !=
+      pdPASS) {
+    // The reader stops by itself and reports when it's done
+    xEventGroupSetBits(this->events_, COMMAND_STOP | DECODER_DONE | PLAYBACK_FAILED);
+    return false;
+  }
+  return true;
+}
+
+void AudioPipeline::stop() {
+  if (this->events_ != nullptr)
+    xEventGroupSetBits(this->events_, COMMAND_STOP);
+}
+
+void AudioPipeline::set_paused(bool paused) {
+  if (this->events_ == nullptr)
+    return;
+  if (paused) {
+    xEventGroupSetBits(this->events_, COMMAND_PAUSE);
+  } else {
+    xEventGroupClearBits(this->events_, COMMAND_PAUSE);
+  }
+}
+
+bool AudioPipeline::is_stopped() const {
+  if (this->events_ == nullptr)
+    return true;
+  return (xEventGroupGetBits(this->events_) & (READER_DONE | DECODER_DONE)) == (READER_DONE | DECODER_DONE);
+}
+
+bool AudioPipeline::is_finished() const { return this->events_ != nullptr && this->is_stopped(); }
+
+bool AudioPipeline::has_failed() const {
+  return this->events_ != nullptr && (xEventGroupGetBits(this->events_) & PLAYBACK_FAILED) != 0;
+}
+
+void AudioPipeline::reader_task(void *params) {
+  auto *pipeline = static_cast<AudioPipeline *>(params);
+  if (!pipeline->read_stream_()) {
+    // The decoder would otherwise wait for data that never comes
+    xEventGroupSetBits(pipeline->events_, PLAYBACK_FAILED | COMMAND_STOP);
+  }
+  xEventGroupSetBits(pipeline->events_, READER_DONE);
+  vTaskDelete(nullptr);
+}
+
+void AudioPipeline::decoder_task(void *params) {
+  auto *pipeline = static_cast<AudioPipeline *>(params);
+  if (!pipeline->decode_stream_())
+    xEventGroupSetBits(pipeline->events_, PLAYBACK_FAILED | COMMAND_STOP);
+  xEventGroupSetBits(pipeline->events_, DECODER_DONE);
+  vTaskDelete(nullptr);
+}
+
+bool AudioPipeline::read_stream_() {
+  esp_http_client_config_t config{};
+  config.url = this->url_.c_str();
+  config.timeout_ms = HTTP_TIMEOUT_MS;
+#if CONFIG_MBEDTLS_CERTIFICATE_BUNDLE
+  config.crt_bundle_attach = esp_crt_bundle_attach;
+#endif
+  esp_http_client_handle_t client = esp_http_client_init(&config);
+  if (client == nullptr) {
+    ESP_LOGE(TAG, "Could not create the HTTP client");
+    return false;
+  }
+
+  bool success = false;
+  int status = 0;
+  // Opening the connection ourselves keeps esp_http_client from following redirects, so do that here
+  for (uint8_t redirects = 0;; redirects++) {
+    esp_err_t err = esp_http_client_open(client, 0);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Connecting to %s failed: %s", this->url_.c_str(), esp_err_to_name(err));
+      break;
+    }
+    esp_http_client_fetch_headers(client);
+    status = esp_http_client_get_status_code(client);
+    if (status >= 300 && status < 400 && redirects < MAX_REDIRECTS) {
+      esp_http_client_set_redirection(client);
+      esp_http_client_close(client);
+      continue;
+    }
+    break;
+  }
+
+  if (status >= 200 && status < 300) {
+    uint8_t buffer[READ_CHUNK_SIZE];
+    while (true) {
+      if (xEventGroupGetBits(this->events_) & COMMAND_STOP) {
+        success = true;
+        break;
+      }
+      int len = esp_http_client_read(client, reinterpret_cast<char *>(buffer), sizeof(buffer));
+      if (len < 0) {
+        ESP_LOGE(TAG, "Reading the stream failed");
+        break;
+      }
+      if (len == 0) {
+        success = true;
+        break;
+      }
+      this->stats_.bytes_read += len;
+      size_t written = 0;
+      while (written < size_t(len) && (xEventGroupGetBits(this->events_) & COMMAND_STOP) == 0)
+        written += this->ring_buffer_->write_without_replacement(buffer + written, len - written, pdMS_TO_TICKS(50));
+    }
+  } else if (status != 0) {
+    ESP_LOGE(TAG, "Requesting %s failed: HTTP status %d", this->url_.c_str(), status);
+  }
+
+  esp_http_client_close(client);
+  esp_http_client_cleanup(client);
+  return success;
+}
+
+size_t AudioPipeline::read_exact_(void *data, size_t len) {
+  auto *bytes = static_cast<uint8_t *>(data);
+  size_t total = 0;
+  while (total < len) {
+    // The reader sets READER_DONE after its last write, so an empty buffer after that is the end of the stream
+    const EventBits_t events = xEventGroupGetBits(this->events_);
+    if (events & COMMAND_STOP)
+      break;
+    if (this->ring_buffer_->available() == 0) {
+      if (events & READER_DONE)
+        break;
+      if (this->prebuffered_ && !this->underrun_) {
+        this->stats_.underruns++;
+        this->underrun_ = true;
+      }
+    } else {
+      this->underrun_ = false;
+    }
+    total += this->ring_buffer_->read(bytes + total, len - total, pdMS_TO_TICKS(20));
+  }
+  return total;
+}
+
+bool AudioPipeline::parse_wav_header_() {
+  uint8_t header[12];
+  // A stream that ended or failed on the way has already been reported by the reader
+  if (this->read_exact_(header, sizeof(header)) != sizeof(header))
+    return false;
+  if (memcmp(header, "RIFF", 4) != 0 || memcmp(header + 8, "WAVE", 4) != 0) {
+    ESP_LOGE(TAG, "The stream is not a WAV file");
+    return false;
+  }
+
+  bool has_format = false;
+  while (true) {
+    uint8_t chunk[8];
+    if (this->read_exact_(chunk, sizeof(chunk)) != sizeof(chunk))
+      return false;
+    if (memcmp(chunk, "data", 4) == 0)
+      break;
+
+    const uint32_t size = encode_uint32(chunk[7], chunk[6], chunk[5], chunk[4]);
+    // Chunks are padded to an even size
+    uint32_t skip = size + (size & 1);
+    if (memcmp(chunk, "fmt ", 4) == 0 && size >= 16) {
+      uint8_t format[16];
+      if (this->read_exact_(format, sizeof(format)) != sizeof(format))
+        return false;
+      skip -= sizeof(format);
+      const uint16_t audio_format = encode_uint16(format[1], format[0]);
+      this->channels_ = encode_uint16(format[3], format[2]);
+      this->source_rate_ = encode_uint32(format[7], format[6], format[5], format[4]);
+      this->bits_per_sample_ = encode_uint16(format[15], format[14]);
+      // Only plain PCM, 1 is WAVE_FORMAT_PCM
+      if (audio_format != 1 || (this->bits_per_sample_ != 8 && this->bits_per_sample_ != 16) ||
+          this->channels_ == 0 || this->channels_ > 2 || this->source_rate_ == 0) {
+        ESP_LOGE(TAG, "Unsupported WAV format %u with %u channels of %u bits", audio_format, this->channels_,
+                 this->bits_per_sample_);
+        return false;
+      }
+      has_format = true;
+    }
+    uint8_t scratch[64];
+    while (skip > 0) {
+      const size_t len = std::min<uint32_t>(skip, sizeof(scratch));
+      if (this->read_exact_(scratch, len) != len)
+        return false;
+      skip -= len;
+    }
+  }
+  if (!has_format) {
+    ESP_LOGE(TAG, "The WAV file has no format chunk");
+    return false;
+  }
+  ESP_LOGD(TAG, "Playing %" PRIu32 " Hz, %u channels of %u bits", this->source_rate_, this->channels_,
+           this->bits_per_sample_);
+  return true;
+}
+
+bool AudioPipeline::decode_stream_() {
+  if (!this->parse_wav_header_())
+    return (xEventGroupGetBits(this->events_) & COMMAND_STOP) != 0;
+
+  const size_t frame_size = this->channels_ * this->bits_per_sample_ / 8;
+  // Never wait for more than fits, the reader would block on a full buffer first
+  const uint64_t wanted = uint64_t(this->prebuffer_ms_) * this->source_rate_ * frame_size / 1000;
+  const size_t prebuffer = std::min<uint64_t>(wanted, this->buffer_size_ * 3 / 4);
+  while ((xEventGroupGetBits(this->events_) & (COMMAND_STOP | READER_DONE)) == 0 &&
+         this->ring_buffer_->available() < prebuffer)
+    vTaskDelay(pdMS_TO_TICKS(10));
+  this->prebuffered_ = true;
+
+  this->step_ = (uint64_t(this->source_rate_) << 16) / this->sample_rate_;
+  this->position_ = 0;
+  this->previous_ = 0;
+
+  uint8_t input[DECODE_CHUNK_SIZE];
+  int16_t samples[DECODE_CHUNK_SIZE];
+  const size_t chunk = sizeof(input) / frame_size * frame_size;
+  while (true) {
+    const EventBits_t events = xEventGroupGetBits(this->events_);
+    if (events & COMMAND_STOP)
+      return true;
+    if (events & COMMAND_PAUSE) {
+      vTaskDelay(pdMS_TO_TICKS(10));
+      continue;
+    }
+
+    this->stats_.min_buffered = std::min<uint32_t>(this->stats_.min_buffered, this->ring_buffer_->available());
+    const size_t len = this->read_exact_(input, chunk);
+    const size_t frames = len / frame_size;
+    for (size_t i = 0; i < frames; i++) {
+      const uint8_t *frame = input + i * frame_size;
+      int32_t sum = 0;
+      for (uint16_t channel = 0; channel < this->channels_; channel++) {
+        if (this->bits_per_sample_ == 8) {
+          // 8 bit samples are unsigned
+          sum += (int32_t(frame[channel]) - 128) << 8;
+        } else {
+          sum += int16_t(encode_uint16(frame[channel * 2 + 1], frame[channel * 2]));
+        }
+      }
+      samples[i] = sum / this->channels_;
+    }
+    if (frames != 0 && !this->play_samples_(samples, frames))
+      return true;
+    if (len < chunk)
+      return true;
+  }
+}
+
+bool AudioPipeline::play_samples_(const int16_t *samples, size_t count) {
+  int16_t output[OUTPUT_SAMPLES];
+  size_t out = 0;
+  const int32_t gain = this->gain_.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < count; i++) {
+    const int32_t current = samples[i];
+    while (this->position_ < (1 << 16)) {
+      // The position in Q15 keeps the product within 32 bits
+      const int32_t value =
+          this->previous_ + (((current - this->previous_) * int32_t(this->position_ >> 1)) >> 15);
+      output[out++] = int16_t((value * gain) >> 15);
+      if (out == OUTPUT_SAMPLES) {
+        if (!this->write_speaker_(output, out))
+          return false;
+        out = 0;
+      }
+      this->position_ += this->step_;
+    }
+    this->position_ -= 1 << 16;
+    this->previous_ = current;
+  }
+  return out == 0 || this->write_speaker_(output, out);
+}
+
+bool AudioPipeline::write_speaker_(const int16_t *samples, size_t count) {
+  const auto *data = reinterpret_cast<const uint8_t *>(samples);
+  size_t remaining = count * sizeof(int16_t);
+  while (remaining > 0) {
+    if (xEventGroupGetBits(this->events_) & COMMAND_STOP)
+      return false;
+    const size_t written = this->speaker_->play(data, remaining);
+    data += written;
+    remaining -= written;
+    if (remaining > 0)
+      vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  this->stats_.samples_played += count;
+  return true;
+}
+
+}  // namespace speaker
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/components/speaker/speaker.h"
+#include "esphome/core/ring_buffer.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+namespace esphome {
+namespace speaker {
+
+/// Counters of the current or last playback, for sizing the buffers. Written by the tasks, so only approximate.
+struct AudioPipelineStats {
+  /// Bytes received from the stream
+  uint32_t bytes_read{0};
+  /// Samples handed to the speaker
+  uint32_t samples_played{0};
+  /// Times the decoder ran out of data while the stream was still going
+  uint32_t underruns{0};
+  /// Lowest fill of the ring buffer since prebuffering finished, in bytes
+  uint32_t min_buffered{UINT32_MAX};
+};
+
+/** Plays a WAV stream from an HTTP URL on a speaker.
+ *
+ * A reader task streams the response into a ring buffer. A decoder task waits until the ring buffer holds the
+ * prebuffer, then converts the PCM samples to 16 bit mono, resamples them linearly to the speaker's sample rate,
+ * applies the volume and feeds the speaker. The speaker has a task of its own, so every stage keeps going while the
+ * main loop is busy, as long as the buffers last.
+ */
+class AudioPipeline {
+ public:
+  AudioPipeline(Speaker *speaker, uint32_t sample_rate, size_t buffer_size, uint32_t prebuffer_ms)
+      : speaker_(speaker), sample_rate_(sample_rate), buffer_size_(buffer_size), prebuffer_ms_(prebuffer_ms) {}
+
+  /// Start playing `url`. Only possible while is_stopped().
+  bool start(const std::string &url);
+  /// Ask both tasks to stop, is_stopped() tells when they did.
+  void stop();
+  void set_paused(bool paused);
+  void set_volume(float volume) { this->gain_ = static_cast<int32_t>(volume * 32768.0f); }
+
+  /// Whether neither task is running.
+  bool is_stopped() const;
+  /// Whether the whole stream was played, or the playback failed, and the tasks are gone.
+  bool is_finished() const;
+  bool has_failed() const;
+  /// Bytes waiting in the ring buffer.
+  size_t get_buffered() const { return this->ring_buffer_ == nullptr ? 0 : this->ring_buffer_->available(); }
+  const AudioPipelineStats &get_stats() const { return this->stats_; }
+
+ protected:
+  static void reader_task(void *params);
+  static void decoder_task(void *params);
+
+  /// Stream the response into the ring buffer until it ends, fails or stop() is called.
+  bool read_stream_();
+  bool decode_stream_();
+  /// Read `len` bytes from the ring buffer, waiting for the reader as needed.
+  /// @return The number of bytes read, less than `len` at the end of the stream or when stopping.
+  size_t read_exact_(void *data, size_t len);
+  bool parse_wav_header_();
+  /// Resample, scale and play a block of 16 bit mono samples.
+  bool play_samples_(const int16_t *samples, size_t count);
+  bool write_speaker_(const int16_t *samples, size_t count);
+
+  Speaker *speaker_;
+  uint32_t sample_rate_;
+  size_t buffer_size_;
+  uint32_t prebuffer_ms_;
+
+  std::unique_ptr<RingBuffer> ring_buffer_;
+  EventGroupHandle_t events_{nullptr};
+  std::string url_;
+  std::atomic<int32_t> gain_{32768};
+  /// Underruns only count once the decoder waited for the prebuffer
+  bool prebuffered_{false};
+  bool underrun_{false};
+  AudioPipelineStats stats_;
+
+  // Format of the stream, from the WAV header
+  uint32_t source_rate_{0};
+  uint16_t channels_{0};
+  uint16_t bits_per_sample_{0};
+
+  // Linear resampler state: position between `previous_` and the next input sample, in Q16
+  uint32_t position_{0};
+  uint32_t step_{0};
+  int16_t previous_{0};
+};
+
+}  // namespace speaker
+}  // namespace esphome
+
+#endif  // USE_ESP32
@@ -0,0 +1,161 @@
+#include "speaker_media_player.h"
+
+#ifdef USE_ESP32
+
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace speaker {
+
+static const char *const TAG = "speaker_media_player";
+
+static const uint32_t STATS_LOG_INTERVAL_MS = 5000;
+
+void SpeakerMediaPlayer::setup() {
+  this->pipeline_ = make_unique<AudioPipeline>(this->speaker_, this->sample_rate_, this->buffer_size_,
+                                               this->prebuffer_ms_);
+  this->update_gain_();
+  this->state = media_player::MEDIA_PLAYER_STATE_IDLE;
+}
+
+void SpeakerMediaPlayer::dump_config() {
+  ESP_LOGCONFIG(TAG, "Speaker Media Player:");
+  ESP_LOGCONFIG(TAG, "  Sample Rate: %" PRIu32 " Hz", this->sample_rate_);
+  ESP_LOGCONFIG(TAG, "  Buffer Size: %u bytes", (unsigned) this->buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Prebuffer: %" PRIu32 " ms", this->prebuffer_ms_);
+}
+
+media_player::MediaPlayerTraits SpeakerMediaPlayer::get_traits() {
+  auto traits = media_player::MediaPlayerTraits();
+  traits.set_supports_pause(true);
+  traits.get_supported_formats().push_back(media_player::MediaPlayerSupportedFormat{
+      "wav", this->sample_rate_, 1, media_player::MediaPlayerFormatPurpose::PURPOSE_DEFAULT, 2});
+  return traits;
+}
+
+void SpeakerMediaPlayer::loop() {
+  if (this->pending_url_.has_value()) {
+    // Wait for the tasks of the previous URL to go away
+    if (!this->pipeline_->is_stopped())
+      return;
+    if (this->state != media_player::MEDIA_PLAYER_STATE_IDLE)
+      this->log_stats_();
+    if (this->speaker_->is_stopped())
+      this->speaker_->start();
+    if (this->pipeline_->start(this->pending_url_.value())) {
+      this->state = this->pending_announcement_ ? media_player::MEDIA_PLAYER_STATE_ANNOUNCING
+                                                : media_player::MEDIA_PLAYER_STATE_PLAYING;
+    } else {
+      ESP_LOGE(TAG, "Could not start playing %s", this->pending_url_.value().c_str());
+      this->speaker_->stop();
+      this->state = media_player::MEDIA_PLAYER_STATE_IDLE;
+    }
+    this->pending_url_.reset();
+    this->last_stats_log_ = millis();
+    this->publish_state();
+    return;
+  }
+
+  if (this->state == media_player::MEDIA_PLAYER_STATE_IDLE)
+    return;
+  if (!this->pipeline_->is_finished()) {
+    if (millis() - this->last_stats_log_ > STATS_LOG_INTERVAL_MS) {
+      this->last_stats_log_ = millis();
+      ESP_LOGV(TAG, "%u bytes buffered, %" PRIu32 " underruns so far", (unsigned) this->pipeline_->get_buffered(),
+               this->pipeline_->get_stats().underruns);
+    }
+    return;
+  }
+  // Let the speaker play out what it still holds
+  if (this->speaker_->has_buffered_data())
+    return;
+  this->speaker_->stop();
+  this->log_stats_();
+  this->state = media_player::MEDIA_PLAYER_STATE_IDLE;
+  this->publish_state();
+}
+
+void SpeakerMediaPlayer::log_stats_() {
+  const AudioPipelineStats &stats = this->pipeline_->get_stats();
+  if (this->pipeline_->has_failed())
+    ESP_LOGW(TAG, "Playback failed");
+  ESP_LOGD(TAG, "Played %" PRIu32 " ms from %" PRIu32 " bytes with %" PRIu32 " underruns, at least %" PRIu32
+                " bytes buffered",
+           uint32_t(uint64_t(stats.samples_played) * 1000 / this->sample_rate_), stats.bytes_read, stats.underruns,
+           stats.min_buffered == UINT32_MAX ? 0 : stats.min_buffered);
+}
+
+void SpeakerMediaPlayer::control(const media_player::MediaPlayerCall &call) {
+  if (call.get_media_url().has_value()) {
+    this->pending_url_ = call.get_media_url();
+    this->pending_announcement_ = call.get_announcement().value_or(false);
+    this->pipeline_->stop();
+  }
+
+  if (call.get_volume().has_value()) {
+    this->set_volume_(call.get_volume().value());
+    this->muted_ = false;
+  }
+  if (call.get_command().has_value()) {
+    switch (call.get_command().value()) {
+      case media_player::MEDIA_PLAYER_COMMAND_MUTE:
+        this->muted_ = true;
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_UNMUTE:
+        this->muted_ = false;
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_VOLUME_UP:
+        this->set_volume_(this->volume + 0.1f);
+        this->muted_ = false;
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_VOLUME_DOWN:
+        this->set_volume_(this->volume - 0.1f);
+        this->muted_ = false;
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_PLAY:
+        if (this->state == media_player::MEDIA_PLAYER_STATE_PAUSED) {
+          this->pipeline_->set_paused(false);
+          this->state = media_player::MEDIA_PLAYER_STATE_PLAYING;
+        }
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_PAUSE:
+        if (this->state == media_player::MEDIA_PLAYER_STATE_PLAYING) {
+          this->pipeline_->set_paused(true);
+          this->state = media_player::MEDIA_PLAYER_STATE_PAUSED;
+        }
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_TOGGLE:
+        if (this->state == media_player::MEDIA_PLAYER_STATE_PAUSED) {
+          this->pipeline_->set_paused(false);
+          this->state = media_player::MEDIA_PLAYER_STATE_PLAYING;
+        } else if (this->state == media_player::MEDIA_PLAYER_STATE_PLAYING) {
+          this->pipeline_->set_paused(true);
+          this->state = media_player::MEDIA_PLAYER_STATE_PAUSED;
+        }
+        break;
+      case media_player::MEDIA_PLAYER_COMMAND_STOP:
+        // loop() goes idle once the tasks are gone
+        this->pending_url_.reset();
+        this->pipeline_->set_paused(false);
+        this->pipeline_->stop();
+        this->speaker_->stop();
+        break;
+      default:
+        break;
+    }
+  }
+  this->update_gain_();
+  this->publish_state();
+}
+
+void SpeakerMediaPlayer::set_volume_(float volume) { this->volume = clamp(volume, 0.0f, 1.0f); }
+
+void SpeakerMediaPlayer::update_gain_() { this->pipeline_->set_volume(this->muted_ ? 0.0f : this->volume); }
+
+}  // namespace speaker
+}  // namespace esphome
+
+#endif  // USE_ESP32
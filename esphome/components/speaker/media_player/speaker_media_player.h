@@ -0,0 +1,66 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_ESP32
+
+#include "audio_pipeline.h"
+
+#include "esphome/components/media_player/media_player.h"
+#include "esphome/components/speaker/speaker.h"
+#include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
+
+#include <memory>
+#include <string>
+
+namespace esphome {
+namespace speaker {
+
+/** Streams WAV files from HTTP URLs to any speaker platform.
+ *
+ * The download, the decoding and the speaker each run in a task of their own, the main loop only starts and stops
+ * them and tracks the state. Playback therefore keeps going through slow loop iterations, as long as the
+ * prebuffered audio lasts.
+ */
+class SpeakerMediaPlayer : public Component, public media_player::MediaPlayer {
+ public:
+  void setup() override;
+  void loop() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  media_player::MediaPlayerTraits get_traits() override;
+  bool is_muted() const override { return this->muted_; }
+
+  void set_speaker(Speaker *speaker) { this->speaker_ = speaker; }
+  /// Sample rate the speaker plays at, streams are resampled to it.
+  void set_sample_rate(uint32_t sample_rate) { this->sample_rate_ = sample_rate; }
+  void set_buffer_size(size_t buffer_size) { this->buffer_size_ = buffer_size; }
+  /// Audio to buffer before the playback starts.
+  void set_prebuffer(uint32_t prebuffer_ms) { this->prebuffer_ms_ = prebuffer_ms; }
+
+ protected:
+  void control(const media_player::MediaPlayerCall &call) override;
+
+  void set_volume_(float volume);
+  void update_gain_();
+  void log_stats_();
+
+  Speaker *speaker_{nullptr};
+  uint32_t sample_rate_{16000};
+  size_t buffer_size_{32768};
+  uint32_t prebuffer_ms_{500};
+
+  std::unique_ptr<AudioPipeline> pipeline_;
+  /// Started as soon as the pipeline stopped playing the previous URL
+  optional<std::string> pending_url_{};
+  bool pending_announcement_{false};
+  bool muted_{false};
+  uint32_t last_stats_log_{0};
+};
+
+}  // namespace speaker
+}  // namespace esphome
+
+#endif  // USE_ESP32
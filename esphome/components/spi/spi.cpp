@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace spi {
 
@@ -9,6 +11,49 @@ const char *const TAG = "spi";
 
 bool SPIDelegate::is_ready() { return true; }
 
+void SPIDelegate::submit(const SPIBatch &batch, bool wait) {
+  for (const auto &phase : batch.get_phases()) {
+    const uint8_t *tx_buffer = phase.get_tx_buffer();
+    if (tx_buffer == nullptr) {
+      this->read_array(phase.rx_buffer, phase.length);
+    } else if (phase.rx_buffer == nullptr) {
+      this->write_array(tx_buffer, phase.length);
+    } else {
+      this->transfer(tx_buffer, phase.rx_buffer, phase.length);
+    }
+  }
+}
+
+SPIBatch &SPIBatch::write(const uint8_t *data, size_t length) {
+  SPIBatchPhase phase{};
+  phase.length = length;
+  if (length <= SPIBatchPhase::INLINE_SIZE) {
+    phase.inline_tx = true;
+    memcpy(phase.inline_data, data, length);
+  } else {
+    phase.tx_buffer = data;
+  }
+  this->phases_.push_back(phase);
+  return *this;
+}
+
+SPIBatch &SPIBatch::read(uint8_t *data, size_t length) {
+  SPIBatchPhase phase{};
+  phase.rx_buffer = data;
+  phase.length = length;
+  this->phases_.push_back(phase);
+  return *this;
+}
+
+SPIBatch &SPIBatch::transfer(uint8_t *data, size_t length) {
+  SPIBatchPhase phase{};
+  phase.tx_buffer = data;
+  phase.rx_buffer = data;
+  phase.length = length;
+  this->phases_.push_back(phase);
+  return *this;
+}
+
 GPIOPin *const NullPin::NULL_PIN = new NullPin();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 SPIDelegate *SPIComponent::register_device(SPIClient *device, SPIMode mode, SPIBitOrder bit_order, uint32_t data_rate,
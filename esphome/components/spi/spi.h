@@ -165,6 +165,45 @@ class Utility {
 
 // represents a device attached to an SPI bus, with a defined clock rate, mode and bit order. On Arduino this is
 // a thin wrapper over SPIClass.
+/// One phase of an SPIBatch
+struct SPIBatchPhase {
+  static const size_t INLINE_SIZE = 4;
+
+  const uint8_t *tx_buffer;
+  uint8_t *rx_buffer;
+  size_t length;
+  // Writes of up to INLINE_SIZE bytes are copied here, so their source doesn't need to outlive the batch
+  bool inline_tx;
+  uint8_t inline_data[INLINE_SIZE];
+
+  const uint8_t *get_tx_buffer() const { return this->inline_tx ? this->inline_data : this->tx_buffer; }
+};
+
+/**
+ * A sequence of write, read and transfer phases that is submitted at once with SPIDevice::submit(), for example a
+ * command byte, an address and the data that follows. All phases run within the same enable()/disable(), so CS stays
+ * asserted, and hardware delegates queue them back to back instead of setting up a transaction per phase.
+ *
+ * Keep a batch as a member and clear() it for the next use, so its phase storage is only allocated once.
+ */
+class SPIBatch {
+ public:
+  /// Write length bytes. Larger writes send the data in place, so it must stay valid until the batch completed.
+  SPIBatch &write(const uint8_t *data, size_t length);
+  SPIBatch &write_byte(uint8_t data) { return this->write(&data, 1); }
+  /// Read length bytes while writing nulls
+  SPIBatch &read(uint8_t *data, size_t length);
+  /// Write the buffer and replace it with the received data
+  SPIBatch &transfer(uint8_t *data, size_t length);
+
+  void clear() { this->phases_.clear(); }
+  bool empty() const { return this->phases_.empty(); }
+  const std::vector<SPIBatchPhase> &get_phases() const { return this->phases_; }
+
+ protected:
+  std::vector<SPIBatchPhase> phases_;
+};
+
 class SPIDelegate {
   friend class SPIClient;
 
@@ -234,6 +273,24 @@ class SPIDelegate {
       this->transfer(ptr[i]);
   }
 
+  /**
+   * Start writing a buffer without waiting for the transfer to finish. Any previously queued write is finished
+   * first, so a caller can fill a second buffer while the first one is sent. The buffer must stay valid and unchanged
+   * until the next queued write, wait_queued() or end of the transaction. Delegates without a transfer queue write
+   * the buffer synchronously.
+   */
+  virtual void write_array_queued(const uint8_t *ptr, size_t length) { this->write_array(ptr, length); }
+
+  // wait until all queued writes are finished
+  virtual void wait_queued() {}
+
+  /**
+   * Run the phases of a batch. With wait false, delegates with a transfer queue return once all phases are queued;
+   * they complete with the next wait_queued() or the end of the transaction, and until then the buffers of the
+   * batch must stay valid. Delegates without a transfer queue always complete the batch before returning.
+   */
+  virtual void submit(const SPIBatch &batch, bool wait);
+
   // read into a buffer, write nulls
   virtual void read_array(uint8_t *ptr, size_t length) {
     for (size_t i = 0; i != length; i++)
@@ -466,6 +523,14 @@ class SPIDevice : public SPIClient {
 
   void write_array(const uint8_t *data, size_t length) { this->delegate_->write_array(data, length); }
 
+  /// Write without waiting for the transfer to finish, see SPIDelegate::write_array_queued().
+  void write_array_queued(const uint8_t *data, size_t length) { this->delegate_->write_array_queued(data, length); }
+
+  void wait_queued() { this->delegate_->wait_queued(); }
+
+  /// Run all phases of a batch, see SPIDelegate::submit(). Must be called between enable() and disable().
+  void submit(const SPIBatch &batch, bool wait = true) { this->delegate_->submit(batch, wait); }
+
   template<size_t N> void write_array(const std::array<uint8_t, N> &data) { this->write_array(data.data(), N); }
 
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
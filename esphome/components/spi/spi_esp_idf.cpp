@@ -1,4 +1,5 @@
 #include "spi.h"
+#include <cstring>
 #include <vector>
 
 namespace esphome {
@@ -7,6 +8,7 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+static const size_t QUEUE_SIZE = 4;            // interrupt transfers in flight for queued writes and batches
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -18,7 +20,7 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(data_rate);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = QUEUE_SIZE;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (bit_order == BIT_ORDER_LSB_FIRST)
@@ -44,12 +46,14 @@ class SPIDelegateHw : public SPIDelegate {
 
   void end_transaction() override {
     if (this->is_ready()) {
+      this->wait_queued();
       SPIDelegate::end_transaction();
       spi_device_release_bus(this->handle_);
     }
   }
 
   ~SPIDelegateHw() override {
+    this->wait_queued();
     esp_err_t const err = spi_bus_remove_device(this->handle_);
     if (err != ESP_OK)
       ESP_LOGE(TAG, "Remove device failed - err %X", err);
@@ -57,13 +61,13 @@ class SPIDelegateHw : public SPIDelegate {
 
   // do a transfer. either txbuf or rxbuf (but not both) may be null.
   // transfers above the maximum size will be split.
-  // TODO - make use of the queue for interrupt transfers to provide a (short) pipeline of blocks
-  // when splitting is required.
   void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
     if (rxbuf != nullptr && this->write_only_) {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    // polling transfers can't be mixed with pending interrupt transfers
+    this->wait_queued();
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -89,7 +93,87 @@ class SPIDelegateHw : public SPIDelegate {
     }
   }
 
+  /**
+   * Queue the blocks of the buffer as interrupt (DMA) transfers. Up to QUEUE_SIZE blocks are in flight, so the
+   * setup of a block overlaps with sending the previous one, and the last blocks are still sending on return.
+   */
+  void write_array_queued(const uint8_t *ptr, size_t length) override {
+    this->wait_queued();
+    while (length != 0) {
+      if (this->queued_ == QUEUE_SIZE)
+        this->wait_oldest_();
+      spi_transaction_t &desc = this->queue_[this->queue_head_];
+      desc = {};
+      size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+      desc.length = partial * 8;
+      desc.tx_buffer = ptr;
+      esp_err_t const err = spi_device_queue_trans(this->handle_, &desc, portMAX_DELAY);
+      if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Queueing transfer failed - err %X", err);
+        return;
+      }
+      this->queue_head_ = (this->queue_head_ + 1) % QUEUE_SIZE;
+      this->queued_++;
+      length -= partial;
+      ptr += partial;
+    }
+  }
+
+  /**
+   * Queue every phase of the batch as an interrupt (DMA) transfer. The driver starts each transfer from the interrupt
+   * of the previous one, so the phases follow each other without the per-transfer setup of polling. Short writes are
+   * sent from the descriptor itself.
+   */
+  void submit(const SPIBatch &batch, bool wait) override {
+    this->wait_queued();
+    for (const auto &phase : batch.get_phases()) {
+      if (phase.rx_buffer != nullptr && this->write_only_) {
+        ESP_LOGE(TAG, "Attempted read from write-only channel");
+        return;
+      }
+      const uint8_t *tx_buffer = phase.inline_tx ? nullptr : phase.tx_buffer;
+      uint8_t *rx_buffer = phase.rx_buffer;
+      size_t length = phase.length;
+      while (length != 0) {
+        if (this->queued_ == QUEUE_SIZE)
+          this->wait_oldest_();
+        spi_transaction_t &desc = this->queue_[this->queue_head_];
+        desc = {};
+        size_t const partial = std::min(length, MAX_TRANSFER_SIZE);
+        desc.length = partial * 8;
+        desc.rxlength = rx_buffer == nullptr ? 0 : partial * 8;
+        if (phase.inline_tx) {
+          desc.flags = SPI_TRANS_USE_TXDATA;
+          memcpy(desc.tx_data, phase.inline_data, partial);
+        } else {
+          desc.tx_buffer = tx_buffer;
+        }
+        desc.rx_buffer = rx_buffer;
+        esp_err_t const err = spi_device_queue_trans(this->handle_, &desc, portMAX_DELAY);
+        if (err != ESP_OK) {
+          ESP_LOGE(TAG, "Queueing transfer failed - err %X", err);
+          return;
+        }
+        this->queue_head_ = (this->queue_head_ + 1) % QUEUE_SIZE;
+        this->queued_++;
+        length -= partial;
+        if (tx_buffer != nullptr)
+          tx_buffer += partial;
+        if (rx_buffer != nullptr)
+          rx_buffer += partial;
+      }
+    }
+    if (wait)
+      this->wait_queued();
+  }
+
+  void wait_queued() override {
+    while (this->queued_ != 0)
+      this->wait_oldest_();
+  }
+
   void write(uint16_t data, size_t num_bits) override {
+    this->wait_queued();
     spi_transaction_ext_t desc = {};
     desc.command_bits = num_bits;
     desc.base.flags = SPI_TRANS_VARIABLE_CMD;
@@ -116,6 +200,7 @@ class SPIDelegateHw : public SPIDelegate {
    */
   void write_cmd_addr_data(size_t cmd_bits, uint32_t cmd, size_t addr_bits, uint32_t address, const uint8_t *data,
                            size_t length, uint8_t bus_width) override {
+    this->wait_queued();
     spi_transaction_ext_t desc = {};
     if (length == 0 && cmd_bits == 0 && addr_bits == 0) {
       esph_log_w(TAG, "Nothing to transfer");
@@ -189,9 +274,21 @@ class SPIDelegateHw : public SPIDelegate {
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
  protected:
+  // results are returned in queue order, so the oldest descriptor is the one that becomes free
+  void wait_oldest_() {
+    spi_transaction_t *desc;
+    esp_err_t const err = spi_device_get_trans_result(this->handle_, &desc, portMAX_DELAY);
+    if (err != ESP_OK)
+      ESP_LOGE(TAG, "Queued transfer failed - err %X", err);
+    this->queued_--;
+  }
+
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool write_only_{false};
+  spi_transaction_t queue_[QUEUE_SIZE]{};
+  size_t queue_head_{0};
+  size_t queued_{0};
 };
 
 class SPIBusHw : public SPIBus {
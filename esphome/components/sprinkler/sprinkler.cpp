@@ -12,6 +12,9 @@ namespace sprinkler {
 
 static const char *const TAG = "sprinkler";
 
+// All valve operator transitions and latching pulse ends of a controller are dispatched from this one timeout
+static constexpr uint32_t TIMEOUT_TIMELINE = fnv1_hash_constexpr("timeline");
+
 SprinklerSwitch::SprinklerSwitch() {}
 SprinklerSwitch::SprinklerSwitch(switch_::Switch *sprinkler_switch) : on_switch_(sprinkler_switch) {}
 SprinklerSwitch::SprinklerSwitch(switch_::Switch *off_switch, switch_::Switch *on_switch, uint32_t pulse_duration)
@@ -19,8 +22,15 @@ SprinklerSwitch::SprinklerSwitch(switch_::Switch *off_switch, switch_::Switch *o
 
 bool SprinklerSwitch::is_latching_valve() { return (this->off_switch_ != nullptr) && (this->on_switch_ != nullptr); }
 
-void SprinklerSwitch::loop() {
-  if ((this->pinned_millis_) && (millis() > this->pinned_millis_ + this->pulse_duration_)) {
+optional<uint32_t> SprinklerSwitch::pulse_end_millis() {
+  if (!this->pinned_millis_) {
+    return nullopt;
+  }
+  return this->pinned_millis_ + this->pulse_duration_;
+}
+
+void SprinklerSwitch::end_pulse_if_due() {
+  if ((this->pinned_millis_) && (millis() - this->pinned_millis_ >= this->pulse_duration_)) {
     this->pinned_millis_ = 0;  // reset tracker
     if (this->off_switch_->state) {
       this->off_switch_->turn_off();
@@ -147,32 +157,45 @@ SprinklerValveOperator::SprinklerValveOperator() {}
 SprinklerValveOperator::SprinklerValveOperator(SprinklerValve *valve, Sprinkler *controller)
     : controller_(controller), valve_(valve) {}
 
-void SprinklerValveOperator::loop() {
-  if (millis() >= this->start_millis_) {  // dummy check
+void SprinklerValveOperator::advance() {
+  // a late dispatch may find more than one transition due, so catch up on all of them
+  for (auto deadline = this->next_transition_millis(); deadline.has_value();
+       deadline = this->next_transition_millis()) {
+    if (static_cast<int32_t>(millis() - deadline.value()) < 0) {
+      return;
+    }
     switch (this->state_) {
       case STARTING:
-        if (millis() > (this->start_millis_ + this->start_delay_)) {
-          this->run_();  // start_delay_ has been exceeded, so ensure both valves are on and update the state
-        }
+        this->run_();  // start_delay_ has been exceeded, so ensure both valves are on and update the state
         break;
 
       case ACTIVE:
-        if (millis() > (this->start_millis_ + this->start_delay_ + this->run_duration_)) {
-          this->stop();  // start_delay_ + run_duration_ has been exceeded, start shutting down
-        }
+        this->stop();  // start_delay_ + run_duration_ has been exceeded, start shutting down
         break;
 
       case STOPPING:
-        if (millis() > (this->stop_millis_ + this->stop_delay_)) {
-          this->kill_();  // stop_delay_has been exceeded, ensure all valves are off
-        }
+        this->kill_();  // stop_delay_has been exceeded, ensure all valves are off
         break;
 
       default:
-        break;
+        return;
     }
-  } else {         // perhaps millis() rolled over...or something else is horribly wrong!
-    this->stop();  // bail out (TODO: handle this highly unlikely situation better...)
+  }
+}
+
+optional<uint32_t> SprinklerValveOperator::next_transition_millis() {
+  switch (this->state_) {
+    case STARTING:
+      return this->start_millis_ + this->start_delay_;
+
+    case ACTIVE:
+      return this->start_millis_ + this->start_delay_ + this->run_duration_;
+
+    case STOPPING:
+      return this->stop_millis_ + this->stop_delay_;
+
+    default:
+      return nullopt;
   }
 }
 
@@ -398,21 +421,6 @@ Sprinkler::Sprinkler(const std::string &name) {
 
 void Sprinkler::setup() { this->all_valves_off_(true); }
 
-void Sprinkler::loop() {
-  for (auto &p : this->pump_) {
-    p.loop();
-  }
-  for (auto &v : this->valve_) {
-    v.valve_switch.loop();
-  }
-  for (auto &vo : this->valve_op_) {
-    vo.loop();
-  }
-  if (this->prev_req_.has_request() && this->prev_req_.valve_operator()->state() == IDLE) {
-    this->prev_req_.reset();
-  }
-}
-
 void Sprinkler::add_valve(SprinklerControllerSwitch *valve_sw, SprinklerControllerSwitch *enable_sw) {
   auto new_valve_number = this->number_of_valves();
   this->valve_.resize(new_valve_number + 1);
@@ -941,6 +949,7 @@ void Sprinkler::shutdown(bool clear_queue) {
   for (auto &vo : this->valve_op_) {
     vo.stop();
   }
+  this->schedule_timeline_();
   this->fsm_transition_to_shutdown_();
   if (clear_queue) {
     this->clear_queued_valves();
@@ -1095,6 +1104,7 @@ void Sprinkler::set_pump_state(SprinklerSwitch *pump_switch, bool state) {
   } else if (hold_pump_on) {               // we must assume the other controller will switch off the pump when done...
     pump_switch->sync_valve_state(false);  // ...this only impacts latching valves
   }
+  this->schedule_timeline_();  // a latching pump may have started a pulse
 }
 
 uint32_t Sprinkler::total_cycle_time_all_valves() {
@@ -1432,6 +1442,7 @@ void Sprinkler::start_valve_(SprinklerValveRunRequest *req) {
       vo.set_start_delay(this->start_delay_, this->start_delay_is_valve_delay_);
       vo.set_stop_delay(this->stop_delay_, this->stop_delay_is_valve_delay_);
       vo.start();
+      this->schedule_timeline_();
       return;
     }
   }
@@ -1447,6 +1458,55 @@ void Sprinkler::all_valves_off_(const bool include_pump) {
     }
   }
   ESP_LOGD(TAG, "All valves stopped%s", include_pump ? ", including pumps" : "");
+  this->schedule_timeline_();
+}
+
+void Sprinkler::schedule_timeline_() {
+  if (this->prev_req_.has_request() && (this->prev_req_.valve_operator() != nullptr) &&
+      (this->prev_req_.valve_operator()->state() == IDLE)) {
+    this->prev_req_.reset();  // the previous valve has fully shut down
+  }
+
+  const uint32_t now = millis();
+  optional<uint32_t> delay;
+  auto add_event = [&delay, now](optional<uint32_t> event_millis) {
+    if (!event_millis.has_value()) {
+      return;
+    }
+    const int32_t remaining = static_cast<int32_t>(event_millis.value() - now);
+    const uint32_t event_delay = remaining > 0 ? remaining : 0;
+    if (!delay.has_value() || (event_delay < delay.value())) {
+      delay = event_delay;
+    }
+  };
+  for (auto &p : this->pump_) {
+    add_event(p.pulse_end_millis());
+  }
+  for (auto &v : this->valve_) {
+    add_event(v.valve_switch.pulse_end_millis());
+  }
+  for (auto &vo : this->valve_op_) {
+    add_event(vo.next_transition_millis());
+  }
+
+  if (!delay.has_value()) {
+    this->cancel_timeout(TIMEOUT_TIMELINE);
+    return;
+  }
+  this->set_timeout(TIMEOUT_TIMELINE, delay.value(), [this]() { this->dispatch_timeline_(); });
+}
+
+void Sprinkler::dispatch_timeline_() {
+  for (auto &p : this->pump_) {
+    p.end_pulse_if_due();
+  }
+  for (auto &v : this->valve_) {
+    v.valve_switch.end_pulse_if_due();
+  }
+  for (auto &vo : this->valve_op_) {
+    vo.advance();
+  }
+  this->schedule_timeline_();
 }
 
 void Sprinkler::prep_full_cycle_() {
@@ -1563,6 +1623,7 @@ void Sprinkler::fsm_transition_from_valve_run_() {
     for (auto &vo : this->valve_op_) {
       vo.stop();
     }
+    this->schedule_timeline_();
   }
 
   this->load_next_valve_run_request_(this->active_req_.valve());
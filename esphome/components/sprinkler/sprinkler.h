@@ -50,8 +50,9 @@ class SprinklerSwitch {
   SprinklerSwitch(switch_::Switch *sprinkler_switch);
   SprinklerSwitch(switch_::Switch *off_switch, switch_::Switch *on_switch, uint32_t pulse_duration);
 
-  bool is_latching_valve();  // returns true if configured as a latching valve
-  void loop();               // called as a part of loop(), used for latching valve pulses
+  bool is_latching_valve();               // returns true if configured as a latching valve
+  optional<uint32_t> pulse_end_millis();  // returns the millis() at which the current latching pulse ends, if any
+  void end_pulse_if_due();                // ends the latching valve pulse once pulse_end_millis() has passed
   uint32_t pulse_duration() { return this->pulse_duration_; }
   bool state();  // returns the switch's current state
   void set_off_switch(switch_::Switch *off_switch) { this->off_switch_ = off_switch; }
@@ -67,7 +68,7 @@ class SprinklerSwitch {
  protected:
   bool state_{false};
   uint32_t pulse_duration_{0};
-  uint64_t pinned_millis_{0};
+  uint32_t pinned_millis_{0};
   switch_::Switch *off_switch_{nullptr};  // only used for latching valves
   switch_::Switch *on_switch_{nullptr};   // used for both latching and non-latching valves
 };
@@ -145,7 +146,8 @@ class SprinklerValveOperator {
  public:
   SprinklerValveOperator();
   SprinklerValveOperator(SprinklerValve *valve, Sprinkler *controller);
-  void loop();
+  void advance();                               // performs the transitions that are due
+  optional<uint32_t> next_transition_millis();  // returns the millis() at which the next transition is due, if any
   void set_controller(Sprinkler *controller);
   void set_valve(SprinklerValve *valve);
   void set_run_duration(uint32_t run_duration);  // set the desired run duration in seconds
@@ -207,7 +209,6 @@ class Sprinkler : public Component {
   Sprinkler();
   Sprinkler(const std::string &name);
   void setup() override;
-  void loop() override;
   void dump_config() override;
 
   /// add a valve to the controller
@@ -466,6 +467,13 @@ class Sprinkler : public Component {
   /// turns off/closes all valves, including pump if include_pump is true
   void all_valves_off_(bool include_pump = false);
 
+  /// (re)arms the single timeout for the earliest pending valve operator transition or latching pulse end;
+  ///  must be called whenever a valve operator or a pump/valve switch may have changed state
+  void schedule_timeline_();
+
+  /// performs all valve operator transitions and latching pulse ends that are due, then reschedules
+  void dispatch_timeline_();
+
   /// prepares for a full cycle by verifying auto-advance is on as well as one or more valve enable switches.
   void prep_full_cycle_();
 
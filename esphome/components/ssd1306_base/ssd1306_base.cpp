@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace ssd1306_base {
 
@@ -328,6 +330,24 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::fill_rect_internal(int x, int y, int width, int height, Color color) {
+  // the buffer is organised in pages of 8 rows, one byte per column and page
+  bool on = color.is_on();
+  int y2 = y + height;
+  for (int page = y / 8; page * 8 < y2; page++) {
+    int first = std::max(y, page * 8) & 0x07;
+    int last = (std::min(y2, page * 8 + 8) - 1) & 0x07;
+    uint8_t mask = (0xFF << first) & (0xFF >> (7 - last));
+    uint8_t *column = this->buffer_ + page * this->get_width_internal() + x;
+    for (int i = 0; i < width; i++) {
+      if (on) {
+        column[i] |= mask;
+      } else {
+        column[i] &= ~mask;
+      }
+    }
+  }
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
@@ -79,6 +79,7 @@ void SSD1331::setup() {
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
   this->display();           // ...write buffer, which actually clears the display's memory
   this->turn_on();           // display ON
+  this->enable_dirty_tracking_();
 }
 void SSD1331::display() {
   this->command(SSD1331_SETCOLUMN);  // set column address
@@ -87,11 +88,22 @@ void SSD1331::display() {
   this->command(SSD1331_SETROW);     // set row address
   this->command(0x00);               // set row start address
   this->command(0x3F);               // set last row
-  this->write_display_data();
+  this->write_display_data(this->buffer_, this->get_buffer_length_());
 }
 void SSD1331::update() {
   this->do_update_();
-  this->display();
+  this->flush_dirty_();
+}
+void SSD1331::flush_rect_internal(const display::Rect &rect) {
+  // every command costs a delay on this bus, so send whole rows and only narrow down the row address
+  size_t row_length = size_t(this->get_width_internal()) * SSD1331_BYTESPERPIXEL;
+  this->command(SSD1331_SETCOLUMN);
+  this->command(0x00);
+  this->command(this->get_width_internal() - 1);
+  this->command(SSD1331_SETROW);
+  this->command(rect.y);
+  this->command(rect.y2() - 1);
+  this->write_display_data(this->buffer_ + rect.y * row_length, rect.h * row_length);
 }
 void SSD1331::set_brightness(float brightness) {
   // validation
@@ -128,6 +140,7 @@ void HOT SSD1331::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos] = color565 & 0xff;
 }
 void SSD1331::fill(Color color) {
+  this->track_fill_(color);
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
     if (i & 1) {
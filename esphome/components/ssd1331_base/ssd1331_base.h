@@ -29,7 +29,8 @@ class SSD1331 : public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  virtual void write_display_data(const uint8_t *data, size_t length) = 0;
+  void flush_rect_internal(const display::Rect &rect) override;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
@@ -88,6 +88,7 @@ void SSD1351::setup() {
   this->fill(Color::BLACK);  // clear display - ensures we do not see garbage at power-on
   this->display();           // ...write buffer, which actually clears the display's memory
   this->turn_on();           // display ON
+  this->enable_dirty_tracking_();
 }
 void SSD1351::display() {
   this->command(SSD1351_SETCOLUMN);  // set column address
@@ -97,11 +98,23 @@ void SSD1351::display() {
   this->data(0x00);                  // set row start address
   this->data(0x7F);                  // set last row
   this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  this->write_display_data(this->buffer_, this->get_buffer_length_());
 }
 void SSD1351::update() {
   this->do_update_();
-  this->display();
+  this->flush_dirty_();
+}
+void SSD1351::flush_rect_internal(const display::Rect &rect) {
+  // every command costs a delay on this bus, so send whole rows and only narrow down the row address
+  size_t row_length = size_t(this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
+  this->command(SSD1351_SETCOLUMN);
+  this->data(0x00);
+  this->data(this->get_width_internal() - 1);
+  this->command(SSD1351_SETROW);
+  this->data(rect.y);
+  this->data(rect.y2() - 1);
+  this->command(SSD1351_WRITERAM);
+  this->write_display_data(this->buffer_ + rect.y * row_length, rect.h * row_length);
 }
 void SSD1351::set_brightness(float brightness) {
   // validation
@@ -160,6 +173,7 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos] = color565 & 0xff;
 }
 void SSD1351::fill(Color color) {
+  this->track_fill_(color);
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
     if (i & 1) {
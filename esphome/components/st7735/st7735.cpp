@@ -289,11 +289,12 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  this->enable_dirty_tracking_();
 }
 
 void ST7735::update() {
   this->do_update_();
-  this->write_display_data_();
+  this->flush_dirty_();
 }
 
 int ST7735::get_height_internal() { return height_; }
@@ -417,14 +418,11 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
   this->disable();
 }
 
-void HOT ST7735::write_display_data_() {
-  uint16_t offsetx = colstart_;
-  uint16_t offsety = rowstart_;
-
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+void HOT ST7735::flush_rect_internal(const display::Rect &rect) {
+  uint16_t x1 = this->colstart_ + rect.x;
+  uint16_t x2 = x1 + rect.w - 1;
+  uint16_t y1 = this->rowstart_ + rect.y;
+  uint16_t y2 = y1 + rect.h - 1;
 
   this->enable();
 
@@ -445,9 +443,11 @@ void HOT ST7735::write_display_data_() {
   this->write_byte(ST77XX_RAMWR);
   this->dc_pin_->digital_write(true);
 
-  if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+  int stride = this->get_width_internal();
+  for (int y = rect.y; y < rect.y2(); y++) {
+    size_t line = size_t(y) * stride + rect.x;
+    if (this->eightbitcolor_) {
+      for (int index = 0; index < rect.w; ++index) {
         auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
@@ -456,9 +456,14 @@ void HOT ST7735::write_display_data_() {
         this->write_byte((color >> 8) & 0xff);
         this->write_byte(color & 0xff);
       }
+    } else {
+      // the window wraps to the next row by itself, full width rows go out in one transfer
+      if (rect.x == 0 && rect.w == stride) {
+        this->write_array(this->buffer_ + line * 2, stride * 2 * rect.h);
+        break;
+      }
+      this->write_array(this->buffer_ + line * 2, rect.w * 2);
     }
-  } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
   }
   this->disable();
 }
@@ -61,7 +61,7 @@ class ST7735 : public display::DisplayBuffer,
   void writecommand_(uint8_t value);
   void writedata_(uint8_t value);
 
-  void write_display_data_();
+  void flush_rect_internal(const display::Rect &rect) override;
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
@@ -1,6 +1,8 @@
 #include "st7789v.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace st7789v {
 
@@ -172,7 +174,9 @@ void ST7789V::write_display_data() {
   this->dc_pin_->digital_write(true);
 
   if (this->eightbitcolor_) {
-    uint8_t temp_buffer[TEMP_BUFFER_SIZE];
+    // one buffer is filled while the other one is sent, the bus driver may still read from it after the write returns
+    alignas(4) uint8_t temp_buffers[2][TEMP_BUFFER_SIZE];
+    uint8_t *temp_buffer = temp_buffers[0];
     size_t temp_index = 0;
     for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
       for (int index = 0; index < this->get_width_internal(); ++index) {
@@ -182,13 +186,14 @@ void ST7789V::write_display_data() {
         temp_buffer[temp_index++] = (uint8_t) (color >> 8);
         temp_buffer[temp_index++] = (uint8_t) color;
         if (temp_index == TEMP_BUFFER_SIZE) {
-          this->write_array(temp_buffer, TEMP_BUFFER_SIZE);
+          this->write_array_queued(temp_buffer, TEMP_BUFFER_SIZE);
+          temp_buffer = temp_buffer == temp_buffers[0] ? temp_buffers[1] : temp_buffers[0];
           temp_index = 0;
         }
       }
     }
     if (temp_index != 0)
-      this->write_array(temp_buffer, temp_index);
+      this->write_array_queued(temp_buffer, temp_index);
   } else {
     this->write_array(this->buffer_, this->get_buffer_length_());
   }
@@ -305,5 +310,29 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   }
 }
 
+void HOT ST7789V::fill_rect_internal(int x, int y, int width, int height, Color color) {
+  int stride = this->get_width_internal();
+  if (this->eightbitcolor_) {
+    auto color332 = display::ColorUtil::color_to_332(color);
+    for (int j = y; j < y + height; j++)
+      memset(this->buffer_ + x + j * stride, color332, width);
+    return;
+  }
+  auto color565 = display::ColorUtil::color_to_565(color);
+  uint8_t high = (color565 >> 8) & 0xff;
+  uint8_t low = color565 & 0xff;
+  for (int j = y; j < y + height; j++) {
+    uint8_t *row = this->buffer_ + (x + j * stride) * 2;
+    if (high == low) {
+      memset(row, high, width * 2);
+      continue;
+    }
+    for (int i = 0; i < width * 2; i += 2) {
+      row[i] = high;
+      row[i + 1] = low;
+    }
+  }
+}
+
 }  // namespace st7789v
 }  // namespace esphome
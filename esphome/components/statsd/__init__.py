@@ -3,6 +3,7 @@ import esphome.config_validation as cv
 from esphome.components import sensor, binary_sensor
 from esphome.const import (
     CONF_ID,
+    CONF_INTERVAL,
     CONF_PORT,
     CONF_NAME,
     CONF_SENSORS,
@@ -15,21 +16,28 @@ DEPENDENCIES = ["network"]
 
 CONF_HOST = "host"
 CONF_PREFIX = "prefix"
+CONF_SEND_ON_CHANGE = "send_on_change"
 
 statsd_component_ns = cg.esphome_ns.namespace("statsd")
 StatsdComponent = statsd_component_ns.class_("StatsdComponent", cg.PollingComponent)
 
-CONFIG_SENSORS_SCHEMA = cv.Schema(
+METRIC_SCHEMA = cv.Schema(
     {
-        cv.Required(CONF_ID): cv.use_id(sensor.Sensor),
         cv.Required(CONF_NAME): cv.string_strict,
+        cv.Optional(CONF_INTERVAL): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_SEND_ON_CHANGE, default=False): cv.boolean,
+    }
+)
+
+CONFIG_SENSORS_SCHEMA = METRIC_SCHEMA.extend(
+    {
+        cv.Required(CONF_ID): cv.use_id(sensor.Sensor),
     }
 )
 
-CONFIG_BINARY_SENSORS_SCHEMA = cv.Schema(
+CONFIG_BINARY_SENSORS_SCHEMA = METRIC_SCHEMA.extend(
     {
         cv.Required(CONF_ID): cv.use_id(binary_sensor.BinarySensor),
-        cv.Required(CONF_NAME): cv.string_strict,
     }
 )
 
@@ -58,8 +66,22 @@ async def to_code(config):
 
     for sensor_cfg in config.get(CONF_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
-        cg.add(var.register_sensor(sensor_cfg[CONF_NAME], s))
+        cg.add(
+            var.register_sensor(sensor_cfg[CONF_NAME], s, *_metric_args(sensor_cfg))
+        )
 
     for sensor_cfg in config.get(CONF_BINARY_SENSORS, []):
         s = await cg.get_variable(sensor_cfg[CONF_ID])
-        cg.add(var.register_binary_sensor(sensor_cfg[CONF_NAME], s))
+        cg.add(
+            var.register_binary_sensor(
+                sensor_cfg[CONF_NAME], s, *_metric_args(sensor_cfg)
+            )
+        )
+
+
+def _metric_args(config):
+    interval = config.get(CONF_INTERVAL)
+    return (
+        0 if interval is None else interval.total_milliseconds,
+        config[CONF_SEND_ON_CHANGE],
+    )
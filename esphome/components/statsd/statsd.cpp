@@ -1,17 +1,26 @@
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+
 #include "statsd.h"
 
 namespace esphome {
 namespace statsd {
 
-// send UDP packet if we reach 1Kb packed size
-// this is needed since statsD does not support fragmented UDP packets
-static const uint16_t SEND_THRESHOLD = 1024;
-
 static const char *const TAG = "statsD";
 
 void StatsdComponent::setup() {
+  for (auto &s : this->sensors_) {
+    if (this->prefix_ != nullptr && this->prefix_[0] != '\0') {
+      s.key = this->prefix_;
+      s.key += '.';
+    }
+    s.key += s.name;
+  }
+
 #ifndef USE_ESP8266
   this->sock_ = esphome::socket::socket(AF_INET, SOCK_DGRAM, 0);
 
@@ -45,39 +54,49 @@ void StatsdComponent::dump_config() {
   }
 
   ESP_LOGCONFIG(TAG, "  metrics:");
-  for (sensors_t s : this->sensors_) {
+  for (const auto &s : this->sensors_) {
     ESP_LOGCONFIG(TAG, "    - name: %s", s.name);
     ESP_LOGCONFIG(TAG, "      type: %d", s.type);
+    if (s.interval > 0)
+      ESP_LOGCONFIG(TAG, "      interval: %" PRIu32 " ms", s.interval);
+    if (s.on_change)
+      ESP_LOGCONFIG(TAG, "      on change: YES");
   }
 }
 
 float StatsdComponent::get_setup_priority() const { return esphome::setup_priority::AFTER_WIFI; }
 
 #ifdef USE_SENSOR
-void StatsdComponent::register_sensor(const char *name, esphome::sensor::Sensor *sensor) {
-  sensors_t s;
+void StatsdComponent::register_sensor(const char *name, esphome::sensor::Sensor *sensor, uint32_t interval,
+                                      bool on_change) {
+  Metric s;
   s.name = name;
   s.sensor = sensor;
   s.type = TYPE_SENSOR;
+  s.interval = interval;
+  s.on_change = on_change;
   this->sensors_.push_back(s);
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
-void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_sensor::BinarySensor *binary_sensor) {
-  sensors_t s;
+void StatsdComponent::register_binary_sensor(const char *name, esphome::binary_sensor::BinarySensor *binary_sensor,
+                                             uint32_t interval, bool on_change) {
+  Metric s;
   s.name = name;
   s.binary_sensor = binary_sensor;
   s.type = TYPE_BINARY_SENSOR;
+  s.interval = interval;
+  s.on_change = on_change;
   this->sensors_.push_back(s);
 }
 #endif
 
 void StatsdComponent::update() {
-  std::string out;
-  out.reserve(SEND_THRESHOLD);
+  const uint32_t now = millis();
+  this->buffer_len_ = 0;
 
-  for (sensors_t s : this->sensors_) {
+  for (auto &s : this->sensors_) {
     double val = 0;
     switch (s.type) {
 #ifdef USE_SENSOR
@@ -104,39 +123,58 @@ void StatsdComponent::update() {
         continue;
     }
 
+    if (s.sent) {
+      if (s.interval > 0 && now - s.last_sent < s.interval)
+        continue;
+      if (s.on_change && (val == s.last_value || (std::isnan(val) && std::isnan(s.last_value))))
+        continue;
+    }
+    s.sent = true;
+    s.last_sent = now;
+    s.last_value = val;
+
     // statsD gauge:
     // https://github.com/statsd/statsd/blob/master/docs/metric_types.md
     // This implies you can't explicitly set a gauge to a negative number without first setting it to zero.
     if (val < 0) {
-      if (this->prefix_) {
-        out.append(str_sprintf("%s.", this->prefix_));
-      }
-      out.append(str_sprintf("%s:0|g\n", s.name));
+      this->append_gauge_(s.key, 0);
     }
-    if (this->prefix_) {
-      out.append(str_sprintf("%s.", this->prefix_));
-    }
-    out.append(str_sprintf("%s:%f|g\n", s.name, val));
+    this->append_gauge_(s.key, val);
+  }
 
-    if (out.length() > SEND_THRESHOLD) {
-      this->send_(&out);
-      out.clear();
+  this->send_();
+}
+
+void StatsdComponent::append_gauge_(const std::string &key, double value) {
+  for (int attempt = 0; attempt < 2; attempt++) {
+    size_t space = sizeof(this->buffer_) - this->buffer_len_;
+    int len = snprintf(this->buffer_ + this->buffer_len_, space, "%s:%f|g\n", key.c_str(), value);
+    if (len < 0)
+      return;
+    if (size_t(len) < space) {
+      this->buffer_len_ += len;
+      return;
     }
+    if (this->buffer_len_ == 0)
+      break;
+    // Doesn't fit anymore, start a new packet
+    this->send_();
   }
-
-  this->send_(&out);
+  ESP_LOGW(TAG, "Metric %s is too long to send", key.c_str());
 }
 
-void StatsdComponent::send_(std::string *out) {
-  if (out->empty()) {
+void StatsdComponent::send_() {
+  if (this->buffer_len_ == 0) {
     return;
   }
+  const size_t len = this->buffer_len_;
+  this->buffer_len_ = 0;
 #ifdef USE_ESP8266
   IPAddress ip;
   ip.fromString(this->host_);
 
   this->sock_.beginPacket(ip, this->port_);
-  this->sock_.write((const uint8_t *) out->c_str(), out->length());
+  this->sock_.write((const uint8_t *) this->buffer_, len);
   this->sock_.endPacket();
 
 #else
@@ -144,10 +182,10 @@ void StatsdComponent::send_(std::string *out) {
     return;
   }
 
-  int n_bytes = this->sock_->sendto(out->c_str(), out->length(), 0, reinterpret_cast<sockaddr *>(&this->destination_),
-                                    sizeof(this->destination_));
-  if (n_bytes != out->length()) {
-    ESP_LOGE(TAG, "Failed to send UDP packed (%d of %d)", n_bytes, out->length());
+  ssize_t n_bytes = this->sock_->sendto(this->buffer_, len, 0, reinterpret_cast<sockaddr *>(&this->destination_),
+                                        sizeof(this->destination_));
+  if (n_bytes != (ssize_t) len) {
+    ESP_LOGE(TAG, "Failed to send UDP packed (%d of %u)", (int) n_bytes, (unsigned) len);
   }
 #endif
 }
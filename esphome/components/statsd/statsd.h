@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "esphome/core/defines.h"
@@ -27,9 +28,9 @@
 namespace esphome {
 namespace statsd {
 
-using sensor_type_t = enum { TYPE_SENSOR, TYPE_BINARY_SENSOR };
+enum sensor_type_t { TYPE_SENSOR, TYPE_BINARY_SENSOR };
 
-using sensors_t = struct {
+struct Metric {
   const char *name;
   sensor_type_t type;
   union {
@@ -40,6 +41,16 @@ using sensors_t = struct {
     esphome::binary_sensor::BinarySensor *binary_sensor;
 #endif
   };
+  /// Minimum time between two values sent, 0 sends one with every update
+  uint32_t interval;
+  /// Only send values that differ from the last one sent
+  bool on_change;
+
+  /// The name including the prefix, built once in setup()
+  std::string key{};
+  bool sent{false};
+  uint32_t last_sent{0};
+  double last_value{0};
 };
 
 class StatsdComponent : public PollingComponent {
@@ -58,11 +69,13 @@ class StatsdComponent : public PollingComponent {
   }
 
 #ifdef USE_SENSOR
-  void register_sensor(const char *name, esphome::sensor::Sensor *sensor);
+  void register_sensor(const char *name, esphome::sensor::Sensor *sensor, uint32_t interval = 0,
+                       bool on_change = false);
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  void register_binary_sensor(const char *name, esphome::binary_sensor::BinarySensor *binary_sensor);
+  void register_binary_sensor(const char *name, esphome::binary_sensor::BinarySensor *binary_sensor,
+                              uint32_t interval = 0, bool on_change = false);
 #endif
 
  private:
@@ -70,7 +83,7 @@ class StatsdComponent : public PollingComponent {
   const char *prefix_;
   uint16_t port_;
 
-  std::vector<sensors_t> sensors_;
+  std::vector<Metric> sensors_;
 
 #ifdef USE_ESP8266
   WiFiUDP sock_;
@@ -79,7 +92,13 @@ class StatsdComponent : public PollingComponent {
   struct sockaddr_in destination_;
 #endif
 
-  void send_(std::string *out);
+  /// Append a gauge to the packet, sending the packet first if the gauge doesn't fit anymore.
+  void append_gauge_(const std::string &key, double value);
+  void send_();
+
+  // Payload of a single UDP packet, statsD doesn't support fragmented ones
+  char buffer_[1432];
+  size_t buffer_len_{0};
 };
 
 }  // namespace statsd
@@ -25,10 +25,16 @@ void TCA9555Component::setup() {
     this->mark_failed();
     return;
   }
+  if (this->interrupt_pin_ != nullptr) {
+    // INT goes low on any input change and is released when the inputs are read
+    this->interrupt_pin_->setup();
+    this->interrupt_pin_->attach_interrupt(&TCA9555Component::gpio_intr, this, gpio::INTERRUPT_FALLING_EDGE);
+  }
 }
 void TCA9555Component::dump_config() {
   ESP_LOGCONFIG(TAG, "TCA9555:");
   LOG_I2C_DEVICE(this)
+  LOG_PIN("  Interrupt Pin: ", this->interrupt_pin_);
   if (this->is_failed()) {
     ESP_LOGE(TAG, "Communication with TCA9555 failed!");
   }
@@ -44,7 +50,15 @@ void TCA9555Component::pin_mode(uint8_t pin, gpio::Flags flags) {
   // Write GPIO to enable input mode
   this->write_gpio_modes_();
 }
-void TCA9555Component::loop() { this->reset_pin_cache_(); }
+void TCA9555Component::loop() {
+  this->reset_pin_cache_();
+  if (this->interrupt_pin_ != nullptr) {
+    // Reading right away releases INT, the snapshot then stays valid until the next change
+    this->disable_loop();
+    this->digital_read(0);
+  }
+}
+void IRAM_ATTR TCA9555Component::gpio_intr(TCA9555Component *arg) { arg->enable_loop_soon_from_isr(); }
 
 bool TCA9555Component::read_gpio_outputs_() {
   if (this->is_failed())
@@ -76,15 +90,13 @@ bool TCA9555Component::read_gpio_modes_() {
 bool TCA9555Component::digital_read_hw(uint8_t pin) {
   if (this->is_failed())
     return false;
-  bool success;
   uint8_t data[2];
-  success = this->read_bytes(TCA9555_INPUT_PORT_REGISTER_0, data, 2);
-  this->input_mask_ = (uint16_t(data[1]) << 8) | (uint16_t(data[0]) << 0);
-
-  if (!success) {
+  if (!this->read_bytes(TCA9555_INPUT_PORT_REGISTER_0, data, 2)) {
+    // Keep the last known states instead of uninitialized data
     this->status_set_warning("Failed to read input register");
     return false;
   }
+  this->input_mask_ = (uint16_t(data[1]) << 8) | (uint16_t(data[0]) << 0);
 
   this->status_clear_warning();
   return true;
@@ -17,6 +17,8 @@ class TCA9555Component : public Component,
   /// Check i2c availability and setup masks
   void setup() override;
   void pin_mode(uint8_t pin, gpio::Flags flags);
+  /// Only read the inputs after the INT output signalled a change, instead of once per loop iteration.
+  void set_interrupt_pin(InternalGPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
 
   float get_setup_priority() const override;
 
@@ -25,6 +27,8 @@ class TCA9555Component : public Component,
   void loop() override;
 
  protected:
+  static void gpio_intr(TCA9555Component *arg);
+
   bool digital_read_hw(uint8_t pin) override;
   bool digital_read_cache(uint8_t pin) override;
   void digital_write_hw(uint8_t pin, bool value) override;
@@ -35,6 +39,7 @@ class TCA9555Component : public Component,
   uint16_t output_mask_{0x00};
   /// The state read in digital_read_hw - 1 means HIGH, 0 means LOW
   uint16_t input_mask_{0x00};
+  InternalGPIOPin *interrupt_pin_{nullptr};
 
   bool read_gpio_modes_();
   bool write_gpio_modes_();
@@ -21,7 +21,8 @@ void ThermostatClimate::setup() {
     // required action may have changed, recompute, refresh, we'll publish_state() later
     this->switch_to_action_(this->compute_action_(), false);
     this->switch_to_supplemental_action_(this->compute_supplemental_action_());
-    // current temperature and possibly action changed, so publish the new state
+    // current temperature and possibly action changed, so publish the new state; the sensor updating with the same
+    // value and action doesn't reach the frontends, publish_state() skips states identical to the last one
     this->publish_state();
   });
   this->current_temperature = this->sensor_->state;
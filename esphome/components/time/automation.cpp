@@ -18,11 +18,19 @@ void CronTrigger::add_day_of_month(uint8_t day_of_month) { this->days_of_month_[
 void CronTrigger::add_month(uint8_t month) { this->months_[month] = true; }
 void CronTrigger::add_day_of_week(uint8_t day_of_week) { this->days_of_week_[day_of_week] = true; }
 bool CronTrigger::matches(const ESPTime &time) {
-  return time.is_valid() && this->seconds_[time.second] && this->minutes_[time.minute] && this->hours_[time.hour] &&
-         this->days_of_month_[time.day_of_month] && this->months_[time.month] && this->days_of_week_[time.day_of_week];
+  return time.is_valid() && this->seconds_[time.second] && this->matches_minute_(time);
+}
+bool CronTrigger::matches_minute_(const ESPTime &time) {
+  return this->minutes_[time.minute] && this->hours_[time.hour] && this->days_of_month_[time.day_of_month] &&
+         this->months_[time.month] && this->days_of_week_[time.day_of_week];
 }
 void CronTrigger::loop() {
-  ESPTime time = this->rtc_->now();
+  // Only convert to local time once per second, not on every loop iteration
+  const time_t timestamp = this->rtc_->timestamp_now();
+  if (this->last_check_.has_value() && this->last_check_->timestamp == timestamp)
+    return;
+
+  ESPTime time = ESPTime::from_epoch_local(timestamp);
   if (!time.is_valid())
     return;
 
@@ -41,7 +49,13 @@ void CronTrigger::loop() {
     }
 
     while (true) {
-      this->last_check_->increment_second();
+      ESPTime &check = *this->last_check_;
+      if (check.second < 59 && !this->matches_minute_(check)) {
+        // None of the remaining seconds of this minute can match, skip to the last one
+        check.timestamp += 59 - check.second;
+        check.second = 59;
+      }
+      check.increment_second();
       if (*this->last_check_ >= time)
         break;
 
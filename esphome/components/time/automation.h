@@ -31,6 +31,9 @@ class CronTrigger : public Trigger<>, public Component {
   float get_setup_priority() const override;
 
  protected:
+  /// Whether the time matches everything but the seconds.
+  bool matches_minute_(const ESPTime &time);
+
   std::bitset<61> seconds_;
   std::bitset<60> minutes_;
   std::bitset<24> hours_;
@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <cmath>
+
 namespace esphome {
 namespace time_based {
 
@@ -22,32 +24,6 @@ void TimeBasedCover::setup() {
     this->position = 0.5f;
   }
 }
-void TimeBasedCover::loop() {
-  if (this->current_operation == COVER_OPERATION_IDLE)
-    return;
-
-  const uint32_t now = millis();
-
-  // Recompute position every loop cycle
-  this->recompute_position_();
-
-  if (this->is_at_target_()) {
-    if (this->has_built_in_endstop_ &&
-        (this->target_position_ == COVER_OPEN || this->target_position_ == COVER_CLOSED)) {
-      // Don't trigger stop, let the cover stop by itself.
-      this->current_operation = COVER_OPERATION_IDLE;
-    } else {
-      this->start_direction_(COVER_OPERATION_IDLE);
-    }
-    this->publish_state();
-  }
-
-  // Send current position every second
-  if (now - this->last_publish_time_ > 1000) {
-    this->publish_state(false);
-    this->last_publish_time_ = now;
-  }
-}
 float TimeBasedCover::get_setup_priority() const { return setup_priority::DATA; }
 CoverTraits TimeBasedCover::get_traits() {
   auto traits = CoverTraits();
@@ -110,20 +86,39 @@ void TimeBasedCover::stop_prev_trigger_() {
     this->prev_command_trigger_ = nullptr;
   }
 }
-bool TimeBasedCover::is_at_target_() const {
-  switch (this->current_operation) {
-    case COVER_OPERATION_OPENING:
-      return this->position >= this->target_position_;
-    case COVER_OPERATION_CLOSING:
-      return this->position <= this->target_position_;
-    case COVER_OPERATION_IDLE:
-    default:
-      return true;
+void TimeBasedCover::schedule_arrival_() {
+  this->recompute_position_();
+  float distance;
+  uint32_t duration;
+  if (this->current_operation == COVER_OPERATION_OPENING) {
+    distance = this->target_position_ - this->position;
+    duration = this->open_duration_;
+  } else {
+    distance = this->position - this->target_position_;
+    duration = this->close_duration_;
+  }
+  // Rounded up, so the position is at the target when the timeout runs
+  const uint32_t remaining = distance > 0.0f ? static_cast<uint32_t>(std::ceil(distance * duration)) : 0;
+  this->set_timeout("arrival", remaining, [this]() { this->arrive_(); });
+}
+void TimeBasedCover::arrive_() {
+  this->recompute_position_();
+  if (this->has_built_in_endstop_ &&
+      (this->target_position_ == COVER_OPEN || this->target_position_ == COVER_CLOSED)) {
+    // Don't trigger stop, let the cover stop by itself.
+    this->current_operation = COVER_OPERATION_IDLE;
+    this->cancel_interval("publish");
+  } else {
+    this->start_direction_(COVER_OPERATION_IDLE);
   }
+  this->publish_state();
 }
 void TimeBasedCover::start_direction_(CoverOperation dir) {
-  if (dir == this->current_operation && dir != COVER_OPERATION_IDLE)
+  if (dir == this->current_operation && dir != COVER_OPERATION_IDLE) {
+    // The target may have changed
+    this->schedule_arrival_();
     return;
+  }
 
   this->recompute_position_();
   Trigger<> *trig;
@@ -152,6 +147,18 @@ void TimeBasedCover::start_direction_(CoverOperation dir) {
   this->stop_prev_trigger_();
   trig->trigger();
   this->prev_command_trigger_ = trig;
+
+  if (dir == COVER_OPERATION_IDLE) {
+    this->cancel_timeout("arrival");
+    this->cancel_interval("publish");
+    return;
+  }
+  this->schedule_arrival_();
+  // Send current position every second
+  this->set_interval("publish", 1000, [this]() {
+    this->recompute_position_();
+    this->publish_state(false);
+  });
 }
 void TimeBasedCover::recompute_position_() {
   if (this->current_operation == COVER_OPERATION_IDLE)
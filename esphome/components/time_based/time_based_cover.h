@@ -10,7 +10,6 @@ namespace time_based {
 class TimeBasedCover : public cover::Cover, public Component {
  public:
   void setup() override;
-  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override;
 
@@ -28,9 +27,11 @@ class TimeBasedCover : public cover::Cover, public Component {
  protected:
   void control(const cover::CoverCall &call) override;
   void stop_prev_trigger_();
-  bool is_at_target_() const;
 
   void start_direction_(cover::CoverOperation dir);
+  /// (Re)starts the timeout stopping the cover at the target, the position is only computed when it's published.
+  void schedule_arrival_();
+  void arrive_();
 
   void recompute_position_();
 
@@ -43,7 +44,6 @@ class TimeBasedCover : public cover::Cover, public Component {
   Trigger<> *prev_command_trigger_{nullptr};
   uint32_t last_recompute_time_{0};
   uint32_t start_dir_time_{0};
-  uint32_t last_publish_time_{0};
   float target_position_{0};
   bool has_built_in_endstop_{false};
   bool manual_control_{false};
@@ -124,14 +124,14 @@ void TLC59208FOutput::loop() {
     return;
 
   for (uint8_t channel = this->min_channel_; channel <= this->max_channel_; channel++) {
-    uint8_t pwm = this->pwm_amounts_[channel];
-    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, pwm);
-
-    uint8_t reg = TLC59208F_REG_PWM0 + channel;
-    if (!this->write_byte(reg, pwm)) {
-      this->status_set_warning();
-      return;
-    }
+    ESP_LOGVV(TAG, "Channel %02u: pwm=%04u ", channel, this->pwm_amounts_[channel]);
+  }
+
+  // One transaction for all channels, AI2 in the control register auto-increments the address
+  uint8_t reg = TLC59208F_MODE1_AI2 | (TLC59208F_REG_PWM0 + this->min_channel_);
+  if (!this->write_bytes(reg, &this->pwm_amounts_[this->min_channel_], this->max_channel_ - this->min_channel_ + 1)) {
+    this->status_set_warning();
+    return;
   }
 
   this->status_clear_warning();
@@ -1,6 +1,10 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor, time
+from esphome.components.persistent_accumulator import (
+    CONF_PERSISTENT_ACCUMULATOR_ID,
+    PersistentAccumulator,
+)
 from esphome.const import (
     CONF_ICON,
     CONF_ID,
@@ -14,6 +18,7 @@ from esphome.const import (
 )
 from esphome.core.entity_helpers import inherit_property_from
 
+AUTO_LOAD = ["persistent_accumulator"]
 DEPENDENCIES = ["time"]
 
 CONF_POWER_ID = "power_id"
@@ -47,6 +52,9 @@ CONFIG_SCHEMA = (
         {
             cv.GenerateID(CONF_TIME_ID): cv.use_id(time.RealTimeClock),
             cv.Required(CONF_POWER_ID): cv.use_id(sensor.Sensor),
+            cv.GenerateID(CONF_PERSISTENT_ACCUMULATOR_ID): cv.use_id(
+                PersistentAccumulator
+            ),
             cv.Optional(CONF_RESTORE, default=True): cv.boolean,
             cv.Optional("min_save_interval"): cv.invalid(
                 "`min_save_interval` was removed in 2022.6.0. Please use the `preferences` -> `flash_write_interval` to adjust."
@@ -88,5 +96,7 @@ async def to_code(config):
     cg.add(var.set_parent(sens))
     time_ = await cg.get_variable(config[CONF_TIME_ID])
     cg.add(var.set_time(time_))
-    cg.add(var.set_restore(config[CONF_RESTORE]))
+    if config[CONF_RESTORE]:
+        accumulator = await cg.get_variable(config[CONF_PERSISTENT_ACCUMULATOR_ID])
+        cg.add(var.set_accumulator(accumulator))
     cg.add(var.set_method(config[CONF_METHOD]))
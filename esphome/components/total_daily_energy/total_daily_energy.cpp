@@ -8,11 +8,8 @@ static const char *const TAG = "total_daily_energy";
 
 void TotalDailyEnergy::setup() {
   float initial_value = 0;
-
-  if (this->restore_) {
-    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
-    this->pref_.load(&initial_value);
-  }
+  if (this->accumulator_ != nullptr)
+    initial_value = this->accumulator_->get(this->accumulator_index_);
   this->publish_state_and_save(initial_value);
 
   this->last_update_ = millis();
@@ -42,9 +39,8 @@ void TotalDailyEnergy::loop() {
 void TotalDailyEnergy::publish_state_and_save(float state) {
   this->total_energy_ = state;
   this->publish_state(state);
-  if (this->restore_) {
-    this->pref_.save(&state);
-  }
+  if (this->accumulator_ != nullptr)
+    this->accumulator_->set(this->accumulator_index_, state);
 }
 
 void TotalDailyEnergy::process_new_state_(float state) {
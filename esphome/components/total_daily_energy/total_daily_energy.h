@@ -1,8 +1,8 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/core/preferences.h"
 #include "esphome/core/hal.h"
+#include "esphome/components/persistent_accumulator/persistent_accumulator.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esphome/components/time/real_time_clock.h"
 
@@ -17,7 +17,11 @@ enum TotalDailyEnergyMethod {
 
 class TotalDailyEnergy : public sensor::Sensor, public Component {
  public:
-  void set_restore(bool restore) { restore_ = restore; }
+  /// Restore the total after reboots, from the shared store of counters.
+  void set_accumulator(persistent_accumulator::PersistentAccumulator *accumulator) {
+    accumulator_ = accumulator;
+    accumulator_index_ = accumulator->add_counter(this);
+  }
   void set_time(time::RealTimeClock *time) { time_ = time; }
   void set_parent(Sensor *parent) { parent_ = parent; }
   void set_method(TotalDailyEnergyMethod method) { method_ = method; }
@@ -31,13 +35,13 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
  protected:
   void process_new_state_(float state);
 
-  ESPPreferenceObject pref_;
+  persistent_accumulator::PersistentAccumulator *accumulator_{nullptr};
+  size_t accumulator_index_{0};
   time::RealTimeClock *time_;
   Sensor *parent_;
   TotalDailyEnergyMethod method_;
   uint16_t last_day_of_year_{};
   uint32_t last_update_{0};
-  bool restore_;
   float total_energy_{0.0f};
   float last_power_state_{0.0f};
 };
@@ -57,7 +57,8 @@ void Touchscreen::loop() {
       }
     } else {
       this->store_.touched = false;
-      this->defer([this]() { this->send_touches_(); });
+      // Deliver right away, a defer() would hold the touch back for another loop iteration
+      this->send_touches_();
       if (this->touch_timeout_ > 0) {
         // Simulate a touch after <this->touch_timeout_> ms. This will reset any existing timeout operation.
         // This is to detect touch release.
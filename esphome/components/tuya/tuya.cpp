@@ -391,27 +391,24 @@ void Tuya::handle_datapoints_(const uint8_t *buffer, size_t len) {
     if (skip)
       continue;
 
-    // Update internal datapoints
-    bool found = false;
-    for (auto &other : this->datapoints_) {
-      if (other.id == datapoint.id) {
-        other = datapoint;
-        found = true;
-      }
-    }
-    if (!found) {
-      this->datapoints_.push_back(datapoint);
+    // Update internal datapoints, the listeners get the stored copy
+    TuyaDatapoint *stored = this->get_datapoint_(datapoint.id);
+    if (stored != nullptr) {
+      *stored = std::move(datapoint);
+    } else {
+      this->datapoints_.push_back(std::move(datapoint));
+      stored = &this->datapoints_.back();
     }
 
     // Run through listeners
     for (auto &listener : this->listeners_) {
-      if (listener.datapoint_id == datapoint.id)
-        listener.on_datapoint(datapoint);
+      if (listener.datapoint_id == stored->id)
+        listener.on_datapoint(*stored);
     }
   }
 }
 
-void Tuya::send_raw_command_(TuyaCommand command) {
+void Tuya::send_raw_command_(const TuyaCommand &command) {
   uint8_t len_hi = (uint8_t) (command.payload.size() >> 8);
   uint8_t len_lo = (uint8_t) (command.payload.size() & 0xFF);
   uint8_t version = 0;
@@ -479,8 +476,8 @@ void Tuya::process_command_queue_() {
   }
 }
 
-void Tuya::send_command_(const TuyaCommand &command) {
-  command_queue_.push_back(command);
+void Tuya::send_command_(TuyaCommand command) {
+  command_queue_.push_back(std::move(command));
   process_command_queue_();
 }
 
@@ -558,7 +555,7 @@ void Tuya::send_local_time_() {
     ESP_LOGW(TAG, "Sending missing local time");
     payload = std::vector<uint8_t>{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
   }
-  this->send_command_(TuyaCommand{.cmd = TuyaCommandType::LOCAL_TIME_QUERY, .payload = payload});
+  this->send_command_(TuyaCommand{.cmd = TuyaCommandType::LOCAL_TIME_QUERY, .payload = std::move(payload)});
 }
 #endif
 
@@ -610,19 +607,19 @@ void Tuya::force_set_bitmask_datapoint_value(uint8_t datapoint_id, uint32_t valu
   this->set_numeric_datapoint_value_(datapoint_id, TuyaDatapointType::BITMASK, value, length, true);
 }
 
-optional<TuyaDatapoint> Tuya::get_datapoint_(uint8_t datapoint_id) {
+TuyaDatapoint *Tuya::get_datapoint_(uint8_t datapoint_id) {
   for (auto &datapoint : this->datapoints_) {
     if (datapoint.id == datapoint_id)
-      return datapoint;
+      return &datapoint;
   }
-  return {};
+  return nullptr;
 }
 
 void Tuya::set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, const uint32_t value,
                                         uint8_t length, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %" PRIu32, datapoint_id, value);
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != datapoint_type) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -632,27 +629,20 @@ void Tuya::set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType
     return;
   }
 
-  std::vector<uint8_t> data;
-  switch (length) {
-    case 4:
-      data.push_back(value >> 24);
-      data.push_back(value >> 16);
-    case 2:
-      data.push_back(value >> 8);
-    case 1:
-      data.push_back(value >> 0);
-      break;
-    default:
-      ESP_LOGE(TAG, "Unexpected datapoint length %u", length);
-      return;
+  if (length != 1 && length != 2 && length != 4) {
+    ESP_LOGE(TAG, "Unexpected datapoint length %u", length);
+    return;
   }
-  this->send_datapoint_command_(datapoint_id, datapoint_type, data);
+  // Big endian, the lowest bytes are at the end
+  const uint8_t data[4] = {(uint8_t) (value >> 24), (uint8_t) (value >> 16), (uint8_t) (value >> 8),
+                           (uint8_t) (value >> 0)};
+  this->send_datapoint_command_(datapoint_id, datapoint_type, data + 4 - length, length);
 }
 
 void Tuya::set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint8_t> &value, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %s", datapoint_id, format_hex_pretty(value).c_str());
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != TuyaDatapointType::RAW) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -661,13 +651,13 @@ void Tuya::set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
-  this->send_datapoint_command_(datapoint_id, TuyaDatapointType::RAW, value);
+  this->send_datapoint_command_(datapoint_id, TuyaDatapointType::RAW, value.data(), value.size());
 }
 
 void Tuya::set_string_datapoint_value_(uint8_t datapoint_id, const std::string &value, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %s", datapoint_id, value.c_str());
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != TuyaDatapointType::STRING) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -676,25 +666,25 @@ void Tuya::set_string_datapoint_value_(uint8_t datapoint_id, const std::string &
     ESP_LOGV(TAG, "Not sending unchanged value");
     return;
   }
-  std::vector<uint8_t> data;
-  for (char const &c : value) {
-    data.push_back(c);
-  }
-  this->send_datapoint_command_(datapoint_id, TuyaDatapointType::STRING, data);
+  this->send_datapoint_command_(datapoint_id, TuyaDatapointType::STRING,
+                                reinterpret_cast<const uint8_t *>(value.data()), value.size());
 }
 
-void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, std::vector<uint8_t> data) {
+void Tuya::send_datapoint_command_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, const uint8_t *data,
+                                   size_t len) {
+  // Encode the payload once, it's moved into the queue from here
   std::vector<uint8_t> buffer;
+  buffer.reserve(4 + len);
   buffer.push_back(datapoint_id);
   buffer.push_back(static_cast<uint8_t>(datapoint_type));
-  buffer.push_back(data.size() >> 8);
-  buffer.push_back(data.size() >> 0);
-  buffer.insert(buffer.end(), data.begin(), data.end());
+  buffer.push_back(len >> 8);
+  buffer.push_back(len >> 0);
+  buffer.insert(buffer.end(), data, data + len);
 
-  this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = buffer});
+  this->send_command_(TuyaCommand{.cmd = TuyaCommandType::DATAPOINT_DELIVER, .payload = std::move(buffer)});
 }
 
-void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(TuyaDatapoint)> &func) {
+void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(const TuyaDatapoint &)> &func) {
   auto listener = TuyaDatapointListener{
       .datapoint_id = datapoint_id,
       .on_datapoint = func,
@@ -412,6 +412,7 @@ async def register_uart_device(var, config):
     """
     parent = await cg.get_variable(config[CONF_UART_ID])
     cg.add(var.set_uart_parent(parent))
+    await cg.register_update_group(var, config, parent)
 
 
 @automation.register_action(
@@ -42,6 +42,10 @@ class UARTDevice {
 
   void flush() { return this->parent_->flush(); }
 
+  bool set_frame_callback(const UARTFrameConfig &config, UARTFrameCallback &&callback) {
+    return this->parent_->set_frame_callback(config, std::move(callback));
+  }
+
   // Compat APIs
   int read() {
     uint8_t data;
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <cstring>
+#include <functional>
 #include "esphome/core/defines.h"
 #include "esphome/core/component.h"
 #include "esphome/core/hal.h"
@@ -29,6 +30,21 @@ enum UARTDirection {
 
 const LogString *parity_to_str(UARTParityOptions parity);
 
+// How received data is split into frames, see UARTComponent::set_frame_callback().
+struct UARTFrameConfig {
+  // Byte that ends a frame, such as '\n' for line based protocols. It's included in the frame. -1 to end frames by
+  // idle time instead.
+  int16_t terminator{-1};
+  // Silence in character times that ends a frame when no terminator is set, e.g. 4 for the 3.5 characters of
+  // Modbus RTU.
+  uint8_t idle_chars{4};
+  // Longer frames are dropped.
+  uint16_t max_length{256};
+};
+
+// Called from the main loop with a complete frame. The data is only valid during the call.
+using UARTFrameCallback = std::function<void(const uint8_t *data, size_t len)>;
+
 class UARTComponent {
  public:
   // Writes an array of bytes to the UART bus.
@@ -74,6 +90,13 @@ class UARTComponent {
   // Pure virtual method to block until all bytes have been written to the UART bus.
   virtual void flush() = 0;
 
+  // Deliver received data as whole frames to the callback instead of through the read methods. The driver splits
+  // the frames in the background, so the device doesn't have to poll for bytes. Call from setup().
+  // @param config How the data is split into frames.
+  // @param callback Called with each frame.
+  // @return False if the platform doesn't support frames, the data can still be read byte by byte then.
+  virtual bool set_frame_callback(const UARTFrameConfig &config, UARTFrameCallback &&callback) { return false; }
+
   // Sets the TX (transmit) pin for the UART bus.
   // @param tx_pin Pointer to the internal GPIO pin used for transmission.
   void set_tx_pin(InternalGPIOPin *tx_pin) { this->tx_pin_ = tx_pin; }
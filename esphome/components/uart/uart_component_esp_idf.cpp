@@ -5,7 +5,9 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -140,6 +142,140 @@ void IDFUARTComponent::setup() {
   }
 
   xSemaphoreGive(this->lock_);
+
+  // Nothing to do in the main loop until frames are enabled and received
+  this->disable_loop();
+}
+
+void IDFUARTComponent::loop() {
+  uint16_t length;
+  while (this->frame_ring_buffer_->available() >= sizeof(length)) {
+    this->frame_ring_buffer_->read(&length, sizeof(length));
+    this->frame_ring_buffer_->read(this->loop_frame_.data(), length);
+#ifdef USE_UART_DEBUGGER
+    for (size_t i = 0; i < length; i++) {
+      this->debug_callback_.call(UART_DIRECTION_RX, this->loop_frame_[i]);
+    }
+#endif
+    this->frame_callback_(this->loop_frame_.data(), length);
+  }
+  uint32_t dropped = this->frames_dropped_.load();
+  if (dropped != this->frames_dropped_logged_) {
+    ESP_LOGW(TAG, "UART %u dropped %" PRIu32 " frames", this->uart_num_, dropped - this->frames_dropped_logged_);
+    this->frames_dropped_logged_ = dropped;
+  }
+  this->disable_loop();
+}
+
+bool IDFUARTComponent::set_frame_callback(const UARTFrameConfig &config, UARTFrameCallback &&callback) {
+  if (this->is_failed() || this->frame_task_handle_ != nullptr)
+    return false;
+
+  // Room for a few frames, so the main loop can fall behind for a moment
+  this->frame_ring_buffer_ = RingBuffer::create(4 * (config.max_length + sizeof(uint16_t)));
+  if (this->frame_ring_buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate the frame buffer");
+    return false;
+  }
+  this->rx_frame_.resize(config.max_length + sizeof(uint16_t));
+  this->loop_frame_.resize(config.max_length);
+
+  esp_err_t err;
+  if (config.terminator >= 0) {
+    err = uart_enable_pattern_det_baud_intr(this->uart_num_, static_cast<char>(config.terminator), 1, 9, 0, 0);
+    if (err == ESP_OK)
+      err = uart_pattern_queue_reset(this->uart_num_, 20);
+  } else {
+    err = uart_set_rx_timeout(this->uart_num_, config.idle_chars);
+  }
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "Enabling frame detection failed: %s", esp_err_to_name(err));
+    return false;
+  }
+
+  this->frame_config_ = config;
+  this->frame_callback_ = std::move(callback);
+  xTaskCreate(IDFUARTComponent::frame_task, "uart_rx", 3072, this, 2, &this->frame_task_handle_);
+  return this->frame_task_handle_ != nullptr;
+}
+
+void IDFUARTComponent::read_frame_data_(size_t length) {
+  uint8_t *frame = this->rx_frame_.data() + sizeof(uint16_t);
+  while (length > 0) {
+    if (this->rx_frame_length_ == this->frame_config_.max_length) {
+      this->rx_frame_overflow_ = true;
+      this->rx_frame_length_ = 0;
+    }
+    size_t chunk = std::min(length, this->frame_config_.max_length - this->rx_frame_length_);
+    int read = uart_read_bytes(this->uart_num_, frame + this->rx_frame_length_, chunk, 0);
+    if (read <= 0)
+      return;
+    this->rx_frame_length_ += read;
+    length -= read;
+  }
+}
+
+void IDFUARTComponent::queue_frame_() {
+  uint16_t length = this->rx_frame_length_;
+  size_t total = length + sizeof(length);
+  bool overflow = this->rx_frame_overflow_;
+  this->rx_frame_length_ = 0;
+  this->rx_frame_overflow_ = false;
+  if (length == 0 && !overflow)
+    return;
+  // Only this task writes, so the free space can only grow before the frame is written in one piece
+  if (overflow || this->frame_ring_buffer_->free() < total) {
+    this->frames_dropped_++;
+  } else {
+    memcpy(this->rx_frame_.data(), &length, sizeof(length));
+    this->frame_ring_buffer_->write_without_replacement(this->rx_frame_.data(), total);
+  }
+  this->enable_loop_soon_any_context();
+}
+
+void IDFUARTComponent::frame_task(void *params) {
+  auto *this_uart = static_cast<IDFUARTComponent *>(params);
+  bool use_terminator = this_uart->frame_config_.terminator >= 0;
+  uart_event_t event;
+  while (true) {
+    if (xQueueReceive(this_uart->uart_event_queue_, &event, portMAX_DELAY) != pdTRUE)
+      continue;
+    switch (event.type) {
+      case UART_DATA:
+        // With a terminator the data stays in the driver's buffer until the terminator arrived
+        if (!use_terminator) {
+          this_uart->read_frame_data_(event.size);
+          // the RX timeout elapsed, the line is idle
+          if (event.timeout_flag)
+            this_uart->queue_frame_();
+        }
+        break;
+      case UART_PATTERN_DET: {
+        int pos = uart_pattern_pop_pos(this_uart->uart_num_);
+        if (pos < 0) {
+          // the pattern queue overflowed, the frame boundaries are lost
+          uart_flush_input(this_uart->uart_num_);
+          this_uart->rx_frame_length_ = 0;
+          this_uart->frames_dropped_++;
+          this_uart->enable_loop_soon_any_context();
+          break;
+        }
+        this_uart->read_frame_data_(pos + 1);
+        this_uart->queue_frame_();
+        break;
+      }
+      case UART_FIFO_OVF:
+      case UART_BUFFER_FULL:
+        uart_flush_input(this_uart->uart_num_);
+        xQueueReset(this_uart->uart_event_queue_);
+        this_uart->rx_frame_length_ = 0;
+        this_uart->frames_dropped_++;
+        this_uart->enable_loop_soon_any_context();
+        break;
+      default:
+        break;
+    }
+  }
 }
 
 void IDFUARTComponent::load_settings(bool dump_config) {
@@ -166,6 +302,13 @@ void IDFUARTComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "  Data Bits: %u", this->data_bits_);
   ESP_LOGCONFIG(TAG, "  Parity: %s", LOG_STR_ARG(parity_to_str(this->parity_)));
   ESP_LOGCONFIG(TAG, "  Stop bits: %u", this->stop_bits_);
+  if (this->frame_task_handle_ != nullptr) {
+    if (this->frame_config_.terminator >= 0) {
+      ESP_LOGCONFIG(TAG, "  Frame terminator: 0x%02X", this->frame_config_.terminator);
+    } else {
+      ESP_LOGCONFIG(TAG, "  Frame idle time: %u characters", this->frame_config_.idle_chars);
+    }
+  }
   this->check_logger_conflict();
 }
 
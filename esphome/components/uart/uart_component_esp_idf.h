@@ -3,15 +3,22 @@
 #ifdef USE_ESP_IDF
 
 #include <driver/uart.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #include "esphome/core/component.h"
+#include "esphome/core/ring_buffer.h"
 #include "uart_component.h"
 
+#include <atomic>
+#include <memory>
+
 namespace esphome {
 namespace uart {
 
 class IDFUARTComponent : public UARTComponent, public Component {
  public:
   void setup() override;
+  void loop() override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::BUS; }
 
@@ -23,6 +30,8 @@ class IDFUARTComponent : public UARTComponent, public Component {
   int available() override;
   void flush() override;
 
+  bool set_frame_callback(const UARTFrameConfig &config, UARTFrameCallback &&callback) override;
+
   uint8_t get_hw_serial_number() { return this->uart_num_; }
   QueueHandle_t *get_uart_event_queue() { return &this->uart_event_queue_; }
 
@@ -50,6 +59,26 @@ class IDFUARTComponent : public UARTComponent, public Component {
 
   bool has_peek_{false};
   uint8_t peek_byte_;
+
+  static void frame_task(void *params);
+  // Reads up to length bytes into rx_frame_ behind the length prefix, or drops them once the frame is too long
+  void read_frame_data_(size_t length);
+  // Hands the frame in rx_frame_ to the main loop
+  void queue_frame_();
+
+  UARTFrameConfig frame_config_;
+  UARTFrameCallback frame_callback_;
+  TaskHandle_t frame_task_handle_{nullptr};
+  // Frames prefixed by their uint16_t length, written by the frame task and read by loop()
+  std::unique_ptr<RingBuffer> frame_ring_buffer_;
+  // Only used by the frame task
+  std::vector<uint8_t> rx_frame_;
+  size_t rx_frame_length_{0};
+  bool rx_frame_overflow_{false};
+  // Only used by loop()
+  std::vector<uint8_t> loop_frame_;
+  std::atomic<uint32_t> frames_dropped_{0};
+  uint32_t frames_dropped_logged_{0};
 };
 
 }  // namespace uart
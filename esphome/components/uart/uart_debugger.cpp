@@ -1,10 +1,14 @@
 #include "esphome/core/defines.h"
 #ifdef USE_UART_DEBUGGER
 
+#include <cstring>
 #include <vector>
 #include "uart_debugger.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#ifdef USE_LOGGER_RING_BUFFER
+#include "esphome/components/logger/logger.h"
+#endif
 
 namespace esphome {
 namespace uart {
@@ -90,111 +94,119 @@ void UARTDummyReceiver::loop() {
   }
 }
 
-// In the upcoming log functions, a delay was added after all log calls.
-// This is done to allow the system to ship the log lines via the API
-// TCP connection(s). Without these delays, debug log lines could go
-// missing when UART devices block the main loop for too long.
+static const char *const HEX_CHARS = "0123456789ABCDEF";
 
-void UARTDebug::log_hex(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator) {
-  std::string res;
-  if (direction == UART_DIRECTION_RX) {
-    res += "<<< ";
-  } else {
-    res += ">>> ";
-  }
-  size_t len = bytes.size();
-  char buf[5];
-  for (size_t i = 0; i < len; i++) {
-    if (i > 0) {
-      res += separator;
-    }
-    sprintf(buf, "%02X", bytes[i]);
-    res += buf;
-  }
+// A delay is added after the log calls, to allow the system to ship the log lines via the API TCP connection(s).
+// Without it, debug log lines could go missing when UART devices block the main loop for too long. It is not
+// needed when the logger queues the messages, it then ships them from its own loop().
+void UARTDebug::log_(const std::string &res) {
   ESP_LOGD(TAG, "%s", res.c_str());
+#ifdef USE_LOGGER_RING_BUFFER
+  if (logger::global_logger != nullptr && logger::global_logger->is_buffering())
+    return;
+#endif
   delay(10);
 }
 
-void UARTDebug::log_string(UARTDirection direction, std::vector<uint8_t> bytes) {
+void UARTDebug::log_hex(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator) {
+  const size_t len = bytes.size();
+  std::string res(len > 0 ? 4 + len * 3 - 1 : 4, separator);
+  memcpy(&res[0], direction == UART_DIRECTION_RX ? "<<< " : ">>> ", 4);
+  char *out = &res[4];
+  for (size_t i = 0; i < len; i++) {
+    out[i * 3] = HEX_CHARS[bytes[i] >> 4];
+    out[i * 3 + 1] = HEX_CHARS[bytes[i] & 0x0F];
+  }
+  log_(res);
+}
+
+void UARTDebug::log_string(UARTDirection direction, const std::vector<uint8_t> &bytes) {
   std::string res;
+  res.reserve(7 + bytes.size());
   if (direction == UART_DIRECTION_RX) {
     res += "<<< \"";
   } else {
     res += ">>> \"";
   }
-  size_t len = bytes.size();
-  char buf[5];
-  for (size_t i = 0; i < len; i++) {
-    if (bytes[i] == 7) {
+  for (uint8_t byte : bytes) {
+    if (byte == 7) {
       res += "\\a";
-    } else if (bytes[i] == 8) {
+    } else if (byte == 8) {
       res += "\\b";
-    } else if (bytes[i] == 9) {
+    } else if (byte == 9) {
       res += "\\t";
-    } else if (bytes[i] == 10) {
+    } else if (byte == 10) {
       res += "\\n";
-    } else if (bytes[i] == 11) {
+    } else if (byte == 11) {
       res += "\\v";
-    } else if (bytes[i] == 12) {
+    } else if (byte == 12) {
       res += "\\f";
-    } else if (bytes[i] == 13) {
+    } else if (byte == 13) {
       res += "\\r";
-    } else if (bytes[i] == 27) {
+    } else if (byte == 27) {
       res += "\\e";
-    } else if (bytes[i] == 34) {
+    } else if (byte == 34) {
       res += "\\\"";
-    } else if (bytes[i] == 39) {
+    } else if (byte == 39) {
       res += "\\'";
-    } else if (bytes[i] == 92) {
+    } else if (byte == 92) {
       res += "\\\\";
-    } else if (bytes[i] < 32 || bytes[i] > 127) {
-      sprintf(buf, "\\x%02X", bytes[i]);
-      res += buf;
+    } else if (byte < 32 || byte > 127) {
+      res += "\\x";
+      res += HEX_CHARS[byte >> 4];
+      res += HEX_CHARS[byte & 0x0F];
     } else {
-      res += bytes[i];
+      res += byte;
     }
   }
   res += '"';
-  ESP_LOGD(TAG, "%s", res.c_str());
-  delay(10);
+  log_(res);
 }
 
-void UARTDebug::log_int(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator) {
+void UARTDebug::log_int(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator) {
   std::string res;
-  size_t len = bytes.size();
+  res.reserve(4 + bytes.size() * 4);
   if (direction == UART_DIRECTION_RX) {
     res += "<<< ";
   } else {
     res += ">>> ";
   }
-  for (size_t i = 0; i < len; i++) {
+  for (size_t i = 0; i < bytes.size(); i++) {
     if (i > 0) {
       res += separator;
     }
-    res += to_string(bytes[i]);
+    const uint8_t byte = bytes[i];
+    if (byte >= 100)
+      res += char('0' + byte / 100);
+    if (byte >= 10)
+      res += char('0' + byte / 10 % 10);
+    res += char('0' + byte % 10);
   }
-  ESP_LOGD(TAG, "%s", res.c_str());
-  delay(10);
+  log_(res);
 }
 
-void UARTDebug::log_binary(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator) {
+void UARTDebug::log_binary(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator) {
   std::string res;
-  size_t len = bytes.size();
+  res.reserve(4 + bytes.size() * 18);
   if (direction == UART_DIRECTION_RX) {
     res += "<<< ";
   } else {
     res += ">>> ";
   }
-  char buf[20];
-  for (size_t i = 0; i < len; i++) {
+  for (size_t i = 0; i < bytes.size(); i++) {
     if (i > 0) {
       res += separator;
     }
-    sprintf(buf, "0b" BYTE_TO_BINARY_PATTERN " (0x%02X)", BYTE_TO_BINARY(bytes[i]), bytes[i]);
-    res += buf;
+    const uint8_t byte = bytes[i];
+    res += "0b";
+    for (int bit = 7; bit >= 0; bit--)
+      res += (byte >> bit) & 1 ? '1' : '0';
+    res += " (0x";
+    res += HEX_CHARS[byte >> 4];
+    res += HEX_CHARS[byte & 0x0F];
+    res += ')';
   }
-  ESP_LOGD(TAG, "%s", res.c_str());
-  delay(10);
+  log_(res);
 }
 
 }  // namespace uart
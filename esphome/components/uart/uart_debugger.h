@@ -30,7 +30,11 @@ class UARTDebugger : public Component, public Trigger<UARTDirection, std::vector
 
   /// Set the maximum number of bytes to accumulate. When the number of bytes
   /// is reached, logging will be triggered.
-  void set_after_bytes(size_t size) { this->after_bytes_ = size; }
+  void set_after_bytes(size_t size) {
+    this->after_bytes_ = size;
+    // Never grows while gathering bytes
+    this->bytes_.reserve(size);
+  }
 
   /// Set a timeout for the data stream. When no new bytes are seen during
   /// this timeout, logging will be triggered.
@@ -82,18 +86,21 @@ class UARTDebug {
  public:
   /// Log the bytes as hex values, separated by the provided separator
   /// character.
-  static void log_hex(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator);
+  static void log_hex(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator);
 
   /// Log the bytes as string values, escaping unprintable characters.
-  static void log_string(UARTDirection direction, std::vector<uint8_t> bytes);
+  static void log_string(UARTDirection direction, const std::vector<uint8_t> &bytes);
 
   /// Log the bytes as integer values, separated by the provided separator
   /// character.
-  static void log_int(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator);
+  static void log_int(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator);
 
   /// Log the bytes as '<binary> (<hex>)' values, separated by the provided
   /// separator.
-  static void log_binary(UARTDirection direction, std::vector<uint8_t> bytes, uint8_t separator);
+  static void log_binary(UARTDirection direction, const std::vector<uint8_t> &bytes, uint8_t separator);
+
+ protected:
+  static void log_(const std::string &res);
 };
 
 }  // namespace uart
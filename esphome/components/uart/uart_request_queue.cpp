@@ -0,0 +1,117 @@
+#include "uart_request_queue.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.request_queue";
+
+// Data that doesn't form frames is dropped beyond this
+static const size_t MAX_RX_BUFFER_SIZE = 512;
+
+void UARTRequestQueue::setup(const UARTFrameConfig &config, FrameSplitter &&splitter) {
+  this->splitter_ = std::move(splitter);
+  this->use_frames_ =
+      this->device_->set_frame_callback(config, [this](const uint8_t *data, size_t len) { this->receive_(data, len); });
+}
+
+void UARTRequestQueue::loop() {
+  if (!this->use_frames_) {
+    uint8_t buffer[64];
+    int available;
+    while ((available = this->device_->available()) > 0) {
+      const size_t len = std::min<size_t>(available, sizeof(buffer));
+      if (!this->device_->read_array(buffer, len))
+        break;
+      this->receive_(buffer, len);
+    }
+  }
+
+  if (this->waiting_ && millis() - this->last_activity_ > this->timeout_) {
+    if (this->response_frames_ == 0) {
+      ESP_LOGV(TAG, "Request timed out after %" PRIu32 " ms", this->timeout_);
+      // the device may have become slower, wait the longest for the next response
+      this->latency_peak_ = 0;
+      this->timeouts_++;
+    }
+    // otherwise the response ended without the handler recognizing its end
+    this->rx_buffer_.clear();
+    this->finish_();
+  }
+}
+
+void UARTRequestQueue::push(std::vector<uint8_t> &&request, FrameHandler &&handler) {
+  const bool idle = this->queue_.empty();
+  this->queue_.push_back(Request{std::move(request), std::move(handler)});
+  if (!idle)
+    return;
+  this->cycle_start_ = millis();
+  this->cycle_requests_ = 0;
+  this->send_next_();
+}
+
+void UARTRequestQueue::receive_(const uint8_t *data, size_t len) {
+  this->rx_buffer_.insert(this->rx_buffer_.end(), data, data + len);
+  size_t start = 0;
+  while (start < this->rx_buffer_.size()) {
+    const int length = this->splitter_(&this->rx_buffer_[start], this->rx_buffer_.size() - start);
+    if (length < 0) {
+      start++;
+      continue;
+    }
+    if (length == 0)
+      break;
+    this->on_frame_(&this->rx_buffer_[start], length);
+    start += length;
+  }
+  if (this->rx_buffer_.size() - start > MAX_RX_BUFFER_SIZE)
+    start = this->rx_buffer_.size();
+  this->rx_buffer_.erase(this->rx_buffer_.begin(), this->rx_buffer_.begin() + start);
+}
+
+void UARTRequestQueue::on_frame_(const uint8_t *data, size_t len) {
+  if (!this->waiting_) {
+    ESP_LOGV(TAG, "Dropped a frame of %u bytes received outside of a request", (unsigned) len);
+    return;
+  }
+  const uint32_t now = millis();
+  this->last_activity_ = now;
+  this->response_frames_++;
+  if (!this->queue_.front().handler(data, len))
+    return;
+  const uint32_t latency = now - this->sent_at_;
+  this->latency_peak_ = std::max(latency, this->latency_peak_ - this->latency_peak_ / 8);
+  this->finish_();
+}
+
+void UARTRequestQueue::send_next_() {
+  if (this->queue_.empty()) {
+    this->cycle_time_ = millis() - this->cycle_start_;
+    ESP_LOGV(TAG, "%u requests took %" PRIu32 " ms", this->cycle_requests_, this->cycle_time_);
+    return;
+  }
+  this->device_->write_array(this->queue_.front().data);
+  const uint32_t now = millis();
+  this->sent_at_ = now;
+  this->last_activity_ = now;
+  this->response_frames_ = 0;
+  this->waiting_ = true;
+  this->cycle_requests_++;
+  this->timeout_ = this->max_timeout_;
+  if (this->latency_peak_ != 0)
+    this->timeout_ = clamp<uint32_t>(2 * this->latency_peak_, this->min_timeout_, this->max_timeout_);
+}
+
+void UARTRequestQueue::finish_() {
+  this->waiting_ = false;
+  this->queue_.pop_front();
+  this->send_next_();
+}
+
+}  // namespace uart
+}  // namespace esphome
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <vector>
+#include "uart.h"
+
+namespace esphome {
+namespace uart {
+
+/** Polls a device by sending requests one after another and handing the frames of each response to its handler.
+ *
+ * The next request is sent as soon as the response to the previous one is complete, instead of after a fixed
+ * delay. A request without response ends after a timeout, which follows the response times of the device: twice
+ * the slowest recent response, within the configured bounds.
+ *
+ * Received data is delivered by the UART as frames where the platform supports it and read in loop() otherwise,
+ * the splitter of the device cuts it into the frames of its protocol.
+ */
+class UARTRequestQueue {
+ public:
+  /// The length of the frame at the start of `data`, 0 if more data is needed, -1 if no frame starts there.
+  using FrameSplitter = std::function<int(const uint8_t *data, size_t len)>;
+  /// Called with each frame received for the request, returns true once its response is complete.
+  using FrameHandler = std::function<bool(const uint8_t *data, size_t len)>;
+
+  explicit UARTRequestQueue(UARTDevice *device) : device_(device) {}
+
+  /// Call from setup() of the device.
+  /// @param config How the UART delivers the received data, its frames are split further by `splitter`.
+  void setup(const UARTFrameConfig &config, FrameSplitter &&splitter);
+  /// Call from loop() of the device.
+  void loop();
+
+  /// Bounds of the response timeout, the upper one is used until the device responded.
+  void set_timeout_bounds(uint32_t min_timeout, uint32_t max_timeout) {
+    this->min_timeout_ = min_timeout;
+    this->max_timeout_ = max_timeout;
+  }
+
+  /// Queue a request, it's sent once the previous ones are complete or timed out.
+  void push(std::vector<uint8_t> &&request, FrameHandler &&handler);
+
+  bool is_idle() const { return this->queue_.empty(); }
+  /// Time from the first request until the queue ran empty again, of the last such cycle.
+  uint32_t get_cycle_time() const { return this->cycle_time_; }
+  /// Requests that timed out without any response, in total.
+  uint32_t get_timeouts() const { return this->timeouts_; }
+
+ protected:
+  struct Request {
+    std::vector<uint8_t> data;
+    FrameHandler handler;
+  };
+
+  void receive_(const uint8_t *data, size_t len);
+  void on_frame_(const uint8_t *data, size_t len);
+  void send_next_();
+  void finish_();
+
+  UARTDevice *device_;
+  FrameSplitter splitter_;
+  bool use_frames_{false};
+  std::vector<uint8_t> rx_buffer_;
+
+  /// The front one is in progress
+  std::deque<Request> queue_;
+  bool waiting_{false};
+  uint32_t sent_at_{0};
+  uint32_t last_activity_{0};
+  uint16_t response_frames_{0};
+  uint32_t timeout_{0};
+  uint32_t min_timeout_{20};
+  uint32_t max_timeout_{1000};
+  /// Slowest recent response in ms, decays with every faster response. 0 until the first response.
+  uint32_t latency_peak_{0};
+
+  uint32_t cycle_start_{0};
+  uint16_t cycle_requests_{0};
+  uint32_t cycle_time_{0};
+  uint32_t timeouts_{0};
+};
+
+}  // namespace uart
+}  // namespace esphome
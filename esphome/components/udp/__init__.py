@@ -10,10 +10,12 @@ from esphome.const import (
     CONF_ID,
     CONF_INTERNAL,
     CONF_KEY,
+    CONF_MODE,
     CONF_NAME,
     CONF_PORT,
     CONF_SENSORS,
 )
+from esphome.core import CORE
 from esphome.cpp_generator import MockObjClass
 
 CODEOWNERS = ["@clydebarrow"]
@@ -34,6 +36,10 @@ CONF_UDP_ID = "udp_id"
 CONF_PING_PONG_ENABLE = "ping_pong_enable"
 CONF_PING_PONG_RECYCLE_TIME = "ping_pong_recycle_time"
 CONF_ROLLING_CODE_ENABLE = "rolling_code_enable"
+CONF_PACKET_VERSION = "packet_version"
+
+MODE_XXTEA = "xxtea"
+MODE_AES_GCM = "aes_gcm"
 
 
 def sensor_validation(cls: MockObjClass):
@@ -59,6 +65,21 @@ ENCRYPTION_SCHEMA = {
     )
 }
 
+# Receivers tell the mode from the packets, only senders choose it
+SENDER_ENCRYPTION_SCHEMA = {
+    cv.Optional(CONF_ENCRYPTION): cv.maybe_simple_value(
+        cv.Schema(
+            {
+                cv.Required(CONF_KEY): cv.string,
+                cv.Optional(CONF_MODE, default=MODE_XXTEA): cv.one_of(
+                    MODE_XXTEA, MODE_AES_GCM, lower=True
+                ),
+            }
+        ),
+        key=CONF_KEY,
+    )
+}
+
 PROVIDER_SCHEMA = cv.Schema(
     {
         cv.Required(CONF_NAME): cv.valid_name,
@@ -70,11 +91,22 @@ def validate_(config):
     if CONF_ENCRYPTION in config:
         if CONF_SENSORS not in config and CONF_BINARY_SENSORS not in config:
             raise cv.Invalid("No sensors or binary sensors to encrypt")
+        if config[CONF_ENCRYPTION][CONF_MODE] == MODE_AES_GCM and not CORE.is_esp32:
+            raise cv.Invalid(
+                "AES-GCM encryption is only available on ESP32",
+                path=[CONF_ENCRYPTION, CONF_MODE],
+            )
     elif config[CONF_ROLLING_CODE_ENABLE]:
         raise cv.Invalid("Rolling code requires an encryption key")
     if config[CONF_PING_PONG_ENABLE]:
         if not any(CONF_ENCRYPTION in p for p in config.get(CONF_PROVIDERS) or ()):
             raise cv.Invalid("Ping-pong requires at least one encrypted provider")
+    if config[CONF_PACKET_VERSION] == 2:
+        for key in (CONF_SENSORS, CONF_BINARY_SENSORS):
+            if len(config.get(key, ())) > 256:
+                raise cv.Invalid(
+                    f"Packet version 2 supports at most 256 {key}", path=[key]
+                )
     return config
 
 
@@ -89,6 +121,7 @@ CONFIG_SCHEMA = cv.All(
             ),
             cv.Optional(CONF_ROLLING_CODE_ENABLE, default=False): cv.boolean,
             cv.Optional(CONF_PING_PONG_ENABLE, default=False): cv.boolean,
+            cv.Optional(CONF_PACKET_VERSION, default=1): cv.int_range(min=1, max=2),
             cv.Optional(
                 CONF_PING_PONG_RECYCLE_TIME, default="600s"
             ): cv.positive_time_period_seconds,
@@ -99,7 +132,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_PROVIDERS): cv.ensure_list(PROVIDER_SCHEMA),
         },
     )
-    .extend(ENCRYPTION_SCHEMA),
+    .extend(SENDER_ENCRYPTION_SCHEMA),
     validate_,
 )
 
@@ -130,6 +163,7 @@ async def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_rolling_code_enable(config[CONF_ROLLING_CODE_ENABLE]))
     cg.add(var.set_ping_pong_enable(config[CONF_PING_PONG_ENABLE]))
+    cg.add(var.set_packet_version(config[CONF_PACKET_VERSION]))
     cg.add(
         var.set_ping_pong_recycle_time(
             config[CONF_PING_PONG_RECYCLE_TIME].total_seconds
@@ -150,6 +184,7 @@ async def to_code(config):
 
     if encryption := config.get(CONF_ENCRYPTION):
         cg.add(var.set_encryption_key(hash_encryption_key(encryption)))
+        cg.add(var.set_aes_gcm_enable(encryption[CONF_MODE] == MODE_AES_GCM))
 
     for provider in config.get(CONF_PROVIDERS, ()):
         name = provider[CONF_NAME]
@@ -3,6 +3,10 @@
 #include "esphome/components/network/util.h"
 #include "udp_component.h"
 
+#ifdef USE_ESP32
+#include "mbedtls/gcm.h"
+#endif
+
 namespace esphome {
 namespace udp {
 
@@ -37,6 +41,19 @@ namespace udp {
  *
  * Padded to a 4 byte boundary with nulls
  *
+ * Version 2 packets start with MAGIC_NUMBER_V2 and refer to sensors by their index on the sender. Each sensor comes
+ * with its name when all values are sent (on every update interval), that announces the index for the receiver:
+ *      SENSOR_DEF_KEY: 1 byte, index: 1 byte, float value: 4 bytes, name length: 1 byte, name
+ *      BINARY_SENSOR_DEF_KEY: 1 byte, index: 1 byte, bool value: 1 byte, name length: 1 byte, name
+ * Changes in between only carry the index:
+ *      SENSOR_INDEX_KEY: 1 byte, index: 1 byte, float value: 4 bytes
+ *      BINARY_SENSOR_INDEX_KEY: 1 byte, index: 1 byte, bool value: 1 byte
+ *
+ * With AES-GCM encryption the packet starts with MAGIC_NUMBER_GCM instead, whatever the version. The header is
+ * followed by a 12 byte nonce, then by the encrypted data without padding, then by a 16 byte authentication tag. The
+ * tag covers the header too. The nonce is the 64 bit packet counter (shared with the rolling code) and a random value
+ * picked at boot, so it never repeats for a key.
+ *
  * Structure of a ping request packet:
  * --- In clear text ---
  * MAGIC_PING: 16 bits
@@ -103,7 +120,11 @@ union FuData {
 
 static const size_t MAX_PACKET_SIZE = 508;
 static const uint16_t MAGIC_NUMBER = 0x4553;
+static const uint16_t MAGIC_NUMBER_V2 = 0x4532;
 static const uint16_t MAGIC_PING = 0x5048;
+static const uint16_t MAGIC_NUMBER_GCM = 0x4547;
+static const size_t GCM_NONCE_SIZE = 12;
+static const size_t GCM_TAG_SIZE = 16;
 static const uint32_t PREF_HASH = 0x45535043;
 enum DataKey {
   ZERO_FILL_KEY,
@@ -112,10 +133,37 @@ enum DataKey {
   BINARY_SENSOR_KEY,
   PING_KEY,
   ROLLING_CODE_KEY,
+  SENSOR_DEF_KEY,
+  BINARY_SENSOR_DEF_KEY,
+  SENSOR_INDEX_KEY,
+  BINARY_SENSOR_INDEX_KEY,
 };
 
 static const size_t MAX_PING_KEYS = 4;
 
+#ifdef USE_ESP32
+/**
+ * AES-256-GCM through mbedTLS, which uses the hardware AES engine on ESP32 targets. Setting the key is cheap with the
+ * hardware engine, so there is no context kept between packets.
+ */
+static bool aes_gcm_crypt(bool encrypt, const std::vector<uint8_t> &key, const uint8_t *nonce, const uint8_t *aad,
+                          size_t aad_len, uint8_t *data, size_t len, uint8_t *tag) {
+  mbedtls_gcm_context ctx;
+  mbedtls_gcm_init(&ctx);
+  int ret = mbedtls_gcm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key.data(), key.size() * 8);
+  if (ret == 0) {
+    if (encrypt) {
+      ret = mbedtls_gcm_crypt_and_tag(&ctx, MBEDTLS_GCM_ENCRYPT, len, nonce, GCM_NONCE_SIZE, aad, aad_len, data, data,
+                                      GCM_TAG_SIZE, tag);
+    } else {
+      ret = mbedtls_gcm_auth_decrypt(&ctx, len, nonce, GCM_NONCE_SIZE, aad, aad_len, tag, GCM_TAG_SIZE, data, data);
+    }
+  }
+  mbedtls_gcm_free(&ctx);
+  return ret == 0;
+}
+#endif
+
 static inline void add(std::vector<uint8_t> &vec, uint32_t data) {
   vec.push_back(data & 0xFF);
   vec.push_back((data >> 8) & 0xFF);
@@ -159,6 +207,8 @@ void UDPComponent::setup() {
     return;
   }
   this->resend_ping_key_ = this->ping_pong_enable_;
+  // receivers only learn the sensor indices from a packet with all values
+  this->resend_data_ = true;
   // restore the upper 32 bits of the rolling code, increment and save.
   this->pref_ = global_preferences->make_preference<uint32_t>(PREF_HASH, true);
   this->pref_.load(&this->rolling_code_[1]);
@@ -191,11 +241,20 @@ void UDPComponent::setup() {
 #endif
   this->should_listen_ = !this->providers_.empty() || this->is_encrypted_();
   // initialise the header. This is invariant.
-  add(this->header_, MAGIC_NUMBER);
+  if (this->aes_gcm_enable_) {
+    add(this->header_, MAGIC_NUMBER_GCM);
+  } else {
+    add(this->header_, this->packet_version_ == 2 ? MAGIC_NUMBER_V2 : MAGIC_NUMBER);
+  }
   add(this->header_, this->name_);
   // pad to a multiple of 4 bytes
   while (this->header_.size() & 0x3)
     this->header_.push_back(0);
+  this->max_data_size_ = MAX_PACKET_SIZE - this->header_.size();
+  if (this->aes_gcm_enable_) {
+    this->max_data_size_ -= GCM_NONCE_SIZE + GCM_TAG_SIZE;
+    this->nonce_salt_ = random_uint32();
+  }
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
   for (const auto &address : this->addresses_) {
     struct sockaddr saddr {};
@@ -298,17 +357,39 @@ void UDPComponent::flush_() {
   auto header_len = round4(this->header_.size()) / 4;
   auto len = round4(data_.size()) / 4;
   memcpy(buffer, this->header_.data(), this->header_.size());
+#ifdef USE_ESP32
+  if (this->aes_gcm_enable_) {
+    auto *packet = reinterpret_cast<uint8_t *>(buffer);
+    auto *nonce = packet + this->header_.size();
+    const uint32_t nonce_words[] = {this->rolling_code_[0], this->rolling_code_[1], this->nonce_salt_};
+    for (size_t i = 0; i != GCM_NONCE_SIZE; i++)
+      nonce[i] = nonce_words[i / 4] >> (i % 4 * 8);
+    this->increment_code_();
+    auto *data = nonce + GCM_NONCE_SIZE;
+    memcpy(data, this->data_.data(), this->data_.size());
+    if (aes_gcm_crypt(true, this->encryption_key_, nonce, packet, this->header_.size(), data, this->data_.size(),
+                      data + this->data_.size())) {
+      this->send_packet_(buffer, data + this->data_.size() + GCM_TAG_SIZE - packet);
+    } else {
+      ESP_LOGW(TAG, "Encryption failed");
+    }
+    this->init_data_();
+    return;
+  }
+#endif
   memcpy(buffer + header_len, this->data_.data(), this->data_.size());
   if (this->is_encrypted_()) {
     xxtea_encrypt(buffer + header_len, len, (uint32_t *) this->encryption_key_.data());
   }
   auto total_len = (header_len + len) * 4;
   this->send_packet_(buffer, total_len);
+  // start the next packet, with a new rolling code
+  this->init_data_();
 }
 
 void UDPComponent::add_binary_data_(uint8_t key, const char *id, bool data) {
   auto len = 1 + 1 + 1 + strlen(id);
-  if (len + this->header_.size() + this->data_.size() > MAX_PACKET_SIZE) {
+  if (len + this->data_.size() > this->max_data_size_) {
     this->flush_();
   }
   add(this->data_, key);
@@ -322,30 +403,70 @@ void UDPComponent::add_data_(uint8_t key, const char *id, float data) {
 
 void UDPComponent::add_data_(uint8_t key, const char *id, uint32_t data) {
   auto len = 4 + 1 + 1 + strlen(id);
-  if (len + this->header_.size() + this->data_.size() > MAX_PACKET_SIZE) {
+  if (len + this->data_.size() > this->max_data_size_) {
     this->flush_();
   }
   add(this->data_, key);
   add(this->data_, data);
   add(this->data_, id);
 }
+void UDPComponent::add_indexed_data_(uint8_t key, uint8_t index, const char *id, uint32_t data) {
+  auto len = 1 + 1 + 4 + (id == nullptr ? 0 : 1 + strlen(id));
+  if (len + this->data_.size() > this->max_data_size_) {
+    this->flush_();
+  }
+  add(this->data_, key);
+  add(this->data_, index);
+  add(this->data_, data);
+  if (id != nullptr)
+    add(this->data_, id);
+}
+
+void UDPComponent::add_indexed_binary_data_(uint8_t key, uint8_t index, const char *id, bool data) {
+  auto len = 1 + 1 + 1 + (id == nullptr ? 0 : 1 + strlen(id));
+  if (len + this->data_.size() > this->max_data_size_) {
+    this->flush_();
+  }
+  add(this->data_, key);
+  add(this->data_, index);
+  add(this->data_, (uint8_t) data);
+  if (id != nullptr)
+    add(this->data_, id);
+}
+
 void UDPComponent::send_data_(bool all) {
   if (!this->should_send_ || !network::is_connected())
     return;
   this->init_data_();
+  bool indexed = this->packet_version_ == 2;
 #ifdef USE_SENSOR
-  for (auto &sensor : this->sensors_) {
+  for (size_t i = 0; i != this->sensors_.size(); i++) {
+    auto &sensor = this->sensors_[i];
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_data_(SENSOR_KEY, sensor.id, sensor.sensor->get_state());
+      FuData udata{.f32 = sensor.sensor->get_state()};
+      if (!indexed) {
+        this->add_data_(SENSOR_KEY, sensor.id, udata.u32);
+      } else if (all) {
+        this->add_indexed_data_(SENSOR_DEF_KEY, i, sensor.id, udata.u32);
+      } else {
+        this->add_indexed_data_(SENSOR_INDEX_KEY, i, nullptr, udata.u32);
+      }
     }
   }
 #endif
 #ifdef USE_BINARY_SENSOR
-  for (auto &sensor : this->binary_sensors_) {
+  for (size_t i = 0; i != this->binary_sensors_.size(); i++) {
+    auto &sensor = this->binary_sensors_[i];
     if (all || sensor.updated) {
       sensor.updated = false;
-      this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      if (!indexed) {
+        this->add_binary_data_(BINARY_SENSOR_KEY, sensor.id, sensor.sensor->state);
+      } else if (all) {
+        this->add_indexed_binary_data_(BINARY_SENSOR_DEF_KEY, i, sensor.id, sensor.sensor->state);
+      } else {
+        this->add_indexed_binary_data_(BINARY_SENSOR_INDEX_KEY, i, nullptr, sensor.sensor->state);
+      }
     }
   }
 #endif
@@ -369,6 +490,8 @@ void UDPComponent::loop() {
   if (this->should_listen_) {
     for (;;) {
 #if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+      if (!this->listen_socket_->ready())
+        break;
       auto len = this->listen_socket_->read(buf, sizeof(buf));
 #else
       auto len = this->udp_client_.parsePacket();
@@ -440,7 +563,7 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
   const uint8_t *end = buf + len;
   FuData rdata{};
   auto magic = get_uint16(buf);
-  if (magic != MAGIC_NUMBER && magic != MAGIC_PING)
+  if (magic != MAGIC_NUMBER && magic != MAGIC_NUMBER_V2 && magic != MAGIC_NUMBER_GCM && magic != MAGIC_PING)
     return ESP_LOGV(TAG, "Bad magic %X", magic);
 
   auto hlen = *buf++;
@@ -454,7 +577,8 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
   buf += hlen;
   if (magic == MAGIC_PING)
     return this->process_ping_request_(namebuf, buf, end - buf);
-  if (round4(len) != len) {
+  // GCM packets aren't padded
+  if (magic != MAGIC_NUMBER_GCM && round4(len) != len) {
     return ESP_LOGW(TAG, "Bad length %zu", len);
   }
   hlen = round4(hlen + 3);
@@ -479,7 +603,22 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
   auto &binary_sensors = this->remote_binary_sensors_[namebuf];
 #endif
 
-  if (!provider.encryption_key.empty()) {
+  if (magic == MAGIC_NUMBER_GCM) {
+#ifdef USE_ESP32
+    if (provider.encryption_key.empty())
+      return ESP_LOGW(TAG, "No key to decrypt data from %s", namebuf);
+    if (end - buf <= (ptrdiff_t) (GCM_NONCE_SIZE + GCM_TAG_SIZE))
+      return ESP_LOGV(TAG, "Bad length %zu", len);
+    uint8_t *nonce = buf;
+    buf += GCM_NONCE_SIZE;
+    end -= GCM_TAG_SIZE;
+    if (!aes_gcm_crypt(false, provider.encryption_key, nonce, start_ptr, hlen, buf, end - buf,
+                       const_cast<uint8_t *>(end)))
+      return ESP_LOGW(TAG, "Authentication of data from %s failed", namebuf);
+#else
+    return ESP_LOGW(TAG, "AES-GCM is not supported on this platform");
+#endif
+  } else if (!provider.encryption_key.empty()) {
     xxtea_decrypt((uint32_t *) buf, (end - buf) / 4, (uint32_t *) provider.encryption_key.data());
   }
   byte = *buf++;
@@ -511,6 +650,32 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
       this->resend_ping_key_ = true;
       break;
     }
+    if (byte == SENSOR_INDEX_KEY || byte == BINARY_SENSOR_INDEX_KEY) {
+      if (end - buf < (byte == SENSOR_INDEX_KEY ? 5 : 2)) {
+        return ESP_LOGV(TAG, "Indexed sensor key %d is truncated", byte);
+      }
+      uint8_t index = *buf++;
+      rdata.u32 = byte == SENSOR_INDEX_KEY ? get_uint32(buf) : *buf++;
+#ifdef USE_SENSOR
+      if (byte == SENSOR_INDEX_KEY && index < provider.sensors.size() && provider.sensors[index] != nullptr)
+        provider.sensors[index]->publish_state(rdata.f32);
+#endif
+#ifdef USE_BINARY_SENSOR
+      if (byte == BINARY_SENSOR_INDEX_KEY && index < provider.binary_sensors.size() &&
+          provider.binary_sensors[index] != nullptr)
+        provider.binary_sensors[index]->publish_state(rdata.u32 != 0);
+#endif
+      continue;
+    }
+    int index = -1;
+    if (byte == SENSOR_DEF_KEY || byte == BINARY_SENSOR_DEF_KEY) {
+      if (end - buf < 1) {
+        return ESP_LOGV(TAG, "Sensor definition key requires an index");
+      }
+      index = *buf++;
+      // the rest is the same as the unindexed entries
+      byte = byte == SENSOR_DEF_KEY ? SENSOR_KEY : BINARY_SENSOR_KEY;
+    }
     if (byte == BINARY_SENSOR_KEY) {
       if (end - buf < 3) {
         return ESP_LOGV(TAG, "Binary sensor key requires at least 3 more bytes");
@@ -534,12 +699,31 @@ void UDPComponent::process_(uint8_t *buf, const size_t len) {
     ESP_LOGV(TAG, "Found sensor key %d, id %s, data %lX", byte, namebuf, (unsigned long) rdata.u32);
     buf += hlen;
 #ifdef USE_SENSOR
-    if (byte == SENSOR_KEY && sensors.count(namebuf) != 0)
-      sensors[namebuf]->publish_state(rdata.f32);
+    if (byte == SENSOR_KEY) {
+      auto it = sensors.find(namebuf);
+      sensor::Sensor *sensor = it == sensors.end() ? nullptr : it->second;
+      if (index >= 0) {
+        // remember the index, the following changes only refer to it
+        if (provider.sensors.size() <= (size_t) index)
+          provider.sensors.resize(index + 1);
+        provider.sensors[index] = sensor;
+      }
+      if (sensor != nullptr)
+        sensor->publish_state(rdata.f32);
+    }
 #endif
 #ifdef USE_BINARY_SENSOR
-    if (byte == BINARY_SENSOR_KEY && binary_sensors.count(namebuf) != 0)
-      binary_sensors[namebuf]->publish_state(rdata.u32 != 0);
+    if (byte == BINARY_SENSOR_KEY) {
+      auto it = binary_sensors.find(namebuf);
+      binary_sensor::BinarySensor *sensor = it == binary_sensors.end() ? nullptr : it->second;
+      if (index >= 0) {
+        if (provider.binary_sensors.size() <= (size_t) index)
+          provider.binary_sensors.resize(index + 1);
+        provider.binary_sensors[index] = sensor;
+      }
+      if (sensor != nullptr)
+        sensor->publish_state(rdata.u32 != 0);
+    }
 #endif
   }
 }
@@ -548,6 +732,8 @@ void UDPComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "UDP:");
   ESP_LOGCONFIG(TAG, "  Port: %u", this->port_);
   ESP_LOGCONFIG(TAG, "  Encrypted: %s", YESNO(this->is_encrypted_()));
+  if (this->is_encrypted_())
+    ESP_LOGCONFIG(TAG, "  Encryption: %s", this->aes_gcm_enable_ ? "AES-GCM" : "XXTEA");
   ESP_LOGCONFIG(TAG, "  Ping-pong: %s", YESNO(this->ping_pong_enable_));
   for (const auto &address : this->addresses_)
     ESP_LOGCONFIG(TAG, "  Address: %s", address.c_str());
@@ -573,7 +759,7 @@ void UDPComponent::dump_config() {
   }
 }
 void UDPComponent::increment_code_() {
-  if (this->rolling_code_enable_) {
+  if (this->rolling_code_enable_ || this->aes_gcm_enable_) {
     if (++this->rolling_code_[0] == 0) {
       this->rolling_code_[1]++;
       this->pref_.save(&this->rolling_code_[1]);
@@ -22,6 +22,13 @@ struct Provider {
   std::vector<uint8_t> encryption_key;
   const char *name;
   uint32_t last_code[2];
+#ifdef USE_SENSOR
+  /// Our sensors by the index the provider announced in version 2 packets, nullptr if not subscribed
+  std::vector<sensor::Sensor *> sensors;
+#endif
+#ifdef USE_BINARY_SENSOR
+  std::vector<binary_sensor::BinarySensor *> binary_sensors;
+#endif
 };
 
 #ifdef USE_SENSOR
@@ -90,7 +97,11 @@ class UDPComponent : public PollingComponent {
 
   void set_encryption_key(std::vector<uint8_t> key) { this->encryption_key_ = std::move(key); }
   void set_rolling_code_enable(bool enable) { this->rolling_code_enable_ = enable; }
+  /// Encrypt and authenticate our packets with AES-GCM instead of XXTEA, ESP32 only.
+  void set_aes_gcm_enable(bool enable) { this->aes_gcm_enable_ = enable; }
   void set_ping_pong_enable(bool enable) { this->ping_pong_enable_ = enable; }
+  /// Version 2 packets refer to sensors by index instead of repeating their names.
+  void set_packet_version(uint8_t version) { this->packet_version_ = version; }
   void set_ping_pong_recycle_time(uint32_t recycle_time) { this->ping_pong_recyle_time_ = recycle_time; }
   void set_provider_encryption(const char *name, std::vector<uint8_t> key) {
     this->providers_[name].encryption_key = std::move(key);
@@ -104,6 +115,9 @@ class UDPComponent : public PollingComponent {
   void add_data_(uint8_t key, const char *id, uint32_t data);
   void increment_code_();
   void add_binary_data_(uint8_t key, const char *id, bool data);
+  /// Add a version 2 entry, id is only sent with SENSOR_DEF_KEY and BINARY_SENSOR_DEF_KEY.
+  void add_indexed_data_(uint8_t key, uint8_t index, const char *id, uint32_t data);
+  void add_indexed_binary_data_(uint8_t key, uint8_t index, const char *id, bool data);
   void init_data_();
 
   bool updated_{};
@@ -111,7 +125,13 @@ class UDPComponent : public PollingComponent {
   uint32_t ping_key_{};
   uint32_t rolling_code_[2]{};
   bool rolling_code_enable_{};
+  bool aes_gcm_enable_{};
+  /// Random part of the GCM nonces, so they don't repeat even if the rolling code preference is lost
+  uint32_t nonce_salt_{};
+  /// Room left for data after the header and the encryption overhead
+  size_t max_data_size_{};
   bool ping_pong_enable_{};
+  uint8_t packet_version_{1};
   uint32_t ping_pong_recyle_time_{};
   uint32_t last_key_time_{};
   bool resend_ping_key_{};
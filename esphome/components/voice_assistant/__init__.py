@@ -33,6 +33,7 @@ CONF_ON_TTS_STREAM_START = "on_tts_stream_start"
 CONF_ON_TTS_STREAM_END = "on_tts_stream_end"
 CONF_ON_WAKE_WORD_DETECTED = "on_wake_word_detected"
 
+CONF_ADPCM = "adpcm"
 CONF_SILENCE_DETECTION = "silence_detection"
 CONF_USE_WAKE_WORD = "use_wake_word"
 CONF_VAD_THRESHOLD = "vad_threshold"
@@ -94,6 +95,7 @@ CONFIG_SCHEMA = cv.All(
                 media_player.MediaPlayer
             ),
             cv.Optional(CONF_USE_WAKE_WORD, default=False): cv.boolean,
+            cv.Optional(CONF_ADPCM, default=False): cv.boolean,
             cv.Optional(CONF_VAD_THRESHOLD): cv.All(
                 cv.requires_component("esp_adf"), cv.only_with_esp_idf, cv.uint8_t
             ),
@@ -180,6 +182,7 @@ async def to_code(config):
         cg.add(var.set_media_player(mp))
 
     cg.add(var.set_use_wake_word(config[CONF_USE_WAKE_WORD]))
+    cg.add(var.set_adpcm(config[CONF_ADPCM]))
 
     if (vad_threshold := config.get(CONF_VAD_THRESHOLD)) is not None:
         cg.add(var.set_vad_threshold(vad_threshold))
@@ -0,0 +1,68 @@
+#include "ima_adpcm.h"
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace voice_assistant {
+
+static const int8_t INDEX_TABLE[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static const int16_t STEP_TABLE[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,    19,    21,    23,    25,    28,
+    31,    34,    37,    41,    45,    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,   337,   371,   408,   449,   494,
+    544,   598,   658,   724,   796,   876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,  5894,  6484,  7132,  7845,  8630,
+    9493,  10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+size_t ImaAdpcmEncoder::encode(const int16_t *samples, size_t count, uint8_t *out) {
+  out[0] = uint8_t(this->predictor_);
+  out[1] = uint8_t(this->predictor_ >> 8);
+  out[2] = uint8_t(this->index_);
+  out[3] = 0;
+  uint8_t *data = out + HEADER_SIZE;
+  for (size_t i = 0; i < count; i += 2) {
+    uint8_t byte = this->encode_sample_(samples[i]);
+    if (i + 1 < count)
+      byte |= this->encode_sample_(samples[i + 1]) << 4;
+    *data++ = byte;
+  }
+  return data - out;
+}
+
+uint8_t ImaAdpcmEncoder::encode_sample_(int16_t sample) {
+  int32_t step = STEP_TABLE[this->index_];
+  int32_t diff = int32_t(sample) - this->predictor_;
+  uint8_t code = 0;
+  if (diff < 0) {
+    code = 8;
+    diff = -diff;
+  }
+
+  // Quantize the difference with three bits, tracking exactly what the decoder will reconstruct
+  int32_t delta = step >> 3;
+  if (diff >= step) {
+    code |= 4;
+    diff -= step;
+    delta += step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 2;
+    diff -= step;
+    delta += step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    code |= 1;
+    delta += step;
+  }
+
+  this->predictor_ = clamp<int32_t>(this->predictor_ + ((code & 8) ? -delta : delta), INT16_MIN, INT16_MAX);
+  this->index_ = clamp<int32_t>(this->index_ + INDEX_TABLE[code & 7], 0, 88);
+  return code;
+}
+
+}  // namespace voice_assistant
+}  // namespace esphome
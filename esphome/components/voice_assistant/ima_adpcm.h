@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace voice_assistant {
+
+/** Compresses 16 bit PCM to 4 bits per sample with IMA ADPCM.
+ *
+ * Every block starts with a 4 byte header holding the predictor (int16, little endian), the step index and a zero
+ * byte, as in WAV files. A block therefore decodes on its own, a lost UDP packet doesn't garble the ones after it.
+ * Two samples follow in each byte, the first one in the low nibble.
+ */
+class ImaAdpcmEncoder {
+ public:
+  static const size_t HEADER_SIZE = 4;
+
+  static constexpr size_t encoded_size(size_t samples) { return HEADER_SIZE + (samples + 1) / 2; }
+
+  /// Start a new stream.
+  void reset() {
+    this->predictor_ = 0;
+    this->index_ = 0;
+  }
+
+  /// Encode `count` samples into `out`, which needs encoded_size(count) bytes.
+  /// @return Bytes written.
+  size_t encode(const int16_t *samples, size_t count, uint8_t *out);
+
+ protected:
+  uint8_t encode_sample_(int16_t sample);
+
+  int32_t predictor_{0};
+  int32_t index_{0};
+};
+
+}  // namespace voice_assistant
+}  // namespace esphome
@@ -4,6 +4,7 @@
 
 #include "esphome/core/log.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstdio>
 
@@ -20,6 +21,7 @@ static const size_t SAMPLE_RATE_HZ = 16000;
 static const size_t INPUT_BUFFER_SIZE = 32 * SAMPLE_RATE_HZ / 1000;  // 32ms * 16kHz / 1000ms
 static const size_t BUFFER_SIZE = 512 * SAMPLE_RATE_HZ / 1000;
 static const size_t SEND_BUFFER_SIZE = INPUT_BUFFER_SIZE * sizeof(int16_t);
+static const size_t ENCODE_BUFFER_SIZE = ImaAdpcmEncoder::encoded_size(INPUT_BUFFER_SIZE);
 static const size_t RECEIVE_SIZE = 1024;
 static const size_t SPEAKER_BUFFER_SIZE = 16 * RECEIVE_SIZE;
 
@@ -107,6 +109,16 @@ bool VoiceAssistant::allocate_buffers_() {
     return false;
   }
 
+  if (this->capture_task_handle_ == nullptr) {
+    // above the main loop, on the core it usually runs on
+    xTaskCreatePinnedToCore(VoiceAssistant::capture_task, "va_capture", 3072, this, 10, &this->capture_task_handle_,
+                            portNUM_PROCESSORS - 1);
+    if (this->capture_task_handle_ == nullptr) {
+      ESP_LOGW(TAG, "Could not create capture task");
+      return false;
+    }
+  }
+
   ExternalRAMAllocator<uint8_t> send_allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->send_buffer_ = send_allocator.allocate(SEND_BUFFER_SIZE);
   if (send_buffer_ == nullptr) {
@@ -114,6 +126,14 @@ bool VoiceAssistant::allocate_buffers_() {
     return false;
   }
 
+  if (this->adpcm_ && this->encode_buffer_ == nullptr) {
+    this->encode_buffer_ = send_allocator.allocate(ENCODE_BUFFER_SIZE);
+    if (this->encode_buffer_ == nullptr) {
+      ESP_LOGW(TAG, "Could not allocate encode buffer");
+      return false;
+    }
+  }
+
   return true;
 }
 
@@ -145,6 +165,10 @@ void VoiceAssistant::deallocate_buffers_() {
   ExternalRAMAllocator<uint8_t> send_deallocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   send_deallocator.deallocate(this->send_buffer_, SEND_BUFFER_SIZE);
   this->send_buffer_ = nullptr;
+  if (this->encode_buffer_ != nullptr) {
+    send_deallocator.deallocate(this->encode_buffer_, ENCODE_BUFFER_SIZE);
+    this->encode_buffer_ = nullptr;
+  }
 
   if (this->ring_buffer_ != nullptr) {
     this->ring_buffer_.reset();
@@ -176,10 +200,49 @@ void VoiceAssistant::reset_conversation_id() {
   ESP_LOGD(TAG, "reset conversation ID");
 }
 
+void VoiceAssistant::capture_task(void *params) {
+  auto *this_va = static_cast<VoiceAssistant *>(params);
+  while (true) {
+    if (!this_va->capture_requested_) {
+      this_va->capture_running_ = false;
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+    if (this_va->capture_microphone_() == 0) {
+      this_va->audio_underruns_++;
+      // the microphone read did not block, don't starve the main loop
+      vTaskDelay(1);
+    }
+  }
+}
+
+void VoiceAssistant::start_capture_() {
+  if (this->capture_running_)
+    return;
+  // set here and only cleared by the task, so stopping never misses a task that did not wake up yet
+  this->capture_running_ = true;
+  this->capture_requested_ = true;
+  xTaskNotifyGive(this->capture_task_handle_);
+}
+
+size_t VoiceAssistant::capture_microphone_() {
+  if (!this->mic_->is_running())
+    return 0;
+  size_t bytes_read = this->mic_reader_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
+  if (bytes_read == 0)
+    return 0;
+  if (this->ring_buffer_->free() < bytes_read)
+    this->audio_dropped_bytes_ += bytes_read - this->ring_buffer_->free();
+  this->ring_buffer_->write((void *) this->input_buffer_, bytes_read);
+  return bytes_read;
+}
+
 int VoiceAssistant::read_microphone_() {
+  if (this->capture_running_)
+    return 0;  // the capture task owns the microphone
   size_t bytes_read = 0;
   if (this->mic_->is_running()) {  // Read audio into input buffer
-    bytes_read = this->mic_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
+    bytes_read = this->mic_reader_->read(this->input_buffer_, INPUT_BUFFER_SIZE * sizeof(int16_t));
     if (bytes_read == 0) {
       memset(this->input_buffer_, 0, INPUT_BUFFER_SIZE * sizeof(int16_t));
       return 0;
@@ -202,7 +265,10 @@ void VoiceAssistant::loop() {
     }
     this->continuous_ = false;
     this->signal_stop_();
-    this->clear_buffers_();
+    this->capture_requested_ = false;
+    // otherwise cleared when the microphone starts again
+    if (!this->capture_running_)
+      this->clear_buffers_();
     return;
   }
   switch (this->state_) {
@@ -232,8 +298,15 @@ void VoiceAssistant::loop() {
         this->status_clear_error();
       }
       this->clear_buffers_();
+      this->audio_dropped_bytes_ = 0;
+      this->audio_underruns_ = 0;
+      this->max_audio_latency_ms_ = 0;
+      this->max_encode_us_ = 0;
+      this->total_encode_us_ = 0;
+      this->encoded_frames_ = 0;
 
       this->mic_->start();
+      this->mic_reader_->reset();
       this->high_freq_.start();
       this->set_state_(State::STARTING_MICROPHONE);
       break;
@@ -277,6 +350,7 @@ void VoiceAssistant::loop() {
 #endif
     case State::START_PIPELINE: {
       this->read_microphone_();
+      this->start_capture_();
       ESP_LOGD(TAG, "Requesting start...");
       uint32_t flags = 0;
       if (this->use_wake_word_)
@@ -315,28 +389,38 @@ void VoiceAssistant::loop() {
     case State::STREAMING_MICROPHONE: {
       this->read_microphone_();
       size_t available = this->ring_buffer_->available();
+      uint32_t latency_ms = available * 1000 / (SAMPLE_RATE_HZ * sizeof(int16_t));
+      this->max_audio_latency_ms_ = std::max(this->max_audio_latency_ms_, latency_ms);
       while (available >= SEND_BUFFER_SIZE) {
         size_t read_bytes = this->ring_buffer_->read((void *) this->send_buffer_, SEND_BUFFER_SIZE, 0);
-        if (this->audio_mode_ == AUDIO_MODE_API) {
-          api::VoiceAssistantAudio msg;
-          msg.data.assign((char *) this->send_buffer_, read_bytes);
-          this->api_client_->send_voice_assistant_audio(msg);
-        } else {
-          if (!this->udp_socket_running_) {
-            if (!this->start_udp_socket_()) {
-              this->set_state_(State::STOP_MICROPHONE, State::IDLE);
-              break;
-            }
+        if (this->audio_mode_ == AUDIO_MODE_UDP && !this->udp_socket_running_) {
+          if (!this->start_udp_socket_()) {
+            this->set_state_(State::STOP_MICROPHONE, State::IDLE);
+            break;
           }
-          this->socket_->sendto(this->send_buffer_, read_bytes, 0, (struct sockaddr *) &this->dest_addr_,
-                                sizeof(this->dest_addr_));
         }
+        this->send_audio_(this->send_buffer_, read_bytes);
         available = this->ring_buffer_->available();
       }
 
       break;
     }
     case State::STOP_MICROPHONE: {
+      if (this->capture_running_) {
+        // wait for the capture task to finish its read before stopping the microphone
+        this->capture_requested_ = false;
+        break;
+      }
+      if (this->audio_dropped_bytes_ != 0 || this->audio_underruns_ != 0) {
+        ESP_LOGW(TAG, "Audio dropped: %" PRIu32 " bytes, underruns: %" PRIu32 ", max latency: %" PRIu32 " ms",
+                 this->audio_dropped_bytes_.load(), this->audio_underruns_.load(), this->max_audio_latency_ms_);
+      } else if (this->max_audio_latency_ms_ != 0) {
+        ESP_LOGD(TAG, "Max audio latency: %" PRIu32 " ms", this->max_audio_latency_ms_);
+      }
+      if (this->encoded_frames_ != 0) {
+        ESP_LOGD(TAG, "Encoded %" PRIu32 " frames as ADPCM, %" PRIu32 " us on average, %" PRIu32 " us max",
+                 this->encoded_frames_, this->total_encode_us_ / this->encoded_frames_, this->max_encode_us_);
+      }
       if (this->mic_->is_running()) {
         this->mic_->stop();
         this->set_state_(State::STOPPING_MICROPHONE);
@@ -526,6 +610,37 @@ void VoiceAssistant::failed_to_start() {
   this->set_state_(State::STOP_MICROPHONE, State::IDLE);
 }
 
+bool VoiceAssistant::set_audio_codec(api::enums::VoiceAssistantAudioCodec codec) {
+  if (codec == api::enums::VOICE_ASSISTANT_AUDIO_CODEC_IMA_ADPCM && !this->adpcm_) {
+    ESP_LOGW(TAG, "Server asked for ADPCM audio, which isn't enabled");
+    return false;
+  }
+  this->audio_codec_ = codec;
+  this->adpcm_encoder_.reset();
+  return true;
+}
+
+void VoiceAssistant::send_audio_(const uint8_t *data, size_t len) {
+  if (this->audio_codec_ == api::enums::VOICE_ASSISTANT_AUDIO_CODEC_IMA_ADPCM) {
+    const uint32_t start = micros();
+    len = this->adpcm_encoder_.encode(reinterpret_cast<const int16_t *>(data), len / sizeof(int16_t),
+                                      this->encode_buffer_);
+    const uint32_t elapsed = micros() - start;
+    this->max_encode_us_ = std::max(this->max_encode_us_, elapsed);
+    this->total_encode_us_ += elapsed;
+    this->encoded_frames_++;
+    data = this->encode_buffer_;
+  }
+
+  if (this->audio_mode_ == AUDIO_MODE_API) {
+    api::VoiceAssistantAudio msg;
+    msg.data = StringRef(data, len);
+    this->api_client_->send_voice_assistant_audio(msg);
+  } else {
+    this->socket_->sendto(data, len, 0, (struct sockaddr *) &this->dest_addr_, sizeof(this->dest_addr_));
+  }
+}
+
 void VoiceAssistant::start_streaming() {
   if (this->state_ != State::STARTING_PIPELINE) {
     this->signal_stop_();
@@ -806,12 +921,12 @@ void VoiceAssistant::on_event(const api::VoiceAssistantEventResponse &msg) {
 
 void VoiceAssistant::on_audio(const api::VoiceAssistantAudio &msg) {
 #ifdef USE_SPEAKER  // We should never get to this function if there is no speaker anyway
-  if (this->speaker_buffer_index_ + msg.data.length() < SPEAKER_BUFFER_SIZE) {
-    memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data.data(), msg.data.length());
-    this->speaker_buffer_index_ += msg.data.length();
-    this->speaker_buffer_size_ += msg.data.length();
-    this->speaker_bytes_received_ += msg.data.length();
-    ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data.length());
+  if (this->speaker_buffer_index_ + msg.data.size() < SPEAKER_BUFFER_SIZE) {
+    memcpy(this->speaker_buffer_ + this->speaker_buffer_index_, msg.data.c_str(), msg.data.size());
+    this->speaker_buffer_index_ += msg.data.size();
+    this->speaker_buffer_size_ += msg.data.size();
+    this->speaker_bytes_received_ += msg.data.size();
+    ESP_LOGV(TAG, "Received audio: %u bytes from API", msg.data.size());
   } else {
     ESP_LOGE(TAG, "Cannot receive audio, buffer is full");
   }
@@ -20,10 +20,13 @@
 #endif
 #include "esphome/components/socket/socket.h"
 
+#include "ima_adpcm.h"
+
 #ifdef USE_ESP_ADF
 #include <esp_vad.h>
 #endif
 
+#include <atomic>
 #include <unordered_map>
 #include <vector>
 
@@ -40,6 +43,7 @@ enum VoiceAssistantFeature : uint32_t {
   FEATURE_SPEAKER = 1 << 1,
   FEATURE_API_AUDIO = 1 << 2,
   FEATURE_TIMERS = 1 << 3,
+  FEATURE_AUDIO_ADPCM = 1 << 4,
 };
 
 enum class State {
@@ -97,8 +101,23 @@ class VoiceAssistant : public Component {
   void start_streaming();
   void start_streaming(struct sockaddr_storage *addr, uint16_t port);
   void failed_to_start();
+  /// Select the codec of the microphone audio, as chosen by the server.
+  /// @return Whether this device can send the codec.
+  bool set_audio_codec(api::enums::VoiceAssistantAudioCodec codec);
+
+  void set_microphone(microphone::Microphone *mic) {
+    this->mic_ = mic;
+    this->mic_reader_ = make_unique<microphone::MicrophoneReader>(mic);
+  }
 
-  void set_microphone(microphone::Microphone *mic) { this->mic_ = mic; }
+  /// Bytes of microphone audio overwritten in the ring buffer before they were sent, since the microphone started.
+  uint32_t get_audio_dropped_bytes() const { return this->audio_dropped_bytes_; }
+  /// Microphone reads that returned no audio while streaming.
+  uint32_t get_audio_underruns() const { return this->audio_underruns_; }
+  /// Longest time audio waited in the ring buffer before it was sent.
+  uint32_t get_max_audio_latency_ms() const { return this->max_audio_latency_ms_; }
+  /// Longest time it took to encode one frame of microphone audio, 0 when it's sent as PCM.
+  uint32_t get_max_encode_time_us() const { return this->max_encode_us_; }
 #ifdef USE_SPEAKER
   void set_speaker(speaker::Speaker *speaker) {
     this->speaker_ = speaker;
@@ -135,6 +154,10 @@ class VoiceAssistant : public Component {
       flags |= VoiceAssistantFeature::FEATURE_TIMERS;
     }
 
+    if (this->adpcm_) {
+      flags |= VoiceAssistantFeature::FEATURE_AUDIO_ADPCM;
+    }
+
     return flags;
   }
 
@@ -163,6 +186,8 @@ class VoiceAssistant : public Component {
   void set_auto_gain(uint8_t auto_gain) { this->auto_gain_ = auto_gain; }
   void set_volume_multiplier(float volume_multiplier) { this->volume_multiplier_ = volume_multiplier; }
   void set_conversation_timeout(uint32_t conversation_timeout) { this->conversation_timeout_ = conversation_timeout; }
+  /// Offer the server IMA ADPCM, a quarter of the bandwidth of PCM.
+  void set_adpcm(bool adpcm) { this->adpcm_ = adpcm; }
   void reset_conversation_id();
 
   Trigger<> *get_intent_end_trigger() const { return this->intent_end_trigger_; }
@@ -205,9 +230,15 @@ class VoiceAssistant : public Component {
   void deallocate_buffers_();
 
   int read_microphone_();
+  size_t capture_microphone_();
+  void start_capture_();
+  /// Reads the microphone into ring_buffer_ from START_PIPELINE on, so a slow main loop doesn't cause audio gaps.
+  static void capture_task(void *params);
   void set_state_(State state);
   void set_state_(State state, State desired_state);
   void signal_stop_();
+  /// Send one frame of microphone audio to the server, encoded as negotiated.
+  void send_audio_(const uint8_t *data, size_t len);
 
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   struct sockaddr_storage dest_addr_;
@@ -246,6 +277,7 @@ class VoiceAssistant : public Component {
   bool timer_tick_running_{false};
 
   microphone::Microphone *mic_{nullptr};
+  std::unique_ptr<microphone::MicrophoneReader> mic_reader_;
 #ifdef USE_SPEAKER
   void write_speaker_();
   speaker::Speaker *speaker_{nullptr};
@@ -274,6 +306,14 @@ class VoiceAssistant : public Component {
   uint8_t vad_counter_{0};
 #endif
   std::unique_ptr<RingBuffer> ring_buffer_;
+  TaskHandle_t capture_task_handle_{nullptr};
+  /// Set by the main loop to start and stop the capture task
+  std::atomic<bool> capture_requested_{false};
+  /// Cleared by the capture task once it no longer touches the microphone and the buffers
+  std::atomic<bool> capture_running_{false};
+  std::atomic<uint32_t> audio_dropped_bytes_{0};
+  std::atomic<uint32_t> audio_underruns_{0};
+  uint32_t max_audio_latency_ms_{0};
 
   bool use_wake_word_;
   uint8_t noise_suppression_level_;
@@ -284,6 +324,14 @@ class VoiceAssistant : public Component {
   uint8_t *send_buffer_;
   int16_t *input_buffer_;
 
+  bool adpcm_{false};
+  api::enums::VoiceAssistantAudioCodec audio_codec_{api::enums::VOICE_ASSISTANT_AUDIO_CODEC_PCM};
+  ImaAdpcmEncoder adpcm_encoder_;
+  uint8_t *encode_buffer_{nullptr};
+  uint32_t max_encode_us_{0};
+  uint32_t total_encode_us_{0};
+  uint32_t encoded_frames_{0};
+
   bool continuous_{false};
   bool silence_detection_;
 
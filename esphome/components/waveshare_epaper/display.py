@@ -9,6 +9,7 @@ from esphome.const import (
     CONF_ID,
     CONF_LAMBDA,
     CONF_MODEL,
+    CONF_NUMBER,
     CONF_PAGES,
     CONF_RESET_DURATION,
     CONF_RESET_PIN,
@@ -16,6 +17,8 @@ from esphome.const import (
 
 DEPENDENCIES = ["spi"]
 
+CONF_USE_INTERRUPT = "use_interrupt"
+
 waveshare_epaper_ns = cg.esphome_ns.namespace("waveshare_epaper")
 WaveshareEPaperBase = waveshare_epaper_ns.class_(
     "WaveshareEPaperBase", cg.PollingComponent, spi.SPIDevice, display.DisplayBuffer
@@ -140,15 +143,20 @@ MODELS = {
 }
 
 RESET_PIN_REQUIRED_MODELS = ("2.13inv2", "2.13in-ttgo-b74")
+# Models of type b that support partial updates
+PARTIAL_UPDATE_TYPE_B_MODELS = ("4.20in",)
 
 
 def validate_full_update_every_only_types_ac(value):
     if CONF_FULL_UPDATE_EVERY not in value:
         return value
-    if MODELS[value[CONF_MODEL]][0] == "b":
+    if (
+        MODELS[value[CONF_MODEL]][0] == "b"
+        and value[CONF_MODEL] not in PARTIAL_UPDATE_TYPE_B_MODELS
+    ):
         full_models = []
         for key, val in sorted(MODELS.items()):
-            if val[0] != "b":
+            if val[0] != "b" or key in PARTIAL_UPDATE_TYPE_B_MODELS:
                 full_models.append(key)
         raise cv.Invalid(
             "The 'full_update_every' option is only available for models "
@@ -157,6 +165,23 @@ def validate_full_update_every_only_types_ac(value):
     return value
 
 
+def validate_busy_interrupt(config):
+    if not config[CONF_USE_INTERRUPT]:
+        return config
+    if CONF_BUSY_PIN not in config:
+        raise cv.Invalid(
+            f"'{CONF_USE_INTERRUPT}' requires a '{CONF_BUSY_PIN}'", [CONF_USE_INTERRUPT]
+        )
+    pin = config[CONF_BUSY_PIN]
+    if pins.PIN_SCHEMA_REGISTRY.get_key(pin) != core.CORE.target_platform:
+        raise cv.Invalid(
+            "Interrupts are only supported on internal pins", [CONF_USE_INTERRUPT]
+        )
+    if core.CORE.is_esp8266 and pin[CONF_NUMBER] == 16:
+        raise cv.Invalid("GPIO16 has no interrupt support", [CONF_USE_INTERRUPT])
+    return config
+
+
 def validate_reset_pin_required(config):
     if config[CONF_MODEL] in RESET_PIN_REQUIRED_MODELS and CONF_RESET_PIN not in config:
         raise cv.Invalid(
@@ -173,6 +198,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_MODEL): cv.one_of(*MODELS, lower=True),
             cv.Optional(CONF_RESET_PIN): pins.gpio_output_pin_schema,
             cv.Optional(CONF_BUSY_PIN): pins.gpio_input_pin_schema,
+            cv.Optional(CONF_USE_INTERRUPT, default=False): cv.boolean,
             cv.Optional(CONF_FULL_UPDATE_EVERY): cv.int_range(min=1, max=4294967295),
             cv.Optional(CONF_RESET_DURATION): cv.All(
                 cv.positive_time_period_milliseconds,
@@ -184,6 +210,7 @@ CONFIG_SCHEMA = cv.All(
     .extend(spi.spi_device_schema()),
     validate_full_update_every_only_types_ac,
     validate_reset_pin_required,
+    validate_busy_interrupt,
     cv.has_at_most_one_key(CONF_PAGES, CONF_LAMBDA),
 )
 
@@ -216,6 +243,8 @@ async def to_code(config):
     if CONF_BUSY_PIN in config:
         reset = await cg.gpio_pin_expression(config[CONF_BUSY_PIN])
         cg.add(var.set_busy_pin(reset))
+    if config[CONF_USE_INTERRUPT]:
+        cg.add(var.set_busy_interrupt(True))
     if CONF_FULL_UPDATE_EVERY in config:
         cg.add(var.set_full_update_every(config[CONF_FULL_UPDATE_EVERY]))
     if CONF_RESET_DURATION in config:
@@ -104,6 +104,7 @@ void WaveshareEPaper2P13InV3::setup() {
   SEND(TEMP_SENS);
   this->wait_until_idle_();
   this->write_lut_(FULL_LUT);
+  this->enable_dirty_tracking_();
 }
 
 // t and b are y positions, i.e. line numbers.
@@ -129,13 +130,15 @@ void WaveshareEPaper2P13InV3::partial_update_() {
     SEND(BORDER_PART);
     SEND(UPSEQ);
     this->command(ACTIVATE);
-    this->set_timeout(100, [this] {
-      this->wait_until_idle_();
-      this->write_buffer_(WRITE_BUFFER, 0, this->get_height_internal());
-      SEND(ON_PARTIAL);
-      this->command(ACTIVATE);  // Activate Display Update Sequence
-      this->is_busy_ = false;
-    });
+    this->when_idle_(
+        [this] {
+          // The rest of the RAM still holds the previous frame
+          this->flush_dirty_();
+          SEND(ON_PARTIAL);
+          this->command(ACTIVATE);  // Activate Display Update Sequence
+          this->when_idle_([this] { this->is_busy_ = false; }, 10);
+        },
+        100);
   });
 }
 
@@ -144,16 +147,29 @@ void WaveshareEPaper2P13InV3::full_update_() {
   this->write_lut_(FULL_LUT);
   this->write_buffer_(WRITE_BUFFER, 0, this->get_height_internal());
   this->write_buffer_(WRITE_BASE, 0, this->get_height_internal());
+  this->dirty_region_.clear();
   SEND(ON_FULL);
-  this->command(ACTIVATE);  // don't wait here
-  this->is_busy_ = false;
+  this->command(ACTIVATE);
+  // the next update starts once the refresh is done
+  this->when_idle_([this] { this->is_busy_ = false; }, 10);
+}
+
+void WaveshareEPaper2P13InV3::flush_rect_internal(const display::Rect &rect) {
+  this->write_ram_window_(WRITE_BUFFER, rect);
+}
+
+void WaveshareEPaper2P13InV3::update() {
+  this->do_update_();
+  this->start_display_(true);
 }
 
 void WaveshareEPaper2P13InV3::display() {
   if (this->is_busy_ || (this->busy_pin_ != nullptr && this->busy_pin_->digital_read()))
     return;
-  this->is_busy_ = true;
   const bool partial = this->at_update_ != 0;
+  if (partial && this->dirty_region_.empty())
+    return;
+  this->is_busy_ = true;
   this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
   if (partial) {
     this->partial_update_();
@@ -120,6 +120,11 @@ void WaveshareEPaperBase::setup_pins_() {
   }
   if (this->busy_pin_ != nullptr) {
     this->busy_pin_->setup();  // INPUT
+    if (this->busy_interrupt_) {
+      // The config validation only allows internal pins with interrupts
+      static_cast<InternalGPIOPin *>(this->busy_pin_)
+          ->attach_interrupt(&WaveshareEPaperBase::gpio_intr, this, gpio::INTERRUPT_ANY_EDGE);
+    }
   }
   this->spi_setup();
 
@@ -163,11 +168,67 @@ bool WaveshareEPaperBase::wait_until_idle_() {
   }
   return true;
 }
+void WaveshareEPaperBase::when_idle_(std::function<void()> &&step, uint32_t settle) {
+  if (settle == 0 && !this->is_busy_()) {
+    step();
+    return;
+  }
+  this->idle_step_ = std::move(step);
+  this->idle_start_ = millis();
+  this->idle_settle_ = settle;
+  this->enable_loop();
+}
+void WaveshareEPaperBase::start_display_(bool when_idle) {
+  if (this->is_updating_()) {
+    // loop() calls display() once the panel is done
+    this->display_pending_ = true;
+    return;
+  }
+  if (when_idle) {
+    this->when_idle_([this]() { this->display(); });
+  } else {
+    this->display();
+  }
+}
+void WaveshareEPaperBase::loop() {
+  if (!this->is_updating_()) {
+    this->disable_loop();
+    return;
+  }
+  const uint32_t elapsed = millis() - this->idle_start_;
+  if (elapsed < this->idle_settle_)
+    return;
+  const uint32_t timeout = this->idle_settle_ + this->idle_timeout_();
+  const bool busy = this->is_busy_();
+  if (busy && elapsed <= timeout) {
+    if (this->busy_interrupt_) {
+      // Woken up by the interrupt, or to give up
+      this->disable_loop();
+      this->set_timeout("busy", timeout - elapsed + 1, [this]() { this->enable_loop(); });
+    }
+    return;
+  }
+  this->cancel_timeout("busy");
+  if (busy) {
+    ESP_LOGE(TAG, "Timeout while displaying image!");
+    this->status_set_warning();
+  }
+
+  std::function<void()> step = std::move(this->idle_step_);
+  this->idle_step_ = nullptr;
+  step();
+  if (!this->is_updating_() && this->display_pending_) {
+    this->display_pending_ = false;
+    this->display();
+  }
+}
+void IRAM_ATTR WaveshareEPaperBase::gpio_intr(WaveshareEPaperBase *arg) { arg->enable_loop_soon_from_isr(); }
 void WaveshareEPaperBase::update() {
   this->do_update_();
-  this->display();
+  this->start_display_(false);
 }
 void WaveshareEPaper::fill(Color color) {
+  this->track_fill_(color);
   // flip logic
   const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
@@ -190,6 +251,36 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
 uint32_t WaveshareEPaper::get_buffer_length_() {
   return this->get_width_controller() * this->get_height_internal() / 8u;
 }  // just a black buffer
+void WaveshareEPaper::write_ram_window_(uint8_t cmd, const display::Rect &rect) {
+  const int width_bytes = this->get_width_controller() / 8;
+  const int x_start = rect.x / 8;
+  const int x_end = (rect.x2() - 1) / 8;
+  const int y_end = rect.y2() - 1;
+
+  // COMMAND SET RAM X ADDRESS START END POSITION
+  this->command(0x44);
+  this->data(x_start);
+  this->data(x_end);
+  // COMMAND SET RAM Y ADDRESS START END POSITION
+  this->command(0x45);
+  this->data(rect.y);
+  this->data(rect.y >> 8);
+  this->data(y_end);
+  this->data(y_end >> 8);
+  // COMMAND SET RAM X ADDRESS COUNTER
+  this->command(0x4E);
+  this->data(x_start);
+  // COMMAND SET RAM Y ADDRESS COUNTER
+  this->command(0x4F);
+  this->data(rect.y);
+  this->data(rect.y >> 8);
+
+  this->command(cmd);
+  this->start_data_();
+  for (int y = rect.y; y <= y_end; y++)
+    this->write_array(this->buffer_ + y * width_bytes + x_start, x_end - x_start + 1);
+  this->end_data_();
+}
 uint32_t WaveshareEPaperBWR::get_buffer_length_() {
   return this->get_width_controller() * this->get_height_internal() / 4u;
 }  // black and red buffer
@@ -239,6 +330,9 @@ void WaveshareEPaperBase::on_safe_shutdown() { this->deep_sleep(); }
 void WaveshareEPaperTypeA::initialize() {
   // Achieve display intialization
   this->init_display_();
+  // Partial updates of these models only send the areas that changed
+  if (this->model_ == WAVESHARE_EPAPER_2_9_IN_V2)
+    this->enable_dirty_tracking_();
   // If a reset pin is configured, eligible displays can be set to deep sleep
   // between updates, as recommended by the hardware provider
   if (this->reset_pin_ != nullptr) {
@@ -351,9 +445,18 @@ void WaveshareEPaperTypeA::dump_config() {
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
   LOG_UPDATE_INTERVAL(this);
 }
+void WaveshareEPaperTypeA::update() {
+  this->do_update_();
+  // BUSY stays high while the display sleeps
+  this->start_display_(!this->deep_sleep_between_updates_);
+}
 void HOT WaveshareEPaperTypeA::display() {
   bool full_update = this->at_update_ == 0;
   bool prev_full_update = this->at_update_ == 1;
+  const bool windowed = !full_update && this->track_dirty_;
+
+  if (windowed && this->dirty_region_.empty())
+    return;
 
   if (this->deep_sleep_between_updates_) {
     ESP_LOGI(TAG, "Wake up the display");
@@ -426,73 +529,79 @@ void HOT WaveshareEPaperTypeA::display() {
       break;
   }
 
-  // Set x & y regions we want to write to (full)
-  switch (this->model_) {
-    case TTGO_EPAPER_2_13_IN_B1:
-      // COMMAND SET RAM X ADDRESS START END POSITION
-      this->command(0x44);
-      this->data(0x00);
-      this->data((this->get_width_controller() - 1) >> 3);
-      // COMMAND SET RAM Y ADDRESS START END POSITION
-      this->command(0x45);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
-      this->data(0x00);
-      this->data(0x00);
-
-      // COMMAND SET RAM X ADDRESS COUNTER
-      this->command(0x4E);
-      this->data(0x00);
-      // COMMAND SET RAM Y ADDRESS COUNTER
-      this->command(0x4F);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
-
-      break;
-    default:
-      // COMMAND SET RAM X ADDRESS START END POSITION
-      this->command(0x44);
-      this->data(0x00);
-      this->data((this->get_width_internal() - 1) >> 3);
-      // COMMAND SET RAM Y ADDRESS START END POSITION
-      this->command(0x45);
-      this->data(0x00);
-      this->data(0x00);
-      this->data(this->get_height_internal() - 1);
-      this->data((this->get_height_internal() - 1) >> 8);
-
-      // COMMAND SET RAM X ADDRESS COUNTER
-      this->command(0x4E);
-      this->data(0x00);
-      // COMMAND SET RAM Y ADDRESS COUNTER
-      this->command(0x4F);
-      this->data(0x00);
-      this->data(0x00);
-  }
-
   if (!this->wait_until_idle_()) {
     this->status_set_warning();
     return;
   }
 
-  // COMMAND WRITE RAM
-  this->command(0x24);
-  this->start_data_();
-  switch (this->model_) {
-    case TTGO_EPAPER_2_13_IN_B1: {  // block needed because of variable initializations
-      int16_t wb = ((this->get_width_controller()) >> 3);
-      for (int i = 0; i < this->get_height_internal(); i++) {
-        for (int j = 0; j < wb; j++) {
-          int idx = j + (this->get_height_internal() - 1 - i) * wb;
-          this->write_byte(this->buffer_[idx]);
+  if (windowed) {
+    // The rest of the controller RAM still holds the previous frame
+    this->flush_dirty_();
+  } else {
+    // Set x & y regions we want to write to (full)
+    switch (this->model_) {
+      case TTGO_EPAPER_2_13_IN_B1:
+        // COMMAND SET RAM X ADDRESS START END POSITION
+        this->command(0x44);
+        this->data(0x00);
+        this->data((this->get_width_controller() - 1) >> 3);
+        // COMMAND SET RAM Y ADDRESS START END POSITION
+        this->command(0x45);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
+        this->data(0x00);
+        this->data(0x00);
+
+        // COMMAND SET RAM X ADDRESS COUNTER
+        this->command(0x4E);
+        this->data(0x00);
+        // COMMAND SET RAM Y ADDRESS COUNTER
+        this->command(0x4F);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
+
+        break;
+      default:
+        // COMMAND SET RAM X ADDRESS START END POSITION
+        this->command(0x44);
+        this->data(0x00);
+        this->data((this->get_width_internal() - 1) >> 3);
+        // COMMAND SET RAM Y ADDRESS START END POSITION
+        this->command(0x45);
+        this->data(0x00);
+        this->data(0x00);
+        this->data(this->get_height_internal() - 1);
+        this->data((this->get_height_internal() - 1) >> 8);
+
+        // COMMAND SET RAM X ADDRESS COUNTER
+        this->command(0x4E);
+        this->data(0x00);
+        // COMMAND SET RAM Y ADDRESS COUNTER
+        this->command(0x4F);
+        this->data(0x00);
+        this->data(0x00);
+    }
+
+    // COMMAND WRITE RAM
+    this->command(0x24);
+    this->start_data_();
+    switch (this->model_) {
+      case TTGO_EPAPER_2_13_IN_B1: {  // block needed because of variable initializations
+        int16_t wb = ((this->get_width_controller()) >> 3);
+        for (int i = 0; i < this->get_height_internal(); i++) {
+          for (int j = 0; j < wb; j++) {
+            int idx = j + (this->get_height_internal() - 1 - i) * wb;
+            this->write_byte(this->buffer_[idx]);
+          }
         }
+        break;
       }
-      break;
+      default:
+        this->write_array(this->buffer_, this->get_buffer_length_());
     }
-    default:
-      this->write_array(this->buffer_, this->get_buffer_length_());
+    this->end_data_();
+    this->dirty_region_.clear();
   }
-  this->end_data_();
 
   if (this->model_ == WAVESHARE_EPAPER_2_13_IN_V2 && full_update) {
     // Write base image again on full refresh
@@ -589,6 +698,10 @@ void WaveshareEPaperTypeA::write_lut_(const uint8_t *lut, const uint8_t size) {
   for (uint8_t i = 0; i < size; i++)
     this->data(lut[i]);
 }
+void WaveshareEPaperTypeA::flush_rect_internal(const display::Rect &rect) {
+  // COMMAND WRITE RAM
+  this->write_ram_window_(0x24, rect);
+}
 WaveshareEPaperTypeA::WaveshareEPaperTypeA(WaveshareEPaperTypeAModel model) : model_(model) {}
 void WaveshareEPaperTypeA::set_full_update_every(uint32_t full_update_every) {
   this->full_update_every_ = full_update_every;
@@ -954,9 +1067,7 @@ void HOT WaveshareEPaper2P7InB::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  this->wait_until_idle_();
-
-  this->deep_sleep();
+  this->when_idle_([this]() { this->deep_sleep(); });
 }
 int WaveshareEPaper2P7InB::get_width_internal() { return 176; }
 int WaveshareEPaper2P7InB::get_height_internal() { return 264; }
@@ -1035,7 +1146,8 @@ void HOT WaveshareEPaper2P7InBV2::display() {
 
   this->command(0x20);
 
-  this->wait_until_idle_();
+  // the next update starts once the refresh is done
+  this->when_idle_([]() {});
 }
 int WaveshareEPaper2P7InBV2::get_width_internal() { return 176; }
 int WaveshareEPaper2P7InBV2::get_height_internal() { return 264; }
@@ -1109,12 +1221,13 @@ void HOT WaveshareEPaper2P9InB::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  delay(2);
-  this->wait_until_idle_();
-
-  // COMMAND POWER OFF
-  // NOTE: power off < deep sleep
-  this->command(0x02);
+  this->when_idle_(
+      [this]() {
+        // COMMAND POWER OFF
+        // NOTE: power off < deep sleep
+        this->command(0x02);
+      },
+      2);
 }
 int WaveshareEPaper2P9InB::get_width_internal() { return 128; }
 int WaveshareEPaper2P9InB::get_height_internal() { return 296; }
@@ -1303,12 +1416,13 @@ void HOT WaveshareEPaper2P9InBV3::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  delay(2);
-  this->wait_until_idle_();
-
-  // COMMAND POWER OFF
-  // NOTE: power off < deep sleep
-  this->command(0x02);
+  this->when_idle_(
+      [this]() {
+        // COMMAND POWER OFF
+        // NOTE: power off < deep sleep
+        this->command(0x02);
+      },
+      2);
 }
 int WaveshareEPaper2P9InBV3::get_width_internal() { return 128; }
 int WaveshareEPaper2P9InBV3::get_height_internal() { return 296; }
@@ -1573,12 +1687,13 @@ void HOT GDEW029T5::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  delay(2);
-  this->wait_until_idle_();
-
-  // COMMAND POWER OFF
-  // NOTE: power off < deep sleep
-  this->command(0x02);
+  this->when_idle_(
+      [this]() {
+        // COMMAND POWER OFF
+        // NOTE: power off < deep sleep
+        this->command(0x02);
+      },
+      2);
 }
 int GDEW029T5::get_width_internal() { return 128; }
 int GDEW029T5::get_height_internal() { return 296; }
@@ -1706,9 +1821,7 @@ void HOT GDEW0154M09::display() {
     this->data(this->buffer_[i]);
   }
   this->command(CMD_DISPLAY_REFRESH);
-  delay(10);
-  this->wait_until_idle_();
-  this->deep_sleep();
+  this->when_idle_([this]() { this->deep_sleep(); }, 10);
 }
 
 void GDEW0154M09::deep_sleep() {
@@ -1809,8 +1922,19 @@ void WaveshareEPaper4P2In::initialize() {
   this->command(0x24);
   for (uint8_t i : LUT_BLACK_TO_BLACK_4_2)
     this->data(i);
+
+  this->enable_dirty_tracking_();
+}
+void WaveshareEPaper4P2In::update() {
+  this->do_update_();
+  this->start_display_(true);
 }
 void HOT WaveshareEPaper4P2In::display() {
+  const bool partial = this->at_update_ != 0;
+  if (partial && this->dirty_region_.empty())
+    return;
+  this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
+
   // COMMAND RESOLUTION SETTING
   this->command(0x61);
   this->data(0x01);
@@ -1826,27 +1950,71 @@ void HOT WaveshareEPaper4P2In::display() {
   this->command(0x50);
   this->data(0x97);
 
-  // COMMAND DATA START TRANSMISSION 1
-  this->command(0x10);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-  delay(2);
-  // COMMAND DATA START TRANSMISSION 2
-  this->command(0x13);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
+  if (partial) {
+    this->partial_update_();
+    return;
+  }
+
+  // COMMAND PARTIAL OUT
+  this->command(0x92);
+  this->write_data_(display::Rect(0, 0, this->get_width_internal(), this->get_height_internal()));
+  this->dirty_region_.clear();
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
 }
+void WaveshareEPaper4P2In::partial_update_() {
+  display::Rect bounds;
+  for (const display::Rect &rect : this->dirty_region_)
+    bounds.extend(rect);
+  this->dirty_region_.clear();
+  // The window starts and ends on whole bytes
+  const int x_start = bounds.x & ~0x07;
+  const int x_end = (bounds.x2() - 1) | 0x07;
+  const int y_end = bounds.y2() - 1;
+
+  // COMMAND PARTIAL IN
+  this->command(0x91);
+  // COMMAND PARTIAL WINDOW
+  this->command(0x90);
+  this->data(x_start >> 8);
+  this->data(x_start);
+  this->data(x_end >> 8);
+  this->data(x_end);
+  this->data(bounds.y >> 8);
+  this->data(bounds.y);
+  this->data(y_end >> 8);
+  this->data(y_end);
+  this->data(0x28);  // PT_SCAN clear: the gates only scan inside the window, as in the Waveshare demo
+
+  this->write_data_(display::Rect(x_start, bounds.y, x_end - x_start + 1, bounds.h));
+  // COMMAND DISPLAY REFRESH
+  this->command(0x12);
+}
+void WaveshareEPaper4P2In::write_data_(const display::Rect &rect) {
+  const int width_bytes = this->get_width_internal() / 8;
+  const int x_start = rect.x / 8;
+  const int length = rect.w / 8;
+  // The LUTs only depend on the new data, so the old data is the same
+  for (uint8_t cmd : {0x10, 0x13}) {
+    // COMMAND DATA START TRANSMISSION 1 / 2
+    this->command(cmd);
+    delay(2);
+    this->start_data_();
+    for (int y = rect.y; y < rect.y2(); y++)
+      this->write_array(this->buffer_ + y * width_bytes + x_start, length);
+    this->end_data_();
+    delay(2);
+  }
+}
 int WaveshareEPaper4P2In::get_width_internal() { return 400; }
 int WaveshareEPaper4P2In::get_height_internal() { return 300; }
+void WaveshareEPaper4P2In::set_full_update_every(uint32_t full_update_every) {
+  this->full_update_every_ = full_update_every;
+}
 void WaveshareEPaper4P2In::dump_config() {
   LOG_DISPLAY("", "Waveshare E-Paper", this);
   ESP_LOGCONFIG(TAG, "  Model: 4.2in");
+  ESP_LOGCONFIG(TAG, "  Full Update Every: %" PRIu32, this->full_update_every_);
   LOG_PIN("  Reset Pin: ", this->reset_pin_);
   LOG_PIN("  DC Pin: ", this->dc_pin_);
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
@@ -1892,11 +2060,11 @@ void HOT WaveshareEPaper4P2InBV2::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  this->wait_until_idle_();
-
-  // COMMAND POWER OFF
-  // NOTE: power off < deep sleep
-  this->command(0x02);
+  this->when_idle_([this]() {
+    // COMMAND POWER OFF
+    // NOTE: power off < deep sleep
+    this->command(0x02);
+  });
 }
 int WaveshareEPaper4P2InBV2::get_width_internal() { return 400; }
 int WaveshareEPaper4P2InBV2::get_height_internal() { return 300; }
@@ -2148,9 +2316,7 @@ void HOT WaveshareEPaper7P5InBV2::display() {
 
   // COMMAND DISPLAY REFRESH
   this->command(0x12);
-  delay(100);  // NOLINT
-  this->wait_until_idle_();
-  this->deep_sleep();
+  this->when_idle_([this]() { this->deep_sleep(); }, 100);
 }
 int WaveshareEPaper7P5InBV2::get_width_internal() { return 800; }
 int WaveshareEPaper7P5InBV2::get_height_internal() { return 480; }
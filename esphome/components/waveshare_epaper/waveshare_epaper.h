@@ -15,6 +15,8 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   float get_setup_priority() const override;
   void set_reset_pin(GPIOPin *reset) { this->reset_pin_ = reset; }
   void set_busy_pin(GPIOPin *busy) { this->busy_pin_ = busy; }
+  /// Wake loop() from an interrupt when BUSY changes, instead of checking it on every iteration.
+  void set_busy_interrupt(bool busy_interrupt) { this->busy_interrupt_ = busy_interrupt; }
   void set_reset_duration(uint32_t reset_duration) { this->reset_duration_ = reset_duration; }
 
   void command(uint8_t value);
@@ -26,6 +28,7 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   virtual void deep_sleep() = 0;
 
   void update() override;
+  void loop() override;
 
   void setup() override {
     this->setup_pins_();
@@ -36,6 +39,20 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
 
  protected:
   bool wait_until_idle_();
+  bool is_busy_() { return this->busy_pin_ != nullptr && this->busy_pin_->digital_read(); }
+  /** Continue the update with `step` once the BUSY pin is released, or after the idle timeout.
+   *
+   * Unlike wait_until_idle_() this returns right away and loop() runs `step` later, so the main loop keeps running
+   * while the panel refreshes. BUSY is only checked `settle` ms from now, for commands that raise it with a delay.
+   * Only one step can be pending, display() must not be called before it ran.
+   */
+  void when_idle_(std::function<void()> &&step, uint32_t settle = 0);
+  /// Whether the last update still waits for the panel.
+  bool is_updating_() const { return bool(this->idle_step_); }
+  /// Call display(), after the pending update and optionally once BUSY is released.
+  void start_display_(bool when_idle);
+
+  static void gpio_intr(WaveshareEPaperBase *arg);
 
   void setup_pins_();
 
@@ -62,6 +79,13 @@ class WaveshareEPaperBase : public display::DisplayBuffer,
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
   virtual uint32_t idle_timeout_() { return 1000u; }  // NOLINT(readability-identifier-naming)
+
+  bool busy_interrupt_{false};
+  std::function<void()> idle_step_{};
+  uint32_t idle_start_{0};
+  uint32_t idle_settle_{0};
+  /// update() was called while the previous update was still running
+  bool display_pending_{false};
 };
 
 class WaveshareEPaper : public WaveshareEPaperBase {
@@ -73,6 +97,10 @@ class WaveshareEPaper : public WaveshareEPaperBase {
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
   uint32_t get_buffer_length_() override;
+
+  /// Write an area of the buffer to RAM `cmd` of an SSD16xx style controller, through its RAM window. The area is
+  /// widened to whole bytes, the data entry mode has to be x and y increasing.
+  void write_ram_window_(uint8_t cmd, const display::Rect &rect);
 };
 
 class WaveshareEPaperBWR : public WaveshareEPaperBase {
@@ -135,11 +163,15 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
 
   void set_full_update_every(uint32_t full_update_every);
 
+  void update() override;
+
  protected:
   void write_lut_(const uint8_t *lut, uint8_t size);
 
   void init_display_();
 
+  void flush_rect_internal(const display::Rect &rect) override;
+
   int get_width_internal() override;
 
   int get_height_internal() override;
@@ -435,10 +467,21 @@ class WaveshareEPaper4P2In : public WaveshareEPaper {
     this->data(0xA5);  // check byte
   }
 
+  void set_full_update_every(uint32_t full_update_every);
+
+  void update() override;
+
  protected:
   int get_width_internal() override;
 
   int get_height_internal() override;
+
+  /// Send the bounding box of the changed areas, only that part of the panel is refreshed.
+  void partial_update_();
+  void write_data_(const display::Rect &rect);
+
+  uint32_t full_update_every_{30};
+  uint32_t at_update_{0};
 };
 
 class WaveshareEPaper4P2InBV2 : public WaveshareEPaper {
@@ -753,11 +796,13 @@ class WaveshareEPaper2P13InV3 : public WaveshareEPaper {
 
   void setup() override;
   void initialize() override;
+  void update() override;
 
  protected:
   int get_width_internal() override;
   int get_height_internal() override;
   uint32_t idle_timeout_() override;
+  void flush_rect_internal(const display::Rect &rect) override;
 
   void write_buffer_(uint8_t cmd, int top, int bottom);
   void set_window_(int t, int b);
@@ -0,0 +1,169 @@
+#include "states_iterator.h"
+#ifdef USE_WEBSERVER
+
+#include "web_server.h"
+
+namespace esphome {
+namespace web_server {
+
+std::string StatesIterator::build(bool include_internal) {
+  this->result_ = "[";
+  this->begin(include_internal);
+  while (this->is_running())
+    this->advance();
+  this->result_ += "]";
+  return std::move(this->result_);
+}
+
+bool StatesIterator::matches_(const char *domain, EntityBase *entity) const {
+  return (this->domain_.empty() || this->domain_ == domain) &&
+         (this->id_.empty() || this->id_ == entity->get_object_id());
+}
+
+void StatesIterator::add_(const std::string &json) {
+  if (this->result_.size() > 1)
+    this->result_ += ",";
+  this->result_ += json;
+}
+
+#ifdef USE_BINARY_SENSOR
+bool StatesIterator::on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) {
+  if (this->matches_("binary_sensor", binary_sensor))
+    this->add_(this->web_server_->binary_sensor_json(binary_sensor, binary_sensor->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_COVER
+bool StatesIterator::on_cover(cover::Cover *cover) {
+  if (this->matches_("cover", cover))
+    this->add_(this->web_server_->cover_json(cover, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_FAN
+bool StatesIterator::on_fan(fan::Fan *fan) {
+  if (this->matches_("fan", fan))
+    this->add_(this->web_server_->fan_json(fan, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_LIGHT
+bool StatesIterator::on_light(light::LightState *light) {
+  if (this->matches_("light", light))
+    this->add_(this->web_server_->light_json(light, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_SENSOR
+bool StatesIterator::on_sensor(sensor::Sensor *sensor) {
+  if (this->matches_("sensor", sensor))
+    this->add_(this->web_server_->sensor_json(sensor, sensor->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_SWITCH
+bool StatesIterator::on_switch(switch_::Switch *a_switch) {
+  if (this->matches_("switch", a_switch))
+    this->add_(this->web_server_->switch_json(a_switch, a_switch->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_BUTTON
+bool StatesIterator::on_button(button::Button *button) {
+  return true;
+}
+#endif
+#ifdef USE_TEXT_SENSOR
+bool StatesIterator::on_text_sensor(text_sensor::TextSensor *text_sensor) {
+  if (this->matches_("text_sensor", text_sensor))
+    this->add_(this->web_server_->text_sensor_json(text_sensor, text_sensor->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_CLIMATE
+bool StatesIterator::on_climate(climate::Climate *climate) {
+  if (this->matches_("climate", climate))
+    this->add_(this->web_server_->climate_json(climate, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_NUMBER
+bool StatesIterator::on_number(number::Number *number) {
+  if (this->matches_("number", number))
+    this->add_(this->web_server_->number_json(number, number->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_DATETIME_DATE
+bool StatesIterator::on_date(datetime::DateEntity *date) {
+  if (this->matches_("date", date))
+    this->add_(this->web_server_->date_json(date, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_DATETIME_TIME
+bool StatesIterator::on_time(datetime::TimeEntity *time) {
+  if (this->matches_("time", time))
+    this->add_(this->web_server_->time_json(time, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_DATETIME_DATETIME
+bool StatesIterator::on_datetime(datetime::DateTimeEntity *datetime) {
+  if (this->matches_("datetime", datetime))
+    this->add_(this->web_server_->datetime_json(datetime, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_TEXT
+bool StatesIterator::on_text(text::Text *text) {
+  if (this->matches_("text", text))
+    this->add_(this->web_server_->text_json(text, text->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_SELECT
+bool StatesIterator::on_select(select::Select *select) {
+  if (this->matches_("select", select))
+    this->add_(this->web_server_->select_json(select, select->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_LOCK
+bool StatesIterator::on_lock(lock::Lock *a_lock) {
+  if (this->matches_("lock", a_lock))
+    this->add_(this->web_server_->lock_json(a_lock, a_lock->state, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_VALVE
+bool StatesIterator::on_valve(valve::Valve *valve) {
+  if (this->matches_("valve", valve))
+    this->add_(this->web_server_->valve_json(valve, DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+bool StatesIterator::on_alarm_control_panel(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
+  if (this->matches_("alarm_control_panel", a_alarm_control_panel))
+    this->add_(this->web_server_->alarm_control_panel_json(a_alarm_control_panel, a_alarm_control_panel->get_state(),
+                                                           DETAIL_STATE));
+  return true;
+}
+#endif
+#ifdef USE_EVENT
+bool StatesIterator::on_event(event::Event *event) {
+  return true;
+}
+#endif
+#ifdef USE_UPDATE
+bool StatesIterator::on_update(update::UpdateEntity *update) {
+  if (this->matches_("update", update))
+    this->add_(this->web_server_->update_json(update, DETAIL_STATE));
+  return true;
+}
+#endif
+
+}  // namespace web_server
+}  // namespace esphome
+#endif
@@ -12,6 +12,7 @@
 #include "StreamString.h"
 #endif
 
+#include <cinttypes>
 #include <cstdlib>
 
 #ifdef USE_LIGHT
@@ -64,14 +65,23 @@ UrlMatch match_url(const std::string &url, bool only_domain = false) {
   match.valid = true;
   if (id_end == std::string::npos) {
     match.id = url.substr(id_begin, url.length() - id_begin);
+    match.key = fnv1_hash(match.id);
     return match;
   }
   match.id = url.substr(id_begin, id_end - id_begin);
+  match.key = fnv1_hash(match.id);
   size_t method_begin = id_end + 1;
   match.method = url.substr(method_begin, url.length() - method_begin);
   return match;
 }
 
+/// The entity found by the key of the URL, unless it is another one with the same hash.
+template<typename T> static T *matching_entity(T *obj, const UrlMatch &match) {
+  if (obj == nullptr || obj->get_object_id() != match.id)
+    return nullptr;
+  return obj;
+}
+
 WebServer::WebServer(web_server_base::WebServerBase *base)
     : base_(base), entities_iterator_(ListEntitiesIterator(this)) {
 #ifdef USE_ESP32
@@ -100,6 +110,7 @@ void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
   this->setup_controller(this->include_internal_);
   this->base_->init();
+  this->boot_id_ = random_uint32();
 
   this->events_.onConnect([this](AsyncEventSourceClient *client) {
     // Configure reconnect timeout and send config
@@ -121,7 +132,123 @@ void WebServer::setup() {
     this->base_->add_ota_handler();
 
   this->set_interval(10000, [this]() { this->events_.send("", "ping", millis(), 30000); });
+  if (this->state_event_interval_ > 0)
+    this->set_interval(this->state_event_interval_, [this]() { this->flush_state_events_(); });
+}
+
+bool WebServer::defer_state_event_(EntityBase *obj, EntityType type) {
+  if (this->state_event_interval_ == 0)
+    return false;
+  // the state is encoded with the next flush, only once however often it changes until then
+  this->state_changes_.mark(obj, type);
+  return true;
+}
+
+void WebServer::flush_state_events_() {
+  const bool connected = this->events_.count() != 0;
+  this->state_changes_.take([this, connected](const StateChangeTracker::Record &record) {
+    if (connected)
+      this->events_.send(this->state_json_(record).c_str(), "state");
+  });
+}
+
+std::string WebServer::state_json_(const StateChangeTracker::Record &record) {
+  switch (record.type) {
+#ifdef USE_SENSOR
+    case EntityType::SENSOR: {
+      auto *obj = static_cast<sensor::Sensor *>(record.entity);
+      return this->sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_TEXT_SENSOR
+    case EntityType::TEXT_SENSOR: {
+      auto *obj = static_cast<text_sensor::TextSensor *>(record.entity);
+      return this->text_sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_SWITCH
+    case EntityType::SWITCH: {
+      auto *obj = static_cast<switch_::Switch *>(record.entity);
+      return this->switch_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_BINARY_SENSOR
+    case EntityType::BINARY_SENSOR: {
+      auto *obj = static_cast<binary_sensor::BinarySensor *>(record.entity);
+      return this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_FAN
+    case EntityType::FAN:
+      return this->fan_json(static_cast<fan::Fan *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_LIGHT
+    case EntityType::LIGHT:
+      return this->light_json(static_cast<light::LightState *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_COVER
+    case EntityType::COVER:
+      return this->cover_json(static_cast<cover::Cover *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_NUMBER
+    case EntityType::NUMBER: {
+      auto *obj = static_cast<number::Number *>(record.entity);
+      return this->number_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_DATETIME_DATE
+    case EntityType::DATETIME_DATE:
+      return this->date_json(static_cast<datetime::DateEntity *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_DATETIME_TIME
+    case EntityType::DATETIME_TIME:
+      return this->time_json(static_cast<datetime::TimeEntity *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_DATETIME_DATETIME
+    case EntityType::DATETIME_DATETIME:
+      return this->datetime_json(static_cast<datetime::DateTimeEntity *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_TEXT
+    case EntityType::TEXT: {
+      auto *obj = static_cast<text::Text *>(record.entity);
+      return this->text_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_SELECT
+    case EntityType::SELECT: {
+      auto *obj = static_cast<select::Select *>(record.entity);
+      return this->select_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_CLIMATE
+    case EntityType::CLIMATE:
+      return this->climate_json(static_cast<climate::Climate *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_LOCK
+    case EntityType::LOCK: {
+      auto *obj = static_cast<lock::Lock *>(record.entity);
+      return this->lock_json(obj, obj->state, DETAIL_STATE);
+    }
+#endif
+#ifdef USE_VALVE
+    case EntityType::VALVE:
+      return this->valve_json(static_cast<valve::Valve *>(record.entity), DETAIL_STATE);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+    case EntityType::ALARM_CONTROL_PANEL: {
+      auto *obj = static_cast<alarm_control_panel::AlarmControlPanel *>(record.entity);
+      return this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
+    }
+#endif
+#ifdef USE_UPDATE
+    case EntityType::UPDATE:
+      return this->update_json(static_cast<update::UpdateEntity *>(record.entity), DETAIL_STATE);
+#endif
+    default:
+      return "";
+  }
 }
+
 void WebServer::loop() {
 #ifdef USE_ESP32
   if (xSemaphoreTake(this->to_schedule_lock_, 0L)) {
@@ -147,17 +274,68 @@ void WebServer::dump_config() {
 }
 float WebServer::get_setup_priority() const { return setup_priority::WIFI - 1.0f; }
 
+/// Answer with 304 if the client already has this version of the resource, otherwise return false.
+static bool send_not_modified(AsyncWebServerRequest *request, const std::string &etag) {
+#ifdef USE_ARDUINO
+  AsyncWebHeader *header = request->getHeader("If-None-Match");
+  if (header == nullptr || header->value() != etag.c_str())
+    return false;
+#else
+  auto header = request->get_header("If-None-Match");
+  if (!header.has_value() || *header != etag)
+    return false;
+#endif
+  request->send(304);
+  return true;
+}
+
+static void add_cache_headers(AsyncWebServerResponse *response, const std::string &etag) {
+  response->addHeader("ETag", etag.c_str());
+  response->addHeader("Cache-Control", "no-cache");
+}
+
+#if defined(USE_WEBSERVER_LOCAL) || USE_WEBSERVER_VERSION >= 2 || defined(USE_WEBSERVER_CSS_INCLUDE) || \
+    defined(USE_WEBSERVER_JS_INCLUDE)
+// The embedded assets only change with the firmware, so browsers may keep them as long as they revalidate them
+// against an ETag derived from the build time. Reloading the page then costs a 304 instead of the whole bundle.
+static std::string asset_etag() { return str_sprintf("\"%08" PRIx32 "\"", fnv1_hash(App.get_compilation_time())); }
+#endif
+
+void WebServer::handle_states_request(AsyncWebServerRequest *request) {
+  // Any state change bumps the version, so an unchanged ETag means all states are the same as last time
+  std::string etag = str_sprintf("\"%08" PRIx32 "-%" PRIx32 "\"", this->boot_id_, this->state_version_.load());
+  if (send_not_modified(request, etag))
+    return;
+  std::string domain, id;
+  if (request->hasParam("domain"))
+    domain = request->getParam("domain")->value().c_str();
+  if (request->hasParam("id"))
+    id = request->getParam("id")->value().c_str();
+  std::string data = StatesIterator(this, std::move(domain), std::move(id)).build(this->include_internal_);
+  AsyncWebServerResponse *response = request->beginResponse(200, "application/json", data.c_str());
+  add_cache_headers(response, etag);
+  request->send(response);
+}
+
 #ifdef USE_WEBSERVER_LOCAL
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  std::string etag = asset_etag();
+  if (send_not_modified(request, etag))
+    return;
   AsyncWebServerResponse *response = request->beginResponse_P(200, "text/html", INDEX_GZ, sizeof(INDEX_GZ));
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, etag);
   request->send(response);
 }
 #elif USE_WEBSERVER_VERSION >= 2
 void WebServer::handle_index_request(AsyncWebServerRequest *request) {
+  std::string etag = asset_etag();
+  if (send_not_modified(request, etag))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/html", ESPHOME_WEBSERVER_INDEX_HTML, ESPHOME_WEBSERVER_INDEX_HTML_SIZE);
   // No gzip header here because the HTML file is so small
+  add_cache_headers(response, etag);
   request->send(response);
 }
 #endif
@@ -175,18 +353,26 @@ void WebServer::handle_pna_cors_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_WEBSERVER_CSS_INCLUDE
 void WebServer::handle_css_request(AsyncWebServerRequest *request) {
+  std::string etag = asset_etag();
+  if (send_not_modified(request, etag))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/css", ESPHOME_WEBSERVER_CSS_INCLUDE, ESPHOME_WEBSERVER_CSS_INCLUDE_SIZE);
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, etag);
   request->send(response);
 }
 #endif
 
 #ifdef USE_WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
+  std::string etag = asset_etag();
+  if (send_not_modified(request, etag))
+    return;
   AsyncWebServerResponse *response =
       request->beginResponse_P(200, "text/javascript", ESPHOME_WEBSERVER_JS_INCLUDE, ESPHOME_WEBSERVER_JS_INCLUDE_SIZE);
   response->addHeader("Content-Encoding", "gzip");
+  add_cache_headers(response, etag);
   request->send(response);
 }
 #endif
@@ -211,14 +397,13 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::SENSOR))
     return;
   this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (sensor::Sensor *obj = matching_entity(App.get_sensor_by_key(match.key, true), match)) {
     std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
     request->send(200, "application/json", data.c_str());
     return;
@@ -249,14 +434,13 @@ std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::TEXT_SENSOR))
     return;
   this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (text_sensor::TextSensor *obj = matching_entity(App.get_text_sensor_by_key(match.key, true), match)) {
     std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
     request->send(200, "application/json", data.c_str());
     return;
@@ -278,15 +462,13 @@ std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std:
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::SWITCH))
     return;
   this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (switch_::Switch *obj = matching_entity(App.get_switch_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -321,9 +503,7 @@ std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail
 
 #ifdef USE_BUTTON
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (button::Button *obj = matching_entity(App.get_button_by_key(match.key, true), match)) {
     if (match.method == "press") {
       this->schedule_([obj]() { obj->press(); });
       request->send(200);
@@ -349,14 +529,13 @@ std::string WebServer::button_json(button::Button *obj, JsonDetail start_config)
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::BINARY_SENSOR))
     return;
   this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (binary_sensor::BinarySensor *obj = matching_entity(App.get_binary_sensor_by_key(match.key, true), match)) {
     std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
     request->send(200, "application/json", data.c_str());
     return;
@@ -378,15 +557,13 @@ std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool
 
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::Fan *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::FAN))
     return;
   this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (fan::Fan *obj = matching_entity(App.get_fan_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->fan_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -456,15 +633,13 @@ std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::LIGHT))
     return;
   this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (light::LightState *obj = matching_entity(App.get_light_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->light_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -567,19 +742,17 @@ std::string WebServer::light_json(light::LightState *obj, JsonDetail start_confi
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::COVER))
     return;
   this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (cover::Cover *obj = matching_entity(App.get_cover_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->cover_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
-      continue;
+      return;
     }
 
     auto call = obj->make_call();
@@ -643,15 +816,13 @@ std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::NUMBER))
     return;
   this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (auto *obj = matching_entity(App.get_number_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -709,14 +880,13 @@ std::string WebServer::number_json(number::Number *obj, float value, JsonDetail
 
 #ifdef USE_DATETIME_DATE
 void WebServer::on_date_update(datetime::DateEntity *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::DATETIME_DATE))
     return;
   this->events_.send(this->date_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_date_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_dates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (auto *obj = matching_entity(App.get_date_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET) {
       std::string data = this->date_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -763,14 +933,13 @@ std::string WebServer::date_json(datetime::DateEntity *obj, JsonDetail start_con
 
 #ifdef USE_DATETIME_TIME
 void WebServer::on_time_update(datetime::TimeEntity *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::DATETIME_TIME))
     return;
   this->events_.send(this->time_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_time_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_times()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (auto *obj = matching_entity(App.get_time_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->time_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -816,14 +985,13 @@ std::string WebServer::time_json(datetime::TimeEntity *obj, JsonDetail start_con
 
 #ifdef USE_DATETIME_DATETIME
 void WebServer::on_datetime_update(datetime::DateTimeEntity *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::DATETIME_DATETIME))
     return;
   this->events_.send(this->datetime_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_datetime_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_datetimes()) {
-    if (obj->get_object_id() != match.id)
-      continue;
+  if (auto *obj = matching_entity(App.get_datetime_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->datetime_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -870,15 +1038,13 @@ std::string WebServer::datetime_json(datetime::DateTimeEntity *obj, JsonDetail s
 
 #ifdef USE_TEXT
 void WebServer::on_text_update(text::Text *obj, const std::string &state) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::TEXT))
     return;
   this->events_.send(this->text_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_text_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_texts()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (auto *obj = matching_entity(App.get_text_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->text_json(obj, obj->state, DETAIL_STATE);
       request->send(200, "text/json", data.c_str());
@@ -926,15 +1092,13 @@ std::string WebServer::text_json(text::Text *obj, const std::string &value, Json
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::SELECT))
     return;
   this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (auto *obj = matching_entity(App.get_select_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       auto detail = DETAIL_STATE;
       auto *param = request->getParam("detail");
@@ -985,15 +1149,13 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::CLIMATE))
     return;
   this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (auto *obj = matching_entity(App.get_climate_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->climate_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -1139,15 +1301,13 @@ std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_conf
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::LOCK))
     return;
   this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (lock::Lock *obj = matching_entity(App.get_lock_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -1182,19 +1342,17 @@ std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDet
 
 #ifdef USE_VALVE
 void WebServer::on_valve_update(valve::Valve *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::VALVE))
     return;
   this->events_.send(this->valve_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_valve_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (valve::Valve *obj : App.get_valves()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (valve::Valve *obj = matching_entity(App.get_valve_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->valve_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
-      continue;
+      return;
     }
 
     auto call = obj->make_call();
@@ -1247,15 +1405,14 @@ std::string WebServer::valve_json(valve::Valve *obj, JsonDetail start_config) {
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::ALARM_CONTROL_PANEL))
     return;
   this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  auto *entity = App.get_alarm_control_panel_by_key(match.key, true);
+  if (alarm_control_panel::AlarmControlPanel *obj = matching_entity(entity, match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -1304,15 +1461,13 @@ std::string WebServer::event_json(event::Event *obj, const std::string &event_ty
 
 #ifdef USE_UPDATE
 void WebServer::on_update(update::UpdateEntity *obj) {
-  if (this->events_.count() == 0)
+  this->state_version_++;
+  if (this->events_.count() == 0 || this->defer_state_event_(obj, EntityType::UPDATE))
     return;
   this->events_.send(this->update_json(obj, DETAIL_STATE).c_str(), "state");
 }
 void WebServer::handle_update_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (update::UpdateEntity *obj : App.get_updates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
+  if (update::UpdateEntity *obj = matching_entity(App.get_update_by_key(match.key, true), match)) {
     if (request->method() == HTTP_GET && match.method.empty()) {
       std::string data = this->update_json(obj, DETAIL_STATE);
       request->send(200, "application/json", data.c_str());
@@ -1365,6 +1520,9 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
   if (request->url() == "/")
     return true;
 
+  if (request->url() == "/states")
+    return request->method() == HTTP_GET;
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css")
     return true;
@@ -1493,6 +1651,11 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
     return;
   }
 
+  if (request->url() == "/states") {
+    this->handle_states_request(request);
+    return;
+  }
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   if (request->url() == "/0.css") {
     this->handle_css_request(request);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "list_entities.h"
+#include "states_iterator.h"
 
 #include "esphome/components/web_server_base/web_server_base.h"
 #ifdef USE_WEBSERVER
@@ -8,6 +9,7 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/entity_base.h"
 
+#include <atomic>
 #include <map>
 #include <vector>
 #ifdef USE_ESP32
@@ -39,6 +41,7 @@ struct UrlMatch {
   std::string domain;  ///< The domain of the component, for example "sensor"
   std::string id;      ///< The id of the device that's being accessed, for example "living_room_fan"
   std::string method;  ///< The method that's being called, for example "turn_on"
+  uint32_t key{0};     ///< The key of the entity with the id, to look it up in the Application
   bool valid;          ///< Whether this match is valid
 };
 
@@ -109,6 +112,12 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    * @param expose_log.
    */
   void set_expose_log(bool expose_log) { this->expose_log_ = expose_log; }
+  /** Send state events at most every interval ms, with only the latest state of each entity.
+   * 0 (the default) sends every state change right away.
+   *
+   * @param interval.
+   */
+  void set_state_event_interval(uint32_t interval) { this->state_event_interval_ = interval; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -127,6 +136,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Return the webserver configuration as JSON.
   std::string get_config_json();
 
+  /// Handle a request for the states of all entities under '/states', optionally filtered by `domain` and `id`.
+  void handle_states_request(AsyncWebServerRequest *request);
+
 #ifdef USE_WEBSERVER_CSS_INCLUDE
   /// Handle included css request under '/0.css'.
   void handle_css_request(AsyncWebServerRequest *request);
@@ -341,11 +353,21 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void schedule_(std::function<void()> &&f);
+  /// Whether the state event of `obj` is sent with the next flush, when the events are coalesced.
+  bool defer_state_event_(EntityBase *obj, EntityType type);
+  void flush_state_events_();
+  std::string state_json_(const StateChangeTracker::Record &record);
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   ListEntitiesIterator entities_iterator_;
   std::map<EntityBase *, SortingComponents> sorting_entitys_;
+  uint32_t state_event_interval_{0};
+  StateChangeTracker state_changes_;
+  /// Counts state changes of all entities, for the ETag of '/states'
+  std::atomic<uint32_t> state_version_{0};
+  /// Keeps the ETags of different boots apart, the version starts from 0 on every boot
+  uint32_t boot_id_{0};
 #if USE_WEBSERVER_VERSION == 1
   const char *css_url_{nullptr};
   const char *js_url_{nullptr};
@@ -1,14 +1,60 @@
-import esphome.config_validation as cv
+import esphome.codegen as cg
 from esphome.components.esp32 import add_idf_sdkconfig_option
+import esphome.config_validation as cv
+from esphome.const import CONF_STACK_SIZE, KEY_CORE, KEY_FRAMEWORK_VERSION
+from esphome.core import CORE
 
 CODEOWNERS = ["@dentra"]
 
+CONF_ASYNC_WORKERS = "async_workers"
+CONF_KEEP_ALIVE = "keep_alive"
+CONF_LRU_PURGE = "lru_purge"
+CONF_MAX_OPEN_SOCKETS = "max_open_sockets"
+
+# httpd keeps 3 sockets for itself, lwIP allows 16 in total, leave a few for the API
+MAX_OPEN_SOCKETS = 10
+
+
+def _validate_async_workers(config):
+    if config[CONF_ASYNC_WORKERS] and CORE.data[KEY_CORE][
+        KEY_FRAMEWORK_VERSION
+    ] < cv.Version(5, 1, 0):
+        raise cv.Invalid(
+            f"{CONF_ASYNC_WORKERS} requires ESP-IDF 5.1 or newer",
+            path=[CONF_ASYNC_WORKERS],
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
-    cv.Schema({}),
+    cv.Schema(
+        {
+            cv.Optional(CONF_MAX_OPEN_SOCKETS, default=7): cv.int_range(
+                min=1, max=MAX_OPEN_SOCKETS
+            ),
+            cv.Optional(CONF_LRU_PURGE, default=True): cv.boolean,
+            cv.Optional(CONF_KEEP_ALIVE, default=True): cv.boolean,
+            cv.Optional(CONF_STACK_SIZE, default=4096): cv.int_range(min=3072),
+            cv.Optional(CONF_ASYNC_WORKERS, default=0): cv.int_range(min=0, max=4),
+        }
+    ),
     cv.only_with_esp_idf,
+    _validate_async_workers,
 )
 
 
 async def to_code(config):
     # Increase the maximum supported size of headers section in HTTP request packet to be processed by the server
     add_idf_sdkconfig_option("CONFIG_HTTPD_MAX_REQ_HDR_LEN", 1024)
+
+    cg.add_define("USE_WEBSERVER_IDF_MAX_OPEN_SOCKETS", config[CONF_MAX_OPEN_SOCKETS])
+    if config[CONF_MAX_OPEN_SOCKETS] > 7:
+        # The default of 10 lwIP sockets would leave nothing for the API and other components
+        add_idf_sdkconfig_option("CONFIG_LWIP_MAX_SOCKETS", 16)
+    if config[CONF_LRU_PURGE]:
+        cg.add_define("USE_WEBSERVER_IDF_LRU_PURGE")
+    if config[CONF_KEEP_ALIVE]:
+        cg.add_define("USE_WEBSERVER_IDF_KEEP_ALIVE")
+    cg.add_define("USE_WEBSERVER_IDF_STACK_SIZE", config[CONF_STACK_SIZE])
+    if config[CONF_ASYNC_WORKERS]:
+        cg.add_define("USE_WEBSERVER_IDF_ASYNC_WORKERS", config[CONF_ASYNC_WORKERS])
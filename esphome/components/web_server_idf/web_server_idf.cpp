@@ -6,10 +6,15 @@
 #include "esphome/core/helpers.h"
 
 #include "esp_tls_crypto.h"
+#include <esp_idf_version.h>
 
 #include "utils.h"
 #include "web_server_idf.h"
 
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 namespace web_server_idf {
 
@@ -36,6 +41,23 @@ void AsyncWebServer::begin() {
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
   config.server_port = this->port_;
   config.uri_match_fn = [](const char * /*unused*/, const char * /*unused*/, size_t /*unused*/) { return true; };
+#ifdef USE_WEBSERVER_IDF_MAX_OPEN_SOCKETS
+  config.max_open_sockets = USE_WEBSERVER_IDF_MAX_OPEN_SOCKETS;
+#endif
+#ifdef USE_WEBSERVER_IDF_STACK_SIZE
+  config.stack_size = USE_WEBSERVER_IDF_STACK_SIZE;
+#endif
+#ifdef USE_WEBSERVER_IDF_LRU_PURGE
+  // Close the least recently used connection when a new client finds all sockets taken, instead of refusing it
+  config.lru_purge_enable = true;
+#endif
+#if defined(USE_WEBSERVER_IDF_KEEP_ALIVE) && ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  // Probe idle connections, so clients that went away don't keep their socket
+  config.keep_alive_enable = true;
+#endif
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+  this->start_workers_();
+#endif
   if (httpd_start(&this->server_, &config) == ESP_OK) {
     const httpd_uri_t handler_get = {
         .uri = "",
@@ -98,16 +120,61 @@ esp_err_t AsyncWebServer::request_post_handler(httpd_req_t *r) {
     }
   }
 
-  AsyncWebServerRequest req(r, std::move(post_query));
-  return static_cast<AsyncWebServer *>(r->user_ctx)->request_handler_(&req);
+  return static_cast<AsyncWebServer *>(r->user_ctx)->dispatch_(r, std::move(post_query));
 }
 
 esp_err_t AsyncWebServer::request_handler(httpd_req_t *r) {
   ESP_LOGVV(TAG, "Enter AsyncWebServer::request_handler. method=%u, uri=%s", r->method, r->uri);
-  AsyncWebServerRequest req(r);
-  return static_cast<AsyncWebServer *>(r->user_ctx)->request_handler_(&req);
+  return static_cast<AsyncWebServer *>(r->user_ctx)->dispatch_(r, {});
 }
 
+esp_err_t AsyncWebServer::dispatch_(httpd_req_t *r, std::string post_query) {
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+  // Event streams keep their socket in the session context, so they stay on the server task. Only this task queues,
+  // so a free slot can't be taken between the check and the send.
+  auto accept = request_get_header(r, "Accept");
+  bool event_stream = accept.has_value() && accept->find("text/event-stream") != std::string::npos;
+  httpd_req_t *copy = nullptr;
+  if (!event_stream && uxQueueSpacesAvailable(this->async_queue_) > 0 &&
+      httpd_req_async_handler_begin(r, &copy) == ESP_OK) {
+    auto *request = new AsyncRequest{copy, std::move(post_query)};  // NOLINT(cppcoreguidelines-owning-memory)
+    xQueueSend(this->async_queue_, &request, 0);
+    return ESP_OK;
+  }
+#endif
+  AsyncWebServerRequest req(r, std::move(post_query));
+  return this->request_handler_(&req);
+}
+
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+void AsyncWebServer::start_workers_() {
+  if (this->async_queue_ != nullptr)
+    return;
+  this->async_queue_ = xQueueCreate(USE_WEBSERVER_IDF_ASYNC_WORKERS, sizeof(AsyncRequest *));
+  for (int i = 0; i < USE_WEBSERVER_IDF_ASYNC_WORKERS; i++) {
+    // Same priority and stack as the server task, the handlers are the same
+    xTaskCreate(AsyncWebServer::worker_task, "httpd_worker", USE_WEBSERVER_IDF_STACK_SIZE, this, tskIDLE_PRIORITY + 5,
+                nullptr);
+  }
+}
+
+void AsyncWebServer::worker_task(void *params) {
+  auto *server = static_cast<AsyncWebServer *>(params);
+  AsyncRequest *request;
+  while (true) {
+    if (xQueueReceive(server->async_queue_, &request, portMAX_DELAY) != pdTRUE)
+      continue;
+    {
+      AsyncWebServerRequest req(request->req, std::move(request->post_query));
+      if (server->request_handler_(&req) == ESP_ERR_NOT_FOUND)
+        httpd_resp_send_err(request->req, HTTPD_404_NOT_FOUND, nullptr);
+    }
+    httpd_req_async_handler_complete(request->req);
+    delete request;  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+}
+#endif
+
 esp_err_t AsyncWebServer::request_handler_(AsyncWebServerRequest *request) const {
   for (auto *handler : this->handlers_) {
     if (handler->canHandle(request)) {
@@ -1,7 +1,13 @@
 #pragma once
 #ifdef USE_ESP_IDF
 
+#include "esphome/core/defines.h"
+
 #include <esp_http_server.h>
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#endif
 
 #include <functional>
 #include <map>
@@ -193,7 +199,19 @@ class AsyncWebServer {
   httpd_handle_t server_{};
   static esp_err_t request_handler(httpd_req_t *r);
   static esp_err_t request_post_handler(httpd_req_t *r);
+  /// Handle the request right away, or hand it off to a worker when there is one.
+  esp_err_t dispatch_(httpd_req_t *r, std::string post_query);
   esp_err_t request_handler_(AsyncWebServerRequest *request) const;
+#ifdef USE_WEBSERVER_IDF_ASYNC_WORKERS
+  struct AsyncRequest {
+    httpd_req_t *req;
+    std::string post_query;
+  };
+  /// Handles requests from async_queue_, so a slow handler only holds up its own client.
+  static void worker_task(void *params);
+  void start_workers_();
+  QueueHandle_t async_queue_{nullptr};
+#endif
   std::vector<AsyncWebHandler *> handlers_;
   std::function<void(AsyncWebServerRequest *request)> on_not_found_{};
 };
@@ -46,6 +46,8 @@ from . import wpa2_eap
 AUTO_LOAD = ["network"]
 
 NO_WIFI_VARIANTS = [const.VARIANT_ESP32H2]
+# Components that list all networks found by a scan
+SCAN_RESULTS_USERS = ["captive_portal", "esp32_improv", "improv_serial", "wifi_info"]
 
 wifi_ns = cg.esphome_ns.namespace("wifi")
 EAPAuth = wifi_ns.struct("EAPAuth")
@@ -257,6 +259,10 @@ def _validate(config):
             raise cv.Invalid("At least one network required for fast_connect!")
         if len(networks) != 1:
             raise cv.Invalid("Fast connect can only be used with one network!")
+    elif config.get(CONF_FAST_CONNECT_REUSE_IP, False):
+        raise cv.Invalid(
+            f"{CONF_FAST_CONNECT_REUSE_IP} requires {CONF_FAST_CONNECT} to be enabled"
+        )
 
     if CONF_USE_ADDRESS not in config:
         use_address = CORE.name + config[CONF_DOMAIN]
@@ -282,6 +288,7 @@ def _validate(config):
 
 CONF_OUTPUT_POWER = "output_power"
 CONF_PASSIVE_SCAN = "passive_scan"
+CONF_FAST_CONNECT_REUSE_IP = "fast_connect_reuse_ip"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -305,6 +312,7 @@ CONFIG_SCHEMA = cv.All(
                 rtl87xx="none",
             ): cv.enum(WIFI_POWER_SAVE_MODES, upper=True),
             cv.Optional(CONF_FAST_CONNECT, default=False): cv.boolean,
+            cv.Optional(CONF_FAST_CONNECT_REUSE_IP, default=False): cv.boolean,
             cv.Optional(CONF_USE_ADDRESS): cv.string_strict,
             cv.SplitDefault(CONF_OUTPUT_POWER, esp8266=20.0): cv.All(
                 cv.decibel, cv.float_range(min=8.5, max=20.5)
@@ -425,6 +433,8 @@ async def to_code(config):
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
     cg.add(var.set_power_save_mode(config[CONF_POWER_SAVE_MODE]))
     cg.add(var.set_fast_connect(config[CONF_FAST_CONNECT]))
+    if config[CONF_FAST_CONNECT_REUSE_IP]:
+        cg.add(var.set_fast_connect_reuse_ip(True))
     cg.add(var.set_passive_scan(config[CONF_PASSIVE_SCAN]))
     if CONF_OUTPUT_POWER in config:
         cg.add(var.set_output_power(config[CONF_OUTPUT_POWER]))
@@ -447,6 +457,11 @@ async def to_code(config):
         if config[CONF_ENABLE_RRM]:
             cg.add(var.set_rrm(config[CONF_ENABLE_RRM]))
 
+    # Unless a component offers the scanned networks to pick from, only the ones
+    # matching a configured network are kept
+    if not any(domain in CORE.loaded_integrations for domain in SCAN_RESULTS_USERS):
+        cg.add_define("USE_WIFI_SCAN_MATCHING_ONLY")
+
     cg.add_define("USE_WIFI")
 
     # must register before OTA safe mode check
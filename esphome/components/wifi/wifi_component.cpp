@@ -42,6 +42,22 @@ namespace wifi {
 
 static const char *const TAG = "wifi";
 
+// A reused IP configuration is never renewed, so get a fresh lease through DHCP every so many connections
+static const uint8_t FAST_CONNECT_MAX_IP_REUSES = 16;
+
+static uint32_t ip4_to_u32(network::IPAddress address) {
+  if (!address.is_ip4())
+    return 0;
+  ip_addr_t addr = address;
+  return ip_addr_get_ip4_u32(&addr);
+}
+
+static network::IPAddress u32_to_ip4(uint32_t value) {
+  ip_addr_t addr;
+  ip_addr_set_ip4_u32(&addr, value);
+  return network::IPAddress(&addr);
+}
+
 float WiFiComponent::get_setup_priority() const { return setup_priority::WIFI; }
 
 void WiFiComponent::setup() {
@@ -61,6 +77,7 @@ void WiFiComponent::start() {
   ESP_LOGCONFIG(TAG, "Starting WiFi...");
   ESP_LOGCONFIG(TAG, "  Local MAC: %s", get_mac_address_pretty().c_str());
   this->last_connected_ = millis();
+  this->connect_started_ = this->last_connected_;
 
   uint32_t hash = this->has_sta() ? fnv1_hash(App.get_compilation_time()) : 88491487UL;
 
@@ -161,11 +178,20 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_STA_CONNECTED: {
         if (!this->is_connected()) {
           ESP_LOGW(TAG, "WiFi Connection lost... Reconnecting...");
+          // The loop may have been idle, the connection was there until the event that woke it up
+          this->last_connected_ = now;
+          this->connect_started_ = now;
           this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTING;
           this->retry_connect();
         } else {
           this->status_clear_warning();
           this->last_connected_ = now;
+#ifndef USE_RP2040
+          // Nothing to do until the connection changes, which the platform reports with an event that resumes the
+          // loop. The CYW43 driver of the Pico W has no events, so it keeps polling.
+          this->disable_loop();
+          return;
+#endif
         }
         break;
       }
@@ -277,6 +303,7 @@ void WiFiComponent::setup_ap_config_() {
   if (!this->has_sta()) {
     this->state_ = WIFI_COMPONENT_STATE_AP;
   }
+  this->enable_loop_soon_any_context();
 }
 
 void WiFiComponent::set_ap(const WiFiAP &ap) {
@@ -377,6 +404,7 @@ void WiFiComponent::start_connecting(const WiFiAP &ap, bool two) {
     this->state_ = WIFI_COMPONENT_STATE_STA_CONNECTING_2;
   }
   this->action_started_ = millis();
+  this->enable_loop_soon_any_context();
 }
 
 const LogString *get_signal_bars(int8_t rssi) {
@@ -462,6 +490,7 @@ void WiFiComponent::enable() {
   ESP_LOGD(TAG, "Enabling WIFI...");
   this->error_from_callback_ = false;
   this->state_ = WIFI_COMPONENT_STATE_OFF;
+  this->enable_loop_soon_any_context();
   this->start();
 }
 
@@ -482,6 +511,25 @@ void WiFiComponent::start_scanning() {
   ESP_LOGD(TAG, "Starting scan...");
   this->wifi_scan_start_(this->passive_scan_);
   this->state_ = WIFI_COMPONENT_STATE_STA_SCANNING;
+  this->enable_loop_soon_any_context();
+}
+
+void WiFiComponent::add_scan_result_(WiFiScanResult &&res) {
+#ifdef USE_WIFI_SCAN_MATCHING_ONLY
+  // No other component lists the scanned networks, only the ones that can be connected to are needed
+  bool matches = false;
+  for (auto &ap : this->sta_) {
+    if (res.matches(ap)) {
+      matches = true;
+      break;
+    }
+  }
+  if (!matches) {
+    ESP_LOGV(TAG, "Ignoring network " LOG_SECRET("'%s'"), res.get_ssid().c_str());
+    return;
+  }
+#endif
+  this->scan_result_.push_back(std::move(res));
 }
 
 void WiFiComponent::check_scanning_finished() {
@@ -494,7 +542,11 @@ void WiFiComponent::check_scanning_finished() {
   }
   this->scan_done_ = false;
 
+#ifdef USE_WIFI_SCAN_MATCHING_ONLY
+  ESP_LOGD(TAG, "Found matching networks:");
+#else
   ESP_LOGD(TAG, "Found networks:");
+#endif
   if (this->scan_result_.empty()) {
     ESP_LOGD(TAG, "  No network found!");
     this->retry_connect();
@@ -614,7 +666,9 @@ void WiFiComponent::check_connecting_finished() {
     // We won't retry hidden networks unless a reconnect fails more than three times again
     this->retry_hidden_ = false;
 
-    ESP_LOGI(TAG, "WiFi Connected!");
+    this->connect_duration_ = millis() - this->connect_started_;
+    ESP_LOGI(TAG, "WiFi Connected in %" PRIu32 " ms%s", this->connect_duration_,
+             this->reusing_ip_ ? " with the saved IP configuration" : "");
     this->print_connect_params_();
 
     if (this->has_ap()) {
@@ -676,6 +730,14 @@ void WiFiComponent::check_connecting_finished() {
 }
 
 void WiFiComponent::retry_connect() {
+  if (this->reusing_ip_) {
+    // The saved IP configuration may be what failed, so fall back to DHCP
+    ESP_LOGD(TAG, "Not reusing the saved IP configuration anymore");
+    this->reusing_ip_ = false;
+    this->ip_reuses_ = 0;
+    this->selected_ap_.set_manual_ip(this->sta_[0].get_manual_ip());
+  }
+
   if (this->selected_ap_.get_bssid()) {
     auto bssid = *this->selected_ap_.get_bssid();
     float priority = this->get_sta_priority(bssid);
@@ -758,23 +820,53 @@ void WiFiComponent::load_fast_connect_settings_() {
     this->selected_ap_.set_channel(fast_connect_save.channel);
 
     ESP_LOGD(TAG, "Loaded saved fast_connect wifi settings");
+
+    if (this->fast_connect_reuse_ip_ && fast_connect_save.ip != 0 && !this->selected_ap_.get_manual_ip().has_value() &&
+        fast_connect_save.ip_reuses < FAST_CONNECT_MAX_IP_REUSES) {
+      ManualIP manual_ip{};
+      manual_ip.static_ip = u32_to_ip4(fast_connect_save.ip);
+      manual_ip.gateway = u32_to_ip4(fast_connect_save.gateway);
+      manual_ip.subnet = u32_to_ip4(fast_connect_save.subnet);
+      manual_ip.dns1 = u32_to_ip4(fast_connect_save.dns1);
+      manual_ip.dns2 = u32_to_ip4(fast_connect_save.dns2);
+      this->selected_ap_.set_manual_ip(manual_ip);
+      this->reusing_ip_ = true;
+      this->ip_reuses_ = fast_connect_save.ip_reuses + 1;
+      ESP_LOGD(TAG, "Reusing saved IP address %s instead of DHCP", manual_ip.static_ip.str().c_str());
+    }
   }
 }
 
 void WiFiComponent::save_fast_connect_settings_() {
   bssid_t bssid = wifi_bssid();
-  uint8_t channel = wifi_channel_();
-
-  if (bssid != this->selected_ap_.get_bssid() || channel != this->selected_ap_.get_channel()) {
-    SavedWifiFastConnectSettings fast_connect_save{};
 
-    memcpy(fast_connect_save.bssid, bssid.data(), 6);
-    fast_connect_save.channel = channel;
+  SavedWifiFastConnectSettings fast_connect_save{};
+  memcpy(fast_connect_save.bssid, bssid.data(), 6);
+  fast_connect_save.channel = wifi_channel_();
 
-    this->fast_connect_pref_.save(&fast_connect_save);
+  if (this->fast_connect_reuse_ip_ && !this->sta_[0].get_manual_ip().has_value()) {
+    for (auto &ip : this->wifi_sta_ip_addresses()) {
+      if (ip.is_ip4() && ip.is_set()) {
+        fast_connect_save.ip = ip4_to_u32(ip);
+        break;
+      }
+    }
+    if (fast_connect_save.ip != 0) {
+      fast_connect_save.gateway = ip4_to_u32(this->wifi_gateway_ip_());
+      fast_connect_save.subnet = ip4_to_u32(this->wifi_subnet_mask_());
+      fast_connect_save.dns1 = ip4_to_u32(this->wifi_dns_ip_(0));
+      fast_connect_save.dns2 = ip4_to_u32(this->wifi_dns_ip_(1));
+      fast_connect_save.ip_reuses = this->ip_reuses_;
+    }
+  }
 
-    ESP_LOGD(TAG, "Saved fast_connect wifi settings");
+  SavedWifiFastConnectSettings previous{};
+  if (this->fast_connect_pref_.load(&previous) && memcmp(&previous, &fast_connect_save, sizeof(previous)) == 0) {
+    return;
   }
+  this->fast_connect_pref_.save(&fast_connect_save);
+
+  ESP_LOGD(TAG, "Saved fast_connect wifi settings");
 }
 
 void WiFiAP::set_ssid(const std::string &ssid) { this->ssid_ = ssid; }
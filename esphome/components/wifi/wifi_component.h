@@ -60,6 +60,14 @@ struct SavedWifiSettings {
 struct SavedWifiFastConnectSettings {
   uint8_t bssid[6];
   uint8_t channel;
+  /// IPv4 configuration of the last connection, ip is 0 when there is none to reuse.
+  uint32_t ip;
+  uint32_t gateway;
+  uint32_t subnet;
+  uint32_t dns1;
+  uint32_t dns2;
+  /// Connections that reused this configuration since it was last obtained through DHCP.
+  uint8_t ip_reuses;
 } PACKED;  // NOLINT
 
 enum WiFiComponentState {
@@ -231,6 +239,8 @@ class WiFiComponent : public Component {
   void check_scanning_finished();
   void start_connecting(const WiFiAP &ap, bool two);
   void set_fast_connect(bool fast_connect);
+  /// Connect with the IP configuration DHCP handed out last time, instead of running DHCP again.
+  void set_fast_connect_reuse_ip(bool reuse_ip) { this->fast_connect_reuse_ip_ = reuse_ip; }
   void set_ap_timeout(uint32_t ap_timeout) { ap_timeout_ = ap_timeout; }
 
   void check_connecting_finished();
@@ -242,6 +252,8 @@ class WiFiComponent : public Component {
   void set_reboot_timeout(uint32_t reboot_timeout);
 
   bool is_connected();
+  /// How long the last connection took to come up, from starting to connect to having an IP address, in ms.
+  uint32_t get_connect_duration() const { return this->connect_duration_; }
 
   void set_power_save_mode(WiFiPowerSaveMode power_save);
   void set_output_power(float output_power) { output_power_ = output_power; }
@@ -337,6 +349,8 @@ class WiFiComponent : public Component {
   void wifi_pre_setup_();
   WiFiSTAConnectStatus wifi_sta_connect_status_();
   bool wifi_scan_start_(bool passive);
+  /// Add a network found by a scan to the results, unless it isn't needed.
+  void add_scan_result_(WiFiScanResult &&res);
 
 #ifdef USE_WIFI_AP
   bool wifi_ap_ip_config_(optional<ManualIP> manual_ip);
@@ -384,6 +398,10 @@ class WiFiComponent : public Component {
   std::vector<WiFiSTAPriority> sta_priorities_;
   WiFiAP selected_ap_;
   bool fast_connect_{false};
+  bool fast_connect_reuse_ip_{false};
+  /// Whether selected_ap_ carries a saved IP configuration instead of using DHCP.
+  bool reusing_ip_{false};
+  uint8_t ip_reuses_{0};
   bool retry_hidden_{false};
 
   bool has_ap_{false};
@@ -393,6 +411,8 @@ class WiFiComponent : public Component {
   uint32_t action_started_;
   uint8_t num_retried_{0};
   uint32_t last_connected_{0};
+  uint32_t connect_started_{0};
+  uint32_t connect_duration_{0};
   uint32_t reboot_timeout_{};
   uint32_t ap_timeout_{};
   WiFiPowerSaveMode power_save_{WIFI_POWER_SAVE_NONE};
@@ -572,6 +572,8 @@ void WiFiComponent::wifi_event_callback(System_Event_t *event) {
   if (event->event == EVENT_STAMODE_DISCONNECTED) {
     global_wifi_component->error_from_callback_ = true;
   }
+  // The loop may be idle while connected
+  global_wifi_component->enable_loop_soon_any_context();
 
   WiFiMockClass::_event_callback(event);
 }
@@ -693,7 +695,7 @@ void WiFiComponent::wifi_scan_done_callback_(void *arg, STATUS status) {
     WiFiScanResult res({it->bssid[0], it->bssid[1], it->bssid[2], it->bssid[3], it->bssid[4], it->bssid[5]},
                        std::string(reinterpret_cast<char *>(it->ssid), it->ssid_len), it->channel, it->rssi,
                        it->authmode != AUTH_OPEN, it->is_hidden != 0);
-    this->scan_result_.push_back(res);
+    this->add_scan_result_(std::move(res));
   }
   this->scan_done_ = true;
 }
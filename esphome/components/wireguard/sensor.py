@@ -2,13 +2,18 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor
 from esphome.const import (
+    DEVICE_CLASS_DATA_SIZE,
     DEVICE_CLASS_TIMESTAMP,
     ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_TOTAL_INCREASING,
+    UNIT_BYTES,
 )
 
 from . import CONF_WIREGUARD_ID, Wireguard
 
 CONF_LATEST_HANDSHAKE = "latest_handshake"
+CONF_BYTES_RECEIVED = "bytes_received"
+CONF_BYTES_SENT = "bytes_sent"
 
 DEPENDENCIES = ["wireguard"]
 
@@ -18,6 +23,20 @@ CONFIG_SCHEMA = {
         device_class=DEVICE_CLASS_TIMESTAMP,
         entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
     ),
+    cv.Optional(CONF_BYTES_RECEIVED): sensor.sensor_schema(
+        unit_of_measurement=UNIT_BYTES,
+        accuracy_decimals=0,
+        device_class=DEVICE_CLASS_DATA_SIZE,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_BYTES_SENT): sensor.sensor_schema(
+        unit_of_measurement=UNIT_BYTES,
+        accuracy_decimals=0,
+        device_class=DEVICE_CLASS_DATA_SIZE,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
 }
 
 
@@ -27,3 +46,11 @@ async def to_code(config):
     if latest_handshake_config := config.get(CONF_LATEST_HANDSHAKE):
         sens = await sensor.new_sensor(latest_handshake_config)
         cg.add(parent.set_handshake_sensor(sens))
+
+    if bytes_received_config := config.get(CONF_BYTES_RECEIVED):
+        sens = await sensor.new_sensor(bytes_received_config)
+        cg.add(parent.set_bytes_received_sensor(sens))
+
+    if bytes_sent_config := config.get(CONF_BYTES_SENT):
+        sens = await sensor.new_sensor(bytes_sent_config)
+        cg.add(parent.set_bytes_sent_sensor(sens))
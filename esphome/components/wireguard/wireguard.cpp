@@ -11,6 +11,7 @@
 
 #include <esp_wireguard.h>
 #include <esp_wireguard_err.h>
+#include <lwip/pbuf.h>
 
 namespace esphome {
 namespace wireguard {
@@ -26,8 +27,12 @@ static const char *const TAG = "wireguard";
 static const char *const LOGMSG_ONLINE = "online";
 static const char *const LOGMSG_OFFLINE = "offline";
 
+/// How often the local network connection is checked while the tunnel is up.
+static const uint32_t NETWORK_CHECK_INTERVAL_MS = 1000;
+
 void Wireguard::setup() {
   ESP_LOGD(TAG, "initializing WireGuard...");
+  global_wireguard = this;
 
   this->wg_config_.address = this->address_.c_str();
   this->wg_config_.private_key = this->private_key_.c_str();
@@ -49,6 +54,7 @@ void Wireguard::setup() {
     this->wg_peer_offline_time_ = millis();
     this->srctime_->add_on_time_sync_callback(std::bind(&Wireguard::start_connection_, this));
     this->defer(std::bind(&Wireguard::start_connection_, this));  // defer to avoid blocking setup
+    this->set_interval("network", NETWORK_CHECK_INTERVAL_MS, std::bind(&Wireguard::check_network_, this));
 
 #ifdef USE_TEXT_SENSOR
     if (this->address_sensor_ != nullptr) {
@@ -61,7 +67,7 @@ void Wireguard::setup() {
   }
 }
 
-void Wireguard::loop() {
+void Wireguard::check_network_() {
   if (!this->enabled_) {
     return;
   }
@@ -125,6 +131,12 @@ void Wireguard::update() {
   if (this->handshake_sensor_ != nullptr && lhs_updated) {
     this->handshake_sensor_->publish_state((double) this->latest_saved_handshake_);
   }
+  if (this->bytes_received_sensor_ != nullptr) {
+    this->bytes_received_sensor_->publish_state(this->bytes_received_);
+  }
+  if (this->bytes_sent_sensor_ != nullptr) {
+    this->bytes_sent_sensor_->publish_state(this->bytes_sent_);
+  }
 #endif
 }
 
@@ -191,6 +203,8 @@ void Wireguard::set_enabled_sensor(binary_sensor::BinarySensor *sensor) { this->
 
 #ifdef USE_SENSOR
 void Wireguard::set_handshake_sensor(sensor::Sensor *sensor) { this->handshake_sensor_ = sensor; }
+void Wireguard::set_bytes_received_sensor(sensor::Sensor *sensor) { this->bytes_received_sensor_ = sensor; }
+void Wireguard::set_bytes_sent_sensor(sensor::Sensor *sensor) { this->bytes_sent_sensor_ = sensor; }
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -253,6 +267,7 @@ void Wireguard::start_connection_() {
 
   if (this->wg_connected_ == ESP_OK) {
     ESP_LOGI(TAG, "WireGuard connection started");
+    this->hook_netif_();
   } else if (this->wg_connected_ == ESP_ERR_RETRY) {
     ESP_LOGD(TAG, "WireGuard is waiting for endpoint IP address to be available");
     return;
@@ -285,6 +300,31 @@ void Wireguard::stop_connection_() {
   }
 }
 
+void Wireguard::hook_netif_() {
+  struct netif *netif = this->wg_ctx_.netif;
+  if (netif == nullptr || netif->input == &Wireguard::count_input)
+    return;
+  this->netif_input_ = netif->input;
+  this->netif_output_ = netif->output;
+  netif->input = &Wireguard::count_input;
+  netif->output = &Wireguard::count_output;
+}
+
+err_t Wireguard::count_input(struct pbuf *p, struct netif *netif) {
+  // Counted before, the input function takes over the buffer
+  global_wireguard->bytes_received_ += p->tot_len;
+  return global_wireguard->netif_input_(p, netif);
+}
+
+err_t Wireguard::count_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr) {
+  err_t err = global_wireguard->netif_output_(netif, p, ipaddr);
+  if (err == ERR_OK)
+    global_wireguard->bytes_sent_ += p->tot_len;
+  return err;
+}
+
+Wireguard *global_wireguard = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 std::string mask_key(const std::string &key) { return (key.substr(0, 5) + "[...]="); }
 
 }  // namespace wireguard
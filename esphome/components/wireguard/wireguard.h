@@ -21,6 +21,7 @@
 #endif
 
 #include <esp_wireguard.h>
+#include <lwip/netif.h>
 
 namespace esphome {
 namespace wireguard {
@@ -29,7 +30,6 @@ namespace wireguard {
 class Wireguard : public PollingComponent {
  public:
   void setup() override;
-  void loop() override;
   void update() override;
   void dump_config() override;
   void on_shutdown() override;
@@ -58,6 +58,8 @@ class Wireguard : public PollingComponent {
 
 #ifdef USE_SENSOR
   void set_handshake_sensor(sensor::Sensor *sensor);
+  void set_bytes_received_sensor(sensor::Sensor *sensor);
+  void set_bytes_sent_sensor(sensor::Sensor *sensor);
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -82,6 +84,10 @@ class Wireguard : public PollingComponent {
   bool is_peer_up() const;
   time_t get_latest_handshake() const;
 
+  /// Bytes received from and sent to the peer through the tunnel, without the WireGuard overhead.
+  uint32_t get_bytes_received() const { return this->bytes_received_; }
+  uint32_t get_bytes_sent() const { return this->bytes_sent_; }
+
  protected:
   std::string address_;
   std::string netmask_;
@@ -105,6 +111,8 @@ class Wireguard : public PollingComponent {
 
 #ifdef USE_SENSOR
   sensor::Sensor *handshake_sensor_ = nullptr;
+  sensor::Sensor *bytes_received_sensor_ = nullptr;
+  sensor::Sensor *bytes_sent_sensor_ = nullptr;
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -134,10 +142,31 @@ class Wireguard : public PollingComponent {
    */
   time_t latest_saved_handshake_ = 0;
 
+  /** \brief Traffic counters of the tunnel.
+   *
+   * esp_wireguard doesn't count the traffic, so the input and output
+   * functions of its network interface are wrapped. They are only
+   * written from the lwIP thread.
+   */
+  uint32_t bytes_received_ = 0;
+  uint32_t bytes_sent_ = 0;
+  netif_input_fn netif_input_ = nullptr;
+  netif_output_fn netif_output_ = nullptr;
+
+  static err_t count_input(struct pbuf *p, struct netif *netif);
+  static err_t count_output(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr);
+
   void start_connection_();
   void stop_connection_();
+  /// Stop the connection when the local network is gone.
+  void check_network_();
+  /// Count the traffic of the interface created by esp_wireguard_connect().
+  void hook_netif_();
 };
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+extern Wireguard *global_wireguard;
+
 // These are used for possibly long DNS resolution to temporarily suspend the watchdog
 void suspend_wdt();
 void resume_wdt();
@@ -19,6 +19,7 @@ from esphome.const import (
     CONF_AVAILABILITY,
     CONF_COMMAND_RETAIN,
     CONF_COMMAND_TOPIC,
+    CONF_CORE,
     CONF_DAY,
     CONF_DISABLED_BY_DEFAULT,
     CONF_DISCOVERY,
@@ -27,6 +28,7 @@ from esphome.const import (
     CONF_ICON,
     CONF_ID,
     CONF_INTERNAL,
+    CONF_LOOP_TASK,
     CONF_MINUTE,
     CONF_MONTH,
     CONF_NAME,
@@ -34,11 +36,13 @@ from esphome.const import (
     CONF_PATH,
     CONF_PAYLOAD_AVAILABLE,
     CONF_PAYLOAD_NOT_AVAILABLE,
+    CONF_PRIORITY,
     CONF_QOS,
     CONF_REF,
     CONF_RETAIN,
     CONF_SECOND,
     CONF_SETUP_PRIORITY,
+    CONF_STACK_SIZE,
     CONF_STATE_TOPIC,
     CONF_TOPIC,
     CONF_TYPE,
@@ -1931,6 +1935,23 @@ ENTITY_BASE_SCHEMA.add_extra(_entity_base_validator)
 
 COMPONENT_SCHEMA = Schema({Optional(CONF_SETUP_PRIORITY): float_})
 
+# For components that can run their loop() in a FreeRTOS task of its own on ESP32, see
+# Application::register_loop_task(). Only extend with this if the loop is safe to run outside the main loop.
+LOOP_TASK_SCHEMA = Schema(
+    {
+        Optional(CONF_LOOP_TASK): All(
+            only_on_esp32,
+            Schema(
+                {
+                    Optional(CONF_CORE, default=1): int_range(min=0, max=1),
+                    Optional(CONF_PRIORITY, default=1): int_range(min=1, max=24),
+                    Optional(CONF_STACK_SIZE, default=4096): int_range(min=2048),
+                }
+            ),
+        ),
+    }
+)
+
 
 def polling_component_schema(default_update_interval):
     """Validate that this component represents a PollingComponent with a configurable
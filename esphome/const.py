@@ -159,6 +159,7 @@ CONF_CONDITION_ID = "condition_id"
 CONF_CONDUCTIVITY = "conductivity"
 CONF_CONSTANT_BRIGHTNESS = "constant_brightness"
 CONF_CONTRAST = "contrast"
+CONF_CORE = "core"
 CONF_COOL_ACTION = "cool_action"
 CONF_COOL_DEADBAND = "cool_deadband"
 CONF_COOL_MODE = "cool_mode"
@@ -445,6 +446,7 @@ CONF_LOG_TOPIC = "log_topic"
 CONF_LOGGER = "logger"
 CONF_LOGS = "logs"
 CONF_LONGITUDE = "longitude"
+CONF_LOOP_TASK = "loop_task"
 CONF_LOOP_TIME = "loop_time"
 CONF_LOW = "low"
 CONF_LOW_VOLTAGE_REFERENCE = "low_voltage_reference"
@@ -793,6 +795,7 @@ CONF_SPI_ID = "spi_id"
 CONF_SPIKE_REJECTION = "spike_rejection"
 CONF_SSID = "ssid"
 CONF_SSL_FINGERPRINTS = "ssl_fingerprints"
+CONF_STACK_SIZE = "stack_size"
 CONF_STARTUP_DELAY = "startup_delay"
 CONF_STATE = "state"
 CONF_STATE_CLASS = "state_class"
@@ -7,6 +7,13 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_SOCKET_SELECT_SUPPORT
+#include "esphome/components/socket/socket.h"
+#endif
+
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 
 static const char *const TAG = "app";
@@ -27,57 +34,135 @@ void Application::register_component_(Component *comp) {
 }
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+#ifdef USE_ESP32
+  this->main_task_ = xTaskGetCurrentTaskHandle();
+#endif
+#ifdef ESPHOME_SCHEDULER_POOL_SIZE
+  this->scheduler.reserve_pool(ESPHOME_SCHEDULER_POOL_SIZE);
+#endif
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
 
-  for (uint32_t i = 0; i < this->components_.size(); i++) {
-    Component *component = this->components_[i];
+  // Components above setup_priority::WIFI don't need the network, and the network doesn't need them. They are set up
+  // as two chains, so a component that is still getting ready, like a display or the Wi-Fi association, only holds
+  // back the components after it in its own chain, while the other chain carries on.
+  struct SetupChain {
+    uint32_t begin;
+    uint32_t end;
+    uint32_t next;
+    Component *waiting_for;
+  };
+  const uint32_t network_begin = std::distance(
+      this->components_.begin(),
+      std::partition_point(this->components_.begin(), this->components_.end(), [](const Component *c) {
+        return c->get_actual_setup_priority() > setup_priority::WIFI;
+      }));
+  SetupChain chains[] = {{0, network_begin, 0, nullptr},
+                         {network_begin, static_cast<uint32_t>(this->components_.size()), network_begin, nullptr}};
 
-    component->call();
-    this->scheduler.process_to_add();
-    this->feed_wdt();
-    if (component->can_proceed())
-      continue;
+  while (true) {
+    bool waiting = false;
+    for (auto &chain : chains) {
+      while (chain.waiting_for == nullptr && chain.next < chain.end) {
+        Component *component = this->components_[chain.next++];
+
+        component->call();
+        this->scheduler.process_to_add();
+        this->feed_wdt();
+        if (component->can_proceed())
+          continue;
 
-    std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
-                     [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
+        chain.waiting_for = component;
+        // Once the local chain is all set up, it is sorted along with the network chain, as a single chain would be
+        uint32_t sort_begin = chains[0].next == chains[0].end ? 0 : chain.begin;
+        std::stable_sort(this->components_.begin() + sort_begin, this->components_.begin() + chain.next,
+                         [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
+      }
+      waiting |= chain.waiting_for != nullptr;
+    }
+    if (!waiting)
+      break;
 
-    do {
-      uint32_t new_app_state = STATUS_LED_WARNING;
-      this->scheduler.call();
-      this->feed_wdt();
-      for (uint32_t j = 0; j <= i; j++) {
+    uint32_t new_app_state = STATUS_LED_WARNING;
+    this->scheduler.call();
+    this->feed_wdt();
+    for (auto &chain : chains) {
+      for (uint32_t j = chain.begin; j < chain.next; j++) {
         this->components_[j]->call();
         new_app_state |= this->components_[j]->get_component_state();
         this->app_state_ |= new_app_state;
         this->feed_wdt();
       }
-      this->app_state_ = new_app_state;
-      yield();
-    } while (!component->can_proceed());
+    }
+    this->app_state_ = new_app_state;
+    yield();
+
+    for (auto &chain : chains) {
+      if (chain.waiting_for != nullptr && chain.waiting_for->can_proceed())
+        chain.waiting_for = nullptr;
+    }
   }
 
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+#ifdef USE_LOOP_TASKS
+  this->start_loop_tasks_();
+#endif
 }
 void Application::loop() {
   uint32_t new_app_state = 0;
 
+#ifdef USE_LOOP_PROFILER
+  const uint32_t iteration_started = micros();
+#endif
+#ifdef USE_LOOP_TASKS
+  this->run_deferred_();
+#endif
   this->scheduler.call();
+#ifdef USE_LOOP_PROFILER
+  // The scheduler as a whole competes with the component loops for the blame of a stall
+  const char *slowest_source = "scheduler";
+  uint32_t slowest_us = micros() - iteration_started;
+#endif
   this->feed_wdt();
-  for (Component *component : this->looping_components_) {
+  if (this->has_pending_enable_loop_requests_)
+    this->enable_pending_loops_();
+#ifdef USE_SOCKET_SELECT_SUPPORT
+  // answers Socket::ready() for the component loops below
+  socket::poll_ready();
+#endif
+  // Components may disable/enable their loop while we iterate, which moves them around in the list
+  this->in_loop_ = true;
+  for (this->current_loop_index_ = 0; this->current_loop_index_ < this->looping_components_active_end_;
+       this->current_loop_index_++) {
+    Component *component = this->looping_components_[this->current_loop_index_];
     {
+#ifdef USE_LOOP_PROFILER
+      const uint32_t started = micros();
+#endif
       WarnIfComponentBlockingGuard guard{component};
       component->call();
+#ifdef USE_LOOP_PROFILER
+      const uint32_t duration = micros() - started;
+      component->get_loop_stats().record_loop(duration);
+      if (duration > slowest_us) {
+        slowest_us = duration;
+        slowest_source = component->get_component_source();
+      }
+#endif
     }
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
   }
+  this->in_loop_ = false;
   this->app_state_ = new_app_state;
+#ifdef USE_LOOP_PROFILER
+  this->record_loop_iteration_(micros() - iteration_started, slowest_source, slowest_us);
+#endif
 
   const uint32_t now = millis();
 
@@ -91,7 +176,7 @@ void Application::loop() {
     // otherwise interval=0 schedules result in constant looping with almost no sleep
     next_schedule = std::max(next_schedule, delay_time / 2);
     delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    this->sleep_until_woken_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -143,13 +228,162 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+#ifdef USE_LOOP_PROFILER
+void Application::reset_loop_stats() {
+  for (auto *obj : this->components_)
+    obj->get_loop_stats().reset();
+  this->loop_iteration_stats_ = LoopIterationStats{};
+  this->scheduler.reset_lateness_stats();
+  this->loop_stats_reset_time_ = millis();
+}
+void HOT Application::record_loop_iteration_(uint32_t duration_us, const char *slowest_source, uint32_t slowest_us) {
+  LoopIterationStats &stats = this->loop_iteration_stats_;
+  stats.iteration_us.record(duration_us);
+  if (this->stall_threshold_us_ == 0 || duration_us < this->stall_threshold_us_)
+    return;
+  stats.stall_count++;
+  stats.last_stall_us = duration_us;
+  stats.last_stall_source = slowest_source;
+  stats.last_stall_source_us = slowest_us;
+  ESP_LOGW(TAG, "Loop iteration stalled for %" PRIu32 " ms, %s took %" PRIu32 " ms of it", duration_us / 1000,
+           slowest_source, slowest_us / 1000);
+}
+#endif
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
-    if (obj->has_overridden_loop())
-      this->looping_components_.push_back(obj);
+    if (!obj->has_overridden_loop())
+      continue;
+#ifdef USE_LOOP_TASKS
+    if (std::any_of(this->loop_tasks_.begin(), this->loop_tasks_.end(),
+                    [obj](const LoopTask &task) { return task.component == obj; }))
+      continue;
+#endif
+    this->looping_components_.push_back(obj);
+  }
+  // Components that disabled their loop during setup start out in the inactive part
+  auto inactive = std::stable_partition(
+      this->looping_components_.begin(), this->looping_components_.end(), [](const Component *c) {
+        return (c->get_component_state() & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE;
+      });
+  this->looping_components_active_end_ = std::distance(this->looping_components_.begin(), inactive);
+}
+void Application::disable_component_loop_(Component *component) {
+  for (uint16_t i = 0; i < this->looping_components_active_end_; i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    // Move it to the start of the inactive part, keeping the order of everything else
+    auto it = this->looping_components_.begin();
+    std::rotate(it + i, it + i + 1, it + this->looping_components_active_end_);
+    this->looping_components_active_end_--;
+    // Make sure the loop in loop() neither skips nor repeats a component (unsigned wrap-around is intended)
+    if (this->in_loop_ && i <= this->current_loop_index_)
+      this->current_loop_index_--;
+    return;
+  }
+}
+void Application::enable_component_loop_(Component *component) {
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    if (this->looping_components_[i] != component)
+      continue;
+    auto it = this->looping_components_.begin();
+    std::rotate(it + this->looping_components_active_end_, it + i, it + i + 1);
+    this->looping_components_active_end_++;
+    return;
+  }
+}
+void Application::enable_pending_loops_() {
+  this->has_pending_enable_loop_requests_ = false;
+  for (size_t i = this->looping_components_active_end_; i < this->looping_components_.size(); i++) {
+    Component *component = this->looping_components_[i];
+    if (!component->pending_enable_loop_)
+      continue;
+    component->pending_enable_loop_ = false;
+    component->enable_loop();
+  }
+}
+void Application::wake_loop_threadsafe() {
+#ifdef USE_ESP32
+  if (this->main_task_ != nullptr)
+    xTaskNotifyGive(this->main_task_);
+#endif
+}
+void IRAM_ATTR Application::wake_loop_isr_() {
+#ifdef USE_ESP32
+  if (this->main_task_ == nullptr)
+    return;
+  BaseType_t higher_priority_task_woken = pdFALSE;
+  vTaskNotifyGiveFromISR(this->main_task_, &higher_priority_task_woken);
+  portYIELD_FROM_ISR(higher_priority_task_woken);
+#endif
+}
+void Application::sleep_until_woken_(uint32_t delay_ms) {
+#ifdef USE_ESP32
+  // Like delay(), but returns early when woken by wake_loop_threadsafe() or an interrupt
+  ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(delay_ms));
+#else
+  delay(delay_ms);
+#endif
+}
+
+#ifdef USE_LOOP_TASKS
+void Application::register_loop_task(Component *component, uint8_t core, uint8_t priority, uint32_t stack_size) {
+  this->loop_tasks_.push_back({component, stack_size, core, priority});
+}
+
+static void loop_task(void *arg) {
+  auto *component = static_cast<Component *>(arg);
+  // Paced like the main loop, and always waiting at least one tick so the idle task of this core feeds the watchdog
+  const TickType_t interval = std::max<TickType_t>(pdMS_TO_TICKS(App.get_loop_interval()), 1);
+  TickType_t last_wake = xTaskGetTickCount();
+  while (true) {
+    component->call();
+    vTaskDelayUntil(&last_wake, interval);
+  }
+}
+
+void Application::start_loop_tasks_() {
+  for (auto &task : this->loop_tasks_) {
+    // Single core variants run everything on core 0
+    const BaseType_t core = std::min<BaseType_t>(task.core, portNUM_PROCESSORS - 1);
+    BaseType_t res = xTaskCreatePinnedToCore(loop_task, task.component->get_component_source(), task.stack_size,
+                                             task.component, task.priority, nullptr, core);
+    if (res != pdPASS) {
+      ESP_LOGE(TAG, "Creating the loop task of %s failed, running it on the main loop",
+               task.component->get_component_source());
+      auto &looping = this->looping_components_;
+      if ((task.component->get_component_state() & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP_DONE) {
+        looping.push_back(task.component);
+      } else {
+        looping.insert(looping.begin() + this->looping_components_active_end_++, task.component);
+      }
+      continue;
+    }
+    ESP_LOGD(TAG, "Running the loop of %s on core %d", task.component->get_component_source(), core);
   }
 }
 
+void Application::defer_to_main_loop(std::function<void()> &&f) {
+  {
+    LockGuard guard{this->deferred_lock_};
+    this->deferred_.push_back(std::move(f));
+  }
+  this->wake_loop_threadsafe();
+}
+
+void Application::run_deferred_() {
+  {
+    LockGuard guard{this->deferred_lock_};
+    if (this->deferred_.empty())
+      return;
+    std::swap(this->deferred_, this->deferred_running_);
+  }
+  for (auto &f : this->deferred_running_)
+    f();
+  this->deferred_running_.clear();
+}
+#endif
+
 Application App;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include "esphome/core/component.h"
@@ -9,6 +10,11 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -75,6 +81,20 @@
 
 namespace esphome {
 
+#ifdef USE_LOOP_PROFILER
+/// Durations of whole main loop iterations and the stalls among them, collected by Application::loop().
+struct LoopIterationStats {
+  /// Time spent in the scheduler and the component loops, without the sleep between iterations
+  LatencyHistogram iteration_us;
+  /// Iterations that took longer than the stall threshold
+  uint32_t stall_count{0};
+  uint32_t last_stall_us{0};
+  /// What took the most time in the last stalled iteration, and how long it took
+  const char *last_stall_source{nullptr};
+  uint32_t last_stall_source_us{0};
+};
+#endif
+
 class Application {
  public:
   void pre_setup(const std::string &name, const std::string &friendly_name, const std::string &area,
@@ -233,6 +253,27 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake up the main loop if it's sleeping between iterations.
+   *
+   * Safe to call from other tasks, but not from interrupt handlers (see Component::enable_loop_soon_from_isr()).
+   */
+  void wake_loop_threadsafe();
+
+#ifdef USE_LOOP_TASKS
+  /** Run the loop() of a component in a FreeRTOS task of its own, pinned to `core`, instead of in the main loop.
+   *
+   * setup() still runs on the main loop, the task only starts once all components are set up. The component then
+   * has to hand everything that reaches other components, like publishing states, to defer_to_main_loop().
+   */
+  void register_loop_task(Component *component, uint8_t core, uint8_t priority, uint32_t stack_size);
+
+  /// Run `f` on the main loop as soon as possible. Safe to call from other tasks, but not from interrupt handlers.
+  void defer_to_main_loop(std::function<void()> &&f);
+
+  /// Whether the calling code runs on the main loop, and not in a loop task or another task.
+  bool in_main_loop() const { return xTaskGetCurrentTaskHandle() == this->main_task_; }
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -243,184 +284,124 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() const { return this->components_; }
+
+#ifdef USE_LOOP_PROFILER
+  /// Clear the loop profiler statistics of all components.
+  void reset_loop_stats();
+  /// Time in ms when the loop profiler statistics were last reset (or 0 if never).
+  uint32_t get_loop_stats_reset_time() const { return this->loop_stats_reset_time_; }
+  const LoopIterationStats &get_loop_iteration_stats() const { return this->loop_iteration_stats_; }
+  /// Main loop iterations taking longer than this (in ms) are logged and counted as stalls, 0 disables that.
+  void set_stall_threshold(uint32_t stall_threshold) { this->stall_threshold_us_ = stall_threshold * 1000; }
+#endif
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->binary_sensors_, this->binary_sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->switches_, this->switches_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_BUTTON
   const std::vector<button::Button *> &get_buttons() { return this->buttons_; }
   button::Button *get_button_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->buttons_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->buttons_, this->buttons_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->sensors_, this->sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->text_sensors_, this->text_sensors_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::Fan *> &get_fans() { return this->fans_; }
   fan::Fan *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->fans_, this->fans_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->covers_, this->covers_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->lights_, this->lights_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->climates_, this->climates_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_NUMBER
   const std::vector<number::Number *> &get_numbers() { return this->numbers_; }
   number::Number *get_number_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->numbers_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->numbers_, this->numbers_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_DATE
   const std::vector<datetime::DateEntity *> &get_dates() { return this->dates_; }
   datetime::DateEntity *get_date_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->dates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->dates_, this->dates_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_TIME
   const std::vector<datetime::TimeEntity *> &get_times() { return this->times_; }
   datetime::TimeEntity *get_time_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->times_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->times_, this->times_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_DATETIME_DATETIME
   const std::vector<datetime::DateTimeEntity *> &get_datetimes() { return this->datetimes_; }
   datetime::DateTimeEntity *get_datetime_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->datetimes_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->datetimes_, this->datetimes_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT
   const std::vector<text::Text *> &get_texts() { return this->texts_; }
   text::Text *get_text_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->texts_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->texts_, this->texts_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_SELECT
   const std::vector<select::Select *> &get_selects() { return this->selects_; }
   select::Select *get_select_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->selects_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->selects_, this->selects_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_LOCK
   const std::vector<lock::Lock *> &get_locks() { return this->locks_; }
   lock::Lock *get_lock_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->locks_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->locks_, this->locks_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_VALVE
   const std::vector<valve::Valve *> &get_valves() { return this->valves_; }
   valve::Valve *get_valve_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->valves_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->valves_, this->valves_by_key_, key, include_internal);
   }
 #endif
 #ifdef USE_MEDIA_PLAYER
   const std::vector<media_player::MediaPlayer *> &get_media_players() { return this->media_players_; }
   media_player::MediaPlayer *get_media_player_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->media_players_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->media_players_, this->media_players_by_key_, key, include_internal);
   }
 #endif
 
@@ -429,33 +410,21 @@ class Application {
     return this->alarm_control_panels_;
   }
   alarm_control_panel::AlarmControlPanel *get_alarm_control_panel_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->alarm_control_panels_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->alarm_control_panels_, this->alarm_control_panels_by_key_, key, include_internal);
   }
 #endif
 
 #ifdef USE_EVENT
   const std::vector<event::Event *> &get_events() { return this->events_; }
   event::Event *get_event_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->events_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->events_, this->events_by_key_, key, include_internal);
   }
 #endif
 
 #ifdef USE_UPDATE
   const std::vector<update::UpdateEntity *> &get_updates() { return this->updates_; }
   update::UpdateEntity *get_update_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->updates_) {
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    }
-    return nullptr;
+    return this->get_entity_by_key_(this->updates_, this->updates_by_key_, key, include_internal);
   }
 #endif
 
@@ -467,74 +436,148 @@ class Application {
   void register_component_(Component *comp);
 
   void calculate_looping_components_();
+#ifdef USE_LOOP_TASKS
+  void start_loop_tasks_();
+  void run_deferred_();
+#endif
+#ifdef USE_LOOP_PROFILER
+  void record_loop_iteration_(uint32_t duration_us, const char *slowest_source, uint32_t slowest_us);
+#endif
+  void disable_component_loop_(Component *component);
+  void enable_component_loop_(Component *component);
+  void enable_pending_loops_();
+  void wake_loop_isr_();
+  void sleep_until_woken_(uint32_t delay_ms);
 
   void feed_wdt_arch_();
 
+  /// Find an entity by its key with a binary search. The index sorted by key is built on the first lookup, and again
+  /// whenever entities were registered since.
+  template<typename T>
+  static T *get_entity_by_key_(const std::vector<T *> &entities, std::vector<T *> &index, uint32_t key,
+                               bool include_internal) {
+    if (index.size() != entities.size()) {
+      index = entities;
+      std::sort(index.begin(), index.end(),
+                [](T *a, T *b) { return a->get_object_id_hash() < b->get_object_id_hash(); });
+    }
+    auto it = std::lower_bound(index.begin(), index.end(), key,
+                               [](T *obj, uint32_t value) { return obj->get_object_id_hash() < value; });
+    // Entities of the same domain may share a key
+    for (; it != index.end() && (*it)->get_object_id_hash() == key; ++it) {
+      if (include_internal || !(*it)->is_internal())
+        return *it;
+    }
+    return nullptr;
+  }
+
   std::vector<Component *> components_{};
+  /// Components with an overridden loop(); the first `looping_components_active_end_` have their loop enabled.
   std::vector<Component *> looping_components_{};
+  uint16_t looping_components_active_end_{0};
+  uint16_t current_loop_index_{0};
+  bool in_loop_{false};
+  volatile bool has_pending_enable_loop_requests_{false};
+#ifdef USE_ESP32
+  TaskHandle_t main_task_{nullptr};
+#endif
+#ifdef USE_LOOP_TASKS
+  struct LoopTask {
+    Component *component;
+    uint32_t stack_size;
+    uint8_t core;
+    uint8_t priority;
+  };
+  std::vector<LoopTask> loop_tasks_{};
+  Mutex deferred_lock_;
+  /// Filled by defer_to_main_loop(), swapped with `deferred_running_` to run, so both keep their capacity
+  std::vector<std::function<void()>> deferred_{};
+  std::vector<std::function<void()>> deferred_running_{};
+#endif
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  std::vector<binary_sensor::BinarySensor *> binary_sensors_by_key_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  std::vector<switch_::Switch *> switches_by_key_{};
 #endif
 #ifdef USE_BUTTON
   std::vector<button::Button *> buttons_{};
+  std::vector<button::Button *> buttons_by_key_{};
 #endif
 #ifdef USE_EVENT
   std::vector<event::Event *> events_{};
+  std::vector<event::Event *> events_by_key_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  std::vector<sensor::Sensor *> sensors_by_key_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  std::vector<text_sensor::TextSensor *> text_sensors_by_key_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::Fan *> fans_{};
+  std::vector<fan::Fan *> fans_by_key_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  std::vector<cover::Cover *> covers_by_key_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  std::vector<climate::Climate *> climates_by_key_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  std::vector<light::LightState *> lights_by_key_{};
 #endif
 #ifdef USE_NUMBER
   std::vector<number::Number *> numbers_{};
+  std::vector<number::Number *> numbers_by_key_{};
 #endif
 #ifdef USE_DATETIME_DATE
   std::vector<datetime::DateEntity *> dates_{};
+  std::vector<datetime::DateEntity *> dates_by_key_{};
 #endif
 #ifdef USE_DATETIME_TIME
   std::vector<datetime::TimeEntity *> times_{};
+  std::vector<datetime::TimeEntity *> times_by_key_{};
 #endif
 #ifdef USE_DATETIME_DATETIME
   std::vector<datetime::DateTimeEntity *> datetimes_{};
+  std::vector<datetime::DateTimeEntity *> datetimes_by_key_{};
 #endif
 #ifdef USE_SELECT
   std::vector<select::Select *> selects_{};
+  std::vector<select::Select *> selects_by_key_{};
 #endif
 #ifdef USE_TEXT
   std::vector<text::Text *> texts_{};
+  std::vector<text::Text *> texts_by_key_{};
 #endif
 #ifdef USE_LOCK
   std::vector<lock::Lock *> locks_{};
+  std::vector<lock::Lock *> locks_by_key_{};
 #endif
 #ifdef USE_VALVE
   std::vector<valve::Valve *> valves_{};
+  std::vector<valve::Valve *> valves_by_key_{};
 #endif
 #ifdef USE_MEDIA_PLAYER
   std::vector<media_player::MediaPlayer *> media_players_{};
+  std::vector<media_player::MediaPlayer *> media_players_by_key_{};
 #endif
 #ifdef USE_ALARM_CONTROL_PANEL
   std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_{};
+  std::vector<alarm_control_panel::AlarmControlPanel *> alarm_control_panels_by_key_{};
 #endif
 #ifdef USE_UPDATE
   std::vector<update::UpdateEntity *> updates_{};
+  std::vector<update::UpdateEntity *> updates_by_key_{};
 #endif
 
   std::string name_;
@@ -547,6 +590,11 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+#ifdef USE_LOOP_PROFILER
+  uint32_t loop_stats_reset_time_{0};
+  uint32_t stall_threshold_us_{0};
+  LoopIterationStats loop_iteration_stats_;
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
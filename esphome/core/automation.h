@@ -198,37 +198,71 @@ template<typename... Ts> class ActionList {
       this->add_action(action);
     }
   }
+  /** Play the actions in a single loop, instead of passing the arguments along the chain of actions.
+   *
+   * Only valid if every action finishes within its play(), i.e. the list contains no delay, wait_until or other
+   * action that continues the chain later. Every action then costs a single virtual call.
+   */
+  void set_synchronous(bool synchronous) { this->synchronous_ = synchronous; }
   void play(Ts... x) {
-    if (this->actions_begin_ != nullptr)
+    if (this->synchronous_) {
+      this->play_synchronous_(x...);
+    } else if (this->actions_begin_ != nullptr) {
       this->actions_begin_->play_complex(x...);
+    }
   }
   void play_tuple(const std::tuple<Ts...> &tuple) { this->play_tuple_(tuple, typename gens<sizeof...(Ts)>::type()); }
   void stop() {
-    if (this->actions_begin_ != nullptr)
+    if (this->synchronous_) {
+      this->num_playing_ = 0;
+      this->stops_++;
+    } else if (this->actions_begin_ != nullptr) {
       this->actions_begin_->stop_complex();
+    }
   }
   bool empty() const { return this->actions_begin_ == nullptr; }
 
   /// Check if any action in this action list is currently running.
   bool is_running() {
+    if (this->synchronous_)
+      return this->num_playing_ > 0;
     if (this->actions_begin_ == nullptr)
       return false;
     return this->actions_begin_->is_running();
   }
   /// Return the number of actions in this action list that are currently running.
   int num_running() {
+    if (this->synchronous_)
+      return this->num_playing_;
     if (this->actions_begin_ == nullptr)
       return 0;
     return this->actions_begin_->num_running_total();
   }
 
  protected:
+  void play_synchronous_(Ts... x) {
+    const uint32_t stops = this->stops_;
+    this->num_playing_++;
+    for (auto *action = this->actions_begin_; action != nullptr; action = action->next_) {
+      action->play(x...);
+      // Like the chain, skip the rest once an action stopped this list, e.g. a script stopping itself
+      if (this->stops_ != stops)
+        return;
+    }
+    this->num_playing_--;
+  }
+
   template<int... S> void play_tuple_(const std::tuple<Ts...> &tuple, seq<S...> /*unused*/) {
     this->play(std::get<S>(tuple)...);
   }
 
   Action<Ts...> *actions_begin_{nullptr};
   Action<Ts...> *actions_end_{nullptr};
+  bool synchronous_{false};
+  /// Plays in progress, only counted for synchronous lists
+  int num_playing_{0};
+  /// Incremented by stop(), so a synchronous play notices it was stopped
+  uint32_t stops_{0};
 };
 
 template<typename... Ts> class Automation {
@@ -237,6 +271,8 @@ template<typename... Ts> class Automation {
 
   void add_action(Action<Ts...> *action) { this->actions_.add_action(action); }
   void add_actions(const std::vector<Action<Ts...> *> &actions) { this->actions_.add_actions(actions); }
+  /// See ActionList::set_synchronous(), set by the code generator when no action continues asynchronously.
+  void set_synchronous(bool synchronous) { this->actions_.set_synchronous(synchronous); }
 
   void stop() { this->actions_.stop(); }
 
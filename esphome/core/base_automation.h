@@ -155,16 +155,39 @@ template<typename... Ts> class DelayAction : public Action<Ts...>, public Compon
   TEMPLATABLE_VALUE(uint32_t, delay)
 
   void play_complex(Ts... x) override {
-    auto f = std::bind(&DelayAction<Ts...>::play_next_, this, x...);
+    // Park the arguments in a free slot, so the timeout only captures the slot index and fits std::function's
+    // local storage. The slots grow to the maximum number of concurrent runs once and are reused after that.
+    size_t index = 0;
+    while (index < this->runs_.size() && this->runs_[index].used)
+      index++;
+    if (index == this->runs_.size())
+      this->runs_.emplace_back();
+    this->runs_[index].args = std::make_tuple(x...);
+    this->runs_[index].used = true;
     this->num_running_++;
-    this->set_timeout(this->delay_.value(x...), f);
+    this->set_timeout(this->delay_.value(x...), [this, index]() {
+      auto &run = this->runs_[index];
+      run.used = false;
+      this->play_next_tuple_(run.args);
+    });
   }
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
 
   void play(Ts... x) override { /* ignore - see play_complex */
   }
 
-  void stop() override { this->cancel_timeout(""); }
+  void stop() override {
+    this->cancel_timeout("");
+    for (auto &run : this->runs_)
+      run.used = false;
+  }
+
+ protected:
+  struct Run {
+    std::tuple<Ts...> args;
+    bool used{false};
+  };
+  std::vector<Run> runs_;
 };
 
 template<typename... Ts> class LambdaAction : public Action<Ts...> {
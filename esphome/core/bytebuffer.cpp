@@ -7,6 +7,34 @@
 
 namespace esphome {
 
+ByteBuffer &ByteBuffer::operator=(const ByteBuffer &other) {
+  if (this != &other) {
+    ByteBufferBase::operator=(other);
+    this->storage_ = other.storage_;
+    this->data_ = this->storage_.data();
+  }
+  return *this;
+}
+
+ByteBuffer &ByteBuffer::operator=(ByteBuffer &&other) noexcept {
+  if (this != &other) {
+    ByteBufferBase::operator=(other);
+    this->storage_ = std::move(other.storage_);
+    this->data_ = this->storage_.data();
+    other.detach_();
+  }
+  return *this;
+}
+
+void ByteBuffer::detach_() {
+  this->storage_.clear();
+  this->data_ = this->storage_.data();
+  this->capacity_ = 0;
+  this->position_ = 0;
+  this->mark_ = 0;
+  this->limit_ = 0;
+}
+
 ByteBuffer ByteBuffer::wrap(const uint8_t *ptr, size_t len, Endian endianness) {
   // there is a double copy happening here, could be optimized but at cost of clarity.
   std::vector<uint8_t> data(ptr, ptr + len);
@@ -63,29 +91,29 @@ ByteBuffer ByteBuffer::wrap(double value, Endian endianness) {
   return buffer;
 }
 
-void ByteBuffer::set_limit(size_t limit) {
+void ByteBufferBase::set_limit(size_t limit) {
   assert(limit <= this->get_capacity());
   this->limit_ = limit;
 }
-void ByteBuffer::set_position(size_t position) {
+void ByteBufferBase::set_position(size_t position) {
   assert(position <= this->get_limit());
   this->position_ = position;
 }
-void ByteBuffer::clear() {
+void ByteBufferBase::clear() {
   this->limit_ = this->get_capacity();
   this->position_ = 0;
 }
-void ByteBuffer::flip() {
+void ByteBufferBase::flip() {
   this->limit_ = this->position_;
   this->position_ = 0;
 }
 
 /// Getters
-uint8_t ByteBuffer::get_uint8() {
+uint8_t ByteBufferBase::get_uint8() {
   assert(this->get_remaining() >= 1);
   return this->data_[this->position_++];
 }
-uint64_t ByteBuffer::get_uint(size_t length) {
+uint64_t ByteBufferBase::get_uint(size_t length) {
   assert(this->get_remaining() >= length);
   uint64_t value = 0;
   if (this->endianness_ == LITTLE) {
@@ -104,37 +132,42 @@ uint64_t ByteBuffer::get_uint(size_t length) {
   return value;
 }
 
-uint32_t ByteBuffer::get_int24() {
+uint32_t ByteBufferBase::get_int24() {
   auto value = this->get_uint24();
   uint32_t mask = (~static_cast<uint32_t>(0)) << 23;
   if ((value & mask) != 0)
     value |= mask;
   return value;
 }
-float ByteBuffer::get_float() {
+float ByteBufferBase::get_float() {
   assert(this->get_remaining() >= sizeof(float));
   return bit_cast<float>(this->get_uint32());
 }
-double ByteBuffer::get_double() {
+double ByteBufferBase::get_double() {
   assert(this->get_remaining() >= sizeof(double));
   return bit_cast<double>(this->get_uint64());
 }
 
-std::vector<uint8_t> ByteBuffer::get_vector(size_t length) {
+std::vector<uint8_t> ByteBufferBase::get_vector(size_t length) {
   assert(this->get_remaining() >= length);
-  auto start = this->data_.begin() + this->position_;
+  auto start = this->data_ + this->position_;
   this->position_ += length;
   return {start, start + length};
 }
+void ByteBufferBase::get_bytes(uint8_t *data, size_t length) {
+  assert(this->get_remaining() >= length);
+  std::copy(this->data_ + this->position_, this->data_ + this->position_ + length, data);
+  this->position_ += length;
+}
 
 /// Putters
-void ByteBuffer::put_uint8(uint8_t value) {
-  assert(this->get_remaining() >= 1);
+void ByteBufferBase::put_uint8(uint8_t value) {
+  assert(!this->read_only_ && this->get_remaining() >= 1);
   this->data_[this->position_++] = value;
 }
 
-void ByteBuffer::put_uint(uint64_t value, size_t length) {
-  assert(this->get_remaining() >= length);
+void ByteBufferBase::put_uint(uint64_t value, size_t length) {
+  assert(!this->read_only_ && this->get_remaining() >= length);
   if (this->endianness_ == LITTLE) {
     while (length-- != 0) {
       this->data_[this->position_++] = static_cast<uint8_t>(value);
@@ -149,19 +182,19 @@ void ByteBuffer::put_uint(uint64_t value, size_t length) {
     }
   }
 }
-void ByteBuffer::put_float(float value) {
+void ByteBufferBase::put_float(float value) {
   static_assert(sizeof(float) == sizeof(uint32_t), "Float sizes other than 32 bit not supported");
   assert(this->get_remaining() >= sizeof(float));
   this->put_uint32(bit_cast<uint32_t>(value));
 }
-void ByteBuffer::put_double(double value) {
+void ByteBufferBase::put_double(double value) {
   static_assert(sizeof(double) == sizeof(uint64_t), "Double sizes other than 64 bit not supported");
   assert(this->get_remaining() >= sizeof(double));
   this->put_uint64(bit_cast<uint64_t>(value));
 }
-void ByteBuffer::put_vector(const std::vector<uint8_t> &value) {
-  assert(this->get_remaining() >= value.size());
-  std::copy(value.begin(), value.end(), this->data_.begin() + this->position_);
-  this->position_ += value.size();
+void ByteBufferBase::put_bytes(const uint8_t *data, size_t length) {
+  assert(!this->read_only_ && this->get_remaining() >= length);
+  std::copy(data, data + length, this->data_ + this->position_);
+  this->position_ += length;
 }
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 #include <cinttypes>
@@ -10,8 +11,8 @@ namespace esphome {
 enum Endian { LITTLE, BIG };
 
 /**
- * A class modelled on the Java ByteBuffer class. It wraps a vector of bytes and permits putting and getting
- * items of various sizes, with an automatically incremented position.
+ * A class modelled on the Java ByteBuffer class. It permits putting and getting items of various sizes into a block
+ * of bytes, with an automatically incremented position.
  *
  * There are three variables maintained pointing into the buffer:
  *
@@ -29,43 +30,13 @@ enum Endian { LITTLE, BIG };
  * The flip() operation will reset the position to 0 and limit to the current position. This is useful for reading
  * data from a buffer after it has been written.
  *
+ * This base class holds the get/put API, the storage is up to the subclass:
+ * - ByteBuffer owns a vector on the heap.
+ * - ByteBufferView works on memory owned by someone else and never allocates, for parsing packets in place.
+ * - StaticByteBuffer<N> holds N bytes inline, for building packets on the stack.
  */
-class ByteBuffer {
+class ByteBufferBase {
  public:
-  // Default constructor (compatibility with TEMPLATABLE_VALUE)
-  ByteBuffer() : ByteBuffer(std::vector<uint8_t>()) {}
-  /**
-   * Create a new Bytebuffer with the given capacity
-   */
-  ByteBuffer(size_t capacity, Endian endianness = LITTLE)
-      : data_(std::vector<uint8_t>(capacity)), endianness_(endianness), limit_(capacity){};
-  /**
-   * Wrap an existing vector in a ByteBufffer
-   */
-  static ByteBuffer wrap(std::vector<uint8_t> const &data, Endian endianness = LITTLE);
-  /**
-   * Wrap an existing array in a ByteBuffer. Note that this will create a copy of the data.
-   */
-  static ByteBuffer wrap(const uint8_t *ptr, size_t len, Endian endianness = LITTLE);
-  // Convenience functions to create a ByteBuffer from a value
-  static ByteBuffer wrap(uint8_t value);
-  static ByteBuffer wrap(uint16_t value, Endian endianness = LITTLE);
-  static ByteBuffer wrap(uint32_t value, Endian endianness = LITTLE);
-  static ByteBuffer wrap(uint64_t value, Endian endianness = LITTLE);
-  static ByteBuffer wrap(int8_t value) { return wrap(static_cast<uint8_t>(value)); }
-  static ByteBuffer wrap(int16_t value, Endian endianness = LITTLE) {
-    return wrap(static_cast<uint16_t>(value), endianness);
-  }
-  static ByteBuffer wrap(int32_t value, Endian endianness = LITTLE) {
-    return wrap(static_cast<uint32_t>(value), endianness);
-  }
-  static ByteBuffer wrap(int64_t value, Endian endianness = LITTLE) {
-    return wrap(static_cast<uint64_t>(value), endianness);
-  }
-  static ByteBuffer wrap(float value, Endian endianness = LITTLE);
-  static ByteBuffer wrap(double value, Endian endianness = LITTLE);
-  static ByteBuffer wrap(bool value) { return wrap(static_cast<uint8_t>(value)); }
-
   // Get an integral value from the buffer, increment position by length
   uint64_t get_uint(size_t length);
   // Get one byte from the buffer, increment position by 1
@@ -92,6 +63,8 @@ class ByteBuffer {
   bool get_bool() { return this->get_uint8(); }
   // Get vector of bytes, increment by length
   std::vector<uint8_t> get_vector(size_t length);
+  // Copy length bytes to data without allocating, increment by length
+  void get_bytes(uint8_t *data, size_t length);
 
   // Put values into the buffer, increment the position accordingly
   // put any integral value, length represents the number of bytes
@@ -111,9 +84,10 @@ class ByteBuffer {
   void put_float(float value);
   void put_double(double value);
   void put_bool(bool value) { this->put_uint8(value); }
-  void put_vector(const std::vector<uint8_t> &value);
+  void put_vector(const std::vector<uint8_t> &value) { this->put_bytes(value.data(), value.size()); }
+  void put_bytes(const uint8_t *data, size_t length);
 
-  inline size_t get_capacity() const { return this->data_.size(); }
+  inline size_t get_capacity() const { return this->capacity_; }
   inline size_t get_position() const { return this->position_; }
   inline size_t get_limit() const { return this->limit_; }
   inline size_t get_remaining() const { return this->get_limit() - this->get_position(); }
@@ -127,18 +101,129 @@ class ByteBuffer {
   void clear();
   // set limit to current position, postition to zero. Used when swapping from write to read operations.
   void flip();
-  // retrieve a pointer to the underlying data.
-  std::vector<uint8_t> get_data() { return this->data_; };
+  // retrieve a pointer to the start of the data, valid as long as the storage is.
+  const uint8_t *data() const { return this->data_; }
   void rewind() { this->position_ = 0; }
   void reset() { this->position_ = this->mark_; }
 
  protected:
-  ByteBuffer(std::vector<uint8_t> const &data) : data_(data), limit_(data.size()) {}
-  std::vector<uint8_t> data_;
+  ByteBufferBase(uint8_t *data, size_t capacity, Endian endianness)
+      : data_(data), capacity_(capacity), endianness_(endianness), limit_(capacity) {}
+  ByteBufferBase(const ByteBufferBase &) = default;
+  ByteBufferBase &operator=(const ByteBufferBase &) = default;
+  ~ByteBufferBase() = default;
+
+  uint8_t *data_;
+  size_t capacity_;
   Endian endianness_{LITTLE};
   size_t position_{0};
   size_t mark_{0};
   size_t limit_{0};
+  // Set for views of const data, puts are not allowed then
+  bool read_only_{false};
+};
+
+/**
+ * A ByteBuffer that owns its data in a vector.
+ */
+class ByteBuffer : public ByteBufferBase {
+ public:
+  // Default constructor (compatibility with TEMPLATABLE_VALUE)
+  ByteBuffer() : ByteBuffer(std::vector<uint8_t>()) {}
+  /**
+   * Create a new Bytebuffer with the given capacity
+   */
+  ByteBuffer(size_t capacity, Endian endianness = LITTLE)
+      : ByteBufferBase(nullptr, capacity, endianness), storage_(capacity) {
+    this->data_ = this->storage_.data();
+  }
+  ByteBuffer(const ByteBuffer &other) : ByteBufferBase(other), storage_(other.storage_) {
+    this->data_ = this->storage_.data();
+  }
+  ByteBuffer(ByteBuffer &&other) noexcept : ByteBufferBase(other), storage_(std::move(other.storage_)) {
+    this->data_ = this->storage_.data();
+    other.detach_();
+  }
+  ByteBuffer &operator=(const ByteBuffer &other);
+  ByteBuffer &operator=(ByteBuffer &&other) noexcept;
+  /**
+   * Wrap an existing vector in a ByteBufffer
+   */
+  static ByteBuffer wrap(std::vector<uint8_t> const &data, Endian endianness = LITTLE);
+  /**
+   * Wrap an existing array in a ByteBuffer. Note that this will create a copy of the data, use a ByteBufferView to
+   * avoid that.
+   */
+  static ByteBuffer wrap(const uint8_t *ptr, size_t len, Endian endianness = LITTLE);
+  // Convenience functions to create a ByteBuffer from a value
+  static ByteBuffer wrap(uint8_t value);
+  static ByteBuffer wrap(uint16_t value, Endian endianness = LITTLE);
+  static ByteBuffer wrap(uint32_t value, Endian endianness = LITTLE);
+  static ByteBuffer wrap(uint64_t value, Endian endianness = LITTLE);
+  static ByteBuffer wrap(int8_t value) { return wrap(static_cast<uint8_t>(value)); }
+  static ByteBuffer wrap(int16_t value, Endian endianness = LITTLE) {
+    return wrap(static_cast<uint16_t>(value), endianness);
+  }
+  static ByteBuffer wrap(int32_t value, Endian endianness = LITTLE) {
+    return wrap(static_cast<uint32_t>(value), endianness);
+  }
+  static ByteBuffer wrap(int64_t value, Endian endianness = LITTLE) {
+    return wrap(static_cast<uint64_t>(value), endianness);
+  }
+  static ByteBuffer wrap(float value, Endian endianness = LITTLE);
+  static ByteBuffer wrap(double value, Endian endianness = LITTLE);
+  static ByteBuffer wrap(bool value) { return wrap(static_cast<uint8_t>(value)); }
+
+  // retrieve a copy of the underlying data.
+  std::vector<uint8_t> get_data() { return this->storage_; };
+
+ protected:
+  ByteBuffer(std::vector<uint8_t> const &data) : ByteBufferBase(nullptr, data.size(), LITTLE), storage_(data) {
+    this->data_ = this->storage_.data();
+  }
+  /// Leave a moved-from buffer empty.
+  void detach_();
+
+  std::vector<uint8_t> storage_;
+};
+
+/**
+ * A ByteBuffer over memory it doesn't own, such as a received packet. It never allocates or copies, the memory has
+ * to outlive the view. A view of const data can only be read from.
+ */
+class ByteBufferView : public ByteBufferBase {
+ public:
+  ByteBufferView(uint8_t *data, size_t len, Endian endianness = LITTLE) : ByteBufferBase(data, len, endianness) {}
+  ByteBufferView(const uint8_t *data, size_t len, Endian endianness = LITTLE)
+      : ByteBufferBase(const_cast<uint8_t *>(data), len, endianness) {
+    this->read_only_ = true;
+  }
+  ByteBufferView(const std::vector<uint8_t> &data, Endian endianness = LITTLE)
+      : ByteBufferView(data.data(), data.size(), endianness) {}
+  ByteBufferView(const ByteBufferView &) = default;
+  ByteBufferView &operator=(const ByteBufferView &) = default;
+};
+
+/**
+ * A ByteBuffer with a fixed capacity of N bytes held inline, so that packets can be built on the stack without a
+ * heap allocation.
+ */
+template<size_t N> class StaticByteBuffer : public ByteBufferBase {
+ public:
+  StaticByteBuffer(Endian endianness = LITTLE) : ByteBufferBase(this->storage_, N, endianness) {}
+  StaticByteBuffer(const StaticByteBuffer &other) : ByteBufferBase(other) {
+    std::copy(other.storage_, other.storage_ + N, this->storage_);
+    this->data_ = this->storage_;
+  }
+  StaticByteBuffer &operator=(const StaticByteBuffer &other) {
+    ByteBufferBase::operator=(other);
+    std::copy(other.storage_, other.storage_ + N, this->storage_);
+    this->data_ = this->storage_;
+    return *this;
+  }
+
+ protected:
+  uint8_t storage_[N];
 };
 
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #include "esphome/core/component.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <utility>
 #include "esphome/core/application.h"
@@ -7,6 +8,16 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_HEAP_PROFILER
+#if defined(USE_ESP32)
+#include <esp_heap_caps.h>
+#elif defined(USE_ESP8266)
+#include <Esp.h>
+#elif defined(USE_RP2040) || defined(USE_LIBRETINY)
+#include <Arduino.h>
+#endif
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "component";
@@ -34,6 +45,7 @@ const uint32_t COMPONENT_STATE_CONSTRUCTION = 0x00;
 const uint32_t COMPONENT_STATE_SETUP = 0x01;
 const uint32_t COMPONENT_STATE_LOOP = 0x02;
 const uint32_t COMPONENT_STATE_FAILED = 0x03;
+const uint32_t COMPONENT_STATE_LOOP_DONE = 0x04;
 const uint32_t STATUS_LED_MASK = 0xFF00;
 const uint32_t STATUS_LED_OK = 0x0000;
 const uint32_t STATUS_LED_WARNING = 0x0100;
@@ -74,6 +86,22 @@ bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+void Component::set_interval(uint32_t id, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, id, interval, std::move(f));
+}
+
+bool Component::cancel_interval(uint32_t id) {  // NOLINT
+  return App.scheduler.cancel_interval(this, id);
+}
+
+void Component::set_timeout(uint32_t id, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, id, timeout, std::move(f));
+}
+
+bool Component::cancel_timeout(uint32_t id) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, id);
+}
+
 void Component::call_loop() { this->loop(); }
 void Component::call_setup() { this->setup(); }
 void Component::call_dump_config() {
@@ -87,25 +115,41 @@ uint32_t Component::get_component_state() const { return this->component_state_;
 void Component::call() {
   uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
   switch (state) {
-    case COMPONENT_STATE_CONSTRUCTION:
+    case COMPONENT_STATE_CONSTRUCTION: {
       // State Construction: Call setup and set state to setup
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_SETUP;
+#ifdef USE_HEAP_PROFILER
+      const uint32_t free_before = ComponentHeapStats::free_heap();
+#endif
       this->call_setup();
+#ifdef USE_HEAP_PROFILER
+      this->heap_stats_.record(true, free_before);
+#endif
       break;
+    }
     case COMPONENT_STATE_SETUP:
       // State setup: Call first loop and set state to loop
       this->component_state_ &= ~COMPONENT_STATE_MASK;
       this->component_state_ |= COMPONENT_STATE_LOOP;
-      this->call_loop();
-      break;
-    case COMPONENT_STATE_LOOP:
+      // fall through
+    case COMPONENT_STATE_LOOP: {
       // State loop: Call loop
+#ifdef USE_HEAP_PROFILER
+      const uint32_t free_before = ComponentHeapStats::free_heap();
+#endif
       this->call_loop();
+#ifdef USE_HEAP_PROFILER
+      this->heap_stats_.record(false, free_before);
+#endif
       break;
+    }
     case COMPONENT_STATE_FAILED:  // NOLINT(bugprone-branch-clone)
       // State failed: Do nothing
       break;
+    case COMPONENT_STATE_LOOP_DONE:  // NOLINT(bugprone-branch-clone)
+      // State loop done: Do nothing until enable_loop() is called
+      break;
     default:
       break;
   }
@@ -143,8 +187,36 @@ void Component::set_retry(uint32_t initial_wait_time, uint8_t max_attempts, std:
 bool Component::is_failed() const { return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_FAILED; }
 bool Component::is_ready() const {
   return (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP ||
+         (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_LOOP_DONE ||
          (this->component_state_ & COMPONENT_STATE_MASK) == COMPONENT_STATE_SETUP;
 }
+void Component::disable_loop() {
+  uint32_t state = this->component_state_ & COMPONENT_STATE_MASK;
+  if (state != COMPONENT_STATE_SETUP && state != COMPONENT_STATE_LOOP)
+    return;
+  ESP_LOGVV(TAG, "%s loop disabled", this->get_component_source());
+  this->component_state_ &= ~COMPONENT_STATE_MASK;
+  this->component_state_ |= COMPONENT_STATE_LOOP_DONE;
+  App.disable_component_loop_(this);
+}
+void Component::enable_loop() {
+  if ((this->component_state_ & COMPONENT_STATE_MASK) != COMPONENT_STATE_LOOP_DONE)
+    return;
+  ESP_LOGVV(TAG, "%s loop enabled", this->get_component_source());
+  this->component_state_ &= ~COMPONENT_STATE_MASK;
+  this->component_state_ |= COMPONENT_STATE_LOOP;
+  App.enable_component_loop_(this);
+}
+void IRAM_ATTR Component::enable_loop_soon_from_isr() {
+  this->pending_enable_loop_ = true;
+  App.has_pending_enable_loop_requests_ = true;
+  App.wake_loop_isr_();
+}
+void Component::enable_loop_soon_any_context() {
+  this->pending_enable_loop_ = true;
+  App.has_pending_enable_loop_requests_ = true;
+  App.wake_loop_threadsafe();
+}
 bool Component::can_proceed() { return true; }
 bool Component::status_has_warning() const { return this->component_state_ & STATUS_LED_WARNING; }
 bool Component::status_has_error() const { return this->component_state_ & STATUS_LED_ERROR; }
@@ -215,9 +287,38 @@ void PollingComponent::call_setup() {
   this->start_poller();
 }
 
+// Number of polling components in each update group, filled while the components are constructed
+static std::vector<std::pair<const void *, uint8_t>> update_group_sizes;  // NOLINT
+
+void PollingComponent::set_update_group(const void *group) {
+  auto it = std::find_if(update_group_sizes.begin(), update_group_sizes.end(),
+                         [group](const std::pair<const void *, uint8_t> &entry) { return entry.first == group; });
+  if (it == update_group_sizes.end()) {
+    update_group_sizes.emplace_back(group, 0);
+    it = update_group_sizes.end() - 1;
+  }
+  this->update_group_ = group;
+  this->update_group_slot_ = it->second++;
+}
+
 void PollingComponent::start_poller() {
   // Register interval.
-  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+  const uint32_t interval = this->get_update_interval();
+  if (this->update_group_ == nullptr || interval == 0 || interval == SCHEDULER_DONT_RUN) {
+    this->set_interval("update", interval, [this]() { this->update(); });
+    return;
+  }
+
+  uint8_t group_size = 1;
+  for (const auto &entry : update_group_sizes) {
+    if (entry.first == this->update_group_)
+      group_size = entry.second;
+  }
+  // Align to millis() rather than to the start of this component, so the slots of a group stay apart no matter when
+  // each member set up: this component then updates whenever millis() % interval == phase.
+  const uint32_t phase = (uint64_t) interval * this->update_group_slot_ / group_size;
+  const uint32_t offset = (millis() % interval + interval - phase) % interval;
+  App.scheduler.set_interval(this, "update", interval, [this]() { this->update(); }, offset);
 }
 
 void PollingComponent::stop_poller() {
@@ -225,9 +326,114 @@ void PollingComponent::stop_poller() {
   this->cancel_interval("update");
 }
 
+static constexpr uint32_t MEASUREMENT_TIMEOUT_ID = fnv1_hash_constexpr("measurement");
+
+void MeasuringComponent::update() {
+  // A measurement that takes longer than the update interval just skips updates
+  if (this->measuring_)
+    return;
+  this->start_measurement_();
+}
+
+void MeasuringComponent::start_measurement_() {
+  uint32_t wait = this->start_measurement();
+  if (wait == MEASUREMENT_FAILED) {
+    this->measuring_ = false;
+    return;
+  }
+  this->measuring_ = true;
+  if (wait == MEASUREMENT_BUSY) {
+    this->set_timeout(MEASUREMENT_TIMEOUT_ID, 1, [this]() { this->start_measurement_(); });
+  } else {
+    this->set_timeout(MEASUREMENT_TIMEOUT_ID, wait, [this]() { this->collect_measurement_(); });
+  }
+}
+
+void MeasuringComponent::collect_measurement_() {
+  if (this->collect_measurement()) {
+    this->measuring_ = false;
+    return;
+  }
+  this->set_timeout(MEASUREMENT_TIMEOUT_ID, 1, [this]() { this->collect_measurement_(); });
+}
+
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+#ifdef USE_LOOP_PROFILER
+static uint8_t loop_stats_bucket(uint32_t duration_us) {
+  uint8_t bucket = 0;
+  while (bucket < ComponentLoopStats::HISTOGRAM_BUCKETS - 1 && duration_us >= (1UL << bucket))
+    bucket++;
+  return bucket;
+}
+static uint32_t histogram_percentile(const uint32_t *buckets, uint8_t size, uint32_t count, uint32_t max,
+                                     float percentile) {
+  if (count == 0)
+    return 0;
+  const uint32_t target = std::ceil(count * percentile / 100.0f);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i < size; i++) {
+    seen += buckets[i];
+    if (seen >= target)
+      // Report the upper bound of the bucket, but never more than what was actually measured
+      return std::min(max, uint32_t(1UL << i));
+  }
+  return max;
+}
+void HOT LatencyHistogram::record(uint32_t value) {
+  static_assert(BUCKETS == ComponentLoopStats::HISTOGRAM_BUCKETS, "both histograms share loop_stats_bucket()");
+  this->count++;
+  this->max = std::max(this->max, value);
+  this->buckets[loop_stats_bucket(value)]++;
+}
+uint32_t LatencyHistogram::percentile(float percentile) const {
+  return histogram_percentile(this->buckets, BUCKETS, this->count, this->max, percentile);
+}
+void HOT ComponentLoopStats::record_loop(uint32_t duration_us) {
+  this->loop_count++;
+  this->loop_time_us += duration_us;
+  this->loop_max_us = std::max(this->loop_max_us, duration_us);
+  this->loop_histogram[loop_stats_bucket(duration_us)]++;
+}
+void HOT ComponentLoopStats::record_scheduler(uint32_t duration_us) {
+  this->scheduler_count++;
+  this->scheduler_time_us += duration_us;
+  this->scheduler_max_us = std::max(this->scheduler_max_us, duration_us);
+}
+uint32_t ComponentLoopStats::loop_percentile_us(float percentile) const {
+  return histogram_percentile(this->loop_histogram, HISTOGRAM_BUCKETS, this->loop_count, this->loop_max_us,
+                              percentile);
+}
+void ComponentLoopStats::reset() { *this = ComponentLoopStats{}; }
+#endif
+
+#ifdef USE_HEAP_PROFILER
+uint32_t ComponentHeapStats::free_heap() {
+#if defined(USE_ESP32)
+  return heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+#elif defined(USE_ESP8266)
+  return ESP.getFreeHeap();  // NOLINT(readability-static-accessed-through-instance)
+#elif defined(USE_RP2040)
+  return rp2040.getFreeHeap();
+#elif defined(USE_LIBRETINY)
+  return lt_heap_get_free();
+#else
+  return 0;
+#endif
+}
+void ComponentHeapStats::record(bool setup, uint32_t free_before) {
+  const int32_t taken = int32_t(free_before - free_heap());
+  if (setup) {
+    this->setup_bytes += taken;
+  } else {
+    this->loop_bytes += taken;
+  }
+  if (taken > 0)
+    this->allocating_calls++;
+}
+#endif
+
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
     : started_(millis()), component_(component) {}
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
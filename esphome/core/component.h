@@ -5,6 +5,7 @@
 #include <functional>
 #include <string>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -58,6 +59,7 @@ extern const uint32_t COMPONENT_STATE_CONSTRUCTION;
 extern const uint32_t COMPONENT_STATE_SETUP;
 extern const uint32_t COMPONENT_STATE_LOOP;
 extern const uint32_t COMPONENT_STATE_FAILED;
+extern const uint32_t COMPONENT_STATE_LOOP_DONE;
 extern const uint32_t STATUS_LED_MASK;
 extern const uint32_t STATUS_LED_OK;
 extern const uint32_t STATUS_LED_WARNING;
@@ -65,6 +67,61 @@ extern const uint32_t STATUS_LED_ERROR;
 
 enum class RetryResult { DONE, RETRY };
 
+#ifdef USE_LOOP_PROFILER
+/// Log2 histogram of durations: bucket i counts values below 2^i (the last bucket takes everything larger).
+struct LatencyHistogram {
+  static const uint8_t BUCKETS = 20;
+
+  uint32_t count{0};
+  uint32_t max{0};
+  uint32_t buckets[BUCKETS]{};
+
+  void record(uint32_t value);
+  /// Estimate the given percentile (0-100) from the histogram, in the unit of the recorded values.
+  uint32_t percentile(float percentile) const;
+};
+
+/// Timing statistics of a single component, collected by Application::loop() and Scheduler::call().
+struct ComponentLoopStats {
+  /// Bucket i counts loop() calls that took less than 2^i µs (the last bucket takes everything longer).
+  static const uint8_t HISTOGRAM_BUCKETS = 20;
+
+  uint32_t loop_count{0};
+  uint64_t loop_time_us{0};
+  uint32_t loop_max_us{0};
+  uint32_t loop_histogram[HISTOGRAM_BUCKETS]{};
+  uint32_t scheduler_count{0};
+  uint64_t scheduler_time_us{0};
+  uint32_t scheduler_max_us{0};
+
+  void record_loop(uint32_t duration_us);
+  void record_scheduler(uint32_t duration_us);
+  /// Estimate the given percentile (0-100) of loop() durations from the histogram, in µs.
+  uint32_t loop_percentile_us(float percentile) const;
+  void reset();
+};
+#endif
+
+#ifdef USE_HEAP_PROFILER
+/** Heap usage of a single component, collected around its setup(), loop() and scheduler callbacks.
+ *
+ * The bytes are the drop of the free heap over each call, so they include what other tasks allocated or freed at
+ * the same time. Over many calls that noise averages out, while a leak keeps adding up.
+ */
+struct ComponentHeapStats {
+  /// Free heap taken by setup()
+  int32_t setup_bytes{0};
+  /// Free heap taken by all loop() and scheduler callbacks since setup
+  int32_t loop_bytes{0};
+  /// Calls that ended with less free heap than they started with
+  uint32_t allocating_calls{0};
+
+  /// The free heap in bytes, as the profiler measures it.
+  static uint32_t free_heap();
+  void record(bool setup, uint32_t free_before);
+};
+#endif
+
 class Component {
  public:
   /** Where the component's initialization should happen.
@@ -142,6 +199,28 @@ class Component {
 
   bool has_overridden_loop() const;
 
+  /** Stop calling loop() for this component until it's enabled again.
+   *
+   * Components that only have work to do after an external event (data received by an interrupt, a callback from
+   * another task, ...) can use this to stay out of the main loop while idle. Timeouts and intervals keep running.
+   *
+   * This may be called from setup() and from within loop().
+   */
+  void disable_loop();
+
+  /// Resume calling loop() after disable_loop(). Must be called from the main loop task.
+  void enable_loop();
+
+  /** Resume calling loop() after disable_loop(), safe to call from an interrupt handler.
+   *
+   * The component is re-enabled at the start of the next main loop iteration, and the main loop is woken up
+   * if it's currently sleeping.
+   */
+  void enable_loop_soon_from_isr();
+
+  /// Like enable_loop_soon_from_isr(), for other tasks, such as a driver's event task.
+  void enable_loop_soon_any_context();
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -153,6 +232,13 @@ class Component {
    */
   const char *get_component_source() const;
 
+#ifdef USE_LOOP_PROFILER
+  ComponentLoopStats &get_loop_stats() { return this->loop_stats_; }
+#endif
+#ifdef USE_HEAP_PROFILER
+  ComponentHeapStats &get_heap_stats() { return this->heap_stats_; }
+#endif
+
  protected:
   friend class Application;
 
@@ -186,6 +272,17 @@ class Component {
    */
   bool cancel_interval(const std::string &name);  // NOLINT
 
+  /** Set an interval function identified by a numeric id instead of a name.
+   *
+   * Behaves like set_interval(const std::string &, uint32_t, std::function<void()> &&), but doesn't allocate or
+   * compare strings. Use fnv1_hash_constexpr() to derive the id from a name at compile time; the id and the name
+   * it was derived from can be used interchangeably.
+   */
+  void set_interval(uint32_t id, uint32_t interval, std::function<void()> &&f);  // NOLINT
+
+  /// Cancel an interval function that was set with a numeric id.
+  bool cancel_interval(uint32_t id);  // NOLINT
+
   /** Set an retry function with a unique name. Empty name means no cancelling possible.
    *
    * This will call the retry function f on the next scheduler loop. f should return RetryResult::DONE if
@@ -254,6 +351,17 @@ class Component {
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
 
+  /** Set a timeout function identified by a numeric id instead of a name.
+   *
+   * Behaves like set_timeout(const std::string &, uint32_t, std::function<void()> &&), but doesn't allocate or
+   * compare strings. Use fnv1_hash_constexpr() to derive the id from a name at compile time; the id and the name
+   * it was derived from can be used interchangeably.
+   */
+  void set_timeout(uint32_t id, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+
+  /// Cancel a timeout function that was set with a numeric id.
+  bool cancel_timeout(uint32_t id);  // NOLINT
+
   /** Defer a callback to the next loop() call.
    *
    * If name is specified and a defer() object with the same name exists, the old one is first removed.
@@ -272,6 +380,13 @@ class Component {
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+  volatile bool pending_enable_loop_{false};
+#ifdef USE_LOOP_PROFILER
+  ComponentLoopStats loop_stats_;
+#endif
+#ifdef USE_HEAP_PROFILER
+  ComponentHeapStats heap_stats_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -310,13 +425,64 @@ class PollingComponent : public Component {
   virtual uint32_t get_update_interval() const;
 
   // Start the poller, used for component.suspend
-  void start_poller();
+  virtual void start_poller();
 
   // Stop the poller, used for component.suspend
   void stop_poller();
 
+  /** Spread the updates of all polling components in the same group evenly over their update interval.
+   *
+   * Devices on a shared bus are grouped by the bus, so that components with the same update_interval don't all
+   * block the loop with bus transfers at the same time.
+   *
+   * @param group Any pointer identifying the group, usually the bus.
+   */
+  void set_update_group(const void *group);
+
  protected:
   uint32_t update_interval_;
+  const void *update_group_{nullptr};
+  uint8_t update_group_slot_{0};
+};
+
+/// Returned by MeasuringComponent::start_measurement() when no measurement was started, skipping this update
+static const uint32_t MEASUREMENT_FAILED = 4294967295UL;
+/// Returned by MeasuringComponent::start_measurement() when the hardware is busy, to try starting again shortly
+static const uint32_t MEASUREMENT_BUSY = 4294967294UL;
+
+/** A PollingComponent whose update is split into starting a measurement and collecting its result.
+ *
+ * For sensors with a conversion time: instead of blocking the loop with delay() while the conversion runs,
+ * update() starts it and collect_measurement() is called once the time returned by start_measurement() passed.
+ * Conversions of several sensors therefore overlap, and a cycle over all of them takes about as long as the slowest.
+ */
+class MeasuringComponent : public PollingComponent {
+ public:
+  MeasuringComponent() : PollingComponent(0) {}
+  explicit MeasuringComponent(uint32_t update_interval) : PollingComponent(update_interval) {}
+
+  void update() final;
+
+  /// Whether a measurement was started and its result not collected yet
+  bool is_measuring() const { return this->measuring_; }
+
+ protected:
+  /** Start a measurement.
+   *
+   * @return The time in ms until the result is expected, MEASUREMENT_BUSY or MEASUREMENT_FAILED.
+   */
+  virtual uint32_t start_measurement() = 0;
+
+  /** Collect the result of the measurement started by start_measurement() and publish it.
+   *
+   * @return false if the result isn't ready yet, to be called again after a millisecond.
+   */
+  virtual bool collect_measurement() = 0;
+
+  void start_measurement_();
+  void collect_measurement_();
+
+  bool measuring_{false};
 };
 
 class WarnIfComponentBlockingGuard {
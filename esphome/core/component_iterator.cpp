@@ -1,6 +1,10 @@
 #include "component_iterator.h"
 
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+#include <cinttypes>
 
 #ifdef USE_API
 #include "esphome/components/api/api_server.h"
@@ -9,23 +13,35 @@
 
 namespace esphome {
 
+static const char *const TAG = "component_iterator";
+
 void ComponentIterator::begin(bool include_internal) {
   this->state_ = IteratorState::BEGIN;
   this->at_ = 0;
   this->include_internal_ = include_internal;
+  this->begin_millis_ = millis();
+  this->entity_count_ = 0;
+}
+void ComponentIterator::advance(uint32_t budget_us) {
+  const uint32_t started = micros();
+  while (this->advance_once_() && micros() - started < budget_us) {
+  }
+}
+uint32_t ComponentIterator::get_duration() const {
+  return (this->is_running() ? millis() : this->end_millis_) - this->begin_millis_;
 }
-void ComponentIterator::advance() {
+bool ComponentIterator::advance_once_() {
   bool advance_platform = false;
   bool success = true;
   switch (this->state_) {
     case IteratorState::NONE:
       // not started
-      return;
+      return false;
     case IteratorState::BEGIN:
       if (this->on_begin()) {
         advance_platform = true;
       } else {
-        return;
+        return false;
       }
       break;
 #ifdef USE_BINARY_SENSOR
@@ -370,8 +386,11 @@ void ComponentIterator::advance() {
     case IteratorState::MAX:
       if (this->on_end()) {
         this->state_ = IteratorState::NONE;
+        this->end_millis_ = millis();
+        ESP_LOGV(TAG, "Iterated over %" PRIu32 " entities in %" PRIu32 " ms", this->entity_count_,
+                 this->get_duration());
       }
-      return;
+      return false;
   }
 
   if (advance_platform) {
@@ -379,7 +398,11 @@ void ComponentIterator::advance() {
     this->at_ = 0;
   } else if (success) {
     this->at_++;
+    this->entity_count_++;
+  } else {
+    return false;
   }
+  return true;
 }
 bool ComponentIterator::on_end() { return true; }
 bool ComponentIterator::on_begin() { return true; }
@@ -19,7 +19,20 @@ class UserServiceDescriptor;
 class ComponentIterator {
  public:
   void begin(bool include_internal = false);
-  void advance();
+  /** Visit entities until the time budget is used up, a callback can't handle its entity yet or all are done.
+   *
+   * At least one step is taken on every call, so with a budget of 0 a single entity is visited. The iteration resumes
+   * on the next call where it stopped.
+   *
+   * @param budget_us The time to spend at most, in microseconds. The last step may overrun it.
+   */
+  void advance(uint32_t budget_us = 0);
+  /// Whether an iteration is in progress.
+  bool is_running() const { return this->state_ != IteratorState::NONE; }
+  /// The number of entities visited by the current or the last iteration, including skipped internal ones.
+  uint32_t get_entity_count() const { return this->entity_count_; }
+  /// The time since the current iteration began, or the time the last one took, in milliseconds.
+  uint32_t get_duration() const;
   virtual bool on_begin();
 #ifdef USE_BINARY_SENSOR
   virtual bool on_binary_sensor(binary_sensor::BinarySensor *binary_sensor) = 0;
@@ -167,7 +180,15 @@ class ComponentIterator {
 #endif
     MAX,
   } state_{IteratorState::NONE};
+
+  /// Take a single step of the iteration.
+  /// @return Whether the iteration moved on, false if it is done or has to retry the same step later.
+  bool advance_once_();
+
   size_t at_{0};
+  uint32_t begin_millis_{0};
+  uint32_t end_millis_{0};
+  uint32_t entity_count_{0};
   bool include_internal_{false};
 };
 
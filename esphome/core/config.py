@@ -360,6 +360,10 @@ async def to_code(config):
 
     CORE.add_job(_add_automations, config)
 
+    # Roughly one scheduler item (update interval, timeout) per component, plus some headroom.
+    # Components are removed from component_ids once registered, so count them before that happens.
+    cg.add_define("ESPHOME_SCHEDULER_POOL_SIZE", len(CORE.component_ids) + 8)
+
     cg.add_build_flag("-fno-exceptions")
 
     # Libraries
@@ -4,6 +4,17 @@
 
 namespace esphome {
 
+void StateChangeTracker::mark(EntityBase *entity, EntityType type) {
+  this->version_++;
+  for (Record &record : this->records_) {
+    if (record.entity == entity) {
+      record.version = this->version_;
+      return;
+    }
+  }
+  this->records_.push_back(Record{entity, type, this->version_});
+}
+
 void Controller::setup_controller(bool include_internal) {
 #ifdef USE_BINARY_SENSOR
   for (auto *obj : App.get_binary_sensors()) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "esphome/core/defines.h"
+#include "esphome/core/entity_base.h"
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -65,8 +66,66 @@
 #include "esphome/components/update/update_entity.h"
 #endif
 
+#include <vector>
+
 namespace esphome {
 
+/// The class behind the entity of a StateChangeTracker record.
+enum class EntityType : uint8_t {
+  BINARY_SENSOR,
+  FAN,
+  LIGHT,
+  SENSOR,
+  SWITCH,
+  COVER,
+  TEXT_SENSOR,
+  CLIMATE,
+  NUMBER,
+  DATETIME_DATE,
+  DATETIME_TIME,
+  DATETIME_DATETIME,
+  TEXT,
+  SELECT,
+  LOCK,
+  VALVE,
+  MEDIA_PLAYER,
+  ALARM_CONTROL_PANEL,
+  UPDATE,
+};
+
+/** Remembers which entities changed, for controllers that send the latest state of each entity at once instead of
+ * every single update.
+ *
+ * The controller marks an entity in its on_*_update() method and builds the messages from the current states when
+ * it takes the records. An entity keeps a single record until then, so states published faster than they are sent
+ * are only encoded once. Each change increments the version, whether anything changed since a version is known
+ * without looking at the entities.
+ */
+class StateChangeTracker {
+ public:
+  struct Record {
+    EntityBase *entity;
+    EntityType type;
+    /// Version of the latest change of the entity
+    uint32_t version;
+  };
+
+  void mark(EntityBase *entity, EntityType type);
+  uint32_t get_version() const { return this->version_; }
+  bool has_changes() const { return !this->records_.empty(); }
+  /// Call `callback` with the record of each entity that changed since the last call, in the order of their first
+  /// changes.
+  template<typename F> void take(F &&callback) {
+    for (const Record &record : this->records_)
+      callback(record);
+    this->records_.clear();
+  }
+
+ protected:
+  std::vector<Record> records_;
+  uint32_t version_{0};
+};
+
 class Controller {
  public:
   void setup_controller(bool include_internal = false);
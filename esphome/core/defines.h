@@ -14,6 +14,9 @@
 #define ESPHOME_PROJECT_VERSION_30 "v2"
 #define ESPHOME_VARIANT "ESP32"
 
+// Sizing
+#define ESPHOME_SCHEDULER_POOL_SIZE 16  // NOLINT
+
 // Feature flags
 #define USE_ALARM_CONTROL_PANEL
 #define USE_API
@@ -34,12 +37,15 @@
 #define USE_FAN
 #define USE_GRAPH
 #define USE_GRAPHICAL_DISPLAY_MENU
+#define USE_HEAP_PROFILER
 #define USE_HOMEASSISTANT_TIME
 #define USE_HTTP_REQUEST_OTA_WATCHDOG_TIMEOUT 8000  // NOLINT
 #define USE_JSON
 #define USE_LIGHT
 #define USE_LOCK
 #define USE_LOGGER
+#define USE_LOGGER_RING_BUFFER
+#define USE_LOOP_PROFILER
 #define USE_LVGL
 #define USE_LVGL_ANIMIMG
 #define USE_LVGL_BINARY_SENSOR
@@ -56,6 +62,7 @@
 #define USE_NETWORK
 #define USE_NEXTION_TFT_UPLOAD
 #define USE_NUMBER
+#define USE_ONLINE_IMAGE_JPEG_SUPPORT
 #define USE_ONLINE_IMAGE_PNG_SUPPORT
 #define USE_OTA
 #define USE_OTA_PASSWORD
@@ -91,20 +98,29 @@
 // IDF-specific feature flags
 #ifdef USE_ESP_IDF
 #define USE_MQTT_IDF_ENQUEUE
+#define USE_WEBSERVER_IDF_ASYNC_WORKERS 2  // NOLINT
+#define USE_WEBSERVER_IDF_KEEP_ALIVE
+#define USE_WEBSERVER_IDF_LRU_PURGE
+#define USE_WEBSERVER_IDF_MAX_OPEN_SOCKETS 7  // NOLINT
+#define USE_WEBSERVER_IDF_STACK_SIZE 4096     // NOLINT
 #endif
 
 // ESP32-specific feature flags
 #ifdef USE_ESP32
+#define USE_ADC_CONTINUOUS
 #define USE_BLUETOOTH_PROXY
 #define USE_ESP32_BLE
 #define USE_ESP32_BLE_CLIENT
 #define USE_ESP32_BLE_SERVER
 #define USE_ESP32_CAMERA
 #define USE_IMPROV
+#define USE_LOOP_TASKS
 #define USE_MICRO_WAKE_WORD_VAD
 #define USE_MICROPHONE
+#define USE_OTA_INFLATE
 #define USE_PSRAM
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #define USE_SPEAKER
 #define USE_SPI
 #define USE_VOICE_ASSISTANT
@@ -133,6 +149,7 @@
 #define USE_ADC_SENSOR_VCC
 #define USE_ARDUINO_VERSION_CODE VERSION_CODE(3, 1, 2)
 #define USE_ESP8266_PREFERENCES_FLASH
+#define USE_ESP8266_PREFERENCES_LOG_SECTORS 4  // NOLINT
 #define USE_HTTP_REQUEST_ESP8266_HTTPS
 #define USE_SOCKET_IMPL_LWIP_TCP
 
@@ -155,10 +172,12 @@
 
 #ifdef USE_LIBRETINY
 #define USE_SOCKET_IMPL_LWIP_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #endif
 
 #ifdef USE_HOST
 #define USE_SOCKET_IMPL_BSD_SOCKETS
+#define USE_SOCKET_SELECT_SUPPORT
 #endif
 
 // Disabled feature flags
@@ -27,12 +27,7 @@ bool EntityBase::is_disabled_by_default() const { return this->disabled_by_defau
 void EntityBase::set_disabled_by_default(bool disabled_by_default) { this->disabled_by_default_ = disabled_by_default; }
 
 // Entity Icon
-std::string EntityBase::get_icon() const {
-  if (this->icon_c_str_ == nullptr) {
-    return "";
-  }
-  return this->icon_c_str_;
-}
+StringRef EntityBase::get_icon() const { return StringRef::from_maybe_nullptr(this->icon_c_str_); }
 void EntityBase::set_icon(const char *icon) { this->icon_c_str_ = icon; }
 
 // Entity Category
@@ -40,18 +35,22 @@ EntityCategory EntityBase::get_entity_category() const { return this->entity_cat
 void EntityBase::set_entity_category(EntityCategory entity_category) { this->entity_category_ = entity_category; }
 
 // Entity Object ID
-std::string EntityBase::get_object_id() const {
+
+// The object ID of all entities without their own name, derived from the friendly name with the MAC suffix. It only
+// depends on the device, so it is computed once and shared instead of built again for every call.
+static const std::string &dynamic_object_id() {
+  static const std::string object_id = str_sanitize(str_snake_case(App.get_friendly_name()));
+  return object_id;
+}
+
+StringRef EntityBase::get_object_id() const {
   // Check if `App.get_friendly_name()` is constant or dynamic.
   if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
     // `App.get_friendly_name()` is dynamic.
-    return str_sanitize(str_snake_case(App.get_friendly_name()));
-  } else {
-    // `App.get_friendly_name()` is constant.
-    if (this->object_id_c_str_ == nullptr) {
-      return "";
-    }
-    return this->object_id_c_str_;
+    return StringRef(dynamic_object_id());
   }
+  // `App.get_friendly_name()` is constant.
+  return StringRef::from_maybe_nullptr(this->object_id_c_str_);
 }
 void EntityBase::set_object_id(const char *object_id) {
   this->object_id_c_str_ = object_id;
@@ -63,9 +62,8 @@ void EntityBase::calc_object_id_() {
   // Check if `App.get_friendly_name()` is constant or dynamic.
   if (!this->has_own_name_ && App.is_name_add_mac_suffix_enabled()) {
     // `App.get_friendly_name()` is dynamic.
-    const auto object_id = str_sanitize(str_snake_case(App.get_friendly_name()));
     // FNV-1 hash
-    this->object_id_hash_ = fnv1_hash(object_id);
+    this->object_id_hash_ = fnv1_hash(dynamic_object_id());
   } else {
     // `App.get_friendly_name()` is constant.
     // FNV-1 hash
@@ -75,19 +73,14 @@ void EntityBase::calc_object_id_() {
 
 uint32_t EntityBase::get_object_id_hash() { return this->object_id_hash_; }
 
-std::string EntityBase_DeviceClass::get_device_class() {
-  if (this->device_class_ == nullptr) {
-    return "";
-  }
-  return this->device_class_;
+StringRef EntityBase_DeviceClass::get_device_class() const {
+  return StringRef::from_maybe_nullptr(this->device_class_);
 }
 
 void EntityBase_DeviceClass::set_device_class(const char *device_class) { this->device_class_ = device_class; }
 
-std::string EntityBase_UnitOfMeasurement::get_unit_of_measurement() {
-  if (this->unit_of_measurement_ == nullptr)
-    return "";
-  return this->unit_of_measurement_;
+StringRef EntityBase_UnitOfMeasurement::get_unit_of_measurement() const {
+  return StringRef::from_maybe_nullptr(this->unit_of_measurement_);
 }
 void EntityBase_UnitOfMeasurement::set_unit_of_measurement(const char *unit_of_measurement) {
   this->unit_of_measurement_ = unit_of_measurement;
@@ -23,7 +23,7 @@ class EntityBase {
   bool has_own_name() const { return this->has_own_name_; }
 
   // Get the sanitized name of this Entity as an ID.
-  std::string get_object_id() const;
+  StringRef get_object_id() const;
   void set_object_id(const char *object_id);
 
   // Get the unique Object ID of this Entity
@@ -44,7 +44,7 @@ class EntityBase {
   void set_entity_category(EntityCategory entity_category);
 
   // Get/set this entity's icon
-  std::string get_icon() const;
+  StringRef get_icon() const;
   void set_icon(const char *icon);
 
  protected:
@@ -66,7 +66,7 @@ class EntityBase {
 class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the device class, using the manual override if set.
-  std::string get_device_class();
+  StringRef get_device_class() const;
   /// Manually set the device class.
   void set_device_class(const char *device_class);
 
@@ -77,7 +77,7 @@ class EntityBase_DeviceClass {  // NOLINT(readability-identifier-naming)
 class EntityBase_UnitOfMeasurement {  // NOLINT(readability-identifier-naming)
  public:
   /// Get the unit of measurement, using the manual override if set.
-  std::string get_unit_of_measurement();
+  StringRef get_unit_of_measurement() const;
   /// Manually set the unit of measurement.
   void set_unit_of_measurement(const char *unit_of_measurement);
 
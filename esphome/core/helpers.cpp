@@ -59,6 +59,15 @@ namespace esphome {
 
 static const char *const TAG = "helpers";
 
+static const uint8_t CRC8_8C_LE_LUT_L[] = {0x00, 0x5e, 0xbc, 0xe2, 0x61, 0x3f, 0xdd, 0x83,
+                                          0xc2, 0x9c, 0x7e, 0x20, 0xa3, 0xfd, 0x1f, 0x41};
+static const uint8_t CRC8_8C_LE_LUT_H[] = {0x00, 0x9d, 0x23, 0xbe, 0x46, 0xdb, 0x65, 0xf8,
+                                          0x8c, 0x11, 0xaf, 0x32, 0xca, 0x57, 0xe9, 0x74};
+static const uint8_t CRC8_31_BE_LUT_L[] = {0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97,
+                                          0xb9, 0x88, 0xdb, 0xea, 0x7d, 0x4c, 0x1f, 0x2e};
+static const uint8_t CRC8_31_BE_LUT_H[] = {0x00, 0x43, 0x86, 0xc5, 0x3d, 0x7e, 0xbb, 0xf8,
+                                          0x7a, 0x39, 0xfc, 0xbf, 0x47, 0x04, 0xc1, 0x82};
+
 static const uint16_t CRC16_A001_LE_LUT_L[] = {0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
                                                0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440};
 static const uint16_t CRC16_A001_LE_LUT_H[] = {0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
@@ -93,17 +102,43 @@ std::string to_string(long double value) { return str_snprintf("%Lf", 32, value)
 // Mathematics
 
 float lerp(float completion, float start, float end) { return start + (end - start) * completion; }
-uint8_t crc8(const uint8_t *data, uint8_t len) {
-  uint8_t crc = 0;
-
-  while ((len--) != 0u) {
-    uint8_t inbyte = *data++;
-    for (uint8_t i = 8; i != 0u; i--) {
-      bool mix = (crc ^ inbyte) & 0x01;
-      crc >>= 1;
-      if (mix)
-        crc ^= 0x8C;
-      inbyte >>= 1;
+uint8_t crc8(const uint8_t *data, uint8_t len, uint8_t crc, uint8_t poly, bool msb_first) {
+#ifdef USE_ESP32
+  if (poly == 0x07 && msb_first) {
+    return crc8_be(crc ^ 0xff, data, len) ^ 0xff;
+  }
+#endif
+  if (poly == 0x8C && !msb_first) {
+    while (len--) {
+      uint8_t combo = crc ^ *data++;
+      crc = CRC8_8C_LE_LUT_L[combo & 0x0F] ^ CRC8_8C_LE_LUT_H[combo >> 4];
+    }
+  } else if (poly == 0x31 && msb_first) {
+    while (len--) {
+      uint8_t combo = crc ^ *data++;
+      crc = CRC8_31_BE_LUT_L[combo & 0x0F] ^ CRC8_31_BE_LUT_H[combo >> 4];
+    }
+  } else if (msb_first) {
+    while (len--) {
+      crc ^= *data++;
+      for (uint8_t i = 0; i < 8; i++) {
+        if (crc & 0x80) {
+          crc = (crc << 1) ^ poly;
+        } else {
+          crc <<= 1;
+        }
+      }
+    }
+  } else {
+    while (len--) {
+      crc ^= *data++;
+      for (uint8_t i = 0; i < 8; i++) {
+        if (crc & 0x01) {
+          crc = (crc >> 1) ^ poly;
+        } else {
+          crc >>= 1;
+        }
+      }
     }
   }
   return crc;
@@ -755,4 +790,47 @@ void delay_microseconds_safe(uint32_t us) {  // avoids CPU locks that could trig
     ;
 }
 
+#ifdef USE_ESP32
+static uint32_t memory_class_caps(MemoryClass memory_class) {
+  switch (memory_class) {
+    case MemoryClass::DMA:
+      return MALLOC_CAP_DMA | MALLOC_CAP_8BIT;
+    case MemoryClass::FAST:
+      return MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+    default:
+#ifdef USE_PSRAM_INTERNAL_BULK_DATA
+      return MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT;
+#else
+      return MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+#endif
+  }
+}
+#endif
+
+void *allocate_memory(size_t size, MemoryClass memory_class) {
+#ifdef USE_ESP32
+  void *ptr = heap_caps_malloc(size, memory_class_caps(memory_class));
+  if (ptr == nullptr && memory_class == MemoryClass::BULK)
+    ptr = heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  return ptr;
+#else
+  return malloc(size);  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#endif
+}
+
+void *reallocate_memory(void *ptr, size_t size, MemoryClass memory_class) {
+#ifdef USE_ESP32
+  void *new_ptr = heap_caps_realloc(ptr, size, memory_class_caps(memory_class));
+  if (new_ptr == nullptr && memory_class == MemoryClass::BULK)
+    new_ptr = heap_caps_realloc(ptr, size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  return new_ptr;
+#else
+  return realloc(ptr, size);  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+#endif
+}
+
+void free_memory(void *ptr) {
+  free(ptr);  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+}
+
 }  // namespace esphome
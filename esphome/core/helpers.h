@@ -154,10 +154,18 @@ template<typename T, typename U> T remap(U value, U min, U max, T min_out, T max
   return (value - min) * (max_out - min_out) / (max - min) + min_out;
 }
 
-/// Calculate a CRC-8 checksum of \p data with size \p len.
-uint8_t crc8(const uint8_t *data, uint8_t len);
+/** Calculate a CRC-8 checksum of \p data with size \p len.
+ *
+ * The default is the Dallas/Maxim 1-Wire CRC, \p poly is reversed unless \p msb_first is set (0x31 for the
+ * Sensirion CRC with \p crc 0xff). Passing the previous result as \p crc continues the checksum over more data.
+ */
+uint8_t crc8(const uint8_t *data, uint8_t len, uint8_t crc = 0x00, uint8_t poly = 0x8C, bool msb_first = false);
 
-/// Calculate a CRC-16 checksum of \p data with size \p len.
+/** Calculate a CRC-16 checksum of \p data with size \p len.
+ *
+ * Without \p refin and \p refout, passing the previous result as \p crc continues the checksum over more data, like
+ * a byte-by-byte frame parser does.
+ */
 uint16_t crc16(const uint8_t *data, uint16_t len, uint16_t crc = 0xffff, uint16_t reverse_poly = 0xa001,
                bool refin = false, bool refout = false);
 uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t poly = 0x1021, bool refin = false,
@@ -166,6 +174,13 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t p
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
 
+/// Calculate a FNV-1 hash of \p str at compile time. Yields the same result as fnv1_hash().
+constexpr uint32_t fnv1_hash_constexpr(const char *str, uint32_t hash = 2166136261UL) {
+  return *str == '\0' ? hash
+                      : fnv1_hash_constexpr(str + 1, static_cast<uint32_t>(hash * 16777619UL) ^
+                                                         static_cast<uint32_t>(*str));
+}
+
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
 /// Return a random float between 0 and 1.
@@ -480,7 +495,12 @@ template<typename... X> class CallbackManager;
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
   /// Add a callback to the list.
-  void add(std::function<void(Ts...)> &&callback) { this->callbacks_.push_back(std::move(callback)); }
+  void add(std::function<void(Ts...)> &&callback) {
+    // Most managers only get a few callbacks, all during setup, so grow one at a time instead of doubling the
+    // capacity and leaving unused std::function slots behind in every entity
+    this->callbacks_.reserve(this->callbacks_.size() + 1);
+    this->callbacks_.push_back(std::move(callback));
+  }
 
   /// Call all callbacks in this manager.
   void call(Ts... args) {
@@ -651,6 +671,26 @@ void delay_microseconds_safe(uint32_t us);
 /// @name Memory management
 ///@{
 
+/// The kind of memory a buffer needs, see allocate_memory().
+enum class MemoryClass : uint8_t {
+  DMA,   ///< Internal RAM the DMA controllers can access, for buffers handed to peripherals.
+  FAST,  ///< Internal RAM, for data used from interrupts or on every loop iteration.
+  BULK,  ///< Large data that tolerates slower access, placed in SPI RAM when available.
+};
+
+/** Allocate `size` bytes from the memory that suits `memory_class`.
+ *
+ * Bulk data goes to SPI RAM first and falls back to internal RAM when SPI RAM is full or unavailable, unless the
+ * psram component is configured to keep bulk data internal. DMA and fast memory never end up in SPI RAM.
+ *
+ * @return The memory, to be released with free_memory(), or `nullptr` if there is not enough of it.
+ */
+void *allocate_memory(size_t size, MemoryClass memory_class);
+/// Resize memory from allocate_memory(), keeping it in the same memory class. Works like realloc().
+void *reallocate_memory(void *ptr, size_t size, MemoryClass memory_class);
+/// Release memory from allocate_memory() or reallocate_memory().
+void free_memory(void *ptr);
+
 /** An STL allocator that uses SPI RAM.
  *
  * By setting flags, it can be configured to don't try main memory if SPI RAM is full or unavailable, and to return
@@ -673,19 +713,19 @@ template<class T> class ExternalRAMAllocator {
   T *allocate(size_t n) {
     size_t size = n * sizeof(T);
     T *ptr = nullptr;
+    if ((this->flags_ & Flags::REFUSE_INTERNAL) == 0) {
+      ptr = static_cast<T *>(allocate_memory(size, MemoryClass::BULK));
+    } else {
 #ifdef USE_ESP32
-    ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+      ptr = static_cast<T *>(heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
 #endif
-    if (ptr == nullptr && (this->flags_ & Flags::REFUSE_INTERNAL) == 0)
-      ptr = static_cast<T *>(malloc(size));  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
+    }
     if (ptr == nullptr && (this->flags_ & Flags::ALLOW_FAILURE) == 0)
       abort();
     return ptr;
   }
 
-  void deallocate(T *p, size_t n) {
-    free(p);  // NOLINT(cppcoreguidelines-owning-memory,cppcoreguidelines-no-malloc)
-  }
+  void deallocate(T *p, size_t n) { free_memory(p); }
 
  private:
   Flags flags_{Flags::ALLOW_FAILURE};
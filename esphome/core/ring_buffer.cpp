@@ -7,13 +7,19 @@
 
 #include "helpers.h"
 
+#include <freertos/task.h>
+
+#include <algorithm>
+#include <cstring>
+
 namespace esphome {
 
 static const char *const TAG = "ring_buffer";
 
 RingBuffer::~RingBuffer() {
-  if (this->handle_ != nullptr) {
+  if (this->handle_ != nullptr)
     vStreamBufferDelete(this->handle_);
+  if (this->handle_ != nullptr || this->zero_copy_) {
     ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
     allocator.deallocate(this->storage_, this->size_);
   }
@@ -35,7 +41,92 @@ std::unique_ptr<RingBuffer> RingBuffer::create(size_t len) {
   return rb;
 }
 
+std::unique_ptr<RingBuffer> RingBuffer::create_zero_copy(size_t len, size_t mirror_size) {
+  std::unique_ptr<RingBuffer> rb = make_unique<RingBuffer>();
+
+  rb->size_ = len + mirror_size;
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  rb->storage_ = allocator.allocate(rb->size_);
+  if (rb->storage_ == nullptr) {
+    return nullptr;
+  }
+
+  rb->zero_copy_ = true;
+  rb->capacity_ = len;
+  rb->mirror_size_ = mirror_size;
+  ESP_LOGD(TAG, "Created zero-copy ring buffer with size %u", len);
+  return rb;
+}
+
+size_t RingBuffer::acquire_write(uint8_t **data, size_t len) {
+  const size_t head = this->head_.load(std::memory_order_relaxed);
+  const size_t tail = this->tail_.load(std::memory_order_acquire);
+  const size_t pos = head % this->capacity_;
+  *data = this->storage_ + pos;
+  return std::min({len, this->capacity_ - (head - tail), this->capacity_ - pos});
+}
+
+void RingBuffer::commit_write(size_t len) {
+  this->head_.store(this->head_.load(std::memory_order_relaxed) + len, std::memory_order_release);
+}
+
+size_t RingBuffer::acquire_read(uint8_t **data, size_t len) {
+  const size_t tail = this->tail_.load(std::memory_order_relaxed);
+  const size_t head = this->head_.load(std::memory_order_acquire);
+  const size_t pos = tail % this->capacity_;
+  size_t count = std::min(len, head - tail);
+  const size_t contiguous = this->capacity_ - pos;
+  if (count > contiguous) {
+    // The writer doesn't touch stored data, so the start of the buffer can be mirrored behind its end
+    const size_t wrapped = std::min(count - contiguous, this->mirror_size_);
+    memcpy(this->storage_ + this->capacity_, this->storage_, wrapped);
+    count = contiguous + wrapped;
+  }
+  *data = this->storage_ + pos;
+  return count;
+}
+
+void RingBuffer::release_read(size_t len) {
+  this->tail_.store(this->tail_.load(std::memory_order_relaxed) + len, std::memory_order_release);
+}
+
+size_t RingBuffer::write_zero_copy_(const uint8_t *data, size_t len, TickType_t ticks_to_wait) {
+  const TickType_t start = xTaskGetTickCount();
+  size_t written = 0;
+  while (true) {
+    uint8_t *region;
+    size_t count;
+    // The free space may wrap around the end
+    while (written < len && (count = this->acquire_write(&region, len - written)) > 0) {
+      memcpy(region, data + written, count);
+      this->commit_write(count);
+      written += count;
+    }
+    if (written == len || xTaskGetTickCount() - start >= ticks_to_wait)
+      return written;
+    vTaskDelay(1);
+  }
+}
+
 size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
+  if (this->zero_copy_) {
+    const TickType_t start = xTaskGetTickCount();
+    auto *bytes = static_cast<uint8_t *>(data);
+    size_t total = 0;
+    while (true) {
+      uint8_t *region;
+      size_t count;
+      while (total < len && (count = this->acquire_read(&region, len - total)) > 0) {
+        memcpy(bytes + total, region, count);
+        this->release_read(count);
+        total += count;
+      }
+      if (total == len || xTaskGetTickCount() - start >= ticks_to_wait)
+        return total;
+      vTaskDelay(1);
+    }
+  }
+
   if (ticks_to_wait > 0)
     xStreamBufferSetTriggerLevel(this->handle_, len);
 
@@ -47,6 +138,8 @@ size_t RingBuffer::read(void *data, size_t len, TickType_t ticks_to_wait) {
 }
 
 size_t RingBuffer::write(void *data, size_t len) {
+  if (this->zero_copy_)
+    return this->write_zero_copy_(static_cast<const uint8_t *>(data), len, 0);
   size_t free = this->free();
   if (free < len) {
     size_t needed = len - free;
@@ -57,14 +150,31 @@ size_t RingBuffer::write(void *data, size_t len) {
 }
 
 size_t RingBuffer::write_without_replacement(void *data, size_t len, TickType_t ticks_to_wait) {
+  if (this->zero_copy_)
+    return this->write_zero_copy_(static_cast<const uint8_t *>(data), len, ticks_to_wait);
   return xStreamBufferSend(this->handle_, data, len, ticks_to_wait);
 }
 
-size_t RingBuffer::available() const { return xStreamBufferBytesAvailable(this->handle_); }
+size_t RingBuffer::available() const {
+  if (this->zero_copy_)
+    return this->head_.load(std::memory_order_acquire) - this->tail_.load(std::memory_order_acquire);
+  return xStreamBufferBytesAvailable(this->handle_);
+}
 
-size_t RingBuffer::free() const { return xStreamBufferSpacesAvailable(this->handle_); }
+size_t RingBuffer::free() const {
+  if (this->zero_copy_)
+    return this->capacity_ - this->available();
+  return xStreamBufferSpacesAvailable(this->handle_);
+}
 
-BaseType_t RingBuffer::reset() { return xStreamBufferReset(this->handle_); }
+BaseType_t RingBuffer::reset() {
+  if (this->zero_copy_) {
+    // Discards from the reader's side, so only the reader or a single task may call this
+    this->tail_.store(this->head_.load(std::memory_order_acquire), std::memory_order_release);
+    return pdPASS;
+  }
+  return xStreamBufferReset(this->handle_);
+}
 
 }  // namespace esphome
 
@@ -5,6 +5,7 @@
 #include <freertos/FreeRTOS.h>
 #include <freertos/stream_buffer.h>
 
+#include <atomic>
 #include <cinttypes>
 #include <memory>
 
@@ -33,6 +34,8 @@ class RingBuffer {
    * The provided data is written to the ring buffer. If not enough space is available,
    * the function will overwrite the oldest data in the ring buffer.
    *
+   * Zero-copy ring buffers can't discard data from the writer's side, they write what fits.
+   *
    * @param data Pointer to data for writing
    * @param len Number of bytes to write
    * @return Number of bytes written
@@ -79,13 +82,63 @@ class RingBuffer {
    */
   BaseType_t reset();
 
+  /**
+   * @brief Reserves contiguous free space for the writer to fill in place.
+   *
+   * Only available on ring buffers from create_zero_copy(). The region may be shorter than requested when the
+   * free space wraps around the end of the buffer, call again after commit_write() for the rest.
+   *
+   * @param data Set to the start of the region
+   * @param len Maximum number of bytes to reserve
+   * @return Number of bytes reserved, 0 if the ring buffer is full
+   */
+  size_t acquire_write(uint8_t **data, size_t len);
+
+  /// @brief Makes `len` bytes of the region from acquire_write() available to the reader.
+  void commit_write(size_t len);
+
+  /**
+   * @brief Gives the reader the stored data in place.
+   *
+   * Only available on ring buffers from create_zero_copy(). Data wrapping around the end of the buffer is copied
+   * behind the end, so regions up to the mirror size passed to create_zero_copy() are always returned whole.
+   *
+   * @param data Set to the start of the region
+   * @param len Maximum number of bytes to return
+   * @return Number of bytes in the region, 0 if the ring buffer is empty
+   */
+  size_t acquire_read(uint8_t **data, size_t len);
+
+  /// @brief Frees the first `len` bytes of the region from acquire_read() for the writer.
+  void release_read(size_t len);
+
   static std::unique_ptr<RingBuffer> create(size_t len);
 
+  /**
+   * @brief Creates a lock-free ring buffer for a single writer and a single reader task.
+   *
+   * Besides the copying functions, it supports acquire_write()/commit_write() and acquire_read()/release_read() so
+   * that producers fill and consumers process the data in place. Timeouts are waited by polling every tick.
+   *
+   * @param len Capacity in bytes
+   * @param mirror_size Largest read region that must be contiguous, this many bytes are allocated behind the end
+   */
+  static std::unique_ptr<RingBuffer> create_zero_copy(size_t len, size_t mirror_size = 0);
+
  protected:
-  StreamBufferHandle_t handle_;
+  size_t write_zero_copy_(const uint8_t *data, size_t len, TickType_t ticks_to_wait);
+
+  StreamBufferHandle_t handle_{nullptr};
   StaticStreamBuffer_t structure_;
   uint8_t *storage_;
   size_t size_{0};
+
+  // Zero-copy mode: total bytes ever committed by the writer and released by the reader
+  bool zero_copy_{false};
+  size_t capacity_{0};
+  size_t mirror_size_{0};
+  std::atomic<size_t> head_{0};
+  std::atomic<size_t> tail_{0};
 };
 
 }  // namespace esphome
@@ -10,6 +10,7 @@ namespace esphome {
 static const char *const TAG = "scheduler";
 
 static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+static const size_t MIN_INDEX_BUCKETS = 16;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
@@ -18,6 +19,9 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 // them (i.e. when adding/removing items, but not when changing items). As items are only deleted from the loop task,
 // iterating over them from the loop task is fine; but iterating from any other context requires the lock to be held to
 // avoid the main thread modifying the list while it is being accessed.
+//
+// The same lock also guards the item pool and the cancel index. Every live named item is linked into exactly one
+// index bucket from the moment it is pushed until it is cancelled or has run for the last time.
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
@@ -31,7 +35,7 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::TIMEOUT;
@@ -40,6 +44,7 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
   item->last_execution_major = this->millis_major_;
   item->callback = std::move(func);
   item->remove = false;
+  item->id_only = false;
   this->push_(std::move(item));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
@@ -47,6 +52,10 @@ bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
+  this->set_interval(component, name, interval, std::move(func), this->interval_offset_(interval));
+}
+void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
+                                 std::function<void()> func, uint32_t offset) {
   const uint32_t now = this->millis_();
 
   if (!name.empty())
@@ -55,14 +64,9 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
   if (interval == SCHEDULER_DONT_RUN)
     return;
 
-  // only put offset in lower half
-  uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
-
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto item = this->acquire_item_();
   item->component = component;
   item->name = name;
   item->type = SchedulerItem::INTERVAL;
@@ -73,11 +77,72 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
     item->last_execution_major--;
   item->callback = std::move(func);
   item->remove = false;
+  item->id_only = false;
   this->push_(std::move(item));
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
   return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
 }
+void HOT Scheduler::set_timeout(Component *component, uint32_t id, uint32_t timeout, std::function<void()> func) {
+  const uint32_t now = this->millis_();
+
+  this->cancel_timeout(component, id);
+
+  if (timeout == SCHEDULER_DONT_RUN)
+    return;
+
+  ESP_LOGVV(TAG, "set_timeout(id=0x%08" PRIX32 ", timeout=%" PRIu32 ")", id, timeout);
+
+  auto item = this->acquire_item_();
+  item->component = component;
+  item->type = SchedulerItem::TIMEOUT;
+  item->timeout = timeout;
+  item->last_execution = now;
+  item->last_execution_major = this->millis_major_;
+  item->callback = std::move(func);
+  item->remove = false;
+  item->id_only = true;
+  item->name_hash = id;
+  this->push_(std::move(item));
+}
+bool HOT Scheduler::cancel_timeout(Component *component, uint32_t id) {
+  return this->cancel_item_(component, id, SchedulerItem::TIMEOUT);
+}
+void HOT Scheduler::set_interval(Component *component, uint32_t id, uint32_t interval, std::function<void()> func) {
+  const uint32_t now = this->millis_();
+
+  this->cancel_interval(component, id);
+
+  if (interval == SCHEDULER_DONT_RUN)
+    return;
+
+  uint32_t offset = this->interval_offset_(interval);
+
+  ESP_LOGVV(TAG, "set_interval(id=0x%08" PRIX32 ", interval=%" PRIu32 ", offset=%" PRIu32 ")", id, interval, offset);
+
+  auto item = this->acquire_item_();
+  item->component = component;
+  item->type = SchedulerItem::INTERVAL;
+  item->interval = interval;
+  item->last_execution = now - offset - interval;
+  item->last_execution_major = this->millis_major_;
+  if (item->last_execution > now)
+    item->last_execution_major--;
+  item->callback = std::move(func);
+  item->remove = false;
+  item->id_only = true;
+  item->name_hash = id;
+  this->push_(std::move(item));
+}
+bool HOT Scheduler::cancel_interval(Component *component, uint32_t id) {
+  return this->cancel_item_(component, id, SchedulerItem::INTERVAL);
+}
+uint32_t Scheduler::interval_offset_(uint32_t interval) {
+  // only put offset in lower half
+  if (interval == 0)
+    return 0;
+  return (random_uint32() % interval) / 2;
+}
 
 struct RetryArgs {
   std::function<RetryResult(uint8_t)> func;
@@ -217,6 +282,7 @@ void HOT Scheduler::call() {
       // Don't run on failed components
       if (item->component != nullptr && item->component->is_failed()) {
         LockGuard guard{this->lock_};
+        this->index_unlink_(item.get());
         this->pop_raw_();
         continue;
       }
@@ -230,8 +296,27 @@ void HOT Scheduler::call() {
       //  - timeouts/intervals get added, potentially invalidating vector pointers
       //  - timeouts/intervals get cancelled
       {
+#if defined(USE_LOOP_PROFILER) || defined(USE_HEAP_PROFILER)
+        Component *component = item->component;
+#endif
+#ifdef USE_LOOP_PROFILER
+        this->lateness_stats_.record(millis() - item->next_execution());
+        const uint32_t started = micros();
+#endif
+#ifdef USE_HEAP_PROFILER
+        const uint32_t free_before = ComponentHeapStats::free_heap();
+#endif
         WarnIfComponentBlockingGuard guard{item->component};
         item->callback();
+#ifdef USE_LOOP_PROFILER
+        // `item` may have been invalidated by the callback
+        if (component != nullptr)
+          component->get_loop_stats().record_scheduler(micros() - started);
+#endif
+#ifdef USE_HEAP_PROFILER
+        if (component != nullptr)
+          component->get_heap_stats().record(false, free_before);
+#endif
       }
     }
 
@@ -245,11 +330,11 @@ void HOT Scheduler::call() {
       // during the function call and know if we were cancelled.
       this->pop_raw_();
 
-      this->lock_.unlock();
-
       if (item->remove) {
         // We were removed/cancelled in the function call, stop
         to_remove_--;
+        this->recycle_item_(std::move(item));
+        this->lock_.unlock();
         continue;
       }
 
@@ -261,8 +346,14 @@ void HOT Scheduler::call() {
           if (item->last_execution < before)
             item->last_execution_major++;
         }
-        this->push_(std::move(item));
+        // Still linked into the index, so only re-queue it
+        this->to_add_.push_back(std::move(item));
+      } else {
+        this->index_unlink_(item.get());
+        this->recycle_item_(std::move(item));
       }
+
+      this->lock_.unlock();
     }
   }
 
@@ -272,6 +363,10 @@ void HOT Scheduler::process_to_add() {
   LockGuard guard{this->lock_};
   for (auto &it : this->to_add_) {
     if (it->remove) {
+      // Cancelled before it ever made it into the heap
+      if (this->to_remove_ > 0)
+        this->to_remove_--;
+      this->recycle_item_(std::move(it));
       continue;
     }
 
@@ -296,25 +391,43 @@ void HOT Scheduler::cleanup_() {
 }
 void HOT Scheduler::pop_raw_() {
   std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+  // The caller may already have moved the item out of the heap
+  if (this->items_.back() != nullptr)
+    this->recycle_item_(std::move(this->items_.back()));
   this->items_.pop_back();
 }
 void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
+  if (item->is_named())
+    this->index_insert_(item.get());
   this->to_add_.push_back(std::move(item));
 }
 bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
   // obtain lock because this function iterates and can be called from non-loop task context
   LockGuard guard{this->lock_};
+
+  if (!name.empty()) {
+    // Named items are unique per (component, name, type), see set_timeout()/set_interval()
+    SchedulerItem *item = this->index_take_(component, fnv1_hash(name), &name, type);
+    if (item == nullptr)
+      return false;
+    item->remove = true;
+    to_remove_++;
+    return true;
+  }
+
+  // Unnamed items aren't indexed; cancelling them (e.g. DelayAction::stop()) cancels all of them
   bool ret = false;
   for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
+    if (it->component == component && !it->is_named() && it->type == type && !it->remove) {
       to_remove_++;
       it->remove = true;
       ret = true;
     }
   }
   for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
+    if (it->component == component && !it->is_named() && it->type == type && !it->remove) {
+      to_remove_++;
       it->remove = true;
       ret = true;
     }
@@ -322,6 +435,119 @@ bool HOT Scheduler::cancel_item_(Component *component, const std::string &name,
 
   return ret;
 }
+bool HOT Scheduler::cancel_item_(Component *component, uint32_t id, Scheduler::SchedulerItem::Type type) {
+  LockGuard guard{this->lock_};
+  SchedulerItem *item = this->index_take_(component, id, nullptr, type);
+  if (item == nullptr)
+    return false;
+  item->remove = true;
+  to_remove_++;
+  return true;
+}
+void Scheduler::reserve_pool(size_t size) {
+  LockGuard guard{this->lock_};
+  this->items_.reserve(size);
+  this->pool_capacity_ = std::max(this->pool_capacity_, size);
+  while (this->item_pool_.size() < size)
+    this->item_pool_.push_back(make_unique<SchedulerItem>());
+  size_t buckets = MIN_INDEX_BUCKETS;
+  while (buckets < size)
+    buckets <<= 1;
+  if (buckets > this->index_.size())
+    this->resize_index_(buckets);
+}
+std::unique_ptr<Scheduler::SchedulerItem> HOT Scheduler::acquire_item_() {
+  {
+    LockGuard guard{this->lock_};
+    if (!this->item_pool_.empty()) {
+      auto item = std::move(this->item_pool_.back());
+      this->item_pool_.pop_back();
+      return item;
+    }
+  }
+  return make_unique<SchedulerItem>();
+}
+void HOT Scheduler::recycle_item_(std::unique_ptr<SchedulerItem> item) {
+  // Release everything captured by the callback right away, not when the item is reused
+  item->callback = nullptr;
+  item->index_next = nullptr;
+  item->indexed = false;
+  if (this->item_pool_.size() >= this->pool_capacity_)
+    return;
+  // clear() keeps the allocated capacity around for the next name
+  item->name.clear();
+  this->item_pool_.push_back(std::move(item));
+}
+static uint32_t make_index_hash(Component *component, uint32_t name_hash, uint8_t type) {
+  uint32_t hash = name_hash;
+  hash ^= static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component) * 2654435761UL);
+  return hash ^ type;
+}
+void Scheduler::resize_index_(size_t buckets) {
+  std::vector<SchedulerItem *> old_index = std::move(this->index_);
+  this->index_.assign(buckets, nullptr);
+  for (auto *head : old_index) {
+    while (head != nullptr) {
+      SchedulerItem *next = head->index_next;
+      auto &bucket = this->index_[make_index_hash(head->component, head->name_hash, head->type) & (buckets - 1)];
+      head->index_next = bucket;
+      bucket = head;
+      head = next;
+    }
+  }
+}
+void HOT Scheduler::index_insert_(SchedulerItem *item) {
+  if (this->index_.empty()) {
+    this->resize_index_(MIN_INDEX_BUCKETS);
+  } else if (this->index_count_ >= this->index_.size() * 2) {
+    this->resize_index_(this->index_.size() * 2);
+  }
+  if (!item->id_only)
+    item->name_hash = fnv1_hash(item->name);
+  const uint32_t hash = make_index_hash(item->component, item->name_hash, item->type);
+  auto &bucket = this->index_[hash & (this->index_.size() - 1)];
+  item->index_next = bucket;
+  item->indexed = true;
+  bucket = item;
+  this->index_count_++;
+}
+void HOT Scheduler::index_unlink_(SchedulerItem *item) {
+  if (!item->indexed)
+    return;
+  const uint32_t hash = make_index_hash(item->component, item->name_hash, item->type);
+  SchedulerItem **link = &this->index_[hash & (this->index_.size() - 1)];
+  while (*link != nullptr) {
+    if (*link == item) {
+      *link = item->index_next;
+      item->index_next = nullptr;
+      item->indexed = false;
+      this->index_count_--;
+      return;
+    }
+    link = &(*link)->index_next;
+  }
+}
+Scheduler::SchedulerItem *HOT Scheduler::index_take_(Component *component, uint32_t name_hash,
+                                                     const std::string *name, SchedulerItem::Type type) {
+  if (this->index_.empty())
+    return nullptr;
+  const uint32_t hash = make_index_hash(component, name_hash, type);
+  SchedulerItem **link = &this->index_[hash & (this->index_.size() - 1)];
+  while (*link != nullptr) {
+    SchedulerItem *item = *link;
+    // A numeric identifier on either side matches by hash alone, two names must match exactly
+    if (item->name_hash == name_hash && item->component == component && item->type == type &&
+        (name == nullptr || item->id_only || item->name == *name)) {
+      *link = item->index_next;
+      item->index_next = nullptr;
+      item->indexed = false;
+      this->index_count_--;
+      return item;
+    }
+    link = &item->index_next;
+  }
+  return nullptr;
+}
 uint32_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
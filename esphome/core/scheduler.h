@@ -15,8 +15,22 @@ class Scheduler {
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
   bool cancel_timeout(Component *component, const std::string &name);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
+  /// Like set_interval(), but runs at `offset` ms before the usual phase instead of a random one
+  void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func,
+                    uint32_t offset);
   bool cancel_interval(Component *component, const std::string &name);
 
+  /** Numeric identifier variants of the timeout/interval API.
+   *
+   * These skip building and comparing `std::string` names, which matters for timeouts that are re-armed on every
+   * input edge. An identifier is interchangeable with the name it was hashed from, i.e. an item scheduled with
+   * `fnv1_hash_constexpr("debounce")` can be cancelled with the name "debounce" and vice versa.
+   */
+  void set_timeout(Component *component, uint32_t id, uint32_t timeout, std::function<void()> func);
+  bool cancel_timeout(Component *component, uint32_t id);
+  void set_interval(Component *component, uint32_t id, uint32_t interval, std::function<void()> func);
+  bool cancel_interval(Component *component, uint32_t id);
+
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                  std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
   bool cancel_retry(Component *component, const std::string &name);
@@ -27,6 +41,19 @@ class Scheduler {
 
   void process_to_add();
 
+  /** Pre-allocate scheduler items and the cancel index.
+   *
+   * Items released by finished or cancelled timeouts/intervals are kept in a pool of up to `size` entries and
+   * reused for the next set_timeout()/set_interval() call, so steady-state scheduling doesn't touch the heap.
+   */
+  void reserve_pool(size_t size);
+
+#ifdef USE_LOOP_PROFILER
+  /// How late timeouts and intervals ran compared to when they were due, in ms.
+  const LatencyHistogram &get_lateness_stats() const { return this->lateness_stats_; }
+  void reset_lateness_stats() { this->lateness_stats_ = LatencyHistogram{}; }
+#endif
+
  protected:
   struct SchedulerItem {
     Component *component;
@@ -40,6 +67,16 @@ class Scheduler {
     std::function<void()> callback;
     bool remove;
     uint8_t last_execution_major;
+    /// FNV-1 hash of the name, or the numeric identifier if `id_only` is set.
+    uint32_t name_hash;
+    /// The item was scheduled through a numeric identifier and has no `name`.
+    bool id_only;
+    /// The item is currently linked into the cancel index.
+    bool indexed;
+    /// Next item in the same cancel index bucket.
+    SchedulerItem *index_next;
+
+    bool is_named() const { return this->id_only || !this->name.empty(); }
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -68,6 +105,16 @@ class Scheduler {
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  bool cancel_item_(Component *component, uint32_t id, SchedulerItem::Type type);
+  std::unique_ptr<SchedulerItem> acquire_item_();
+  uint32_t interval_offset_(uint32_t interval);
+  // The following methods must be called with `lock_` held.
+  void recycle_item_(std::unique_ptr<SchedulerItem> item);
+  void resize_index_(size_t buckets);
+  void index_insert_(SchedulerItem *item);
+  void index_unlink_(SchedulerItem *item);
+  SchedulerItem *index_take_(Component *component, uint32_t name_hash, const std::string *name,
+                             SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -76,9 +123,18 @@ class Scheduler {
   Mutex lock_;
   std::vector<std::unique_ptr<SchedulerItem>> items_;
   std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  /// Released items waiting to be reused.
+  std::vector<std::unique_ptr<SchedulerItem>> item_pool_;
+  size_t pool_capacity_{8};
+  /// Intrusive hash index of all live named items (both in `items_` and `to_add_`), used for O(1) cancels.
+  std::vector<SchedulerItem *> index_;
+  size_t index_count_{0};
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
+#ifdef USE_LOOP_PROFILER
+  LatencyHistogram lateness_stats_;
+#endif
 };
 
 }  // namespace esphome
@@ -127,6 +127,18 @@ inline std::string operator+(const StringRef &lhs, const char *rhs) {
   return str;
 }
 
+inline std::string operator+(const std::string &lhs, const StringRef &rhs) {
+  auto str = lhs;
+  str.append(rhs.c_str(), rhs.size());
+  return str;
+}
+
+inline std::string operator+(const StringRef &lhs, const std::string &rhs) {
+  auto str = lhs.str();
+  str.append(rhs);
+  return str;
+}
+
 #ifdef USE_JSON
 // NOLINTNEXTLINE(readability-identifier-naming)
 void convertToJson(const StringRef &src, JsonVariant dst);
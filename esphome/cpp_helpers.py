@@ -1,21 +1,26 @@
 import logging
 
 from esphome.const import (
+    CONF_CORE,
     CONF_DISABLED_BY_DEFAULT,
     CONF_ENTITY_CATEGORY,
     CONF_ICON,
+    CONF_ID,
     CONF_INTERNAL,
+    CONF_LOOP_TASK,
     CONF_NAME,
+    CONF_PRIORITY,
     CONF_SAFE_MODE,
     CONF_SETUP_PRIORITY,
+    CONF_STACK_SIZE,
     CONF_TYPE_ID,
     CONF_UPDATE_INTERVAL,
     KEY_PAST_SAFE_MODE,
 )
 from esphome.core import CORE, ID, coroutine
 from esphome.coroutine import FakeAwaitable
-from esphome.cpp_generator import add, get_variable
-from esphome.cpp_types import App
+from esphome.cpp_generator import add, add_define, get_variable
+from esphome.cpp_types import App, PollingComponent
 from esphome.helpers import sanitize, snake_case
 from esphome.types import ConfigFragmentType, ConfigType
 from esphome.util import Registry, RegistryEntry
@@ -58,6 +63,16 @@ async def register_component(var, config):
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
     if CONF_UPDATE_INTERVAL in config:
         add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if task_conf := config.get(CONF_LOOP_TASK):
+        add_define("USE_LOOP_TASKS")
+        add(
+            App.register_loop_task(
+                var,
+                task_conf[CONF_CORE],
+                task_conf[CONF_PRIORITY],
+                task_conf[CONF_STACK_SIZE],
+            )
+        )
 
     # Set component source by inspecting the stack and getting the callee module
     # https://stackoverflow.com/a/1095621
@@ -88,6 +103,23 @@ async def register_component(var, config):
     return var
 
 
+async def register_update_group(var, config, group):
+    """Stagger the updates of a polling component with the others in the same group.
+
+    Bus components call this with the bus as group, so that devices sharing a bus
+    don't all poll in the same loop iteration. Does nothing if the component doesn't poll.
+
+    :param var: The variable representing the component.
+    :param config: The configuration for the component.
+    :param group: The variable the components are grouped by, usually the bus.
+    """
+    id_ = config.get(CONF_ID)
+    if not isinstance(id_, ID) or str(id_) != str(var.base):
+        return
+    if id_.type.inherits_from(PollingComponent):
+        add(var.set_update_group(group))
+
+
 async def register_parented(var, value):
     if isinstance(value, ID):
         paren = await get_variable(value)
@@ -28,6 +28,7 @@ EntityBase = esphome_ns.class_("EntityBase")
 Component = esphome_ns.class_("Component")
 ComponentPtr = Component.operator("ptr")
 PollingComponent = esphome_ns.class_("PollingComponent", Component)
+MeasuringComponent = esphome_ns.class_("MeasuringComponent", PollingComponent)
 Application = esphome_ns.class_("Application")
 optional = esphome_ns.class_("optional")
 arduino_json_ns = global_ns.namespace("ArduinoJson")
@@ -0,0 +1,27 @@
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.const import CONF_ID
+
+CODEOWNERS = ["@esphome/core"]
+DEPENDENCIES = ["host"]
+AUTO_LOAD = ["display", "json", "remote_base", "sensor"]
+
+benchmark_ns = cg.esphome_ns.namespace("benchmark")
+Benchmark = benchmark_ns.class_("Benchmark", cg.Component)
+
+CONF_MIN_TIME = "min_time"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(Benchmark),
+        cv.Optional(
+            CONF_MIN_TIME, default="200ms"
+        ): cv.positive_time_period_milliseconds,
+    }
+).extend(cv.COMPONENT_SCHEMA)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    cg.add(var.set_min_time(config[CONF_MIN_TIME]))
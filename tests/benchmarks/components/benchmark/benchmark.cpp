@@ -0,0 +1,257 @@
+#include "benchmark.h"
+
+#include "esphome/components/api/api_pb2.h"
+#include "esphome/components/display/display_buffer.h"
+#include "esphome/components/json/json_util.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/sensor/filter.h"
+#include "esphome/components/sensor/sensor.h"
+#include "esphome/core/application.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#ifdef USE_API_NOISE
+#include "noise/protocol.h"
+#endif
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace esphome {
+namespace benchmark {
+
+static const char *const TAG = "benchmark";
+
+/// Grayscale frame buffer that only lives in memory.
+class MemoryDisplay : public display::DisplayBuffer {
+ public:
+  MemoryDisplay() { this->init_internal_(WIDTH * HEIGHT); }
+  void update() override {}
+  display::DisplayType get_display_type() override { return display::DisplayType::DISPLAY_TYPE_GRAYSCALE; }
+
+ protected:
+  static constexpr int WIDTH = 320;
+  static constexpr int HEIGHT = 240;
+
+  int get_width_internal() override { return WIDTH; }
+  int get_height_internal() override { return HEIGHT; }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    if (x < 0 || y < 0 || x >= WIDTH || y >= HEIGHT)
+      return;
+    this->buffer_[y * WIDTH + x] = color.white;
+  }
+};
+
+void Benchmark::loop() {
+  ESP_LOGW(TAG, "Running benchmarks...");
+  this->bench_scheduler_();
+  this->bench_proto_();
+  this->bench_noise_();
+  this->bench_sensor_filters_();
+  this->bench_display_();
+  this->bench_json_();
+  this->bench_remote_base_();
+  ESP_LOGW(TAG, "Benchmarks done");
+  exit(0);  // NOLINT(concurrency-mt-unsafe)
+}
+
+void Benchmark::bench_scheduler_() {
+  for (size_t count : {0, 16, 64}) {
+    // items that never become due, call() should only look at the front of the heap
+    for (size_t i = 0; i < count; i++)
+      App.scheduler.set_interval(this, "bench_" + to_string(i), 3600000, []() {});
+    App.scheduler.call();
+    std::string name = "scheduler_call_idle_" + to_string(count);
+    this->run_(name.c_str(), 0, []() { App.scheduler.call(); });
+    for (size_t i = 0; i < count; i++)
+      App.scheduler.cancel_interval(this, "bench_" + to_string(i));
+  }
+  App.scheduler.call();
+
+  uint32_t fired = 0;
+  this->run_("scheduler_timeout_named", 0, [this, &fired]() {
+    App.scheduler.set_timeout(this, "bench", 0, [&fired]() { fired++; });
+    App.scheduler.call();
+  });
+  this->run_("scheduler_timeout_id", 0, [this, &fired]() {
+    App.scheduler.set_timeout(this, 1U, 0, [&fired]() { fired++; });
+    App.scheduler.call();
+  });
+}
+
+void Benchmark::bench_proto_() {
+  std::vector<uint8_t> buffer;
+  buffer.reserve(2048);
+
+  api::SensorStateResponse state;
+  state.key = 0x12345678;
+  state.state = 21.5f;
+  this->run_("proto_encode_sensor_state", 0, [&]() {
+    buffer.clear();
+    state.encode(api::ProtoWriteBuffer(&buffer));
+  });
+
+  api::BluetoothLERawAdvertisementsResponse adverts;
+  for (uint32_t i = 0; i < 16; i++) {
+    api::BluetoothLERawAdvertisement adv;
+    adv.address = 0xA4C138000000ULL + i;
+    adv.rssi = -70;
+    adv.address_type = 0;
+    adv.data.assign(31, char(i));
+    adverts.advertisements.push_back(std::move(adv));
+  }
+  uint32_t size = 0;
+  adverts.calculate_size(size);
+  this->run_("proto_encode_raw_advertisements_16", size, [&]() {
+    buffer.clear();
+    adverts.encode(api::ProtoWriteBuffer(&buffer));
+  });
+  this->run_("proto_calculate_size_raw_advertisements_16", 0, [&]() {
+    uint32_t total = 0;
+    adverts.calculate_size(total);
+    size = total;
+  });
+}
+
+void Benchmark::bench_noise_() {
+#ifdef USE_API_NOISE
+  NoiseCipherState *send_cipher = nullptr;
+  NoiseCipherState *recv_cipher = nullptr;
+  uint8_t key[32];
+  for (size_t i = 0; i < sizeof(key); i++)
+    key[i] = i;
+  if (noise_cipherstate_new_by_id(&send_cipher, NOISE_CIPHER_CHACHAPOLY) != NOISE_ERROR_NONE ||
+      noise_cipherstate_new_by_id(&recv_cipher, NOISE_CIPHER_CHACHAPOLY) != NOISE_ERROR_NONE) {
+    ESP_LOGE(TAG, "Creating noise cipher states failed");
+    return;
+  }
+  noise_cipherstate_init_key(send_cipher, key, sizeof(key));
+  noise_cipherstate_init_key(recv_cipher, key, sizeof(key));
+  size_t mac_len = noise_cipherstate_get_mac_length(send_cipher);
+
+  for (size_t payload : {16, 128, 512, 1400}) {
+    std::vector<uint8_t> frame(payload + mac_len, 0x55);
+    // encrypt and decrypt in one step, the nonces of both cipher states have to stay in sync
+    std::string name = "noise_encrypt_decrypt_" + to_string(payload);
+    this->run_(name.c_str(), payload, [&]() {
+      NoiseBuffer mbuf;
+      noise_buffer_init(mbuf);
+      noise_buffer_set_inout(mbuf, frame.data(), payload, frame.size());
+      noise_cipherstate_encrypt(send_cipher, &mbuf);
+      noise_cipherstate_decrypt(recv_cipher, &mbuf);
+    });
+  }
+  noise_cipherstate_free(send_cipher);
+  noise_cipherstate_free(recv_cipher);
+
+  // same protocol as APINoiseFrameHelper::init_handshake_(), both sides of the NNpsk0 handshake
+  NoiseProtocolId nid{};
+  nid.pattern_id = NOISE_PATTERN_NN;
+  nid.cipher_id = NOISE_CIPHER_CHACHAPOLY;
+  nid.dh_id = NOISE_DH_CURVE25519;
+  nid.prefix_id = NOISE_PREFIX_STANDARD;
+  nid.hybrid_id = NOISE_DH_NONE;
+  nid.hash_id = NOISE_HASH_SHA256;
+  nid.modifier_ids[0] = NOISE_MODIFIER_PSK0;
+  uint32_t failed = 0;
+  this->run_("noise_handshake", 0, [&]() {
+    NoiseHandshakeState *initiator = nullptr;
+    NoiseHandshakeState *responder = nullptr;
+    noise_handshakestate_new_by_id(&initiator, &nid, NOISE_ROLE_INITIATOR);
+    noise_handshakestate_new_by_id(&responder, &nid, NOISE_ROLE_RESPONDER);
+    noise_handshakestate_set_pre_shared_key(initiator, key, sizeof(key));
+    noise_handshakestate_set_pre_shared_key(responder, key, sizeof(key));
+    noise_handshakestate_start(initiator);
+    noise_handshakestate_start(responder);
+    uint8_t message[128];
+    NoiseBuffer mbuf;
+    NoiseHandshakeState *steps[2][2] = {{initiator, responder}, {responder, initiator}};
+    for (auto &step : steps) {
+      noise_buffer_init(mbuf);
+      noise_buffer_set_output(mbuf, message, sizeof(message));
+      if (noise_handshakestate_write_message(step[0], &mbuf, nullptr) != NOISE_ERROR_NONE)
+        failed++;
+      noise_buffer_set_input(mbuf, message, mbuf.size);
+      if (noise_handshakestate_read_message(step[1], &mbuf, nullptr) != NOISE_ERROR_NONE)
+        failed++;
+    }
+    noise_handshakestate_free(initiator);
+    noise_handshakestate_free(responder);
+  });
+  if (failed != 0)
+    ESP_LOGE(TAG, "Noise handshake failed");
+#endif
+}
+
+void Benchmark::bench_sensor_filters_() {
+  // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+  sensor::Sensor chain;
+  chain.add_filters({
+      new sensor::OffsetFilter(-0.5f),
+      new sensor::MultiplyFilter(1.8f),
+      new sensor::MedianFilter(5, 1, 1),
+      new sensor::SlidingWindowMovingAverageFilter(15, 1, 1),
+      new sensor::DeltaFilter(0.0f, false),
+  });
+  sensor::Sensor window;
+  window.add_filter(new sensor::MedianFilter(64, 1, 1));
+  // NOLINTEND(cppcoreguidelines-owning-memory)
+
+  float value = 0.0f;
+  this->run_("sensor_filter_chain", 0, [&]() {
+    value += 0.25f;
+    if (value > 100.0f)
+      value = 0.0f;
+    chain.publish_state(value);
+  });
+  this->run_("sensor_filter_median_64", 0, [&]() {
+    value += 0.37f;
+    if (value > 100.0f)
+      value = 0.0f;
+    window.publish_state(value);
+  });
+}
+
+void Benchmark::bench_display_() {
+  MemoryDisplay display;
+  int width = display.get_width();
+  int height = display.get_height();
+  this->run_("display_fill", 0, [&]() { display.fill(Color(0x80, 0x80, 0x80)); });
+  this->run_("display_line", 0, [&]() { display.line(0, 0, width - 1, height - 1); });
+  this->run_("display_filled_rectangle_64", 0, [&]() { display.filled_rectangle(10, 10, 64, 64); });
+  this->run_("display_filled_circle_32", 0, [&]() { display.filled_circle(width / 2, height / 2, 32); });
+}
+
+void Benchmark::bench_json_() {
+  // same shape as the web_server sensor state events
+  float value = 21.5f;
+  size_t size = 0;
+  this->run_("json_sensor_state", 0, [&]() {
+    std::string data = json::build_json([value](JsonObject root) {
+      root["id"] = "sensor-living_room_temperature";
+      root["value"] = value;
+      root["state"] = value_accuracy_to_string(value, 1) + " °C";
+    });
+    size += data.size();
+  });
+}
+
+void Benchmark::bench_remote_base_() {
+  remote_base::RemoteTransmitData transmit;
+  remote_base::NECData data{0x1234, 0x5678, 1};
+  remote_base::NECProtocol protocol;
+  protocol.encode(&transmit, data);
+  const auto &timings = transmit.get_data();
+  uint32_t decoded = 0;
+  this->run_("remote_base_nec_decode", 0, [&]() {
+    remote_base::RemoteReceiveData src(timings, 25, remote_base::TOLERANCE_MODE_PERCENTAGE);
+    if (protocol.decode(src).has_value())
+      decoded++;
+  });
+  if (decoded == 0)
+    ESP_LOGE(TAG, "NEC frame was not decoded");
+}
+
+}  // namespace benchmark
+}  // namespace esphome
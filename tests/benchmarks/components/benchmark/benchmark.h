@@ -0,0 +1,56 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace esphome {
+namespace benchmark {
+
+/** Runs the micro-benchmarks once the device is up and exits.
+ *
+ * Every result is printed on its own line as "BENCHMARK {json}", so it can be filtered out of the log output.
+ */
+class Benchmark : public Component {
+ public:
+  void loop() override;
+  float get_setup_priority() const override { return setup_priority::LATE; }
+
+  void set_min_time(uint32_t min_time) { this->min_time_ = min_time; }
+
+ protected:
+  /// Call f until at least min_time_ passed and report the mean time per call.
+  template<typename F> void run_(const char *name, size_t bytes_per_op, F &&f) {
+    uint64_t iterations = 0;
+    uint64_t batch = 1;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::nanoseconds elapsed{0};
+    while (elapsed < std::chrono::milliseconds(this->min_time_)) {
+      for (uint64_t i = 0; i < batch; i++)
+        f();
+      iterations += batch;
+      batch *= 2;
+      elapsed = std::chrono::steady_clock::now() - start;
+    }
+    double ns_per_op = double(elapsed.count()) / double(iterations);
+    printf("BENCHMARK {\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.2f,\"bytes_per_op\":%zu}\n", name,
+           (unsigned long long) iterations, ns_per_op, bytes_per_op);
+    fflush(stdout);
+  }
+
+  void bench_scheduler_();
+  void bench_proto_();
+  void bench_noise_();
+  void bench_sensor_filters_();
+  void bench_display_();
+  void bench_json_();
+  void bench_remote_base_();
+
+  uint32_t min_time_{200};
+};
+
+}  // namespace benchmark
+}  // namespace esphome
@@ -3,6 +3,7 @@ from unittest.mock import Mock
 
 from esphome import cpp_helpers as ch
 from esphome import const
+from esphome import cpp_types
 
 
 @pytest.mark.asyncio
@@ -70,3 +71,31 @@ async def test_register_component__with_setup_priority(monkeypatch):
     assert add_mock.call_count == 4
     app_mock.register_component.assert_called_with(var)
     assert core_mock.component_ids == []
+
+
+@pytest.mark.asyncio
+async def test_register_update_group(monkeypatch):
+    id_ = ch.ID("foo", type=ch.PollingComponent)
+    var = Mock(base=id_)
+    bus = Mock()
+
+    add_mock = Mock()
+    monkeypatch.setattr(ch, "add", add_mock)
+
+    await ch.register_update_group(var, {const.CONF_ID: id_}, bus)
+
+    add_mock.assert_called_once()
+    var.set_update_group.assert_called_with(bus)
+
+
+@pytest.mark.asyncio
+async def test_register_update_group__not_polling(monkeypatch):
+    id_ = ch.ID("foo", type=cpp_types.Component)
+    var = Mock(base=id_)
+
+    add_mock = Mock()
+    monkeypatch.setattr(ch, "add", add_mock)
+
+    await ch.register_update_group(var, {const.CONF_ID: id_}, Mock())
+
+    add_mock.assert_not_called()